@@ -35,6 +35,7 @@
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
 #include "core/io/resource_uid.h"
@@ -273,10 +274,69 @@ String ProjectSettings::globalize_path(const String &p_path) const {
 	return p_path;
 }
 
+void ProjectSettings::_add_feature_overrides(const StringName &p_name) {
+	int dot = p_name.operator String().find(".");
+	if (dot == -1) {
+		return;
+	}
+
+	Vector<String> s = p_name.operator String().split(".");
+	for (int i = 1; i < s.size(); i++) {
+		String feature = s[i].strip_edges();
+		Pair<StringName, StringName> feature_override(feature, p_name);
+
+		if (!feature_overrides.has(s[0])) {
+			feature_overrides[s[0]] = LocalVector<Pair<StringName, StringName>>();
+		}
+
+		feature_overrides[s[0]].push_back(feature_override);
+	}
+}
+
+const Variant &ProjectSettings::_get_value(const StringName &p_name, const VariantContainer &p_container) const {
+	if (p_container.encoded_size > 0) {
+		Variant value;
+		Error err = decode_variant(value, binary_settings_ptr + p_container.encoded_offset, p_container.encoded_size, nullptr, true);
+		_clear_encoded_value(p_container);
+		ERR_FAIL_COND_V_MSG(err != OK, p_container.variant, "Error decoding property: " + p_name + ".");
+		p_container.variant = value;
+	}
+	return p_container.variant;
+}
+
+void ProjectSettings::_clear_encoded_value(const VariantContainer &p_container) const {
+	if (p_container.encoded_size == 0) {
+		return;
+	}
+	p_container.encoded_size = 0;
+	encoded_settings_count--;
+	if (encoded_settings_count == 0) {
+		_release_binary_settings();
+	}
+}
+
+void ProjectSettings::_release_binary_settings() const {
+	binary_settings_file.unref();
+	binary_settings.clear();
+	binary_settings_ptr = nullptr;
+}
+
+void ProjectSettings::_decode_all_values() {
+	for (const KeyValue<StringName, VariantContainer> &E : props) {
+		if (encoded_settings_count == 0) {
+			break;
+		}
+		_get_value(E.key, E.value);
+	}
+}
+
 bool ProjectSettings::_set(const StringName &p_name, const Variant &p_value) {
 	_THREAD_SAFE_METHOD_
 
 	if (p_value.get_type() == Variant::NIL) {
+		if (props.has(p_name)) {
+			_clear_encoded_value(props[p_name]);
+		}
 		props.erase(p_name);
 		if (p_name.operator String().begins_with("autoload/")) {
 			String node_name = p_name.operator String().split("/")[1];
@@ -299,25 +359,10 @@ bool ProjectSettings::_set(const StringName &p_name, const Variant &p_value) {
 			return true;
 		}
 
-		{ // Feature overrides.
-			int dot = p_name.operator String().find(".");
-			if (dot != -1) {
-				Vector<String> s = p_name.operator String().split(".");
-
-				for (int i = 1; i < s.size(); i++) {
-					String feature = s[i].strip_edges();
-					Pair<StringName, StringName> feature_override(feature, p_name);
-
-					if (!feature_overrides.has(s[0])) {
-						feature_overrides[s[0]] = LocalVector<Pair<StringName, StringName>>();
-					}
-
-					feature_overrides[s[0]].push_back(feature_override);
-				}
-			}
-		}
+		_add_feature_overrides(p_name);
 
 		if (props.has(p_name)) {
+			_clear_encoded_value(props[p_name]);
 			props[p_name].variant = p_value;
 		} else {
 			props[p_name] = VariantContainer(p_value, last_order++);
@@ -351,7 +396,7 @@ bool ProjectSettings::_get(const StringName &p_name, Variant &r_ret) const {
 		WARN_PRINT("Property not found: " + String(p_name));
 		return false;
 	}
-	r_ret = props[p_name].variant;
+	r_ret = _get_value(p_name, props[p_name]);
 	return true;
 }
 
@@ -375,7 +420,7 @@ Variant ProjectSettings::get_setting_with_override(const StringName &p_name) con
 		WARN_PRINT("Property not found: " + String(name));
 		return Variant();
 	}
-	return props[name].variant;
+	return _get_value(name, props[name]);
 }
 
 struct _VCSort {
@@ -402,7 +447,7 @@ void ProjectSettings::_get_property_list(List<PropertyInfo> *p_list) const {
 		_VCSort vc;
 		vc.name = E.key;
 		vc.order = v->order;
-		vc.type = v->variant.get_type();
+		vc.type = _get_value(E.key, *v).get_type();
 
 		bool internal = v->internal;
 		if (!internal) {
@@ -692,6 +737,14 @@ Error ProjectSettings::setup(const String &p_path, const String &p_main_pack, bo
 
 	Compression::gzip_level = GLOBAL_GET("compression/formats/gzip/compression_level");
 
+	const Dictionary resource_dictionaries = GLOBAL_GET("compression/formats/zstd/resource_dictionaries");
+	for (const Variant *key = resource_dictionaries.next(nullptr); key; key = resource_dictionaries.next(key)) {
+		const String dictionary_path = resource_dictionaries[*key];
+		Vector<uint8_t> dictionary = FileAccess::get_file_as_bytes(dictionary_path);
+		ERR_CONTINUE_MSG(dictionary.is_empty(), "Can't load Zstd dictionary '" + dictionary_path + "'.");
+		FileAccessCompressed::set_type_dictionary(*key, Compression::register_zstd_dictionary(dictionary));
+	}
+
 	load_scene_groups_cache();
 
 	project_loaded = err == OK;
@@ -706,7 +759,7 @@ bool ProjectSettings::has_setting(const String &p_var) const {
 
 Error ProjectSettings::_load_settings_binary(const String &p_path) {
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = FileAccess::open_mapped(p_path, &err);
 	if (err != OK) {
 		return err;
 	}
@@ -715,26 +768,69 @@ Error ProjectSettings::_load_settings_binary(const String &p_path) {
 	f->get_buffer(hdr, 4);
 	ERR_FAIL_COND_V_MSG((hdr[0] != 'E' || hdr[1] != 'C' || hdr[2] != 'F' || hdr[3] != 'G'), ERR_FILE_CORRUPT, "Corrupted header in binary project.binary (not ECFG).");
 
-	uint32_t count = f->get_32();
+	// Values still encoded from a previous load refer to its data.
+	_decode_all_values();
+
+	// Most settings are only decoded when first read, as many are never used at run-time
+	// (e.g. editor-only settings). Keep the file contents around until then, mapped if possible.
+	_release_binary_settings();
+	uint64_t len = f->get_length() - f->get_position();
+	if (f->get_mapped_data()) {
+		binary_settings_file = f;
+		binary_settings_ptr = f->get_mapped_data() + f->get_position();
+	} else {
+		binary_settings.resize(len);
+		f->get_buffer(binary_settings.ptrw(), len);
+		binary_settings_ptr = binary_settings.ptr();
+	}
+
+	const uint8_t *ptr = binary_settings_ptr;
+	uint64_t pos = 4;
+	ERR_FAIL_COND_V_MSG(len < pos, ERR_FILE_CORRUPT, "Truncated binary project.binary.");
+	uint32_t count = decode_uint32(ptr);
 
 	for (uint32_t i = 0; i < count; i++) {
-		uint32_t slen = f->get_32();
-		CharString cs;
-		cs.resize(slen + 1);
-		cs[slen] = 0;
-		f->get_buffer((uint8_t *)cs.ptr(), slen);
+		ERR_FAIL_COND_V_MSG(pos + 4 > len, ERR_FILE_CORRUPT, "Truncated binary project.binary.");
+		uint32_t slen = decode_uint32(ptr + pos);
+		pos += 4;
+		ERR_FAIL_COND_V_MSG(pos + slen + 4 > len, ERR_FILE_CORRUPT, "Truncated binary project.binary.");
 		String key;
-		key.parse_utf8(cs.ptr());
+		key.parse_utf8((const char *)ptr + pos, slen);
+		pos += slen;
+
+		uint32_t vlen = decode_uint32(ptr + pos);
+		pos += 4;
+		ERR_FAIL_COND_V_MSG(pos + vlen > len, ERR_FILE_CORRUPT, "Truncated binary project.binary.");
+
+		// Settings with side effects when set are decoded right away.
+		if (vlen > 0 && key != CoreStringName(_custom_features) && !key.begins_with("autoload/") && !key.begins_with("global_group/")) {
+			StringName name = key;
+			_add_feature_overrides(name);
+			if (props.has(name)) {
+				_clear_encoded_value(props[name]);
+				props[name].variant = Variant();
+			} else {
+				props[name] = VariantContainer(Variant(), last_order++);
+			}
+			props[name].encoded_offset = pos;
+			props[name].encoded_size = vlen;
+			encoded_settings_count++;
+		} else {
+			Variant value;
+			err = decode_variant(value, ptr + pos, vlen, nullptr, true);
+			if (err == OK) {
+				set(key, value);
+			} else {
+				ERR_PRINT("Error decoding property: " + key + ".");
+			}
+		}
+		pos += vlen;
+	}
 
-		uint32_t vlen = f->get_32();
-		Vector<uint8_t> d;
-		d.resize(vlen);
-		f->get_buffer(d.ptrw(), vlen);
-		Variant value;
-		err = decode_variant(value, d.ptr(), d.size(), nullptr, true);
-		ERR_CONTINUE_MSG(err != OK, "Error decoding property: " + key + ".");
-		set(key, value);
+	if (encoded_settings_count == 0) {
+		_release_binary_settings();
 	}
+	_queue_changed();
 
 	return OK;
 }
@@ -1048,7 +1144,7 @@ Error ProjectSettings::save_custom(const String &p_path, const CustomMap &p_cust
 			_VCSort vc;
 			vc.name = G.key; //*k;
 			vc.order = v->order;
-			vc.type = v->variant.get_type();
+			vc.type = _get_value(G.key, *v).get_type();
 			vc.flags = PROPERTY_USAGE_EDITOR | PROPERTY_USAGE_STORAGE;
 			if (v->variant == v->initial) {
 				continue;
@@ -1172,7 +1268,7 @@ bool ProjectSettings::_property_can_revert(const StringName &p_name) const {
 		return false;
 	}
 
-	return props[p_name].initial != props[p_name].variant;
+	return props[p_name].initial != _get_value(p_name, props[p_name]);
 }
 
 bool ProjectSettings::_property_get_revert(const StringName &p_name, Variant &r_property) const {
@@ -1520,6 +1616,7 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "compression/formats/zstd/long_distance_matching"), Compression::zstd_long_distance_matching);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zstd/compression_level", PROPERTY_HINT_RANGE, "1,22,1"), Compression::zstd_level);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zstd/window_log_size", PROPERTY_HINT_RANGE, "10,30,1"), Compression::zstd_window_log_size);
+	GLOBAL_DEF(PropertyInfo(Variant::DICTIONARY, "compression/formats/zstd/resource_dictionaries"), Dictionary());
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/zlib/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::zlib_level);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "compression/formats/gzip/compression_level", PROPERTY_HINT_RANGE, "-1,9,1"), Compression::gzip_level);
 
@@ -1542,6 +1639,7 @@ ProjectSettings::ProjectSettings() {
 
 	GLOBAL_DEF_BASIC("gui/common/snap_controls_to_pixels", true);
 	GLOBAL_DEF_BASIC("gui/fonts/dynamic_fonts/use_oversampling", true);
+	GLOBAL_DEF("gui/fonts/dynamic_fonts/persistent_glyph_cache", false);
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/rendering_device/vsync/frame_queue_size", PROPERTY_HINT_RANGE, "2,3,1"), 2);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/rendering_device/vsync/swapchain_image_count", PROPERTY_HINT_RANGE, "2,4,1"), 3);
@@ -1549,7 +1647,9 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/staging_buffer/max_size_mb", PROPERTY_HINT_RANGE, "1,1024,1,or_greater"), 128);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/staging_buffer/texture_upload_region_size_px", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), 64);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::BOOL, "rendering/rendering_device/pipeline_cache/enable"), true);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::BOOL, "rendering/rendering_device/pipeline_cache/prewarm_manifest"), true);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/rendering_device/pipeline_cache/save_chunk_size_mb", PROPERTY_HINT_RANGE, "0.000001,64.0,0.001,or_greater"), 3.0);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/rendering_device/secondary_command_buffers_per_frame", PROPERTY_HINT_RANGE, "0,64,1,or_greater"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/vulkan/max_descriptors_per_pool", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), 64);
 
 	GLOBAL_DEF_RST("rendering/rendering_device/d3d12/max_resource_descriptors_per_frame", 16384);
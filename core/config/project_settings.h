@@ -32,6 +32,9 @@
 #define PROJECT_SETTINGS_H
 
 #include "core/object/class_db.h"
+#include "core/object/ref_counted.h"
+
+class FileAccess;
 
 template <typename T>
 class TypedArray;
@@ -69,13 +72,16 @@ protected:
 		bool persist = false;
 		bool basic = false;
 		bool internal = false;
-		Variant variant;
+		mutable Variant variant; // Decoded on first access when loaded lazily, see `_get_value()`.
 		Variant initial;
 		bool hide_from_editor = false;
 		bool restart_if_changed = false;
 #ifdef DEBUG_METHODS_ENABLED
 		bool ignore_value_in_docs = false;
 #endif
+		// Location of the still encoded value in `binary_settings`, unused once `encoded_size` is 0.
+		mutable uint32_t encoded_offset = 0;
+		mutable uint32_t encoded_size = 0;
 
 		VariantContainer() {}
 
@@ -91,6 +97,12 @@ protected:
 	uint64_t last_save_time = 0;
 
 	RBMap<StringName, VariantContainer> props; // NOTE: Key order is used e.g. in the save_custom method.
+	// The contents of project.binary, kept while some of its settings haven't been decoded yet. The file stays open
+	// when it is memory-mapped, otherwise it is copied to `binary_settings`.
+	mutable Ref<FileAccess> binary_settings_file;
+	mutable Vector<uint8_t> binary_settings;
+	mutable const uint8_t *binary_settings_ptr = nullptr;
+	mutable uint32_t encoded_settings_count = 0;
 	String resource_path;
 	HashMap<StringName, PropertyInfo> custom_prop_info;
 	bool using_datapack = false;
@@ -119,6 +131,12 @@ protected:
 	void _queue_changed();
 	void _emit_changed();
 
+	const Variant &_get_value(const StringName &p_name, const VariantContainer &p_container) const;
+	void _clear_encoded_value(const VariantContainer &p_container) const;
+	void _release_binary_settings() const;
+	void _decode_all_values();
+	void _add_feature_overrides(const StringName &p_name);
+
 	static ProjectSettings *singleton;
 
 	Error _load_settings_text(const String &p_path);
@@ -62,6 +62,11 @@ public:
 		THREAD_LOAD_LOADED
 	};
 
+	enum ThreadLoadPriority {
+		THREAD_LOAD_PRIORITY_NORMAL,
+		THREAD_LOAD_PRIORITY_HIGH,
+	};
+
 	enum CacheMode {
 		CACHE_MODE_IGNORE,
 		CACHE_MODE_REUSE,
@@ -75,6 +80,8 @@ public:
 	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	ThreadLoadStatus load_threaded_get_status(const String &p_path, Array r_progress = Array());
 	Ref<Resource> load_threaded_get(const String &p_path);
+	Error load_threaded_set_priority(const String &p_path, ThreadLoadPriority p_priority);
+	Error load_threaded_cancel(const String &p_path);
 
 	Ref<Resource> load(const String &p_path, const String &p_type_hint = "", CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	Vector<String> get_recognized_extensions_for_type(const String &p_type);
@@ -605,6 +612,7 @@ public:
 } // namespace core_bind
 
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::ThreadLoadStatus);
+VARIANT_ENUM_CAST(core_bind::ResourceLoader::ThreadLoadPriority);
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::CacheMode);
 
 VARIANT_BITFIELD_CAST(core_bind::ResourceSaver::SaverFlags);
@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*  engine_trace.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "engine_trace.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+SafeFlag EngineTrace::recording;
+BinaryMutex EngineTrace::buffers_mutex;
+LocalVector<EngineTrace::ThreadBuffer *> EngineTrace::buffers;
+uint64_t EngineTrace::start_time = 0;
+
+thread_local EngineTrace::ThreadBuffer *EngineTrace::thread_buffer = nullptr;
+thread_local String EngineTrace::thread_name;
+
+EngineTrace::ThreadBuffer *EngineTrace::_get_thread_buffer() {
+	if (unlikely(!thread_buffer)) {
+		ThreadBuffer *buffer = memnew(ThreadBuffer);
+		buffer->thread_id = Thread::get_caller_id();
+		buffer->thread_name = thread_name;
+
+		MutexLock lock(buffers_mutex);
+		buffers.push_back(buffer);
+		thread_buffer = buffer;
+	}
+	return thread_buffer;
+}
+
+uint64_t EngineTrace::get_time() {
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void EngineTrace::add_zone(const char *p_name, const String &p_detail, uint64_t p_begin) {
+	const uint64_t end = get_time();
+	ThreadBuffer *buffer = _get_thread_buffer();
+
+	buffer->lock.lock();
+	if (likely(buffer->events.size() < MAX_EVENTS_PER_THREAD)) {
+		Event event;
+		event.name = p_name;
+		event.detail = p_detail;
+		event.begin = p_begin;
+		event.end = end;
+		buffer->events.push_back(event);
+	} else {
+		buffer->dropped++;
+	}
+	buffer->lock.unlock();
+}
+
+void EngineTrace::set_thread_name(const String &p_name) {
+	thread_name = p_name;
+	if (thread_buffer) {
+		thread_buffer->lock.lock();
+		thread_buffer->thread_name = p_name;
+		thread_buffer->lock.unlock();
+	}
+}
+
+void EngineTrace::start() {
+	clear();
+	start_time = get_time();
+	recording.set();
+}
+
+void EngineTrace::stop() {
+	recording.clear();
+}
+
+Error EngineTrace::save(const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_CREATE, "Cannot write the engine trace to '" + p_path + "'.");
+
+	const int pid = OS::get_singleton()->get_process_id();
+	uint64_t dropped = 0;
+
+	// Written as it goes rather than through JSON, traces can hold millions of events.
+	f->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		buffer->lock.lock();
+		const LocalVector<Event> events = buffer->events;
+		const String name = buffer->thread_name;
+		dropped += buffer->dropped;
+		buffer->lock.unlock();
+
+		const String tid = itos(buffer->thread_id);
+		if (!name.is_empty()) {
+			f->store_string(vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%s,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", pid, tid, name.json_escape()));
+			first = false;
+		}
+
+		for (const Event &E : events) {
+			if (E.begin < start_time) {
+				continue; // Started before the recording.
+			}
+			String line = vformat("%s{\"name\":\"%s\",\"cat\":\"engine\",\"ph\":\"X\",\"ts\":%d,\"dur\":%d,\"pid\":%d,\"tid\":%s", first ? "" : ",\n", String(E.name).json_escape(), E.begin - start_time, E.end - E.begin, pid, tid);
+			if (!E.detail.is_empty()) {
+				line += ",\"args\":{\"detail\":\"" + E.detail.json_escape() + "\"}";
+			}
+			f->store_string(line + "}");
+			first = false;
+		}
+	}
+
+	f->store_string("\n]}\n");
+
+	if (dropped > 0) {
+		WARN_PRINT(vformat("The engine trace was full, %d zones were dropped.", dropped));
+	}
+	return OK;
+}
+
+void EngineTrace::clear() {
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		buffer->lock.lock();
+		buffer->events.clear();
+		buffer->dropped = 0;
+		buffer->lock.unlock();
+	}
+}
+
+void EngineTrace::finish() {
+	recording.clear();
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete(buffer);
+	}
+	buffers.reset();
+	thread_buffer = nullptr;
+}
@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  engine_trace.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ENGINE_TRACE_H
+#define ENGINE_TRACE_H
+
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Lightweight scoped-zone tracing, exported in the Chrome trace event format
+// (which Perfetto reads as well). Zones are recorded per thread, so stalls
+// between threads show up as gaps on the timeline.
+//
+// Zone names must be string literals, or otherwise outlive the recording.
+// When not recording, a zone costs a single atomic load.
+class EngineTrace {
+	struct Event {
+		const char *name = nullptr;
+		String detail;
+		uint64_t begin = 0;
+		uint64_t end = 0;
+	};
+
+	struct ThreadBuffer {
+		Thread::ID thread_id = 0;
+		String thread_name;
+		SpinLock lock;
+		LocalVector<Event> events;
+		uint64_t dropped = 0;
+	};
+
+	static const uint32_t MAX_EVENTS_PER_THREAD = 1 << 20;
+
+	static SafeFlag recording;
+	static BinaryMutex buffers_mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+	static uint64_t start_time;
+
+	static thread_local ThreadBuffer *thread_buffer;
+	static thread_local String thread_name;
+
+	static ThreadBuffer *_get_thread_buffer();
+
+public:
+	_ALWAYS_INLINE_ static bool is_recording() { return recording.is_set(); }
+
+	static uint64_t get_time();
+	static void add_zone(const char *p_name, const String &p_detail, uint64_t p_begin);
+
+	// Named threads are easier to tell apart in trace viewers.
+	static void set_thread_name(const String &p_name);
+
+	static void start();
+	static void stop();
+	static Error save(const String &p_path);
+	static void clear();
+
+	// Frees the per-thread buffers, only once no other thread records anymore.
+	static void finish();
+};
+
+class EngineTraceZone {
+	const char *name = nullptr;
+	String detail;
+	uint64_t begin = 0;
+
+public:
+	_ALWAYS_INLINE_ EngineTraceZone(const char *p_name) {
+		if (unlikely(EngineTrace::is_recording())) {
+			name = p_name;
+			begin = EngineTrace::get_time();
+		}
+	}
+
+	_ALWAYS_INLINE_ EngineTraceZone(const char *p_name, const String &p_detail) {
+		if (unlikely(EngineTrace::is_recording())) {
+			name = p_name;
+			detail = p_detail;
+			begin = EngineTrace::get_time();
+		}
+	}
+
+	_ALWAYS_INLINE_ ~EngineTraceZone() {
+		if (unlikely(name)) {
+			EngineTrace::add_zone(name, detail, begin);
+		}
+	}
+};
+
+#define _TRACE_ZONE_CONCAT_IMPL(m_a, m_b) m_a##m_b
+#define _TRACE_ZONE_CONCAT(m_a, m_b) _TRACE_ZONE_CONCAT_IMPL(m_a, m_b)
+#define _TRACE_ZONE_VAR _TRACE_ZONE_CONCAT(_trace_zone_, __LINE__)
+
+// Records a zone from this point until the end of the enclosing scope.
+#define TRACE_ZONE(m_name) EngineTraceZone _TRACE_ZONE_VAR(m_name)
+// Same as above, with a per-zone detail (e.g. a path) shown as its argument.
+#define TRACE_ZONE_DETAIL(m_name, m_detail) EngineTraceZone _TRACE_ZONE_VAR(m_name, m_detail)
+
+#endif // ENGINE_TRACE_H
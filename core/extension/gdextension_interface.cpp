@@ -1222,6 +1222,20 @@ static void gdextension_object_method_bind_ptrcall(GDExtensionMethodBindPtr p_me
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdextension_object_method_bind_ptrcall_batch(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *p_args, GDExtensionInt p_arg_count, const GDExtensionTypePtr *r_rets, GDExtensionInt p_call_count) {
+	const MethodBind *mb = reinterpret_cast<const MethodBind *>(p_method_bind);
+	ERR_FAIL_NULL(mb);
+	ERR_FAIL_COND_MSG(p_arg_count != mb->get_argument_count(), vformat("Batched call to method '%s' expects %d arguments per call, got %d.", mb->get_name(), mb->get_argument_count(), p_arg_count));
+	ERR_FAIL_COND_MSG(mb->has_return() && r_rets == nullptr, vformat("Batched call to method '%s' needs storage for the return values.", mb->get_name()));
+	ERR_FAIL_COND_MSG(!mb->is_static() && p_instances == nullptr, vformat("Batched call to non-static method '%s' needs instances.", mb->get_name()));
+
+	const void **args = (const void **)p_args;
+	for (GDExtensionInt i = 0; i < p_call_count; i++) {
+		Object *o = p_instances ? (Object *)p_instances[i] : nullptr;
+		mb->ptrcall(o, args + i * p_arg_count, r_rets ? r_rets[i] : nullptr);
+	}
+}
+
 static void gdextension_object_destroy(GDExtensionObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1674,6 +1688,7 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(dictionary_operator_index_const);
 	REGISTER_INTERFACE_FUNC(object_method_bind_call);
 	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall);
+	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall_batch);
 	REGISTER_INTERFACE_FUNC(object_destroy);
 	REGISTER_INTERFACE_FUNC(global_get_singleton);
 	REGISTER_INTERFACE_FUNC(object_get_instance_binding);
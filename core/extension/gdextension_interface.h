@@ -2367,6 +2367,24 @@ typedef void (*GDExtensionInterfaceObjectMethodBindCall)(GDExtensionMethodBindPt
  */
 typedef void (*GDExtensionInterfaceObjectMethodBindPtrcall)(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_ret);
 
+/**
+ * @name object_method_bind_ptrcall_batch
+ * @since 4.4
+ *
+ * Calls a method on several Objects (using a "ptrcall"), crossing the extension boundary only once.
+ *
+ * The arguments of all calls are laid out one call after the other, so the arguments of the call at index `i`
+ * start at `p_args[i * p_arg_count]`.
+ *
+ * @param p_method_bind A pointer to the MethodBind representing the method on the Objects' class.
+ * @param p_instances A pointer to a C array of `p_call_count` Objects, or NULL to call a static method.
+ * @param p_args A pointer to a C array of `p_call_count * p_arg_count` pointers representing the arguments.
+ * @param p_arg_count The number of arguments of each call.
+ * @param r_rets A pointer to a C array of `p_call_count` pointers that will receive the return values, or NULL if the method doesn't return anything.
+ * @param p_call_count The number of calls to perform.
+ */
+typedef void (*GDExtensionInterfaceObjectMethodBindPtrcallBatch)(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *p_args, GDExtensionInt p_arg_count, const GDExtensionTypePtr *r_rets, GDExtensionInt p_call_count);
+
 /**
  * @name object_destroy
  * @since 4.1
@@ -32,6 +32,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/zip_io.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 
 #include "thirdparty/misc/fastlz.h"
 
@@ -349,6 +351,113 @@ int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_s
 	}
 }
 
+struct ZstdDictionary {
+	Vector<uint8_t> data;
+	ZSTD_CDict *cdict = nullptr; // Only created once something is compressed with it, which exported projects rarely do.
+	ZSTD_DDict *ddict = nullptr;
+};
+
+static Mutex zstd_dictionary_mutex;
+static HashMap<uint32_t, ZstdDictionary *> zstd_dictionaries;
+
+static ZstdDictionary *_get_zstd_dictionary(uint32_t p_dictionary_id) {
+	MutexLock lock(zstd_dictionary_mutex);
+	ZstdDictionary **dictionary = zstd_dictionaries.getptr(p_dictionary_id);
+	return dictionary ? *dictionary : nullptr;
+}
+
+uint32_t Compression::register_zstd_dictionary(const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_V(p_dictionary.is_empty(), 0);
+
+	uint32_t id = hash_murmur3_buffer(p_dictionary.ptr(), p_dictionary.size());
+	if (id == 0) {
+		id = 1; // Zero stands for no dictionary.
+	}
+
+	MutexLock lock(zstd_dictionary_mutex);
+	ZstdDictionary **existing = zstd_dictionaries.getptr(id);
+	if (existing) {
+		ERR_FAIL_COND_V_MSG((*existing)->data != p_dictionary, 0, "A different Zstd dictionary with the same ID is already registered.");
+		return id;
+	}
+
+	// Both trained dictionaries and raw content are accepted.
+	ZSTD_DDict *ddict = ZSTD_createDDict(p_dictionary.ptr(), p_dictionary.size());
+	ERR_FAIL_NULL_V_MSG(ddict, 0, "Invalid Zstd dictionary.");
+
+	ZstdDictionary *dictionary = memnew(ZstdDictionary);
+	dictionary->data = p_dictionary;
+	dictionary->ddict = ddict;
+	zstd_dictionaries.insert(id, dictionary);
+	return id;
+}
+
+bool Compression::has_zstd_dictionary(uint32_t p_dictionary_id) {
+	return _get_zstd_dictionary(p_dictionary_id) != nullptr;
+}
+
+void Compression::clear_zstd_dictionaries() {
+	MutexLock lock(zstd_dictionary_mutex);
+	for (KeyValue<uint32_t, ZstdDictionary *> &E : zstd_dictionaries) {
+		if (E.value->cdict) {
+			ZSTD_freeCDict(E.value->cdict);
+		}
+		ZSTD_freeDDict(E.value->ddict);
+		memdelete(E.value);
+	}
+	zstd_dictionaries.clear();
+}
+
+Vector<uint8_t> Compression::build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size) {
+	ERR_FAIL_COND_V(p_samples.is_empty() || p_max_size <= 0, Vector<uint8_t>());
+
+	// The dictionary trainer isn't part of the bundled library, so this builds a raw content dictionary instead.
+	// It takes the start of each sample, which is where files of the same type repeat the most (headers, class and property names).
+	int share = MAX(p_max_size / p_samples.size(), 1);
+	Vector<uint8_t> dictionary;
+	for (const Vector<uint8_t> &sample : p_samples) {
+		int length = MIN(MIN(sample.size(), share), p_max_size - dictionary.size());
+		if (length <= 0) {
+			continue;
+		}
+		int ofs = dictionary.size();
+		dictionary.resize(ofs + length);
+		memcpy(dictionary.ptrw() + ofs, sample.ptr(), length);
+	}
+
+	return dictionary;
+}
+
+int Compression::compress_with_dictionary(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, uint32_t p_dictionary_id) {
+	ZstdDictionary *dictionary = _get_zstd_dictionary(p_dictionary_id);
+	ERR_FAIL_NULL_V_MSG(dictionary, -1, "Zstd dictionary " + itos(p_dictionary_id) + " is not registered.");
+
+	const ZSTD_CDict *cdict;
+	{
+		MutexLock lock(zstd_dictionary_mutex);
+		if (!dictionary->cdict) {
+			dictionary->cdict = ZSTD_createCDict(dictionary->data.ptr(), dictionary->data.size(), zstd_level);
+		}
+		cdict = dictionary->cdict;
+	}
+	ERR_FAIL_NULL_V(cdict, -1);
+
+	ZSTD_CCtx *cctx = ZSTD_createCCtx();
+	size_t ret = ZSTD_compress_usingCDict(cctx, p_dst, get_max_compressed_buffer_size(p_src_size, MODE_ZSTD), p_src, p_src_size, cdict);
+	ZSTD_freeCCtx(cctx);
+	return ZSTD_isError(ret) ? -1 : (int)ret;
+}
+
+int Compression::decompress_with_dictionary(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, uint32_t p_dictionary_id) {
+	ZstdDictionary *dictionary = _get_zstd_dictionary(p_dictionary_id);
+	ERR_FAIL_NULL_V_MSG(dictionary, -1, "Zstd dictionary " + itos(p_dictionary_id) + " is not registered.");
+
+	ZSTD_DCtx *dctx = ZSTD_createDCtx();
+	size_t ret = ZSTD_decompress_usingDDict(dctx, p_dst, p_dst_max_size, p_src, p_src_size, dictionary->ddict);
+	ZSTD_freeDCtx(dctx);
+	return ZSTD_isError(ret) ? -1 : (int)ret;
+}
+
 int Compression::zlib_level = Z_DEFAULT_COMPRESSION;
 int Compression::gzip_level = Z_DEFAULT_COMPRESSION;
 int Compression::zstd_level = 3;
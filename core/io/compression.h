@@ -55,6 +55,16 @@ public:
 	static int get_max_compressed_buffer_size(int p_src_size, Mode p_mode = MODE_ZSTD);
 	static int decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, Mode p_mode = MODE_ZSTD);
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_size, const uint8_t *p_src, int p_src_size, Mode p_mode);
+
+	// Zstd dictionaries are identified by a hash of their content, so data compressed with one can only be decoded by the same dictionary.
+	// They stay registered until shutdown, which lets any thread use them without holding a reference.
+	static uint32_t register_zstd_dictionary(const Vector<uint8_t> &p_dictionary);
+	static bool has_zstd_dictionary(uint32_t p_dictionary_id);
+	static void clear_zstd_dictionaries();
+	static Vector<uint8_t> build_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size = 112640);
+
+	static int compress_with_dictionary(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, uint32_t p_dictionary_id);
+	static int decompress_with_dictionary(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size, uint32_t p_dictionary_id);
 };
 
 #endif // COMPRESSION_H
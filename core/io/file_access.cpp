@@ -36,6 +36,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = {};
@@ -116,6 +117,90 @@ Ref<FileAccess> FileAccess::open(const String &p_path, int p_mode_flags, Error *
 	return ret;
 }
 
+struct FileAccess::AsyncReadRequest {
+	Ref<FileAccess> file;
+	uint64_t position = 0;
+	uint8_t *dst = nullptr;
+	uint64_t length = 0;
+	uint64_t read = 0;
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+};
+
+void FileAccess::_async_read_task(void *p_userdata) {
+	AsyncReadRequest *request = (AsyncReadRequest *)p_userdata;
+	request->read = request->file->get_buffer_at(request->position, request->dst, request->length);
+}
+
+uint64_t FileAccess::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) {
+	uint64_t prev_position = get_position();
+	seek(p_position);
+	uint64_t read = get_buffer(p_dst, p_length);
+	seek(prev_position);
+	return read;
+}
+
+FileAccess::AsyncReadID FileAccess::read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, nullptr);
+
+	AsyncReadRequest *request = memnew(AsyncReadRequest);
+	request->file = Ref<FileAccess>(this);
+	request->position = p_position;
+	request->dst = p_dst;
+	request->length = p_length;
+
+	if (is_positional_read_supported() && WorkerThreadPool::get_singleton()) {
+		// Low priority, so blocking reads only ever occupy the threads reserved for that.
+		request->task_id = WorkerThreadPool::get_singleton()->add_native_task(&FileAccess::_async_read_task, request, false, "FileAccess async read");
+	} else {
+		_async_read_task(request);
+	}
+
+	return request;
+}
+
+bool FileAccess::is_async_read_completed(AsyncReadID p_id) const {
+	ERR_FAIL_NULL_V(p_id, true);
+	return p_id->task_id == WorkerThreadPool::INVALID_TASK_ID || WorkerThreadPool::get_singleton()->is_task_completed(p_id->task_id);
+}
+
+uint64_t FileAccess::wait_for_async_read(AsyncReadID p_id) {
+	ERR_FAIL_NULL_V(p_id, 0);
+	ERR_FAIL_COND_V_MSG(p_id->file.ptr() != this, 0, "Async read request belongs to another file.");
+
+	if (p_id->task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_id->task_id);
+	}
+
+	uint64_t read = p_id->read;
+	memdelete(p_id);
+	return read;
+}
+
+Ref<FileAccess> FileAccess::open_mapped(const String &p_path, Error *r_error) {
+	Ref<FileAccess> ret;
+	if (PackedData::get_singleton() && !PackedData::get_singleton()->is_disabled()) {
+		ret = PackedData::get_singleton()->try_open_path(p_path);
+		if (ret.is_valid()) {
+			if (r_error) {
+				*r_error = OK;
+			}
+			return ret;
+		}
+	}
+
+	ret = create_for_path(p_path);
+	Error err = ret->open_mapped_internal(p_path);
+
+	if (r_error) {
+		*r_error = err;
+	}
+	if (err != OK) {
+		ret.unref();
+	}
+
+	return ret;
+}
+
 Ref<FileAccess> FileAccess::_open(const String &p_path, ModeFlags p_mode_flags) {
 	Error err = OK;
 	Ref<FileAccess> fa = open(p_path, p_mode_flags, &err);
@@ -104,6 +104,7 @@ protected:
 	AccessType get_access_type() const;
 	virtual String fix_path(const String &p_path) const;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) = 0; ///< open a file
+	virtual Error open_mapped_internal(const String &p_path) { return open_internal(p_path, READ); } ///< open a file read-only, memory-mapping it if supported
 	virtual uint64_t _get_modified_time(const String &p_file) = 0;
 	virtual void _set_access_type(AccessType p_access);
 
@@ -122,6 +123,9 @@ private:
 
 	static Ref<FileAccess> _open(const String &p_path, ModeFlags p_mode_flags);
 
+	struct AsyncReadRequest;
+	static void _async_read_task(void *p_userdata);
+
 public:
 	static void set_file_close_fail_notify_callback(FileCloseFailNotify p_cbk) { close_fail_notify = p_cbk; }
 
@@ -149,6 +153,20 @@ public:
 	Variant get_var(bool p_allow_objects = false) const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
+	virtual const uint8_t *get_mapped_data() const { return nullptr; } ///< contents of the whole file if it is memory-mapped, valid while the file stays open
+
+	virtual bool is_positional_read_supported() const { return false; } ///< true if get_buffer_at() is thread-safe and leaves the position untouched
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length); ///< read at an absolute position, without changing the current one
+
+	/**
+	 * Asynchronous reads run get_buffer_at() on the WorkerThreadPool, so many of them can be in flight at once.
+	 * Files without positional read support are read synchronously when the request is made.
+	 * Every request must be waited on exactly once, and the destination must stay valid until then.
+	 */
+	typedef AsyncReadRequest *AsyncReadID;
+	AsyncReadID read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length);
+	bool is_async_read_completed(AsyncReadID p_id) const;
+	uint64_t wait_for_async_read(AsyncReadID p_id); ///< returns the amount of bytes read
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
 	virtual String get_line() const;
 	virtual String get_token() const;
@@ -198,6 +216,7 @@ public:
 	static Ref<FileAccess> create(AccessType p_access); /// Create a file access (for the current platform) this is the only portable way of accessing files.
 	static Ref<FileAccess> create_for_path(const String &p_path);
 	static Ref<FileAccess> open(const String &p_path, int p_mode_flags, Error *r_error = nullptr); /// Create a file access (for the current platform) this is the only portable way of accessing files.
+	static Ref<FileAccess> open_mapped(const String &p_path, Error *r_error = nullptr); /// Same as open() in READ mode, but memory-maps the file where the platform supports it.
 
 	static Ref<FileAccess> open_encrypted(const String &p_path, ModeFlags p_mode_flags, const Vector<uint8_t> &p_key);
 	static Ref<FileAccess> open_encrypted_pass(const String &p_path, ModeFlags p_mode_flags, const String &p_pass);
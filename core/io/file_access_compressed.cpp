@@ -30,14 +30,42 @@
 
 #include "file_access_compressed.h"
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
-void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+static Mutex type_dictionary_mutex;
+static HashMap<String, uint32_t> type_dictionaries;
+
+void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size, uint32_t p_dictionary_id) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
 
 	cmode = p_mode;
 	block_size = p_block_size;
+	dictionary_id = 0;
+	if (p_dictionary_id != 0) {
+		ERR_FAIL_COND_MSG(p_mode != Compression::MODE_ZSTD, "Compression dictionaries are only supported with Zstd.");
+		ERR_FAIL_COND_MSG(!Compression::has_zstd_dictionary(p_dictionary_id), "Zstd dictionary " + itos(p_dictionary_id) + " is not registered.");
+		dictionary_id = p_dictionary_id;
+	}
+}
+
+void FileAccessCompressed::set_type_dictionary(const String &p_type, uint32_t p_dictionary_id) {
+	MutexLock lock(type_dictionary_mutex);
+	if (p_dictionary_id == 0) {
+		type_dictionaries.erase(p_type);
+	} else {
+		type_dictionaries[p_type] = p_dictionary_id;
+	}
+}
+
+uint32_t FileAccessCompressed::get_type_dictionary(const String &p_type) {
+	MutexLock lock(type_dictionary_mutex);
+	const uint32_t *id = type_dictionaries.getptr(p_type);
+	return id ? *id : 0;
 }
 
 #define WRITE_FIT(m_bytes)                                  \
@@ -54,13 +82,22 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
-	cmode = (Compression::Mode)f->get_32();
+	uint32_t mode = f->get_32();
+	cmode = (Compression::Mode)(mode & ~MODE_FLAG_DICTIONARY);
 	block_size = f->get_32();
 	if (block_size == 0) {
 		f.unref();
 		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Can't open compressed file '" + p_base->get_path() + "' with block size 0, it is corrupted.");
 	}
 	read_total = f->get_32();
+	dictionary_id = 0;
+	if (mode & MODE_FLAG_DICTIONARY) {
+		dictionary_id = f->get_32();
+		if (cmode != Compression::MODE_ZSTD || !Compression::has_zstd_dictionary(dictionary_id)) {
+			f.unref();
+			ERR_FAIL_V_MSG(ERR_FILE_MISSING_DEPENDENCIES, "Can't open compressed file '" + p_base->get_path() + "', Zstd dictionary " + itos(dictionary_id) + " is not registered.");
+		}
+	}
 	uint32_t bc = (read_total / block_size) + 1;
 	uint64_t acc_ofs = f->get_position() + bc * 4;
 	uint32_t max_bs = 0;
@@ -76,17 +113,115 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
 	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
-	at_end = false;
-	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
-
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
 	read_block = 0;
+	read_block_size = _get_block_size(0);
 	read_pos = 0;
+	loaded_block = UINT32_MAX;
+	at_end = read_total == 0;
+	read_eof = false;
+
+	return _load_block(0) ? OK : ERR_FILE_CORRUPT;
+}
+
+int FileAccessCompressed::_decompress_block(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size) const {
+	if (dictionary_id != 0) {
+		return Compression::decompress_with_dictionary(p_dst, p_dst_max_size, p_src, p_src_size, dictionary_id);
+	}
+	return Compression::decompress(p_dst, p_dst_max_size, p_src, p_src_size, cmode);
+}
+
+bool FileAccessCompressed::_load_block(uint32_t p_block) const {
+	if (loaded_block == p_block) {
+		return true;
+	}
+
+	const ReadBlock &rb = read_blocks[p_block];
+	if (f->get_position() != rb.offset) {
+		f->seek(rb.offset);
+	}
+	loaded_block = UINT32_MAX;
+	if (f->get_buffer(comp_buffer.ptrw(), rb.csize) != rb.csize) {
+		return false;
+	}
+	if (_decompress_block(buffer.ptrw(), block_size, comp_buffer.ptr(), rb.csize) == -1) {
+		return false;
+	}
+	loaded_block = p_block;
+	return true;
+}
+
+void FileAccessCompressed::_check_block_end() const {
+	if (read_pos < read_block_size) {
+		return;
+	}
+	// The last block is empty when the size is a multiple of the block size, so it is never entered.
+	if (read_block + 1 < read_block_count && _get_block_size(read_block + 1) > 0) {
+		read_block++;
+		read_block_size = _get_block_size(read_block);
+		read_pos = 0;
+	} else {
+		at_end = true;
+	}
+}
+
+uint32_t FileAccessCompressed::_get_parallel_block_count(uint64_t p_length) const {
+	if (read_pos != 0 || p_length < (uint64_t)block_size * PARALLEL_MIN_BLOCKS || !WorkerThreadPool::get_singleton()) {
+		return 0;
+	}
+
+	// Only whole blocks go straight into the destination, the remainder is read through the block buffer.
+	uint32_t count = 0;
+	uint64_t length = 0;
+	while (read_block + count < read_block_count) {
+		uint32_t size = _get_block_size(read_block + count);
+		if (size == 0 || length + size > p_length) {
+			break;
+		}
+		length += size;
+		count++;
+	}
+
+	return count >= PARALLEL_MIN_BLOCKS ? count : 0;
+}
+
+void FileAccessCompressed::_decompress_block_task(void *p_userdata, uint32_t p_index) {
+	ParallelRead *pr = (ParallelRead *)p_userdata;
+	const FileAccessCompressed *fac = pr->file;
+	uint32_t block = pr->first_block + p_index;
+	const ReadBlock &rb = fac->read_blocks[block];
+	int size = fac->_get_block_size(block);
+
+	int ret = fac->_decompress_block(pr->dst + (uint64_t)p_index * fac->block_size, size, pr->src + (rb.offset - pr->src_offset), rb.csize);
+	if (ret != size) {
+		pr->failed.set();
+	}
+}
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+bool FileAccessCompressed::_decompress_blocks_parallel(uint32_t p_first_block, uint32_t p_count, uint8_t *p_dst) const {
+	// Blocks are stored back to back, so their compressed data is read in one go.
+	const ReadBlock &first = read_blocks[p_first_block];
+	const ReadBlock &last = read_blocks[p_first_block + p_count - 1];
+	LocalVector<uint8_t> src;
+	src.resize(last.offset + last.csize - first.offset);
+	if (f->get_position() != first.offset) {
+		f->seek(first.offset);
+	}
+	if (f->get_buffer(src.ptr(), src.size()) != src.size()) {
+		return false;
+	}
+
+	ParallelRead pr;
+	pr.file = this;
+	pr.first_block = p_first_block;
+	pr.src = src.ptr();
+	pr.src_offset = first.offset;
+	pr.dst = p_dst;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_decompress_block_task, &pr, p_count, -1, true, SNAME("FileAccessCompressed"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	return !pr.failed.is_set();
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -135,9 +270,13 @@ void FileAccessCompressed::_close() {
 
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
+		f->store_32(dictionary_id != 0 ? (cmode | MODE_FLAG_DICTIONARY) : cmode); //write compression mode 4
 		f->store_32(block_size); //write block size 4
 		f->store_32(write_max); //max amount of data written 4
+		if (dictionary_id != 0) {
+			f->store_32(dictionary_id); //dictionary the blocks were compressed with 4
+		}
+		uint64_t table_ofs = f->get_position();
 		uint32_t bc = (write_max / block_size) + 1;
 
 		for (uint32_t i = 0; i < bc; i++) {
@@ -151,13 +290,13 @@ void FileAccessCompressed::_close() {
 
 			Vector<uint8_t> cblock;
 			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+			int s = dictionary_id != 0 ? Compression::compress_with_dictionary(cblock.ptrw(), bp, bl, dictionary_id) : Compression::compress(cblock.ptrw(), bp, bl, cmode);
 
 			f->store_buffer(cblock.ptr(), s);
 			block_sizes.push_back(s);
 		}
 
-		f->seek(16); //ok write block sizes
+		f->seek(table_ofs); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(block_sizes[i]);
 		}
@@ -204,23 +343,11 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 
 	} else {
 		ERR_FAIL_COND(p_position > read_total);
-		if (p_position == read_total) {
-			at_end = true;
-		} else {
-			at_end = false;
-			read_eof = false;
-			uint32_t block_idx = p_position / block_size;
-			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-			}
-
-			read_pos = p_position % block_size;
-		}
+		at_end = p_position == read_total;
+		read_eof = false;
+		read_block = MIN(p_position / block_size, read_block_count - 1);
+		read_block_size = _get_block_size(read_block);
+		read_pos = p_position - (uint64_t)read_block * block_size;
 	}
 }
 
@@ -269,25 +396,10 @@ uint8_t FileAccessCompressed::get_8() const {
 		return 0;
 	}
 
+	ERR_FAIL_COND_V_MSG(!_load_block(read_block), 0, "Compressed file is corrupt.");
 	uint8_t ret = read_ptr[read_pos];
-
 	read_pos++;
-	if (read_pos >= read_block_size) {
-		read_block++;
-
-		if (read_block < read_block_count) {
-			//read another block of compressed data
-			f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-			int total = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-			ERR_FAIL_COND_V_MSG(total == -1, 0, "Compressed file is corrupt.");
-			read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-			read_pos = 0;
-
-		} else {
-			read_block--;
-			at_end = true;
-		}
-	}
+	_check_block_end();
 
 	return ret;
 }
@@ -302,32 +414,31 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
-
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
-
-			} else {
-				read_block--;
-				at_end = true;
-				if (i + 1 < p_length) {
-					read_eof = true;
-				}
-				return i + 1;
-			}
+	uint64_t dst_pos = 0;
+	while (dst_pos < p_length && !at_end) {
+		uint32_t parallel_blocks = _get_parallel_block_count(p_length - dst_pos);
+		if (parallel_blocks > 0) {
+			ERR_FAIL_COND_V_MSG(!_decompress_blocks_parallel(read_block, parallel_blocks, p_dst + dst_pos), -1, "Compressed file is corrupt.");
+			read_block += parallel_blocks - 1;
+			read_block_size = _get_block_size(read_block);
+			read_pos = read_block_size;
+			dst_pos += (uint64_t)(parallel_blocks - 1) * block_size + read_block_size;
+			_check_block_end();
+			continue;
 		}
+
+		ERR_FAIL_COND_V_MSG(!_load_block(read_block), -1, "Compressed file is corrupt.");
+		uint64_t length = MIN(read_block_size - read_pos, p_length - dst_pos);
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, length);
+		read_pos += length;
+		dst_pos += length;
+		_check_block_end();
 	}
 
-	return p_length;
+	if (dst_pos < p_length) {
+		read_eof = true;
+	}
+	return dst_pos;
 }
 
 Error FileAccessCompressed::get_error() const {
@@ -35,7 +35,15 @@
 #include "core/io/file_access.h"
 
 class FileAccessCompressed : public FileAccess {
+	enum {
+		// Stored in the compression mode word, followed by the dictionary ID in the header.
+		MODE_FLAG_DICTIONARY = 1 << 16,
+		// Reads spanning at least this many whole blocks decompress them on the WorkerThreadPool.
+		PARALLEL_MIN_BLOCKS = 4,
+	};
+
 	Compression::Mode cmode = Compression::MODE_ZSTD;
+	uint32_t dictionary_id = 0;
 	bool writing = false;
 	uint64_t write_pos = 0;
 	uint8_t *write_ptr = nullptr;
@@ -50,9 +58,19 @@ class FileAccessCompressed : public FileAccess {
 		uint64_t offset;
 	};
 
+	struct ParallelRead {
+		const FileAccessCompressed *file = nullptr;
+		uint32_t first_block = 0;
+		const uint8_t *src = nullptr;
+		uint64_t src_offset = 0;
+		uint8_t *dst = nullptr;
+		SafeFlag failed;
+	};
+
 	mutable Vector<uint8_t> comp_buffer;
 	uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
+	mutable uint32_t loaded_block = UINT32_MAX; // Seeking only moves the cursor, the block is decompressed once read.
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
 	mutable uint64_t read_pos = 0;
@@ -65,8 +83,21 @@ class FileAccessCompressed : public FileAccess {
 
 	void _close();
 
+	_FORCE_INLINE_ uint32_t _get_block_size(uint32_t p_block) const { return p_block == read_block_count - 1 ? read_total % block_size : block_size; }
+	int _decompress_block(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p_src, int p_src_size) const;
+	bool _load_block(uint32_t p_block) const;
+	void _check_block_end() const;
+	uint32_t _get_parallel_block_count(uint64_t p_length) const;
+	bool _decompress_blocks_parallel(uint32_t p_first_block, uint32_t p_count, uint8_t *p_dst) const;
+	static void _decompress_block_task(void *p_userdata, uint32_t p_index);
+
 public:
-	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096, uint32_t p_dictionary_id = 0);
+	uint32_t get_dictionary_id() const { return dictionary_id; }
+
+	// Zstd dictionary used to compress resources of a given type, see Compression::register_zstd_dictionary().
+	static void set_type_dictionary(const String &p_type, uint32_t p_dictionary_id);
+	static uint32_t get_type_dictionary(const String &p_type);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
@@ -149,6 +149,18 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint64_t FileAccessMemory::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, 0);
+	ERR_FAIL_NULL_V(data, 0);
+
+	if (p_position >= length) {
+		return 0;
+	}
+	uint64_t read = MIN(p_length, length - p_position);
+	memcpy(p_dst, &data[p_position], read);
+	return read;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
@@ -58,6 +58,9 @@ public:
 	virtual uint8_t get_8() const override; ///< get a byte
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override; ///< get an array of bytes
+	virtual const uint8_t *get_mapped_data() const override { return data; }
+	virtual bool is_positional_read_supported() const override { return data != nullptr; }
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) override;
 
 	virtual Error get_error() const override; ///< get last error
 
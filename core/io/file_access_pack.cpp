@@ -31,6 +31,7 @@
 #include "file_access_pack.h"
 
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -38,6 +39,9 @@
 #include <stdio.h>
 
 Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
+	current_pack_order = pack_replace_files.size();
+	pack_replace_files.push_back(p_replace_files);
+
 	for (int i = 0; i < sources.size(); i++) {
 		if (sources[i]->try_open_pack(p_path, p_replace_files, p_offset)) {
 			return OK;
@@ -47,7 +51,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, const uint8_t *p_mapped_data) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -62,6 +66,9 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		pf.md5[i] = p_md5[i];
 	}
 	pf.src = p_src;
+	pf.mapped_data = p_mapped_data;
+	pf.pack_order = current_pack_order;
+	pf.first_pack_order = exists ? files[pmd5].first_pack_order : current_pack_order;
 
 	if (!exists || p_replace_files) {
 		files[pmd5] = pf;
@@ -96,6 +103,181 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	}
 }
 
+void PackedData::add_path_index(const PathIndex &p_index) {
+	MutexLock lock(dir_mutex);
+	path_indices.push_back(p_index);
+	path_indices[path_indices.size() - 1].pack_order = current_pack_order;
+}
+
+// Returns the directory record at the given position of the path table, or null if it's out of bounds.
+const uint8_t *PackedData::_get_index_record(const PathIndex &p_index, uint32_t p_path_pos, uint32_t &r_path_len) const {
+	uint64_t record_ofs = decode_uint64(p_index.paths + p_path_pos * 8);
+	uint64_t available = p_index.mapped_length - p_index.pck_start;
+	if (record_ofs > available || available - record_ofs < 4) {
+		return nullptr;
+	}
+	const uint8_t *record = p_index.mapped_data + p_index.pck_start + record_ofs;
+	uint32_t padded_len = decode_uint32(record);
+	// Path, offset, size, MD5 and flags.
+	if (available - record_ofs - 4 < (uint64_t)padded_len + 8 + 8 + 16 + 4) {
+		return nullptr;
+	}
+	r_path_len = padded_len;
+	while (r_path_len > 0 && record[4 + r_path_len - 1] == 0) {
+		r_path_len--;
+	}
+	return record;
+}
+
+// Returns the first position in the path table whose path isn't less than the given one.
+uint32_t PackedData::_index_lower_bound(const PathIndex &p_index, const char *p_path, uint32_t p_len) const {
+	uint32_t lo = 0;
+	uint32_t hi = p_index.file_count;
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		uint32_t len = 0;
+		const uint8_t *record = _get_index_record(p_index, mid, len);
+		if (!record) {
+			return p_index.file_count; // Corrupted, treat as empty.
+		}
+		int cmp = memcmp(record + 4, p_path, MIN(len, p_len));
+		if (cmp < 0 || (cmp == 0 && len < p_len)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+bool PackedData::_find_in_index(const PathIndex &p_index, const uint8_t *p_md5, PackedFile &r_file) const {
+	uint32_t lo = 0;
+	uint32_t hi = p_index.file_count;
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		const uint8_t *hash = p_index.hashes + mid * 24;
+		int cmp = memcmp(hash, p_md5, 16);
+		if (cmp < 0) {
+			lo = mid + 1;
+		} else if (cmp > 0) {
+			hi = mid;
+		} else {
+			uint32_t path_pos = decode_uint32(hash + 16);
+			uint32_t len = 0;
+			const uint8_t *record = path_pos < p_index.file_count ? _get_index_record(p_index, path_pos, len) : nullptr;
+			ERR_FAIL_NULL_V_MSG(record, false, "Corrupted path index in pack '" + p_index.pack + "'.");
+			const uint8_t *data = record + 4 + decode_uint32(record);
+
+			r_file.pack = p_index.pack;
+			r_file.offset = p_index.file_base + decode_uint64(data);
+			r_file.size = decode_uint64(data + 8);
+			memcpy(r_file.md5, data + 16, 16);
+			r_file.encrypted = decode_uint32(data + 32) & PACK_FILE_ENCRYPTED;
+			r_file.src = p_index.src;
+			r_file.mapped_data = (r_file.offset + r_file.size <= p_index.mapped_length) ? p_index.mapped_data : nullptr;
+			r_file.pack_order = p_index.pack_order;
+			r_file.first_pack_order = p_index.pack_order;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool PackedData::_find_path(const String &p_path, PackedFile &r_file) {
+	Vector<uint8_t> md5 = p_path.simplify_path().md5_buffer();
+	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(PathMD5(md5));
+	if (path_indices.is_empty()) {
+		if (!E) {
+			return false;
+		}
+		r_file = E->value;
+		return true;
+	}
+
+	// Resolve as if every pack had been added to the map in order: the first pack
+	// with the file keeps it, unless a later one is allowed to replace it.
+	uint32_t first_order = E ? E->value.first_pack_order : UINT32_MAX;
+	int64_t replace_order = (E && pack_replace_files[E->value.pack_order]) ? (int64_t)E->value.pack_order : -1;
+	PackedFile first_file;
+	PackedFile replace_file;
+	if (E) {
+		first_file = E->value;
+		replace_file = E->value;
+	}
+
+	for (const PathIndex &index : path_indices) {
+		PackedFile pf;
+		if (!_find_in_index(index, md5.ptr(), pf)) {
+			continue;
+		}
+		if (index.pack_order < first_order) {
+			first_order = index.pack_order;
+			first_file = pf;
+		}
+		if (pack_replace_files[index.pack_order] && (int64_t)index.pack_order > replace_order) {
+			replace_order = index.pack_order;
+			replace_file = pf;
+		}
+	}
+
+	if (first_order == UINT32_MAX) {
+		return false;
+	}
+	r_file = replace_order > (int64_t)first_order ? replace_file : first_file;
+	return true;
+}
+
+// Adds the entries of path indices to a directory the first time it's looked into,
+// so packs with a path index don't need a node per directory up front.
+void PackedData::_materialize_dir(PackedDir *p_dir) {
+	if (p_dir->materialized_indices.get() == path_indices.size()) {
+		return;
+	}
+
+	MutexLock lock(dir_mutex);
+
+	String dir_path;
+	for (PackedDir *pd = p_dir; pd->parent; pd = pd->parent) {
+		dir_path = pd->name + "/" + dir_path;
+	}
+	CharString prefix = ("res://" + dir_path).utf8();
+
+	for (uint32_t i = p_dir->materialized_indices.get(); i < path_indices.size(); i++) {
+		const PathIndex &index = path_indices[i];
+		uint32_t pos = _index_lower_bound(index, prefix.get_data(), prefix.length());
+		while (pos < index.file_count) {
+			uint32_t len = 0;
+			const uint8_t *record = _get_index_record(index, pos, len);
+			if (!record || len < (uint32_t)prefix.length() || memcmp(record + 4, prefix.get_data(), prefix.length()) != 0) {
+				break;
+			}
+
+			const char *rest = (const char *)record + 4 + prefix.length();
+			uint32_t rest_len = len - prefix.length();
+			const char *slash = (const char *)memchr(rest, '/', rest_len);
+			if (slash) {
+				String name = String::utf8(rest, slash - rest);
+				if (!p_dir->subdirs.has(name)) {
+					PackedDir *pd = memnew(PackedDir);
+					pd->name = name;
+					pd->parent = p_dir;
+					p_dir->subdirs[name] = pd;
+				}
+				// Skip the rest of the subdirectory, '0' being the character after '/'.
+				CharString next = ("res://" + dir_path + name + "0").utf8();
+				pos = _index_lower_bound(index, next.get_data(), next.length());
+			} else {
+				if (rest_len > 0) {
+					p_dir->files.insert(String::utf8(rest, rest_len));
+				}
+				pos++;
+			}
+		}
+	}
+
+	p_dir->materialized_indices.set(path_indices.size());
+}
+
 void PackedData::add_pack_source(PackSource *p_source) {
 	if (p_source != nullptr) {
 		sources.push_back(p_source);
@@ -132,11 +314,15 @@ PackedData::~PackedData() {
 //////////////////////////////////////////////////////////////////
 
 bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	Ref<FileAccess> f = FileAccess::open_mapped(p_path);
 	if (f.is_null()) {
 		return false;
 	}
 
+	Ref<FileAccess> pack_file = f;
+	const uint8_t *mapped_data = f->get_mapped_data();
+	uint64_t mapped_length = mapped_data ? f->get_length() : 0;
+
 	bool pck_header_found = false;
 
 	// Search for the header at the start offset - standalone PCK file.
@@ -216,7 +402,8 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	bool enc_directory = (pack_flags & PACK_DIR_ENCRYPTED);
 	bool rel_filebase = (pack_flags & PACK_REL_FILEBASE);
 
-	for (int i = 0; i < 16; i++) {
+	uint64_t path_index_ofs = f->get_64();
+	for (int i = 2; i < 16; i++) {
 		//reserved
 		f->get_32();
 	}
@@ -227,6 +414,29 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		file_base += pck_start_pos;
 	}
 
+	if ((pack_flags & PACK_PATH_INDEX) && !enc_directory && mapped_data) {
+		// Look files up in place, without reading the directory.
+		PackedData::PathIndex index;
+		index.pack = p_path;
+		index.src = this;
+		index.mapped_data = mapped_data;
+		index.mapped_length = mapped_length;
+		index.pck_start = pck_start_pos;
+		index.file_base = file_base + p_offset;
+		index.file_count = file_count;
+
+		uint64_t available = mapped_length - pck_start_pos;
+		uint64_t index_size = 8 + (uint64_t)file_count * (24 + 8);
+		if (path_index_ofs <= available && available - path_index_ofs >= index_size && decode_uint32(mapped_data + pck_start_pos + path_index_ofs) == (uint32_t)file_count) {
+			index.hashes = mapped_data + pck_start_pos + path_index_ofs + 8;
+			index.paths = index.hashes + (uint64_t)file_count * 24;
+			PackedData::get_singleton()->add_path_index(index);
+			mapped_packs.push_back(pack_file);
+			return true;
+		}
+		WARN_PRINT("Invalid path index in pack '" + p_path + "', reading its directory instead.");
+	}
+
 	if (enc_directory) {
 		Ref<FileAccessEncrypted> fae;
 		fae.instantiate();
@@ -259,7 +469,11 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (ofs + p_offset + size <= mapped_length) ? mapped_data : nullptr);
+	}
+
+	if (mapped_data) {
+		mapped_packs.push_back(pack_file);
 	}
 
 	return true;
@@ -277,7 +491,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped_data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -285,7 +501,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped_data && f.is_null(), "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -293,7 +509,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped_data) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -314,18 +532,22 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint8_t FileAccessPack::get_8() const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped_data && f.is_null(), 0, "File must be opened before use.");
 	if (pos >= pf.size) {
 		eof = true;
 		return 0;
 	}
 
+	if (mapped_data) {
+		return mapped_data[pos++];
+	}
+
 	pos++;
 	return f->get_8();
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped_data && f.is_null(), -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -338,21 +560,50 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
+
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + pos, to_read);
+		pos += to_read;
+		return to_read;
+	}
+
+	pos += to_read;
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
 }
 
+bool FileAccessPack::is_positional_read_supported() const {
+	return mapped_data || (f.is_valid() && f->is_positional_read_supported());
+}
+
+uint64_t FileAccessPack::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V_MSG(!mapped_data && f.is_null(), 0, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, 0);
+
+	if (p_position >= pf.size) {
+		return 0;
+	}
+	uint64_t to_read = MIN(p_length, pf.size - p_position);
+
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + p_position, to_read);
+		return to_read;
+	}
+
+	return f->get_buffer_at(off + p_position, p_dst, to_read);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped_data && f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -380,11 +631,22 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_data = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+
+	if (pf.mapped_data && !pf.encrypted) {
+		// Read straight from the pages shared with the pack source, no file handle needed.
+		mapped_data = pf.mapped_data + pf.offset;
+		off = 0;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -406,8 +668,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +678,7 @@ Error DirAccessPack::list_dir_begin() {
 	list_dirs.clear();
 	list_files.clear();
 
+	PackedData::get_singleton()->_materialize_dir(current);
 	for (const KeyValue<String, PackedData::PackedDir *> &E : current->subdirs) {
 		list_dirs.push_back(E.key);
 	}
@@ -509,9 +770,12 @@ PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
 			if (pd->parent) {
 				pd = pd->parent;
 			}
-		} else if (pd->subdirs.has(p)) {
-			pd = pd->subdirs[p];
+			continue;
+		}
 
+		PackedData::get_singleton()->_materialize_dir(pd);
+		if (pd->subdirs.has(p)) {
+			pd = pd->subdirs[p];
 		} else {
 			return nullptr;
 		}
@@ -549,6 +813,7 @@ bool DirAccessPack::file_exists(String p_file) {
 	if (!pd) {
 		return false;
 	}
+	PackedData::get_singleton()->_materialize_dir(pd);
 	return pd->files.has(p_file.get_file());
 }
 
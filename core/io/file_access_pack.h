@@ -33,10 +33,13 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -46,8 +49,15 @@
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
 	PACK_REL_FILEBASE = 1 << 1,
+	PACK_PATH_INDEX = 1 << 2, // The first two reserved words hold the offset of the path index, relative to the start of the PCK.
 };
 
+// The path index lets the directory of a memory-mapped PCK be queried in place,
+// instead of being read into PackedData up front. Its layout is:
+// - uint32_t file count, uint32_t unused.
+// - Per file, sorted by path MD5: uint8_t[16] MD5 of the simplified path, uint32_t position in the path table, uint32_t unused.
+// - Per file, sorted by UTF-8 path bytes: uint64_t offset of its directory record, relative to the start of the PCK.
+
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0
 };
@@ -58,6 +68,7 @@ class PackedData {
 	friend class FileAccessPack;
 	friend class DirAccessPack;
 	friend class PackSource;
+	friend class TestPackedDataInternalsAccessor;
 
 public:
 	struct PackedFile {
@@ -67,6 +78,23 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		const uint8_t *mapped_data = nullptr; // Start of the pack if it is memory-mapped, owned by the source.
+		uint32_t pack_order = 0; // Of the pack the file was taken from.
+		uint32_t first_pack_order = 0; // Of the first pack that had the file.
+	};
+
+	// A directory queried in place, see PACK_PATH_INDEX. The mapping is owned by the source.
+	struct PathIndex {
+		String pack;
+		PackSource *src = nullptr;
+		const uint8_t *mapped_data = nullptr; // Start of the pack.
+		uint64_t mapped_length = 0;
+		uint64_t pck_start = 0;
+		uint64_t file_base = 0;
+		const uint8_t *hashes = nullptr;
+		const uint8_t *paths = nullptr;
+		uint32_t file_count = 0;
+		uint32_t pack_order = 0;
 	};
 
 private:
@@ -75,6 +103,7 @@ private:
 		String name;
 		HashMap<String, PackedDir *> subdirs;
 		HashSet<String> files;
+		SafeNumeric<uint32_t> materialized_indices; // Path indices already merged into this node, see _materialize_dir().
 	};
 
 	struct PathMD5 {
@@ -103,14 +132,28 @@ private:
 
 	PackedDir *root = nullptr;
 
+	// Packs with a path index keep their files out of the map above, so resolving a path
+	// needs to know which packs were allowed to replace the files of earlier ones.
+	LocalVector<PathIndex> path_indices;
+	LocalVector<bool> pack_replace_files; // By pack order.
+	uint32_t current_pack_order = 0;
+	Mutex dir_mutex;
+
 	static PackedData *singleton;
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
 
+	const uint8_t *_get_index_record(const PathIndex &p_index, uint32_t p_path_pos, uint32_t &r_path_len) const;
+	uint32_t _index_lower_bound(const PathIndex &p_index, const char *p_path, uint32_t p_len) const;
+	bool _find_in_index(const PathIndex &p_index, const uint8_t *p_md5, PackedFile &r_file) const;
+	bool _find_path(const String &p_path, PackedFile &r_file);
+	void _materialize_dir(PackedDir *p_dir);
+
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, const uint8_t *p_mapped_data = nullptr); // for PackSource
+	void add_path_index(const PathIndex &p_index); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -136,6 +179,9 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Mapped packs stay open for as long as the source exists, so readers can share the pages.
+	Vector<Ref<FileAccess>> mapped_packs;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
@@ -147,6 +193,7 @@ class FileAccessPack : public FileAccess {
 	mutable uint64_t pos;
 	mutable bool eof;
 	uint64_t off;
+	const uint8_t *mapped_data = nullptr;
 
 	Ref<FileAccess> f;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
@@ -172,6 +219,9 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_data() const override { return mapped_data; }
+	virtual bool is_positional_read_supported() const override;
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -191,21 +241,20 @@ public:
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
-	String simplified_path = p_path.simplify_path();
-	PathMD5 pmd5(simplified_path.md5_buffer());
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
-	if (!E) {
+	PackedFile pf;
+	if (!_find_path(p_path, pf)) {
 		return nullptr; //not found
 	}
-	if (E->value.offset == 0) {
+	if (pf.offset == 0) {
 		return nullptr; //was erased
 	}
 
-	return E->value.src->get_file(p_path, &E->value);
+	return pf.src->get_file(p_path, &pf);
 }
 
 bool PackedData::has_path(const String &p_path) {
-	return files.has(PathMD5(p_path.simplify_path().md5_buffer()));
+	PackedFile pf;
+	return _find_path(p_path, pf);
 }
 
 bool PackedData::has_directory(const String &p_path) {
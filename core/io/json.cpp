@@ -32,6 +32,7 @@
 
 #include "core/config/engine.h"
 #include "core/string/print_string.h"
+#include "core/string/string_buffer.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -190,7 +191,22 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			}
 			case '"': {
 				index++;
-				String str;
+
+				// Strings without escapes or line breaks are copied at once.
+				int run_end = index;
+				while (p_str[run_end] != '"' && p_str[run_end] != '\\' && p_str[run_end] != '\n' && p_str[run_end] != 0) {
+					run_end++;
+				}
+				if (p_str[run_end] == '"') {
+					r_token.type = TK_STRING;
+					r_token.value = String(p_str + index, run_end - index);
+					index = run_end + 1;
+					return OK;
+				}
+
+				StringBuffer<> str;
+				str.append(p_str + index, run_end - index);
+				index = run_end;
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
@@ -315,17 +331,23 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 						str += res;
 
+					} else if (p_str[index] == '\n') {
+						line++;
+						str += p_str[index];
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
+						run_end = index + 1;
+						while (p_str[run_end] != '"' && p_str[run_end] != '\\' && p_str[run_end] != '\n' && p_str[run_end] != 0) {
+							run_end++;
 						}
-						str += p_str[index];
+						str.append(p_str + index, run_end - index);
+						index = run_end;
+						continue;
 					}
 					index++;
 				}
 
 				r_token.type = TK_STRING;
-				r_token.value = str;
+				r_token.value = str.as_string();
 				return OK;
 
 			} break;
@@ -345,15 +367,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if (is_ascii_alphabet_char(p_str[index])) {
-					String id;
-
+					const int start = index;
 					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String(p_str + start, index - start);
 					return OK;
 				} else {
 					r_err_str = "Unexpected character.";
@@ -511,6 +531,159 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 	return ERR_PARSE_ERROR;
 }
 
+Error JSON::parse_events(const String &p_json_string, ParseEventFunc p_func, void *p_userdata, String &r_err_str, int &r_err_line) {
+	ERR_FAIL_NULL_V(p_func, ERR_INVALID_PARAMETER);
+
+	enum State {
+		STATE_VALUE,
+		STATE_VALUE_OR_ARRAY_END,
+		STATE_KEY,
+		STATE_KEY_OR_OBJECT_END,
+		STATE_AFTER_VALUE,
+	};
+
+#define EMIT_EVENT(m_event, m_value)                                \
+	if (!p_func(p_userdata, m_event, m_value)) {                    \
+		r_err_str = "Parsing was stopped by the event handler."; \
+		return ERR_SKIP;                                            \
+	}
+
+	const char32_t *str = p_json_string.ptr();
+	int index = 0;
+	const int len = p_json_string.length();
+	r_err_line = 0;
+
+	// Containers being parsed, true for objects. Not recursive, so the depth only costs memory.
+	LocalVector<bool> containers;
+	State state = STATE_VALUE;
+	Token token;
+
+	while (true) {
+		Error err = _get_token(str, index, len, token, r_err_line, r_err_str);
+		if (err != OK) {
+			return err;
+		}
+
+		switch (state) {
+			case STATE_VALUE_OR_ARRAY_END: {
+				if (token.type == TK_BRACKET_CLOSE) {
+					containers.resize(containers.size() - 1);
+					EMIT_EVENT(EVENT_ARRAY_END, Variant());
+					state = STATE_AFTER_VALUE;
+					break;
+				}
+				[[fallthrough]];
+			}
+			case STATE_VALUE: {
+				if (token.type == TK_CURLY_BRACKET_OPEN || token.type == TK_BRACKET_OPEN) {
+					if (containers.size() >= Variant::MAX_RECURSION_DEPTH) {
+						r_err_str = "JSON structure is too deep. Bailing.";
+						return ERR_OUT_OF_MEMORY;
+					}
+					const bool is_object = token.type == TK_CURLY_BRACKET_OPEN;
+					containers.push_back(is_object);
+					EMIT_EVENT(is_object ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN, Variant());
+					state = is_object ? STATE_KEY_OR_OBJECT_END : STATE_VALUE_OR_ARRAY_END;
+				} else if (token.type == TK_IDENTIFIER) {
+					String id = token.value;
+					Variant value;
+					if (id == "true") {
+						value = true;
+					} else if (id == "false") {
+						value = false;
+					} else if (id != "null") {
+						r_err_str = "Expected 'true','false' or 'null', got '" + id + "'.";
+						return ERR_PARSE_ERROR;
+					}
+					EMIT_EVENT(EVENT_VALUE, value);
+					state = STATE_AFTER_VALUE;
+				} else if (token.type == TK_NUMBER || token.type == TK_STRING) {
+					EMIT_EVENT(EVENT_VALUE, token.value);
+					state = STATE_AFTER_VALUE;
+				} else {
+					r_err_str = "Expected value, got " + String(tk_name[token.type]) + ".";
+					return ERR_PARSE_ERROR;
+				}
+			} break;
+			case STATE_KEY_OR_OBJECT_END: {
+				if (token.type == TK_CURLY_BRACKET_CLOSE) {
+					containers.resize(containers.size() - 1);
+					EMIT_EVENT(EVENT_OBJECT_END, Variant());
+					state = STATE_AFTER_VALUE;
+					break;
+				}
+				[[fallthrough]];
+			}
+			case STATE_KEY: {
+				if (token.type != TK_STRING) {
+					r_err_str = "Expected key";
+					return ERR_PARSE_ERROR;
+				}
+				EMIT_EVENT(EVENT_KEY, token.value);
+
+				err = _get_token(str, index, len, token, r_err_line, r_err_str);
+				if (err != OK) {
+					return err;
+				}
+				if (token.type != TK_COLON) {
+					r_err_str = "Expected ':'";
+					return ERR_PARSE_ERROR;
+				}
+				state = STATE_VALUE;
+			} break;
+			case STATE_AFTER_VALUE: {
+				if (containers.is_empty()) {
+					if (token.type != TK_EOF) {
+						r_err_str = "Expected 'EOF'";
+						return ERR_PARSE_ERROR;
+					}
+					r_err_line = 0;
+					return OK;
+				}
+
+				const bool in_object = containers[containers.size() - 1];
+				if (token.type == TK_COMMA) {
+					state = in_object ? STATE_KEY : STATE_VALUE;
+				} else if (token.type == (in_object ? TK_CURLY_BRACKET_CLOSE : TK_BRACKET_CLOSE)) {
+					containers.resize(containers.size() - 1);
+					EMIT_EVENT(in_object ? EVENT_OBJECT_END : EVENT_ARRAY_END, Variant());
+				} else {
+					r_err_str = in_object ? "Expected '}' or ','" : "Expected ','";
+					return ERR_PARSE_ERROR;
+				}
+			} break;
+		}
+	}
+
+#undef EMIT_EVENT
+}
+
+bool JSON::_call_event_callable(void *p_userdata, ParseEvent p_event, const Variant &p_value) {
+	const Callable &callback = *(const Callable *)p_userdata;
+	const Variant event = p_event;
+	const Variant *args[2] = { &event, &p_value };
+	Variant ret;
+	Callable::CallError ce;
+	callback.callp(args, 2, ret, ce);
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT("Error calling JSON event callback: " + Variant::get_callable_error_text(callback, args, 2, ce));
+		return false;
+	}
+	// Callbacks returning nothing keep parsing.
+	return ret.get_type() != Variant::BOOL || bool(ret);
+}
+
+Error JSON::parse_events(const String &p_json_string, const Callable &p_callback) {
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+	data = Variant();
+	text.clear();
+	Error err = parse_events(p_json_string, &JSON::_call_event_callable, (void *)&p_callback, err_str, err_line);
+	if (err == Error::OK) {
+		err_str.clear();
+	}
+	return err;
+}
+
 void JSON::set_data(const Variant &p_data) {
 	data = p_data;
 	text.clear();
@@ -581,6 +754,7 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_events", "json_text", "callback"), static_cast<Error (JSON::*)(const String &, const Callable &)>(&JSON::parse_events));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -588,6 +762,13 @@ void JSON::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_error_line"), &JSON::get_error_line);
 	ClassDB::bind_method(D_METHOD("get_error_message"), &JSON::get_error_message);
 
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_END);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_END);
+	BIND_ENUM_CONSTANT(EVENT_KEY);
+	BIND_ENUM_CONSTANT(EVENT_VALUE);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NIL, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_NIL_IS_VARIANT), "set_data", "get_data"); // Ensures that it can be serialized as binary.
 }
 
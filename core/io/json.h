@@ -80,10 +80,29 @@ class JSON : public Resource {
 	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
+public:
+	enum ParseEvent {
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY,
+		EVENT_VALUE,
+	};
+
+	// Receives the events of parse_events(), returns false to stop parsing.
+	typedef bool (*ParseEventFunc)(void *p_userdata, ParseEvent p_event, const Variant &p_value);
+
+private:
+	static bool _call_event_callable(void *p_userdata, ParseEvent p_event, const Variant &p_value);
+
 protected:
 	static void _bind_methods();
 
 public:
+	static Error parse_events(const String &p_json_string, ParseEventFunc p_func, void *p_userdata, String &r_err_str, int &r_err_line);
+	Error parse_events(const String &p_json_string, const Callable &p_callback);
+
 	Error parse(const String &p_json_string, bool p_keep_text = false);
 	String get_parsed_text() const;
 
@@ -96,6 +115,8 @@ public:
 	inline String get_error_message() const { return err_str; }
 };
 
+VARIANT_ENUM_CAST(JSON::ParseEvent);
+
 class ResourceFormatLoaderJSON : public ResourceFormatLoader {
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
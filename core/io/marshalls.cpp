@@ -74,6 +74,9 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define HEADER_DATA_FIELD_TYPED_ARRAY_CLASS_NAME (0b10 << 16)
 #define HEADER_DATA_FIELD_TYPED_ARRAY_SCRIPT (0b11 << 16)
 
+// On little-endian hosts, packed arrays are copied to and from the buffer as a whole.
+static_assert(sizeof(Vector2) == sizeof(real_t) * 2 && sizeof(Vector3) == sizeof(real_t) * 3 && sizeof(Vector4) == sizeof(real_t) * 4 && sizeof(Color) == sizeof(float) * 4, "Packed vector and color arrays must not be padded.");
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -879,10 +882,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -906,12 +906,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int*rbuf=(const int*)buf;
 				data.resize(count);
 				int32_t *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_uint32(&buf[i * 4]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(int32_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -930,12 +933,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int*rbuf=(const int*)buf;
 				data.resize(count);
 				int64_t *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_uint64(&buf[i * 8]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(int64_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -954,12 +960,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float*rbuf=(const float*)buf;
 				data.resize(count);
 				float *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_float(&buf[i * 4]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(float));
+#endif
 			}
 			r_variant = data;
 
@@ -981,9 +990,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				data.resize(count);
 				double *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_double(&buf[i * 8]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(double));
+#endif
 			}
 			r_variant = data;
 
@@ -1037,10 +1050,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(double) * 2 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
 					}
+#endif
 
 					int adv = sizeof(double) * 2 * count;
 
@@ -1062,10 +1079,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(float) * 2 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
 					}
+#endif
 
 					int adv = sizeof(float) * 2 * count;
 
@@ -1097,11 +1118,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(double) * 3 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
 					}
+#endif
 
 					int adv = sizeof(double) * 3 * count;
 
@@ -1123,11 +1148,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(float) * 3 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
 					}
+#endif
 
 					int adv = sizeof(float) * 3 * count;
 
@@ -1160,6 +1189,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				carray.resize(count);
 				Color *w = carray.ptrw();
 
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					// Colors should always be in single-precision.
 					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
@@ -1167,6 +1197,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
 					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
 				}
+#else
+				memcpy(w, buf, 4 * 4 * count);
+#endif
 
 				int adv = 4 * 4 * count;
 
@@ -1199,12 +1232,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(double) * 4 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 2);
 						w[i].w = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 3);
 					}
+#endif
 
 					int adv = sizeof(double) * 4 * count;
 
@@ -1226,12 +1263,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy(w, buf, sizeof(float) * 4 * count);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 2);
 						w[i].w = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 3);
 					}
+#endif
 
 					int adv = sizeof(float) * 4 * count;
 
@@ -1253,9 +1294,19 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 	return OK;
 }
 
-static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
+// When encoding into a bounded buffer, stops writing once the next p_size bytes
+// don't fit anymore. The length keeps being measured so the caller can retry with
+// a large enough buffer.
+static _FORCE_INLINE_ void _reserve_encode(uint8_t *&r_buf, const uint8_t *p_end, int p_size) {
+	if (r_buf && p_end && p_size > p_end - r_buf) {
+		r_buf = nullptr;
+	}
+}
+
+static void _encode_string(const String &p_string, uint8_t *&buf, const uint8_t *p_end, int &r_len) {
 	CharString utf8 = p_string.utf8();
 
+	_reserve_encode(buf, p_end, 4 + utf8.length() + (4 - utf8.length() % 4) % 4);
 	if (buf) {
 		encode_uint32(utf8.length(), buf);
 		buf += 4;
@@ -1272,7 +1323,7 @@ static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	}
 }
 
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+static Error _encode_variant(const Variant &p_variant, uint8_t *r_buffer, const uint8_t *p_end, int &r_len, bool p_full_objects, int p_depth) {
 	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
 	uint8_t *buf = r_buffer;
 
@@ -1299,6 +1350,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Object *obj = p_variant.get_validated_object();
 			if (!obj) {
 				// Object is invalid, send a nullptr instead.
+				_reserve_encode(buf, p_end, 4);
 				if (buf) {
 					encode_uint32(Variant::NIL, buf);
 				}
@@ -1347,6 +1399,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} // nothing to do at this stage
 	}
 
+	_reserve_encode(buf, p_end, 4);
 	if (buf) {
 		encode_uint32(header, buf);
 		buf += 4;
@@ -1358,6 +1411,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			//nothing to do
 		} break;
 		case Variant::BOOL: {
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(p_variant.operator bool(), buf);
 			}
@@ -1368,12 +1422,14 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::INT: {
 			if (header & HEADER_DATA_FLAG_64) {
 				//64 bits
+				_reserve_encode(buf, p_end, 8);
 				if (buf) {
 					encode_uint64(p_variant.operator int64_t(), buf);
 				}
 
 				r_len += 8;
 			} else {
+				_reserve_encode(buf, p_end, 4);
 				if (buf) {
 					encode_uint32(p_variant.operator int32_t(), buf);
 				}
@@ -1383,6 +1439,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::FLOAT: {
 			if (header & HEADER_DATA_FLAG_64) {
+				_reserve_encode(buf, p_end, 8);
 				if (buf) {
 					encode_double(p_variant.operator double(), buf);
 				}
@@ -1390,6 +1447,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				r_len += 8;
 
 			} else {
+				_reserve_encode(buf, p_end, 4);
 				if (buf) {
 					encode_float(p_variant.operator float(), buf);
 				}
@@ -1400,6 +1458,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::NODE_PATH: {
 			NodePath np = p_variant;
+			_reserve_encode(buf, p_end, 12);
 			if (buf) {
 				encode_uint32(uint32_t(np.get_name_count()) | 0x80000000, buf); //for compatibility with the old format
 				encode_uint32(np.get_subname_count(), buf + 4);
@@ -1434,6 +1493,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					pad = 4 - utf8.length() % 4;
 				}
 
+				_reserve_encode(buf, p_end, 4 + utf8.length() + pad);
 				if (buf) {
 					encode_uint32(utf8.length(), buf);
 					buf += 4;
@@ -1447,12 +1507,13 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::STRING:
 		case Variant::STRING_NAME: {
-			_encode_string(p_variant, buf, r_len);
+			_encode_string(p_variant, buf, p_end, r_len);
 
 		} break;
 
 		// math types
 		case Variant::VECTOR2: {
+			_reserve_encode(buf, p_end, 2 * sizeof(real_t));
 			if (buf) {
 				Vector2 v2 = p_variant;
 				encode_real(v2.x, &buf[0]);
@@ -1463,6 +1524,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR2I: {
+			_reserve_encode(buf, p_end, 2 * 4);
 			if (buf) {
 				Vector2i v2 = p_variant;
 				encode_uint32(v2.x, &buf[0]);
@@ -1473,6 +1535,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::RECT2: {
+			_reserve_encode(buf, p_end, 4 * sizeof(real_t));
 			if (buf) {
 				Rect2 r2 = p_variant;
 				encode_real(r2.position.x, &buf[0]);
@@ -1484,6 +1547,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::RECT2I: {
+			_reserve_encode(buf, p_end, 4 * 4);
 			if (buf) {
 				Rect2i r2 = p_variant;
 				encode_uint32(r2.position.x, &buf[0]);
@@ -1495,6 +1559,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR3: {
+			_reserve_encode(buf, p_end, 3 * sizeof(real_t));
 			if (buf) {
 				Vector3 v3 = p_variant;
 				encode_real(v3.x, &buf[0]);
@@ -1506,6 +1571,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR3I: {
+			_reserve_encode(buf, p_end, 3 * 4);
 			if (buf) {
 				Vector3i v3 = p_variant;
 				encode_uint32(v3.x, &buf[0]);
@@ -1517,6 +1583,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::TRANSFORM2D: {
+			_reserve_encode(buf, p_end, 6 * sizeof(real_t));
 			if (buf) {
 				Transform2D val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1530,6 +1597,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR4: {
+			_reserve_encode(buf, p_end, 4 * sizeof(real_t));
 			if (buf) {
 				Vector4 v4 = p_variant;
 				encode_real(v4.x, &buf[0]);
@@ -1542,6 +1610,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR4I: {
+			_reserve_encode(buf, p_end, 4 * 4);
 			if (buf) {
 				Vector4i v4 = p_variant;
 				encode_uint32(v4.x, &buf[0]);
@@ -1554,6 +1623,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::PLANE: {
+			_reserve_encode(buf, p_end, 4 * sizeof(real_t));
 			if (buf) {
 				Plane p = p_variant;
 				encode_real(p.normal.x, &buf[0]);
@@ -1566,6 +1636,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::QUATERNION: {
+			_reserve_encode(buf, p_end, 4 * sizeof(real_t));
 			if (buf) {
 				Quaternion q = p_variant;
 				encode_real(q.x, &buf[0]);
@@ -1578,6 +1649,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::AABB: {
+			_reserve_encode(buf, p_end, 6 * sizeof(real_t));
 			if (buf) {
 				AABB aabb = p_variant;
 				encode_real(aabb.position.x, &buf[0]);
@@ -1592,6 +1664,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::BASIS: {
+			_reserve_encode(buf, p_end, 9 * sizeof(real_t));
 			if (buf) {
 				Basis val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1605,6 +1678,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::TRANSFORM3D: {
+			_reserve_encode(buf, p_end, 12 * sizeof(real_t));
 			if (buf) {
 				Transform3D val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1622,6 +1696,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::PROJECTION: {
+			_reserve_encode(buf, p_end, 16 * sizeof(real_t));
 			if (buf) {
 				Projection val = p_variant;
 				for (int i = 0; i < 4; i++) {
@@ -1637,6 +1712,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		// misc types
 		case Variant::COLOR: {
+			_reserve_encode(buf, p_end, 4 * 4);
 			if (buf) {
 				Color c = p_variant;
 				encode_float(c.r, &buf[0]);
@@ -1651,6 +1727,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::RID: {
 			RID rid = p_variant;
 
+			_reserve_encode(buf, p_end, 8);
 			if (buf) {
 				encode_uint64(rid.get_id(), buf);
 			}
@@ -1660,6 +1737,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (p_full_objects) {
 				Object *obj = p_variant;
 				if (!obj) {
+					_reserve_encode(buf, p_end, 4);
 					if (buf) {
 						encode_uint32(0, buf);
 					}
@@ -1668,7 +1746,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				} else {
 					ERR_FAIL_COND_V(!ClassDB::can_instantiate(obj->get_class()), ERR_INVALID_PARAMETER);
 
-					_encode_string(obj->get_class(), buf, r_len);
+					_encode_string(obj->get_class(), buf, p_end, r_len);
 
 					List<PropertyInfo> props;
 					obj->get_property_list(&props);
@@ -1681,6 +1759,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 						pc++;
 					}
 
+					_reserve_encode(buf, p_end, 4);
 					if (buf) {
 						encode_uint32(pc, buf);
 						buf += 4;
@@ -1693,7 +1772,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 							continue;
 						}
 
-						_encode_string(E.name, buf, r_len);
+						_encode_string(E.name, buf, p_end, r_len);
 
 						Variant value;
 
@@ -1709,16 +1788,18 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 						}
 
 						int len;
-						Error err = encode_variant(value, buf, len, p_full_objects, p_depth + 1);
+						Error err = _encode_variant(value, buf, p_end, len, p_full_objects, p_depth + 1);
 						ERR_FAIL_COND_V(err, err);
 						ERR_FAIL_COND_V(len % 4, ERR_BUG);
 						r_len += len;
+						_reserve_encode(buf, p_end, len);
 						if (buf) {
 							buf += len;
 						}
 					}
 				}
 			} else {
+				_reserve_encode(buf, p_end, 8);
 				if (buf) {
 					Object *obj = p_variant.get_validated_object();
 					ObjectID id;
@@ -1738,8 +1819,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::SIGNAL: {
 			Signal signal = p_variant;
 
-			_encode_string(signal.get_name(), buf, r_len);
+			_encode_string(signal.get_name(), buf, p_end, r_len);
 
+			_reserve_encode(buf, p_end, 8);
 			if (buf) {
 				encode_uint64(signal.get_object_id(), buf);
 			}
@@ -1748,6 +1830,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::DICTIONARY: {
 			Dictionary d = p_variant;
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(uint32_t(d.size()), buf);
 				buf += 4;
@@ -1759,19 +1842,21 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			for (const Variant &E : keys) {
 				int len;
-				Error err = encode_variant(E, buf, len, p_full_objects, p_depth + 1);
+				Error err = _encode_variant(E, buf, p_end, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
 				r_len += len;
+				_reserve_encode(buf, p_end, len);
 				if (buf) {
 					buf += len;
 				}
 				Variant *v = d.getptr(E);
 				ERR_FAIL_NULL_V(v, ERR_BUG);
-				err = encode_variant(*v, buf, len, p_full_objects, p_depth + 1);
+				err = _encode_variant(*v, buf, p_end, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
 				r_len += len;
+				_reserve_encode(buf, p_end, len);
 				if (buf) {
 					buf += len;
 				}
@@ -1788,15 +1873,16 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					if (p_full_objects) {
 						String path = script->get_path();
 						ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://"), ERR_UNAVAILABLE, "Failed to encode a path to a custom script for an array type.");
-						_encode_string(path, buf, r_len);
+						_encode_string(path, buf, p_end, r_len);
 					} else {
-						_encode_string(EncodedObjectAsID::get_class_static(), buf, r_len);
+						_encode_string(EncodedObjectAsID::get_class_static(), buf, p_end, r_len);
 					}
 				} else if (array.get_typed_class_name() != StringName()) {
-					_encode_string(p_full_objects ? array.get_typed_class_name().operator String() : EncodedObjectAsID::get_class_static(), buf, r_len);
+					_encode_string(p_full_objects ? array.get_typed_class_name().operator String() : EncodedObjectAsID::get_class_static(), buf, p_end, r_len);
 				} else {
 					// No need to check `p_full_objects` since for `Variant::OBJECT`
 					// `array.get_typed_class_name()` should be non-empty.
+					_reserve_encode(buf, p_end, 4);
 					if (buf) {
 						encode_uint32(array.get_typed_builtin(), buf);
 						buf += 4;
@@ -1805,6 +1891,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				}
 			}
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(uint32_t(array.size()), buf);
 				buf += 4;
@@ -1813,9 +1900,10 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			for (const Variant &var : array) {
 				int len;
-				Error err = encode_variant(var, buf, len, p_full_objects, p_depth + 1);
+				Error err = _encode_variant(var, buf, p_end, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
+				_reserve_encode(buf, p_end, len);
 				if (buf) {
 					buf += len;
 				}
@@ -1829,6 +1917,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(uint8_t);
 
+			_reserve_encode(buf, p_end, 4 + datalen * datasize + (4 - datalen % 4) % 4);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1853,13 +1942,20 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(int32_t);
 
+			_reserve_encode(buf, p_end, 4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const int32_t *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < datalen; i++) {
 					encode_uint32(r[i], &buf[i * datasize]);
 				}
+#else
+				if (datalen) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1870,13 +1966,20 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(int64_t);
 
+			_reserve_encode(buf, p_end, 4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const int64_t *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < datalen; i++) {
 					encode_uint64(r[i], &buf[i * datasize]);
 				}
+#else
+				if (datalen) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1887,13 +1990,20 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(float);
 
+			_reserve_encode(buf, p_end, 4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const float *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < datalen; i++) {
 					encode_float(r[i], &buf[i * datasize]);
 				}
+#else
+				if (datalen) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1904,13 +2014,20 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(double);
 
+			_reserve_encode(buf, p_end, 4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const double *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < datalen; i++) {
 					encode_double(r[i], &buf[i * datasize]);
 				}
+#else
+				if (datalen) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1920,6 +2037,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<String> data = p_variant;
 			int len = data.size();
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1930,6 +2048,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			for (int i = 0; i < len; i++) {
 				CharString utf8 = data.get(i).utf8();
 
+				_reserve_encode(buf, p_end, 4 + utf8.length() + 1 + (4 - (utf8.length() + 1) % 4) % 4);
 				if (buf) {
 					encode_uint32(utf8.length() + 1, buf);
 					buf += 4;
@@ -1951,6 +2070,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Vector2> data = p_variant;
 			int len = data.size();
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1958,7 +2078,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			_reserve_encode(buf, p_end, sizeof(real_t) * 2 * len);
 			if (buf) {
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < len; i++) {
 					Vector2 v = data.get(i);
 
@@ -1966,6 +2088,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_real(v.y, &buf[sizeof(real_t)]);
 					buf += sizeof(real_t) * 2;
 				}
+#else
+				if (len) {
+					memcpy(buf, data.ptr(), sizeof(real_t) * 2 * len);
+					buf += sizeof(real_t) * 2 * len;
+				}
+#endif
 			}
 
 			r_len += sizeof(real_t) * 2 * len;
@@ -1975,6 +2103,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Vector3> data = p_variant;
 			int len = data.size();
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1982,7 +2111,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			_reserve_encode(buf, p_end, sizeof(real_t) * 3 * len);
 			if (buf) {
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < len; i++) {
 					Vector3 v = data.get(i);
 
@@ -1991,6 +2122,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_real(v.z, &buf[sizeof(real_t) * 2]);
 					buf += sizeof(real_t) * 3;
 				}
+#else
+				if (len) {
+					memcpy(buf, data.ptr(), sizeof(real_t) * 3 * len);
+					buf += sizeof(real_t) * 3 * len;
+				}
+#endif
 			}
 
 			r_len += sizeof(real_t) * 3 * len;
@@ -2000,6 +2137,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Color> data = p_variant;
 			int len = data.size();
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -2007,7 +2145,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			_reserve_encode(buf, p_end, 4 * 4 * len);
 			if (buf) {
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < len; i++) {
 					Color c = data.get(i);
 
@@ -2017,6 +2157,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_float(c.a, &buf[12]);
 					buf += 4 * 4; // Colors should always be in single-precision.
 				}
+#else
+				if (len) {
+					memcpy(buf, data.ptr(), 4 * 4 * len);
+					buf += 4 * 4 * len;
+				}
+#endif
 			}
 
 			r_len += 4 * 4 * len;
@@ -2026,6 +2172,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Vector4> data = p_variant;
 			int len = data.size();
 
+			_reserve_encode(buf, p_end, 4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -2033,7 +2180,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			_reserve_encode(buf, p_end, sizeof(real_t) * 4 * len);
 			if (buf) {
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < len; i++) {
 					Vector4 v = data.get(i);
 
@@ -2043,6 +2192,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_real(v.w, &buf[sizeof(real_t) * 3]);
 					buf += sizeof(real_t) * 4;
 				}
+#else
+				if (len) {
+					memcpy(buf, data.ptr(), sizeof(real_t) * 4 * len);
+					buf += sizeof(real_t) * 4 * len;
+				}
+#endif
 			}
 
 			r_len += sizeof(real_t) * 4 * len;
@@ -2056,6 +2211,18 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+	return _encode_variant(p_variant, r_buffer, nullptr, r_len, p_full_objects, p_depth);
+}
+
+Error encode_variant_bounded(const Variant &p_variant, uint8_t *r_buffer, int p_max_len, int &r_len, bool p_full_objects) {
+	ERR_FAIL_COND_V(p_max_len < 0, ERR_INVALID_PARAMETER);
+	if (!r_buffer || p_max_len == 0) {
+		return _encode_variant(p_variant, nullptr, nullptr, r_len, p_full_objects, 0);
+	}
+	return _encode_variant(p_variant, r_buffer, r_buffer + p_max_len, r_len, p_full_objects, 0);
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
@@ -214,6 +214,10 @@ public:
 
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+// Encodes in a single pass when the result fits in p_max_len bytes. r_len is always
+// set to the full encoded length; if it's larger than p_max_len, the contents of
+// r_buffer are undefined and encoding must be retried with a large enough buffer.
+Error encode_variant_bounded(const Variant &p_variant, uint8_t *r_buffer, int p_max_len, int &r_len, bool p_full_objects = false);
 
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
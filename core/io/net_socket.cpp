@@ -40,3 +40,40 @@ NetSocket *NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return nullptr;
 }
+
+Error NetSocket::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	ERR_FAIL_COND_V(p_count < 0, ERR_INVALID_PARAMETER);
+	r_received = 0;
+	while (r_received < p_count) {
+		Datagram &d = p_datagrams[r_received];
+		int read = 0;
+		Error err = recvfrom(d.buffer, d.len, read, d.ip, d.port);
+		if (err != OK) {
+			if (r_received > 0) {
+				break; // Errors will be reported on the next call.
+			}
+			return err;
+		}
+		d.len = read;
+		r_received++;
+	}
+	return OK;
+}
+
+Error NetSocket::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	ERR_FAIL_COND_V(p_count < 0, ERR_INVALID_PARAMETER);
+	r_sent = 0;
+	while (r_sent < p_count) {
+		const Datagram &d = p_datagrams[r_sent];
+		int sent = 0;
+		Error err = sendto(d.buffer, d.len, sent, d.ip, d.port);
+		if (err != OK) {
+			if (r_sent > 0) {
+				break;
+			}
+			return err;
+		}
+		r_sent++;
+	}
+	return OK;
+}
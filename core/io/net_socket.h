@@ -53,6 +53,16 @@ public:
 		TYPE_UDP,
 	};
 
+	// A single datagram in a batch. When receiving, `len` is the capacity of
+	// `buffer` and is set to the received size, `ip` and `port` to the sender.
+	// When sending, `len` is the payload size and `ip`/`port` the destination.
+	struct Datagram {
+		uint8_t *buffer = nullptr;
+		int len = 0;
+		IPAddress ip;
+		uint16_t port = 0;
+	};
+
 	virtual Error open(Type p_type, IP::Type &ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(IPAddress p_addr, uint16_t p_port) = 0;
@@ -65,6 +75,12 @@ public:
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) = 0;
 
+	// Receive/send up to p_count datagrams at once. The default implementations
+	// call recvfrom/sendto in a loop, platforms may override them with batched
+	// syscalls. Return ERR_BUSY only if nothing could be transferred.
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
+
 	virtual bool is_open() const = 0;
 	virtual int get_available_bytes() const = 0;
 	virtual Error get_socket_address(IPAddress *r_ip, uint16_t *r_port) const = 0;
@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  packed_byte_array_slice.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "packed_byte_array_slice.h"
+
+#include "core/io/marshalls.h"
+
+Ref<PackedByteArraySlice> PackedByteArraySlice::create(const PackedByteArray &p_source, int64_t p_begin, int64_t p_end) {
+	Ref<PackedByteArraySlice> slice;
+	slice.instantiate();
+	slice->view = p_source.slice_view(p_begin, p_end);
+	return slice;
+}
+
+int64_t PackedByteArraySlice::get(int64_t p_index) const {
+	ERR_FAIL_INDEX_V(p_index, int64_t(view.size()), 0);
+	return view[p_index];
+}
+
+int64_t PackedByteArraySlice::find(int64_t p_value, int64_t p_from) const {
+	if (p_value < 0 || p_value > UINT8_MAX) {
+		// Would wrap around to another byte value.
+		return -1;
+	}
+	return view.find(p_value, p_from);
+}
+
+Ref<PackedByteArraySlice> PackedByteArraySlice::slice(int64_t p_begin, int64_t p_end) const {
+	Ref<PackedByteArraySlice> slice;
+	slice.instantiate();
+	slice->view = view.slice(p_begin, p_end);
+	return slice;
+}
+
+PackedByteArray PackedByteArraySlice::to_byte_array() const {
+	return view.to_vector();
+}
+
+String PackedByteArraySlice::get_string_from_ascii() const {
+	String s;
+	if (view.size() > 0) {
+		CharString cs;
+		cs.resize(view.size() + 1);
+		memcpy(cs.ptrw(), view.ptr(), view.size());
+		cs[(int)view.size()] = 0;
+
+		s = cs.get_data();
+	}
+	return s;
+}
+
+String PackedByteArraySlice::get_string_from_utf8() const {
+	String s;
+	if (view.size() > 0) {
+		s.parse_utf8((const char *)view.ptr(), view.size());
+	}
+	return s;
+}
+
+int64_t PackedByteArraySlice::decode_u8(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 1), 0);
+	return view.ptr()[p_offset];
+}
+
+int64_t PackedByteArraySlice::decode_s8(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 1), 0);
+	return (int8_t)view.ptr()[p_offset];
+}
+
+int64_t PackedByteArraySlice::decode_u16(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 2), 0);
+	return decode_uint16(view.ptr() + p_offset);
+}
+
+int64_t PackedByteArraySlice::decode_s16(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 2), 0);
+	return (int16_t)decode_uint16(view.ptr() + p_offset);
+}
+
+int64_t PackedByteArraySlice::decode_u32(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 4), 0);
+	return decode_uint32(view.ptr() + p_offset);
+}
+
+int64_t PackedByteArraySlice::decode_s32(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 4), 0);
+	return (int32_t)decode_uint32(view.ptr() + p_offset);
+}
+
+int64_t PackedByteArraySlice::decode_u64(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 8), 0);
+	return (int64_t)decode_uint64(view.ptr() + p_offset);
+}
+
+int64_t PackedByteArraySlice::decode_s64(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 8), 0);
+	return (int64_t)decode_uint64(view.ptr() + p_offset);
+}
+
+double PackedByteArraySlice::decode_half(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 2), 0);
+	return Math::half_to_float(decode_uint16(view.ptr() + p_offset));
+}
+
+double PackedByteArraySlice::decode_float(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 4), 0);
+	return ::decode_float(view.ptr() + p_offset);
+}
+
+double PackedByteArraySlice::decode_double(int64_t p_offset) const {
+	ERR_FAIL_COND_V(!_has_bytes(p_offset, 8), 0);
+	return ::decode_double(view.ptr() + p_offset);
+}
+
+void PackedByteArraySlice::_bind_methods() {
+	ClassDB::bind_static_method("PackedByteArraySlice", D_METHOD("create", "source", "begin", "end"), &PackedByteArraySlice::create, DEFVAL(0), DEFVAL(INT_MAX));
+
+	ClassDB::bind_method(D_METHOD("size"), &PackedByteArraySlice::size);
+	ClassDB::bind_method(D_METHOD("is_empty"), &PackedByteArraySlice::is_empty);
+	ClassDB::bind_method(D_METHOD("get", "index"), &PackedByteArraySlice::get);
+	ClassDB::bind_method(D_METHOD("find", "value", "from"), &PackedByteArraySlice::find, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("slice", "begin", "end"), &PackedByteArraySlice::slice, DEFVAL(INT_MAX));
+	ClassDB::bind_method(D_METHOD("to_byte_array"), &PackedByteArraySlice::to_byte_array);
+
+	ClassDB::bind_method(D_METHOD("get_string_from_ascii"), &PackedByteArraySlice::get_string_from_ascii);
+	ClassDB::bind_method(D_METHOD("get_string_from_utf8"), &PackedByteArraySlice::get_string_from_utf8);
+
+	ClassDB::bind_method(D_METHOD("decode_u8", "byte_offset"), &PackedByteArraySlice::decode_u8);
+	ClassDB::bind_method(D_METHOD("decode_s8", "byte_offset"), &PackedByteArraySlice::decode_s8);
+	ClassDB::bind_method(D_METHOD("decode_u16", "byte_offset"), &PackedByteArraySlice::decode_u16);
+	ClassDB::bind_method(D_METHOD("decode_s16", "byte_offset"), &PackedByteArraySlice::decode_s16);
+	ClassDB::bind_method(D_METHOD("decode_u32", "byte_offset"), &PackedByteArraySlice::decode_u32);
+	ClassDB::bind_method(D_METHOD("decode_s32", "byte_offset"), &PackedByteArraySlice::decode_s32);
+	ClassDB::bind_method(D_METHOD("decode_u64", "byte_offset"), &PackedByteArraySlice::decode_u64);
+	ClassDB::bind_method(D_METHOD("decode_s64", "byte_offset"), &PackedByteArraySlice::decode_s64);
+	ClassDB::bind_method(D_METHOD("decode_half", "byte_offset"), &PackedByteArraySlice::decode_half);
+	ClassDB::bind_method(D_METHOD("decode_float", "byte_offset"), &PackedByteArraySlice::decode_float);
+	ClassDB::bind_method(D_METHOD("decode_double", "byte_offset"), &PackedByteArraySlice::decode_double);
+}
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  packed_byte_array_slice.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PACKED_BYTE_ARRAY_SLICE_H
+#define PACKED_BYTE_ARRAY_SLICE_H
+
+#include "core/object/ref_counted.h"
+
+// Script facing VectorSlice<uint8_t>, for parsing buffers without copying them.
+class PackedByteArraySlice : public RefCounted {
+	GDCLASS(PackedByteArraySlice, RefCounted);
+
+	VectorSlice<uint8_t> view;
+
+	_FORCE_INLINE_ bool _has_bytes(int64_t p_offset, int64_t p_bytes) const {
+		return p_offset >= 0 && p_offset <= int64_t(view.size()) - p_bytes;
+	}
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<PackedByteArraySlice> create(const PackedByteArray &p_source, int64_t p_begin = 0, int64_t p_end = INT_MAX);
+
+	const VectorSlice<uint8_t> &get_view() const { return view; }
+	void set_view(const VectorSlice<uint8_t> &p_view) { view = p_view; }
+
+	int64_t size() const { return view.size(); }
+	bool is_empty() const { return view.is_empty(); }
+	int64_t get(int64_t p_index) const;
+	int64_t find(int64_t p_value, int64_t p_from = 0) const;
+
+	Ref<PackedByteArraySlice> slice(int64_t p_begin, int64_t p_end = INT_MAX) const;
+	PackedByteArray to_byte_array() const;
+
+	String get_string_from_ascii() const;
+	String get_string_from_utf8() const;
+
+	int64_t decode_u8(int64_t p_offset) const;
+	int64_t decode_s8(int64_t p_offset) const;
+	int64_t decode_u16(int64_t p_offset) const;
+	int64_t decode_s16(int64_t p_offset) const;
+	int64_t decode_u32(int64_t p_offset) const;
+	int64_t decode_s32(int64_t p_offset) const;
+	int64_t decode_u64(int64_t p_offset) const;
+	int64_t decode_s64(int64_t p_offset) const;
+	double decode_half(int64_t p_offset) const;
+	double decode_float(int64_t p_offset) const;
+	double decode_double(int64_t p_offset) const;
+};
+
+#endif // PACKED_BYTE_ARRAY_SLICE_H
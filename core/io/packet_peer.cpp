@@ -89,8 +89,11 @@ Error PacketPeer::get_var(Variant &r_variant, bool p_allow_objects) {
 }
 
 Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
+	// Encode straight into the buffer kept from previous packets, and only
+	// start over when it turns out to be too small.
 	int len;
-	Error err = encode_variant(p_packet, nullptr, len, p_full_objects); // compute len first
+	uint8_t *w = encode_buffer.ptrw();
+	Error err = encode_variant_bounded(p_packet, w, encode_buffer.size(), len, p_full_objects);
 	if (err) {
 		return err;
 	}
@@ -104,11 +107,11 @@ Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
 	if (unlikely(encode_buffer.size() < len)) {
 		encode_buffer.resize(0); // Avoid realloc
 		encode_buffer.resize(next_power_of_2(len));
-	}
 
-	uint8_t *w = encode_buffer.ptrw();
-	err = encode_variant(p_packet, w, len, p_full_objects);
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to encode Variant.");
+		w = encode_buffer.ptrw();
+		err = encode_variant(p_packet, w, len, p_full_objects);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to encode Variant.");
+	}
 
 	return put_packet(w, len);
 }
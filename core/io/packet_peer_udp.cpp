@@ -274,19 +274,20 @@ Error PacketPeerUDP::_poll() {
 		return OK; // Handled by UDPServer.
 	}
 
+	if (recv_buffer.is_empty()) {
+		recv_buffer.resize(RECV_BATCH_SIZE * PACKET_BUFFER_SIZE);
+	}
+
 	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	int received;
 
 	while (true) {
-		if (connected) {
-			err = _sock->recv(recv_buffer, sizeof(recv_buffer), read);
-			ip = peer_addr;
-			port = peer_port;
-		} else {
-			err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+		for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+			recv_batch[i].buffer = recv_buffer.ptr() + i * PACKET_BUFFER_SIZE;
+			recv_batch[i].len = PACKET_BUFFER_SIZE;
 		}
+		// Connected sockets only receive from the peer, so the batch works for both.
+		err = _sock->recvfrom_batch(recv_batch, RECV_BATCH_SIZE, received);
 
 		if (err != OK) {
 			if (err == ERR_BUSY) {
@@ -295,12 +296,23 @@ Error PacketPeerUDP::_poll() {
 			return FAILED;
 		}
 
-		err = store_packet(ip, port, recv_buffer, read);
+		for (int i = 0; i < received; i++) {
+			const NetSocket::Datagram &d = recv_batch[i];
+			if (connected) {
+				err = store_packet(peer_addr, peer_port, d.buffer, d.len);
+			} else {
+				err = store_packet(d.ip, d.port, d.buffer, d.len);
+			}
 #ifdef TOOLS_ENABLED
-		if (err != OK) {
-			WARN_PRINT("Buffer full, dropping packets!");
-		}
+			if (err != OK) {
+				WARN_PRINT("Buffer full, dropping packets!");
+			}
 #endif
+		}
+
+		if (received < RECV_BATCH_SIZE) {
+			break; // Drained.
+		}
 	}
 
 	return OK;
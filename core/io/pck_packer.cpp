@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/templates/sort_array.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -46,6 +47,75 @@ static int _get_pad(int p_alignment, int p_n) {
 	return pad;
 }
 
+struct _PathIndexPathSort {
+	const Vector<CharString> *paths = nullptr;
+
+	bool operator()(int p_a, int p_b) const {
+		const CharString &a = (*paths)[p_a];
+		const CharString &b = (*paths)[p_b];
+		// Same byte order the reader compares in, regardless of the signedness of char.
+		int cmp = memcmp(a.get_data(), b.get_data(), MIN(a.length(), b.length()));
+		return cmp < 0 || (cmp == 0 && a.length() < b.length());
+	}
+};
+
+struct _PathIndexHashSort {
+	const Vector<Vector<uint8_t>> *hashes = nullptr;
+
+	bool operator()(int p_a, int p_b) const {
+		return memcmp((*hashes)[p_a].ptr(), (*hashes)[p_b].ptr(), 16) < 0;
+	}
+};
+
+// Writes the path index of the directory records at the given offsets, see PACK_PATH_INDEX.
+// Returns its offset relative to the start of the PCK, which is where offsets are relative to too.
+uint64_t PCKPacker::store_path_index(const Ref<FileAccess> &p_file, uint64_t p_pck_start, const Vector<CharString> &p_paths, const Vector<uint64_t> &p_record_offsets) {
+	ERR_FAIL_COND_V(p_paths.size() != p_record_offsets.size(), 0);
+
+	int pad = _get_pad(8, p_file->get_position() - p_pck_start);
+	for (int i = 0; i < pad; i++) {
+		p_file->store_8(0);
+	}
+	uint64_t index_ofs = p_file->get_position() - p_pck_start;
+
+	Vector<int> by_path;
+	Vector<Vector<uint8_t>> hashes;
+	by_path.resize(p_paths.size());
+	hashes.resize(p_paths.size());
+	for (int i = 0; i < p_paths.size(); i++) {
+		by_path.write[i] = i;
+		hashes.write[i] = String::utf8(p_paths[i].get_data()).simplify_path().md5_buffer();
+	}
+	Vector<int> by_hash = by_path;
+
+	SortArray<int, _PathIndexPathSort> path_sort;
+	path_sort.compare.paths = &p_paths;
+	path_sort.sort(by_path.ptrw(), by_path.size());
+
+	SortArray<int, _PathIndexHashSort> hash_sort;
+	hash_sort.compare.hashes = &hashes;
+	hash_sort.sort(by_hash.ptrw(), by_hash.size());
+
+	Vector<uint32_t> path_pos;
+	path_pos.resize(p_paths.size());
+	for (int i = 0; i < by_path.size(); i++) {
+		path_pos.write[by_path[i]] = i;
+	}
+
+	p_file->store_32(p_paths.size());
+	p_file->store_32(0);
+	for (int i = 0; i < by_hash.size(); i++) {
+		p_file->store_buffer(hashes[by_hash[i]].ptr(), 16);
+		p_file->store_32(path_pos[by_hash[i]]);
+		p_file->store_32(0);
+	}
+	for (int i = 0; i < by_path.size(); i++) {
+		p_file->store_64(p_record_offsets[by_path[i]]);
+	}
+
+	return index_ofs;
+}
+
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
@@ -97,6 +167,8 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	uint32_t pack_flags = 0;
 	if (enc_dir) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
+	} else {
+		pack_flags |= PACK_PATH_INDEX;
 	}
 	file->store_32(pack_flags); // flags
 
@@ -177,7 +249,15 @@ Error PCKPacker::flush(bool p_verbose) {
 		fhead = fae;
 	}
 
+	Vector<CharString> index_paths;
+	Vector<uint64_t> index_record_offsets;
+
 	for (int i = 0; i < files.size(); i++) {
+		if (!enc_dir) {
+			index_paths.push_back(files[i].path.utf8());
+			index_record_offsets.push_back(file->get_position());
+		}
+
 		int string_len = files[i].path.utf8().length();
 		int pad = _get_pad(4, string_len);
 
@@ -203,6 +283,11 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
+	uint64_t path_index_ofs = 0;
+	if (!enc_dir) {
+		path_index_ofs = store_path_index(file, 0, index_paths, index_record_offsets);
+	}
+
 	int header_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		file->store_8(0);
@@ -211,6 +296,7 @@ Error PCKPacker::flush(bool p_verbose) {
 	int64_t file_base = file->get_position();
 	file->seek(file_base_ofs);
 	file->store_64(file_base); // update files base
+	file->store_64(path_index_ofs); // first reserved words
 	file->seek(file_base);
 
 	const uint32_t buf_max = 65536;
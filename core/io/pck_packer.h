@@ -62,6 +62,8 @@ public:
 	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
 	Error flush(bool p_verbose = false);
 
+	static uint64_t store_path_index(const Ref<FileAccess> &p_file, uint64_t p_pck_start, const Vector<CharString> &p_paths, const Vector<uint64_t> &p_record_offsets);
+
 	PCKPacker() {}
 };
 
@@ -33,10 +33,12 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -109,6 +111,23 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+// When the file contents are resident in memory (mapped, or prefetched), returns the next p_size bytes
+// so they can be decoded in place, and moves past them.
+static const uint8_t *get_mapped_range(Ref<FileAccess> &f, uint64_t p_size) {
+	const uint8_t *data = f->get_mapped_data();
+	if (!data) {
+		return nullptr;
+	}
+
+	uint64_t pos = f->get_position();
+	if (pos + p_size > f->get_length()) {
+		return nullptr;
+	}
+
+	f->seek(pos + p_size);
+	return data + pos;
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
@@ -124,8 +143,15 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 #endif
 		} else if constexpr (sizeof(real_t) == 4) {
 			// May be slower, but this is for compatibility. Eventually the data should be converted.
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_double();
+			const uint8_t *src = f->is_big_endian() ? nullptr : get_mapped_range(f, count * sizeof(double));
+			if (src) {
+				for (size_t i = 0; i < count; ++i) {
+					dst[i] = decode_double(src + i * sizeof(double));
+				}
+			} else {
+				for (size_t i = 0; i < count; ++i) {
+					dst[i] = f->get_double();
+				}
 			}
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
@@ -143,8 +169,15 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 			}
 #endif
 		} else if constexpr (sizeof(real_t) == 8) {
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_float();
+			const uint8_t *src = f->is_big_endian() ? nullptr : get_mapped_range(f, count * sizeof(float));
+			if (src) {
+				for (size_t i = 0; i < count; ++i) {
+					dst[i] = decode_float(src + i * sizeof(float));
+				}
+			} else {
+				for (size_t i = 0; i < count; ++i) {
+					dst[i] = f->get_float();
+				}
 			}
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
@@ -163,6 +196,12 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
+		const uint8_t *mapped = get_mapped_range(f, len);
+		if (mapped) {
+			String s;
+			s.parse_utf8((const char *)mapped, len);
+			return s;
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
 		s.parse_utf8(&str_buf[0]);
@@ -410,11 +449,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const HashMap<String, Ref<Resource>> &index_cache = parent ? parent->internal_index_cache : internal_index_cache;
+					HashMap<String, Ref<Resource>>::ConstIterator E = index_cache.find(path);
+					if (!E) {
 						WARN_PRINT(String("Couldn't load resource (no cache): " + path).utf8().get_data());
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = E->value;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -448,7 +489,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
+						const Ref<ResourceLoader::LoadToken> &load_token = external_resources[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
 							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
@@ -676,6 +717,53 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	return OK; //never reach anyway
 }
 
+bool ResourceLoaderBinary::Prefetch::start(const Ref<FileAccess> &p_file, uint64_t p_begin) {
+	// Mapped files are already in memory, and stdio reads are what this avoids waiting on.
+	if (!p_file->is_positional_read_supported() || p_file->get_mapped_data()) {
+		return false;
+	}
+
+	// Past MAX_SIZE, holding a second copy of the file while it's decoded costs more than waiting on reads.
+	uint64_t length = p_file->get_length();
+	if (p_begin >= length || length - p_begin < MIN_SIZE || length > MAX_SIZE) {
+		return false;
+	}
+
+	// The buffer mirrors the whole file so positions stay the same, only the part after p_begin is read.
+	if (data.resize(length) != OK) {
+		return false;
+	}
+
+	file = p_file;
+	uint8_t *w = data.ptrw();
+	for (uint64_t ofs = p_begin; ofs < length; ofs += CHUNK_SIZE) {
+		Chunk chunk;
+		chunk.begin = ofs;
+		chunk.size = MIN((uint64_t)CHUNK_SIZE, length - ofs);
+		chunk.id = file->read_async(ofs, w + ofs, chunk.size);
+		chunks.push_back(chunk);
+	}
+
+	return true;
+}
+
+bool ResourceLoaderBinary::Prefetch::wait_until(uint64_t p_end) {
+	bool ok = true;
+	while (completed < chunks.size() && chunks[completed].begin < p_end) {
+		const Chunk &chunk = chunks[completed];
+		if (file->wait_for_async_read(chunk.id) != chunk.size) {
+			ok = false;
+		}
+		completed++;
+	}
+	return ok;
+}
+
+ResourceLoaderBinary::Prefetch::~Prefetch() {
+	// The requests write into the buffer, so none can outlive it.
+	wait_until(UINT64_MAX);
+}
+
 Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
@@ -709,187 +797,350 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	bool prefetching = false;
+	if (!internal_resources.is_empty()) {
+		// Internal resources are stored back to back until the end of the file.
+		bool ordered = true;
+		for (int i = 1; i < internal_resources.size(); i++) {
+			if (internal_resources[i].offset <= internal_resources[i - 1].offset) {
+				ordered = false;
+				break;
+			}
+		}
+
+		if (ordered && prefetch.start(f, internal_resources[0].offset)) {
+			Ref<FileAccessMemory> fam;
+			fam.instantiate();
+			fam->open_custom(prefetch.data.ptr(), prefetch.data.size());
+			fam->set_big_endian(f->is_big_endian());
+			fam->real_is_double = f->real_is_double;
+			f = fam;
+			prefetching = true;
+		}
+	}
+
+	if (use_sub_threads && internal_resources.size() >= PARALLEL_MIN_INTERNAL_RESOURCES && WorkerThreadPool::get_singleton()) {
+		// Every task needs its own cursor on the data, which is only cheap when the file is resident in memory.
+		if (prefetching && !prefetch.wait_until(UINT64_MAX)) {
+			f = prefetch.file;
+			prefetching = false;
+		}
+		if (f->get_mapped_data()) {
+			return _load_internal_resources_parallel();
+		}
+	}
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
-		//maybe it is loaded already
-		String path;
-		String id;
+		if (prefetching && !prefetch.wait_until(main ? UINT64_MAX : internal_resources[i + 1].offset)) {
+			// Short read, go back to reading the file directly.
+			f = prefetch.file;
+			prefetching = false;
+		}
 
-		if (!main) {
-			path = internal_resources[i].path;
+		if (ResourceLoader::is_current_load_canceled()) {
+			error = ERR_SKIP;
+			return error;
+		}
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+		InternalResourceLoad load;
+		Error err = _start_internal_resource(i, load);
+		if (err != OK) {
+			return err;
+		}
+		if (load.res.is_null()) {
+			continue; // Already loaded.
+		}
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+		err = _parse_internal_resource(internal_resources[i].offset, load);
+		if (err != OK) {
+			return err;
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
-			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
-			}
+		_finish_internal_resource(i, load);
+
+		if (main) {
+			return OK;
 		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	return ERR_FILE_EOF;
+}
 
-		f->seek(offset);
+Error ResourceLoaderBinary::_start_internal_resource(int p_index, InternalResourceLoad &r_load) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-		String t = get_unicode_string();
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		MissingResource *missing_resource = nullptr;
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+			internal_resources.write[p_index].path = path; // Update path.
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				return OK;
 			}
+		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-					}
-				}
+	uint64_t offset = internal_resources[p_index].offset;
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
-				}
+	f->seek(offset);
+
+	String t = get_unicode_string();
+
+	Ref<Resource> res;
+	Resource *r = nullptr;
+
+	MissingResource *missing_resource = nullptr;
 
-				res = Ref<Resource>(r);
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
 				} else {
-					r->set_path_cache(path);
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 				}
 			}
-			r->set_scene_unique_id(id);
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		int pc = f->get_32();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		//set properties
+	r_load.res = res;
+	r_load.missing_resource = missing_resource;
+	return OK;
+}
 
-		Dictionary missing_resource_properties;
+Error ResourceLoaderBinary::_parse_internal_resource(uint64_t p_offset, InternalResourceLoad &r_load) {
+	f->seek(p_offset);
+	get_unicode_string(); // Type, already known.
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	int pc = f->get_32();
+	r_load.properties.reserve(pc);
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-			Variant value;
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+		Variant value;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+		r_load.properties.push_back(Pair<StringName, Variant>(name, value));
+	}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	return OK;
+}
 
-			if (set_valid) {
-				res->set(name, value);
+void ResourceLoaderBinary::_finish_internal_resource(int p_index, InternalResourceLoad &p_load) {
+	bool main = p_index == (internal_resources.size() - 1);
+	Ref<Resource> &res = p_load.res;
+	MissingResource *missing_resource = p_load.missing_resource;
+
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (Pair<StringName, Variant> &property : p_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
+	p_load.properties.clear();
+
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
 #ifdef TOOLS_ENABLED
-		res->set_edited(false);
+	res->set_edited(false);
 #endif
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+	uint64_t length = f->get_length();
+	ResourceLoader::set_current_load_bytes(main ? length : internal_resources[p_index + 1].offset, length);
+
+	resource_cache.push_back(res);
+
+	if (main) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+	}
+}
+
+void ResourceLoaderBinary::_parse_internal_resource_task(uint32_t p_index, InternalResourceLoad *p_loads) {
+	InternalResourceLoad &load = p_loads[p_index];
+	if (load.res.is_null()) {
+		return;
+	}
+
+	// Parsing only reads the shared tables, the cursor and scratch buffers are per task.
+	ResourceLoaderBinary task_loader;
+	task_loader.parent = this;
+	task_loader.local_path = local_path;
+	task_loader.res_path = res_path;
+	task_loader.ver_format = ver_format;
+	task_loader.using_named_scene_ids = using_named_scene_ids;
+	task_loader.string_map = string_map;
+	task_loader.external_resources = external_resources;
+	task_loader.internal_resources = internal_resources;
+	task_loader.remaps = remaps;
+	task_loader.cache_mode_for_external = cache_mode_for_external;
+
+	Ref<FileAccessMemory> fam;
+	fam.instantiate();
+	fam->open_custom(f->get_mapped_data(), f->get_length());
+	fam->set_big_endian(f->is_big_endian());
+	fam->real_is_double = f->real_is_double;
+	task_loader.f = fam;
+
+	load.error = task_loader._parse_internal_resource(internal_resources[p_index].offset, load);
+}
+
+Error ResourceLoaderBinary::_load_internal_resources_parallel() {
+	// Instancing registers every resource in internal_index_cache first, so references between them resolve from any task.
+	LocalVector<InternalResourceLoad> loads;
+	loads.resize(internal_resources.size());
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Error err = _start_internal_resource(i, loads[i]);
+		if (err != OK) {
+			return err;
+		}
+	}
+
+	// Complete the dependencies here, so tasks don't wait on other loads while holding pool threads.
+	for (const ExtResource &er : external_resources) {
+		if (er.load_token.is_valid()) {
+			Error err;
+			ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
 		}
+	}
 
-		resource_cache.push_back(res);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_parse_internal_resource_task, loads.ptr(), loads.size(), -1, true, SNAME("ResourceLoaderBinary"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
-			return OK;
+	// Properties are set in file order, same as when loading serially.
+	for (int i = 0; i < internal_resources.size(); i++) {
+		InternalResourceLoad &load = loads[i];
+		if (load.res.is_null()) {
+			continue;
+		}
+		if (load.error != OK) {
+			error = load.error;
+			return error;
 		}
+
+		_finish_internal_resource(i, load);
 	}
 
-	return ERR_FILE_EOF;
+	return resource.is_valid() ? OK : ERR_FILE_EOF;
 }
 
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
@@ -914,12 +1165,18 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
 	if (len == 0) {
 		return String();
 	}
+	const uint8_t *mapped = len > 0 ? get_mapped_range(f, len) : nullptr;
+	if (mapped) {
+		String s;
+		s.parse_utf8((const char *)mapped, len);
+		return s;
+	}
+	if (len > str_buf.size()) {
+		str_buf.resize(len);
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
 	s.parse_utf8(&str_buf[0]);
@@ -1209,7 +1466,8 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	// Mapping lets the internal resources be parsed in parallel without a copy of the file for each task.
+	Ref<FileAccess> f = p_use_sub_threads ? FileAccess::open_mapped(p_path, &err) : FileAccess::open(p_path, FileAccess::READ, &err);
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
@@ -1311,7 +1569,7 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 
 		Ref<FileAccessCompressed> facw;
 		facw.instantiate();
-		facw->configure("RSCC");
+		facw->configure("RSCC", Compression::MODE_ZSTD, 4096, fac->get_dictionary_id());
 		err = facw->open_internal(p_path + ".depren", FileAccess::WRITE);
 		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Cannot create file '" + p_path + ".depren'.");
 
@@ -2124,7 +2382,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	if (p_flags & ResourceSaver::FLAG_COMPRESS) {
 		Ref<FileAccessCompressed> fac;
 		fac.instantiate();
-		fac->configure("RSCC");
+		fac->configure("RSCC", Compression::MODE_ZSTD, 4096, FileAccessCompressed::get_type_dictionary(_resource_get_class(p_resource)));
 		f = fac;
 		err = fac->open_internal(p_path, FileAccess::WRITE);
 	} else {
@@ -2380,7 +2638,7 @@ Error ResourceFormatSaverBinaryInstance::set_uid(const String &p_path, ResourceU
 
 		Ref<FileAccessCompressed> facw;
 		facw.instantiate();
-		facw->configure("RSCC");
+		facw->configure("RSCC", Compression::MODE_ZSTD, 4096, fac->get_dictionary_id());
 		err = facw->open_internal(p_path + ".uidren", FileAccess::WRITE);
 		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Cannot create file '" + p_path + ".uidren'.");
 
@@ -34,6 +34,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -78,6 +82,52 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	enum {
+		PARALLEL_MIN_INTERNAL_RESOURCES = 8,
+	};
+
+	struct InternalResourceLoad {
+		Ref<Resource> res; // Null if it was already loaded.
+		MissingResource *missing_resource = nullptr;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	// Set on the loaders that parse internal resources in parallel, which share the parent's tables.
+	const ResourceLoaderBinary *parent = nullptr;
+
+	Error _start_internal_resource(int p_index, InternalResourceLoad &r_load);
+	Error _parse_internal_resource(uint64_t p_offset, InternalResourceLoad &r_load);
+	void _finish_internal_resource(int p_index, InternalResourceLoad &p_load);
+	void _parse_internal_resource_task(uint32_t p_index, InternalResourceLoad *p_loads);
+	Error _load_internal_resources_parallel();
+
+	// Reads the internal resources ahead with many requests in flight, while they are parsed from memory.
+	struct Prefetch {
+		enum {
+			MIN_SIZE = 256 * 1024,
+			MAX_SIZE = 64 * 1024 * 1024,
+			CHUNK_SIZE = 128 * 1024,
+		};
+
+		struct Chunk {
+			uint64_t begin = 0;
+			uint64_t size = 0;
+			FileAccess::AsyncReadID id = nullptr;
+		};
+
+		Ref<FileAccess> file;
+		Vector<uint8_t> data;
+		Vector<Chunk> chunks;
+		int completed = 0;
+
+		bool start(const Ref<FileAccess> &p_file, uint64_t p_begin);
+		bool wait_until(uint64_t p_end);
+		~Prefetch();
+	};
+
+	Prefetch prefetch;
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
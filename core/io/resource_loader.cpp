@@ -31,6 +31,7 @@
 #include "resource_loader.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_trace.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
@@ -243,6 +244,8 @@ ResourceLoader::LoadToken::~LoadToken() {
 }
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_RESOURCE);
+	TRACE_ZONE_DETAIL("ResourceLoader::load", p_path);
 	const String &original_path = p_original_path.is_empty() ? p_path : p_original_path;
 	load_nesting++;
 	if (load_paths_stack->size()) {
@@ -280,6 +283,10 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 		return res;
 	}
 
+	if (found && is_current_load_canceled()) {
+		return Ref<Resource>(); // Not an error, nobody wants the result anymore.
+	}
+
 	ERR_FAIL_COND_V_MSG(found, Ref<Resource>(),
 			vformat("Failed loading resource: %s. Make sure resources have been imported by opening the project in the editor at least once.", p_path));
 
@@ -296,8 +303,11 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 
 	thread_load_mutex.lock();
 	caller_task_id = load_task.task_id;
-	if (cleaning_tasks) {
+	if (cleaning_tasks || load_task.shared.canceled.is_set()) {
 		load_task.status = THREAD_LOAD_FAILED;
+		if (load_task.shared.canceled.is_set()) {
+			load_task.error = ERR_SKIP;
+		}
 		thread_load_mutex.unlock();
 		return;
 	}
@@ -320,7 +330,10 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 	// --
 
 	Error load_err = OK;
+	ThreadLoadTask *prev_load_task = curr_load_task; // In case this is a nested load on the same thread.
+	curr_load_task = &load_task;
 	Ref<Resource> res = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
+	curr_load_task = prev_load_task;
 	if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
 		MessageQueue::get_singleton()->flush();
 	}
@@ -426,18 +439,22 @@ static String _validate_local_path(const String &p_path) {
 	}
 }
 
-Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode, ThreadLoadPriority p_priority) {
 	thread_load_mutex.lock();
 	if (user_load_tokens.has(p_path)) {
 		print_verbose("load_threaded_request(): Another threaded load for resource path '" + p_path + "' has been initiated. Not an error.");
-		user_load_tokens[p_path]->reference(); // Additional request.
+		LoadToken *load_token = user_load_tokens[p_path];
+		load_token->reference(); // Additional request.
+		if (p_priority == THREAD_LOAD_PRIORITY_HIGH && !load_token->local_path.is_empty()) {
+			_set_load_task_priority(thread_load_tasks[load_token->local_path], true);
+		}
 		thread_load_mutex.unlock();
 		return OK;
 	}
 	user_load_tokens[p_path] = nullptr;
 	thread_load_mutex.unlock();
 
-	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode);
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, p_priority);
 	if (token.is_valid()) {
 		thread_load_mutex.lock();
 		token->user_path = p_path;
@@ -468,9 +485,12 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	return res;
 }
 
-Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode) {
+Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, ThreadLoadPriority p_priority) {
 	String local_path = _validate_local_path(p_path);
 
+	// Dependencies take the priority of the load that needs them.
+	bool high_priority = p_priority == THREAD_LOAD_PRIORITY_HIGH || (curr_load_task && curr_load_task->high_priority);
+
 	bool ignoring_cache = p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE || p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP;
 
 	Ref<LoadToken> load_token;
@@ -484,6 +504,9 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (!ignoring_cache && thread_load_tasks.has(local_path)) {
 			load_token = Ref<LoadToken>(thread_load_tasks[local_path].load_token);
 			if (load_token.is_valid()) {
+				if (high_priority) {
+					_set_load_task_priority(thread_load_tasks[local_path], true);
+				}
 				return load_token;
 			} else {
 				// The token is dying (reached 0 on another thread).
@@ -505,6 +528,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			load_task.high_priority = high_priority;
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -535,7 +559,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr, load_task_ptr->high_priority);
 		}
 	}
 
@@ -571,7 +595,39 @@ float ResourceLoader::_dependency_get_progress(const String &p_path) {
 	}
 }
 
-ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, float *r_progress) {
+void ResourceLoader::_dependency_get_bytes(const String &p_path, uint64_t &r_loaded, uint64_t &r_total) {
+	if (thread_load_tasks.has(p_path)) {
+		ThreadLoadTask &load_task = thread_load_tasks[p_path];
+		r_loaded += load_task.shared.loaded_bytes.get();
+		r_total += load_task.shared.total_bytes.get();
+		for (const String &E : load_task.sub_tasks) {
+			_dependency_get_bytes(E, r_loaded, r_total);
+		}
+	}
+}
+
+void ResourceLoader::_set_load_task_priority(ThreadLoadTask &p_load_task, bool p_high_priority) {
+	// Expected to be called with the thread load mutex locked.
+	if (p_load_task.high_priority == p_high_priority) {
+		return;
+	}
+	p_load_task.high_priority = p_high_priority;
+	if (p_load_task.task_id != 0 && p_load_task.status == THREAD_LOAD_IN_PROGRESS) {
+		WorkerThreadPool::get_singleton()->set_task_priority(p_load_task.task_id, p_high_priority);
+	}
+
+	// Only raising is forwarded, since dependencies may be shared with other urgent loads.
+	if (p_high_priority) {
+		for (const String &E : p_load_task.sub_tasks) {
+			HashMap<String, ThreadLoadTask>::Iterator F = thread_load_tasks.find(E);
+			if (F) {
+				_set_load_task_priority(F->value, true);
+			}
+		}
+	}
+}
+
+ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, float *r_progress, uint64_t *r_loaded_bytes, uint64_t *r_total_bytes) {
 	bool ensure_progress = false;
 	ThreadLoadStatus status = THREAD_LOAD_IN_PROGRESS;
 	{
@@ -596,6 +652,17 @@ ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const
 		if (r_progress) {
 			*r_progress = _dependency_get_progress(local_path);
 		}
+		if (r_loaded_bytes || r_total_bytes) {
+			uint64_t loaded = 0;
+			uint64_t total = 0;
+			_dependency_get_bytes(local_path, loaded, total);
+			if (r_loaded_bytes) {
+				*r_loaded_bytes = loaded;
+			}
+			if (r_total_bytes) {
+				*r_total_bytes = total;
+			}
+		}
 
 		// Support userland polling in a loop on the main thread.
 		if (Thread::is_main_thread() && status == THREAD_LOAD_IN_PROGRESS) {
@@ -666,6 +733,71 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	return res;
 }
 
+Error ResourceLoader::load_threaded_set_priority(const String &p_path, ThreadLoadPriority p_priority) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_set_priority(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	if (!load_token) {
+		// This happens if requested from one thread and rapidly querying from another.
+		return ERR_BUSY;
+	}
+
+	HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_token->local_path);
+	if (E) {
+		_set_load_task_priority(E->value, p_priority == THREAD_LOAD_PRIORITY_HIGH);
+	}
+	return OK;
+}
+
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+
+		if (!user_load_tokens.has(p_path)) {
+			print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+			return ERR_INVALID_PARAMETER;
+		}
+
+		LoadToken *load_token = user_load_tokens[p_path];
+		if (!load_token) {
+			// This happens if requested from one thread and rapidly querying from another.
+			return ERR_BUSY;
+		}
+
+		// The load can only be stopped if this is the last request and no other load depends on it.
+		if (!load_token->local_path.is_empty() && load_token->get_reference_count() == 1) {
+			ThreadLoadTask &load_task = thread_load_tasks[load_token->local_path];
+			if (load_task.status == THREAD_LOAD_IN_PROGRESS) {
+				load_task.shared.canceled.set();
+				if (load_task.task_id != 0) {
+					// Let it bail out now instead of waiting for its turn.
+					WorkerThreadPool::get_singleton()->set_task_priority(load_task.task_id, true);
+				}
+			}
+		}
+	}
+
+	// The token can't go away before its task is done, so this waits like collecting the result does.
+	load_threaded_get(p_path);
+	return OK;
+}
+
+void ResourceLoader::set_current_load_bytes(uint64_t p_loaded, uint64_t p_total) {
+	if (curr_load_task) {
+		curr_load_task->shared.loaded_bytes.set(p_loaded);
+		curr_load_task->shared.total_bytes.set(p_total);
+	}
+}
+
+bool ResourceLoader::is_current_load_canceled() {
+	return curr_load_task && curr_load_task->shared.canceled.is_set();
+}
+
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
 	MutexLock thread_load_lock(thread_load_mutex);
 	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
@@ -738,6 +870,7 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 					if (!load_task.cond_var) {
 						load_task.cond_var = memnew(ConditionVariable);
 					}
+					TRACE_ZONE_DETAIL("ResourceLoader::wait", p_load_token.local_path);
 					do {
 						load_task.cond_var->wait(p_thread_load_lock);
 						DEV_ASSERT(thread_load_tasks.has(p_load_token.local_path) && p_load_token.get_reference_count());
@@ -1309,6 +1442,7 @@ bool ResourceLoader::timestamp_on_load = false;
 
 thread_local int ResourceLoader::load_nesting = 0;
 thread_local WorkerThreadPool::TaskID ResourceLoader::caller_task_id = 0;
+thread_local ResourceLoader::ThreadLoadTask *ResourceLoader::curr_load_task = nullptr;
 thread_local Vector<String> *ResourceLoader::load_paths_stack = nullptr;
 thread_local HashMap<int, HashMap<String, Ref<Resource>>> ResourceLoader::res_ref_overrides;
 
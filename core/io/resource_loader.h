@@ -112,6 +112,11 @@ public:
 		THREAD_LOAD_LOADED
 	};
 
+	enum ThreadLoadPriority {
+		THREAD_LOAD_PRIORITY_NORMAL,
+		THREAD_LOAD_PRIORITY_HIGH,
+	};
+
 	enum LoadThreadMode {
 		LOAD_THREAD_FROM_CURRENT,
 		LOAD_THREAD_SPAWN_SINGLE,
@@ -130,7 +135,7 @@ public:
 
 	static const int BINARY_MUTEX_TAG = 1;
 
-	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode);
+	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, ThreadLoadPriority p_priority = THREAD_LOAD_PRIORITY_NORMAL);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
 
 private:
@@ -180,13 +185,31 @@ private:
 		Ref<Resource> resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
+		bool high_priority = false;
+		// Written and read from different threads while loading. Tasks are only copied before they start.
+		struct SharedState {
+			SafeNumeric<uint64_t> loaded_bytes;
+			SafeNumeric<uint64_t> total_bytes;
+			SafeFlag canceled; // Checked before the load starts and polled by loaders, see is_current_load_canceled().
+
+			SharedState() {}
+			SharedState(const SharedState &p_other) { *this = p_other; }
+			SharedState &operator=(const SharedState &p_other) {
+				loaded_bytes.set(p_other.loaded_bytes.get());
+				total_bytes.set(p_other.total_bytes.get());
+				canceled.set_to(p_other.canceled.is_set());
+				return *this;
+			}
+		} shared;
 		HashSet<String> sub_tasks;
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static void _set_load_task_priority(ThreadLoadTask &p_load_task, bool p_high_priority);
 
 	static thread_local int load_nesting;
 	static thread_local WorkerThreadPool::TaskID caller_task_id;
+	static thread_local ThreadLoadTask *curr_load_task;
 	static thread_local HashMap<int, HashMap<String, Ref<Resource>>> res_ref_overrides; // Outermost key is nesting level.
 	static thread_local Vector<String> *load_paths_stack; // A pointer to avoid broken TLS implementations from double-running the destructor.
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> thread_load_mutex;
@@ -196,13 +219,20 @@ private:
 	static HashMap<String, LoadToken *> user_load_tokens;
 
 	static float _dependency_get_progress(const String &p_path);
+	static void _dependency_get_bytes(const String &p_path, uint64_t &r_loaded, uint64_t &r_total);
 
 	static bool _ensure_load_progress();
 
 public:
-	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
-	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
+	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, ThreadLoadPriority p_priority = THREAD_LOAD_PRIORITY_NORMAL);
+	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr, uint64_t *r_loaded_bytes = nullptr, uint64_t *r_total_bytes = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_set_priority(const String &p_path, ThreadLoadPriority p_priority);
+	static Error load_threaded_cancel(const String &p_path);
+
+	// Loaders can use these to report byte progress and to stop early if the load they run is no longer wanted.
+	static void set_current_load_bytes(uint64_t p_loaded, uint64_t p_total);
+	static bool is_current_load_canceled();
 
 	static bool is_within_load() { return load_nesting > 0; };
 
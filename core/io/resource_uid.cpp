@@ -34,12 +34,22 @@
 #include "core/crypto/crypto_core.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
 
 // These constants are off by 1, causing the 'z' and '9' characters never to be used.
 // This cannot be fixed without breaking compatibility; see GH-83843.
 static constexpr uint32_t char_count = ('z' - 'a');
 static constexpr uint32_t base = char_count + ('9' - '0');
 
+// The cache file starts with a table of IDs sorted for binary search, followed by their paths,
+// so it can be used as loaded. IDs added afterwards are appended as a journal of
+// (ID, length, path) records, until the file is rewritten with all of them in the table.
+static const uint8_t CACHE_MAGIC[4] = { 'U', 'I', 'D', 'C' };
+static constexpr uint32_t CACHE_VERSION = 1;
+static constexpr uint32_t CACHE_HEADER_SIZE = 20; // Magic, version, table count, paths size and journal count.
+static constexpr uint32_t CACHE_JOURNAL_COUNT_OFFSET = 16;
+static constexpr uint32_t CACHE_ENTRY_SIZE = 16; // ID, path offset and path length.
+
 String ResourceUID::get_cache_file() {
 	return ProjectSettings::get_singleton()->get_project_data_path().path_join("uid_cache.bin");
 }
@@ -84,6 +94,39 @@ ResourceUID::ID ResourceUID::text_to_id(const String &p_text) const {
 	return ID(uid & 0x7FFFFFFFFFFFFFFF);
 }
 
+int64_t ResourceUID::_find_cached(ID p_id) const {
+	const uint8_t *entries = cache_table_ptr + CACHE_HEADER_SIZE;
+	uint32_t low = 0;
+	uint32_t high = cache_table_count;
+	while (low < high) {
+		uint32_t middle = low + (high - low) / 2;
+		ID id = (ID)decode_uint64(entries + middle * CACHE_ENTRY_SIZE);
+		if (id < p_id) {
+			low = middle + 1;
+		} else if (id > p_id) {
+			high = middle;
+		} else {
+			return middle;
+		}
+	}
+	return -1;
+}
+
+const char *ResourceUID::_get_cached_path(int64_t p_index, uint32_t &r_length) const {
+	const uint8_t *entry = cache_table_ptr + CACHE_HEADER_SIZE + p_index * CACHE_ENTRY_SIZE;
+	const uint8_t *paths = cache_table_ptr + CACHE_HEADER_SIZE + cache_table_count * CACHE_ENTRY_SIZE;
+	r_length = decode_uint32(entry + 12);
+	return (const char *)paths + decode_uint32(entry + 8);
+}
+
+bool ResourceUID::_has_id(ID p_id) const {
+	HashMap<ID, Cache>::ConstIterator E = unique_ids.find(p_id);
+	if (E) {
+		return !E->value.removed;
+	}
+	return _find_cached(p_id) != -1;
+}
+
 ResourceUID::ID ResourceUID::create_id() {
 	while (true) {
 		ID id = INVALID_ID;
@@ -91,7 +134,7 @@ ResourceUID::ID ResourceUID::create_id() {
 		Error err = ((CryptoCore::RandomGenerator *)crypto)->get_random_bytes((uint8_t *)&id, sizeof(id));
 		ERR_FAIL_COND_V(err != OK, INVALID_ID);
 		id &= 0x7FFFFFFFFFFFFFFF;
-		bool exists = unique_ids.has(id);
+		bool exists = _has_id(id);
 		if (!exists) {
 			return id;
 		}
@@ -100,11 +143,11 @@ ResourceUID::ID ResourceUID::create_id() {
 
 bool ResourceUID::has_id(ID p_id) const {
 	MutexLock l(mutex);
-	return unique_ids.has(p_id);
+	return _has_id(p_id);
 }
 void ResourceUID::add_id(ID p_id, const String &p_path) {
 	MutexLock l(mutex);
-	ERR_FAIL_COND(unique_ids.has(p_id));
+	ERR_FAIL_COND(_has_id(p_id));
 	Cache c;
 	c.cs = p_path.utf8();
 	unique_ids[p_id] = c;
@@ -113,30 +156,60 @@ void ResourceUID::add_id(ID p_id, const String &p_path) {
 
 void ResourceUID::set_id(ID p_id, const String &p_path) {
 	MutexLock l(mutex);
-	ERR_FAIL_COND(!unique_ids.has(p_id));
+	ERR_FAIL_COND(!_has_id(p_id));
 	CharString cs = p_path.utf8();
+
+	HashMap<ID, Cache>::Iterator E = unique_ids.find(p_id);
+	if (!E) {
+		uint32_t cached_length = 0;
+		const char *cached_ptr = _get_cached_path(_find_cached(p_id), cached_length);
+		if (uint32_t(cs.length()) == cached_length && (cached_length == 0 || memcmp(cs.ptr(), cached_ptr, cached_length) == 0)) {
+			return; // Unchanged.
+		}
+		Cache c;
+		c.cs = cs;
+		unique_ids[p_id] = c;
+		changed = true;
+		return;
+	}
+
 	const char *update_ptr = cs.ptr();
-	const char *cached_ptr = unique_ids[p_id].cs.ptr();
+	const char *cached_ptr = E->value.cs.ptr();
 	if (update_ptr == nullptr && cached_ptr == nullptr) {
 		return; // Both are empty strings.
 	}
 	if ((update_ptr == nullptr) != (cached_ptr == nullptr) || strcmp(update_ptr, cached_ptr) != 0) {
-		unique_ids[p_id].cs = cs;
-		unique_ids[p_id].saved_to_cache = false; //changed
+		E->value.cs = cs;
+		E->value.saved_to_cache = false; //changed
 		changed = true;
 	}
 }
 
 String ResourceUID::get_id_path(ID p_id) const {
 	MutexLock l(mutex);
-	ERR_FAIL_COND_V(!unique_ids.has(p_id), String());
-	const CharString &cs = unique_ids[p_id].cs;
-	return String::utf8(cs.ptr());
+	HashMap<ID, Cache>::ConstIterator E = unique_ids.find(p_id);
+	if (E) {
+		ERR_FAIL_COND_V(E->value.removed, String());
+		return String::utf8(E->value.cs.ptr());
+	}
+
+	int64_t index = _find_cached(p_id);
+	ERR_FAIL_COND_V(index == -1, String());
+	uint32_t length = 0;
+	const char *path = _get_cached_path(index, length);
+	return String::utf8(path, length);
 }
 void ResourceUID::remove_id(ID p_id) {
 	MutexLock l(mutex);
-	ERR_FAIL_COND(!unique_ids.has(p_id));
-	unique_ids.erase(p_id);
+	ERR_FAIL_COND(!_has_id(p_id));
+	if (_find_cached(p_id) != -1) {
+		Cache c;
+		c.saved_to_cache = true;
+		c.removed = true;
+		unique_ids[p_id] = c;
+	} else {
+		unique_ids.erase(p_id);
+	}
 }
 
 Error ResourceUID::save_to_cache() {
@@ -146,66 +219,246 @@ Error ResourceUID::save_to_cache() {
 		d->make_dir_recursive(String(cache_file).get_base_dir()); //ensure base dir exists
 	}
 
+	MutexLock l(mutex);
+	// Writing truncates the file, which must not be mapped then.
+	_unmap_cache_table();
+
 	Ref<FileAccess> f = FileAccess::open(cache_file, FileAccess::WRITE);
 	if (f.is_null()) {
 		return ERR_CANT_OPEN;
 	}
 
-	MutexLock l(mutex);
-	f->store_32(unique_ids.size());
+	struct Entry {
+		ID id = INVALID_ID;
+		const char *path = nullptr;
+		uint32_t length = 0;
+
+		bool operator<(const Entry &p_entry) const { return id < p_entry.id; }
+	};
+
+	LocalVector<Entry> entries;
+	entries.reserve(cache_table_count + unique_ids.size());
+	uint64_t paths_size = 0;
+	for (uint32_t i = 0; i < cache_table_count; i++) {
+		Entry entry;
+		entry.id = (ID)decode_uint64(cache_table_ptr + CACHE_HEADER_SIZE + i * CACHE_ENTRY_SIZE);
+		if (unique_ids.has(entry.id)) {
+			continue; // Changed or removed.
+		}
+		entry.path = _get_cached_path(i, entry.length);
+		entries.push_back(entry);
+		paths_size += entry.length;
+	}
+	for (const KeyValue<ID, Cache> &E : unique_ids) {
+		if (E.value.removed) {
+			continue;
+		}
+		Entry entry;
+		entry.id = E.key;
+		entry.path = E.value.cs.ptr();
+		entry.length = E.value.cs.length();
+		entries.push_back(entry);
+		paths_size += entry.length;
+	}
+	entries.sort();
+
+	uint64_t table_size = CACHE_HEADER_SIZE + uint64_t(entries.size()) * CACHE_ENTRY_SIZE;
+	ERR_FAIL_COND_V_MSG(table_size + paths_size > UINT32_MAX, ERR_OUT_OF_MEMORY, "The UID cache is too large.");
+
+	Vector<uint8_t> data;
+	data.resize(table_size + paths_size);
+	uint8_t *w = data.ptrw();
+	memcpy(w, CACHE_MAGIC, 4);
+	encode_uint32(CACHE_VERSION, w + 4);
+	encode_uint32(entries.size(), w + 8);
+	encode_uint32(paths_size, w + 12);
+	encode_uint32(0, w + CACHE_JOURNAL_COUNT_OFFSET);
+
+	uint32_t path_offset = 0;
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		uint8_t *entry = w + CACHE_HEADER_SIZE + i * CACHE_ENTRY_SIZE;
+		encode_uint64(entries[i].id, entry);
+		encode_uint32(path_offset, entry + 8);
+		encode_uint32(entries[i].length, entry + 12);
+		if (entries[i].length > 0) {
+			memcpy(w + table_size + path_offset, entries[i].path, entries[i].length);
+		}
+		path_offset += entries[i].length;
+	}
 
-	cache_entries = 0;
+	f->store_buffer(data.ptr(), data.size());
 
-	for (KeyValue<ID, Cache> &E : unique_ids) {
-		f->store_64(E.key);
-		uint32_t s = E.value.cs.length();
-		f->store_32(s);
-		f->store_buffer((const uint8_t *)E.value.cs.ptr(), s);
-		E.value.saved_to_cache = true;
-		cache_entries++;
-	}
+	// The written file becomes the table all lookups go through.
+	cache_table = data;
+	cache_table_ptr = cache_table.ptr();
+	cache_table_count = entries.size();
+	cache_journal_count = 0;
+	unique_ids.clear();
 
+	cache_entries = cache_table_count;
 	changed = false;
 	return OK;
 }
 
-Error ResourceUID::load_from_cache(bool p_reset) {
-	Ref<FileAccess> f = FileAccess::open(get_cache_file(), FileAccess::READ);
-	if (f.is_null()) {
-		return ERR_CANT_OPEN;
+void ResourceUID::_unmap_cache_table() {
+	if (cache_table_file.is_null()) {
+		return;
 	}
+	// Only the table is read in place, the journal appended after it may not be mapped.
+	const uint32_t paths_size = decode_uint32(cache_table_ptr + 12);
+	cache_table.resize(CACHE_HEADER_SIZE + uint64_t(cache_table_count) * CACHE_ENTRY_SIZE + paths_size);
+	memcpy(cache_table.ptrw(), cache_table_ptr, cache_table.size());
+	cache_table_ptr = cache_table.ptr();
+	cache_table_file.unref();
+}
 
-	MutexLock l(mutex);
-	if (p_reset) {
-		unique_ids.clear();
+void ResourceUID::_clear_cache_table() {
+	cache_table_file.unref();
+	cache_table.clear();
+	cache_table_ptr = nullptr;
+	cache_table_count = 0;
+	cache_journal_count = 0;
+}
+
+Error ResourceUID::_load_cache_table(const uint8_t *p_data, uint64_t p_size, bool p_use_in_place) {
+	// When used in place, the caller keeps the data around.
+	const uint8_t *ptr = p_data;
+	uint64_t size = p_size;
+	ERR_FAIL_COND_V(size < CACHE_HEADER_SIZE, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V_MSG(decode_uint32(ptr + 4) != CACHE_VERSION, ERR_FILE_UNRECOGNIZED, "Unsupported UID cache version.");
+
+	uint32_t table_count = decode_uint32(ptr + 8);
+	uint32_t paths_size = decode_uint32(ptr + 12);
+	uint32_t journal_count = decode_uint32(ptr + CACHE_JOURNAL_COUNT_OFFSET);
+	uint64_t paths_start = CACHE_HEADER_SIZE + uint64_t(table_count) * CACHE_ENTRY_SIZE;
+	uint64_t journal_start = paths_start + paths_size;
+	ERR_FAIL_COND_V(journal_start > size, ERR_FILE_CORRUPT);
+
+	// Only check that paths stay within the file, lookups read them in place.
+	for (uint32_t i = 0; i < table_count; i++) {
+		const uint8_t *entry = ptr + CACHE_HEADER_SIZE + i * CACHE_ENTRY_SIZE;
+		ERR_FAIL_COND_V(uint64_t(decode_uint32(entry + 8)) + decode_uint32(entry + 12) > paths_size, ERR_FILE_CORRUPT);
 	}
 
-	uint32_t entry_count = f->get_32();
-	for (uint32_t i = 0; i < entry_count; i++) {
-		int64_t id = f->get_64();
-		int32_t len = f->get_32();
+	if (p_use_in_place) {
+		cache_table_ptr = p_data;
+		cache_table_count = table_count;
+		cache_journal_count = journal_count;
+	} else {
+		for (uint32_t i = 0; i < table_count; i++) {
+			const uint8_t *entry = ptr + CACHE_HEADER_SIZE + i * CACHE_ENTRY_SIZE;
+			uint32_t len = decode_uint32(entry + 12);
+			Cache c;
+			c.cs.resize(len + 1);
+			memcpy(c.cs.ptrw(), ptr + paths_start + decode_uint32(entry + 8), len);
+			c.cs[len] = 0;
+			c.saved_to_cache = true;
+			unique_ids[(ID)decode_uint64(entry)] = c;
+		}
+	}
+
+	uint64_t pos = journal_start;
+	for (uint32_t i = 0; i < journal_count; i++) {
+		ERR_FAIL_COND_V(pos + 12 > size, ERR_FILE_CORRUPT);
+		ID id = (ID)decode_uint64(ptr + pos);
+		uint32_t len = decode_uint32(ptr + pos + 8);
+		pos += 12;
+		ERR_FAIL_COND_V(pos + len > size, ERR_FILE_CORRUPT);
+
 		Cache c;
 		c.cs.resize(len + 1);
-		ERR_FAIL_COND_V(c.cs.size() != len + 1, ERR_FILE_CORRUPT); // out of memory
+		memcpy(c.cs.ptrw(), ptr + pos, len);
 		c.cs[len] = 0;
-		int32_t rl = f->get_buffer((uint8_t *)c.cs.ptrw(), len);
-		ERR_FAIL_COND_V(rl != len, ERR_FILE_CORRUPT);
+		c.saved_to_cache = true;
+		unique_ids[id] = c;
+		pos += len;
+	}
 
+	cache_entries = table_count + journal_count;
+	return OK;
+}
+
+Error ResourceUID::_load_legacy_cache(const uint8_t *p_data, uint64_t p_size) {
+	// Files written before the table format list (ID, length, path) records.
+	const uint8_t *ptr = p_data;
+	uint64_t size = p_size;
+	ERR_FAIL_COND_V(size < 4, ERR_FILE_CORRUPT);
+
+	uint32_t entry_count = decode_uint32(ptr);
+	uint64_t pos = 4;
+	for (uint32_t i = 0; i < entry_count; i++) {
+		ERR_FAIL_COND_V(pos + 12 > size, ERR_FILE_CORRUPT);
+		ID id = (ID)decode_uint64(ptr + pos);
+		uint32_t len = decode_uint32(ptr + pos + 8);
+		pos += 12;
+		ERR_FAIL_COND_V(pos + len > size, ERR_FILE_CORRUPT);
+
+		Cache c;
+		c.cs.resize(len + 1);
+		ERR_FAIL_COND_V(c.cs.size() != int(len + 1), ERR_FILE_CORRUPT); // out of memory
+		memcpy(c.cs.ptrw(), ptr + pos, len);
+		c.cs[len] = 0;
 		c.saved_to_cache = true;
 		unique_ids[id] = c;
+		pos += len;
 	}
 
-	cache_entries = entry_count;
-	changed = false;
+	// Rewrite the file in the table format on the next update.
+	cache_entries = 0;
 	return OK;
 }
 
+Error ResourceUID::load_from_cache(bool p_reset) {
+	Ref<FileAccess> f = FileAccess::open_mapped(get_cache_file());
+	if (f.is_null()) {
+		return ERR_CANT_OPEN;
+	}
+
+	// The table is read in place, so a mapped file is kept open instead of being copied.
+	Vector<uint8_t> data;
+	const uint8_t *ptr = f->get_mapped_data();
+	const uint64_t size = f->get_length();
+	if (!ptr) {
+		data.resize(size);
+		ERR_FAIL_COND_V(f->get_buffer(data.ptrw(), data.size()) != uint64_t(data.size()), ERR_FILE_CORRUPT);
+		ptr = data.ptr();
+	}
+
+	MutexLock l(mutex);
+	if (p_reset) {
+		unique_ids.clear();
+		_clear_cache_table();
+	}
+
+	Error err;
+	if (size >= 4 && memcmp(ptr, CACHE_MAGIC, 4) == 0) {
+		// Entries are merged into the overlay when there's a table already (e.g. from another pack).
+		bool use_in_place = cache_table_count == 0 && unique_ids.is_empty();
+		err = _load_cache_table(ptr, size, use_in_place);
+		if (use_in_place) {
+			if (data.is_empty()) {
+				cache_table_file = f;
+			} else {
+				cache_table = data;
+			}
+		} else if (err == OK) {
+			cache_entries = 0;
+		}
+	} else {
+		err = _load_legacy_cache(ptr, size);
+	}
+
+	changed = false;
+	return err;
+}
+
 Error ResourceUID::update_cache() {
 	if (!changed) {
 		return OK;
 	}
 
-	if (cache_entries == 0) {
+	// Rewrite the whole table once the journal grows large enough to slow down loading.
+	if (cache_entries == 0 || cache_journal_count >= cache_table_count / 4) {
 		return save_to_cache();
 	}
 	MutexLock l(mutex);
@@ -225,13 +478,14 @@ Error ResourceUID::update_cache() {
 			f->store_32(s);
 			f->store_buffer((const uint8_t *)E.value.cs.ptr(), s);
 			E.value.saved_to_cache = true;
+			cache_journal_count++;
 			cache_entries++;
 		}
 	}
 
 	if (f.is_valid()) {
-		f->seek(0);
-		f->store_32(cache_entries); //update amount of entries
+		f->seek(CACHE_JOURNAL_COUNT_OFFSET);
+		f->store_32(cache_journal_count); //update amount of entries
 	}
 
 	changed = false;
@@ -242,6 +496,7 @@ Error ResourceUID::update_cache() {
 void ResourceUID::clear() {
 	cache_entries = 0;
 	unique_ids.clear();
+	_clear_cache_table();
 	changed = false;
 }
 void ResourceUID::_bind_methods() {
@@ -35,6 +35,8 @@
 #include "core/string/string_name.h"
 #include "core/templates/hash_map.h"
 
+class FileAccess;
+
 class ResourceUID : public Object {
 	GDCLASS(ResourceUID, Object)
 public:
@@ -51,14 +53,31 @@ private:
 	struct Cache {
 		CharString cs;
 		bool saved_to_cache = false;
+		bool removed = false; // Hides an ID of the cache table.
 	};
 
-	HashMap<ID, Cache> unique_ids; //unique IDs and utf8 paths (less memory used)
+	HashMap<ID, Cache> unique_ids; // IDs added or changed since the cache table was loaded, with their utf8 paths.
 	static ResourceUID *singleton;
 
+	// The contents of the cache file. Its table of IDs is sorted and looked up in place, from the file mapping while
+	// `cache_table_file` is open, or from `cache_table` otherwise.
+	Ref<FileAccess> cache_table_file;
+	Vector<uint8_t> cache_table;
+	const uint8_t *cache_table_ptr = nullptr;
+	uint32_t cache_table_count = 0;
+	uint32_t cache_journal_count = 0;
+
 	uint32_t cache_entries = 0;
 	bool changed = false;
 
+	int64_t _find_cached(ID p_id) const;
+	const char *_get_cached_path(int64_t p_index, uint32_t &r_length) const;
+	bool _has_id(ID p_id) const;
+	void _unmap_cache_table();
+	void _clear_cache_table();
+	Error _load_cache_table(const uint8_t *p_data, uint64_t p_size, bool p_use_in_place);
+	Error _load_legacy_cache(const uint8_t *p_data, uint64_t p_size);
+
 protected:
 	static void _bind_methods();
 
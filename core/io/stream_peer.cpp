@@ -213,9 +213,18 @@ void StreamPeer::put_utf8_string(const String &p_string) {
 }
 
 void StreamPeer::put_var(const Variant &p_variant, bool p_full_objects) {
+	// Small values are encoded in a single pass on the stack.
+	uint8_t stack_buf[256];
 	int len = 0;
+	Error err = encode_variant_bounded(p_variant, stack_buf, sizeof(stack_buf), len, p_full_objects);
+	ERR_FAIL_COND_MSG(err != OK, "Error when trying to encode Variant.");
+	if (len <= (int)sizeof(stack_buf)) {
+		put_32(len);
+		put_data(stack_buf, len);
+		return;
+	}
+
 	Vector<uint8_t> buf;
-	encode_variant(p_variant, nullptr, len, p_full_objects);
 	buf.resize(len);
 	put_32(len);
 	encode_variant(p_variant, buf.ptrw(), len, p_full_objects);
@@ -107,6 +107,8 @@ void AStar3D::remove_point(int64_t p_id) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't remove point. Point with id: %d doesn't exist.", p_id));
 
+	_expand();
+
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 		Segment s(p_id, (*it.key));
 		segments.erase(s);
@@ -139,6 +141,8 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	bool to_exists = points.lookup(p_with_id, b);
 	ERR_FAIL_COND_MSG(!to_exists, vformat("Can't connect points. Point with id: %d doesn't exist.", p_with_id));
 
+	_expand();
+
 	a->neighbors.set(b->id, b);
 
 	if (bidirectional) {
@@ -175,6 +179,8 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 	bool b_exists = points.lookup(p_with_id, b);
 	ERR_FAIL_COND_MSG(!b_exists, vformat("Can't disconnect points. Point with id: %d doesn't exist.", p_with_id));
 
+	_expand();
+
 	Segment s(p_id, p_with_id);
 	int remove_direction = bidirectional ? (int)Segment::BIDIRECTIONAL : (int)s.direction;
 
@@ -227,6 +233,13 @@ Vector<int64_t> AStar3D::get_point_connections(int64_t p_id) {
 
 	Vector<int64_t> point_list;
 
+	if (compact_graph) {
+		for (uint32_t i = p->compact_neighbors_begin; i < p->compact_neighbors_end; i++) {
+			point_list.push_back(compact_neighbors[i]->id);
+		}
+		return point_list;
+	}
+
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 		point_list.push_back((*it.key));
 	}
@@ -249,6 +262,74 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	compact_neighbors.reset();
+	compact_graph = false;
+}
+
+void AStar3D::compact() {
+	if (compact_graph) {
+		return;
+	}
+
+	uint32_t neighbor_count = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		neighbor_count += (*it.value)->neighbors.get_num_elements();
+	}
+
+	compact_neighbors.clear();
+	compact_neighbors.reserve(neighbor_count);
+
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *it.value;
+		p->compact_neighbors_begin = compact_neighbors.size();
+		for (OAHashMap<int64_t, Point *>::Iterator nit = p->neighbors.iter(); nit.valid; nit = p->neighbors.next_iter(nit)) {
+			compact_neighbors.push_back(*nit.value);
+		}
+		p->compact_neighbors_end = compact_neighbors.size();
+
+		// Release the maps, the segments keep what is needed to rebuild them.
+		p->neighbors = OAHashMap<int64_t, Point *>(1u);
+		p->unlinked_neighbours = OAHashMap<int64_t, Point *>(1u);
+	}
+
+	compact_graph = true;
+}
+
+bool AStar3D::is_compact() const {
+	return compact_graph;
+}
+
+void AStar3D::_expand() {
+	if (!compact_graph) {
+		return;
+	}
+
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *it.value;
+		for (uint32_t i = p->compact_neighbors_begin; i < p->compact_neighbors_end; i++) {
+			p->neighbors.set(compact_neighbors[i]->id, compact_neighbors[i]);
+		}
+		p->compact_neighbors_begin = 0;
+		p->compact_neighbors_end = 0;
+	}
+
+	// One-way segments are stored as unlinked neighbors on their target point.
+	for (const Segment &E : segments) {
+		if (E.direction == Segment::BIDIRECTIONAL) {
+			continue;
+		}
+		Point *from_point = nullptr, *to_point = nullptr;
+		points.lookup(E.key.first, from_point);
+		points.lookup(E.key.second, to_point);
+		if (E.direction == Segment::FORWARD) {
+			to_point->unlinked_neighbours.set(from_point->id, from_point);
+		} else {
+			from_point->unlinked_neighbours.set(to_point->id, to_point);
+		}
+	}
+
+	compact_neighbors.reset();
+	compact_graph = false;
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -355,11 +436,9 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 		open_list.remove_at(open_list.size() - 1);
 		p->closed_pass = pass; // Mark the point as closed.
 
-		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			Point *e = *(it.value); // The neighbor point.
-
+		const auto visit_neighbor = [&](Point *e) {
 			if (!e->enabled || e->closed_pass == pass) {
-				continue;
+				return;
 			}
 
 			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
@@ -371,7 +450,7 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
+				return;
 			}
 
 			e->prev_point = p;
@@ -385,6 +464,16 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 			} else {
 				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
 			}
+		};
+
+		if (compact_graph) {
+			for (uint32_t i = p->compact_neighbors_begin; i < p->compact_neighbors_end; i++) {
+				visit_neighbor(compact_neighbors[i]);
+			}
+		} else {
+			for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
+				visit_neighbor(*(it.value));
+			}
 		}
 	}
 
@@ -572,6 +661,8 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_capacity"), &AStar3D::get_point_capacity);
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar3D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar3D::clear);
+	ClassDB::bind_method(D_METHOD("compact"), &AStar3D::compact);
+	ClassDB::bind_method(D_METHOD("is_compact"), &AStar3D::is_compact);
 
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar3D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar3D::get_closest_position_in_segment);
@@ -662,6 +753,14 @@ void AStar2D::clear() {
 	astar.clear();
 }
 
+void AStar2D::compact() {
+	astar.compact();
+}
+
+bool AStar2D::is_compact() const {
+	return astar.is_compact();
+}
+
 void AStar2D::reserve_space(int64_t p_num_nodes) {
 	astar.reserve_space(p_num_nodes);
 }
@@ -852,11 +951,9 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 		open_list.remove_at(open_list.size() - 1);
 		p->closed_pass = astar.pass; // Mark the point as closed.
 
-		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			AStar3D::Point *e = *(it.value); // The neighbor point.
-
+		const auto visit_neighbor = [&](AStar3D::Point *e) {
 			if (!e->enabled || e->closed_pass == astar.pass) {
-				continue;
+				return;
 			}
 
 			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
@@ -868,7 +965,7 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
+				return;
 			}
 
 			e->prev_point = p;
@@ -882,6 +979,16 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 			} else {
 				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
 			}
+		};
+
+		if (astar.compact_graph) {
+			for (uint32_t i = p->compact_neighbors_begin; i < p->compact_neighbors_end; i++) {
+				visit_neighbor(astar.compact_neighbors[i]);
+			}
+		} else {
+			for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
+				visit_neighbor(*(it.value));
+			}
 		}
 	}
 
@@ -911,6 +1018,8 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_capacity"), &AStar2D::get_point_capacity);
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar2D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar2D::clear);
+	ClassDB::bind_method(D_METHOD("compact"), &AStar2D::compact);
+	ClassDB::bind_method(D_METHOD("is_compact"), &AStar2D::is_compact);
 
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
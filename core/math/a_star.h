@@ -33,6 +33,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -54,6 +55,10 @@ class AStar3D : public RefCounted {
 		OAHashMap<int64_t, Point *> neighbors = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
 
+		// Range of the neighbors in compact_neighbors, used instead of the maps above once the graph is compact.
+		uint32_t compact_neighbors_begin = 0;
+		uint32_t compact_neighbors_end = 0;
+
 		// Used for pathfinding.
 		Point *prev_point = nullptr;
 		real_t g_score = 0;
@@ -115,6 +120,10 @@ class AStar3D : public RefCounted {
 	HashSet<Segment, Segment> segments;
 	Point *last_closest_point = nullptr;
 
+	bool compact_graph = false;
+	LocalVector<Point *> compact_neighbors;
+
+	void _expand();
 	bool _solve(Point *begin_point, Point *end_point);
 
 protected:
@@ -157,6 +166,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void compact();
+	bool is_compact() const;
+
 	int64_t get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
@@ -213,6 +225,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void compact();
+	bool is_compact() const;
+
 	int64_t get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
@@ -60,6 +60,16 @@ static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to)
 
 static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidean, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
 
+static void push_hierarchy_transitions(LocalVector<Vector2i> &r_transitions, const Vector2i &p_run_begin, const Vector2i &p_run_end) {
+	// Long runs of open border cells get an entrance on each end, short ones a single entrance in the middle.
+	if (MAX(p_run_end.x - p_run_begin.x, p_run_end.y - p_run_begin.y) >= 5) {
+		r_transitions.push_back(p_run_begin);
+		r_transitions.push_back(p_run_end);
+	} else {
+		r_transitions.push_back((p_run_begin + p_run_end) / 2);
+	}
+}
+
 void AStarGrid2D::set_region(const Rect2i &p_region) {
 	ERR_FAIL_COND(p_region.size.x < 0 || p_region.size.y < 0);
 	if (p_region != region) {
@@ -154,6 +164,8 @@ void AStarGrid2D::update() {
 		points.push_back(line);
 	}
 
+	_clear_hierarchy();
+
 	dirty = false;
 }
 
@@ -204,10 +216,24 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 	return default_estimate_heuristic;
 }
 
+void AStarGrid2D::set_hierarchy_cluster_size(int32_t p_cluster_size) {
+	ERR_FAIL_COND_MSG(p_cluster_size < 0, vformat("Can't set hierarchy cluster size less than 0: %d.", p_cluster_size));
+	if (hierarchy_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchy_cluster_size = p_cluster_size;
+	_clear_hierarchy();
+}
+
+int32_t AStarGrid2D::get_hierarchy_cluster_size() const {
+	return hierarchy_cluster_size;
+}
+
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
 	_get_point_unchecked(p_id)->solid = p_solid;
+	_mark_hierarchy_dirty(Rect2i(p_id, Vector2i(1, 1)));
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -221,6 +247,7 @@ void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_s
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	_mark_hierarchy_dirty(Rect2i(p_id, Vector2i(1, 1)));
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
@@ -241,6 +268,8 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_get_point_unchecked(x, y)->solid = p_solid;
 		}
 	}
+
+	_mark_hierarchy_dirty(safe_region);
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -256,6 +285,8 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
 		}
 	}
+
+	_mark_hierarchy_dirty(safe_region);
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
@@ -535,6 +566,475 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	return found_route;
 }
 
+bool AStarGrid2D::_solve_bounded(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds, bool p_reverse) {
+	// Same search as _solve() restricted to p_bounds. Without an end point it settles every reachable point
+	// of the bounds, and p_reverse makes the scores the cost of going from each point to p_begin_point instead.
+	pass++;
+
+	LocalVector<Point *> open_list;
+	LocalVector<Point *> nbors;
+	SortArray<Point *, SortPoints> sorter;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = p_end_point ? _estimate_cost(p_begin_point->id, p_end_point->id) : 0;
+	p_begin_point->open_pass = pass;
+	open_list.push_back(p_begin_point);
+
+	while (!open_list.is_empty()) {
+		Point *p = open_list[0];
+
+		if (p == p_end_point) {
+			return true;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+		p->closed_pass = pass;
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+
+		for (Point *e : nbors) {
+			if (e->closed_pass == pass || !p_bounds.has_point(e->id)) {
+				continue;
+			}
+
+			const real_t cost = p_reverse ? _compute_cost(e->id, p->id) * p->weight_scale : _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = p->g_score + cost;
+			bool new_point = false;
+
+			if (e->open_pass != pass) {
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) {
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = e->g_score + (p_end_point ? _estimate_cost(e->id, p_end_point->id) : 0);
+
+			if (new_point) {
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			}
+		}
+	}
+
+	return false;
+}
+
+bool AStarGrid2D::_append_bounded_path(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds, LocalVector<Vector2i> &r_path) {
+	if (!_solve_bounded(p_begin_point, p_end_point, p_bounds)) {
+		return false;
+	}
+
+	// Appends the path without its begin point.
+	const uint32_t path_begin = r_path.size();
+	for (Point *p = p_end_point; p != p_begin_point; p = p->prev_point) {
+		r_path.push_back(p->id);
+	}
+	for (uint32_t i = path_begin, j = r_path.size() - 1; i < j; i++, j--) {
+		SWAP(r_path[i], r_path[j]);
+	}
+
+	return true;
+}
+
+void AStarGrid2D::_clear_hierarchy() {
+	hierarchy_clusters.clear();
+	hierarchy_nodes.clear();
+	hierarchy_cluster_count = Vector2i();
+	hierarchy_nodes_dirty = true;
+}
+
+void AStarGrid2D::_mark_hierarchy_dirty(const Rect2i &p_region) {
+	if (hierarchy_clusters.is_empty() || !p_region.has_area()) {
+		return; // Built from scratch on the next query.
+	}
+
+	const Vector2i from = (p_region.position - region.position) / hierarchy_cluster_size;
+	const Vector2i to = (p_region.get_end() - Vector2i(1, 1) - region.position) / hierarchy_cluster_size;
+	for (int32_t y = from.y; y <= to.y; y++) {
+		for (int32_t x = from.x; x <= to.x; x++) {
+			hierarchy_clusters[y * hierarchy_cluster_count.x + x].dirty = true;
+		}
+	}
+}
+
+void AStarGrid2D::_update_hierarchy_transitions(uint32_t p_cluster_index) {
+	HierarchyCluster &cluster = hierarchy_clusters[p_cluster_index];
+	cluster.right_transitions.clear();
+	cluster.bottom_transitions.clear();
+
+	const Vector2i cluster_end = cluster.rect.get_end();
+	const Vector2i region_end = region.get_end();
+
+	if (cluster_end.x < region_end.x) {
+		const int32_t x = cluster_end.x - 1;
+		int32_t run_begin = -1;
+		for (int32_t y = cluster.rect.position.y; y <= cluster_end.y; y++) {
+			if (y < cluster_end.y && !_get_point_unchecked(x, y)->solid && !_get_point_unchecked(x + 1, y)->solid) {
+				if (run_begin < 0) {
+					run_begin = y;
+				}
+			} else if (run_begin >= 0) {
+				push_hierarchy_transitions(cluster.right_transitions, Vector2i(x, run_begin), Vector2i(x, y - 1));
+				run_begin = -1;
+			}
+		}
+	}
+
+	if (cluster_end.y < region_end.y) {
+		const int32_t y = cluster_end.y - 1;
+		int32_t run_begin = -1;
+		for (int32_t x = cluster.rect.position.x; x <= cluster_end.x; x++) {
+			if (x < cluster_end.x && !_get_point_unchecked(x, y)->solid && !_get_point_unchecked(x, y + 1)->solid) {
+				if (run_begin < 0) {
+					run_begin = x;
+				}
+			} else if (run_begin >= 0) {
+				push_hierarchy_transitions(cluster.bottom_transitions, Vector2i(run_begin, y), Vector2i(x - 1, y));
+				run_begin = -1;
+			}
+		}
+	}
+}
+
+bool AStarGrid2D::_update_hierarchy_entrances(uint32_t p_cluster_index) {
+	HierarchyCluster &cluster = hierarchy_clusters[p_cluster_index];
+
+	LocalVector<Vector2i> entrances;
+	HashMap<Vector2i, uint32_t> entrance_indices;
+
+	const auto add_entrance = [&](const Vector2i &p_id) {
+		if (!entrance_indices.has(p_id)) {
+			entrance_indices.insert(p_id, entrances.size());
+			entrances.push_back(p_id);
+		}
+	};
+
+	for (const Vector2i &id : cluster.right_transitions) {
+		add_entrance(id);
+	}
+	for (const Vector2i &id : cluster.bottom_transitions) {
+		add_entrance(id);
+	}
+	if (p_cluster_index % hierarchy_cluster_count.x > 0) {
+		for (const Vector2i &id : hierarchy_clusters[p_cluster_index - 1].right_transitions) {
+			add_entrance(id + Vector2i(1, 0));
+		}
+	}
+	if (p_cluster_index >= (uint32_t)hierarchy_cluster_count.x) {
+		for (const Vector2i &id : hierarchy_clusters[p_cluster_index - hierarchy_cluster_count.x].bottom_transitions) {
+			add_entrance(id + Vector2i(0, 1));
+		}
+	}
+
+	if (entrances.size() == cluster.entrances.size()) {
+		bool changed = false;
+		for (uint32_t i = 0; i < entrances.size(); i++) {
+			if (entrances[i] != cluster.entrances[i]) {
+				changed = true;
+				break;
+			}
+		}
+		if (!changed) {
+			return false;
+		}
+	}
+
+	cluster.entrances = entrances;
+	cluster.entrance_indices = entrance_indices;
+	return true;
+}
+
+void AStarGrid2D::_update_hierarchy_costs(uint32_t p_cluster_index) {
+	HierarchyCluster &cluster = hierarchy_clusters[p_cluster_index];
+	const uint32_t entrance_count = cluster.entrances.size();
+
+	cluster.costs.resize(entrance_count * entrance_count);
+	cluster.paths.clear();
+
+	for (uint32_t i = 0; i < entrance_count; i++) {
+		_solve_bounded(_get_point_unchecked(cluster.entrances[i]), nullptr, cluster.rect);
+		for (uint32_t j = 0; j < entrance_count; j++) {
+			const Point *to = _get_point_unchecked(cluster.entrances[j]);
+			cluster.costs[i * entrance_count + j] = to->closed_pass == pass ? to->g_score : -1.0;
+		}
+	}
+
+	cluster.dirty = false;
+}
+
+void AStarGrid2D::_update_hierarchy() {
+	if (hierarchy_clusters.is_empty()) {
+		hierarchy_cluster_count = (region.size + Vector2i(hierarchy_cluster_size - 1, hierarchy_cluster_size - 1)) / hierarchy_cluster_size;
+		hierarchy_clusters.resize(hierarchy_cluster_count.x * hierarchy_cluster_count.y);
+		for (int32_t y = 0; y < hierarchy_cluster_count.y; y++) {
+			for (int32_t x = 0; x < hierarchy_cluster_count.x; x++) {
+				HierarchyCluster &cluster = hierarchy_clusters[y * hierarchy_cluster_count.x + x];
+				cluster.rect = Rect2i(region.position + Vector2i(x, y) * hierarchy_cluster_size, Vector2i(hierarchy_cluster_size, hierarchy_cluster_size)).intersection(region);
+			}
+		}
+		hierarchy_nodes_dirty = true;
+	}
+
+	LocalVector<uint32_t> dirty_clusters;
+	for (uint32_t i = 0; i < hierarchy_clusters.size(); i++) {
+		if (hierarchy_clusters[i].dirty) {
+			dirty_clusters.push_back(i);
+		}
+	}
+
+	// The borders of a dirty cluster, including the ones stored by its left and top neighbors.
+	for (uint32_t cluster_index : dirty_clusters) {
+		_update_hierarchy_transitions(cluster_index);
+		if (cluster_index % hierarchy_cluster_count.x > 0) {
+			_update_hierarchy_transitions(cluster_index - 1);
+		}
+		if (cluster_index >= (uint32_t)hierarchy_cluster_count.x) {
+			_update_hierarchy_transitions(cluster_index - hierarchy_cluster_count.x);
+		}
+	}
+
+	// Neighbors only need new costs when their entrances moved.
+	for (uint32_t cluster_index : dirty_clusters) {
+		const int32_t x = cluster_index % hierarchy_cluster_count.x;
+		const int32_t y = cluster_index / hierarchy_cluster_count.x;
+		const Vector2i affected[5] = { Vector2i(x, y), Vector2i(x - 1, y), Vector2i(x + 1, y), Vector2i(x, y - 1), Vector2i(x, y + 1) };
+		for (const Vector2i &cluster_coords : affected) {
+			if (cluster_coords.x < 0 || cluster_coords.y < 0 || cluster_coords.x >= hierarchy_cluster_count.x || cluster_coords.y >= hierarchy_cluster_count.y) {
+				continue;
+			}
+			const uint32_t affected_index = cluster_coords.y * hierarchy_cluster_count.x + cluster_coords.x;
+			const bool entrances_changed = _update_hierarchy_entrances(affected_index);
+			if (entrances_changed) {
+				hierarchy_nodes_dirty = true;
+			}
+			if (entrances_changed || hierarchy_clusters[affected_index].dirty) {
+				_update_hierarchy_costs(affected_index);
+			}
+		}
+	}
+
+	if (hierarchy_nodes_dirty) {
+		hierarchy_nodes.clear();
+		for (uint32_t i = 0; i < hierarchy_clusters.size(); i++) {
+			HierarchyCluster &cluster = hierarchy_clusters[i];
+			cluster.node_offset = hierarchy_nodes.size();
+			for (const Vector2i &id : cluster.entrances) {
+				HierarchyNode node;
+				node.id = id;
+				node.cluster = i;
+				hierarchy_nodes.push_back(node);
+			}
+		}
+		// The begin and end points of a query.
+		hierarchy_nodes.push_back(HierarchyNode());
+		hierarchy_nodes.push_back(HierarchyNode());
+		hierarchy_nodes_dirty = false;
+	}
+}
+
+bool AStarGrid2D::_use_hierarchy(const Point *p_begin_point, const Point *p_end_point) const {
+	// Points in the same cluster are close enough for a regular search.
+	return hierarchy_cluster_size > 0 && _get_hierarchy_cluster_index(p_begin_point->id) != _get_hierarchy_cluster_index(p_end_point->id);
+}
+
+bool AStarGrid2D::_solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Vector2i> &r_path) {
+	if (p_end_point->solid) {
+		return false;
+	}
+
+	_update_hierarchy();
+
+	const uint32_t begin_cluster_index = _get_hierarchy_cluster_index(p_begin_point->id);
+	const uint32_t end_cluster_index = _get_hierarchy_cluster_index(p_end_point->id);
+	const HierarchyCluster &begin_cluster = hierarchy_clusters[begin_cluster_index];
+	const HierarchyCluster &end_cluster = hierarchy_clusters[end_cluster_index];
+
+	// Connect the begin point to the entrances of its cluster, and the entrances of the end cluster to the end point.
+	LocalVector<real_t> begin_costs;
+	begin_costs.resize(begin_cluster.entrances.size());
+	_solve_bounded(p_begin_point, nullptr, begin_cluster.rect);
+	for (uint32_t i = 0; i < begin_cluster.entrances.size(); i++) {
+		const Point *entrance = _get_point_unchecked(begin_cluster.entrances[i]);
+		begin_costs[i] = entrance->closed_pass == pass ? entrance->g_score : -1.0;
+	}
+
+	LocalVector<real_t> end_costs;
+	end_costs.resize(end_cluster.entrances.size());
+	_solve_bounded(p_end_point, nullptr, end_cluster.rect, true);
+	for (uint32_t i = 0; i < end_cluster.entrances.size(); i++) {
+		const Point *entrance = _get_point_unchecked(end_cluster.entrances[i]);
+		end_costs[i] = entrance->closed_pass == pass ? entrance->g_score : -1.0;
+	}
+
+	const uint32_t begin_node_index = hierarchy_nodes.size() - 2;
+	const uint32_t end_node_index = hierarchy_nodes.size() - 1;
+	hierarchy_nodes[begin_node_index].id = p_begin_point->id;
+	hierarchy_nodes[begin_node_index].cluster = begin_cluster_index;
+	hierarchy_nodes[end_node_index].id = p_end_point->id;
+	hierarchy_nodes[end_node_index].cluster = end_cluster_index;
+
+	hierarchy_pass++;
+
+	LocalVector<uint32_t> open_list;
+	LocalVector<Pair<uint32_t, real_t>> nbors;
+	SortArray<uint32_t, SortHierarchyNodes> sorter;
+	sorter.compare.nodes = hierarchy_nodes.ptr();
+
+	HierarchyNode &begin_node = hierarchy_nodes[begin_node_index];
+	begin_node.g_score = 0;
+	begin_node.f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	begin_node.open_pass = hierarchy_pass;
+	open_list.push_back(begin_node_index);
+
+	static const Vector2i directions[4] = { Vector2i(1, 0), Vector2i(-1, 0), Vector2i(0, 1), Vector2i(0, -1) };
+
+	bool found_route = false;
+
+	while (!open_list.is_empty()) {
+		const uint32_t node_index = open_list[0]; // The currently processed node.
+
+		if (node_index == end_node_index) {
+			found_route = true;
+			break;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current node from the open list.
+		open_list.remove_at(open_list.size() - 1);
+
+		HierarchyNode &node = hierarchy_nodes[node_index];
+		node.closed_pass = hierarchy_pass; // Mark the node as closed.
+
+		nbors.clear();
+		if (node_index == begin_node_index) {
+			for (uint32_t i = 0; i < begin_costs.size(); i++) {
+				if (begin_costs[i] >= 0) {
+					nbors.push_back(Pair<uint32_t, real_t>(begin_cluster.node_offset + i, begin_costs[i]));
+				}
+			}
+		} else {
+			const HierarchyCluster &cluster = hierarchy_clusters[node.cluster];
+			const uint32_t entrance_count = cluster.entrances.size();
+			const uint32_t entrance_index = node_index - cluster.node_offset;
+
+			// Entrances of the same cluster.
+			for (uint32_t i = 0; i < entrance_count; i++) {
+				const real_t cost = cluster.costs[entrance_index * entrance_count + i];
+				if (i != entrance_index && cost >= 0) {
+					nbors.push_back(Pair<uint32_t, real_t>(cluster.node_offset + i, cost));
+				}
+			}
+
+			if (node.cluster == end_cluster_index && end_costs[entrance_index] >= 0) {
+				nbors.push_back(Pair<uint32_t, real_t>(end_node_index, end_costs[entrance_index]));
+			}
+
+			// Entrances across the cluster borders.
+			for (const Vector2i &direction : directions) {
+				const Vector2i id = node.id + direction;
+				if (!region.has_point(id)) {
+					continue;
+				}
+				const uint32_t neighbor_cluster_index = _get_hierarchy_cluster_index(id);
+				if (neighbor_cluster_index == node.cluster) {
+					continue;
+				}
+				const HierarchyCluster &neighbor_cluster = hierarchy_clusters[neighbor_cluster_index];
+				const uint32_t *neighbor_entrance_index = neighbor_cluster.entrance_indices.getptr(id);
+				if (neighbor_entrance_index) {
+					const Point *to = _get_point_unchecked(id);
+					nbors.push_back(Pair<uint32_t, real_t>(neighbor_cluster.node_offset + *neighbor_entrance_index, _compute_cost(node.id, id) * to->weight_scale));
+				}
+			}
+		}
+
+		for (const Pair<uint32_t, real_t> &nbor : nbors) {
+			HierarchyNode &e = hierarchy_nodes[nbor.first];
+			if (e.closed_pass == hierarchy_pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = node.g_score + nbor.second;
+			bool new_node = false;
+
+			if (e.open_pass != hierarchy_pass) { // The node wasn't inside the open list.
+				e.open_pass = hierarchy_pass;
+				open_list.push_back(nbor.first);
+				new_node = true;
+			} else if (tentative_g_score >= e.g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e.prev_node = node_index;
+			e.g_score = tentative_g_score;
+			e.f_score = e.g_score + (nbor.first == end_node_index ? 0 : _estimate_cost(e.id, p_end_point->id));
+
+			if (new_node) { // The position of the new nodes is already known.
+				sorter.push_heap(0, open_list.size() - 1, 0, nbor.first, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(nbor.first), 0, nbor.first, open_list.ptr());
+			}
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	LocalVector<uint32_t> node_path;
+	for (uint32_t node_index = end_node_index; node_index != begin_node_index; node_index = hierarchy_nodes[node_index].prev_node) {
+		node_path.push_back(node_index);
+	}
+	node_path.push_back(begin_node_index);
+
+	// Refine the abstract path into grid points, one cluster at a time.
+	r_path.clear();
+	r_path.push_back(p_begin_point->id);
+	for (uint32_t i = node_path.size() - 1; i > 0; i--) {
+		const uint32_t from_index = node_path[i];
+		const uint32_t to_index = node_path[i - 1];
+		const HierarchyNode &from = hierarchy_nodes[from_index];
+		const HierarchyNode &to = hierarchy_nodes[to_index];
+
+		if (from.id == to.id) {
+			continue; // The begin or end point is an entrance itself.
+		}
+		if (from.cluster != to.cluster) {
+			r_path.push_back(to.id); // Crossing a border.
+			continue;
+		}
+
+		HierarchyCluster &cluster = hierarchy_clusters[from.cluster];
+		if (from_index == begin_node_index || to_index == end_node_index) {
+			if (!_append_bounded_path(_get_point_unchecked(from.id), _get_point_unchecked(to.id), cluster.rect, r_path)) {
+				return false;
+			}
+			continue;
+		}
+
+		const uint32_t path_key = (from_index - cluster.node_offset) * cluster.entrances.size() + (to_index - cluster.node_offset);
+		LocalVector<Vector2i> *cached_path = cluster.paths.getptr(path_key);
+		if (!cached_path) {
+			LocalVector<Vector2i> path;
+			if (!_append_bounded_path(_get_point_unchecked(from.id), _get_point_unchecked(to.id), cluster.rect, path)) {
+				return false;
+			}
+			cached_path = &cluster.paths.insert(path_key, path)->value;
+		}
+		for (const Vector2i &id : *cached_path) {
+			r_path.push_back(id);
+		}
+	}
+
+	return true;
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_to_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_to_id, scost)) {
@@ -554,6 +1054,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 void AStarGrid2D::clear() {
 	points.clear();
 	region = Rect2i();
+	_clear_hierarchy();
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
@@ -576,6 +1077,23 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 		return ret;
 	}
 
+	if (_use_hierarchy(a, b)) {
+		LocalVector<Vector2i> id_path;
+		if (_solve_hierarchical(a, b, id_path)) {
+			Vector<Vector2> path;
+			path.resize(id_path.size());
+			Vector2 *w = path.ptrw();
+			for (uint32_t i = 0; i < id_path.size(); i++) {
+				w[i] = _get_point_unchecked(id_path[i])->pos;
+			}
+			return path;
+		}
+		if (!p_allow_partial_path) {
+			return Vector<Vector2>();
+		}
+		// Only the full search knows the closest point of a partial path.
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -629,6 +1147,22 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 		return ret;
 	}
 
+	if (_use_hierarchy(a, b)) {
+		LocalVector<Vector2i> id_path;
+		if (_solve_hierarchical(a, b, id_path)) {
+			TypedArray<Vector2i> path;
+			path.resize(id_path.size());
+			for (uint32_t i = 0; i < id_path.size(); i++) {
+				path[i] = id_path[i];
+			}
+			return path;
+		}
+		if (!p_allow_partial_path) {
+			return TypedArray<Vector2i>();
+		}
+		// Only the full search knows the closest point of a partial path.
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -689,6 +1223,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_default_compute_heuristic"), &AStarGrid2D::get_default_compute_heuristic);
 	ClassDB::bind_method(D_METHOD("set_default_estimate_heuristic", "heuristic"), &AStarGrid2D::set_default_estimate_heuristic);
 	ClassDB::bind_method(D_METHOD("get_default_estimate_heuristic"), &AStarGrid2D::get_default_estimate_heuristic);
+	ClassDB::bind_method(D_METHOD("set_hierarchy_cluster_size", "cluster_size"), &AStarGrid2D::set_hierarchy_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_hierarchy_cluster_size"), &AStarGrid2D::get_hierarchy_cluster_size);
 	ClassDB::bind_method(D_METHOD("set_point_solid", "id", "solid"), &AStarGrid2D::set_point_solid, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("is_point_solid", "id"), &AStarGrid2D::is_point_solid);
 	ClassDB::bind_method(D_METHOD("set_point_weight_scale", "id", "weight_scale"), &AStarGrid2D::set_point_weight_scale);
@@ -714,6 +1250,7 @@ void AStarGrid2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_compute_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_compute_heuristic", "get_default_compute_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_estimate_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_estimate_heuristic", "get_default_estimate_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "diagonal_mode", PROPERTY_HINT_ENUM, "Never,Always,At Least One Walkable,Only If No Obstacles"), "set_diagonal_mode", "get_diagonal_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "hierarchy_cluster_size", PROPERTY_HINT_RANGE, "0,256,1,or_greater"), "set_hierarchy_cluster_size", "get_hierarchy_cluster_size");
 
 	BIND_ENUM_CONSTANT(HEURISTIC_EUCLIDEAN);
 	BIND_ENUM_CONSTANT(HEURISTIC_MANHATTAN);
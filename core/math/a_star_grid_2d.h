@@ -33,6 +33,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/list.h"
 #include "core/templates/local_vector.h"
 
@@ -117,6 +118,59 @@ private:
 
 	uint64_t pass = 1;
 
+	// Hierarchical pathfinding (HPA*): the grid is split in clusters connected through entrance points
+	// on their borders, long paths are searched on the graph of entrances and refined cluster by cluster.
+	struct HierarchyCluster {
+		Rect2i rect;
+
+		// Cells of this cluster that have a walkable neighbor in the next cluster to the right or below.
+		LocalVector<Vector2i> right_transitions;
+		LocalVector<Vector2i> bottom_transitions;
+
+		LocalVector<Vector2i> entrances;
+		HashMap<Vector2i, uint32_t> entrance_indices;
+		// Costs between the entrances inside the cluster, row-major from -> to, negative when unreachable.
+		LocalVector<real_t> costs;
+		// Refined paths between entrances, cached on first use.
+		HashMap<uint32_t, LocalVector<Vector2i>> paths;
+
+		uint32_t node_offset = 0;
+		bool dirty = true;
+	};
+
+	struct HierarchyNode {
+		Vector2i id;
+		uint32_t cluster = 0;
+
+		// Used for pathfinding.
+		uint32_t prev_node = 0;
+		real_t g_score = 0;
+		real_t f_score = 0;
+		uint64_t open_pass = 0;
+		uint64_t closed_pass = 0;
+	};
+
+	struct SortHierarchyNodes {
+		const HierarchyNode *nodes = nullptr;
+
+		_FORCE_INLINE_ bool operator()(uint32_t A, uint32_t B) const { // Returns true when the node A is worse than node B.
+			if (nodes[A].f_score > nodes[B].f_score) {
+				return true;
+			} else if (nodes[A].f_score < nodes[B].f_score) {
+				return false;
+			} else {
+				return nodes[A].g_score < nodes[B].g_score;
+			}
+		}
+	};
+
+	int32_t hierarchy_cluster_size = 0;
+	Vector2i hierarchy_cluster_count;
+	LocalVector<HierarchyCluster> hierarchy_clusters;
+	LocalVector<HierarchyNode> hierarchy_nodes;
+	bool hierarchy_nodes_dirty = true;
+	uint64_t hierarchy_pass = 1;
+
 private: // Internal routines.
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
 		if (region.has_point(Vector2i(p_x, p_y))) {
@@ -147,6 +201,21 @@ private: // Internal routines.
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
 	Point *_jump(Point *p_from, Point *p_to);
 	bool _solve(Point *p_begin_point, Point *p_end_point);
+	bool _solve_bounded(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds, bool p_reverse = false);
+	bool _append_bounded_path(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds, LocalVector<Vector2i> &r_path);
+
+	_FORCE_INLINE_ uint32_t _get_hierarchy_cluster_index(const Vector2i &p_id) const {
+		return ((p_id.y - region.position.y) / hierarchy_cluster_size) * hierarchy_cluster_count.x + (p_id.x - region.position.x) / hierarchy_cluster_size;
+	}
+
+	void _clear_hierarchy();
+	void _mark_hierarchy_dirty(const Rect2i &p_region);
+	void _update_hierarchy_transitions(uint32_t p_cluster_index);
+	bool _update_hierarchy_entrances(uint32_t p_cluster_index);
+	void _update_hierarchy_costs(uint32_t p_cluster_index);
+	void _update_hierarchy();
+	bool _use_hierarchy(const Point *p_begin_point, const Point *p_end_point) const;
+	bool _solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Vector2i> &r_path);
 
 protected:
 	static void _bind_methods();
@@ -197,6 +266,9 @@ public:
 	void set_default_estimate_heuristic(Heuristic p_heuristic);
 	Heuristic get_default_estimate_heuristic() const;
 
+	void set_hierarchy_cluster_size(int32_t p_cluster_size);
+	int32_t get_hierarchy_cluster_size() const;
+
 	void set_point_solid(const Vector2i &p_id, bool p_solid = true);
 	bool is_point_solid(const Vector2i &p_id) const;
 
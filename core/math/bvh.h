@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -71,6 +72,12 @@ public:
 		_thread_safe = p_enable;
 	}
 
+	// when many items moved, find their new pairing candidates on the WorkerThreadPool.
+	// the pair callbacks are still sent from the calling thread, in the same order.
+	void params_set_parallel_pairing(bool p_enable) {
+		_parallel_pairing = p_enable;
+	}
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -435,6 +442,11 @@ private:
 			return;
 		}
 
+		if (_parallel_pairing && changed_items.size() >= PARALLEL_PAIRING_MIN_ITEMS) {
+			_check_for_collisions_parallel(p_full_check);
+			return;
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -480,6 +492,60 @@ private:
 		_reset();
 	}
 
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &_changed_item_hits[p_index];
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb(params, false);
+	}
+
+	void _check_for_collisions_parallel(bool p_full_check) {
+		// leaving pairs modify the pair lists, so send them first, from this thread.
+		for (const BVHHandle &h : changed_items) {
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+			_find_leavers(h, abb, p_full_check);
+		}
+
+		// culling only reads the tree, each item gets its own hit buffer.
+		uint32_t changed_item_count = changed_items.size();
+		if (_changed_item_hits.size() < changed_item_count) {
+			_changed_item_hits.resize(changed_item_count);
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, nullptr, changed_item_count, -1, true, SNAME("BVHPairing"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint32_t n = 0; n < changed_item_count; n++) {
+			const BVHHandle &h = changed_items[n];
+			uint32_t changed_item_ref_id = h.id();
+
+			for (const uint32_t ref_id : _changed_item_hits[n]) {
+				// don't collide against ourself
+				if (ref_id == changed_item_ref_id) {
+					continue;
+				}
+
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+
+				// find NEW enterers, and send callbacks for them only
+				_collide(h, h_collidee);
+			}
+		}
+		_reset();
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +839,11 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// below this, dispatching to threads costs more than it saves.
+	static const uint32_t PARALLEL_PAIRING_MIN_ITEMS = 256;
+	bool _parallel_pairing = false;
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> _changed_item_hits;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
@@ -371,6 +371,13 @@ bool DynamicBVH::update(const ID &p_id, const AABB &p_box) {
 		return false;
 	}
 
+	if (leaf->parent && leaf->parent->volume.contains(volume)) {
+		// Still inside the parent, so the tree stays valid without re-inserting the leaf.
+		// The parent is refit the next time one of its children is removed or re-inserted.
+		leaf->volume = volume;
+		return true;
+	}
+
 	Node *base = _remove_leaf(leaf);
 	if (base) {
 		if (lkhd >= 0) {
@@ -423,6 +430,14 @@ void DynamicBVH::get_elements(List<ID> *r_elements) {
 int DynamicBVH::get_leaf_count() const {
 	return total_leaves;
 }
+
+AABB DynamicBVH::get_bounds() const {
+	if (!bvh_root) {
+		return AABB();
+	}
+	return AABB(bvh_root->volume.min, bvh_root->volume.get_length());
+}
+
 int DynamicBVH::get_max_depth() const {
 	if (bvh_root) {
 		int depth = 1;
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1239,232 +1240,433 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
-	switch (p_node->type) {
-		case Expression::ENode::TYPE_INPUT: {
-			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
-				return true;
-			}
-			r_ret = p_inputs[in->index];
-		} break;
-		case Expression::ENode::TYPE_CONSTANT: {
-			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
+static bool _is_operator_fallible(Variant::Operator p_op) {
+	switch (p_op) {
+		// These report invalid operands for some values (e.g. division by zero),
+		// which the validated evaluators don't.
+		case Variant::OP_DIVIDE:
+		case Variant::OP_MODULE:
+		case Variant::OP_SHIFT_LEFT:
+		case Variant::OP_SHIFT_RIGHT:
+		case Variant::OP_IN:
+			return true;
+		default:
+			return false;
+	}
+}
 
-		} break;
-		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
-			}
-			r_ret = p_instance;
-		} break;
-		case Expression::ENode::TYPE_OPERATOR: {
-			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
+static bool _is_value_foldable(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		// Stored by reference, the result of every execution would share it.
+		case Variant::OBJECT:
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+		case Variant::PACKED_BYTE_ARRAY:
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_COLOR_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return false;
+		default:
+			return true;
+	}
+}
 
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
+int Expression::_add_constant(const Variant &p_value) {
+	constants.push_back(p_value);
+	return (ADDR_MODE_CONSTANT << ADDR_BITS) | (constants.size() - 1);
+}
 
-			Variant b;
+int Expression::_compile_node(const ENode *p_node, int p_register) {
+	// Inputs and constants are read in place, everything else writes to `p_register`
+	// and evaluates its operands in the registers after it.
+	switch (p_node->type) {
+		case ENode::TYPE_INPUT: {
+			const InputNode *in = static_cast<const InputNode *>(p_node);
+			return (ADDR_MODE_INPUT << ADDR_BITS) | MIN(in->index, ADDR_MASK);
+		}
+		case ENode::TYPE_CONSTANT: {
+			return _add_constant(static_cast<const ConstantNode *>(p_node)->value);
+		}
+		default:
+			break;
+	}
 
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-			}
+	if (p_register >= (int)registers.size()) {
+		registers.resize(p_register + 1);
+	}
+	const int dst = (ADDR_MODE_REGISTER << ADDR_BITS) | p_register;
+	int next_register = p_register + 1;
 
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
-			}
+#define COMPILE_OPERAND(m_var, m_node)                         \
+	const int m_var = _compile_node(m_node, next_register);    \
+	if ((m_var >> ADDR_BITS) == ADDR_MODE_REGISTER) {          \
+		next_register++;                                       \
+	}
 
+	switch (p_node->type) {
+		case ENode::TYPE_SELF: {
+			program.push_back(OPCODE_SELF);
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_INDEX: {
-			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
+		case ENode::TYPE_OPERATOR: {
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
+			const uint32_t constant_count = constants.size();
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+			COMPILE_OPERAND(left, op->nodes[0]);
+			int right = -1;
+			if (op->nodes[1]) {
+				COMPILE_OPERAND(operand, op->nodes[1]);
+				right = operand;
 			}
 
-			Variant idx;
-
-			ret = _execute(p_inputs, p_instance, index->index, idx, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+			if ((left >> ADDR_BITS) == ADDR_MODE_CONSTANT && (right == -1 || (right >> ADDR_BITS) == ADDR_MODE_CONSTANT)) {
+				// Both operands are constants, so the result can be computed once here.
+				bool valid = true;
+				Variant value;
+				Variant::evaluate(op->op, constants[left & ADDR_MASK], right == -1 ? Variant() : constants[right & ADDR_MASK], value, valid);
+				if (valid && _is_value_foldable(value)) {
+					constants.resize(constant_count);
+					return _add_constant(value);
+				}
 			}
 
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
-			}
+			OperatorCache cache;
+			cache.op = op->op;
+			operator_caches.push_back(cache);
 
+			program.push_back(OPCODE_OPERATOR);
+			program.push_back(operator_caches.size() - 1);
+			program.push_back(left);
+			program.push_back(right);
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_NAMED_INDEX: {
-			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
+		case ENode::TYPE_INDEX: {
+			const IndexNode *index = static_cast<const IndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			bool valid;
-			r_ret = base.get_named(index->name, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
-			}
+			COMPILE_OPERAND(base, index->base);
+			COMPILE_OPERAND(idx, index->index);
 
+			program.push_back(OPCODE_INDEX);
+			program.push_back(base);
+			program.push_back(idx);
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
+		case ENode::TYPE_NAMED_INDEX: {
+			const NamedIndexNode *index = static_cast<const NamedIndexNode *>(p_node);
 
-			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, p_const_calls_only, r_error_str);
+			COMPILE_OPERAND(base, index->base);
+			names.push_back(index->name);
 
-				if (ret) {
-					return true;
-				}
-				arr[i] = value;
+			program.push_back(OPCODE_NAMED_INDEX);
+			program.push_back(base);
+			program.push_back(names.size() - 1);
+			program.push_back(dst);
+		} break;
+		case ENode::TYPE_ARRAY:
+		case ENode::TYPE_DICTIONARY: {
+			const Vector<ENode *> &elements = p_node->type == ENode::TYPE_ARRAY ? static_cast<const ArrayNode *>(p_node)->array : static_cast<const DictionaryNode *>(p_node)->dict;
+
+			LocalVector<int> operands;
+			for (int i = 0; i < elements.size(); i++) {
+				COMPILE_OPERAND(element, elements[i]);
+				operands.push_back(element);
 			}
 
-			r_ret = arr;
-
+			program.push_back(p_node->type == ENode::TYPE_ARRAY ? OPCODE_ARRAY : OPCODE_DICTIONARY);
+			program.push_back(operands.size());
+			for (int operand : operands) {
+				program.push_back(operand);
+			}
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
+		case ENode::TYPE_CONSTRUCTOR: {
+			const ConstructorNode *constructor = static_cast<const ConstructorNode *>(p_node);
+			const uint32_t constant_count = constants.size();
 
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, p_const_calls_only, r_error_str);
+			LocalVector<int> operands;
+			bool all_constant = true;
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				COMPILE_OPERAND(argument, constructor->arguments[i]);
+				operands.push_back(argument);
+				all_constant = all_constant && (argument >> ADDR_BITS) == ADDR_MODE_CONSTANT;
+			}
 
-				if (ret) {
-					return true;
+			if (all_constant) {
+				const Variant **argp = (const Variant **)alloca(sizeof(Variant *) * MAX(1u, operands.size()));
+				for (uint32_t i = 0; i < operands.size(); i++) {
+					argp[i] = &constants[operands[i] & ADDR_MASK];
 				}
 
+				Callable::CallError ce;
 				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
+				Variant::construct(constructor->data_type, value, argp, operands.size(), ce);
+				if (ce.error == Callable::CallError::CALL_OK && _is_value_foldable(value)) {
+					constants.resize(constant_count);
+					return _add_constant(value);
 				}
-
-				d[key] = value;
 			}
 
-			r_ret = d;
+			program.push_back(OPCODE_CONSTRUCT);
+			program.push_back(constructor->data_type);
+			program.push_back(operands.size());
+			for (int operand : operands) {
+				program.push_back(operand);
+			}
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
+		case ENode::TYPE_BUILTIN_FUNC: {
+			const BuiltinFuncNode *bifunc = static_cast<const BuiltinFuncNode *>(p_node);
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
-
-			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
+			LocalVector<int> operands;
+			for (int i = 0; i < bifunc->arguments.size(); i++) {
+				COMPILE_OPERAND(argument, bifunc->arguments[i]);
+				operands.push_back(argument);
 			}
+			names.push_back(bifunc->func);
 
-			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
+			program.push_back(OPCODE_CALL_BUILTIN);
+			program.push_back(names.size() - 1);
+			program.push_back(operands.size());
+			for (int operand : operands) {
+				program.push_back(operand);
 			}
+			program.push_back(dst);
+		} break;
+		case ENode::TYPE_CALL: {
+			const CallNode *call = static_cast<const CallNode *>(p_node);
 
+			COMPILE_OPERAND(base, call->base);
+			LocalVector<int> operands;
+			for (int i = 0; i < call->arguments.size(); i++) {
+				COMPILE_OPERAND(argument, call->arguments[i]);
+				operands.push_back(argument);
+			}
+			names.push_back(call->method);
+
+			program.push_back(OPCODE_CALL);
+			program.push_back(base);
+			program.push_back(names.size() - 1);
+			program.push_back(operands.size());
+			for (int operand : operands) {
+				program.push_back(operand);
+			}
+			program.push_back(dst);
 		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
+		case ENode::TYPE_INPUT:
+		case ENode::TYPE_CONSTANT:
+			break; // Handled above.
+	}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
+#undef COMPILE_OPERAND
 
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+	return dst;
+}
+
+void Expression::_compile_program() {
+	program.clear();
+	constants.clear();
+	names.clear();
+	operator_caches.clear();
+	registers.clear();
+
+	const int result = root ? _compile_node(root, 0) : _add_constant(Variant());
+	program.push_back(OPCODE_END);
+	program.push_back(result);
+}
 
-			r_ret = Variant(); //may not return anything
-			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
-				return true;
+const Variant *Expression::_get_operand(int p_address, const Array &p_inputs, String &r_error_str) const {
+	const int index = p_address & ADDR_MASK;
+	switch (p_address >> ADDR_BITS) {
+		case ADDR_MODE_REGISTER:
+			return &registers[index];
+		case ADDR_MODE_CONSTANT:
+			return &constants[index];
+		default:
+			if (index >= p_inputs.size()) {
+				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), index);
+				return nullptr;
 			}
+			return &p_inputs[index];
+	}
+}
 
-		} break;
-		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+bool Expression::_execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+#define GET_OPERAND(m_var, m_address)                                         \
+	const Variant *m_var = _get_operand(m_address, p_inputs, r_error_str);    \
+	if (unlikely(!m_var)) {                                                   \
+		return true;                                                          \
+	}
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
+#define GET_ARGUMENTS(m_count, m_offset)                                           \
+	const Variant **argp = (const Variant **)alloca(sizeof(Variant *) * MAX(1, m_count)); \
+	for (int i = 0; i < m_count; i++) {                                            \
+		GET_OPERAND(argument, program[(m_offset) + i]);                            \
+		argp[i] = argument;                                                        \
+	}
 
-			if (ret) {
-				return true;
-			}
+	const Variant nil;
+	const int *code = program.ptr();
+	int ip = 0;
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+	while (true) {
+		switch (code[ip]) {
+			case OPCODE_SELF: {
+				if (!p_instance) {
+					r_error_str = RTR("self can't be used because instance is null (not passed)");
+					return true;
+				}
+				registers[code[ip + 1]] = p_instance;
+				ip += 2;
+			} break;
+			case OPCODE_OPERATOR: {
+				OperatorCache &cache = operator_caches[code[ip + 1]];
+
+				GET_OPERAND(a, code[ip + 2]);
+				const Variant *b = &nil;
+				if (code[ip + 3] != -1) {
+					GET_OPERAND(right, code[ip + 3]);
+					b = right;
+				}
+				Variant *dst = &registers[code[ip + 4]];
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, p_const_calls_only, r_error_str);
+				if (a->get_type() != cache.left_type || b->get_type() != cache.right_type) {
+					cache.left_type = a->get_type();
+					cache.right_type = b->get_type();
+					cache.return_type = Variant::get_operator_return_type(cache.op, cache.left_type, cache.right_type);
+					cache.evaluator = _is_operator_fallible(cache.op) ? nullptr : Variant::get_validated_operator_evaluator(cache.op, cache.left_type, cache.right_type);
+				}
 
-				if (ret) {
+				if (likely(cache.evaluator)) {
+					if (dst->get_type() != cache.return_type) {
+						VariantInternal::initialize(dst, cache.return_type);
+					}
+					cache.evaluator(a, b, dst);
+				} else {
+					bool valid = true;
+					Variant::evaluate(cache.op, *a, *b, *dst, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(cache.op), Variant::get_type_name(a->get_type()), Variant::get_type_name(b->get_type()));
+						return true;
+					}
+				}
+				ip += 5;
+			} break;
+			case OPCODE_INDEX: {
+				GET_OPERAND(base, code[ip + 1]);
+				GET_OPERAND(idx, code[ip + 2]);
+
+				bool valid;
+				registers[code[ip + 3]] = base->get(*idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx->get_type()), Variant::get_type_name(base->get_type()));
 					return true;
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+				ip += 4;
+			} break;
+			case OPCODE_NAMED_INDEX: {
+				GET_OPERAND(base, code[ip + 1]);
+				const StringName &name = names[code[ip + 2]];
+
+				bool valid;
+				registers[code[ip + 3]] = base->get_named(name, valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(name), Variant::get_type_name(base->get_type()));
+					return true;
+				}
+				ip += 4;
+			} break;
+			case OPCODE_ARRAY: {
+				const int count = code[ip + 1];
+
+				Array arr;
+				arr.resize(count);
+				for (int i = 0; i < count; i++) {
+					GET_OPERAND(value, code[ip + 2 + i]);
+					arr[i] = *value;
+				}
 
-			Callable::CallError ce;
-			if (p_const_calls_only) {
-				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			} else {
-				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			}
+				registers[code[ip + 2 + count]] = arr;
+				ip += 3 + count;
+			} break;
+			case OPCODE_DICTIONARY: {
+				const int count = code[ip + 1];
+
+				Dictionary d;
+				for (int i = 0; i < count; i += 2) {
+					GET_OPERAND(key, code[ip + 2 + i]);
+					GET_OPERAND(value, code[ip + 3 + i]);
+					d[*key] = *value;
+				}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+				registers[code[ip + 2 + count]] = d;
+				ip += 3 + count;
+			} break;
+			case OPCODE_CONSTRUCT: {
+				const Variant::Type type = Variant::Type(code[ip + 1]);
+				const int count = code[ip + 2];
+				GET_ARGUMENTS(count, ip + 3);
+
+				Callable::CallError ce;
+				Variant::construct(type, registers[code[ip + 3 + count]], argp, count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(type));
+					return true;
+				}
+				ip += 4 + count;
+			} break;
+			case OPCODE_CALL_BUILTIN: {
+				const StringName &func = names[code[ip + 1]];
+				const int count = code[ip + 2];
+				GET_ARGUMENTS(count, ip + 3);
+
+				Variant &ret = registers[code[ip + 3 + count]];
+				ret = Variant(); // May not return anything.
+				Callable::CallError ce;
+				Variant::call_utility_function(func, &ret, argp, count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = "Builtin call failed: " + Variant::get_call_error_text(func, argp, count, ce);
+					return true;
+				}
+				ip += 4 + count;
+			} break;
+			case OPCODE_CALL: {
+				GET_OPERAND(base_ptr, code[ip + 1]);
+				const StringName &method = names[code[ip + 2]];
+				const int count = code[ip + 3];
+				GET_ARGUMENTS(count, ip + 4);
+
+				// Calls may modify the base, which must not change constants or inputs.
+				Variant base = *base_ptr;
+				Variant &ret = registers[code[ip + 4 + count]];
+				Callable::CallError ce;
+				if (p_const_calls_only) {
+					base.call_const(method, argp, count, ret, ce);
+				} else {
+					base.callp(method, argp, count, ret, ce);
+				}
 
-		} break;
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(method));
+					return true;
+				}
+				ip += 5 + count;
+			} break;
+			case OPCODE_END: {
+				GET_OPERAND(result, code[ip + 1]);
+				r_ret = *result;
+				return false;
+			}
+		}
 	}
-	return false;
+
+#undef GET_ARGUMENTS
+#undef GET_OPERAND
 }
 
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
@@ -1488,9 +1690,12 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 			memdelete(nodes);
 		}
 		nodes = nullptr;
+		_compile_program();
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile_program();
+
 	return OK;
 }
 
@@ -1500,7 +1705,13 @@ Variant Expression::execute(const Array &p_inputs, Object *p_base, bool p_show_e
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	bool err = _execute(p_inputs, p_base, output, p_const_calls_only, error_txt);
+
+	// Don't keep references alive through the registers between executions.
+	for (Variant &reg : registers) {
+		reg = Variant();
+	}
+
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
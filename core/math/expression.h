@@ -32,6 +32,7 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -256,8 +257,53 @@ private:
 
 	Vector<String> input_names;
 
+	// The parsed tree is compiled to a flat program working on a register file,
+	// so executing it doesn't have to walk the nodes recursively.
+	enum Opcode {
+		OPCODE_SELF,
+		OPCODE_OPERATOR,
+		OPCODE_INDEX,
+		OPCODE_NAMED_INDEX,
+		OPCODE_ARRAY,
+		OPCODE_DICTIONARY,
+		OPCODE_CONSTRUCT,
+		OPCODE_CALL_BUILTIN,
+		OPCODE_CALL,
+		OPCODE_END,
+	};
+
+	enum AddressMode {
+		ADDR_MODE_REGISTER,
+		ADDR_MODE_CONSTANT,
+		ADDR_MODE_INPUT,
+	};
+
+	static constexpr int ADDR_BITS = 24;
+	static constexpr int ADDR_MASK = (1 << ADDR_BITS) - 1;
+
+	// Remembers the validated evaluator for the operand types seen last,
+	// which stay the same between executions in the common case.
+	struct OperatorCache {
+		Variant::Operator op = Variant::OP_ADD;
+		Variant::Type left_type = Variant::VARIANT_MAX;
+		Variant::Type right_type = Variant::VARIANT_MAX;
+		Variant::Type return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator evaluator = nullptr;
+	};
+
+	LocalVector<int> program;
+	LocalVector<Variant> constants;
+	LocalVector<StringName> names;
+	LocalVector<OperatorCache> operator_caches;
+	LocalVector<Variant> registers;
+
+	int _add_constant(const Variant &p_value);
+	int _compile_node(const ENode *p_node, int p_register);
+	void _compile_program();
+	_FORCE_INLINE_ const Variant *_get_operand(int p_address, const Array &p_inputs, String &r_error_str) const;
+
 	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+	bool _execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -31,6 +31,7 @@
 #include "transform_interpolator.h"
 
 #include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
 
 void TransformInterpolator::interpolate_transform_2d(const Transform2D &p_prev, const Transform2D &p_curr, Transform2D &r_result, real_t p_fraction) {
 	// Special case for physics interpolation, if flipping, don't interpolate basis.
@@ -44,3 +45,14 @@ void TransformInterpolator::interpolate_transform_2d(const Transform2D &p_prev,
 
 	r_result = p_prev.interpolate_with(p_curr, p_fraction);
 }
+
+void TransformInterpolator::interpolate_transform_3d(const Transform3D &p_prev, const Transform3D &p_curr, Transform3D &r_result, real_t p_fraction) {
+	// As in 2D, a basis that flips handedness can't be interpolated, only the origin is.
+	if (_sign(p_prev.basis.determinant()) != _sign(p_curr.basis.determinant())) {
+		r_result.basis = p_curr.basis;
+		r_result.origin = p_prev.origin.lerp(p_curr.origin, p_fraction);
+		return;
+	}
+
+	r_result = p_prev.interpolate_with(p_curr, p_fraction);
+}
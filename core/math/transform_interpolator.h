@@ -34,6 +34,7 @@
 #include "core/math/math_defs.h"
 
 struct Transform2D;
+struct Transform3D;
 
 class TransformInterpolator {
 private:
@@ -41,6 +42,7 @@ private:
 
 public:
 	static void interpolate_transform_2d(const Transform2D &p_prev, const Transform2D &p_curr, Transform2D &r_result, real_t p_fraction);
+	static void interpolate_transform_3d(const Transform3D &p_prev, const Transform3D &p_curr, Transform3D &r_result, real_t p_fraction);
 };
 
 #endif // TRANSFORM_INTERPOLATOR_H
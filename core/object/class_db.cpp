@@ -66,6 +66,9 @@ ClassDB::APIType ClassDB::get_current_api() {
 }
 
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+SafeNumeric<uint32_t> ClassDB::members_version{ 1 };
+bool ClassDB::resolved_members_built = false;
+Mutex ClassDB::resolve_mutex;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
@@ -554,6 +557,44 @@ Object *ClassDB::instantiate_no_placeholders(const StringName &p_class) {
 	return _instantiate_internal(p_class, true);
 }
 
+ClassDB::CreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	OBJTYPE_RLOCK;
+	// Only classes that instantiate() would create directly, without extensions,
+	// placeholders or compatibility remaps involved.
+	const ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if ((ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION) && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_resolved_property_setget(const StringName &p_class, const StringName &p_property) {
+	OBJTYPE_RLOCK;
+	ClassInfo *type = classes.getptr(p_class);
+	ResolvedMembers *members = type ? _get_resolved_members(type) : nullptr;
+	if (members) {
+		const PropertySetGet *const *resolved = members->property_setget.getptr(p_property);
+		return resolved ? *resolved : nullptr;
+	}
+
+	while (type) {
+		const PropertySetGet *psg = type->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+		if (type->constant_map.has(p_property) || type->method_map.has(p_property) || type->signal_map.has(p_property)) {
+			return nullptr; // Shadowed, get_property() would not reach the accessors.
+		}
+		type = type->inherits_ptr;
+	}
+	return nullptr;
+}
+
 #ifdef TOOLS_ENABLED
 ObjectGDExtension *ClassDB::get_placeholder_extension(const StringName &p_class) {
 	ObjectGDExtension *placeholder_extension = placeholder_extensions.getptr(p_class);
@@ -725,6 +766,7 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 
 	ERR_FAIL_COND_MSG(classes.has(name), "Class '" + String(p_class) + "' already exists.");
 
+	members_version.increment();
 	classes[name] = ClassInfo();
 	ClassInfo &ti = classes[name];
 	ti.name = name;
@@ -917,10 +959,94 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 	return false;
 }
 
+ClassDB::ResolvedMembers *ClassDB::_get_resolved_members(ClassInfo *p_class) {
+	ResolvedMembers *resolved = p_class->resolved.ptr.load(std::memory_order_acquire);
+	if (likely(resolved) || !resolved_members_built) {
+		return resolved;
+	}
+
+	// Only classes registered or changed since build_resolved_members() get here.
+	MutexLock resolve_lock(resolve_mutex);
+	resolved = p_class->resolved.ptr.load(std::memory_order_acquire);
+	if (resolved) {
+		return resolved; // Built by another thread meanwhile.
+	}
+
+	resolved = memnew(ResolvedMembers);
+
+	// Same precedence as walking the chain: the most derived class wins, and within
+	// get_property() a constant, method or signal hides properties of the ancestors.
+	HashSet<StringName> shadowed;
+	for (ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			if (E.value && !resolved->methods.has(E.key)) {
+				resolved->methods.insert(E.key, E.value);
+			}
+		}
+		for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+			if (!resolved->property_setget.has(E.key)) {
+				// A null entry means the property exists but lookups must walk the chain.
+				resolved->property_setget.insert(E.key, shadowed.has(E.key) ? nullptr : &E.value);
+			}
+		}
+		for (const KeyValue<StringName, int64_t> &E : check->constant_map) {
+			shadowed.insert(E.key);
+		}
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			shadowed.insert(E.key);
+		}
+		for (const KeyValue<StringName, MethodInfo> &E : check->signal_map) {
+			shadowed.insert(E.key);
+		}
+	}
+
+	p_class->resolved.ptr.store(resolved, std::memory_order_release);
+	return resolved;
+}
+
+void ClassDB::_invalidate_resolved_members(ClassInfo *p_class) {
+	members_version.increment();
+	if (!resolved_members_built) {
+		return; // Nothing built yet, registration is still going on.
+	}
+
+	// Drop the tables of the class and everything inheriting from it, they are rebuilt on
+	// their next use. Called while the class is being changed, so no lookup on it can be
+	// in flight: the old tables can be freed right away instead of being kept around.
+	MutexLock resolve_lock(resolve_mutex);
+	for (KeyValue<StringName, ClassInfo> &E : classes) {
+		ClassInfo *check = &E.value;
+		while (check && check != p_class) {
+			check = check->inherits_ptr;
+		}
+		if (!check) {
+			continue;
+		}
+		ResolvedMembers *resolved = E.value.resolved.ptr.exchange(nullptr, std::memory_order_acq_rel);
+		if (resolved) {
+			memdelete(resolved);
+		}
+	}
+}
+
+void ClassDB::build_resolved_members() {
+	OBJTYPE_WLOCK;
+
+	resolved_members_built = true;
+	for (KeyValue<StringName, ClassInfo> &E : classes) {
+		_get_resolved_members(&E.value);
+	}
+}
+
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
+	ResolvedMembers *resolved = type ? _get_resolved_members(type) : nullptr;
+	if (resolved) {
+		MethodBind **method = resolved->methods.getptr(p_name);
+		return method ? *method : nullptr;
+	}
 
 	while (type) {
 		MethodBind **method = type->method_map.getptr(p_name);
@@ -998,6 +1124,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 	}
 
 	type->constant_map[p_name] = p_constant;
+	_invalidate_resolved_members(type);
 
 	String enum_name = p_enum;
 	if (!enum_name.is_empty()) {
@@ -1237,6 +1364,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 #endif
 
 	type->signal_map[sname] = p_signal;
+	_invalidate_resolved_members(type);
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
@@ -1389,6 +1517,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_invalidate_resolved_members(type);
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -1487,8 +1616,14 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
+	ResolvedMembers *members = type ? _get_resolved_members(type) : nullptr;
+	const PropertySetGet *const *resolved = members ? members->property_setget.getptr(p_property) : nullptr;
+	if (members && !resolved) {
+		return false; // No class in the chain has this property.
+	}
 	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		// Resolved properties are found in one lookup, otherwise walk the chain.
+		const PropertySetGet *psg = (resolved && *resolved) ? *resolved : check->property_setget.getptr(p_property);
 		if (psg) {
 			if (!psg->setter) {
 				if (r_valid) {
@@ -1536,8 +1671,11 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
+	ResolvedMembers *members = type ? _get_resolved_members(type) : nullptr;
+	const PropertySetGet *const *resolved = members ? members->property_setget.getptr(p_property) : nullptr;
 	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		// Resolved properties are found in one lookup, otherwise walk the chain.
+		const PropertySetGet *psg = (resolved && *resolved) ? *resolved : check->property_setget.getptr(p_property);
 		if (psg) {
 			if (!psg->getter) {
 				return true; //return true but do nothing
@@ -1766,6 +1904,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_invalidate_resolved_members(type);
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
@@ -1792,6 +1931,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
 	type->method_map[p_name] = bind;
+	_invalidate_resolved_members(type);
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1850,6 +1990,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		_invalidate_resolved_members(type);
 	}
 
 	Vector<Variant> defvals;
@@ -2136,6 +2277,7 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 #endif
 
 	classes[p_extension->class_name] = c;
+	members_version.increment();
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
@@ -2146,6 +2288,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 			memdelete(F.value);
 		}
 	}
+	_invalidate_resolved_members(c);
 	classes.erase(p_class);
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
@@ -2199,7 +2342,12 @@ void ClassDB::cleanup() {
 				memdelete(F.value[i]);
 			}
 		}
+		ResolvedMembers *resolved = ti.resolved.ptr.load(std::memory_order_acquire);
+		if (resolved) {
+			memdelete(resolved);
+		}
 	}
+	resolved_members_built = false;
 
 	classes.clear();
 	resource_base_extensions.clear();
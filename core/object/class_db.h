@@ -38,6 +38,7 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/os/mutex.h"
 #include "core/templates/hash_set.h"
 
 #include <type_traits>
@@ -97,6 +98,14 @@ public:
 		Variant::Type type;
 	};
 
+	// Methods and property accessors of a class and all its ancestors, flattened
+	// so dynamic calls resolve in a single lookup instead of walking the chain.
+	struct ResolvedMembers {
+		HashMap<StringName, MethodBind *> methods;
+		// Only holds properties not shadowed by a constant, method or signal of a derived class.
+		HashMap<StringName, const PropertySetGet *> property_setget;
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -136,6 +145,15 @@ public:
 		bool is_runtime = false;
 		Object *(*creation_func)() = nullptr;
 
+		// Built once registration is done, see build_resolved_members(). Not copied with the class.
+		struct ResolvedMembersPtr {
+			std::atomic<ResolvedMembers *> ptr = { nullptr };
+
+			ResolvedMembersPtr() {}
+			ResolvedMembersPtr(const ResolvedMembersPtr &p_other) {}
+			ResolvedMembersPtr &operator=(const ResolvedMembersPtr &p_other) { return *this; }
+		} resolved;
+
 		ClassInfo() {}
 		~ClassInfo() {}
 	};
@@ -147,6 +165,14 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+
+	// Bumped whenever registration changes classes or their members.
+	static SafeNumeric<uint32_t> members_version;
+	// Until registration is done, lookups walk the inheritance chain instead.
+	static bool resolved_members_built;
+	static Mutex resolve_mutex;
+	static ResolvedMembers *_get_resolved_members(ClassInfo *p_class);
+	static void _invalidate_resolved_members(ClassInfo *p_class);
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -291,6 +317,13 @@ public:
 	static bool is_virtual(const StringName &p_class);
 	static Object *instantiate(const StringName &p_class);
 	static Object *instantiate_no_placeholders(const StringName &p_class);
+
+	// Lookups for callers that cache them, like scene instantiation plans.
+	// The results stay valid as long as get_members_version() doesn't change.
+	typedef Object *(*CreationFunc)();
+	static CreationFunc get_native_creation_func(const StringName &p_class);
+	static const PropertySetGet *get_resolved_property_setget(const StringName &p_class, const StringName &p_property);
+	_FORCE_INLINE_ static uint32_t get_members_version() { return members_version.get(); }
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -473,6 +506,7 @@ public:
 
 	static void set_current_api(APIType p_api);
 	static APIType get_current_api();
+	static void build_resolved_members();
 	static void cleanup_defaults();
 	static void cleanup();
 
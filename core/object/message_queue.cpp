@@ -58,6 +58,10 @@
 		mutex.unlock();                           \
 	}
 
+SafeNumeric<uint64_t> CallQueue::last_producer_cache_id;
+thread_local uint64_t CallQueue::cached_producer_queue = 0;
+thread_local CallQueue::Producer *CallQueue::cached_producer = nullptr;
+
 void CallQueue::_add_page() {
 	if (pages_used == page_bytes.size()) {
 		pages.push_back(allocator->alloc());
@@ -67,6 +71,126 @@ void CallQueue::_add_page() {
 	pages_used++;
 }
 
+void CallQueue::_ensure_first_page() {
+	if (unlikely(pages.is_empty())) {
+		pages.push_back(allocator->alloc());
+		page_bytes.push_back(0);
+		pages_used = 1;
+	}
+}
+
+CallQueue::Producer *CallQueue::_get_producer() {
+	if (this == MessageQueue::thread_singleton || Thread::is_main_thread()) {
+		return nullptr;
+	}
+	if (cached_producer_queue == producer_cache_id) {
+		return cached_producer;
+	}
+
+	mutex.lock();
+	Producer *producer = nullptr;
+	Producer **producerp = producer_map.getptr(Thread::get_caller_id());
+	if (producerp) {
+		producer = *producerp;
+	} else {
+		producer = memnew(Producer);
+		producers.push_back(producer);
+		producer_map.insert(Thread::get_caller_id(), producer);
+	}
+	mutex.unlock();
+
+	cached_producer_queue = producer_cache_id;
+	cached_producer = producer;
+	return producer;
+}
+
+void CallQueue::_lock_for_push(Producer *p_producer) {
+	if (p_producer) {
+		p_producer->lock.lock();
+	} else {
+		LOCK_MUTEX;
+	}
+}
+
+void CallQueue::_unlock_for_push(Producer *p_producer) {
+	if (p_producer) {
+		p_producer->lock.unlock();
+	} else {
+		UNLOCK_MUTEX;
+	}
+}
+
+uint8_t *CallQueue::_reserve_message(Producer *p_producer, uint32_t p_room_needed) {
+	if (!p_producer) {
+		_ensure_first_page();
+		if ((page_bytes[pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+			if (pages_used >= max_pages) {
+				return nullptr;
+			}
+			_add_page();
+		}
+		return &pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+	}
+
+	if (unlikely(p_producer->pages.is_empty())) {
+		p_producer->pages.push_back(allocator->alloc());
+		p_producer->page_bytes.push_back(0);
+		p_producer->pages_used = 1;
+	}
+	if ((p_producer->page_bytes[p_producer->pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (p_producer->pages_used >= max_pages) {
+			return nullptr;
+		}
+		if (p_producer->pages_used == p_producer->pages.size()) {
+			p_producer->pages.push_back(allocator->alloc());
+			p_producer->page_bytes.push_back(0);
+		}
+		p_producer->page_bytes[p_producer->pages_used] = 0;
+		p_producer->pages_used++;
+	}
+	return &p_producer->pages[p_producer->pages_used - 1]->data[p_producer->page_bytes[p_producer->pages_used - 1]];
+}
+
+void CallQueue::_commit_message(Producer *p_producer, uint32_t p_room_needed) {
+	if (!p_producer) {
+		page_bytes[pages_used - 1] += p_room_needed;
+		return;
+	}
+	p_producer->page_bytes[p_producer->pages_used - 1] += p_room_needed;
+	p_producer->message_count++;
+	producer_message_count.increment();
+}
+
+void CallQueue::_merge_producers() {
+	// Expected to be called with the mutex locked.
+	if (producer_message_count.get() == 0) {
+		return;
+	}
+
+	for (Producer *producer : producers) {
+		producer->lock.lock();
+		for (uint32_t i = 0; i < producer->pages_used; i++) {
+			if (producer->page_bytes[i] == 0) {
+				continue;
+			}
+			_ensure_first_page();
+			if (page_bytes[pages_used - 1] != 0) {
+				_add_page();
+			}
+			// Hand the filled page over, and give the producer the empty one back.
+			SWAP(pages[pages_used - 1], producer->pages[i]);
+			page_bytes[pages_used - 1] = producer->page_bytes[i];
+			producer->page_bytes[i] = 0;
+		}
+		if (producer->pages_used) {
+			producer->pages_used = 1;
+		}
+		producer_message_count.sub(producer->message_count);
+		producer->message_count = 0;
+		producer->lock.unlock();
+	}
+}
+
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -88,24 +212,17 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
+	Producer *producer = _get_producer();
+	_lock_for_push(producer);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _reserve_message(producer, room_needed);
+	if (!buffer_end) {
+		_unlock_for_push(producer);
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -126,37 +243,29 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	_commit_message(producer, room_needed);
+	_unlock_for_push(producer);
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
+	Producer *producer = _get_producer();
+	_lock_for_push(producer);
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	uint8_t *buffer_end = _reserve_message(producer, room_needed);
+	if (!buffer_end) {
+		_unlock_for_push(producer);
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -167,32 +276,26 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit_message(producer, room_needed);
+	_unlock_for_push(producer);
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
+	Producer *producer = _get_producer();
+	_lock_for_push(producer);
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _reserve_message(producer, room_needed);
+	if (!buffer_end) {
+		_unlock_for_push(producer);
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -200,8 +303,8 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit_message(producer, room_needed);
+	_unlock_for_push(producer);
 
 	return OK;
 }
@@ -226,15 +329,17 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 Error CallQueue::flush() {
 	LOCK_MUTEX;
 
-	if (pages.size() == 0) {
-		// Never allocated
+	if (flushing) {
 		UNLOCK_MUTEX;
-		return OK; // Do nothing.
+		return ERR_BUSY;
 	}
 
-	if (flushing) {
+	_merge_producers();
+
+	if (pages.size() == 0) {
+		// Never allocated
 		UNLOCK_MUTEX;
-		return ERR_BUSY;
+		return OK; // Do nothing.
 	}
 
 	flushing = true;
@@ -242,7 +347,16 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	while (true) {
+		if (!(i < pages_used && offset < page_bytes[i])) {
+			// Messages pushed from other threads meanwhile also belong to this flush.
+			if (producer_message_count.get() == 0) {
+				break;
+			}
+			_merge_producers();
+			continue;
+		}
+
 		Page *page = pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
@@ -308,6 +422,8 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	_merge_producers();
+
 	if (pages.size() == 0) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
@@ -348,6 +464,7 @@ void CallQueue::clear() {
 
 void CallQueue::statistics() {
 	LOCK_MUTEX;
+	_merge_producers();
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
@@ -446,6 +563,9 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (producer_message_count.get() > 0) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
@@ -470,6 +590,7 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 	}
 	max_pages = p_max_pages;
 	error_text = p_error_text;
+	producer_cache_id = last_producer_cache_id.increment();
 }
 
 CallQueue::~CallQueue() {
@@ -478,6 +599,12 @@ CallQueue::~CallQueue() {
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
 	}
+	for (Producer *producer : producers) {
+		for (uint32_t i = 0; i < producer->pages.size(); i++) {
+			allocator->free(producer->pages[i]);
+		}
+		memdelete(producer);
+	}
 	if (!allocator_is_custom) {
 		memdelete(allocator);
 	}
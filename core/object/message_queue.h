@@ -32,9 +32,13 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -77,6 +81,26 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Messages pushed from threads other than the main one go to pages of their own,
+	// so producers don't contend on the queue mutex. They are spliced into the queue,
+	// keeping each producer's order, when it's flushed.
+	struct Producer {
+		SpinLock lock;
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		uint32_t pages_used = 0;
+		uint32_t message_count = 0;
+	};
+
+	LocalVector<Producer *> producers;
+	HashMap<Thread::ID, Producer *> producer_map;
+	SafeNumeric<uint32_t> producer_message_count;
+	uint64_t producer_cache_id = 0;
+
+	static SafeNumeric<uint64_t> last_producer_cache_id;
+	static thread_local uint64_t cached_producer_queue;
+	static thread_local Producer *cached_producer;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -90,15 +114,15 @@ private:
 		};
 	};
 
-	_FORCE_INLINE_ void _ensure_first_page() {
-		if (unlikely(pages.is_empty())) {
-			pages.push_back(allocator->alloc());
-			page_bytes.push_back(0);
-			pages_used = 1;
-		}
-	}
-
 	void _add_page();
+	void _ensure_first_page();
+
+	Producer *_get_producer();
+	uint8_t *_reserve_message(Producer *p_producer, uint32_t p_room_needed);
+	void _commit_message(Producer *p_producer, uint32_t p_room_needed);
+	void _lock_for_push(Producer *p_producer);
+	void _unlock_for_push(Producer *p_producer);
+	void _merge_producers();
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
@@ -438,6 +438,24 @@ void Object::set_indexed(const Vector<StringName> &p_names, const Variant &p_val
 	ERR_FAIL_COND(!value_stack.is_empty());
 }
 
+// Same as `set_indexed()`, but remembers in `r_script_member_slot` where a script member was found.
+// The slot starts as `ScriptInstance::MEMBER_SLOT_UNRESOLVED` and must only be used with this object.
+void Object::set_indexed_cached(const Vector<StringName> &p_names, const Variant &p_value, int &r_script_member_slot, bool *r_valid) {
+	if (p_names.size() == 1 && script_instance && r_script_member_slot != ScriptInstance::MEMBER_SLOT_NONE) {
+#ifdef TOOLS_ENABLED
+		_edited = true;
+#endif
+		if (script_instance->set_member_cached(p_names[0], p_value, r_script_member_slot)) {
+			if (r_valid) {
+				*r_valid = true;
+			}
+			return;
+		}
+	}
+
+	set_indexed(p_names, p_value, r_valid);
+}
+
 Variant Object::get_indexed(const Vector<StringName> &p_names, bool *r_valid) const {
 	if (p_names.is_empty()) {
 		if (r_valid) {
@@ -1076,6 +1094,7 @@ void Object::_remove_user_signal(const StringName &p_name) {
 	SignalData *s = signal_map.getptr(p_name);
 	ERR_FAIL_NULL_MSG(s, "Provided signal does not exist.");
 	ERR_FAIL_COND_MSG(!s->removable, "Signal is not removable (not added with add_user_signal).");
+	ERR_FAIL_COND_MSG(s->emitting > 0, "Can't remove a signal while it is being emitted.");
 	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
 		Object *target = slot_kv.key.get_object();
 		if (likely(target)) {
@@ -1134,31 +1153,26 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// Slots are called in place instead of from a copy of the connection list.
+	// While an emission is in progress, disconnecting only marks slots as removed
+	// (see _disconnect()), and new connections are appended after `last`, so the
+	// slots seen here match the connections at the time the emission started.
+	s->emitting++;
+	const uint32_t generation = ++s->emission_generation;
+	HashMap<Callable, SignalData::Slot, HashableHasher<Callable>>::Iterator last = s->slot_map.last();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+	for (KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
+		const SignalData::Slot &slot = slot_kv.value;
+		bool disconnect = !slot.removed && (slot.conn.flags & CONNECT_ONE_SHOT);
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slot.conn.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slot.conn.callable);
 		}
 	}
 
@@ -1166,30 +1180,31 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+	for (HashMap<Callable, SignalData::Slot, HashableHasher<Callable>>::Iterator E = s->slot_map.begin(); E; ++E) {
+		const SignalData::Slot &slot = E->value;
+		const Callable &callable = slot.conn.callable;
+		const uint32_t flags = slot.conn.flags;
+		const bool is_last = E == last;
 
-		if (!callable.is_valid()) {
+		if (slot.removed && int32_t(slot.removed_generation - generation) < 0) {
+			// Disconnected before this emission started.
+		} else if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
-			continue;
-		}
-
-		const Variant **args = p_args;
-		int argc = p_argcount;
-
-		if (flags & CONNECT_DEFERRED) {
-			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
+		} else if (flags & CONNECT_DEFERRED) {
+			MessageQueue::get_singleton()->push_callablep(callable, p_args, p_argcount, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			callable.callp(p_args, p_argcount, ret, ce);
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
 				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+					if (is_last) {
+						break;
+					}
 					continue;
 				}
 #endif
@@ -1197,15 +1212,20 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
-					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(callable, args, argc, ce) + ".");
+					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(callable, p_args, p_argcount, ce) + ".");
 					err = ERR_METHOD_NOT_FOUND;
 				}
 			}
 		}
+
+		if (is_last) {
+			break;
+		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	s->emitting--;
+	if (s->emitting == 0 && (s->removed_slots > 0 || !s->retired_callables.is_empty())) {
+		_erase_removed_slots(p_name, s);
 	}
 
 	return err;
@@ -1319,7 +1339,9 @@ void Object::get_all_signal_connections(List<Connection> *p_connections) const {
 		const SignalData *s = &E.value;
 
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			p_connections->push_back(slot_kv.value.conn);
+			if (!slot_kv.value.removed) {
+				p_connections->push_back(slot_kv.value.conn);
+			}
 		}
 	}
 }
@@ -1331,7 +1353,9 @@ void Object::get_signal_connection_list(const StringName &p_signal, List<Connect
 	}
 
 	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		p_connections->push_back(slot_kv.value.conn);
+		if (!slot_kv.value.removed) {
+			p_connections->push_back(slot_kv.value.conn);
+		}
 	}
 }
 
@@ -1342,7 +1366,7 @@ int Object::get_persistent_signal_connection_count() const {
 		const SignalData *s = &E.value;
 
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			if (slot_kv.value.conn.flags & CONNECT_PERSIST) {
+			if (!slot_kv.value.removed && (slot_kv.value.conn.flags & CONNECT_PERSIST)) {
 				count += 1;
 			}
 		}
@@ -1394,9 +1418,10 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 	}
 
 	//compare with the base callable, so binds can be ignored
-	if (s->slot_map.has(*p_callable.get_base_comparator())) {
+	SignalData::Slot *existing = s->slot_map.getptr(*p_callable.get_base_comparator());
+	if (existing && !existing->removed) {
 		if (p_flags & CONNECT_REFERENCE_COUNTED) {
-			s->slot_map[*p_callable.get_base_comparator()].reference_count++;
+			existing->reference_count++;
 			return OK;
 		} else {
 			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Signal '" + p_signal + "' is already connected to given callable '" + p_callable + "' in that object.");
@@ -1419,6 +1444,23 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 		slot.reference_count = 1;
 	}
 
+	if (existing) {
+		// Reconnected while being emitted, revive the removed slot in place.
+		// Its callable may still be running, so only the connection data is replaced.
+		existing->reference_count = slot.reference_count;
+		existing->conn.signal = slot.conn.signal;
+		existing->conn.flags = slot.conn.flags;
+		existing->cE = slot.cE;
+		existing->removed = false;
+		s->removed_slots--;
+		if (existing->conn.callable != p_callable) {
+			// Different binds, keep the old callable alive until the emission ends.
+			s->retired_callables.push_back(existing->conn.callable);
+			existing->conn.callable = p_callable;
+		}
+		return OK;
+	}
+
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
 
@@ -1441,7 +1483,8 @@ bool Object::is_connected(const StringName &p_signal, const Callable &p_callable
 		ERR_FAIL_V_MSG(false, "Nonexistent signal: " + p_signal + ".");
 	}
 
-	return s->slot_map.has(*p_callable.get_base_comparator());
+	const SignalData::Slot *slot = s->slot_map.getptr(*p_callable.get_base_comparator());
+	return slot && !slot->removed;
 }
 
 void Object::disconnect(const StringName &p_signal, const Callable &p_callable) {
@@ -1459,9 +1502,8 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 	ERR_FAIL_NULL_V_MSG(s, false, vformat("Disconnecting nonexistent signal '%s' in %s.", p_signal, to_string()));
 
-	ERR_FAIL_COND_V_MSG(!s->slot_map.has(*p_callable.get_base_comparator()), false, "Attempt to disconnect a nonexistent connection from '" + to_string() + "'. Signal: '" + p_signal + "', callable: '" + p_callable + "'.");
-
-	SignalData::Slot *slot = &s->slot_map[*p_callable.get_base_comparator()];
+	SignalData::Slot *slot = s->slot_map.getptr(*p_callable.get_base_comparator());
+	ERR_FAIL_COND_V_MSG(!slot || slot->removed, false, "Attempt to disconnect a nonexistent connection from '" + to_string() + "'. Signal: '" + p_signal + "', callable: '" + p_callable + "'.");
 
 	if (!p_force) {
 		slot->reference_count--; // by default is zero, if it was not referenced it will go below it
@@ -1475,6 +1517,15 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 		if (target_object) {
 			target_object->connections.erase(slot->cE);
 		}
+		slot->cE = nullptr;
+	}
+
+	if (s->emitting > 0) {
+		// An emission is iterating over the slots, erase it once it ends.
+		slot->removed = true;
+		slot->removed_generation = s->emission_generation;
+		s->removed_slots++;
+		return true;
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
@@ -1487,6 +1538,24 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	return true;
 }
 
+void Object::_erase_removed_slots(const StringName &p_signal, SignalData *p_signal_data) {
+	for (HashMap<Callable, SignalData::Slot, HashableHasher<Callable>>::Iterator E = p_signal_data->slot_map.begin(); E;) {
+		HashMap<Callable, SignalData::Slot, HashableHasher<Callable>>::Iterator next = E;
+		++next;
+		if (E->value.removed) {
+			p_signal_data->slot_map.remove(E);
+		}
+		E = next;
+	}
+	p_signal_data->removed_slots = 0;
+	p_signal_data->retired_callables.clear();
+
+	if (p_signal_data->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
+		//not user signal, delete
+		signal_map.erase(p_signal);
+	}
+}
+
 void Object::_set_bind(const StringName &p_set, const Variant &p_value) {
 	set(p_set, p_value);
 }
@@ -2086,7 +2155,7 @@ Object::~Object() {
 
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
 			Object *target = slot_kv.value.conn.callable.get_object();
-			if (likely(target)) {
+			if (likely(target && slot_kv.value.cE)) {
 				target->connections.erase(slot_kv.value.cE);
 			}
 		}
@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -616,10 +617,17 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			// Disconnected while the signal was being emitted, erased once the emission ends.
+			bool removed = false;
+			uint32_t removed_generation = 0;
 		};
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		uint32_t emitting = 0; // Number of nested emissions in progress.
+		uint32_t emission_generation = 0;
+		uint32_t removed_slots = 0;
+		LocalVector<Callable> retired_callables; // Replaced while possibly being called.
 		bool removable = false;
 	};
 
@@ -770,6 +778,7 @@ protected:
 	friend class PlaceholderExtensionInstance;
 
 	bool _disconnect(const StringName &p_signal, const Callable &p_callable, bool p_force = false);
+	void _erase_removed_slots(const StringName &p_signal, SignalData *p_signal_data);
 
 #ifdef TOOLS_ENABLED
 	struct VirtualMethodTracker {
@@ -861,6 +870,7 @@ public:
 	void set(const StringName &p_name, const Variant &p_value, bool *r_valid = nullptr);
 	Variant get(const StringName &p_name, bool *r_valid = nullptr) const;
 	void set_indexed(const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid = nullptr);
+	void set_indexed_cached(const Vector<StringName> &p_names, const Variant &p_value, int &r_script_member_slot, bool *r_valid = nullptr);
 	Variant get_indexed(const Vector<StringName> &p_names, bool *r_valid = nullptr) const;
 
 	void get_property_list(List<PropertyInfo> *p_list, bool p_reversed = false) const;
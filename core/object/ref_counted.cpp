@@ -55,8 +55,29 @@ int RefCounted::get_reference_count() const {
 	return refcount.get();
 }
 
+#ifdef DEBUG_ENABLED
+void RefCounted::_check_confined_thread() const {
+	CRASH_COND_MSG(Thread::get_caller_id() != confined_thread, "A thread-confined RefCounted was referenced from a thread other than the one it is confined to.");
+}
+#endif
+
+void RefCounted::set_thread_confined(bool p_enabled) {
+	thread_confined = p_enabled;
+#ifdef DEBUG_ENABLED
+	confined_thread = p_enabled ? Thread::get_caller_id() : Thread::UNASSIGNED_ID;
+#endif
+}
+
 bool RefCounted::reference() {
-	uint32_t rc_val = refcount.refval();
+	uint32_t rc_val;
+	if (thread_confined) {
+#ifdef DEBUG_ENABLED
+		_check_confined_thread();
+#endif
+		rc_val = refcount.refval_unsynchronized();
+	} else {
+		rc_val = refcount.refval();
+	}
 	bool success = rc_val != 0;
 
 	if (success && rc_val <= 2 /* higher is not relevant */) {
@@ -74,7 +95,15 @@ bool RefCounted::reference() {
 }
 
 bool RefCounted::unreference() {
-	uint32_t rc_val = refcount.unrefval();
+	uint32_t rc_val;
+	if (thread_confined) {
+#ifdef DEBUG_ENABLED
+		_check_confined_thread();
+#endif
+		rc_val = refcount.unrefval_unsynchronized();
+	} else {
+		rc_val = refcount.unrefval();
+	}
 	bool die = rc_val == 0;
 
 	if (rc_val <= 1 /* higher is not relevant */) {
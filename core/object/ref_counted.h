@@ -32,12 +32,18 @@
 #define REF_COUNTED_H
 
 #include "core/object/class_db.h"
+#include "core/os/thread.h"
 #include "core/templates/safe_refcount.h"
 
 class RefCounted : public Object {
 	GDCLASS(RefCounted, Object);
 	SafeRefCount refcount;
 	SafeRefCount refcount_init;
+	bool thread_confined = false;
+#ifdef DEBUG_ENABLED
+	Thread::ID confined_thread = Thread::UNASSIGNED_ID;
+	void _check_confined_thread() const;
+#endif
 
 protected:
 	static void _bind_methods();
@@ -49,6 +55,12 @@ public:
 	bool unreference();
 	int get_reference_count() const;
 
+	// Thread-confined objects use plain, non-atomic reference counting.
+	// Only enable it on objects whose references never leave the calling thread,
+	// and while no other thread holds a reference.
+	void set_thread_confined(bool p_enabled);
+	_FORCE_INLINE_ bool is_thread_confined() const { return thread_confined; }
+
 	RefCounted();
 	~RefCounted() {}
 };
@@ -40,6 +40,18 @@ class ScriptInstance {
 public:
 	virtual bool set(const StringName &p_name, const Variant &p_value) = 0;
 	virtual bool get(const StringName &p_name, Variant &r_ret) const = 0;
+
+	// Sets a member variable of the script, for callers that set the same one repeatedly (e.g. tweens and animations).
+	// `r_slot` is a hint owned by the caller, initialized to `MEMBER_SLOT_UNRESOLVED`, that lets the lookup by name be skipped.
+	// Returns false and sets it to `MEMBER_SLOT_NONE` when the name isn't a plain member, so `set()` has to be used.
+	enum {
+		MEMBER_SLOT_UNRESOLVED = -1,
+		MEMBER_SLOT_NONE = -2,
+	};
+	virtual bool set_member_cached(const StringName &p_name, const Variant &p_value, int &r_slot) {
+		r_slot = MEMBER_SLOT_NONE;
+		return false;
+	}
 	virtual void get_property_list(List<PropertyInfo> *p_properties) const = 0;
 	virtual Variant::Type get_property_type(const StringName &p_name, bool *r_is_valid = nullptr) const = 0;
 	virtual void validate_property(PropertyInfo &p_property) const = 0;
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  task_graph.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "task_graph.h"
+
+int TaskGraph::_add_node(const Node &p_node) {
+	ERR_FAIL_COND_V_MSG(submitted, -1, "Can't add tasks to a TaskGraph that was submitted and not waited for.");
+	for (int dependency : p_node.dependencies) {
+		ERR_FAIL_INDEX_V_MSG(dependency, (int)nodes.size(), -1, "Dependencies must be tasks previously added to the graph.");
+	}
+	nodes.push_back(p_node);
+	return nodes.size() - 1;
+}
+
+int TaskGraph::add_task(const Callable &p_action, const Vector<int> &p_dependencies, bool p_high_priority, const String &p_description) {
+	Node node;
+	node.action = p_action;
+	node.dependencies = p_dependencies;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	return _add_node(node);
+}
+
+int TaskGraph::add_group_task(const Callable &p_action, int p_elements, const Vector<int> &p_dependencies, int p_tasks_needed, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_COND_V(p_elements < 0, -1);
+	Node node;
+	node.action = p_action;
+	node.elements = p_elements;
+	node.tasks_needed = p_tasks_needed;
+	node.dependencies = p_dependencies;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	return _add_node(node);
+}
+
+int TaskGraph::add_native_task(void (*p_func)(void *), void *p_userdata, const Vector<int> &p_dependencies, bool p_high_priority, const String &p_description) {
+	Node node;
+	node.native_func = p_func;
+	node.native_userdata = p_userdata;
+	node.dependencies = p_dependencies;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	return _add_node(node);
+}
+
+int TaskGraph::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int> &p_dependencies, int p_tasks_needed, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_COND_V(p_elements < 0, -1);
+	Node node;
+	node.native_group_func = p_func;
+	node.native_userdata = p_userdata;
+	node.elements = p_elements;
+	node.tasks_needed = p_tasks_needed;
+	node.dependencies = p_dependencies;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	return _add_node(node);
+}
+
+int TaskGraph::get_task_count() const {
+	return nodes.size();
+}
+
+void TaskGraph::clear() {
+	ERR_FAIL_COND_MSG(submitted, "Can't clear a TaskGraph that was submitted and not waited for.");
+	nodes.clear();
+}
+
+void TaskGraph::submit() {
+	ERR_FAIL_COND_MSG(submitted, "This TaskGraph was already submitted. Wait for it before submitting it again.");
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	Vector<WorkerThreadPool::TaskID> dependency_ids;
+	for (Node &node : nodes) {
+		dependency_ids.resize(node.dependencies.size());
+		for (int i = 0; i < node.dependencies.size(); i++) {
+			dependency_ids.write[i] = nodes[node.dependencies[i]].id;
+		}
+
+		if (node.elements < 0) {
+			if (node.native_func) {
+				node.id = pool->add_native_task_after(node.native_func, node.native_userdata, dependency_ids, node.high_priority, node.description);
+			} else {
+				node.id = pool->add_task_after(node.action, dependency_ids, node.high_priority, node.description);
+			}
+		} else {
+			if (node.native_group_func) {
+				node.id = pool->add_native_group_task_after(node.native_group_func, node.native_userdata, node.elements, dependency_ids, node.tasks_needed, node.high_priority, node.description);
+			} else {
+				node.id = pool->add_group_task_after(node.action, node.elements, dependency_ids, node.tasks_needed, node.high_priority, node.description);
+			}
+		}
+	}
+	submitted = true;
+}
+
+bool TaskGraph::is_submitted() const {
+	return submitted;
+}
+
+bool TaskGraph::is_completed() const {
+	ERR_FAIL_COND_V_MSG(!submitted, false, "This TaskGraph was not submitted.");
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (const Node &node : nodes) {
+		bool completed = node.elements < 0 ? pool->is_task_completed(node.id) : pool->is_group_task_completed(node.id);
+		if (!completed) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void TaskGraph::wait() {
+	ERR_FAIL_COND_MSG(!submitted, "This TaskGraph was not submitted.");
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (Node &node : nodes) {
+		if (node.elements < 0) {
+			pool->wait_for_task_completion(node.id);
+		} else {
+			pool->wait_for_group_task_completion(node.id);
+		}
+		node.id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	submitted = false;
+}
+
+void TaskGraph::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_task", "action", "dependencies", "high_priority", "description"), &TaskGraph::add_task, DEFVAL(Vector<int>()), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &TaskGraph::add_group_task, DEFVAL(Vector<int>()), DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("get_task_count"), &TaskGraph::get_task_count);
+	ClassDB::bind_method(D_METHOD("clear"), &TaskGraph::clear);
+
+	ClassDB::bind_method(D_METHOD("submit"), &TaskGraph::submit);
+	ClassDB::bind_method(D_METHOD("is_submitted"), &TaskGraph::is_submitted);
+	ClassDB::bind_method(D_METHOD("is_completed"), &TaskGraph::is_completed);
+	ClassDB::bind_method(D_METHOD("wait"), &TaskGraph::wait);
+}
+
+TaskGraph::~TaskGraph() {
+	if (submitted) {
+		// Tasks must always be waited for, so their resources are released.
+		wait();
+	}
+}
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  task_graph.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
+
+// Builds a set of tasks and the dependencies between them, then posts them
+// all to the WorkerThreadPool as continuations, so nothing has to block
+// between one step and the next. Dependencies can only refer to tasks added
+// earlier, so graphs can't have cycles. After wait(), the same graph can be
+// submitted again.
+class TaskGraph : public RefCounted {
+	GDCLASS(TaskGraph, RefCounted);
+
+	struct Node {
+		Callable action;
+		void (*native_func)(void *) = nullptr;
+		void (*native_group_func)(void *, uint32_t) = nullptr;
+		void *native_userdata = nullptr;
+		int elements = -1; // Negative for regular tasks.
+		int tasks_needed = -1;
+		bool high_priority = false;
+		String description;
+		Vector<int> dependencies;
+		WorkerThreadPool::TaskID id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<Node> nodes;
+	bool submitted = false;
+
+	int _add_node(const Node &p_node);
+
+protected:
+	static void _bind_methods();
+
+public:
+	int add_task(const Callable &p_action, const Vector<int> &p_dependencies = Vector<int>(), bool p_high_priority = false, const String &p_description = String());
+	int add_group_task(const Callable &p_action, int p_elements, const Vector<int> &p_dependencies = Vector<int>(), int p_tasks_needed = -1, bool p_high_priority = false, const String &p_description = String());
+	int add_native_task(void (*p_func)(void *), void *p_userdata, const Vector<int> &p_dependencies = Vector<int>(), bool p_high_priority = false, const String &p_description = String());
+	int add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int> &p_dependencies = Vector<int>(), int p_tasks_needed = -1, bool p_high_priority = false, const String &p_description = String());
+
+	int get_task_count() const;
+	void clear();
+
+	void submit();
+	bool is_submitted() const;
+	bool is_completed() const;
+	void wait();
+
+	~TaskGraph();
+};
+
+#endif // TASK_GRAPH_H
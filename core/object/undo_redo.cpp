@@ -30,10 +30,76 @@
 
 #include "undo_redo.h"
 
+#include "core/io/compression.h"
+#include "core/io/marshalls.h"
 #include "core/io/resource.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
 
+// Packed arrays below this size are not worth compressing.
+static const int UNDO_REDO_COMPRESS_MIN_SIZE = 64 * 1024;
+
+// Rough estimate of the memory held by a value, only counting data that can grow large.
+static uint64_t _get_variant_memory_usage(const Variant &p_value, int p_depth = 0) {
+	uint64_t usage = sizeof(Variant);
+	if (p_depth > 8) {
+		return usage;
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::STRING: {
+			usage += String(p_value).length() * sizeof(char32_t);
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				usage += _get_variant_memory_usage(array[i], p_depth + 1);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict = p_value;
+			for (const Variant &key : dict.keys()) {
+				usage += _get_variant_memory_usage(key, p_depth + 1) + _get_variant_memory_usage(dict[key], p_depth + 1);
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			usage += PackedByteArray(p_value).size();
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			usage += PackedInt32Array(p_value).size() * sizeof(int32_t);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			usage += PackedInt64Array(p_value).size() * sizeof(int64_t);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			usage += PackedFloat32Array(p_value).size() * sizeof(float);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			usage += PackedFloat64Array(p_value).size() * sizeof(double);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			for (const String &E : PackedStringArray(p_value)) {
+				usage += sizeof(String) + E.length() * sizeof(char32_t);
+			}
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			usage += PackedVector2Array(p_value).size() * sizeof(Vector2);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			usage += PackedVector3Array(p_value).size() * sizeof(Vector3);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			usage += PackedColorArray(p_value).size() * sizeof(Color);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			usage += PackedVector4Array(p_value).size() * sizeof(Vector4);
+		} break;
+		default: {
+		}
+	}
+	return usage;
+}
+
 void UndoRedo::Operation::delete_reference() {
 	if (type != Operation::TYPE_REFERENCE) {
 		return;
@@ -48,6 +114,83 @@ void UndoRedo::Operation::delete_reference() {
 	}
 }
 
+void UndoRedo::Operation::compress_value() {
+	// Only packed arrays, as they can't hold objects and are what large edits (meshes, images, terrains) store.
+	if (type != Operation::TYPE_PROPERTY || !compressed_value.is_empty() || !value.is_array() || value.get_type() == Variant::ARRAY) {
+		return;
+	}
+	if (_get_variant_memory_usage(value) < UNDO_REDO_COMPRESS_MIN_SIZE) {
+		return;
+	}
+
+	int len = 0;
+	Error err = encode_variant(value, nullptr, len);
+	ERR_FAIL_COND(err != OK);
+
+	Vector<uint8_t> encoded;
+	encoded.resize(len);
+	encode_variant(value, encoded.ptrw(), len);
+
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(len, Compression::MODE_ZSTD));
+	int compressed_size = Compression::compress(compressed.ptrw(), encoded.ptr(), len, Compression::MODE_ZSTD);
+	if (compressed_size < 0 || compressed_size >= len) {
+		return; // Not worth it, keep the value as is.
+	}
+
+	compressed.resize(compressed_size);
+	compressed_value = compressed;
+	encoded_size = len;
+	value = Variant();
+}
+
+Variant UndoRedo::Operation::get_value() const {
+	if (compressed_value.is_empty()) {
+		return value;
+	}
+
+	Vector<uint8_t> encoded;
+	encoded.resize(encoded_size);
+	int len = Compression::decompress(encoded.ptrw(), encoded_size, compressed_value.ptr(), compressed_value.size(), Compression::MODE_ZSTD);
+	ERR_FAIL_COND_V(len != encoded_size, Variant());
+
+	Variant ret;
+	Error err = decode_variant(ret, encoded.ptr(), encoded_size);
+	ERR_FAIL_COND_V(err != OK, Variant());
+	return ret;
+}
+
+uint64_t UndoRedo::Operation::get_memory_usage() const {
+	uint64_t usage = sizeof(Operation);
+	if (!compressed_value.is_empty()) {
+		usage += compressed_value.size();
+	} else {
+		usage += _get_variant_memory_usage(value);
+	}
+
+	if (type == Operation::TYPE_METHOD && callable.is_custom()) {
+		Vector<Variant> binds;
+		int bind_count = 0;
+		callable.get_bound_arguments_ref(binds, bind_count);
+		for (const Variant &E : binds) {
+			usage += _get_variant_memory_usage(E);
+		}
+	}
+	return usage;
+}
+
+void UndoRedo::_update_action_memory_usage(Action &p_action) {
+	memory_usage -= p_action.memory_usage;
+	p_action.memory_usage = sizeof(Action);
+	for (const Operation &E : p_action.do_ops) {
+		p_action.memory_usage += E.get_memory_usage();
+	}
+	for (const Operation &E : p_action.undo_ops) {
+		p_action.memory_usage += E.get_memory_usage();
+	}
+	memory_usage += p_action.memory_usage;
+}
+
 void UndoRedo::_discard_redo() {
 	if (current_action == actions.size() - 1) {
 		return;
@@ -58,6 +201,7 @@ void UndoRedo::_discard_redo() {
 			E.delete_reference();
 		}
 		//ERASE do data
+		memory_usage -= actions[i].memory_usage;
 	}
 
 	actions.resize(current_action + 1);
@@ -287,21 +431,30 @@ void UndoRedo::end_force_keep_in_merge_ends() {
 	force_keep_in_merge_ends = false;
 }
 
-void UndoRedo::_pop_history_tail() {
+void UndoRedo::_pop_history_tail(int p_count) {
 	_discard_redo();
 
-	if (!actions.size()) {
+	p_count = MIN(p_count, actions.size());
+	if (p_count <= 0) {
 		return;
 	}
 
-	for (Operation &E : actions.write[0].undo_ops) {
-		E.delete_reference();
+	for (int i = 0; i < p_count; i++) {
+		for (Operation &E : actions.write[i].undo_ops) {
+			E.delete_reference();
+		}
+		memory_usage -= actions[i].memory_usage;
 	}
 
-	actions.remove_at(0);
-	if (current_action >= 0) {
-		current_action--;
+	// Shift the remaining actions once, rather than once per removed action.
+	int remaining = actions.size() - p_count;
+	Action *w = actions.ptrw();
+	for (int i = 0; i < remaining; i++) {
+		w[i] = w[i + p_count];
 	}
+	actions.resize(remaining);
+
+	current_action = MAX(current_action - p_count, -1);
 }
 
 bool UndoRedo::is_committing_action() const {
@@ -330,12 +483,34 @@ void UndoRedo::commit_action(bool p_execute) {
 	_redo(p_execute); // perform action
 	committing--;
 
-	if (max_steps > 0) {
+	// The previous action is less likely to be undone right away, so its large values can be compressed now.
+	if (add_message && actions.size() > 1) {
+		Action &previous = actions.write[actions.size() - 2];
+		for (Operation &E : previous.do_ops) {
+			E.compress_value();
+		}
+		for (Operation &E : previous.undo_ops) {
+			E.compress_value();
+		}
+		_update_action_memory_usage(previous);
+	}
+	_update_action_memory_usage(actions.write[actions.size() - 1]);
+
+	if (max_steps > 0 && actions.size() > max_steps) {
 		// Clear early steps.
+		_pop_history_tail(actions.size() - max_steps);
+	}
 
-		while (actions.size() > max_steps) {
-			_pop_history_tail();
+	if (max_memory_mb > 0) {
+		// Clear early steps until the history fits in the budget, always keeping the action just committed.
+		const uint64_t max_memory = uint64_t(max_memory_mb) * 1024 * 1024;
+		uint64_t usage = memory_usage;
+		int count = 0;
+		while (usage > max_memory && count < actions.size() - 1) {
+			usage -= actions[count].memory_usage;
+			count++;
 		}
+		_pop_history_tail(count);
 	}
 
 	if (add_message && callback && actions.size() > 0) {
@@ -397,8 +572,9 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E, bool p_execu
 				}
 			} break;
 			case Operation::TYPE_PROPERTY: {
+				Variant value = op.get_value();
 				if (p_execute) {
-					obj->set(op.name, op.value);
+					obj->set(op.name, value);
 #ifdef TOOLS_ENABLED
 					Resource *res = Object::cast_to<Resource>(obj);
 					if (res) {
@@ -408,7 +584,7 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E, bool p_execu
 				}
 
 				if (property_callback) {
-					property_callback(prop_callback_ud, obj, op.name, op.value);
+					property_callback(prop_callback_ud, obj, op.name, value);
 				}
 			} break;
 			case Operation::TYPE_REFERENCE: {
@@ -455,11 +631,7 @@ String UndoRedo::get_action_name(int p_id) {
 
 void UndoRedo::clear_history(bool p_increase_version) {
 	ERR_FAIL_COND(action_level > 0);
-	_discard_redo();
-
-	while (actions.size()) {
-		_pop_history_tail();
-	}
+	_pop_history_tail(actions.size());
 
 	if (p_increase_version) {
 		version++;
@@ -503,6 +675,18 @@ int UndoRedo::get_max_steps() const {
 	return max_steps;
 }
 
+void UndoRedo::set_max_memory_mb(int p_max_memory_mb) {
+	max_memory_mb = p_max_memory_mb;
+}
+
+int UndoRedo::get_max_memory_mb() const {
+	return max_memory_mb;
+}
+
+uint64_t UndoRedo::get_memory_usage() const {
+	return memory_usage;
+}
+
 void UndoRedo::set_commit_notify_callback(CommitNotifyCallback p_callback, void *p_ud) {
 	callback = p_callback;
 	callback_ud = p_ud;
@@ -549,10 +733,14 @@ void UndoRedo::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_version"), &UndoRedo::get_version);
 	ClassDB::bind_method(D_METHOD("set_max_steps", "max_steps"), &UndoRedo::set_max_steps);
 	ClassDB::bind_method(D_METHOD("get_max_steps"), &UndoRedo::get_max_steps);
+	ClassDB::bind_method(D_METHOD("set_max_memory_mb", "max_memory_mb"), &UndoRedo::set_max_memory_mb);
+	ClassDB::bind_method(D_METHOD("get_max_memory_mb"), &UndoRedo::get_max_memory_mb);
+	ClassDB::bind_method(D_METHOD("get_memory_usage"), &UndoRedo::get_memory_usage);
 	ClassDB::bind_method(D_METHOD("redo"), &UndoRedo::redo);
 	ClassDB::bind_method(D_METHOD("undo"), &UndoRedo::undo);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_steps", PROPERTY_HINT_RANGE, "0,50,1,or_greater"), "set_max_steps", "get_max_steps");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_memory_mb", PROPERTY_HINT_RANGE, "0,4096,1,or_greater,suffix:MiB"), "set_max_memory_mb", "get_max_memory_mb");
 
 	ADD_SIGNAL(MethodInfo("version_changed"));
 
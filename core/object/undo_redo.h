@@ -64,8 +64,14 @@ private:
 		StringName name;
 		Callable callable;
 		Variant value;
+		// Large packed array values of older actions are kept encoded and compressed, see compress_value().
+		Vector<uint8_t> compressed_value;
+		int encoded_size = 0;
 
 		void delete_reference();
+		void compress_value();
+		Variant get_value() const;
+		uint64_t get_memory_usage() const;
 	};
 
 	struct Action {
@@ -73,6 +79,7 @@ private:
 		List<Operation> do_ops;
 		List<Operation> undo_ops;
 		uint64_t last_tick = 0;
+		uint64_t memory_usage = 0;
 		bool backward_undo_ops = false;
 	};
 
@@ -81,12 +88,15 @@ private:
 	bool force_keep_in_merge_ends = false;
 	int action_level = 0;
 	int max_steps = 0;
+	int max_memory_mb = 0;
+	uint64_t memory_usage = 0;
 	MergeMode merge_mode = MERGE_DISABLE;
 	bool merging = false;
 	uint64_t version = 1;
 	int merge_total = 0;
 
-	void _pop_history_tail();
+	void _pop_history_tail(int p_count = 1);
+	void _update_action_memory_usage(Action &p_action);
 	void _process_operation_list(List<Operation>::Element *E, bool p_execute);
 	void _discard_redo();
 	bool _redo(bool p_execute);
@@ -140,6 +150,10 @@ public:
 	void set_max_steps(int p_max_steps);
 	int get_max_steps() const;
 
+	void set_max_memory_mb(int p_max_memory_mb);
+	int get_max_memory_mb() const;
+	uint64_t get_memory_usage() const;
+
 	void set_commit_notify_callback(CommitNotifyCallback p_callback, void *p_ud);
 
 	void set_method_notify_callback(MethodNotifyCallback p_method_callback, void *p_ud);
@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/engine_trace.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
@@ -49,7 +50,74 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 thread_local uintptr_t WorkerThreadPool::unlockable_mutexes[MAX_UNLOCKABLE_MUTEXES] = {};
 #endif
 
+void WorkerThreadPool::WorkStealingQueue::push(Task *p_task) {
+	lock.lock();
+	tasks.push_back(p_task);
+	lock.unlock();
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::WorkStealingQueue::pop() {
+	lock.lock();
+	Task *task = nullptr;
+	if (head < tasks.size()) {
+		task = tasks[tasks.size() - 1];
+		tasks.resize(tasks.size() - 1);
+		if (head == tasks.size()) {
+			tasks.clear();
+			head = 0;
+		}
+	}
+	lock.unlock();
+	return task;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::WorkStealingQueue::steal() {
+	lock.lock();
+	Task *task = nullptr;
+	if (head < tasks.size()) {
+		task = tasks[head++];
+		if (head == tasks.size()) {
+			tasks.clear();
+			head = 0;
+		}
+	}
+	lock.unlock();
+	return task;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_stealable_task(ThreadData *p_thread_data) {
+	if (stealable_task_count.get() == 0) {
+		return nullptr;
+	}
+
+	Task *task = p_thread_data->work_queue.pop();
+	for (uint32_t i = 1; !task && i < threads.size(); i++) {
+		task = threads[(p_thread_data->index + i) % threads.size()].work_queue.steal();
+	}
+
+	if (task) {
+		stealable_task_count.decrement();
+	}
+	return task;
+}
+
+void WorkerThreadPool::_free_group(Group *p_group) {
+	// Expected to be called with the task mutex locked.
+	Task *task = p_group->first_task;
+	while (task) {
+		Task *next = task->next_group_task;
+		task_allocator.free(task);
+		task = next;
+	}
+	group_allocator.free(p_group);
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
+	// High priority group tasks come from the work-stealing queues. They only touch
+	// state owned by this thread or by their group, so they don't need the task mutex.
+	bool uses_task_mutex = !p_task->group || p_task->low_priority;
+	Continuations ready_continuations;
+
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -66,20 +134,22 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// its pre-created threads can't have ScriptServer::thread_enter() called on them early.
 		// Therefore, we do it late at the first opportunity, so in case the task
 		// about to be run uses scripting, guarantees are held.
-		task_mutex.lock();
 		if (!curr_thread.ready_for_scripting && ScriptServer::are_languages_initialized()) {
-			task_mutex.unlock();
 			ScriptServer::thread_enter();
-			task_mutex.lock();
 			curr_thread.ready_for_scripting = true;
 		}
+		if (uses_task_mutex) {
+			task_mutex.lock();
+		}
 		p_task->pool_thread_index = pool_thread_index;
 		prev_task = curr_thread.current_task;
 		curr_thread.current_task = p_task;
 		if (p_task->pending_notify_yield_over) {
 			curr_thread.yield_is_over = true;
 		}
-		task_mutex.unlock();
+		if (uses_task_mutex) {
+			task_mutex.unlock();
+		}
 	}
 #endif
 
@@ -88,6 +158,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 
 	if (p_task->group) {
+		TRACE_ZONE_DETAIL("WorkerThreadPool::group_task", p_task->description);
+
 		// Handling a group
 		bool do_post = false;
 
@@ -120,34 +192,46 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (do_post) {
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
-		}
-		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
-		uint32_t finished_users = p_task->group->finished.increment();
 
-		if (finished_users == max_users) {
-			// Get rid of the group, because nobody else is using it.
+			// Must happen after completion is flagged, so continuations added meanwhile aren't missed.
 			task_mutex.lock();
-			group_allocator.free(p_task->group);
+			_collect_ready_continuations(p_task->group->continuations, ready_continuations);
 			task_mutex.unlock();
 		}
+		Group *group = p_task->group;
+		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 
-		// For groups, tasks get rid of themselves.
+#ifdef THREADS_ENABLED
+		// Whoever frees the group also frees this task, so stop referencing it first.
+		curr_thread.current_task = prev_task;
+#endif
+		uint32_t finished_users = group->finished.increment();
 
-		task_mutex.lock();
-		task_allocator.free(p_task);
+		if (uses_task_mutex || finished_users == max_users) {
+			task_mutex.lock();
+		}
+		if (finished_users == max_users) {
+			// Get rid of the group and its tasks, because nobody else is using them.
+			_free_group(group);
+			uses_task_mutex = true;
+		}
 	} else {
-		if (p_task->native_func) {
-			p_task->native_func(p_task->native_func_userdata);
-		} else if (p_task->template_userdata) {
-			p_task->template_userdata->callback();
-			memdelete(p_task->template_userdata);
-		} else {
-			p_task->callable.call();
+		{
+			TRACE_ZONE_DETAIL("WorkerThreadPool::task", p_task->description);
+			if (p_task->native_func) {
+				p_task->native_func(p_task->native_func_userdata);
+			} else if (p_task->template_userdata) {
+				p_task->template_userdata->callback();
+				memdelete(p_task->template_userdata);
+			} else {
+				p_task->callable.call();
+			}
 		}
 
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_collect_ready_continuations(p_task->continuations, ready_continuations);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -161,7 +245,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	}
 
 #ifdef THREADS_ENABLED
-	{
+	if (uses_task_mutex) {
 		curr_thread.current_task = prev_task;
 		if (low_priority) {
 			low_priority_threads_used--;
@@ -175,7 +259,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 		task_mutex.unlock();
 	}
+#endif
 
+	_post_ready_continuations(ready_continuations);
+
+#ifdef THREADS_ENABLED
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
@@ -183,9 +271,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
+	EngineTrace::set_thread_name(vformat("WorkerThread %d", thread_data->index));
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		Task *task_to_process = singleton->_pop_stealable_task(thread_data);
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 			if (singleton->exit_threads) {
 				return;
@@ -195,7 +284,8 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 			if (singleton->task_queue.first()) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
-			} else {
+			} else if (singleton->stealable_task_count.get() == 0) {
+				// Work queues are only pushed to with the task mutex locked, so nothing can be missed here.
 				thread_data->cond_var.wait(lock);
 				DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
 			}
@@ -227,7 +317,13 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+		if (p_high_priority && p_tasks[i]->group) {
+			// Spread group tasks across the work queues, so they can be taken without the task mutex.
+			threads[work_queue_index].work_queue.push(p_tasks[i]);
+			work_queue_index = (work_queue_index + 1) % threads.size();
+			stealable_task_count.increment();
+			to_process++;
+		} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
 			task_queue.add_last(&p_tasks[i]->task_elem);
 			if (!p_high_priority) {
 				low_priority_threads_used++;
@@ -236,6 +332,7 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 		} else {
 			// Too many threads using low priority, must go to queue.
 			low_priority_task_queue.add_last(&p_tasks[i]->task_elem);
+			p_tasks[i]->in_low_priority_queue = true;
 			to_promote++;
 		}
 	}
@@ -271,7 +368,7 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 		}
 		if (th.current_task) {
 			// Good thread for promoting low-prio?
-			if (to_promote && th.awaited_task && th.current_task->low_priority) {
+			if (to_promote && th.awaited_task && th.current_task.load()->low_priority) {
 				if (likely(&th != p_current_thread_data)) {
 					th.cond_var.notify_one();
 				}
@@ -313,6 +410,7 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
 		low_priority_task_queue.remove(low_priority_task_queue.first());
+		low_prio_task->in_low_priority_queue = false;
 		task_queue.add_last(&low_prio_task->task_elem);
 		low_priority_threads_used++;
 		return true;
@@ -321,11 +419,77 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+void WorkerThreadPool::_post_group_tasks_and_unlock(Group *p_group) {
+	Task **group_tasks = (Task **)alloca(sizeof(Task *) * p_group->tasks_used);
+	uint32_t count = 0;
+	for (Task *task = p_group->first_task; task; task = task->next_group_task) {
+		group_tasks[count++] = task;
+	}
+	_post_tasks_and_unlock(group_tasks, count, count > 0 && !group_tasks[0]->low_priority);
+}
+
+bool WorkerThreadPool::_add_dependency(TaskID p_dependency, TaskID p_dependent, Task *p_task, Group *p_group) {
+	// Expected to be called with the task mutex locked. Returns whether the dependency is still pending.
+	// Dependencies can only be older than their dependents, so there can't be cycles.
+	ERR_FAIL_COND_V_MSG(p_dependency < 1 || p_dependency >= p_dependent, false, vformat("Invalid dependency ID %d.", p_dependency));
+
+	Continuations *continuations = nullptr;
+	Task **taskp = tasks.getptr(p_dependency);
+	if (taskp) {
+		if (!(*taskp)->completed) {
+			continuations = &(*taskp)->continuations;
+		}
+	} else {
+		Group **groupp = groups.getptr(p_dependency);
+		if (groupp && !(*groupp)->completed.is_set()) {
+			continuations = &(*groupp)->continuations;
+		}
+	}
+
+	if (!continuations) {
+		// Completed, or already waited for.
+		return false;
+	}
+	if (p_task) {
+		continuations->tasks.push_back(p_task);
+	} else {
+		continuations->groups.push_back(p_group);
+	}
+	return true;
+}
+
+void WorkerThreadPool::_collect_ready_continuations(Continuations &p_continuations, Continuations &r_ready) {
+	// Expected to be called with the task mutex locked.
+	for (Task *task : p_continuations.tasks) {
+		if (--task->pending_dependencies == 0) {
+			r_ready.tasks.push_back(task);
+		}
+	}
+	for (Group *group : p_continuations.groups) {
+		if (--group->pending_dependencies == 0) {
+			r_ready.groups.push_back(group);
+		}
+	}
+	p_continuations.tasks.reset();
+	p_continuations.groups.reset();
+}
+
+void WorkerThreadPool::_post_ready_continuations(Continuations &p_ready) {
+	for (Task *task : p_ready.tasks) {
+		task_mutex.lock();
+		_post_tasks_and_unlock(&task, 1, !task->low_priority);
+	}
+	for (Group *group : p_ready.groups) {
+		task_mutex.lock();
+		_post_group_tasks_and_unlock(group);
+	}
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -336,13 +500,32 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
+	for (const TaskID &dependency : p_dependencies) {
+		if (_add_dependency(dependency, id, task, nullptr)) {
+			task->pending_dependencies++;
+		}
+	}
 	tasks.insert(id, task);
 
-	_post_tasks_and_unlock(&task, 1, p_high_priority);
+	if (task->pending_dependencies) {
+		// Posted by whichever dependency completes last.
+		task_mutex.unlock();
+	} else {
+		_post_tasks_and_unlock(&task, 1, p_high_priority);
+	}
 
 	return id;
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_after(void (*p_func)(void *), void *p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_after(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description) {
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
@@ -361,7 +544,48 @@ bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	return completed;
 }
 
+bool WorkerThreadPool::set_task_priority(TaskID p_task_id, bool p_high_priority) {
+	task_mutex.lock();
+	Task **taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		task_mutex.unlock();
+		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
+	}
+	Task *task = *taskp;
+
+	if (task->pending_dependencies) {
+		// Not posted yet, it will be with the new priority.
+		task->low_priority = !p_high_priority;
+		task_mutex.unlock();
+		return true;
+	}
+	if (!task->task_elem.in_list()) {
+		// Already running or done.
+		task_mutex.unlock();
+		return false;
+	}
+	if (task->low_priority == !p_high_priority) {
+		task_mutex.unlock();
+		return true;
+	}
+
+	task->task_elem.remove_from_list();
+	if (task->in_low_priority_queue) {
+		task->in_low_priority_queue = false;
+	} else if (task->low_priority) {
+		// Give its low priority slot to the next one waiting.
+		low_priority_threads_used--;
+		if (_try_promote_low_priority_task()) {
+			_notify_threads(nullptr, 1, 0);
+		}
+	}
+	_post_tasks_and_unlock(&task, 1, p_high_priority);
+	return true;
+}
+
 Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
+	TRACE_ZONE("WorkerThreadPool::wait_for_task");
+
 	task_mutex.lock();
 	Task **taskp = tasks.getptr(p_task_id);
 	if (!taskp) {
@@ -380,7 +604,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
-	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task->self) {
+	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task.load()->self) {
 		// Deadlock prevention:
 		// When a pool thread wants to wait for an older task, the following situations can happen:
 		// 1. Awaited task is deep in the stack of the awaiter.
@@ -472,8 +696,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (!exit_threads && was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
-					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || stealable_task_count.get()) ? 1 : 0;
+					uint32_t to_promote = p_caller_pool_thread->current_task.load()->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
 						p_caller_pool_thread->signaled = true;
@@ -485,7 +709,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 			}
 
 			if (!exit_threads) {
-				if (p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first()) {
+				if (p_caller_pool_thread->current_task.load()->low_priority && low_priority_task_queue.first()) {
 					if (_try_promote_low_priority_task()) {
 						_notify_threads(p_caller_pool_thread, 1, 0);
 					}
@@ -494,6 +718,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (singleton->task_queue.first()) {
 					task_to_process = task_queue.first()->self();
 					task_queue.remove(task_queue.first());
+				} else {
+					task_to_process = _pop_stealable_task(p_caller_pool_thread);
 				}
 
 				if (!task_to_process) {
@@ -550,7 +776,7 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	task_mutex.unlock();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -584,6 +810,9 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
+			task->next_group_task = group->first_task;
+			group->first_task = task;
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
@@ -591,7 +820,20 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	groups[id] = group;
 
-	_post_tasks_and_unlock(tasks_posted, p_tasks, p_high_priority);
+	if (p_tasks) {
+		for (const TaskID &dependency : p_dependencies) {
+			if (_add_dependency(dependency, id, nullptr, group)) {
+				group->pending_dependencies++;
+			}
+		}
+	}
+
+	if (group->pending_dependencies) {
+		// Posted by whichever dependency completes last.
+		task_mutex.unlock();
+	} else {
+		_post_tasks_and_unlock(tasks_posted, p_tasks, p_high_priority);
+	}
 
 	return id;
 }
@@ -604,6 +846,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_after(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_after(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	task_mutex.lock();
 	const Group *const *groupp = groups.getptr(p_group);
@@ -628,6 +878,8 @@ bool WorkerThreadPool::is_group_task_completed(GroupID p_group) const {
 }
 
 void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
+	TRACE_ZONE("WorkerThreadPool::wait_for_group_task");
+
 #ifdef THREADS_ENABLED
 	task_mutex.lock();
 	Group **groupp = groups.getptr(p_group);
@@ -649,7 +901,7 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 		if (finished_users == max_users) {
 			// All tasks using this group are gone (finished before the group), so clear the group too.
 			task_mutex.lock();
-			group_allocator.free(group);
+			_free_group(group);
 			task_mutex.unlock();
 		}
 	}
@@ -757,7 +1009,10 @@ void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
+	ClassDB::bind_method(D_METHOD("add_task_after", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_after, DEFVAL(false), DEFVAL(String()));
+
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task_after", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task_after, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
@@ -35,6 +35,7 @@
 #include "core/os/memory.h"
 #include "core/os/os.h"
 #include "core/os/semaphore.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
@@ -60,6 +61,14 @@ private:
 		virtual ~BaseTemplateUserdata() {}
 	};
 
+	struct Group;
+
+	// Tasks and groups that can only be posted once a task or group completes.
+	struct Continuations {
+		LocalVector<Task *> tasks;
+		LocalVector<Group *> groups;
+	};
+
 	struct Group {
 		GroupID self = -1;
 		SafeNumeric<uint32_t> index;
@@ -69,6 +78,9 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		Task *first_task = nullptr; // Group tasks are freed together with their group.
+		uint32_t pending_dependencies = 0;
+		Continuations continuations;
 	};
 
 	struct Task {
@@ -81,6 +93,7 @@ private:
 		Semaphore done_semaphore; // For user threads awaiting.
 		bool completed : 1;
 		bool pending_notify_yield_over : 1;
+		bool in_low_priority_queue : 1; // Waiting for a low priority slot, so not counted in low_priority_threads_used.
 		Group *group = nullptr;
 		SelfList<Task> task_elem;
 		uint32_t waiting_pool = 0;
@@ -88,11 +101,15 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		Task *next_group_task = nullptr;
+		uint32_t pending_dependencies = 0;
+		Continuations continuations;
 
 		void free_template_userdata();
 		Task() :
 				completed(false),
 				pending_notify_yield_over(false),
+				in_low_priority_queue(false),
 				task_elem(this) {}
 	};
 
@@ -107,20 +124,33 @@ private:
 
 	BinaryMutex task_mutex;
 
+	// Per-thread queue of high priority group tasks. The owning thread takes
+	// from the back, while idle threads steal from the front, so dispatching
+	// these doesn't need the task mutex.
+	struct WorkStealingQueue {
+		SpinLock lock;
+		LocalVector<Task *> tasks;
+		uint32_t head = 0;
+
+		void push(Task *p_task);
+		Task *pop();
+		Task *steal();
+	};
+
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
 
 		uint32_t index = 0;
 		Thread thread;
-		bool ready_for_scripting : 1;
+		bool ready_for_scripting = false; // Only accessed by the owning thread.
 		bool signaled : 1;
 		bool yield_is_over : 1;
-		Task *current_task = nullptr;
+		std::atomic<Task *> current_task = nullptr; // Written without the task mutex while running stolen tasks.
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		WorkStealingQueue work_queue;
 
 		ThreadData() :
-				ready_for_scripting(false),
 				signaled(false),
 				yield_is_over(false) {}
 	};
@@ -147,14 +177,22 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	uint32_t work_queue_index = 0; // For rotating across threads when distributing group tasks.
+	SafeNumeric<uint32_t> stealable_task_count; // Tasks pushed onto work queues and not yet taken.
 
 	uint64_t last_task = 1;
 
 	static void _thread_function(void *p_user);
 
 	void _process_task(Task *task);
+	Task *_pop_stealable_task(ThreadData *p_thread_data);
+	void _free_group(Group *p_group);
 
 	void _post_tasks_and_unlock(Task **p_tasks, uint32_t p_count, bool p_high_priority);
+	void _post_group_tasks_and_unlock(Group *p_group);
+	bool _add_dependency(TaskID p_dependency, TaskID p_dependent, Task *p_task, Group *p_group);
+	void _collect_ready_continuations(Continuations &p_continuations, Continuations &r_ready);
+	void _post_ready_continuations(Continuations &p_ready);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
@@ -166,8 +204,8 @@ private:
 	static thread_local uintptr_t unlockable_mutexes[MAX_UNLOCKABLE_MUTEXES];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -214,7 +252,21 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Continuations: these are only posted once every task or group in p_dependencies has completed.
+	template <typename C, typename M, typename U>
+	TaskID add_template_task_after(C *p_instance, M p_method, U p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
+	}
+	TaskID add_native_task_after(void (*p_func)(void *), void *p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_after(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
+	bool set_task_priority(TaskID p_task_id, bool p_high_priority);
 	Error wait_for_task_completion(TaskID p_task_id);
 
 	void yield();
@@ -231,6 +283,19 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <typename C, typename M, typename U>
+	GroupID add_template_group_task_after(C *p_instance, M p_method, U p_userdata, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+	}
+	GroupID add_native_group_task_after(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_after(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -35,6 +35,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -44,6 +45,10 @@ void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)) {
 	return p_allocfunc(p_size);
 }
 
+void *operator new(size_t p_size, Memory::Tag p_tag) {
+	return Memory::alloc_static_tagged(p_size, p_tag, false);
+}
+
 #ifdef _MSC_VER
 void operator delete(void *p_mem, const char *p_description) {
 	CRASH_NOW_MSG("Call to placement delete should not happen.");
@@ -56,16 +61,43 @@ void operator delete(void *p_mem, void *(*p_allocfunc)(size_t p_size)) {
 void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_description) {
 	CRASH_NOW_MSG("Call to placement delete should not happen.");
 }
+
+void operator delete(void *p_mem, Memory::Tag p_tag) {
+	CRASH_NOW_MSG("Call to placement delete should not happen.");
+}
 #endif
 
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
+thread_local Memory::Tag Memory::thread_tag = Memory::TAG_DEFAULT;
+
+void Memory::_add_usage(Tag p_tag, uint64_t p_bytes) {
+	uint64_t new_mem_usage = mem_usage.add(p_bytes);
+	max_usage.exchange_if_greater(new_mem_usage);
+	uint64_t new_tag_usage = tag_usage[p_tag].add(p_bytes);
+	tag_max_usage[p_tag].exchange_if_greater(new_tag_usage);
+}
+
+void Memory::_sub_usage(Tag p_tag, uint64_t p_bytes) {
+	mem_usage.sub(p_bytes);
+	tag_usage[p_tag].sub(p_bytes);
+}
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
+#ifdef DEBUG_ENABLED
+	return alloc_static_tagged(p_bytes, thread_tag, p_pad_align);
+#else
+	return alloc_static_tagged(p_bytes, TAG_DEFAULT, p_pad_align);
+#endif
+}
+
+void *Memory::alloc_static_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
 #else
@@ -82,11 +114,12 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
-		*s = p_bytes;
 
 #ifdef DEBUG_ENABLED
-		uint64_t new_mem_usage = mem_usage.add(p_bytes);
-		max_usage.exchange_if_greater(new_mem_usage);
+		*s = p_bytes | (uint64_t(p_tag) << TAG_SHIFT);
+		_add_usage(p_tag, p_bytes);
+#else
+		*s = p_bytes;
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -112,26 +145,31 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
-			max_usage.exchange_if_greater(new_mem_usage);
+		// Resized blocks keep the tag they were allocated with.
+		Tag tag = Tag(*s >> TAG_SHIFT);
+		uint64_t old_bytes = *s & SIZE_MASK;
+		if (p_bytes > old_bytes) {
+			_add_usage(tag, p_bytes - old_bytes);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			_sub_usage(tag, old_bytes - p_bytes);
 		}
+		uint64_t header = p_bytes | (uint64_t(tag) << TAG_SHIFT);
+#else
+		uint64_t header = p_bytes;
 #endif
 
 		if (p_bytes == 0) {
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
+			*s = header;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = header;
 
 			return mem + DATA_OFFSET;
 		}
@@ -162,7 +200,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+		_sub_usage(Tag(*s >> TAG_SHIFT), *s & SIZE_MASK);
 #endif
 
 		free(mem);
@@ -191,6 +229,177 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_tag_mem_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_mem_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	static const char *names[TAG_MAX] = {
+		"default",
+		"rendering",
+		"physics",
+		"script",
+		"resource",
+		"audio",
+		"navigation",
+	};
+	return names[p_tag];
+}
+
+uint8_t *FrameAllocator::arena = nullptr;
+size_t FrameAllocator::arena_size = 0;
+SafeNumeric<size_t> FrameAllocator::arena_offset;
+SafeNumeric<uint64_t> FrameAllocator::arena_allocations;
+uint8_t *FrameAllocator::retired_arena = nullptr;
+size_t FrameAllocator::retired_arena_size = 0;
+SafeNumeric<uint64_t> FrameAllocator::retired_arena_allocations;
+
+void *FrameAllocator::alloc(size_t p_bytes) {
+	const size_t size = HEADER_SIZE + ((p_bytes + ALIGN - 1) & ~(ALIGN - 1));
+
+	uint8_t *mem = nullptr;
+	if (arena) {
+		const size_t offset = arena_offset.postadd(size);
+		if (offset + size <= arena_size) {
+			mem = arena + offset;
+			arena_allocations.increment();
+		}
+	}
+
+	if (!mem) {
+		// Arena exhausted, use the heap instead.
+		mem = (uint8_t *)Memory::alloc_static(size, false);
+		ERR_FAIL_NULL_V(mem, nullptr);
+	}
+
+	*(uint64_t *)mem = p_bytes;
+	return mem + HEADER_SIZE;
+}
+
+void *FrameAllocator::realloc(void *p_memory, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc(p_bytes);
+	}
+
+	if (p_bytes == 0) {
+		free(p_memory);
+		return nullptr;
+	}
+
+	uint8_t *mem = (uint8_t *)p_memory - HEADER_SIZE;
+	const uint64_t old_bytes = *(uint64_t *)mem;
+	if (p_bytes <= old_bytes) {
+		return p_memory;
+	}
+
+	if (!_is_in_arena(mem) && !_is_in_retired_arena(mem)) {
+		mem = (uint8_t *)Memory::realloc_static(mem, HEADER_SIZE + p_bytes, false);
+		ERR_FAIL_NULL_V(mem, nullptr);
+		*(uint64_t *)mem = p_bytes;
+		return mem + HEADER_SIZE;
+	}
+
+	void *new_memory = alloc(p_bytes);
+	ERR_FAIL_NULL_V(new_memory, nullptr);
+	memcpy(new_memory, p_memory, old_bytes);
+	free(p_memory);
+	return new_memory;
+}
+
+void FrameAllocator::free(void *p_ptr) {
+	ERR_FAIL_NULL(p_ptr);
+
+	uint8_t *mem = (uint8_t *)p_ptr - HEADER_SIZE;
+	if (_is_in_arena(mem)) {
+		arena_allocations.decrement();
+	} else if (_is_in_retired_arena(mem)) {
+		retired_arena_allocations.decrement();
+	} else {
+		Memory::free_static(mem, false);
+	}
+}
+
+void FrameAllocator::_free_retired_arena() {
+	Memory::free_static(retired_arena, false);
+	retired_arena = nullptr;
+	retired_arena_size = 0;
+}
+
+void FrameAllocator::reset() {
+	if (retired_arena && retired_arena_allocations.get() == 0) {
+		_free_retired_arena();
+	}
+
+	if (likely(arena_allocations.get() == 0)) {
+		arena_offset.set(0);
+		return;
+	}
+
+	// Rewinding would hand out memory that is still in use, so keep that memory
+	// in a retired arena and continue with a fresh one.
+	if (retired_arena) {
+		// Only one arena can be retired at a time, new allocations use the rest of this one, then the heap.
+		ERR_PRINT_ONCE("Frame allocator memory is still in use at the end of the frame, while memory from an earlier frame is also still in use. The arena can't be rewound until it's freed.");
+		return;
+	}
+
+	ERR_PRINT("Frame allocator memory is still in use at the end of the frame. Memory from FrameAllocator must be freed before the frame ends.");
+	uint8_t *new_arena = (uint8_t *)Memory::alloc_static(arena_size, false);
+	ERR_FAIL_NULL(new_arena);
+
+	retired_arena = arena;
+	retired_arena_size = arena_size;
+	retired_arena_allocations.set(arena_allocations.get());
+
+	arena = new_arena;
+	arena_offset.set(0);
+	arena_allocations.set(0);
+}
+
+void FrameAllocator::initialize(size_t p_arena_size) {
+	ERR_FAIL_COND_MSG(arena != nullptr, "Frame allocator is already initialized.");
+	if (p_arena_size == 0) {
+		return;
+	}
+
+	arena = (uint8_t *)Memory::alloc_static(p_arena_size, false);
+	ERR_FAIL_NULL(arena);
+	arena_size = p_arena_size;
+	arena_offset.set(0);
+}
+
+void FrameAllocator::finalize() {
+	if (retired_arena) {
+		ERR_FAIL_COND_MSG(retired_arena_allocations.get() > 0, "Frame allocator memory leaked at exit.");
+		_free_retired_arena();
+	}
+
+	if (!arena) {
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(arena_allocations.get() > 0, "Frame allocator memory leaked at exit.");
+	Memory::free_static(arena, false);
+	arena = nullptr;
+	arena_size = 0;
+	arena_offset.set(0);
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
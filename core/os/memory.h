@@ -39,9 +39,34 @@
 #include <type_traits>
 
 class Memory {
+public:
+	// Subsystems an allocation can be attributed to, for usage reporting.
+	// Only tracked in debug builds, like the global usage.
+	enum Tag : uint8_t {
+		TAG_DEFAULT,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_SCRIPT,
+		TAG_RESOURCE,
+		TAG_AUDIO,
+		TAG_NAVIGATION,
+		TAG_MAX,
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
+	static thread_local Tag thread_tag;
+
+	// The tag is kept in the top bits of the size stored in the allocation header.
+	static constexpr int TAG_SHIFT = 56;
+	static constexpr uint64_t SIZE_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
+	static void _add_usage(Tag p_tag, uint64_t p_bytes);
+	static void _sub_usage(Tag p_tag, uint64_t p_bytes);
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
@@ -59,24 +84,98 @@ public:
 	static constexpr size_t DATA_OFFSET = ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t) == 0) ? (ELEMENT_OFFSET + sizeof(uint64_t)) : ((ELEMENT_OFFSET + sizeof(uint64_t)) + alignof(max_align_t) - ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t)));
 
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
+	static void *alloc_static_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
 
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static uint64_t get_tag_mem_usage(Tag p_tag);
+	static uint64_t get_tag_mem_max_usage(Tag p_tag);
+	static const char *get_tag_name(Tag p_tag);
+
+	// Allocations made by the calling thread without an explicit tag use this one.
+	// Returns the previous tag. Prefer MemoryTagScope.
+	_FORCE_INLINE_ static Tag set_thread_tag(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+		Tag previous = thread_tag;
+		thread_tag = p_tag;
+		return previous;
+#else
+		return TAG_DEFAULT;
+#endif
+	}
+};
+
+// Attributes the allocations made by the current thread to a tag while in scope.
+class MemoryTagScope {
+#ifdef DEBUG_ENABLED
+	Memory::Tag previous;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) { previous = Memory::set_thread_tag(p_tag); }
+	_FORCE_INLINE_ ~MemoryTagScope() { Memory::set_thread_tag(previous); }
+#else
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {}
+#endif
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_memory, size_t p_bytes) { return Memory::realloc_static(p_memory, p_bytes, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+// Linear allocator for scratch memory that never outlives the current frame.
+// Allocations bump an offset into a preallocated arena, and the whole arena is
+// rewound by the main loop at the end of each iteration, so hot paths can get
+// transient storage without going through malloc/free.
+// If the arena is exhausted (or was never initialized), it falls back to the heap.
+class FrameAllocator {
+	static constexpr size_t ALIGN = alignof(max_align_t);
+	static constexpr size_t HEADER_SIZE = (sizeof(uint64_t) + ALIGN - 1) & ~(ALIGN - 1);
+
+	static uint8_t *arena;
+	static size_t arena_size;
+	static SafeNumeric<size_t> arena_offset;
+	static SafeNumeric<uint64_t> arena_allocations;
+
+	// Arena that still had live allocations when it was reset. It's replaced by a
+	// fresh one and freed once its last allocation is released.
+	static uint8_t *retired_arena;
+	static size_t retired_arena_size;
+	static SafeNumeric<uint64_t> retired_arena_allocations;
+
+	_FORCE_INLINE_ static bool _is_in_arena(const uint8_t *p_mem) { return p_mem >= arena && p_mem < arena + arena_size; }
+	_FORCE_INLINE_ static bool _is_in_retired_arena(const uint8_t *p_mem) { return p_mem >= retired_arena && p_mem < retired_arena + retired_arena_size; }
+	static void _free_retired_arena();
+
+public:
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Must be called when no other thread is allocating from the arena.
+	// Allocations that are still alive are an error. Their arena is retired
+	// instead of rewound, so their memory is never handed out twice.
+	static void reset();
+
+	static void initialize(size_t p_arena_size);
+	static void finalize();
+
+	static size_t get_arena_size() { return arena_size; }
+	static size_t get_arena_usage() { return MIN(arena_offset.get(), arena_size); }
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
 void *operator new(size_t p_size, void *p_pointer, size_t check, const char *p_description); ///< operator new that takes a description and uses a pointer to the preallocated memory
+void *operator new(size_t p_size, Memory::Tag p_tag); ///< operator new that attributes the allocation to a memory tag
 
 #ifdef _MSC_VER
 // When compiling with VC++ 2017, the above declarations of placement new generate many irrelevant warnings (C4291).
@@ -84,11 +183,13 @@ void *operator new(size_t p_size, void *p_pointer, size_t check, const char *p_d
 void operator delete(void *p_mem, const char *p_description);
 void operator delete(void *p_mem, void *(*p_allocfunc)(size_t p_size));
 void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_description);
+void operator delete(void *p_mem, Memory::Tag p_tag);
 #endif
 
 #define memalloc(m_size) Memory::alloc_static(m_size)
 #define memrealloc(m_mem, m_size) Memory::realloc_static(m_mem, m_size)
 #define memfree(m_mem) Memory::free_static(m_mem)
+#define memalloc_tagged(m_size, m_tag) Memory::alloc_static_tagged(m_size, m_tag)
 
 _ALWAYS_INLINE_ void postinitialize_handler(void *) {}
 
@@ -99,6 +200,7 @@ _ALWAYS_INLINE_ T *_post_initialize(T *p_obj) {
 }
 
 #define memnew(m_class) _post_initialize(new ("") m_class)
+#define memnew_tagged(m_class, m_tag) _post_initialize(new (m_tag) m_class)
 
 #define memnew_allocator(m_class, m_allocator) _post_initialize(new (m_allocator::alloc) m_class)
 #define memnew_placement(m_placement, m_class) _post_initialize(new (m_placement) m_class)
@@ -36,6 +36,7 @@
 #include "core/io/file_access.h"
 #include "core/io/json.h"
 #include "core/os/midi_driver.h"
+#include "core/os/thread.h"
 #include "core/version_generated.gen.h"
 
 #include <stdarg.h>
@@ -579,6 +580,13 @@ void OS::close_midi_inputs() {
 	}
 }
 
+void OS::delay_until_ticks_usec(uint64_t p_ticks_usec) const {
+	const uint64_t ticks = get_ticks_usec();
+	if (ticks < p_ticks_usec) {
+		delay_usec(MIN(p_ticks_usec - ticks, (uint64_t)UINT32_MAX));
+	}
+}
+
 void OS::add_frame_delay(bool p_can_draw) {
 	const uint32_t frame_delay = Engine::get_singleton()->get_frame_delay();
 	if (frame_delay) {
@@ -644,7 +652,90 @@ String OS::get_benchmark_file() {
 	return benchmark_file;
 }
 
+void OS::set_startup_trace_file(const String &p_startup_trace_file) {
+	startup_trace_file = p_startup_trace_file;
+}
+
+String OS::get_startup_trace_file() {
+	return startup_trace_file;
+}
+
+void OS::_startup_trace_begin(const String &p_context, const String &p_what) {
+	MutexLock lock(startup_trace_mutex);
+	if (!startup_trace_recording) {
+		return;
+	}
+
+	StartupTraceEvent event;
+	event.context = p_context;
+	event.what = p_what;
+	event.thread_id = Thread::get_caller_id();
+	event.begin = get_ticks_usec();
+	startup_trace_events.push_back(event);
+}
+
+void OS::_startup_trace_end(const String &p_context, const String &p_what) {
+	uint64_t end = get_ticks_usec();
+
+	MutexLock lock(startup_trace_mutex);
+	if (!startup_trace_recording) {
+		return;
+	}
+
+	// The matching measure is usually the most recent one.
+	for (int64_t i = int64_t(startup_trace_events.size()) - 1; i >= 0; i--) {
+		StartupTraceEvent &event = startup_trace_events[i];
+		if (event.end == 0 && event.what == p_what && event.context == p_context) {
+			event.end = end;
+			return;
+		}
+	}
+}
+
+void OS::_startup_trace_dump() {
+	MutexLock lock(startup_trace_mutex);
+	if (!startup_trace_recording) {
+		return;
+	}
+	startup_trace_recording = false;
+
+	if (!startup_trace_file.is_empty()) {
+		// See the Trace Event Format, complete events ("X") nest by their time span.
+		Array trace_events;
+		int pid = get_process_id();
+		for (const StartupTraceEvent &E : startup_trace_events) {
+			if (E.end == 0) {
+				continue; // Not finished before the dump.
+			}
+			Dictionary event;
+			event["name"] = E.what;
+			event["cat"] = E.context;
+			event["ph"] = "X";
+			event["ts"] = E.begin;
+			event["dur"] = E.end - E.begin;
+			event["pid"] = pid;
+			event["tid"] = E.thread_id;
+			trace_events.push_back(event);
+		}
+
+		Dictionary trace;
+		trace["traceEvents"] = trace_events;
+		trace["displayTimeUnit"] = "ms";
+
+		Ref<FileAccess> f = FileAccess::open(startup_trace_file, FileAccess::WRITE);
+		if (f.is_valid()) {
+			f->store_string(JSON::stringify(trace, "", false));
+		} else {
+			ERR_PRINT("Cannot write the startup trace to '" + startup_trace_file + "'.");
+		}
+	}
+
+	startup_trace_events.reset();
+}
+
 void OS::benchmark_begin_measure(const String &p_context, const String &p_what) {
+	_startup_trace_begin(p_context, p_what);
+
 #ifdef TOOLS_ENABLED
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' already exists.", p_context, p_what));
@@ -653,6 +744,8 @@ void OS::benchmark_begin_measure(const String &p_context, const String &p_what)
 #endif
 }
 void OS::benchmark_end_measure(const String &p_context, const String &p_what) {
+	_startup_trace_end(p_context, p_what);
+
 #ifdef TOOLS_ENABLED
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(!benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' doesn't exist.", p_context, p_what));
@@ -664,6 +757,8 @@ void OS::benchmark_end_measure(const String &p_context, const String &p_what) {
 }
 
 void OS::benchmark_dump() {
+	_startup_trace_dump();
+
 #ifdef TOOLS_ENABLED
 	if (!use_benchmark) {
 		return;
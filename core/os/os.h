@@ -35,9 +35,11 @@
 #include "core/io/image.h"
 #include "core/io/logger.h"
 #include "core/io/remote_filesystem_client.h"
+#include "core/os/mutex.h"
 #include "core/os/time_enums.h"
 #include "core/string/ustring.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 
 #include <stdarg.h>
@@ -84,9 +86,27 @@ class OS {
 	HashMap<Pair<String, String>, uint64_t, PairHash<String, String>> benchmark_marks_from;
 	HashMap<Pair<String, String>, double, PairHash<String, String>> benchmark_marks_final;
 
+	// For tracing the startup phases. Benchmark measures are recorded in all builds
+	// until the first dump, and written to the trace file if one was set.
+	struct StartupTraceEvent {
+		String context;
+		String what;
+		uint64_t thread_id = 0;
+		uint64_t begin = 0;
+		uint64_t end = 0;
+	};
+	bool startup_trace_recording = true;
+	String startup_trace_file;
+	LocalVector<StartupTraceEvent> startup_trace_events;
+	BinaryMutex startup_trace_mutex;
+
 protected:
 	void _set_logger(CompositeLogger *p_logger);
 
+	void _startup_trace_begin(const String &p_context, const String &p_what);
+	void _startup_trace_end(const String &p_context, const String &p_what);
+	void _startup_trace_dump();
+
 public:
 	typedef void (*ImeCallback)(void *p_inp, const String &p_text, Point2 p_selection);
 	typedef bool (*HasServerFeatureCallback)(const String &p_feature);
@@ -235,6 +255,7 @@ public:
 	virtual double get_unix_time() const;
 
 	virtual void delay_usec(uint32_t p_usec) const = 0;
+	virtual void delay_until_ticks_usec(uint64_t p_ticks_usec) const;
 	virtual void add_frame_delay(bool p_can_draw);
 
 	virtual uint64_t get_ticks_usec() const = 0;
@@ -328,6 +349,10 @@ public:
 	virtual void benchmark_end_measure(const String &p_context, const String &p_what);
 	virtual void benchmark_dump();
 
+	// Writes the startup phases measured by the benchmark functions as a Chrome trace, available in all builds.
+	void set_startup_trace_file(const String &p_startup_trace_file);
+	String get_startup_trace_file();
+
 	virtual Error setup_remote_filesystem(const String &p_server_host, int p_port, const String &p_password, String &r_project_path);
 
 	enum PreferredTextureFormat {
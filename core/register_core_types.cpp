@@ -42,6 +42,7 @@
 #include "core/input/input.h"
 #include "core/input/input_map.h"
 #include "core/input/shortcut.h"
+#include "core/io/compression.h"
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/dtls_server.h"
@@ -50,6 +51,7 @@
 #include "core/io/json.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
+#include "core/io/packed_byte_array_slice.h"
 #include "core/io/packed_data_container.h"
 #include "core/io/packet_peer.h"
 #include "core/io/packet_peer_dtls.h"
@@ -73,6 +75,7 @@
 #include "core/math/triangle_mesh.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language_extension.h"
+#include "core/object/task_graph.h"
 #include "core/object/undo_redo.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/main_loop.h"
@@ -193,6 +196,7 @@ void register_core_types() {
 	GDREGISTER_ABSTRACT_CLASS(StreamPeer);
 	GDREGISTER_CLASS(StreamPeerExtension);
 	GDREGISTER_CLASS(StreamPeerBuffer);
+	GDREGISTER_CLASS(PackedByteArraySlice);
 	GDREGISTER_CLASS(StreamPeerGZIP);
 	GDREGISTER_CLASS(StreamPeerTCP);
 	GDREGISTER_CLASS(TCPServer);
@@ -204,6 +208,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(UDPServer);
 
 	GDREGISTER_ABSTRACT_CLASS(WorkerThreadPool);
+	GDREGISTER_CLASS(TaskGraph);
 
 	ClassDB::register_custom_instance_class<HTTPClient>();
 
@@ -435,6 +440,7 @@ void unregister_core_types() {
 	resource_loader_gdextension.unref();
 
 	ResourceLoader::finalize();
+	Compression::clear_zstd_dictionaries();
 
 	ClassDB::cleanup_defaults();
 	memdelete(_time);
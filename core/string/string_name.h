@@ -48,7 +48,12 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// The table is split into shards, each guarded by its own lock,
+		// so threads interning unrelated names don't contend with each other.
+		TABLE_SHARD_BITS = 6,
+		TABLE_SHARD_LEN = 1 << TABLE_SHARD_BITS,
+		TABLE_SHARD_MASK = TABLE_SHARD_LEN - 1
 	};
 
 	struct _Data {
@@ -60,6 +65,10 @@ class StringName {
 		uint32_t debug_references = 0;
 #endif
 		String get_name() const { return cname ? String(cname) : name; }
+		// Compare without building a String out of static names.
+		bool name_equals(const char *p_name) const;
+		bool name_equals(const char32_t *p_name) const;
+		bool name_equals(const String &p_name) const;
 		int idx = 0;
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
@@ -75,6 +84,12 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
+	struct alignas(64) TableShard {
+		Mutex mutex;
+	};
+	static TableShard table_shards[TABLE_SHARD_LEN];
+	_FORCE_INLINE_ static Mutex &_get_table_mutex(uint32_t p_idx) { return table_shards[p_idx & TABLE_SHARD_MASK].mutex; }
+
 	static Mutex mutex;
 	static void setup();
 	static void cleanup();
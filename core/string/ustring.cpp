@@ -482,8 +482,25 @@ void String::operator=(const wchar_t *p_str) {
 }
 
 String String::operator+(const String &p_str) const {
-	String res = *this;
-	res += p_str;
+	const int lhs_len = length();
+	if (lhs_len == 0) {
+		return p_str;
+	}
+
+	const int rhs_len = p_str.length();
+	if (rhs_len == 0) {
+		return *this;
+	}
+
+	// Build the result with a single allocation, without touching the refcount of either operand.
+	String res;
+	res.resize(lhs_len + rhs_len + 1);
+
+	char32_t *dst = res.ptrw();
+	memcpy(dst, ptr(), lhs_len * sizeof(char32_t));
+	memcpy(dst + lhs_len, p_str.ptr(), rhs_len * sizeof(char32_t));
+	dst[lhs_len + rhs_len] = _null;
+
 	return res;
 }
 
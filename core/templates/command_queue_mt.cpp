@@ -41,9 +41,44 @@ void CommandQueueMT::unlock() {
 	mutex.unlock();
 }
 
+void CommandQueueMT::begin_batch(uint32_t p_reserve_bytes) {
+	Thread::ID caller_id = Thread::get_caller_id();
+	Thread::ID expected = Thread::UNASSIGNED_ID;
+	if (!batch_thread_id.compare_exchange_strong(expected, caller_id, std::memory_order_acq_rel) && expected != caller_id) {
+		// Another thread owns the batch; this one keeps pushing through the mutex.
+		return;
+	}
+	if (batch_depth++ == 0 && p_reserve_bytes > batch_mem.size()) {
+		batch_mem.reserve(p_reserve_bytes);
+	}
+}
+
+void CommandQueueMT::commit_batch() {
+	if (!_is_batching_thread() || batch_mem.is_empty()) {
+		return;
+	}
+	lock();
+	_append_batch();
+	_notify_pump();
+	unlock();
+}
+
+void CommandQueueMT::end_batch() {
+	if (!_is_batching_thread()) {
+		return;
+	}
+	ERR_FAIL_COND(batch_depth == 0);
+	if (--batch_depth > 0) {
+		return;
+	}
+	commit_batch();
+	batch_thread_id.store(Thread::UNASSIGNED_ID, std::memory_order_release);
+}
+
 CommandQueueMT::CommandQueueMT() {
 	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
 }
 
 CommandQueueMT::~CommandQueueMT() {
+	ERR_FAIL_COND_MSG(batch_depth > 0, "CommandQueueMT destroyed with an open batch, its commands are lost.");
 }
@@ -35,6 +35,7 @@
 #include "core/os/condition_variable.h"
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
@@ -251,13 +252,18 @@
 #define DECL_PUSH(N)                                                            \
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>    \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) {    \
-		MutexLock mlock(mutex);                                                 \
-		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>();                             \
+		const bool batched = _is_batching_thread();                             \
+		if (!batched) {                                                         \
+			lock();                                                             \
+		}                                                                       \
+		LocalVector<uint8_t> &mem = batched ? batch_mem : command_mem;          \
+		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>(mem);                          \
 		cmd->instance = p_instance;                                             \
 		cmd->method = p_method;                                                 \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                    \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id); \
+		if (!batched) {                                                         \
+			_notify_pump();                                                     \
+			unlock();                                                           \
 		}                                                                       \
 	}
 
@@ -267,14 +273,13 @@
 	template <typename T, typename M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) typename R>       \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
 		MutexLock mlock(mutex);                                                                \
-		CMD_RET_TYPE(N) *cmd = allocate<CMD_RET_TYPE(N)>();                                    \
+		_append_batch_if_batching();                                                           \
+		CMD_RET_TYPE(N) *cmd = allocate<CMD_RET_TYPE(N)>(command_mem);                         \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                               \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);                \
-		}                                                                                      \
+		_notify_pump();                                                                        \
 		sync_tail++;                                                                           \
 		_wait_for_sync(mlock);                                                                 \
 	}
@@ -285,13 +290,12 @@
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>          \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
 		MutexLock mlock(mutex);                                                       \
-		CMD_SYNC_TYPE(N) *cmd = allocate<CMD_SYNC_TYPE(N)>();                         \
+		_append_batch_if_batching();                                                  \
+		CMD_SYNC_TYPE(N) *cmd = allocate<CMD_SYNC_TYPE(N)>(command_mem);              \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                      \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);       \
-		}                                                                             \
+		_notify_pump();                                                               \
 		sync_tail++;                                                                  \
 		_wait_for_sync(mlock);                                                        \
 	}
@@ -336,17 +340,53 @@ class CommandQueueMT {
 	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	uint64_t flush_read_ptr = 0;
 
+	// Commands pushed by the thread that owns the open batch are written here,
+	// without taking the mutex, and moved to command_mem when the batch is committed.
+	LocalVector<uint8_t> batch_mem;
+	std::atomic<Thread::ID> batch_thread_id = Thread::UNASSIGNED_ID;
+	uint32_t batch_depth = 0;
+
 	template <typename T>
-	T *allocate() {
+	T *allocate(LocalVector<uint8_t> &p_mem) {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		uint64_t size = p_mem.size();
+		p_mem.resize(size + alloc_size + 8);
+		*(uint64_t *)&p_mem[size] = alloc_size;
+		T *cmd = memnew_placement(&p_mem[size + 8], T);
 		return cmd;
 	}
 
+	_FORCE_INLINE_ bool _is_batching_thread() const {
+		// Only the batching thread can store its own ID, so a relaxed load is enough for it to recognize itself.
+		return unlikely(batch_thread_id.load(std::memory_order_relaxed) == Thread::get_caller_id());
+	}
+
+	_FORCE_INLINE_ void _notify_pump() {
+		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		}
+	}
+
+	// Must be called with the mutex held, from the batching thread.
+	void _append_batch() {
+		uint32_t batch_size = batch_mem.size();
+		if (batch_size == 0) {
+			return;
+		}
+		// Commands are relocated bitwise, the same way command_mem itself is when it grows.
+		uint32_t size = command_mem.size();
+		command_mem.resize(size + batch_size);
+		memcpy(&command_mem[size], batch_mem.ptr(), batch_size);
+		batch_mem.clear();
+	}
+
+	_FORCE_INLINE_ void _append_batch_if_batching() {
+		if (_is_batching_thread()) {
+			_append_batch();
+		}
+	}
+
 	_FORCE_INLINE_ void _prevent_sync_wraparound() {
 		bool safe_to_reset = !sync_awaiters;
 		bool already_sync_to_latest = sync_head == sync_tail;
@@ -364,6 +404,9 @@ class CommandQueueMT {
 
 		lock();
 
+		// Keep the order of the batching thread's commands when it flushes its own queue.
+		_append_batch_if_batching();
+
 		uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(&mutex);
 		while (flush_read_ptr < command_mem.size()) {
 			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
@@ -426,7 +469,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem.size() > 0 || (_is_batching_thread() && batch_mem.size() > 0))) {
 			_flush();
 		}
 	}
@@ -439,6 +482,16 @@ public:
 		push_and_sync(this, &CommandQueueMT::_no_op);
 	}
 
+	// Batching lets a single producer record many commands without locking or
+	// waking the consumer for each of them. Sync and return commands pushed from
+	// the batching thread publish what was recorded before them, so order is kept.
+	// Batches nest; only one thread can batch at a time, pushes from any other
+	// thread take the regular path.
+	void begin_batch(uint32_t p_reserve_bytes = 0);
+	void commit_batch();
+	void end_batch();
+	_FORCE_INLINE_ bool is_batching() const { return _is_batching_thread(); }
+
 	void wait_and_flush() {
 		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
 		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
@@ -164,6 +164,8 @@ private:
 	void _ref(const CowData *p_from);
 	void _ref(const CowData &p_from);
 	USize _copy_on_write();
+	template <bool p_ensure_zero>
+	Error _resize_shared(Size p_size);
 
 public:
 	void operator=(const CowData<T> &p_from) { _ref(p_from); }
@@ -326,6 +328,12 @@ Error CowData<T>::resize(Size p_size) {
 		return OK;
 	}
 
+	if (unlikely(_ptr && _get_refcount()->get() > 1)) {
+		// Shared, so a copy is needed anyway. Make it at the requested size
+		// instead of copying everything and then reallocating the copy.
+		return _resize_shared<p_ensure_zero>(p_size);
+	}
+
 	// possibly changing size, copy on write
 	USize rc = _copy_on_write();
 
@@ -401,6 +409,49 @@ Error CowData<T>::resize(Size p_size) {
 	return OK;
 }
 
+template <typename T>
+template <bool p_ensure_zero>
+Error CowData<T>::_resize_shared(Size p_size) {
+	const USize current_size = *_get_size();
+
+	USize alloc_size;
+	ERR_FAIL_COND_V(!_get_alloc_size_checked(p_size, &alloc_size), ERR_OUT_OF_MEMORY);
+
+	uint8_t *mem_new = (uint8_t *)Memory::alloc_static(alloc_size + DATA_OFFSET, false);
+	ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
+
+	SafeNumeric<USize> *_refc_ptr = _get_refcount_ptr(mem_new);
+	USize *_size_ptr = _get_size_ptr(mem_new);
+	T *_data_ptr = _get_data_ptr(mem_new);
+
+	new (_refc_ptr) SafeNumeric<USize>(1); //refcount
+	*(_size_ptr) = p_size; //size
+
+	// copy the elements that are kept
+	const USize copy_size = MIN(current_size, (USize)p_size);
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		memcpy((uint8_t *)_data_ptr, _ptr, copy_size * sizeof(T));
+	} else {
+		for (USize i = 0; i < copy_size; i++) {
+			memnew_placement(&_data_ptr[i], T(_ptr[i]));
+		}
+	}
+
+	// construct the newly created elements
+	if constexpr (!std::is_trivially_constructible_v<T>) {
+		for (USize i = copy_size; i < (USize)p_size; i++) {
+			memnew_placement(&_data_ptr[i], T);
+		}
+	} else if (p_ensure_zero) {
+		memset((void *)(_data_ptr + copy_size), 0, (p_size - copy_size) * sizeof(T));
+	}
+
+	_unref(_ptr);
+	_ptr = _data_ptr;
+
+	return OK;
+}
+
 template <typename T>
 typename CowData<T>::Size CowData<T>::find(const T &p_val, Size p_from) const {
 	Size ret = -1;
@@ -0,0 +1,538 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * An insertion ordered hash map with a compact layout, in the style of the
+ * CPython dict.
+ *
+ * Entries are appended to a dense array in insertion order, and are found
+ * through a separate open addressing table that only stores 32-bit indices
+ * into that array. Iterating walks the dense array linearly, and no allocation
+ * is made per element.
+ *
+ * The dense array is split into pages that double in size, so entries never
+ * move when the map grows: like with HashMap, pointers to keys and values stay
+ * valid when other keys are inserted. Erasing leaves a hole that iteration
+ * skips, and never moves other entries, so it is safe while iterating or
+ * while holding pointers to them. Once holes outnumber the remaining entries,
+ * the next insertion of a new key compacts the array first, which moves
+ * entries and invalidates pointers to them.
+ *
+ * The assignment operator copies the pairs from one map to the other.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static constexpr uint32_t MIN_INDEX_CAPACITY = 8; // Must be a power of 2.
+
+private:
+	static constexpr uint32_t EMPTY_INDEX = UINT32_MAX;
+	static constexpr uint32_t FIRST_PAGE_SHIFT = 2; // The first two pages hold 4 entries each.
+	static constexpr uint32_t MAX_PAGES = 32 - FIRST_PAGE_SHIFT;
+
+	struct Entry {
+		KeyValue<TKey, TValue> data;
+		uint32_t hash = EMPTY_HASH; // EMPTY_HASH marks an erased entry, whose data was destroyed.
+
+		Entry(const TKey &p_key, const TValue &p_value, uint32_t p_hash) :
+				data(p_key, p_value), hash(p_hash) {}
+	};
+
+	Entry **pages = nullptr;
+	uint32_t *indices = nullptr;
+	uint32_t page_count = 0;
+	uint32_t index_capacity = 0;
+	uint32_t index_shift = 0;
+	uint32_t used = 0; // Entries in the dense array, including erased ones.
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_page(uint32_t p_index) {
+		uint32_t q = p_index >> FIRST_PAGE_SHIFT;
+		if (q == 0) {
+			return 0;
+		}
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long msb;
+		_BitScanReverse(&msb, q);
+		return uint32_t(msb) + 1;
+#else
+		return 32 - uint32_t(__builtin_clz(q));
+#endif
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_page_start(uint32_t p_page) {
+		return p_page == 0 ? 0 : (1u << (FIRST_PAGE_SHIFT + p_page - 1));
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_page_size(uint32_t p_page) {
+		return p_page == 0 ? (1u << FIRST_PAGE_SHIFT) : (1u << (FIRST_PAGE_SHIFT + p_page - 1));
+	}
+
+	// Fibonacci hashing, so weak hashes still spread over the power of 2 sized table.
+	_FORCE_INLINE_ uint32_t _get_home(uint32_t p_hash) const {
+		return (p_hash * 2654435769u) >> index_shift;
+	}
+
+	_FORCE_INLINE_ Entry *_get_entry(uint32_t p_index) const {
+		uint32_t page = _get_page(p_index);
+		return pages[page] + (p_index - _get_page_start(page));
+	}
+
+	// Returns the table slot of the key, or EMPTY_INDEX.
+	uint32_t _lookup_slot(const TKey &p_key, uint32_t p_hash) const {
+		if (unlikely(indices == nullptr)) {
+			return EMPTY_INDEX;
+		}
+
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = _get_home(p_hash);
+
+		while (true) {
+			uint32_t index = indices[pos];
+			if (index == EMPTY_INDEX) {
+				return EMPTY_INDEX;
+			}
+			const Entry *entry = _get_entry(index);
+			if (entry->hash == p_hash && Comparator::compare(entry->data.key, p_key)) {
+				return pos;
+			}
+			pos = (pos + 1) & mask;
+		}
+	}
+
+	// Returns the position of the key in the dense array, or EMPTY_INDEX.
+	_FORCE_INLINE_ uint32_t _lookup(const TKey &p_key, uint32_t p_hash) const {
+		uint32_t pos = _lookup_slot(p_key, p_hash);
+		return pos == EMPTY_INDEX ? EMPTY_INDEX : indices[pos];
+	}
+
+	// Backward shift deletion, so the table never holds stale slots.
+	void _remove_slot(uint32_t p_pos) {
+		const uint32_t mask = index_capacity - 1;
+		uint32_t hole = p_pos;
+		uint32_t pos = p_pos;
+		while (true) {
+			pos = (pos + 1) & mask;
+			uint32_t index = indices[pos];
+			if (index == EMPTY_INDEX) {
+				break;
+			}
+			uint32_t home = _get_home(_get_entry(index)->hash);
+			// Move the slot back unless its home lies cyclically in (hole, pos].
+			bool stays = hole <= pos ? (home > hole && home <= pos) : (home > hole || home <= pos);
+			if (!stays) {
+				indices[hole] = index;
+				hole = pos;
+			}
+		}
+		indices[hole] = EMPTY_INDEX;
+	}
+
+	_FORCE_INLINE_ void _place_index(uint32_t p_index, uint32_t p_hash) {
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = _get_home(p_hash);
+		while (indices[pos] != EMPTY_INDEX) {
+			pos = (pos + 1) & mask;
+		}
+		indices[pos] = p_index;
+	}
+
+	void _rebuild_indices(uint32_t p_capacity) {
+		if (p_capacity != index_capacity) {
+			if (indices) {
+				Memory::free_static(indices);
+			}
+			indices = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * p_capacity));
+			index_capacity = p_capacity;
+			index_shift = 32;
+			while ((1u << (32 - index_shift)) < p_capacity) {
+				index_shift--;
+			}
+		}
+		memset(indices, 0xFF, sizeof(uint32_t) * index_capacity);
+
+		for (uint32_t i = 0; i < used; i++) {
+			const Entry *entry = _get_entry(i);
+			if (entry->hash != EMPTY_HASH) {
+				_place_index(i, entry->hash);
+			}
+		}
+	}
+
+	// Keeps the table at most 3/4 full, counting holes in the dense array.
+	_FORCE_INLINE_ void _reserve_indices(uint32_t p_entries) {
+		if (p_entries * 4 <= index_capacity * 3) {
+			return;
+		}
+		uint32_t capacity = MAX(index_capacity, MIN_INDEX_CAPACITY);
+		while (p_entries * 4 > capacity * 3) {
+			capacity <<= 1;
+		}
+		_rebuild_indices(capacity);
+	}
+
+	uint32_t _insert_new(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(used - num_elements > num_elements)) {
+			_compact(); // Rather than growing the table for holes.
+		}
+		_reserve_indices(used + 1);
+
+		uint32_t page = _get_page(used);
+		if (page == page_count) {
+			CRASH_COND_MSG(page >= MAX_PAGES, "OrderedHashMap can't hold more elements.");
+			pages = reinterpret_cast<Entry **>(Memory::realloc_static(pages, sizeof(Entry *) * (page_count + 1)));
+			pages[page] = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * _get_page_size(page)));
+			page_count++;
+		}
+
+		uint32_t index = used;
+		memnew_placement(_get_entry(index), Entry(p_key, p_value, p_hash));
+		_place_index(index, p_hash);
+		used++;
+		num_elements++;
+		return index;
+	}
+
+	void _compact() {
+		uint32_t write = 0;
+		for (uint32_t read = 0; read < used; read++) {
+			Entry *entry = _get_entry(read);
+			if (entry->hash == EMPTY_HASH) {
+				continue;
+			}
+			if (write != read) {
+				memnew_placement(_get_entry(write), Entry(entry->data.key, entry->data.value, entry->hash));
+				entry->data.~KeyValue();
+				entry->hash = EMPTY_HASH;
+			}
+			write++;
+		}
+		used = write;
+		_rebuild_indices(index_capacity);
+	}
+
+	void _destroy_entries() {
+		for (uint32_t i = 0; i < used; i++) {
+			Entry *entry = _get_entry(i);
+			if (entry->hash != EMPTY_HASH) {
+				entry->data.~KeyValue();
+			}
+		}
+		used = 0;
+		num_elements = 0;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_valid(uint32_t p_index) const {
+		while (p_index < used && _get_entry(p_index)->hash == EMPTY_HASH) {
+			p_index++;
+		}
+		return p_index;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ bool is_empty() const { return num_elements == 0; }
+
+	void clear() {
+		if (used == 0) {
+			return;
+		}
+		_destroy_entries();
+		memset(indices, 0xFF, sizeof(uint32_t) * index_capacity);
+	}
+
+	void reserve(uint32_t p_new_capacity) {
+		_reserve_indices(p_new_capacity);
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == EMPTY_INDEX, "OrderedHashMap key not found.");
+		return _get_entry(index)->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == EMPTY_INDEX, "OrderedHashMap key not found.");
+		return _get_entry(index)->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		return index == EMPTY_INDEX ? nullptr : &_get_entry(index)->data.value;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		return index == EMPTY_INDEX ? nullptr : &_get_entry(index)->data.value;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup(p_key, _hash(p_key)) != EMPTY_INDEX;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = _lookup_slot(p_key, _hash(p_key));
+		if (pos == EMPTY_INDEX) {
+			return false;
+		}
+
+		Entry *entry = _get_entry(indices[pos]);
+		_remove_slot(pos);
+		entry->data.~KeyValue();
+		entry->hash = EMPTY_HASH;
+		num_elements--;
+
+		// Holes are compacted away on a later insertion, see _insert_new().
+		return true;
+	}
+
+	// Changes the key of an element without moving it in the iteration order.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (Comparator::compare(p_old_key, p_new_key)) {
+			return true;
+		}
+		uint32_t new_hash = _hash(p_new_key);
+		ERR_FAIL_COND_V(_lookup_slot(p_new_key, new_hash) != EMPTY_INDEX, false);
+		uint32_t pos = _lookup_slot(p_old_key, _hash(p_old_key));
+		ERR_FAIL_COND_V(pos == EMPTY_INDEX, false);
+
+		uint32_t index = indices[pos];
+		_remove_slot(pos);
+		Entry *entry = _get_entry(index);
+		const_cast<TKey &>(entry->data.key) = p_new_key;
+		entry->hash = new_hash;
+		_place_index(index, new_hash);
+		return true;
+	}
+
+	// Returns the pair at the given position in insertion order.
+	// Constant time, unless elements were erased since the last compaction.
+	const KeyValue<TKey, TValue> *get_at_index(uint32_t p_index) const {
+		if (p_index >= num_elements) {
+			return nullptr;
+		}
+		if (used == num_elements) {
+			return &_get_entry(p_index)->data;
+		}
+		uint32_t index = _next_valid(0);
+		for (uint32_t i = 0; i < p_index; i++) {
+			index = _next_valid(index + 1);
+		}
+		return &_get_entry(index)->data;
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_entry(index)->data;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const {
+			return &map->_get_entry(index)->data;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			index = map->_next_valid(index + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->used;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const OrderedHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const OrderedHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_entry(index)->data;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const {
+			return &map->_get_entry(index)->data;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			index = map->_next_valid(index + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->used;
+		}
+
+		_FORCE_INLINE_ operator ConstIterator() const {
+			return ConstIterator(map, index);
+		}
+
+		_FORCE_INLINE_ Iterator(OrderedHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		OrderedHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_valid(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, used);
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_valid(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, used);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		return Iterator(this, index == EMPTY_INDEX ? used : index);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t index = _lookup(p_key, _hash(p_key));
+		return ConstIterator(this, index == EMPTY_INDEX ? used : index);
+	}
+
+	void remove(const ConstIterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t hash = _hash(p_key);
+		uint32_t index = _lookup(p_key, hash);
+		if (index == EMPTY_INDEX) {
+			index = _insert_new(p_key, p_value, hash);
+		} else {
+			_get_entry(index)->data.value = p_value;
+		}
+		return Iterator(this, index);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		return get(p_key);
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t hash = _hash(p_key);
+		uint32_t index = _lookup(p_key, hash);
+		if (index == EMPTY_INDEX) {
+			index = _insert_new(p_key, TValue(), hash);
+		}
+		return _get_entry(index)->data.value;
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		reserve(p_other.size());
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert_new(E.key, E.value, _hash(E.key));
+		}
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		clear();
+		reserve(p_other.size());
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert_new(E.key, E.value, _hash(E.key));
+		}
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {}
+
+	~OrderedHashMap() {
+		_destroy_entries();
+		for (uint32_t i = 0; i < page_count; i++) {
+			Memory::free_static(pages[i]);
+		}
+		if (pages) {
+			Memory::free_static(pages);
+		}
+		if (indices) {
+			Memory::free_static(indices);
+		}
+	}
+};
+
+#endif // ORDERED_HASH_MAP_H
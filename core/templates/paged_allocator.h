@@ -34,6 +34,7 @@
 #include "core/core_globals.h"
 #include "core/os/memory.h"
 #include "core/os/spin_lock.h"
+#include "core/os/thread.h"
 #include "core/string/ustring.h"
 #include "core/typedefs.h"
 
@@ -52,12 +53,26 @@ class PagedAllocator {
 	uint32_t page_size = 0;
 	SpinLock spin_lock;
 
-public:
-	template <typename... Args>
-	T *alloc(Args &&...p_args) {
-		if (thread_safe) {
-			spin_lock.lock();
-		}
+	// Optional per-thread magazines, so threads that allocate and free many
+	// objects only touch the shared pool (and its lock) once per batch.
+	// Each thread maps to one of THREAD_CACHE_SLOTS caches by its ID.
+	static constexpr uint32_t THREAD_CACHE_SLOTS = 16;
+	static constexpr uint32_t THREAD_CACHE_SIZE = 32;
+	static constexpr uint32_t THREAD_CACHE_BATCH = THREAD_CACHE_SIZE / 2;
+
+	struct ThreadCache {
+		SpinLock lock;
+		uint32_t count = 0;
+		T *items[THREAD_CACHE_SIZE];
+	};
+	ThreadCache *thread_caches = nullptr;
+
+	_FORCE_INLINE_ ThreadCache &_get_thread_cache() const {
+		return thread_caches[Thread::get_caller_id() & (THREAD_CACHE_SLOTS - 1)];
+	}
+
+	// Shared pool access, the spin lock must be held if thread safe.
+	T *_pop_available() {
 		if (unlikely(allocs_available == 0)) {
 			uint32_t pages_used = pages_allocated;
 
@@ -75,26 +90,115 @@ public:
 		}
 
 		allocs_available--;
-		T *alloc = available_pool[allocs_available >> page_shift][allocs_available & page_mask];
-		if (thread_safe) {
+		return available_pool[allocs_available >> page_shift][allocs_available & page_mask];
+	}
+
+	_FORCE_INLINE_ void _push_available(T *p_mem) {
+		available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem;
+		allocs_available++;
+	}
+
+	T *_cached_alloc() {
+		ThreadCache &cache = _get_thread_cache();
+		cache.lock.lock();
+		if (unlikely(cache.count == 0)) {
+			spin_lock.lock();
+			while (cache.count < THREAD_CACHE_BATCH) {
+				cache.items[cache.count++] = _pop_available();
+			}
+			spin_lock.unlock();
+		}
+		T *alloc = cache.items[--cache.count];
+		cache.lock.unlock();
+		return alloc;
+	}
+
+	void _cached_free(T *p_mem) {
+		ThreadCache &cache = _get_thread_cache();
+		cache.lock.lock();
+		if (unlikely(cache.count == THREAD_CACHE_SIZE)) {
+			spin_lock.lock();
+			while (cache.count > THREAD_CACHE_SIZE - THREAD_CACHE_BATCH) {
+				_push_available(cache.items[--cache.count]);
+			}
+			spin_lock.unlock();
+		}
+		cache.items[cache.count++] = p_mem;
+		cache.lock.unlock();
+	}
+
+	// Returns all cached entries to the shared pool.
+	// Locks in the same order as the cached paths, so the spin lock must not be held.
+	void _flush_thread_caches() {
+		if (!thread_caches) {
+			return;
+		}
+		for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+			ThreadCache &cache = thread_caches[i];
+			cache.lock.lock();
+			spin_lock.lock();
+			while (cache.count > 0) {
+				_push_available(cache.items[--cache.count]);
+			}
 			spin_lock.unlock();
+			cache.lock.unlock();
+		}
+	}
+
+public:
+	template <typename... Args>
+	T *alloc(Args &&...p_args) {
+		T *alloc;
+		if (thread_caches) {
+			alloc = _cached_alloc();
+		} else {
+			if (thread_safe) {
+				spin_lock.lock();
+			}
+			alloc = _pop_available();
+			if (thread_safe) {
+				spin_lock.unlock();
+			}
 		}
 		memnew_placement(alloc, T(p_args...));
 		return alloc;
 	}
 
 	void free(T *p_mem) {
+		p_mem->~T();
+		if (thread_caches) {
+			_cached_free(p_mem);
+			return;
+		}
 		if (thread_safe) {
 			spin_lock.lock();
 		}
-		p_mem->~T();
-		available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem;
-		allocs_available++;
+		_push_available(p_mem);
 		if (thread_safe) {
 			spin_lock.unlock();
 		}
 	}
 
+	// Only available for thread safe allocators. Must not be toggled while
+	// other threads are using the allocator.
+	void set_thread_cache_enabled(bool p_enabled) {
+		ERR_FAIL_COND_MSG(!thread_safe, "Thread caches require a thread safe PagedAllocator.");
+		if (p_enabled == (thread_caches != nullptr)) {
+			return;
+		}
+		if (p_enabled) {
+			thread_caches = memnew_arr(ThreadCache, THREAD_CACHE_SLOTS);
+		} else {
+			_flush_thread_caches();
+			memdelete_arr(thread_caches);
+			thread_caches = nullptr;
+		}
+	}
+
+	bool is_thread_cache_enabled() const {
+		return thread_caches != nullptr;
+	}
+
 	template <typename... Args>
 	T *new_allocation(Args &&...p_args) { return alloc(p_args...); }
 	void delete_allocation(T *p_mem) { free(p_mem); }
@@ -120,6 +224,7 @@ private:
 
 public:
 	void reset(bool p_allow_unfreed = false) {
+		_flush_thread_caches();
 		if (thread_safe) {
 			spin_lock.lock();
 		}
@@ -156,11 +261,15 @@ public:
 
 	// Power of 2 recommended because of alignment with OS page sizes.
 	// Even if element is bigger, it's still a multiple and gets rounded to amount of pages.
-	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE) {
+	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE, bool p_thread_cache = false) {
 		configure(p_page_size);
+		if (p_thread_cache) {
+			set_thread_cache_enabled(true);
+		}
 	}
 
 	~PagedAllocator() {
+		_flush_thread_caches();
 		if (thread_safe) {
 			spin_lock.lock();
 		}
@@ -172,6 +281,10 @@ public:
 		} else {
 			_reset(false);
 		}
+		if (thread_caches) {
+			memdelete_arr(thread_caches);
+			thread_caches = nullptr;
+		}
 		if (thread_safe) {
 			spin_lock.unlock();
 		}
@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*  parallel_sort_array.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PARALLEL_SORT_ARRAY_H
+#define PARALLEL_SORT_ARRAY_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/sort_array.h"
+
+// Merge sort spread over the WorkerThreadPool: the array is cut into one run
+// per thread, each run is sorted with SortArray, then runs are merged pairwise
+// in parallel rounds. Arrays below `min_parallel_size`, or sorts started from
+// a pool thread, fall back to a plain SortArray.
+// Like SortArray, the order of equivalent elements is not preserved.
+template <typename T, typename Comparator = _DefaultComparator<T>>
+class ParallelSortArray {
+	LocalVector<T> scratch;
+
+	T *src = nullptr;
+	T *dst = nullptr;
+	uint32_t size = 0;
+	uint32_t run_size = 0;
+
+	_FORCE_INLINE_ uint32_t _run_end(uint32_t p_from) const {
+		return MIN(p_from + run_size, size);
+	}
+
+	void _sort_run(uint32_t p_index, void *p_userdata) {
+		uint32_t from = p_index * run_size;
+		SortArray<T, Comparator> sorter;
+		sorter.compare = compare;
+		sorter.sort(src + from, _run_end(from) - from);
+	}
+
+	void _merge_runs(uint32_t p_index, void *p_userdata) {
+		uint32_t from = p_index * run_size * 2;
+		uint32_t mid = _run_end(from);
+		uint32_t to = mid < size ? _run_end(mid) : mid;
+
+		uint32_t a = from;
+		uint32_t b = mid;
+		uint32_t out = from;
+		while (a < mid && b < to) {
+			if (compare(src[b], src[a])) {
+				dst[out++] = src[b++];
+			} else {
+				dst[out++] = src[a++];
+			}
+		}
+		while (a < mid) {
+			dst[out++] = src[a++];
+		}
+		while (b < to) {
+			dst[out++] = src[b++];
+		}
+	}
+
+public:
+	Comparator compare;
+	uint32_t min_parallel_size = 16384;
+
+	void sort(T *p_array, uint32_t p_size) {
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		uint32_t threads = pool ? pool->get_thread_count() : 0;
+		if (p_size < min_parallel_size || threads < 2 || WorkerThreadPool::get_thread_index() != -1) {
+			SortArray<T, Comparator> sorter;
+			sorter.compare = compare;
+			sorter.sort(p_array, p_size);
+			return;
+		}
+
+		if (scratch.size() < p_size) {
+			scratch.resize(p_size);
+		}
+
+		src = p_array;
+		dst = scratch.ptr();
+		size = p_size;
+		run_size = (p_size + threads - 1) / threads;
+		uint32_t runs = (p_size + run_size - 1) / run_size;
+
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(this, &ParallelSortArray::_sort_run, (void *)nullptr, runs, -1, true, SNAME("ParallelSort"));
+		pool->wait_for_group_task_completion(group);
+
+		while (runs > 1) {
+			uint32_t pairs = (runs + 1) / 2;
+			group = pool->add_template_group_task(this, &ParallelSortArray::_merge_runs, (void *)nullptr, pairs, -1, true, SNAME("ParallelSortMerge"));
+			pool->wait_for_group_task_completion(group);
+			SWAP(src, dst);
+			run_size *= 2;
+			runs = pairs;
+		}
+
+		if (src != p_array) {
+			for (uint32_t i = 0; i < p_size; i++) {
+				p_array[i] = src[i];
+			}
+		}
+		src = nullptr;
+		dst = nullptr;
+	}
+};
+
+#endif // PARALLEL_SORT_ARRAY_H
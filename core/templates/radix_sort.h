@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  radix_sort.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include "core/templates/local_vector.h"
+#include "core/typedefs.h"
+
+#include <cstring>
+#include <type_traits>
+
+// Helpers to build unsigned radix keys that order the same way as the source values.
+struct RadixSortKey {
+	static _FORCE_INLINE_ uint32_t from_float(float p_value) {
+		uint32_t bits;
+		memcpy(&bits, &p_value, sizeof(uint32_t));
+		// Flip all bits of negative values and only the sign bit of positive ones.
+		return bits ^ (uint32_t(-int32_t(bits >> 31)) | 0x80000000u);
+	}
+
+	static _FORCE_INLINE_ uint64_t from_double(double p_value) {
+		uint64_t bits;
+		memcpy(&bits, &p_value, sizeof(uint64_t));
+		return bits ^ (uint64_t(-int64_t(bits >> 63)) | 0x8000000000000000ull);
+	}
+
+	static _FORCE_INLINE_ uint32_t from_int32(int32_t p_value) { return uint32_t(p_value) ^ 0x80000000u; }
+	static _FORCE_INLINE_ uint64_t from_int64(int64_t p_value) { return uint64_t(p_value) ^ 0x8000000000000000ull; }
+};
+
+template <typename T>
+struct _DefaultRadixKey {
+	_FORCE_INLINE_ T operator()(const T &p_value) const { return p_value; }
+};
+
+// Stable LSD radix sort on an unsigned integer key, one byte per pass.
+// KeyGetter returns the key of an element; use RadixSortKey to map signed
+// or floating point values. Passes where every element shares the same digit
+// are skipped, so keys with few significant bytes stay cheap.
+// The scratch buffer is kept between calls, keep the sorter around to reuse it.
+template <typename T, typename KeyGetter = _DefaultRadixKey<T>, typename Key = std::invoke_result_t<KeyGetter, const T &>>
+class RadixSort {
+	static_assert(std::is_unsigned_v<Key>, "RadixSort keys must be unsigned integers.");
+
+	static constexpr uint32_t DIGITS = sizeof(Key);
+
+	LocalVector<T> scratch;
+
+public:
+	KeyGetter get_key;
+
+	void sort(T *p_array, uint32_t p_size) {
+		if (p_size < 2) {
+			return;
+		}
+
+		uint32_t histogram[DIGITS][256] = {};
+		for (uint32_t i = 0; i < p_size; i++) {
+			Key key = get_key(p_array[i]);
+			for (uint32_t d = 0; d < DIGITS; d++) {
+				histogram[d][(key >> (d * 8)) & 0xFF]++;
+			}
+		}
+
+		if (scratch.size() < p_size) {
+			scratch.resize(p_size);
+		}
+
+		T *src = p_array;
+		T *dst = scratch.ptr();
+		const Key first_key = get_key(p_array[0]);
+
+		for (uint32_t d = 0; d < DIGITS; d++) {
+			const uint32_t shift = d * 8;
+			uint32_t *counts = histogram[d];
+			if (counts[(first_key >> shift) & 0xFF] == p_size) {
+				continue; // All elements share this digit.
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < 256; i++) {
+				uint32_t count = counts[i];
+				counts[i] = offset;
+				offset += count;
+			}
+
+			for (uint32_t i = 0; i < p_size; i++) {
+				dst[counts[(get_key(src[i]) >> shift) & 0xFF]++] = src[i];
+			}
+
+			SWAP(src, dst);
+		}
+
+		if (src != p_array) {
+			for (uint32_t i = 0; i < p_size; i++) {
+				p_array[i] = src[i];
+			}
+		}
+	}
+};
+
+#endif // RADIX_SORT_H
@@ -69,34 +69,75 @@ public:
 
 template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
+	// Elements are stored next to their validator, so a lookup only touches one cache line.
+	// The validator is only written with the lock held. In thread safe mode it is stored with release semantics
+	// once the element is constructed, so a reader that loads a matching validator sees the constructed data.
+	struct Chunk {
+		T data;
+		std::atomic<uint32_t> validator;
+	};
+
+	// In thread safe mode, get_or_null() and owns() don't take the lock.
+	// The chunk table is never reallocated in place: growing it publishes a
+	// new copy, and retired copies are only freed on destruction, so readers
+	// can keep using whichever table they loaded. max_alloc is published
+	// after the chunk that makes it valid, so any index a reader sees as in
+	// range is backed by a chunk in the table it loads afterwards.
+	std::atomic<Chunk **> chunks = nullptr;
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+	Chunk ***retired_chunk_tables = nullptr;
+	uint32_t chunk_table_size = 0;
+	uint32_t retired_chunk_table_count = 0;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	SafeNumeric<uint32_t> max_alloc;
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
+	void _grow_chunk_table(uint32_t p_chunk_count) {
+		Chunk **old_table = chunks.load(std::memory_order_relaxed);
+		if (!THREAD_SAFE) {
+			chunks.store((Chunk **)memrealloc(old_table, sizeof(Chunk *) * p_chunk_count), std::memory_order_relaxed);
+			chunk_table_size = p_chunk_count;
+			return;
+		}
+
+		// Readers may still hold the old table, so copy it instead of reallocating it.
+		const uint32_t new_size = MAX(chunk_table_size * 2, MAX(p_chunk_count, 4u));
+		Chunk **new_table = (Chunk **)memalloc(sizeof(Chunk *) * new_size);
+		if (old_table) {
+			memcpy(new_table, old_table, sizeof(Chunk *) * chunk_table_size);
+			retired_chunk_tables = (Chunk ***)memrealloc(retired_chunk_tables, sizeof(Chunk **) * (retired_chunk_table_count + 1));
+			retired_chunk_tables[retired_chunk_table_count++] = old_table;
+		}
+		chunks.store(new_table, std::memory_order_release);
+		chunk_table_size = new_size;
+	}
+
+	_FORCE_INLINE_ Chunk &_get_chunk_element(uint32_t p_idx) const {
+		Chunk **table = chunks.load(THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed);
+		return table[p_idx / elements_in_chunk][p_idx % elements_in_chunk];
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
 
-		if (alloc_count == max_alloc) {
+		uint32_t current_max = max_alloc.get();
+		if (alloc_count == current_max) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = alloc_count == 0 ? 0 : (current_max / elements_in_chunk);
 
 			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			if (chunk_count + 1 > chunk_table_size) {
+				_grow_chunk_table(chunk_count + 1);
+			}
+			Chunk *chunk = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 			//grow free lists
 			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
@@ -104,27 +145,24 @@ class RID_Alloc : public RID_AllocBase {
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				chunk[i].validator.store(0xFFFFFFFF, std::memory_order_relaxed);
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			// Publish the chunk before the new element count that makes it reachable.
+			chunks.load(std::memory_order_relaxed)[chunk_count] = chunk;
+			max_alloc.set(current_max + elements_in_chunk);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
-
 		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
 		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_chunk_element(free_index).validator.store(validator | 0x80000000, std::memory_order_relaxed); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -135,6 +173,18 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	_FORCE_INLINE_ void _mark_initialized(const RID &p_rid) {
+		// Publishes the constructed element to readers that don't take the lock.
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+		const uint64_t id = p_rid.get_id();
+		_get_chunk_element(uint32_t(id & 0xFFFFFFFF)).validator.store(uint32_t(id >> 32), std::memory_order_release);
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -156,96 +206,59 @@ public:
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
+		Chunk &c = _get_chunk_element(idx);
 		uint32_t validator = uint32_t(id >> 32);
+		const uint32_t chunk_validator = c.validator.load(THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed);
 
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
+			// Returns the memory to construct the element in, initialize_rid() marks it initialized afterwards.
+			if (unlikely(!(chunk_validator & 0x80000000))) {
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
+			if (unlikely((chunk_validator & 0x7FFFFFFF) != validator)) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		} else if (unlikely(chunk_validator != validator)) {
+			if ((chunk_validator & 0x80000000) && chunk_validator != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &c.data;
 	}
 	void initialize_rid(RID p_rid) {
 		T *mem = get_or_null(p_rid, true);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T);
+		_mark_initialized(p_rid);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
 		T *mem = get_or_null(p_rid, true);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T(p_value));
+		_mark_initialized(p_rid);
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_get_chunk_element(idx).validator.load(std::memory_order_relaxed) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -255,31 +268,30 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.get())) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
+		Chunk &c = _get_chunk_element(idx);
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		const uint32_t chunk_validator = c.validator.load(std::memory_order_relaxed);
+		if (unlikely(chunk_validator & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID.");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(chunk_validator != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		c.data.~T();
+		c.validator.store(0xFFFFFFFF, std::memory_order_relaxed); // go invalid
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -296,8 +308,9 @@ public:
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		const uint32_t current_max = max_alloc.get();
+		for (size_t i = 0; i < current_max; i++) {
+			uint64_t validator = _get_chunk_element(i).validator.load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -313,8 +326,9 @@ public:
 			spin_lock.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		const uint32_t current_max = max_alloc.get();
+		for (size_t i = 0; i < current_max; i++) {
+			uint64_t validator = _get_chunk_element(i).validator.load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -330,36 +344,45 @@ public:
 	}
 
 	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536) {
-		elements_in_chunk = sizeof(T) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(T));
+		elements_in_chunk = sizeof(Chunk) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(Chunk));
+		max_alloc.set(0);
 	}
 
 	~RID_Alloc() {
+		const uint32_t current_max = max_alloc.get();
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
-				if (validator & 0x80000000) {
+			for (size_t i = 0; i < current_max; i++) {
+				Chunk &c = _get_chunk_element(i);
+				const uint32_t chunk_validator = c.validator.load(std::memory_order_relaxed);
+				if (chunk_validator & 0x80000000) {
 					continue; //uninitialized
 				}
-				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+				if (chunk_validator != 0xFFFFFFFF) {
+					c.data.~T();
 				}
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		Chunk **table = chunks.load(std::memory_order_relaxed);
+		uint32_t chunk_count = current_max / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
+			memfree(table[i]);
 			memfree(free_list_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
+		if (table) {
+			memfree(table);
 			memfree(free_list_chunks);
-			memfree(validator_chunks);
+		}
+
+		for (uint32_t i = 0; i < retired_chunk_table_count; i++) {
+			memfree(retired_chunk_tables[i]);
+		}
+		if (retired_chunk_tables) {
+			memfree(retired_chunk_tables);
 		}
 	}
 };
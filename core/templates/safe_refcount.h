@@ -146,6 +146,23 @@ public:
 		}
 	}
 
+	// Unsynchronized variants, for values that are known to be accessed from a single thread.
+	// They compile to a plain load and store instead of a locked read-modify-write.
+	_ALWAYS_INLINE_ T conditional_increment_unsynchronized() {
+		T c = value.load(std::memory_order_relaxed);
+		if (c == 0) {
+			return 0;
+		}
+		value.store(c + 1, std::memory_order_relaxed);
+		return c + 1;
+	}
+
+	_ALWAYS_INLINE_ T decrement_unsynchronized() {
+		T c = value.load(std::memory_order_relaxed) - 1;
+		value.store(c, std::memory_order_relaxed);
+		return c;
+	}
+
 	_ALWAYS_INLINE_ explicit SafeNumeric(T p_value = static_cast<T>(0)) {
 		set(p_value);
 	}
@@ -214,6 +231,18 @@ public:
 		return count.decrement();
 	}
 
+	// Only valid while the count is confined to the calling thread.
+	_ALWAYS_INLINE_ uint32_t refval_unsynchronized() { // none-zero on success
+		return count.conditional_increment_unsynchronized();
+	}
+
+	_ALWAYS_INLINE_ uint32_t unrefval_unsynchronized() { // 0 if must be disposed of
+#ifdef DEV_ENABLED
+		_check_unref_safety();
+#endif
+		return count.decrement_unsynchronized();
+	}
+
 	_ALWAYS_INLINE_ uint32_t get() const {
 		return count.get();
 	}
@@ -0,0 +1,629 @@
+/**************************************************************************/
+/*  swiss_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SWISS_HASH_MAP_H
+#define SWISS_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hashfuncs.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SWISS_HASH_MAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SWISS_HASH_MAP_NEON
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * A HashMap variant with the same API as HashMap that uses the "Swiss table"
+ * layout: one control byte per slot, holding 7 bits of the hash (or an empty /
+ * deleted marker), scanned 16 slots at a time with SSE2 or NEON.
+ *
+ * Capacity is a power of two and probing is done group by group, so most
+ * lookups touch a single 16-byte group of control bytes plus the matching
+ * element. This makes it a better fit than HashMap for large maps that are
+ * mostly read from, where the probing distance checks of Robin Hood hashing
+ * turn into cache misses.
+ *
+ * Like HashMap, keys and values are stored in a double linked list by
+ * insertion order, so iteration order and iterator stability are the same.
+ */
+
+struct SwissHashMapGroup {
+	static constexpr uint32_t WIDTH = 16;
+
+	static constexpr int8_t CTRL_EMPTY = -128; // 0b10000000
+	static constexpr int8_t CTRL_DELETED = -2; // 0b11111110
+
+	// Iterable set of matching slot indices within a group.
+	struct BitMask {
+#ifdef SWISS_HASH_MAP_NEON
+		static constexpr uint32_t SHIFT = 2; // One nibble per slot.
+#else
+		static constexpr uint32_t SHIFT = 0; // One bit per slot.
+#endif
+		uint64_t mask = 0;
+
+		_FORCE_INLINE_ explicit operator bool() const { return mask != 0; }
+		_FORCE_INLINE_ uint32_t lowest() const {
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return uint32_t(index) >> SHIFT;
+#else
+			return uint32_t(__builtin_ctzll(mask)) >> SHIFT;
+#endif
+		}
+		_FORCE_INLINE_ uint32_t trailing_zeros() const {
+			return mask ? lowest() : WIDTH;
+		}
+		_FORCE_INLINE_ uint32_t leading_zeros() const {
+			if (!mask) {
+				return WIDTH;
+			}
+			const uint64_t top_aligned = mask << (64 - (WIDTH << SHIFT));
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanReverse64(&index, top_aligned);
+			return uint32_t(63 - index) >> SHIFT;
+#else
+			return uint32_t(__builtin_clzll(top_aligned)) >> SHIFT;
+#endif
+		}
+		_FORCE_INLINE_ void clear_lowest() { mask &= mask - 1; }
+	};
+
+#if defined(SWISS_HASH_MAP_SSE2)
+	__m128i ctrl;
+
+	_FORCE_INLINE_ explicit SwissHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+	}
+	_FORCE_INLINE_ BitMask match(int8_t p_h2) const {
+		return BitMask{ uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl)))) };
+	}
+	_FORCE_INLINE_ BitMask match_empty() const {
+		return match(CTRL_EMPTY);
+	}
+	_FORCE_INLINE_ BitMask match_empty_or_deleted() const {
+		// Full slots are positive, both markers are smaller than -1.
+		return BitMask{ uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)))) };
+	}
+#elif defined(SWISS_HASH_MAP_NEON)
+	int8x16_t ctrl;
+
+	static _FORCE_INLINE_ uint64_t _to_mask(uint8x16_t p_cmp) {
+		// Narrow each byte to a nibble and keep a single bit per slot.
+		const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(p_cmp), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ULL;
+	}
+
+	_FORCE_INLINE_ explicit SwissHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = vld1q_s8(p_ctrl);
+	}
+	_FORCE_INLINE_ BitMask match(int8_t p_h2) const {
+		return BitMask{ _to_mask(vceqq_s8(vdupq_n_s8(p_h2), ctrl)) };
+	}
+	_FORCE_INLINE_ BitMask match_empty() const {
+		return match(CTRL_EMPTY);
+	}
+	_FORCE_INLINE_ BitMask match_empty_or_deleted() const {
+		return BitMask{ _to_mask(vcltq_s8(ctrl, vdupq_n_s8(-1))) };
+	}
+#else
+	// Portable fallback, same layout but scanned one byte at a time.
+	const int8_t *ctrl = nullptr;
+
+	_FORCE_INLINE_ explicit SwissHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = p_ctrl;
+	}
+	_FORCE_INLINE_ BitMask match(int8_t p_h2) const {
+		uint64_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint64_t(ctrl[i] == p_h2) << i;
+		}
+		return BitMask{ mask };
+	}
+	_FORCE_INLINE_ BitMask match_empty() const {
+		return match(CTRL_EMPTY);
+	}
+	_FORCE_INLINE_ BitMask match_empty_or_deleted() const {
+		uint64_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint64_t(ctrl[i] < -1) << i;
+		}
+		return BitMask{ mask };
+	}
+#endif
+};
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		typename Allocator = DefaultTypedAllocator<HashMapElement<TKey, TValue>>>
+class SwissHashMap {
+	using Group = SwissHashMapGroup;
+
+public:
+	static constexpr uint32_t MIN_CAPACITY = Group::WIDTH;
+	static constexpr uint32_t MAX_CAPACITY = 1u << 31;
+
+private:
+	Allocator element_alloc;
+	HashMapElement<TKey, TValue> **elements = nullptr;
+	// One control byte per slot, followed by a copy of the first group so
+	// groups starting near the end can be loaded without wrapping.
+	int8_t *ctrl = nullptr;
+	HashMapElement<TKey, TValue> *head_element = nullptr;
+	HashMapElement<TKey, TValue> *tail_element = nullptr;
+
+	uint32_t capacity = MIN_CAPACITY;
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		// Capacity is a power of two, so mix the hash to make sure all bits are used.
+		return hash_fmix32(Hasher::hash(p_key));
+	}
+	_FORCE_INLINE_ static uint32_t _h1(uint32_t p_hash) { return p_hash >> 7; }
+	_FORCE_INLINE_ static int8_t _h2(uint32_t p_hash) { return int8_t(p_hash & 0x7F); }
+
+	_FORCE_INLINE_ static uint32_t _get_growth_limit(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8; // Max occupancy of 7/8.
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_pos, int8_t p_value) {
+		ctrl[p_pos] = p_value;
+		if (p_pos < Group::WIDTH) {
+			ctrl[capacity + p_pos] = p_value;
+		}
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (elements == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t mask = capacity - 1;
+		const uint32_t hash = _hash(p_key);
+		const int8_t h2 = _h2(hash);
+		uint32_t pos = _h1(hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const Group group(ctrl + pos);
+			for (Group::BitMask match = group.match(h2); match; match.clear_lowest()) {
+				const uint32_t candidate = (pos + match.lowest()) & mask;
+				if (Comparator::compare(elements[candidate]->data.key, p_key)) {
+					r_pos = candidate;
+					return true;
+				}
+			}
+
+			if (group.match_empty()) {
+				return false;
+			}
+
+			// Triangular probing visits every group when capacity is a power of two.
+			step += Group::WIDTH;
+			if (unlikely(step > capacity)) {
+				return false;
+			}
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_insert_pos(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const Group::BitMask available = Group(ctrl + pos).match_empty_or_deleted();
+			if (available) {
+				return (pos + available.lowest()) & mask;
+			}
+			step += Group::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _insert_with_hash(uint32_t p_hash, HashMapElement<TKey, TValue> *p_value) {
+		const uint32_t pos = _find_insert_pos(p_hash);
+		if (ctrl[pos] == Group::CTRL_DELETED) {
+			num_deleted--;
+		}
+		_set_ctrl(pos, _h2(p_hash));
+		elements[pos] = p_value;
+		num_elements++;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		const uint32_t mask = capacity - 1;
+
+		// If no group containing this slot was ever full, no probe sequence
+		// went past it and the slot can be marked as empty again.
+		const Group::BitMask empty_before = Group(ctrl + ((p_pos - Group::WIDTH) & mask)).match_empty();
+		const Group::BitMask empty_after = Group(ctrl + p_pos).match_empty();
+		const bool was_never_full = empty_before && empty_after && (empty_after.trailing_zeros() + empty_before.leading_zeros()) < Group::WIDTH;
+
+		if (was_never_full) {
+			_set_ctrl(p_pos, Group::CTRL_EMPTY);
+		} else {
+			_set_ctrl(p_pos, Group::CTRL_DELETED);
+			num_deleted++;
+		}
+		elements[p_pos] = nullptr;
+		num_elements--;
+	}
+
+	void _allocate_tables() {
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(sizeof(int8_t) * (capacity + Group::WIDTH)));
+		elements = reinterpret_cast<HashMapElement<TKey, TValue> **>(Memory::alloc_static(sizeof(HashMapElement<TKey, TValue> *) * capacity));
+
+		memset(ctrl, (uint8_t)Group::CTRL_EMPTY, capacity + Group::WIDTH);
+		memset(elements, 0, sizeof(HashMapElement<TKey, TValue> *) * capacity);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		const uint32_t old_capacity = capacity;
+		int8_t *old_ctrl = ctrl;
+		HashMapElement<TKey, TValue> **old_elements = elements;
+
+		capacity = MAX(MIN_CAPACITY, p_new_capacity);
+		num_elements = 0;
+		num_deleted = 0;
+		_allocate_tables();
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue; // Empty or deleted.
+			}
+			_insert_with_hash(_hash(old_elements[i]->data.key), old_elements[i]);
+		}
+
+		Memory::free_static(old_elements);
+		Memory::free_static(old_ctrl);
+	}
+
+	_FORCE_INLINE_ HashMapElement<TKey, TValue> *_insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate_tables();
+		}
+
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			elements[pos]->data.value = p_value;
+			return elements[pos];
+		} else {
+			if (num_elements + num_deleted + 1 > _get_growth_limit(capacity)) {
+				if (num_deleted > num_elements / 2) {
+					// Mostly tombstones, cleaning them up is enough.
+					_resize_and_rehash(capacity);
+				} else {
+					ERR_FAIL_COND_V_MSG(capacity == MAX_CAPACITY, nullptr, "Hash table maximum capacity reached, aborting insertion.");
+					_resize_and_rehash(capacity * 2);
+				}
+			}
+
+			HashMapElement<TKey, TValue> *elem = element_alloc.new_allocation(HashMapElement<TKey, TValue>(p_key, p_value));
+
+			if (tail_element == nullptr) {
+				head_element = elem;
+				tail_element = elem;
+			} else if (p_front_insert) {
+				head_element->prev = elem;
+				elem->next = head_element;
+				head_element = elem;
+			} else {
+				tail_element->next = elem;
+				elem->prev = tail_element;
+				tail_element = elem;
+			}
+
+			_insert_with_hash(_hash(p_key), elem);
+			return elem;
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || (num_elements == 0 && num_deleted == 0)) {
+			return;
+		}
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (ctrl[i] >= 0) {
+				element_alloc.delete_allocation(elements[i]);
+				elements[i] = nullptr;
+			}
+		}
+		memset(ctrl, (uint8_t)Group::CTRL_EMPTY, capacity + Group::WIDTH);
+
+		tail_element = nullptr;
+		head_element = nullptr;
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (!exists) {
+			return false;
+		}
+
+		HashMapElement<TKey, TValue> *element = elements[pos];
+		_erase_pos(pos);
+
+		if (head_element == element) {
+			head_element = element->next;
+		}
+
+		if (tail_element == element) {
+			tail_element = element->prev;
+		}
+
+		if (element->prev) {
+			element->prev->next = element->next;
+		}
+
+		if (element->next) {
+			element->next->prev = element->prev;
+		}
+
+		element_alloc.delete_allocation(element);
+		return true;
+	}
+
+	// Replace the key of an entry in-place, without invalidating iterators or changing the entries position during iteration.
+	// p_old_key must exist in the map and p_new_key must not, unless it is equal to p_old_key.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (p_old_key == p_new_key) {
+			return true;
+		}
+		uint32_t pos = 0;
+		ERR_FAIL_COND_V(_lookup_pos(p_new_key, pos), false);
+		ERR_FAIL_COND_V(!_lookup_pos(p_old_key, pos), false);
+		HashMapElement<TKey, TValue> *element = elements[pos];
+		_erase_pos(pos);
+
+		// Update the HashMapElement with the new key and reinsert it.
+		// The slot freed above guarantees there is room without growing.
+		const_cast<TKey &>(element->data.key) = p_new_key;
+		_insert_with_hash(_hash(p_new_key), element);
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = capacity;
+		while (_get_growth_limit(new_capacity) < p_new_capacity) {
+			ERR_FAIL_COND_MSG(new_capacity == MAX_CAPACITY, "Hash table maximum capacity reached, aborting reserve.");
+			new_capacity *= 2;
+		}
+
+		if (new_capacity == capacity) {
+			return;
+		}
+
+		if (elements == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	using ConstIterator = typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::ConstIterator;
+	using Iterator = typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::Iterator;
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(head_element);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(tail_element);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(elements[pos]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(head_element);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(tail_element);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(elements[pos]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[pos]->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return _insert(p_key, TValue())->data.value;
+		} else {
+			return elements[pos]->data.value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		return Iterator(_insert(p_key, p_value, p_front_insert));
+	}
+
+	/* Constructors */
+
+	SwissHashMap(const SwissHashMap &p_other) {
+		reserve(p_other.num_elements);
+
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const SwissHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		if (num_elements != 0) {
+			clear();
+		}
+
+		reserve(p_other.num_elements);
+
+		if (p_other.elements == nullptr) {
+			return; // Nothing to copy.
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	SwissHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	SwissHashMap() {}
+
+	~SwissHashMap() {
+		clear();
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(ctrl);
+		}
+	}
+};
+
+#endif // SWISS_HASH_MAP_H
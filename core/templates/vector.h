@@ -55,6 +55,9 @@ public:
 	}
 };
 
+template <typename T>
+class VectorSlice;
+
 template <typename T>
 class Vector {
 	friend class VectorWriteProxy<T>;
@@ -174,6 +177,10 @@ public:
 
 		ERR_FAIL_COND_V(begin > end, result);
 
+		if (begin == 0 && end == s) {
+			return *this;
+		}
+
 		Size result_size = end - begin;
 		result.resize(result_size);
 
@@ -186,6 +193,9 @@ public:
 		return result;
 	}
 
+	// Same range semantics as slice(), but shares the buffer instead of copying it.
+	VectorSlice<T> slice_view(Size p_begin, Size p_end = CowData<T>::MAX_INT) const;
+
 	bool operator==(const Vector<T> &p_arr) const {
 		Size s = size();
 		if (s != p_arr.size()) {
@@ -329,4 +339,93 @@ void Vector<T>::fill(T p_elem) {
 	}
 }
 
+// Read-only window over a range of a Vector.
+// It keeps a reference to the Vector's buffer instead of copying the range,
+// so creating and narrowing slices is cheap. Writing to the source Vector
+// afterwards copies its buffer as usual, so a slice never sees later changes.
+// Use to_vector() to get a writable copy of the range.
+template <typename T>
+class VectorSlice {
+public:
+	typedef typename Vector<T>::Size Size;
+
+private:
+	Vector<T> source;
+	Size offset = 0;
+	Size length = 0;
+
+public:
+	_FORCE_INLINE_ const T *ptr() const { return source.ptr() + offset; }
+	_FORCE_INLINE_ Size size() const { return length; }
+	_FORCE_INLINE_ bool is_empty() const { return length == 0; }
+
+	_FORCE_INLINE_ const T &operator[](Size p_index) const {
+		CRASH_BAD_INDEX(p_index, length);
+		return ptr()[p_index];
+	}
+
+	Size find(const T &p_val, Size p_from = 0) const {
+		if (p_from < 0) {
+			p_from = length + p_from;
+		}
+		if (p_from < 0 || p_from >= length) {
+			return -1;
+		}
+		const T *data = ptr();
+		for (Size i = p_from; i < length; i++) {
+			if (data[i] == p_val) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	VectorSlice<T> slice(Size p_begin, Size p_end = CowData<T>::MAX_INT) const {
+		VectorSlice<T> result;
+
+		Size begin = CLAMP(p_begin, -length, length);
+		if (begin < 0) {
+			begin += length;
+		}
+		Size end = CLAMP(p_end, -length, length);
+		if (end < 0) {
+			end += length;
+		}
+
+		ERR_FAIL_COND_V(begin > end, result);
+
+		result.source = source;
+		result.offset = offset + begin;
+		result.length = end - begin;
+		return result;
+	}
+
+	Vector<T> to_vector() const {
+		if (offset == 0 && length == source.size()) {
+			return source;
+		}
+
+		Vector<T> result;
+		result.resize(length);
+		const T *r = ptr();
+		T *w = result.ptrw();
+		for (Size i = 0; i < length; i++) {
+			w[i] = r[i];
+		}
+		return result;
+	}
+
+	_FORCE_INLINE_ typename Vector<T>::ConstIterator begin() const { return typename Vector<T>::ConstIterator(ptr()); }
+	_FORCE_INLINE_ typename Vector<T>::ConstIterator end() const { return typename Vector<T>::ConstIterator(ptr() + length); }
+
+	VectorSlice() {}
+	VectorSlice(const Vector<T> &p_source) :
+			source(p_source), length(p_source.size()) {}
+};
+
+template <typename T>
+VectorSlice<T> Vector<T>::slice_view(Size p_begin, Size p_end) const {
+	return VectorSlice<T>(*this).slice(p_begin, p_end);
+}
+
 #endif // VECTOR_H
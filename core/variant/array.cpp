@@ -281,6 +281,10 @@ void Array::assign(const Array &p_array) {
 
 void Array::push_back(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (likely(_p->typed.is_exact(p_value))) {
+		_p->array.push_back(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_back"));
 	_p->array.push_back(value);
@@ -289,6 +293,13 @@ void Array::push_back(const Variant &p_value) {
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
 
+	const ContainerTypeValidate &typed = _p->typed;
+	if (typed.type == Variant::NIL || (typed.type != Variant::OBJECT && typed == p_array._p->typed)) {
+		// Every element already has the right type, share the source buffer.
+		_p->array.append_array(p_array._p->array);
+		return;
+	}
+
 	Vector<Variant> validated_array = p_array._p->array;
 	for (int i = 0; i < validated_array.size(); ++i) {
 		ERR_FAIL_COND(!_p->typed.validate(validated_array.write[i], "append_array"));
@@ -312,6 +323,9 @@ Error Array::resize(int p_new_size) {
 
 Error Array::insert(int p_pos, const Variant &p_value) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
+	if (likely(_p->typed.is_exact(p_value))) {
+		return _p->array.insert(p_pos, p_value);
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed.validate(value, "insert"), ERR_INVALID_PARAMETER);
 	return _p->array.insert(p_pos, value);
@@ -319,6 +333,10 @@ Error Array::insert(int p_pos, const Variant &p_value) {
 
 void Array::fill(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (likely(_p->typed.is_exact(p_value))) {
+		_p->array.fill(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "fill"));
 	_p->array.fill(value);
@@ -425,6 +443,10 @@ void Array::remove_at(int p_pos) {
 
 void Array::set(int p_idx, const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (likely(_p->typed.is_exact(p_value))) {
+		_p->array.write[p_idx] = p_value;
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "set"));
 
@@ -73,6 +73,12 @@ struct ContainerTypeValidate {
 		return type != p_type.type || class_name != p_type.class_name || script != p_type.script;
 	}
 
+	// True when the value can be stored as-is, without coercion or object checks.
+	// Containers use it to skip copying the value before validating it.
+	_FORCE_INLINE_ bool is_exact(const Variant &p_variant) const {
+		return type == Variant::NIL || (type == p_variant.get_type() && type != Variant::OBJECT);
+	}
+
 	// Coerces String and StringName into each other and int into float when needed.
 	_FORCE_INLINE_ bool validate(Variant &inout_variant, const char *p_operation = "use") const {
 		if (type == Variant::NIL) {
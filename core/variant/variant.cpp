@@ -38,9 +38,11 @@
 #include "core/string/print_string.h"
 #include "core/variant/variant_parser.h"
 
-PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small;
-PagedAllocator<Variant::Pools::BucketMedium, true> Variant::Pools::_bucket_medium;
-PagedAllocator<Variant::Pools::BucketLarge, true> Variant::Pools::_bucket_large;
+// Variants holding these types are created and destroyed from many threads
+// (rendering, physics), so the pools use per-thread caches.
+PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small(4096, true);
+PagedAllocator<Variant::Pools::BucketMedium, true> Variant::Pools::_bucket_medium(4096, true);
+PagedAllocator<Variant::Pools::BucketLarge, true> Variant::Pools::_bucket_large(4096, true);
 
 String Variant::get_type_name(Variant::Type p_type) {
 	switch (p_type) {
@@ -37,12 +37,7 @@
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_get_char_buffered() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
 	if (readahead_filled) {
@@ -53,7 +48,7 @@ char32_t VariantParser::Stream::get_char() {
 		eof = true;
 		return 0;
 	}
-	return get_char();
+	return readahead_buffer[readahead_pointer++];
 }
 
 bool VariantParser::Stream::is_eof() const {
@@ -212,6 +207,14 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 			}
 			case ';': {
 				while (true) {
+					uint32_t available;
+					const char32_t *buffered = p_stream->get_buffered(available);
+					uint32_t run = 0;
+					while (run < available && buffered[run] != '\n') {
+						run++;
+					}
+					p_stream->skip_buffered(run);
+
 					char32_t ch = p_stream->get_char();
 					if (p_stream->is_eof()) {
 						r_token.type = TK_EOF;
@@ -273,9 +276,29 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				// Characters as read from the stream, UTF-8 bytes are decoded once at the end.
+				LocalVector<char32_t> str;
 				char32_t prev = 0;
 				while (true) {
+					// Copy runs of plain characters straight from the readahead buffer.
+					uint32_t available;
+					const char32_t *buffered = p_stream->get_buffered(available);
+					uint32_t run = 0;
+					while (run < available && buffered[run] != '"' && buffered[run] != '\\' && buffered[run] != '\n' && buffered[run] != 0) {
+						run++;
+					}
+					if (run) {
+						if (prev != 0) {
+							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							r_token.type = TK_ERROR;
+							return ERR_PARSE_ERROR;
+						}
+						uint32_t str_size = str.size();
+						str.resize(str_size + run);
+						memcpy(str.ptr() + str_size, buffered, run * sizeof(char32_t));
+						p_stream->skip_buffered(run);
+					}
+
 					char32_t ch = p_stream->get_char();
 
 					if (ch == 0) {
@@ -376,7 +399,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						str.push_back(res);
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -386,7 +409,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						str.push_back(ch);
 					}
 				}
 				if (prev != 0) {
@@ -395,15 +418,36 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
-				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+				// ASCII reads the same in UTF-8, so only other strings need decoding.
+				char32_t bits = 0;
+				for (const char32_t c : str) {
+					bits |= c;
+				}
+				String value;
+				if (p_stream->is_utf8() && bits > 0x7f) {
+					CharString utf8;
+					utf8.resize(str.size() + 1);
+					char *utf8_ptr = utf8.ptrw();
+					for (uint32_t i = 0; i < str.size(); i++) {
+						if (str[i] > 0xff) {
+							// Only escapes can go beyond a byte, replace them as before.
+							utf8 = String(str.ptr(), str.size()).ascii(true);
+							utf8_ptr = utf8.ptrw();
+							break;
+						}
+						utf8_ptr[i] = str[i];
+					}
+					utf8_ptr[str.size()] = 0;
+					value.parse_utf8(utf8_ptr, str.size());
+				} else if (str.size()) {
+					value = String(str.ptr(), str.size());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
-					r_token.value = StringName(str);
+					r_token.value = StringName(value);
 				} else {
 					r_token.type = TK_STRING;
-					r_token.value = str;
+					r_token.value = value;
 				}
 				return OK;
 
@@ -491,12 +535,23 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return OK;
 				} else if (is_ascii_alphabet_char(cchar) || is_underscore(cchar)) {
 					StringBuffer<> id;
-					bool first = true;
+					id += cchar;
+					cchar = p_stream->get_char();
 
-					while (is_ascii_alphabet_char(cchar) || is_underscore(cchar) || (!first && is_digit(cchar))) {
+					while (is_ascii_alphanumeric_char(cchar) || is_underscore(cchar)) {
 						id += cchar;
+
+						uint32_t available;
+						const char32_t *buffered = p_stream->get_buffered(available);
+						uint32_t run = 0;
+						while (run < available && (is_ascii_alphanumeric_char(buffered[run]) || is_underscore(buffered[run]))) {
+							run++;
+						}
+						if (run) {
+							id.append(buffered, run);
+							p_stream->skip_buffered(run);
+						}
 						cchar = p_stream->get_char();
-						first = false;
 					}
 
 					p_stream->saved = cchar;
@@ -50,10 +50,28 @@ public:
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 		virtual bool _is_eof() const = 0;
 
+		char32_t _get_char_buffered();
+
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		_FORCE_INLINE_ char32_t get_char() {
+			if (readahead_pointer < readahead_filled) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _get_char_buffered();
+		}
+
+		// Characters already read ahead, so the tokenizer can scan runs of them
+		// at once. They are only consumed by skip_buffered().
+		_FORCE_INLINE_ const char32_t *get_buffered(uint32_t &r_count) const {
+			r_count = readahead_pointer < readahead_filled ? readahead_filled - readahead_pointer : 0;
+			return readahead_buffer + readahead_pointer;
+		}
+		_FORCE_INLINE_ void skip_buffered(uint32_t p_count) {
+			readahead_pointer += p_count;
+		}
+
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
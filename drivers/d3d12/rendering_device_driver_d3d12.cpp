@@ -3898,6 +3898,7 @@ RDD::UniformSetID RenderingDeviceDriverD3D12::uniform_set_create(VectorView<Boun
 					const D3D12_SAMPLER_DESC &sampler_desc = samplers[uniform.ids[j].id];
 					device->CreateSampler(&sampler_desc, desc_heap_walkers.samplers.get_curr_cpu_handle());
 					desc_heap_walkers.samplers.advance();
+					uniform_set_info->samplers_hash = hash_murmur3_buffer(&sampler_desc, sizeof(D3D12_SAMPLER_DESC), uniform_set_info->samplers_hash);
 				}
 			} break;
 			case UNIFORM_TYPE_SAMPLER_WITH_TEXTURE: {
@@ -3907,6 +3908,7 @@ RDD::UniformSetID RenderingDeviceDriverD3D12::uniform_set_create(VectorView<Boun
 
 					device->CreateSampler(&sampler_desc, desc_heap_walkers.samplers.get_curr_cpu_handle());
 					desc_heap_walkers.samplers.advance();
+					uniform_set_info->samplers_hash = hash_murmur3_buffer(&sampler_desc, sizeof(D3D12_SAMPLER_DESC), uniform_set_info->samplers_hash);
 					device->CreateShaderResourceView(texture_info->resource, &texture_info->view_descs.srv, desc_heap_walkers.resources.get_curr_cpu_handle());
 #ifdef DEV_ENABLED
 					uniform_set_info->resources_desc_info.push_back({ D3D12_DESCRIPTOR_RANGE_TYPE_SRV, texture_info->view_descs.srv.ViewDimension });
@@ -4311,6 +4313,36 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 	set_heap_walkers.resources = uniform_set_info->desc_heaps.resources.make_walker();
 	set_heap_walkers.samplers = uniform_set_info->desc_heaps.samplers.make_walker();
 
+	// Sets created with the same samplers (the common case) can point at tables another set already copied this frame.
+	uint64_t sampler_tables_key = 0;
+	const TightLocalVector<RootDescriptorTable> *shared_sampler_tables = nullptr;
+	if (uniform_set_info->desc_heaps.samplers.get_descriptor_count()) {
+		sampler_tables_key = hash_murmur3_one_32(p_set_index, hash_murmur3_one_32(root_sig_crc, uniform_set_info->samplers_hash));
+		sampler_tables_key = (sampler_tables_key << 32) | uniform_set_info->desc_heaps.samplers.get_descriptor_count();
+		shared_sampler_tables = frames[frame_idx].sampler_tables.getptr(sampler_tables_key);
+	}
+
+	// Copies from consecutive descriptors of the set to consecutive slots of the frame heap are merged.
+	struct PendingCopy {
+		D3D12_CPU_DESCRIPTOR_HANDLE dst = {};
+		D3D12_CPU_DESCRIPTOR_HANDLE src = {};
+		uint32_t count = 0;
+	};
+	PendingCopy resource_copy;
+	PendingCopy sampler_copy;
+	auto queue_copy = [&](PendingCopy &r_copy, D3D12_CPU_DESCRIPTOR_HANDLE p_dst, D3D12_CPU_DESCRIPTOR_HANDLE p_src, uint32_t p_count, uint32_t p_handle_size, D3D12_DESCRIPTOR_HEAP_TYPE p_type) {
+		if (r_copy.count && r_copy.dst.ptr + r_copy.count * p_handle_size == p_dst.ptr && r_copy.src.ptr + r_copy.count * p_handle_size == p_src.ptr) {
+			r_copy.count += p_count;
+			return;
+		}
+		if (r_copy.count) {
+			device->CopyDescriptorsSimple(r_copy.count, r_copy.dst, r_copy.src, p_type);
+		}
+		r_copy.dst = p_dst;
+		r_copy.src = p_src;
+		r_copy.count = p_count;
+	};
+
 #ifdef DEV_ENABLED
 	// Whether we have stages where the uniform is actually used should match
 	// whether we have any root signature locations for it.
@@ -4334,6 +4366,16 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 	last_bind->root_tables.samplers.clear();
 	last_bind->uses++;
 
+	if (shared_sampler_tables) {
+		for (const RootDescriptorTable &table : *shared_sampler_tables) {
+			(cmd_buf_info->cmd_list.Get()->*set_root_desc_table_fn)(table.root_param_idx, table.start_gpu_handle);
+			last_bind->root_tables.samplers.push_back(table);
+		}
+#ifdef DEV_ENABLED
+		frames[frame_idx].sampler_tables_reused++;
+#endif
+	}
+
 	struct {
 		RootDescriptorTable *resources = nullptr;
 		RootDescriptorTable *samplers = nullptr;
@@ -4386,11 +4428,11 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 						set_heap_walkers.resources.advance(num_resource_descs);
 					}
 
-					// TODO: Batch to avoid multiple calls where possible (in any case, flush before setting root descriptor tables, or even batch that as well).
-					device->CopyDescriptorsSimple(
-							num_resource_descs,
+					queue_copy(resource_copy,
 							frame_heap_walkers.resources->get_curr_cpu_handle(),
 							set_heap_walkers.resources.get_curr_cpu_handle(),
+							num_resource_descs,
+							frame_heap_walkers.resources->get_handle_size(),
 							D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 					frame_heap_walkers.resources->advance(num_resource_descs);
 
@@ -4405,7 +4447,7 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 
 			{
 				const ShaderInfo::UniformBindingInfo::RootSignatureLocation &rs_loc_sampler = shader_set.bindings[i].root_sig_locations.sampler;
-				if (rs_loc_sampler.root_param_idx != UINT32_MAX) { // Location used?
+				if (rs_loc_sampler.root_param_idx != UINT32_MAX && !shared_sampler_tables) { // Location used?
 					DEV_ASSERT(num_sampler_descs);
 					DEV_ASSERT(!srv_uav_ambiguity); // [[SRV_UAV_AMBIGUITY]]
 
@@ -4436,11 +4478,11 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 						tables.samplers->start_gpu_handle = frame_heap_walkers.samplers->get_curr_gpu_handle();
 					}
 
-					// TODO: Batch to avoid multiple calls where possible (in any case, flush before setting root descriptor tables, or even batch that as well).
-					device->CopyDescriptorsSimple(
-							num_sampler_descs,
+					queue_copy(sampler_copy,
 							frame_heap_walkers.samplers->get_curr_cpu_handle(),
 							set_heap_walkers.samplers.get_curr_cpu_handle(),
+							num_sampler_descs,
+							frame_heap_walkers.samplers->get_handle_size(),
 							D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
 					frame_heap_walkers.samplers->advance(num_sampler_descs);
 				}
@@ -4465,6 +4507,14 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 	DEV_ASSERT(set_heap_walkers.resources.is_at_eof());
 	DEV_ASSERT(set_heap_walkers.samplers.is_at_eof());
 
+	// Root tables only record GPU handles, so the copies can be done once all of them are known.
+	if (resource_copy.count) {
+		device->CopyDescriptorsSimple(resource_copy.count, resource_copy.dst, resource_copy.src, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	}
+	if (sampler_copy.count) {
+		device->CopyDescriptorsSimple(sampler_copy.count, sampler_copy.dst, sampler_copy.src, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+	}
+
 	{
 		bool must_flush_table = tables.resources;
 		if (must_flush_table) {
@@ -4478,6 +4528,10 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 		}
 	}
 
+	if (sampler_tables_key && !shared_sampler_tables) {
+		frames[frame_idx].sampler_tables[sampler_tables_key] = last_bind->root_tables.samplers;
+	}
+
 	last_bind->root_signature_crc = root_sig_crc;
 	last_bind->segment_serial = frames[frame_idx].segment_serial;
 }
@@ -6027,6 +6081,7 @@ void RenderingDeviceDriverD3D12::begin_segment(uint32_t p_frame_index, uint32_t
 	frames[frame_idx].desc_heaps_exhausted_reported = {};
 	frames[frame_idx].null_rtv_handle = CD3DX12_CPU_DESCRIPTOR_HANDLE{};
 	frames[frame_idx].segment_serial = segment_serial;
+	frames[frame_idx].sampler_tables.clear();
 
 	segment_begun = true;
 }
@@ -6137,6 +6192,12 @@ uint64_t RenderingDeviceDriverD3D12::get_total_memory_used() {
 	return stats.Total.Stats.BlockBytes;
 }
 
+uint64_t RenderingDeviceDriverD3D12::get_total_memory_budget() {
+	D3D12MA::Budget local_budget = {};
+	allocator->GetBudget(&local_budget, nullptr);
+	return local_budget.BudgetBytes;
+}
+
 uint64_t RenderingDeviceDriverD3D12::limit_get(Limit p_limit) {
 	uint64_t safe_unbounded = ((uint64_t)1 << 30);
 	switch (p_limit) {
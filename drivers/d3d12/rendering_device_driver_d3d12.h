@@ -183,6 +183,7 @@ class RenderingDeviceDriverD3D12 : public RenderingDeviceDriver {
 			void advance(uint32_t p_count = 1);
 			uint32_t get_current_handle_index() const { return handle_index; }
 			uint32_t get_free_handles() { return handle_count - handle_index; }
+			uint32_t get_handle_size() const { return handle_size; }
 			bool is_at_eof() { return handle_index == handle_count; }
 		};
 
@@ -739,6 +740,9 @@ private:
 		};
 		TightLocalVector<StateRequirement> resource_states;
 
+		// Content hash of the sampler descriptors, so sets with the same samplers can share their GPU-visible tables.
+		uint32_t samplers_hash = 0;
+
 		struct RecentBind {
 			uint64_t segment_serial = 0;
 			uint32_t root_signature_crc = 0;
@@ -970,9 +974,12 @@ private:
 		} desc_heaps_exhausted_reported;
 		CD3DX12_CPU_DESCRIPTOR_HANDLE null_rtv_handle = {}; // For [[MANUAL_SUBPASSES]].
 		uint32_t segment_serial = 0;
+		// Sampler tables already copied into the frame heap, keyed by samplers hash, root signature and set index.
+		HashMap<uint64_t, TightLocalVector<RootDescriptorTable>> sampler_tables;
 
 #ifdef DEV_ENABLED
 		uint32_t uniform_set_reused = 0;
+		uint32_t sampler_tables_reused = 0;
 #endif
 	};
 	TightLocalVector<FrameInfo> frames;
@@ -993,6 +1000,7 @@ public:
 	virtual void set_object_name(ObjectType p_type, ID p_driver_id, const String &p_name) override final;
 	virtual uint64_t get_resource_native_handle(DriverResource p_type, ID p_driver_id) override final;
 	virtual uint64_t get_total_memory_used() override final;
+	virtual uint64_t get_total_memory_budget() override final;
 	virtual uint64_t limit_get(Limit p_limit) override final;
 	virtual uint64_t api_trait_get(ApiTrait p_trait) override final;
 	virtual bool has_feature(Features p_feature) override final;
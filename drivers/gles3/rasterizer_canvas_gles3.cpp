@@ -670,15 +670,7 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	}
 
 	// Copy over all data needed for rendering.
-	glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.current_instance_buffer_index]);
-#ifdef WEB_ENABLED
-	glBufferSubData(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), sizeof(InstanceData) * index, state.instance_data_array);
-#else
-	// On Desktop and mobile we map the memory without synchronizing for maximum speed.
-	void *buffer = glMapBufferRange(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), index * sizeof(InstanceData), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
-	memcpy(buffer, state.instance_data_array, index * sizeof(InstanceData));
-	glUnmapBuffer(GL_ARRAY_BUFFER);
-#endif
+	_upload_instance_data(index);
 
 	glDisable(GL_SCISSOR_TEST);
 	current_clip = nullptr;
@@ -1087,13 +1079,18 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 			case Item::Command::TYPE_POLYGON: {
 				const Item::CommandPolygon *polygon = static_cast<const Item::CommandPolygon *>(c);
 
-				// Polygon's can't be batched, so always create a new batch
-				_new_batch(r_batch_broken);
+				// Polygons with different vertex arrays can't be batched, but repeated draws of the same
+				// polygon are rendered as instances of one batch.
+				const Batch &current = state.canvas_instance_batches[state.current_batch_index];
+				const Item::CommandPolygon *batch_polygon = current.command_type == Item::Command::TYPE_POLYGON ? static_cast<const Item::CommandPolygon *>(current.command) : nullptr;
+				if (r_batch_broken || !batch_polygon || batch_polygon->polygon.polygon_id != polygon->polygon.polygon_id || batch_polygon->primitive != polygon->primitive || current.tex != polygon->texture) {
+					_new_batch(r_batch_broken);
 
-				state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
-				state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_POLYGON;
-				state.canvas_instance_batches[state.current_batch_index].command = c;
-				state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_ATTRIBUTES;
+					state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
+					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_POLYGON;
+					state.canvas_instance_batches[state.current_batch_index].command = c;
+					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_ATTRIBUTES;
+				}
 
 				_prepare_canvas_texture(polygon->texture, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
@@ -1114,10 +1111,12 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 			case Item::Command::TYPE_PRIMITIVE: {
 				const Item::CommandPrimitive *primitive = static_cast<const Item::CommandPrimitive *>(c);
 
-				if (primitive->point_count != state.canvas_instance_batches[state.current_batch_index].primitive_points || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE) {
+				// Quads are drawn as two triangle instances, so they share batches with triangles.
+				uint32_t primitive_points = MIN(primitive->point_count, 3u);
+				if (primitive_points != state.canvas_instance_batches[state.current_batch_index].primitive_points || primitive->texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE) {
 					_new_batch(r_batch_broken);
 					state.canvas_instance_batches[state.current_batch_index].tex = primitive->texture;
-					state.canvas_instance_batches[state.current_batch_index].primitive_points = primitive->point_count;
+					state.canvas_instance_batches[state.current_batch_index].primitive_points = primitive_points;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_PRIMITIVE;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_PRIMITIVE;
@@ -1323,10 +1322,11 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index, Ren
 				glVertexAttrib4f(RS::ARRAY_COLOR, pb->color.r, pb->color.g, pb->color.b, pb->color.a);
 			}
 
+			int instance_count = state.canvas_instance_batches[p_index].instance_count;
 			if (pb->index_buffer != 0) {
-				glDrawElementsInstanced(prim[polygon->primitive], pb->count, GL_UNSIGNED_INT, nullptr, 1);
+				glDrawElementsInstanced(prim[polygon->primitive], pb->count, GL_UNSIGNED_INT, nullptr, instance_count);
 			} else {
-				glDrawArraysInstanced(prim[polygon->primitive], 0, pb->count, 1);
+				glDrawArraysInstanced(prim[polygon->primitive], 0, pb->count, instance_count);
 			}
 			glBindVertexArray(0);
 
@@ -1336,8 +1336,8 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index, Ren
 			}
 
 			if (r_render_info) {
-				r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
-				r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += _indices_to_primitives(polygon->primitive, pb->count);
+				r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += instance_count;
+				r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += _indices_to_primitives(polygon->primitive, pb->count) * instance_count;
 				r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 			}
 		} break;
@@ -1534,15 +1534,7 @@ void RasterizerCanvasGLES3::_add_to_batch(uint32_t &r_index, bool &r_batch_broke
 	if (r_index + state.last_item_index >= data.max_instances_per_buffer) {
 		// Copy over all data needed for rendering right away
 		// then go back to recording item commands.
-		glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.current_instance_buffer_index]);
-#ifdef WEB_ENABLED
-		glBufferSubData(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), sizeof(InstanceData) * r_index, state.instance_data_array);
-#else
-		// On Desktop and mobile we map the memory without synchronizing for maximum speed.
-		void *buffer = glMapBufferRange(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), r_index * sizeof(InstanceData), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
-		memcpy(buffer, state.instance_data_array, r_index * sizeof(InstanceData));
-		glUnmapBuffer(GL_ARRAY_BUFFER);
-#endif
+		_upload_instance_data(r_index);
 		_allocate_instance_buffer();
 		r_index = 0;
 		state.last_item_index = 0;
@@ -1552,6 +1544,32 @@ void RasterizerCanvasGLES3::_add_to_batch(uint32_t &r_index, bool &r_batch_broke
 	}
 }
 
+void RasterizerCanvasGLES3::_upload_instance_data(uint32_t p_count) {
+	DataBuffer &db = state.canvas_instance_data_buffers[state.current_data_buffer_index];
+	uint32_t offset = state.last_item_index * sizeof(InstanceData);
+	uint32_t size = p_count * sizeof(InstanceData);
+
+	if (!db.instance_buffer_maps.is_empty()) {
+		// The mapping is coherent and the data buffer fence keeps us from writing while the GPU still reads it.
+		memcpy(db.instance_buffer_maps[state.current_instance_buffer_index] + offset, state.instance_data_array, size);
+		return;
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, db.instance_buffers[state.current_instance_buffer_index]);
+#ifdef WEB_ENABLED
+	if (offset == 0) {
+		// Orphan the storage on the first write into this buffer, so the browser doesn't wait for the GPU to release the old contents.
+		glBufferData(GL_ARRAY_BUFFER, data.max_instance_buffer_size, nullptr, GL_STREAM_DRAW);
+	}
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, state.instance_data_array);
+#else
+	// On Desktop and mobile we map the memory without synchronizing for maximum speed.
+	void *buffer = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	memcpy(buffer, state.instance_data_array, size);
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+#endif
+}
+
 void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken) {
 	if (state.canvas_instance_batches.size() == 0) {
 		state.canvas_instance_batches.push_back(Batch());
@@ -2560,23 +2578,21 @@ void RasterizerCanvasGLES3::free_polygon(PolygonID p_polygon) {
 // In theory allocations can reach as high as number of windows * 3 frames
 // because OpenGL can start rendering subsequent frames before finishing the current one
 void RasterizerCanvasGLES3::_allocate_instance_data_buffer() {
-	GLuint new_buffers[3];
-	glGenBuffers(3, new_buffers);
+	GLuint new_buffers[2];
+	glGenBuffers(2, new_buffers);
+	DataBuffer db;
 	// Batch UBO.
-	glBindBuffer(GL_ARRAY_BUFFER, new_buffers[0]);
-	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, new_buffers[0], data.max_instance_buffer_size, nullptr, GL_STREAM_DRAW, "2D Batch UBO[" + itos(state.current_data_buffer_index) + "][0]");
+	_create_instance_buffer(db, "2D Batch UBO[" + itos(state.current_data_buffer_index) + "][0]");
 	// Light uniform buffer.
-	glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[1]);
-	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[1], sizeof(LightUniform) * data.max_lights_per_render, nullptr, GL_STREAM_DRAW, "2D Lights UBO[" + itos(state.current_data_buffer_index) + "]");
+	glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[0]);
+	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[0], sizeof(LightUniform) * data.max_lights_per_render, nullptr, GL_STREAM_DRAW, "2D Lights UBO[" + itos(state.current_data_buffer_index) + "]");
 	// State buffer.
-	glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[2]);
-	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[2], sizeof(StateBuffer), nullptr, GL_STREAM_DRAW, "2D State UBO[" + itos(state.current_data_buffer_index) + "]");
+	glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[1]);
+	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[1], sizeof(StateBuffer), nullptr, GL_STREAM_DRAW, "2D State UBO[" + itos(state.current_data_buffer_index) + "]");
 
 	state.current_data_buffer_index = (state.current_data_buffer_index + 1);
-	DataBuffer db;
-	db.instance_buffers.push_back(new_buffers[0]);
-	db.light_ubo = new_buffers[1];
-	db.state_ubo = new_buffers[2];
+	db.light_ubo = new_buffers[0];
+	db.state_ubo = new_buffers[1];
 	db.last_frame_used = RSG::rasterizer->get_frame_number();
 	state.canvas_instance_data_buffers.insert(state.current_data_buffer_index, db);
 	state.current_data_buffer_index = state.current_data_buffer_index % state.canvas_instance_data_buffers.size();
@@ -2591,14 +2607,30 @@ void RasterizerCanvasGLES3::_allocate_instance_buffer() {
 		return;
 	}
 
+	DataBuffer &db = state.canvas_instance_data_buffers[state.current_data_buffer_index];
+	_create_instance_buffer(db, "Batch UBO[" + itos(state.current_data_buffer_index) + "][" + itos(db.instance_buffers.size()) + "]");
+}
+
+void RasterizerCanvasGLES3::_create_instance_buffer(DataBuffer &r_data_buffer, const String &p_name) {
 	GLuint new_buffer;
 	glGenBuffers(1, &new_buffer);
-
 	glBindBuffer(GL_ARRAY_BUFFER, new_buffer);
-	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, new_buffer, data.max_instance_buffer_size, nullptr, GL_STREAM_DRAW, "Batch UBO[" + itos(state.current_data_buffer_index) + "][" + itos(state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers.size()) + "]");
 
-	state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers.push_back(new_buffer);
+#ifdef ANDROID_ENABLED
+	if (GLES3::Config::get_singleton()->buffer_storage_supported) {
+		// Map once and keep writing through the pointer, saving a map/unmap round trip in the driver per upload.
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+		GLES3::Config::get_singleton()->eglBufferStorageEXT(GL_ARRAY_BUFFER, data.max_instance_buffer_size, nullptr, flags);
+		GLES3::Utilities::get_singleton()->buffer_allocated_data(new_buffer, data.max_instance_buffer_size, p_name);
+		r_data_buffer.instance_buffer_maps.push_back((uint8_t *)glMapBufferRange(GL_ARRAY_BUFFER, 0, data.max_instance_buffer_size, flags));
+		r_data_buffer.instance_buffers.push_back(new_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		return;
+	}
+#endif
 
+	GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, new_buffer, data.max_instance_buffer_size, nullptr, GL_STREAM_DRAW, p_name);
+	r_data_buffer.instance_buffers.push_back(new_buffer);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
@@ -2755,21 +2787,19 @@ RasterizerCanvasGLES3::RasterizerCanvasGLES3() {
 	state.canvas_instance_batches.reserve(200);
 
 	for (int i = 0; i < 3; i++) {
-		GLuint new_buffers[3];
-		glGenBuffers(3, new_buffers);
+		GLuint new_buffers[2];
+		glGenBuffers(2, new_buffers);
+		DataBuffer db;
 		// Batch UBO.
-		glBindBuffer(GL_ARRAY_BUFFER, new_buffers[0]);
-		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, new_buffers[0], data.max_instance_buffer_size, nullptr, GL_STREAM_DRAW, "Batch UBO[0][0]");
+		_create_instance_buffer(db, "Batch UBO[0][0]");
 		// Light uniform buffer.
-		glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[1]);
-		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[1], sizeof(LightUniform) * data.max_lights_per_render, nullptr, GL_STREAM_DRAW, "2D lights UBO[0]");
+		glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[0]);
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[0], sizeof(LightUniform) * data.max_lights_per_render, nullptr, GL_STREAM_DRAW, "2D lights UBO[0]");
 		// State buffer.
-		glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[2]);
-		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[2], sizeof(StateBuffer), nullptr, GL_STREAM_DRAW, "2D state UBO[0]");
-		DataBuffer db;
-		db.instance_buffers.push_back(new_buffers[0]);
-		db.light_ubo = new_buffers[1];
-		db.state_ubo = new_buffers[2];
+		glBindBuffer(GL_UNIFORM_BUFFER, new_buffers[1]);
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_UNIFORM_BUFFER, new_buffers[1], sizeof(StateBuffer), nullptr, GL_STREAM_DRAW, "2D state UBO[0]");
+		db.light_ubo = new_buffers[0];
+		db.state_ubo = new_buffers[1];
 		db.last_frame_used = 0;
 		db.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		state.canvas_instance_data_buffers[i] = db;
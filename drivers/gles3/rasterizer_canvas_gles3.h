@@ -288,6 +288,7 @@ public:
 	// to avoid the GPU stalling to wait for a resource to become available.
 	struct DataBuffer {
 		Vector<GLuint> instance_buffers;
+		Vector<uint8_t *> instance_buffer_maps; // Persistent mappings of instance_buffers, empty without buffer storage support.
 		GLuint light_ubo = 0;
 		GLuint state_ubo = 0;
 		uint64_t last_frame_used = -3;
@@ -369,6 +370,8 @@ public:
 	void _add_to_batch(uint32_t &r_index, bool &r_batch_broken);
 	void _allocate_instance_data_buffer();
 	void _allocate_instance_buffer();
+	void _create_instance_buffer(DataBuffer &r_data_buffer, const String &p_name);
+	void _upload_instance_data(uint32_t p_count);
 	void _enable_attributes(uint32_t p_start, bool p_primitive, uint32_t p_rate = 1);
 
 	void set_time(double p_time);
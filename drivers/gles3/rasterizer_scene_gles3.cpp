@@ -2875,6 +2875,98 @@ void RasterizerSceneGLES3::_render_post_processing(const RenderDataGLES3 *p_rend
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+bool RasterizerSceneGLES3::_can_auto_instance(const GeometryInstanceSurface *p_surface, const GeometryInstanceSurface *p_with, bool p_shadow_pass) const {
+	const GeometryInstanceGLES3 *inst = p_surface->owner;
+
+	// Anything that is set per instance through uniforms or extra passes must be off.
+	if (inst->instance_count >= 0 || inst->mesh_instance.is_valid() || !inst->light_passes.is_empty() || !inst->reflection_probe_rid_cache.is_empty() || inst->lightmap_instance.is_valid() || inst->lightmap_sh) {
+		return false;
+	}
+
+	if (p_with == nullptr) {
+		return true;
+	}
+
+	if (p_shadow_pass) {
+		if (p_surface->surface_shadow != p_with->surface_shadow || p_surface->material_shadow != p_with->material_shadow || p_surface->shader_shadow != p_with->shader_shadow) {
+			return false;
+		}
+	} else {
+		if (p_surface->surface != p_with->surface || p_surface->material != p_with->material || p_surface->shader != p_with->shader) {
+			return false;
+		}
+	}
+
+	const GeometryInstanceGLES3 *with_inst = p_with->owner;
+	if (p_surface->lod_index != p_with->lod_index || p_surface->flags != p_with->flags || inst->flags_cache != with_inst->flags_cache || inst->mirror != with_inst->mirror || inst->store_transform_cache != with_inst->store_transform_cache) {
+		return false;
+	}
+
+	// The base pass light indices are uniforms too.
+	if (inst->omni_light_gl_cache.size() != with_inst->omni_light_gl_cache.size() || inst->spot_light_gl_cache.size() != with_inst->spot_light_gl_cache.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < inst->omni_light_gl_cache.size(); i++) {
+		if (inst->omni_light_gl_cache[i] != with_inst->omni_light_gl_cache[i]) {
+			return false;
+		}
+	}
+	for (uint32_t i = 0; i < inst->spot_light_gl_cache.size(); i++) {
+		if (inst->spot_light_gl_cache[i] != with_inst->spot_light_gl_cache[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t RasterizerSceneGLES3::_upload_auto_instance_transforms(GeometryInstanceSurface **p_elements, uint32_t p_count) {
+	GLuint &buffer = scene_state.auto_instance_buffers[scene_state.auto_instance_buffer_index];
+	uint32_t buffer_size = SceneState::AUTO_INSTANCE_MAX * SceneState::AUTO_INSTANCE_STRIDE * sizeof(float);
+	if (buffer == 0) {
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, buffer, buffer_size, nullptr, GL_STREAM_DRAW, "Auto instance buffer");
+	} else {
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	}
+
+	scene_state.auto_instance_data.resize(p_count * SceneState::AUTO_INSTANCE_STRIDE);
+	float *data = scene_state.auto_instance_data.ptr();
+	for (uint32_t i = 0; i < p_count; i++) {
+		const GeometryInstanceGLES3 *inst = p_elements[i]->owner;
+		Transform3D transform;
+		if (inst->store_transform_cache) {
+			transform = inst->transform;
+		}
+		float *row = &data[i * SceneState::AUTO_INSTANCE_STRIDE];
+		for (int j = 0; j < 3; j++) {
+			row[j * 4 + 0] = transform.basis.rows[j][0];
+			row[j * 4 + 1] = transform.basis.rows[j][1];
+			row[j * 4 + 2] = transform.basis.rows[j][2];
+			row[j * 4 + 3] = transform.origin[j];
+		}
+	}
+
+	uint32_t offset = scene_state.auto_instance_used * SceneState::AUTO_INSTANCE_STRIDE * sizeof(float);
+	uint32_t size = p_count * SceneState::AUTO_INSTANCE_STRIDE * sizeof(float);
+#ifdef WEB_ENABLED
+	if (offset == 0) {
+		// Orphan the storage on the first write of the frame, so the browser doesn't wait for the GPU to release the old contents.
+		glBufferData(GL_ARRAY_BUFFER, buffer_size, nullptr, GL_STREAM_DRAW);
+	}
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+#else
+	// Previous frames never touch this range, so there is no need to synchronize.
+	void *ptr = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	memcpy(ptr, data, size);
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+#endif
+
+	scene_state.auto_instance_used += p_count;
+	return offset;
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2916,6 +3008,14 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		base_spec_constants |= SceneShaderGLES3::USE_MULTIVIEW;
 	}
 
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	if (scene_state.auto_instance_frame != frame) {
+		// Move on to the buffer the GPU finished reading the longest time ago.
+		scene_state.auto_instance_frame = frame;
+		scene_state.auto_instance_buffer_index = (scene_state.auto_instance_buffer_index + 1) % SceneState::AUTO_INSTANCE_BUFFER_COUNT;
+		scene_state.auto_instance_used = 0;
+	}
+
 	bool should_request_redraw = false;
 	if constexpr (p_pass_mode != PASS_MODE_DEPTH) {
 		// Don't count elements during depth pre-pass to match the RD renderers.
@@ -2962,6 +3062,32 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			continue;
 		}
 
+		// Draw runs of the same mesh and material as instances of a single call.
+		int32_t instance_count = inst->instance_count;
+		bool auto_instanced = false;
+		uint32_t instance_offset = 0;
+		if (!shader->uses_model_matrix && _can_auto_instance(surf, nullptr, p_pass_mode == PASS_MODE_SHADOW)) {
+			uint32_t max_count = MIN(p_to_element - i, SceneState::AUTO_INSTANCE_MAX - scene_state.auto_instance_used);
+			uint32_t run = 1;
+			while (run < max_count) {
+				GeometryInstanceSurface *next = p_params->elements[i + run];
+				if (p_pass_mode == PASS_MODE_COLOR && !(next->flags & GeometryInstanceSurface::FLAG_PASS_OPAQUE)) {
+					break;
+				}
+				if (!_can_auto_instance(next, surf, p_pass_mode == PASS_MODE_SHADOW)) {
+					break;
+				}
+				run++;
+			}
+
+			if (run > 1) {
+				instance_offset = _upload_auto_instance_transforms(&p_params->elements[i], run);
+				instance_count = run;
+				auto_instanced = true;
+				i += run - 1;
+			}
+		}
+
 		//request a redraw if one of the shaders uses TIME
 		if (shader->uses_time) {
 			should_request_redraw = true;
@@ -3142,7 +3268,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			}
 
 			Transform3D world_transform;
-			if (inst->store_transform_cache) {
+			if (inst->store_transform_cache && !auto_instanced) {
 				world_transform = inst->transform;
 			}
 
@@ -3153,8 +3279,8 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 
 			SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
 
-			if (inst->instance_count > 0) {
-				// Will need to use instancing to draw (either MultiMesh or Particles).
+			if (instance_count > 0) {
+				// Will need to use instancing to draw (either MultiMesh, Particles or a run of identical meshes).
 				instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(instance_variant));
 			}
 
@@ -3461,13 +3587,16 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				}
 			}
 
-			if (inst->instance_count > 0) {
-				// Using MultiMesh or Particles.
+			if (instance_count > 0) {
+				// Using MultiMesh, Particles or a run of identical meshes.
 				// Bind instance buffers.
 
 				GLuint instance_buffer = 0;
 				uint32_t stride = 0;
-				if (inst->flags_cache & INSTANCE_DATA_FLAG_PARTICLES) {
+				if (auto_instanced) {
+					instance_buffer = scene_state.auto_instance_buffers[scene_state.auto_instance_buffer_index];
+					stride = SceneState::AUTO_INSTANCE_STRIDE;
+				} else if (inst->flags_cache & INSTANCE_DATA_FLAG_PARTICLES) {
 					instance_buffer = particles_storage->particles_get_gl_buffer(inst->data->base);
 					stride = 16; // 12 bytes for instance transform and 4 bytes for packed color and custom.
 				} else {
@@ -3483,18 +3612,18 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
 
 				glEnableVertexAttribArray(12);
-				glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(0));
+				glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(instance_offset));
 				glVertexAttribDivisor(12, 1);
 				glEnableVertexAttribArray(13);
-				glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 4));
+				glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(instance_offset + sizeof(float) * 4));
 				glVertexAttribDivisor(13, 1);
 				if (!(inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D)) {
 					glEnableVertexAttribArray(14);
-					glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 8));
+					glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(instance_offset + sizeof(float) * 8));
 					glVertexAttribDivisor(14, 1);
 				}
 
-				if ((inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_COLOR) || (inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_CUSTOM_DATA)) {
+				if (!auto_instanced && ((inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_COLOR) || (inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_HAS_CUSTOM_DATA))) {
 					uint32_t color_custom_offset = inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D ? 8 : 12;
 					glEnableVertexAttribArray(15);
 					glVertexAttribIPointer(15, 4, GL_UNSIGNED_INT, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(color_custom_offset * sizeof(float)));
@@ -3509,12 +3638,12 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				}
 
 				if (use_wireframe) {
-					glDrawElementsInstanced(GL_LINES, count, GL_UNSIGNED_INT, nullptr, inst->instance_count);
+					glDrawElementsInstanced(GL_LINES, count, GL_UNSIGNED_INT, nullptr, instance_count);
 				} else {
 					if (use_index_buffer) {
-						glDrawElementsInstanced(primitive_gl, count, mesh_storage->mesh_surface_get_index_type(mesh_surface), nullptr, inst->instance_count);
+						glDrawElementsInstanced(primitive_gl, count, mesh_storage->mesh_surface_get_index_type(mesh_surface), nullptr, instance_count);
 					} else {
-						glDrawArraysInstanced(primitive_gl, 0, count, inst->instance_count);
+						glDrawArraysInstanced(primitive_gl, 0, count, instance_count);
 					}
 				}
 			} else {
@@ -3530,7 +3659,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				}
 			}
 
-			if (inst->instance_count > 0) {
+			if (instance_count > 0) {
 				glDisableVertexAttribArray(12);
 				glDisableVertexAttribArray(13);
 				glDisableVertexAttribArray(14);
@@ -4297,6 +4426,12 @@ RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.tonemap_buffer);
 	}
 
+	for (uint32_t i = 0; i < SceneState::AUTO_INSTANCE_BUFFER_COUNT; i++) {
+		if (scene_state.auto_instance_buffers[i] != 0) {
+			GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.auto_instance_buffers[i]);
+		}
+	}
+
 	singleton = nullptr;
 }
 
@@ -562,6 +562,17 @@ private:
 		DirectionalShadowData *directional_shadows = nullptr;
 		GLuint directional_shadow_buffer = 0;
 		RS::ShadowQuality directional_shadow_quality = RS::ShadowQuality::SHADOW_QUALITY_SOFT_LOW;
+
+		// Transforms of consecutive regular meshes drawn with a single instanced call.
+		// One buffer per frame in flight, so writing never waits on the GPU.
+		static const uint32_t AUTO_INSTANCE_BUFFER_COUNT = 3;
+		static const uint32_t AUTO_INSTANCE_MAX = 8192;
+		static const uint32_t AUTO_INSTANCE_STRIDE = 12; // In floats, matches the 3D MultiMesh format without color and custom data.
+		GLuint auto_instance_buffers[AUTO_INSTANCE_BUFFER_COUNT] = {};
+		uint32_t auto_instance_buffer_index = 0;
+		uint32_t auto_instance_used = 0;
+		uint64_t auto_instance_frame = UINT64_MAX;
+		LocalVector<float> auto_instance_data;
 	} scene_state;
 
 	struct RenderListParameters {
@@ -645,6 +656,9 @@ private:
 	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
 	void _render_post_processing(const RenderDataGLES3 *p_render_data);
 
+	bool _can_auto_instance(const GeometryInstanceSurface *p_surface, const GeometryInstanceSurface *p_with, bool p_shadow_pass) const;
+	uint32_t _upload_auto_instance_transforms(GeometryInstanceSurface **p_elements, uint32_t p_count);
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -2875,6 +2875,7 @@ void SceneShaderData::set_code(const String &p_code) {
 	uses_fragment_time = false;
 	writes_modelview_or_projection = false;
 	uses_world_coordinates = false;
+	uses_model_matrix = false;
 	uses_tangent = false;
 	uses_color = false;
 	uses_uv = false;
@@ -2950,6 +2951,12 @@ void SceneShaderData::set_code(const String &p_code) {
 	actions.write_flag_pointers["MODELVIEW_MATRIX"] = &writes_modelview_or_projection;
 	actions.write_flag_pointers["PROJECTION_MATRIX"] = &writes_modelview_or_projection;
 	actions.write_flag_pointers["VERTEX"] = &uses_vertex;
+
+	actions.usage_flag_pointers["MODEL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["MODEL_NORMAL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_WORLD"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_VIEW"] = &uses_model_matrix;
+	actions.usage_flag_pointers["INSTANCE_ID"] = &uses_model_matrix;
 	actions.write_flag_pointers["POSITION"] = &uses_position;
 
 	actions.usage_flag_pointers["TANGENT"] = &uses_tangent;
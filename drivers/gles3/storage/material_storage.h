@@ -319,6 +319,7 @@ struct SceneShaderData : public ShaderData {
 	bool uses_fragment_time;
 	bool writes_modelview_or_projection;
 	bool uses_world_coordinates;
+	bool uses_model_matrix; // Includes INSTANCE_ID, prevents drawing separate meshes as instances.
 	bool uses_tangent;
 	bool uses_color;
 	bool uses_uv;
@@ -38,6 +38,7 @@
 #include "texture_storage.h"
 #include "utilities.h"
 
+#include "core/config/project_settings.h"
 #include "servers/rendering/rendering_server_default.h"
 
 using namespace GLES3;
@@ -50,6 +51,8 @@ ParticlesStorage *ParticlesStorage::get_singleton() {
 
 ParticlesStorage::ParticlesStorage() {
 	singleton = this;
+	culled_catch_up_time = GLOBAL_GET("rendering/particles/culled_catch_up_time");
+
 	GLES3::MaterialStorage *material_storage = GLES3::MaterialStorage::get_singleton();
 
 	{
@@ -206,6 +209,13 @@ void ParticlesStorage::particles_set_amount_ratio(RID p_particles, float p_amoun
 	particles->amount_ratio = p_amount_ratio;
 }
 
+void ParticlesStorage::particles_set_emission_lod_distance(RID p_particles, float p_distance) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	particles->emission_lod_distance = MAX(p_distance, 0.0f);
+}
+
 void ParticlesStorage::particles_set_lifetime(RID p_particles, double p_lifetime) {
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL(particles);
@@ -535,7 +545,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 
 	frame_params.cycle = p_particles->cycle_number;
 	frame_params.frame = p_particles->frame_counter++;
-	frame_params.amount_ratio = p_particles->amount_ratio;
+	frame_params.amount_ratio = p_particles->amount_ratio * p_particles->lod_amount_ratio;
 	frame_params.pad1 = 0;
 	frame_params.pad2 = 0;
 	frame_params.interp_to_end = p_particles->interp_to_end;
@@ -777,6 +787,14 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 	SWAP(p_particles->front_vertex_array, p_particles->back_vertex_array);
 }
 
+void ParticlesStorage::particles_set_view_distance(RID p_particles, float p_distance) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	// Several viewports may see the same particles, keep the closest one until they are processed.
+	particles->view_distance = MIN(particles->view_distance, p_distance);
+}
+
 void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) {
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL(particles);
@@ -1028,6 +1046,14 @@ void ParticlesStorage::update_particles() {
 		particles->update_list.remove_from_list();
 		particles->dirty = false;
 
+		particles->lod_amount_ratio = 1.0;
+		if (particles->emission_lod_distance > 0.0 && particles->view_distance > particles->emission_lod_distance) {
+			// Emit in proportion to the screen area the emitter covers.
+			float lod_ratio = particles->emission_lod_distance / particles->view_distance;
+			particles->lod_amount_ratio = lod_ratio * lod_ratio;
+		}
+		particles->view_distance = FLT_MAX;
+
 		_particles_update_buffers(particles);
 
 		if (particles->restart_request) {
@@ -1103,6 +1129,21 @@ void ParticlesStorage::update_particles() {
 			}
 		}
 
+		uint64_t process_frame = RSG::rasterizer->get_frame_number();
+		double process_time = RSG::rasterizer->get_total_time();
+		if (!particles->clear && !zero_time_scale && culled_catch_up_time > 0.0 && process_frame - particles->last_process_frame > 1) {
+			// The particles were culled for a while, simulate the time they missed rather than resuming where they left off.
+			double frame_time = fixed_fps > 0 ? 1.0 / fixed_fps : 1.0 / 30.0;
+			double todo = MIN(process_time - particles->last_process_time - RSG::rasterizer->get_frame_delta_time(), MIN(culled_catch_up_time, particles->lifetime / particles->speed_scale));
+
+			while (todo >= frame_time) {
+				_particles_process(particles, frame_time);
+				todo -= frame_time;
+			}
+		}
+		particles->last_process_frame = process_frame;
+		particles->last_process_time = process_time;
+
 		if (fixed_fps > 0) {
 			double frame_time;
 			double decr;
@@ -98,6 +98,20 @@ public:
 		buffer_allocs_cache[p_id] = resource_allocation;
 	}
 
+	// Track memory of a buffer allocated elsewhere, e.g. with immutable storage.
+	_FORCE_INLINE_ void buffer_allocated_data(GLuint p_id, uint32_t p_size, String p_name = "") {
+		buffer_mem_cache += p_size;
+#ifdef DEV_ENABLED
+		ERR_FAIL_COND_MSG(buffer_allocs_cache.has(p_id), "trying to allocate buffer with name " + p_name + " but ID already used by " + buffer_allocs_cache[p_id].name);
+#endif
+		ResourceAllocation resource_allocation;
+		resource_allocation.size = p_size;
+#ifdef DEV_ENABLED
+		resource_allocation.name = p_name + ": " + itos((uint64_t)p_id);
+#endif
+		buffer_allocs_cache[p_id] = resource_allocation;
+	}
+
 	_FORCE_INLINE_ void buffer_free_data(GLuint p_id) {
 		ERR_FAIL_COND(!buffer_allocs_cache.has(p_id));
 		glDeleteBuffers(1, &p_id);
@@ -176,7 +190,7 @@ public:
 	virtual void visibility_notifier_set_callbacks(RID p_notifier, const Callable &p_enter_callbable, const Callable &p_exit_callable) override;
 
 	virtual AABB visibility_notifier_get_aabb(RID p_notifier) const override;
-	virtual void visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) override;
+	virtual Callable visibility_notifier_get_callback(RID p_notifier, bool p_enter) const override;
 
 	/* TIMING */
 
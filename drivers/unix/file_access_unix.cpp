@@ -38,6 +38,9 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#if !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#endif
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -137,11 +140,61 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+Error FileAccessUnix::open_mapped_internal(const String &p_path) {
+	Error err = open_internal(p_path, READ);
+	if (err != OK) {
+		return err;
+	}
+
+#if !defined(WEB_ENABLED)
+	// Files that can't be mapped (empty, special, or mmap failing) keep using stdio.
+	int fd = fileno(f);
+	struct stat st = {};
+	if (fd == -1 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+		return OK;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (data == MAP_FAILED) {
+		return OK;
+	}
+
+	mapped_data = (uint8_t *)data;
+	mapped_length = st.st_size;
+	mapped_pos = 0;
+#endif
+
+	return OK;
+}
+
+uint64_t FileAccessUnix::_read_mapped(uint8_t *p_dst, uint64_t p_length) const {
+	uint64_t available = mapped_pos < mapped_length ? mapped_length - mapped_pos : 0;
+	if (p_length > available) {
+		last_error = ERR_FILE_EOF;
+		p_length = available;
+	}
+
+	if (p_length > 0) {
+		memcpy(p_dst, mapped_data + mapped_pos, p_length);
+		mapped_pos += p_length;
+	}
+	return p_length;
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+#if !defined(WEB_ENABLED)
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+		mapped_pos = 0;
+	}
+#endif
+
 	fclose(f);
 	f = nullptr;
 
@@ -177,6 +230,10 @@ void FileAccessUnix::seek(uint64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
 	last_error = OK;
+	if (mapped_data) {
+		mapped_pos = p_position;
+		return;
+	}
 	if (fseeko(f, p_position, SEEK_SET)) {
 		check_errors();
 	}
@@ -185,6 +242,11 @@ void FileAccessUnix::seek(uint64_t p_position) {
 void FileAccessUnix::seek_end(int64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	if (mapped_data) {
+		ERR_FAIL_COND(p_position < 0 && uint64_t(-p_position) > mapped_length);
+		mapped_pos = mapped_length + p_position;
+		return;
+	}
 	if (fseeko(f, p_position, SEEK_END)) {
 		check_errors();
 	}
@@ -193,6 +255,9 @@ void FileAccessUnix::seek_end(int64_t p_position) {
 uint64_t FileAccessUnix::get_position() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_pos;
+	}
 	int64_t pos = ftello(f);
 	if (pos < 0) {
 		check_errors();
@@ -204,6 +269,9 @@ uint64_t FileAccessUnix::get_position() const {
 uint64_t FileAccessUnix::get_length() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_length;
+	}
 	int64_t pos = ftello(f);
 	ERR_FAIL_COND_V(pos < 0, 0);
 	ERR_FAIL_COND_V(fseeko(f, 0, SEEK_END), 0);
@@ -221,6 +289,12 @@ bool FileAccessUnix::eof_reached() const {
 uint8_t FileAccessUnix::get_8() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 	uint8_t b;
+	if (mapped_data) {
+		if (_read_mapped(&b, 1) == 0) {
+			b = '\0';
+		}
+		return b;
+	}
 	if (fread(&b, 1, 1, f) == 0) {
 		check_errors();
 		b = '\0';
@@ -232,7 +306,9 @@ uint16_t FileAccessUnix::get_16() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
 	uint16_t b = 0;
-	if (fread(&b, 1, 2, f) != 2) {
+	if (mapped_data) {
+		_read_mapped((uint8_t *)&b, 2);
+	} else if (fread(&b, 1, 2, f) != 2) {
 		check_errors();
 	}
 
@@ -247,7 +323,9 @@ uint32_t FileAccessUnix::get_32() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
 	uint32_t b = 0;
-	if (fread(&b, 1, 4, f) != 4) {
+	if (mapped_data) {
+		_read_mapped((uint8_t *)&b, 4);
+	} else if (fread(&b, 1, 4, f) != 4) {
 		check_errors();
 	}
 
@@ -262,7 +340,9 @@ uint64_t FileAccessUnix::get_64() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
 	uint64_t b = 0;
-	if (fread(&b, 1, 8, f) != 8) {
+	if (mapped_data) {
+		_read_mapped((uint8_t *)&b, 8);
+	} else if (fread(&b, 1, 8, f) != 8) {
 		check_errors();
 	}
 
@@ -277,11 +357,48 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 	ERR_FAIL_NULL_V_MSG(f, -1, "File must be opened before use.");
 
+	if (mapped_data) {
+		return _read_mapped(p_dst, p_length);
+	}
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
 	return read;
 }
 
+uint64_t FileAccessUnix::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, 0);
+	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+
+	if (flags != READ) {
+		// Writes may still be sitting in the stdio buffer.
+		return FileAccess::get_buffer_at(p_position, p_dst, p_length);
+	}
+
+	if (mapped_data) {
+		if (p_position >= mapped_length) {
+			return 0;
+		}
+		uint64_t read = MIN(p_length, mapped_length - p_position);
+		memcpy(p_dst, mapped_data + p_position, read);
+		return read;
+	}
+
+	// pread() doesn't move the file offset, so it's safe next to the stdio reads.
+	int fd = fileno(f);
+	uint64_t read = 0;
+	while (read < p_length) {
+		ssize_t r = pread(fd, p_dst + read, p_length - read, p_position + read);
+		if (r < 0 && errno == EINTR) {
+			continue;
+		}
+		if (r <= 0) {
+			break;
+		}
+		read += r;
+	}
+	return read;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
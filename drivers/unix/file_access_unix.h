@@ -49,12 +49,19 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Set when the file was opened through open_mapped(), reads then bypass stdio.
+	uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+	mutable uint64_t mapped_pos = 0;
+	uint64_t _read_mapped(uint8_t *p_dst, uint64_t p_length) const;
+
 	void _close();
 
 public:
 	static CloseNotificationFunc close_notification_func;
 
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
+	virtual Error open_mapped_internal(const String &p_path) override;
 	virtual bool is_open() const override; ///< true when file is open
 
 	virtual String get_path() const override; /// returns the path for the current open file
@@ -72,6 +79,9 @@ public:
 	virtual uint32_t get_32() const override;
 	virtual uint64_t get_64() const override;
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_data() const override { return mapped_data; }
+	virtual bool is_positional_read_supported() const override { return f && flags == READ; }
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -54,6 +54,15 @@
 #include <arpa/inet.h>
 #endif
 
+// Batched datagram syscalls and UDP segmentation offload.
+#if defined(__linux__) && !defined(WEB_ENABLED)
+#include <netinet/udp.h>
+#define SOCK_MMSG_ENABLED
+#ifdef UDP_SEGMENT
+#define SOCK_GSO_ENABLED
+#endif
+#endif
+
 // BSD calls this flag IPV6_JOIN_GROUP
 #if !defined(IPV6_ADD_MEMBERSHIP) && defined(IPV6_JOIN_GROUP)
 #define IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP
@@ -306,6 +315,9 @@ void NetSocketPosix::_set_socket(SOCKET_TYPE p_sock, IP::Type p_ip_type, bool p_
 	_sock = p_sock;
 	_ip_type = p_ip_type;
 	_is_stream = p_is_stream;
+#ifdef SOCK_GSO_ENABLED
+	_gso_enabled = !p_is_stream;
+#endif
 	// Disable descriptor sharing with subprocesses.
 	_set_close_exec_enabled(true);
 }
@@ -652,6 +664,181 @@ Error NetSocketPosix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IP
 	return OK;
 }
 
+#ifdef SOCK_MMSG_ENABLED
+// Messages per recvmmsg/sendmmsg call, kept on the stack.
+#define SOCK_MMSG_MAX 32
+#endif
+
+#ifdef SOCK_GSO_ENABLED
+// Limits for coalescing datagrams into a single GSO send, segments must fit
+// the path MTU (or the kernel rejects them instead of fragmenting).
+#define SOCK_GSO_MAX_SEGMENTS 64
+#define SOCK_GSO_MAX_SEGMENT_SIZE 1400
+#define SOCK_GSO_MAX_SIZE 65000
+#endif
+
+Error NetSocketPosix::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+#ifdef SOCK_MMSG_ENABLED
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count < 0, ERR_INVALID_PARAMETER);
+
+	struct mmsghdr msgs[SOCK_MMSG_MAX];
+	struct iovec iovs[SOCK_MMSG_MAX];
+	struct sockaddr_storage addrs[SOCK_MMSG_MAX];
+
+	r_received = 0;
+	while (r_received < p_count) {
+		const int count = MIN(p_count - r_received, SOCK_MMSG_MAX);
+		memset(msgs, 0, sizeof(struct mmsghdr) * count);
+		for (int i = 0; i < count; i++) {
+			Datagram &d = p_datagrams[r_received + i];
+			iovs[i].iov_base = d.buffer;
+			iovs[i].iov_len = d.len;
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = &addrs[i];
+			msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		}
+
+		int ret = ::recvmmsg(_sock, msgs, count, 0, nullptr);
+		if (ret < 0) {
+			if (r_received > 0) {
+				break; // Errors will be reported on the next call.
+			}
+			NetError err = _get_socket_error();
+			if (err == ERR_NET_WOULD_BLOCK) {
+				return ERR_BUSY;
+			}
+			if (err == ERR_NET_BUFFER_TOO_SMALL) {
+				return ERR_OUT_OF_MEMORY;
+			}
+			return FAILED;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			Datagram &d = p_datagrams[r_received + i];
+			d.len = msgs[i].msg_len;
+			_set_ip_port(&addrs[i], &d.ip, &d.port);
+		}
+		r_received += ret;
+
+		if (ret < count) {
+			break; // Drained.
+		}
+	}
+
+	return OK;
+#else
+	return NetSocket::recvfrom_batch(p_datagrams, p_count, r_received);
+#endif
+}
+
+Error NetSocketPosix::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+#ifdef SOCK_MMSG_ENABLED
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count < 0, ERR_INVALID_PARAMETER);
+
+	struct mmsghdr msgs[SOCK_MMSG_MAX];
+	struct iovec iovs[SOCK_MMSG_MAX];
+	struct sockaddr_storage addrs[SOCK_MMSG_MAX];
+	int segments[SOCK_MMSG_MAX];
+#ifdef SOCK_GSO_ENABLED
+	union {
+		char buf[CMSG_SPACE(sizeof(uint16_t))];
+		struct cmsghdr align;
+	} controls[SOCK_MMSG_MAX];
+#endif
+
+	r_sent = 0;
+	while (r_sent < p_count) {
+		// Build up to SOCK_MMSG_MAX messages, each one either a single datagram
+		// or, with GSO, a run of same sized datagrams to the same destination
+		// (the last one may be shorter) that the kernel will split.
+		int msg_count = 0;
+		int iov_count = 0;
+		int next = r_sent;
+		memset(msgs, 0, sizeof(msgs));
+		while (next < p_count && msg_count < SOCK_MMSG_MAX && iov_count < SOCK_MMSG_MAX) {
+			const Datagram &d = p_datagrams[next];
+			struct msghdr &hdr = msgs[msg_count].msg_hdr;
+			size_t addr_size = _set_addr_storage(&addrs[msg_count], d.ip, d.port, _ip_type);
+			ERR_FAIL_COND_V(addr_size == 0, ERR_INVALID_PARAMETER);
+			hdr.msg_name = &addrs[msg_count];
+			hdr.msg_namelen = addr_size;
+			hdr.msg_iov = &iovs[iov_count];
+
+			int seg = 1;
+			iovs[iov_count].iov_base = d.buffer;
+			iovs[iov_count].iov_len = d.len;
+			iov_count++;
+#ifdef SOCK_GSO_ENABLED
+			if (_gso_enabled && d.len > 0 && d.len <= SOCK_GSO_MAX_SEGMENT_SIZE) {
+				int total = d.len;
+				while (next + seg < p_count && seg < SOCK_GSO_MAX_SEGMENTS && iov_count < SOCK_MMSG_MAX) {
+					const Datagram &n = p_datagrams[next + seg];
+					if (n.len <= 0 || n.len > d.len || total + n.len > SOCK_GSO_MAX_SIZE || n.port != d.port || n.ip != d.ip) {
+						break;
+					}
+					iovs[iov_count].iov_base = n.buffer;
+					iovs[iov_count].iov_len = n.len;
+					iov_count++;
+					total += n.len;
+					seg++;
+					if (n.len < d.len) {
+						break; // Only the last segment can be shorter.
+					}
+				}
+				if (seg > 1) {
+					hdr.msg_control = controls[msg_count].buf;
+					hdr.msg_controllen = sizeof(controls[msg_count].buf);
+					struct cmsghdr *cm = CMSG_FIRSTHDR(&hdr);
+					cm->cmsg_level = SOL_UDP;
+					cm->cmsg_type = UDP_SEGMENT;
+					cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+					*((uint16_t *)CMSG_DATA(cm)) = d.len;
+				}
+			}
+#endif
+			hdr.msg_iovlen = seg;
+			segments[msg_count] = seg;
+			msg_count++;
+			next += seg;
+		}
+
+		int ret = ::sendmmsg(_sock, msgs, msg_count, 0);
+		if (ret < 0) {
+#ifdef SOCK_GSO_ENABLED
+			if (_gso_enabled && (errno == EIO || errno == EINVAL) && msgs[0].msg_hdr.msg_controllen) {
+				// No offload support on this route/device, send datagrams separately.
+				_gso_enabled = false;
+				continue;
+			}
+#endif
+			if (r_sent > 0) {
+				break;
+			}
+			NetError err = _get_socket_error();
+			if (err == ERR_NET_WOULD_BLOCK) {
+				return ERR_BUSY;
+			}
+			if (err == ERR_NET_BUFFER_TOO_SMALL) {
+				return ERR_OUT_OF_MEMORY;
+			}
+			return FAILED;
+		}
+
+		// On a partial send, the next call either sends the rest or reports why not.
+		for (int i = 0; i < ret; i++) {
+			r_sent += segments[i];
+		}
+	}
+
+	return OK;
+#else
+	return NetSocket::sendto_batch(p_datagrams, p_count, r_sent);
+#endif
+}
+
 Error NetSocketPosix::set_broadcasting_enabled(bool p_enabled) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 	// IPv6 has no broadcast support.
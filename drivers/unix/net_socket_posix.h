@@ -49,6 +49,7 @@ private:
 	SOCKET_TYPE _sock; // NOLINT - the default value is defined in the .cpp
 	IP::Type _ip_type = IP::TYPE_NONE;
 	bool _is_stream = false;
+	bool _gso_enabled = false; // UDP segmentation offload for sendto_batch, Linux only.
 
 	enum NetError {
 		ERR_NET_WOULD_BLOCK,
@@ -87,6 +88,8 @@ public:
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent);
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port);
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port);
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
 
 	virtual bool is_open() const;
 	virtual int get_available_bytes() const;
@@ -292,6 +292,26 @@ void OS_Unix::delay_usec(uint32_t p_usec) const {
 	}
 }
 
+void OS_Unix::delay_until_ticks_usec(uint64_t p_ticks_usec) const {
+#if defined(__linux__) && !defined(WEB_ENABLED)
+	const uint64_t ticks = get_ticks_usec();
+	if (ticks >= p_ticks_usec) {
+		return;
+	}
+	// Sleep on an absolute deadline, so interrupted or late wakeups don't
+	// accumulate. CLOCK_MONOTONIC_RAW can't be used with clock_nanosleep().
+	struct timespec deadline = { 0, 0 };
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	const uint64_t nsec = (uint64_t)deadline.tv_nsec + (p_ticks_usec - ticks) * 1000;
+	deadline.tv_sec += nsec / 1000000000;
+	deadline.tv_nsec = nsec % 1000000000;
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+	}
+#else
+	OS::delay_until_ticks_usec(p_ticks_usec);
+#endif
+}
+
 uint64_t OS_Unix::get_ticks_usec() const {
 #if defined(__APPLE__)
 	uint64_t longtime = mach_absolute_time() * _clock_scale;
@@ -78,6 +78,7 @@ public:
 	virtual double get_unix_time() const override;
 
 	virtual void delay_usec(uint32_t p_usec) const override;
+	virtual void delay_until_ticks_usec(uint64_t p_ticks_usec) const override;
 	virtual uint64_t get_ticks_usec() const override;
 
 	virtual Dictionary get_memory_info() const override;
@@ -497,6 +497,10 @@ Error RenderingDeviceDriverVulkan::_initialize_device_extensions() {
 	_register_requested_device_extension(VK_KHR_MAINTENANCE_2_EXTENSION_NAME, false);
 	_register_requested_device_extension(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME, false);
 	_register_requested_device_extension(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME, false);
+	if (context_driver->functions_get().GetPhysicalDeviceProperties2 != nullptr) {
+		// Also needs VK_KHR_get_physical_device_properties2 on the instance.
+		_register_requested_device_extension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
+	}
 
 	if (Engine::get_singleton()->is_generate_spirv_debug_info_enabled()) {
 		_register_requested_device_extension(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME, true);
@@ -1003,6 +1007,22 @@ Error RenderingDeviceDriverVulkan::_initialize_allocator() {
 	if (use_1_3_features) {
 		allocator_info.flags |= VMA_ALLOCATOR_CREATE_KHR_MAINTENANCE5_BIT;
 	}
+
+	// With the real budget, VMA frees empty blocks and picks smaller ones once close to it,
+	// instead of relying on a fixed estimate of 80% of every heap.
+	VmaVulkanFunctions vulkan_functions = {};
+	if (enabled_device_extension_names.has(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
+		VkInstance instance = context_driver->instance_get();
+		vulkan_functions.vkGetPhysicalDeviceMemoryProperties2KHR = PFN_vkGetPhysicalDeviceMemoryProperties2KHR(vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties2"));
+		if (vulkan_functions.vkGetPhysicalDeviceMemoryProperties2KHR == nullptr) {
+			vulkan_functions.vkGetPhysicalDeviceMemoryProperties2KHR = PFN_vkGetPhysicalDeviceMemoryProperties2KHR(vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties2KHR"));
+		}
+		if (vulkan_functions.vkGetPhysicalDeviceMemoryProperties2KHR != nullptr) {
+			allocator_info.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+			allocator_info.pVulkanFunctions = &vulkan_functions;
+		}
+	}
+
 	VkResult err = vmaCreateAllocator(&allocator_info, &allocator);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateAllocator failed with error " + itos(err) + ".");
 
@@ -4847,9 +4867,32 @@ uint64_t RenderingDeviceDriverVulkan::get_resource_native_handle(DriverResource
 }
 
 uint64_t RenderingDeviceDriverVulkan::get_total_memory_used() {
-	VmaTotalStatistics stats = {};
-	vmaCalculateStatistics(allocator, &stats);
-	return stats.total.statistics.allocationBytes;
+	// Budgets carry cached statistics, which is much cheaper than walking every block with vmaCalculateStatistics().
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+	VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+	vmaGetHeapBudgets(allocator, budgets);
+
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+		total += budgets[i].statistics.allocationBytes;
+	}
+	return total;
+}
+
+uint64_t RenderingDeviceDriverVulkan::get_total_memory_budget() {
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+	VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+	vmaGetHeapBudgets(allocator, budgets);
+
+	uint64_t budget = 0;
+	for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+		if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+			budget += budgets[i].budget;
+		}
+	}
+	return budget;
 }
 
 uint64_t RenderingDeviceDriverVulkan::limit_get(Limit p_limit) {
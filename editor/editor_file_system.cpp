@@ -44,6 +44,8 @@
 #include "editor/editor_paths.h"
 #include "editor/editor_resource_preview.h"
 #include "editor/editor_settings.h"
+#include "editor/import/editor_import_cache.h"
+#include "editor/import/editor_import_plugin.h"
 #include "editor/project_settings_editor.h"
 #include "scene/resources/packed_scene.h"
 
@@ -233,7 +235,7 @@ void EditorFileSystem::_first_scan_filesystem() {
 	first_scan_root_dir->full_path = "res://";
 	HashSet<String> existing_class_names;
 
-	nb_files_total = _scan_new_dir(first_scan_root_dir, d);
+	nb_files_total = _scan_new_dir(first_scan_root_dir, d, true);
 
 	// This loads the global class names from the scripts and ensures that even if the
 	// global_script_class_cache.cfg was missing or invalid, the global class names are valid in ScriptServer.
@@ -390,7 +392,7 @@ void EditorFileSystem::_scan_filesystem() {
 		Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 		sd = memnew(ScannedDirectory);
 		sd->full_path = "res://";
-		nb_files_total = _scan_new_dir(sd, d);
+		nb_files_total = _scan_new_dir(sd, d, true);
 	}
 
 	_process_file_system(sd, new_filesystem, sp);
@@ -882,7 +884,23 @@ void EditorFileSystem::ScanProgress::increment() {
 	EditorFileSystem::singleton->scan_total = ratio;
 }
 
-int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+void EditorFileSystem::_scan_new_dir_task(uint32_t p_index, ScanNewDirData *p_data) {
+	ScannedDirectory *sd = p_data->dirs[p_index];
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+	if (da->change_dir(sd->full_path) != OK) {
+		ERR_PRINT("Cannot go into subdir '" + sd->name + "'.");
+		p_data->nb_files.write[p_index] = -1;
+		return;
+	}
+	String d = da->get_current_dir();
+	if (d == p_data->parent_dir || !d.begins_with(p_data->parent_dir)) {
+		p_data->nb_files.write[p_index] = -1; // Avoid recursion.
+		return;
+	}
+	p_data->nb_files.write[p_index] = _scan_new_dir(sd, da);
+}
+
+int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da, bool p_parallel) {
 	List<String> dirs;
 	List<String> files;
 
@@ -922,6 +940,32 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 
 	int nb_files_total_scan = 0;
 
+	if (p_parallel && dirs.size() > 1) {
+		// Walk the subdirectories on worker threads, each one with its own DirAccess.
+		ScanNewDirData scan_data;
+		scan_data.parent_dir = cd;
+		for (const String &E : dirs) {
+			ScannedDirectory *sd = memnew(ScannedDirectory);
+			sd->name = E;
+			sd->full_path = p_dir->full_path.path_join(sd->name);
+			scan_data.dirs.push_back(sd);
+		}
+		scan_data.nb_files.resize(scan_data.dirs.size());
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_new_dir_task, &scan_data, scan_data.dirs.size(), -1, false, "Scan directories");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (int i = 0; i < scan_data.dirs.size(); i++) {
+			if (scan_data.nb_files[i] < 0) {
+				memdelete(scan_data.dirs[i]);
+				continue;
+			}
+			nb_files_total_scan += scan_data.nb_files[i];
+			p_dir->subdirs.push_back(scan_data.dirs[i]);
+		}
+		dirs.clear();
+	}
+
 	for (List<String>::Element *E = dirs.front(); E; E = E->next()) {
 		if (da->change_dir(E->get()) == OK) {
 			String d = da->get_current_dir();
@@ -1245,46 +1289,19 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanPr
 
 		String path = cd.path_join(p_dir->files[i]->file);
 
+		// The checks themselves are done in parallel by _process_scan_file_checks().
 		if (import_extensions.has(p_dir->files[i]->file.get_extension().to_lower())) {
 			//check here if file must be imported or not
-
-			uint64_t mt = FileAccess::get_modified_time(path);
-
-			bool reimport = false;
-
-			if (mt != p_dir->files[i]->modified_time) {
-				reimport = true; //it was modified, must be reimported.
-			} else if (!FileAccess::exists(path + ".import")) {
-				reimport = true; //no .import file, obviously reimport
-			} else {
-				uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
-				if (import_mt != p_dir->files[i]->import_modified_time) {
-					reimport = true;
-				} else if (_test_for_reimport(path, true)) {
-					reimport = true;
-				}
-			}
-
-			if (reimport) {
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = p_dir->files[i]->file;
-				scan_actions.push_back(ia);
-			}
+			ScanFileCheck check;
+			check.dir = p_dir;
+			check.index = i;
+			check.import = true;
+			scan_file_checks.push_back(check);
 		} else if (ResourceCache::has(path)) { //test for potential reload
-
-			uint64_t mt = FileAccess::get_modified_time(path);
-
-			if (mt != p_dir->files[i]->modified_time) {
-				p_dir->files[i]->modified_time = mt; //save new time, but test for reload
-
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_RELOAD;
-				ia.dir = p_dir;
-				ia.file = p_dir->files[i]->file;
-				scan_actions.push_back(ia);
-			}
+			ScanFileCheck check;
+			check.dir = p_dir;
+			check.index = i;
+			scan_file_checks.push_back(check);
 		}
 
 		p_progress.increment();
@@ -1309,6 +1326,74 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanPr
 	nb_files_total = MAX(nb_files_total + diff_nb_files, 0);
 }
 
+void EditorFileSystem::_scan_file_check_task(uint32_t p_index, ScanFileCheck *p_checks) {
+	ScanFileCheck &check = p_checks[p_index];
+	const EditorFileSystemDirectory::FileInfo *fi = check.dir->files[check.index];
+	String path = check.dir->get_path().path_join(fi->file);
+
+	check.modified_time = FileAccess::get_modified_time(path);
+	if (!check.import) {
+		check.changed = check.modified_time != fi->modified_time;
+		return;
+	}
+
+	if (check.modified_time != fi->modified_time) {
+		check.changed = true; //it was modified, must be reimported.
+	} else if (!FileAccess::exists(path + ".import")) {
+		check.changed = true; //no .import file, obviously reimport
+	} else {
+		uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
+		if (import_mt != fi->import_modified_time) {
+			check.changed = true;
+		} else if (!scan_reimport_tests_in_parallel) {
+			check.test_reimport = true; // Tested afterwards on the scan thread.
+		} else if (_test_for_reimport(path, true)) {
+			check.changed = true;
+		}
+	}
+}
+
+void EditorFileSystem::_process_scan_file_checks() {
+	if (scan_file_checks.is_empty()) {
+		return;
+	}
+
+	// Testing for reimport queries the importers, which may run script or extension code
+	// when import plugins are registered. Only run those tests in parallel with built-in importers.
+	scan_reimport_tests_in_parallel = true;
+	List<Ref<ResourceImporter>> importers;
+	ResourceFormatImporter::get_singleton()->get_importers(&importers);
+	for (const Ref<ResourceImporter> &importer : importers) {
+		if (Object::cast_to<EditorImportPlugin>(importer.ptr())) {
+			scan_reimport_tests_in_parallel = false;
+			break;
+		}
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_file_check_task, scan_file_checks.ptr(), scan_file_checks.size(), -1, false, "Scan file changes");
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (ScanFileCheck &check : scan_file_checks) {
+		if (check.test_reimport) {
+			check.changed = _test_for_reimport(check.dir->get_path().path_join(check.dir->files[check.index]->file), true);
+		}
+		if (!check.changed) {
+			continue;
+		}
+		ItemAction ia;
+		ia.dir = check.dir;
+		ia.file = check.dir->files[check.index]->file;
+		if (check.import) {
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+		} else {
+			check.dir->files[check.index]->modified_time = check.modified_time; //save new time, but test for reload
+			ia.action = ItemAction::ACTION_FILE_RELOAD;
+		}
+		scan_actions.push_back(ia);
+	}
+	scan_file_checks.clear();
+}
+
 void EditorFileSystem::_delete_internal_files(const String &p_file) {
 	if (FileAccess::exists(p_file + ".import")) {
 		List<String> paths;
@@ -1347,6 +1432,7 @@ void EditorFileSystem::_thread_func_sources(void *_userdata) {
 		sp.progress = &pr;
 		sp.hi = efs->nb_files_total;
 		efs->_scan_fs_changes(efs->filesystem, sp);
+		efs->_process_scan_file_checks();
 	}
 	efs->scanning_changes_done.set();
 }
@@ -1405,6 +1491,7 @@ void EditorFileSystem::scan_changes() {
 			sp.hi = nb_files_total;
 			scan_total = 0;
 			_scan_fs_changes(filesystem, sp);
+			_process_scan_file_checks();
 			if (_update_scan_actions()) {
 				emit_signal(SNAME("filesystem_changed"));
 			}
@@ -2464,7 +2551,20 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = OK;
+
+	String cache_key = EditorImportCache::get_cache_key(p_file, importer, params);
+	if (!cache_key.is_empty() && EditorImportCache::restore(cache_key, base_path, &import_variants, &meta)) {
+		print_verbose(vformat("EditorFileSystem: Restored '%s' from the import cache.", p_file));
+	} else {
+		uint64_t import_start_time = (uint64_t)OS::get_singleton()->get_unix_time();
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		// Imports that generate additional files elsewhere in the project can't be restored from the cache.
+		if (err == OK && !cache_key.is_empty() && gen_files.is_empty()) {
+			EditorImportCache::store(cache_key, base_path, importer, import_variants, meta, import_start_time);
+		}
+	}
 
 	// As import is complete, save the .import file.
 
@@ -2705,60 +2805,91 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	bool use_multiple_threads = false;
 #endif
 
+	// Files are imported one import order at a time, as higher orders (like
+	// scenes) may use the resources imported by lower ones. Within an order,
+	// the files of all importers that support it are imported together in a
+	// single group task, so a few slow files of one type don't leave threads
+	// idle while the next type waits. Other importers run alone afterwards.
+	int imported = 0;
 	int from = 0;
-	for (int i = 0; i < reimport_files.size(); i++) {
-		if (groups_to_reimport.has(reimport_files[i].path)) {
-			from = i + 1;
-			continue;
-		}
+	while (from < reimport_files.size()) {
+		int to = from + 1;
+		while (to < reimport_files.size() && reimport_files[to].order == reimport_files[from].order) {
+			to++;
+		}
+
+		Vector<ImportFile> threaded_files;
+		Vector<Ref<ResourceImporter>> threaded_importers;
+		LocalVector<int> single_files;
+		for (int i = from; i < to; i++) {
+			const ImportFile &ifile = reimport_files[i];
+			if (groups_to_reimport.has(ifile.path)) {
+				continue;
+			}
+			if (!use_multiple_threads || !ifile.threaded) {
+				single_files.push_back(i);
+				continue;
+			}
 
-		if (use_multiple_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer || groups_to_reimport.has(reimport_files[i + 1].path)) {
-				if (from - i == 0) {
-					// Single file, do not use threads.
-					pr.step(reimport_files[i].path.get_file(), i);
-					_reimport_file(reimport_files[i].path);
-				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					if (importer.is_null()) {
-						ERR_PRINT(vformat("Invalid importer for \"%s\".", reimport_files[from].importer));
-						from = i + 1;
-						continue;
-					}
+			if (threaded_importers.is_empty() || threaded_importers[threaded_importers.size() - 1]->get_importer_name() != ifile.importer) {
+				Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(ifile.importer);
+				if (importer.is_null()) {
+					ERR_PRINT(vformat("Invalid importer for \"%s\".", ifile.importer));
+					continue;
+				}
+				threaded_importers.push_back(importer);
+			}
 
-					importer->import_threaded_begin();
+			ImportFile threaded_file = ifile;
+			Ref<FileAccess> f = FileAccess::open(ifile.path, FileAccess::READ);
+			if (f.is_valid()) {
+				threaded_file.size = f->get_length();
+			}
+			threaded_files.push_back(threaded_file);
+		}
 
-					ImportThreadData tdata;
-					tdata.max_index.set(from);
-					tdata.reimport_from = from;
-					tdata.reimport_files = reimport_files.ptr();
+		if (threaded_files.size() == 1) {
+			// Single file, do not use threads.
+			pr.step(threaded_files[0].path.get_file(), imported++);
+			_reimport_file(threaded_files[0].path);
+		} else if (threaded_files.size() > 1) {
+			// Start with the largest files, so the last ones to finish are short.
+			threaded_files.sort_custom<ImportFileSizeComparator>();
 
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
-					int current_index = from - 1;
-					do {
-						if (current_index < tdata.max_index.get()) {
-							current_index = tdata.max_index.get();
-							pr.step(reimport_files[current_index].path.get_file(), current_index);
-						}
-						OS::get_singleton()->delay_usec(1);
-					} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
+			for (const Ref<ResourceImporter> &importer : threaded_importers) {
+				importer->import_threaded_begin();
+			}
 
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			ImportThreadData tdata;
+			tdata.max_index.set(0);
+			tdata.reimport_from = 0;
+			tdata.reimport_files = threaded_files.ptr();
 
-					importer->import_threaded_end();
+			// Import is modal, so let it use all threads rather than the share of low priority tasks.
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, threaded_files.size(), -1, true, TTR("Import resources"));
+			int current_index = -1;
+			do {
+				if (current_index < tdata.max_index.get()) {
+					current_index = tdata.max_index.get();
+					pr.step(threaded_files[current_index].path.get_file(), imported + current_index);
 				}
+				OS::get_singleton()->delay_usec(1);
+			} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
 
-				from = i + 1;
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+			for (const Ref<ResourceImporter> &importer : threaded_importers) {
+				importer->import_threaded_end();
 			}
+			imported += threaded_files.size();
+		}
 
-		} else {
-			pr.step(reimport_files[i].path.get_file(), i);
+		for (int i : single_files) {
+			pr.step(reimport_files[i].path.get_file(), imported++);
 			_reimport_file(reimport_files[i].path);
-
-			// We need to increment the counter, maybe the next file is multithreaded
-			// and doesn't have the same importer.
-			from = i + 1;
 		}
+
+		from = to;
 	}
 
 	// Reimport groups.
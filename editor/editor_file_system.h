@@ -35,6 +35,7 @@
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -229,6 +230,20 @@ class EditorFileSystem : public Node {
 
 	void _scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanProgress &p_progress);
 
+	// Per file checks of known files collected by _scan_fs_changes, run in parallel afterwards.
+	struct ScanFileCheck {
+		EditorFileSystemDirectory *dir = nullptr;
+		int index = 0;
+		bool import = false; // Test for reimport, otherwise for reload.
+		bool changed = false;
+		bool test_reimport = false; // Left for _process_scan_file_checks() to test serially.
+		uint64_t modified_time = 0;
+	};
+	LocalVector<ScanFileCheck> scan_file_checks;
+	bool scan_reimport_tests_in_parallel = false;
+	void _scan_file_check_task(uint32_t p_index, ScanFileCheck *p_checks);
+	void _process_scan_file_checks();
+
 	void _delete_internal_files(const String &p_file);
 	int _insert_actions_delete_files_directory(EditorFileSystemDirectory *p_dir);
 
@@ -236,7 +251,13 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
-	int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	struct ScanNewDirData {
+		String parent_dir;
+		Vector<ScannedDirectory *> dirs;
+		Vector<int> nb_files;
+	};
+	int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da, bool p_parallel = false);
+	void _scan_new_dir_task(uint32_t p_index, ScanNewDirData *p_data);
 	void _process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress);
 
 	Thread thread_sources;
@@ -266,11 +287,18 @@ class EditorFileSystem : public Node {
 		String importer;
 		bool threaded = false;
 		int order = 0;
+		uint64_t size = 0;
 		bool operator<(const ImportFile &p_if) const {
 			return order == p_if.order ? (importer < p_if.importer) : (order < p_if.order);
 		}
 	};
 
+	struct ImportFileSizeComparator {
+		_FORCE_INLINE_ bool operator()(const ImportFile &p_a, const ImportFile &p_b) const {
+			return p_a.size > p_b.size;
+		}
+	};
+
 	struct ScriptInfo {
 		String type;
 		String script_class_name;
@@ -37,6 +37,7 @@
 #include "editor/debugger/editor_debugger_node.h"
 #include "editor/editor_log.h"
 #include "editor/editor_node.h"
+#include "editor/editor_settings.h"
 #include "scene/main/node.h"
 
 EditorUndoRedoManager *EditorUndoRedoManager::singleton = nullptr;
@@ -45,6 +46,7 @@ EditorUndoRedoManager::History &EditorUndoRedoManager::get_or_create_history(int
 	if (!history_map.has(p_idx)) {
 		History history;
 		history.undo_redo = memnew(UndoRedo);
+		history.undo_redo->set_max_memory_mb(EDITOR_GET("interface/editor/undo_redo_max_memory_mb"));
 		history.id = p_idx;
 		history_map[p_idx] = history;
 
@@ -35,6 +35,7 @@
 #include "core/extension/gdextension.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/pck_packer.h"
 #include "core/io/zip_io.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
@@ -1630,6 +1631,8 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	bool enc_directory = p_preset->get_enc_directory();
 	if (enc_pck && enc_directory) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
+	} else {
+		pack_flags |= PACK_PATH_INDEX;
 	}
 	if (p_embed) {
 		pack_flags |= PACK_REL_FILEBASE;
@@ -1693,7 +1696,15 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		fhead = fae;
 	}
 
+	Vector<CharString> index_paths;
+	Vector<uint64_t> index_record_offsets;
+
 	for (int i = 0; i < pd.file_ofs.size(); i++) {
+		if (pack_flags & PACK_PATH_INDEX) {
+			index_paths.push_back(pd.file_ofs[i].path_utf8);
+			index_record_offsets.push_back(f->get_position() - pck_start_pos);
+		}
+
 		uint32_t string_len = pd.file_ofs[i].path_utf8.length();
 		uint32_t pad = _get_pad(4, string_len);
 
@@ -1718,6 +1729,11 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		fae.unref();
 	}
 
+	uint64_t path_index_ofs = 0;
+	if (pack_flags & PACK_PATH_INDEX) {
+		path_index_ofs = PCKPacker::store_path_index(f, pck_start_pos, index_paths, index_record_offsets);
+	}
+
 	int header_padding = _get_pad(PCK_PADDING, f->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		f->store_8(0);
@@ -1730,6 +1746,7 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	}
 	f->seek(file_base_ofs);
 	f->store_64(file_base_store); // update files base
+	f->store_64(path_index_ofs); // first reserved words
 	f->seek(file_base);
 
 	// Save the rest of the data.
@@ -65,6 +65,7 @@ public:
 
 	// Threaded import can currently cause deadlocks, see GH-48265.
 	virtual bool can_import_threaded() const override { return false; }
+	virtual bool can_use_import_cache() const override { return false; }
 
 	ResourceImporterOBJ();
 };
@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  editor_import_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_import_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+#include "editor/editor_paths.h"
+
+#define ENTRY_FILE "entry.cfg"
+#define ARTIFACT_PREFIX "artifact"
+
+bool EditorImportCache::is_enabled() {
+	return GLOBAL_GET("editor/import/use_import_cache");
+}
+
+String EditorImportCache::_get_cache_dir() {
+	String path = GLOBAL_GET("editor/import/import_cache_path");
+	if (path.is_empty()) {
+		return EditorPaths::get_singleton()->get_cache_dir().path_join("import_cache");
+	}
+	return ProjectSettings::get_singleton()->globalize_path(path);
+}
+
+String EditorImportCache::_get_entry_dir(const String &p_key) {
+	// Spread entries over subdirectories, so a large shared cache doesn't end up in a single directory.
+	return _get_cache_dir().path_join(p_key.substr(0, 2)).path_join(p_key);
+}
+
+String EditorImportCache::get_cache_key(const String &p_source_file, const Ref<ResourceImporter> &p_importer, const HashMap<StringName, Variant> &p_options) {
+	if (!is_enabled() || !p_importer->can_use_import_cache()) {
+		return String();
+	}
+
+	String source_hash = FileAccess::get_sha256(p_source_file);
+	if (source_hash.is_empty()) {
+		return String();
+	}
+
+	String key = source_hash + "\n" + p_source_file.get_extension().to_lower();
+	key += "\n" + p_importer->get_importer_name() + "\n" + itos(p_importer->get_format_version());
+	key += "\n" + p_importer->get_import_settings_string();
+
+	// Options are hashed in a stable order, HashMap iteration depends on insertion.
+	List<StringName> option_names;
+	for (const KeyValue<StringName, Variant> &E : p_options) {
+		option_names.push_back(E.key);
+	}
+	option_names.sort_custom<StringName::AlphCompare>();
+	for (const StringName &E : option_names) {
+		String value;
+		VariantWriter::write_to_string(p_options[E], value);
+		key += "\n" + String(E) + "=" + value;
+	}
+
+	return key.sha256_text();
+}
+
+bool EditorImportCache::restore(const String &p_key, const String &p_base_path, List<String> *r_platform_variants, Variant *r_metadata) {
+	String entry_dir = _get_entry_dir(p_key);
+
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(entry_dir.path_join(ENTRY_FILE)) != OK) {
+		return false;
+	}
+
+	Vector<String> artifacts = cf->get_value("entry", "artifacts", Vector<String>());
+	if (artifacts.is_empty()) {
+		return false;
+	}
+
+	String base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	for (const String &E : artifacts) {
+		if (DirAccess::copy_absolute(entry_dir.path_join(ARTIFACT_PREFIX + E), base_path + E) != OK) {
+			print_verbose(vformat("EditorImportCache: Failed to restore '%s' from the import cache, importing it instead.", p_base_path + E));
+			return false;
+		}
+	}
+
+	Vector<String> platform_variants = cf->get_value("entry", "platform_variants", Vector<String>());
+	for (const String &E : platform_variants) {
+		r_platform_variants->push_back(E);
+	}
+	*r_metadata = cf->get_value("entry", "metadata", Variant());
+
+	return true;
+}
+
+void EditorImportCache::store(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_platform_variants, const Variant &p_metadata, uint64_t p_import_start_time) {
+	String entry_dir = _get_entry_dir(p_key);
+	if (FileAccess::exists(entry_dir.path_join(ENTRY_FILE))) {
+		return; // Another project or machine already stored the same import.
+	}
+
+	String base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	String base_file = base_path.get_file();
+
+	// The main resource (or one per platform variant) is required, any other file next to it
+	// written by this import (such as editor-only variants) is stored along with it.
+	Vector<String> artifacts;
+	if (p_platform_variants.is_empty()) {
+		artifacts.push_back("." + p_importer->get_save_extension());
+	} else {
+		for (const String &E : p_platform_variants) {
+			artifacts.push_back("." + E + "." + p_importer->get_save_extension());
+		}
+	}
+	for (const String &E : artifacts) {
+		if (!FileAccess::exists(base_path + E)) {
+			return;
+		}
+	}
+
+	for (const String &E : DirAccess::get_files_at(base_path.get_base_dir())) {
+		if (!E.begins_with(base_file + ".") || E.ends_with(".md5")) {
+			continue;
+		}
+		String suffix = E.substr(base_file.length());
+		if (!artifacts.has(suffix) && FileAccess::get_modified_time(base_path + suffix) >= p_import_start_time) {
+			artifacts.push_back(suffix);
+		}
+	}
+
+	// Write into a temporary directory first and move it into place once complete,
+	// so other editors using the same cache never see a partial entry.
+	String temp_dir = entry_dir + vformat(".%d_%d.tmp", OS::get_singleton()->get_process_id(), (uint64_t)Thread::get_caller_id());
+	Error err = DirAccess::make_dir_recursive_absolute(temp_dir);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot create import cache directory '" + temp_dir + "'.");
+
+	for (const String &E : artifacts) {
+		err = DirAccess::copy_absolute(base_path + E, temp_dir.path_join(ARTIFACT_PREFIX + E));
+		if (err != OK) {
+			break;
+		}
+	}
+
+	if (err == OK) {
+		Ref<ConfigFile> cf;
+		cf.instantiate();
+		cf->set_value("entry", "artifacts", artifacts);
+		Vector<String> platform_variants;
+		for (const String &E : p_platform_variants) {
+			platform_variants.push_back(E);
+		}
+		cf->set_value("entry", "platform_variants", platform_variants);
+		cf->set_value("entry", "metadata", p_metadata);
+		err = cf->save(temp_dir.path_join(ENTRY_FILE));
+	}
+
+	if (err == OK) {
+		err = DirAccess::rename_absolute(temp_dir, entry_dir);
+	}
+
+	if (err != OK) {
+		// Either storing failed or another editor won the race; discard the temporary entry.
+		for (const String &E : DirAccess::get_files_at(temp_dir)) {
+			DirAccess::remove_absolute(temp_dir.path_join(E));
+		}
+		DirAccess::remove_absolute(temp_dir);
+	}
+}
@@ -275,6 +275,8 @@ void register_editor_types() {
 
 	GLOBAL_DEF("editor/import/reimport_missing_imported_files", true);
 	GLOBAL_DEF("editor/import/use_multiple_threads", true);
+	GLOBAL_DEF("editor/import/use_import_cache", false);
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "editor/import/import_cache_path", PROPERTY_HINT_GLOBAL_DIR), "");
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/import/atlas_max_width", PROPERTY_HINT_RANGE, "128,8192,1,or_greater"), 2048);
 
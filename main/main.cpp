@@ -34,6 +34,7 @@
 #include "core/core_globals.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_trace.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -238,6 +239,9 @@ static int frame_delay = 0;
 static int audio_output_latency = 0;
 static bool disable_render_loop = false;
 static int fixed_fps = -1;
+static bool server_ticks = false;
+static uint64_t server_tick_next = 0;
+static String trace_file;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
@@ -625,6 +629,9 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--server-ticks", "Run as a dedicated server: iterate once per physics tick and skip rendering and audio work (requires --headless).\n");
+	print_help_option("--startup-trace <path>", "Record the duration of each startup phase and save it to a given file in the Chrome trace event format.\n");
+	print_help_option("--trace <path>", "Record engine zones (tasks, rendering sync, physics step, resource loading, audio mix) on all threads and save them to a given file in the Chrome trace event format on exit.\n");
 
 	print_help_title("Standalone tools");
 	print_help_option("-s, --script <script>", "Run a script.\n");
@@ -660,7 +667,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--benchmark", "Benchmark the run time and print it to console.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #ifdef TESTS_ENABLED
-	print_help_option("--test [--help]", "Run unit tests. Use --test --help for more information.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--test [--bench] [--help]", "Run unit tests, or benchmarks with --bench. Use --test --help for more information.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
 #endif
 	OS::get_singleton()->print("\n");
@@ -778,6 +785,7 @@ Error Main::test_setup() {
 	}
 
 	ClassDB::set_current_api(ClassDB::API_NONE);
+	ClassDB::build_resolved_members();
 
 	_start_success = true;
 
@@ -917,8 +925,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 	MAIN_PRINT("Main: Initialize CORE");
 
+	OS::get_singleton()->benchmark_begin_measure("Startup", "Core Types");
 	register_core_types();
 	register_core_driver_types();
+	OS::get_singleton()->benchmark_end_measure("Startup", "Core Types");
 
 	MAIN_PRINT("Main: Initialize Globals");
 
@@ -1673,6 +1683,26 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--server-ticks") {
+			server_ticks = true;
+		} else if (arg == "--startup-trace") {
+			if (N) {
+				OS::get_singleton()->set_startup_trace_file(N->get());
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --startup-trace <path>.\n");
+				goto error;
+			}
+		} else if (arg == "--trace") {
+			if (N) {
+				trace_file = N->get();
+				EngineTrace::set_thread_name("Main");
+				EngineTrace::start();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --trace <path>.\n");
+				goto error;
+			}
 		} else if (arg == "--profile-gpu") {
 			profile_gpu = true;
 		} else if (arg == "--disable-crash-handler") {
@@ -1777,11 +1807,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	}
 
 	OS::get_singleton()->_in_editor = editor;
+	OS::get_singleton()->benchmark_begin_measure("Startup", "Project Settings");
 	if (globals->setup(project_path, main_pack, upwards, editor) == OK) {
+		OS::get_singleton()->benchmark_end_measure("Startup", "Project Settings");
 #ifdef TOOLS_ENABLED
 		found_project = true;
 #endif
 	} else {
+		OS::get_singleton()->benchmark_end_measure("Startup", "Project Settings");
 #ifdef TOOLS_ENABLED
 		editor = false;
 #else
@@ -2376,6 +2409,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	Engine::get_singleton()->set_physics_jitter_fix(GLOBAL_DEF("physics/common/physics_jitter_fix", 0.5));
 	Engine::get_singleton()->set_max_fps(GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/max_fps", PROPERTY_HINT_RANGE, "0,1000,1"), 0));
 
+	// Server ticks only make sense without anything to draw.
+	server_ticks = (server_ticks || GLOBAL_DEF("application/run/server_tick_mode", false)) && display_driver == NULL_DISPLAY_DRIVER && !editor && !project_manager && !cmdline_tool;
+
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/output_latency", PROPERTY_HINT_RANGE, "1,100,1"), 15);
 	// Use a safer default output_latency for web to avoid audio cracking on low-end devices, especially mobile.
 	GLOBAL_DEF_RST("audio/driver/output_latency.web", 50);
@@ -2453,6 +2489,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 	message_queue = memnew(MessageQueue);
 
+	FrameAllocator::initialize(size_t(int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "memory/limits/frame_allocator/arena_size_kb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), 1024))) * 1024);
+
 	Thread::release_main_thread(); // If setup2() is called from another thread, that one will become main thread, so preventively release this one.
 	set_current_thread_safe_for_nodes(false);
 
@@ -3150,6 +3188,7 @@ Error Main::setup2(bool p_show_boot_logo) {
 	_start_success = true;
 
 	ClassDB::set_current_api(ClassDB::API_NONE); //no more APIs are registered at this point
+	ClassDB::build_resolved_members();
 
 	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
 	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
@@ -3595,6 +3634,10 @@ int Main::start() {
 
 	OS::get_singleton()->set_main_loop(main_loop);
 
+	if (editor || project_manager) {
+		server_ticks = false; // The editor may have been started instead of the project.
+	}
+
 	SceneTree *sml = Object::cast_to<SceneTree>(main_loop);
 	if (sml) {
 #ifdef DEBUG_ENABLED
@@ -3999,6 +4042,7 @@ static uint64_t navigation_process_max = 0;
 // will terminate the program. In case of failure, the OS exit code needs
 // to be set explicitly here (defaults to EXIT_SUCCESS).
 bool Main::iteration() {
+	TRACE_ZONE("Main::iteration");
 	iterating++;
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
@@ -4038,13 +4082,16 @@ bool Main::iteration() {
 
 	// process all our active interfaces
 #ifndef _3D_DISABLED
-	XRServer::get_singleton()->_process();
+	if (!server_ticks) {
+		XRServer::get_singleton()->_process();
+	}
 #endif // _3D_DISABLED
 
 	NavigationServer2D::get_singleton()->sync();
 	NavigationServer3D::get_singleton()->sync();
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		TRACE_ZONE("Main::physics_iteration");
 		if (Input::get_singleton()->is_agile_input_event_flushing()) {
 			Input::get_singleton()->flush_buffered_events();
 		}
@@ -4113,9 +4160,11 @@ bool Main::iteration() {
 	}
 	message_queue->flush();
 
-	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	if (!server_ticks) {
+		RenderingServer::get_singleton()->sync_frame(); //sync if still drawing from previous frames.
+	}
 
-	if ((DisplayServer::get_singleton()->can_any_window_draw() || DisplayServer::get_singleton()->has_additional_outputs()) &&
+	if (!server_ticks && (DisplayServer::get_singleton()->can_any_window_draw() || DisplayServer::get_singleton()->has_additional_outputs()) &&
 			RenderingServer::get_singleton()->is_render_loop_enabled()) {
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (RenderingServer::get_singleton()->has_changed()) {
@@ -4137,7 +4186,9 @@ bool Main::iteration() {
 		ScriptServer::get_language(i)->frame();
 	}
 
-	AudioServer::get_singleton()->update();
+	if (!server_ticks) {
+		AudioServer::get_singleton()->update();
+	}
 
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
@@ -4146,6 +4197,9 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	// Everything allocated for this frame is expected to be released by now.
+	FrameAllocator::reset();
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
@@ -4198,7 +4252,18 @@ bool Main::iteration() {
 		return exit;
 	}
 
-	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
+	if (server_ticks) {
+		// Nothing happens between physics ticks, sleep until the next one.
+		const uint64_t tick_usec = 1000000 / physics_ticks_per_second;
+		const uint64_t now = OS::get_singleton()->get_ticks_usec();
+		server_tick_next += tick_usec;
+		if (server_tick_next + tick_usec < now) {
+			server_tick_next = now; // Fell behind, don't wake up early to catch up.
+		}
+		OS::get_singleton()->delay_until_ticks_usec(server_tick_next);
+	} else {
+		OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
+	}
 
 #ifdef TOOLS_ENABLED
 	if (auto_build_solutions) {
@@ -4256,6 +4321,11 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	if (EngineTrace::is_recording()) {
+		EngineTrace::stop();
+		EngineTrace::save(trace_file);
+	}
+
 	ResourceLoader::clear_thread_load_tasks();
 
 	ResourceLoader::remove_custom_loaders();
@@ -4380,6 +4450,8 @@ void Main::cleanup(bool p_force) {
 	message_queue->flush();
 	memdelete(message_queue);
 
+	FrameAllocator::finalize();
+
 #if defined(STEAMAPI_ENABLED)
 	if (steam_tracker) {
 		memdelete(steam_tracker);
@@ -4395,6 +4467,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	unregister_core_types();
+	EngineTrace::finish();
 
 	OS::get_singleton()->benchmark_end_measure("Shutdown", "Main::Cleanup");
 	OS::get_singleton()->benchmark_dump();
@@ -91,6 +91,18 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_NAVIGATION);
+	BIND_ENUM_CONSTANT(MEMORY_NAVIGATION_MAX);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -141,6 +153,18 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation/edges_merged"),
 		PNAME("navigation/edges_connected"),
 		PNAME("navigation/edges_free"),
+		PNAME("memory/rendering"),
+		PNAME("memory/rendering_max"),
+		PNAME("memory/physics"),
+		PNAME("memory/physics_max"),
+		PNAME("memory/script"),
+		PNAME("memory/script_max"),
+		PNAME("memory/resource"),
+		PNAME("memory/resource_max"),
+		PNAME("memory/audio"),
+		PNAME("memory/audio_max"),
+		PNAME("memory/navigation"),
+		PNAME("memory/navigation_max"),
 
 	};
 
@@ -225,6 +249,30 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case MEMORY_RENDERING:
+			return Memory::get_tag_mem_usage(Memory::TAG_RENDERING);
+		case MEMORY_RENDERING_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS:
+			return Memory::get_tag_mem_usage(Memory::TAG_PHYSICS);
+		case MEMORY_PHYSICS_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPT:
+			return Memory::get_tag_mem_usage(Memory::TAG_SCRIPT);
+		case MEMORY_SCRIPT_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_SCRIPT);
+		case MEMORY_RESOURCE:
+			return Memory::get_tag_mem_usage(Memory::TAG_RESOURCE);
+		case MEMORY_RESOURCE_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_RESOURCE);
+		case MEMORY_AUDIO:
+			return Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+		case MEMORY_AUDIO_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO);
+		case MEMORY_NAVIGATION:
+			return Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION);
+		case MEMORY_NAVIGATION_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_NAVIGATION);
 
 		default: {
 		}
@@ -272,6 +320,18 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
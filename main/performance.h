@@ -100,6 +100,18 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		MEMORY_RENDERING,
+		MEMORY_RENDERING_MAX,
+		MEMORY_PHYSICS,
+		MEMORY_PHYSICS_MAX,
+		MEMORY_SCRIPT,
+		MEMORY_SCRIPT_MAX,
+		MEMORY_RESOURCE,
+		MEMORY_RESOURCE_MAX,
+		MEMORY_AUDIO,
+		MEMORY_AUDIO_MAX,
+		MEMORY_NAVIGATION,
+		MEMORY_NAVIGATION_MAX,
 		MONITOR_MAX
 	};
 
@@ -98,6 +98,9 @@ complete -c godot -l disable-render-loop -d "Disable render loop so rendering on
 complete -c godot -l disable-crash-handler -d "Disable crash handler when supported by the platform code"
 complete -c godot -l fixed-fps -d "Force a fixed number of frames per second (this setting disables real-time synchronization)" -x
 complete -c godot -l print-fps -d "Print the frames per second to the stdout"
+complete -c godot -l server-ticks -d "Iterate once per physics tick and skip rendering and audio work (requires --headless)"
+complete -c godot -l startup-trace -d "Record the duration of each startup phase and save it to a given file in the Chrome trace event format" -x
+complete -c godot -l trace -d "Record engine zones on all threads and save them to a given file in the Chrome trace event format on exit" -x
 
 # Standalone tools:
 complete -c godot -s s -l script -d "Run a script" -r
@@ -30,6 +30,7 @@
 
 #include "image_compress_basisu.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering_server.h"
 
 #include <transcoder/basisu_transcoder.h>
@@ -206,6 +207,40 @@ Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::UsedCha
 }
 #endif // TOOLS_ENABLED
 
+struct BasisUniversalTranscodeData {
+	const basist::basisu_transcoder *transcoder = nullptr;
+	const uint8_t *src_ptr = nullptr;
+	int src_size = 0;
+	basist::transcoder_texture_format basisu_format = basist::transcoder_texture_format::cTFTotalTextureFormats;
+	Image::Format image_format = Image::FORMAT_MAX;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t levels = 0;
+	uint8_t *dst = nullptr;
+	int64_t dst_size = 0;
+};
+
+static void _basis_universal_transcode_level(void *p_userdata, uint32_t p_level) {
+	const BasisUniversalTranscodeData &data = *static_cast<BasisUniversalTranscodeData *>(p_userdata);
+
+	basist::basisu_image_level_info basisu_level;
+	data.transcoder->get_image_level_info(data.src_ptr, data.src_size, basisu_level, 0, p_level);
+
+	uint32_t mip_block_or_pixel_count = Image::is_format_compressed(data.image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
+	int64_t ofs = Image::get_image_mipmap_offset(data.width, data.height, data.image_format, p_level);
+
+	// The transcoder is only thread-safe with a state per thread.
+	basist::basisu_transcoder_state state;
+	bool result = data.transcoder->transcode_image_level(data.src_ptr, data.src_size, 0, p_level, data.dst + ofs, mip_block_or_pixel_count, data.basisu_format, 0, 0, &state);
+
+	if (!result) {
+		print_line(vformat("BasisUniversal cannot unpack level %d.", p_level));
+		// Leave the level blank rather than uninitialized.
+		int64_t end = p_level + 1 < data.levels ? Image::get_image_mipmap_offset(data.width, data.height, data.image_format, p_level + 1) : data.dst_size;
+		memset(data.dst + ofs, 0, end - ofs);
+	}
+}
+
 Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	Ref<Image> image;
 	ERR_FAIL_NULL_V_MSG(p_data, image, "Cannot unpack invalid BasisUniversal data.");
@@ -295,25 +330,30 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	basist::basisu_image_info basisu_info;
 	transcoder.get_image_info(src_ptr, src_size, basisu_info, 0);
 
-	// Create the buffer for transcoded/decompressed data.
+	// Create the buffer for transcoded/decompressed data. The levels are transcoded
+	// straight into it, and the image takes it over without a copy.
 	Vector<uint8_t> out_data;
 	out_data.resize(Image::get_image_data_size(basisu_info.m_width, basisu_info.m_height, image_format, basisu_info.m_total_levels > 1));
 
-	uint8_t *dst = out_data.ptrw();
-	memset(dst, 0, out_data.size());
-
-	for (uint32_t i = 0; i < basisu_info.m_total_levels; i++) {
-		basist::basisu_image_level_info basisu_level;
-		transcoder.get_image_level_info(src_ptr, src_size, basisu_level, 0, i);
-
-		uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
-		int64_t ofs = Image::get_image_mipmap_offset(basisu_info.m_width, basisu_info.m_height, image_format, i);
-
-		bool result = transcoder.transcode_image_level(src_ptr, src_size, 0, i, dst + ofs, mip_block_or_pixel_count, basisu_format);
-
-		if (!result) {
-			print_line(vformat("BasisUniversal cannot unpack level %d.", i));
-			break;
+	BasisUniversalTranscodeData data;
+	data.transcoder = &transcoder;
+	data.src_ptr = src_ptr;
+	data.src_size = src_size;
+	data.basisu_format = basisu_format;
+	data.image_format = image_format;
+	data.width = basisu_info.m_width;
+	data.height = basisu_info.m_height;
+	data.levels = basisu_info.m_total_levels;
+	data.dst = out_data.ptrw();
+	data.dst_size = out_data.size();
+
+	// Levels are independent, transcode them in parallel for large enough images.
+	if (basisu_info.m_total_levels > 1 && basisu_info.m_width * basisu_info.m_height >= 256 * 256) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_basis_universal_transcode_level, &data, basisu_info.m_total_levels, -1, true, SNAME("BasisUniversalTranscode"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < basisu_info.m_total_levels; i++) {
+			_basis_universal_transcode_level(&data, i);
 		}
 	}
 
@@ -31,6 +31,7 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -167,76 +168,124 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 	dirty = true;
 }
 
-CSGBrush *CSGShape3D::_get_brush() {
-	if (dirty) {
-		if (brush) {
-			memdelete(brush);
+void CSGShape3D::_collect_dirty_shapes(LocalVector<CSGShape3D *> &r_shapes) {
+	// Runs on the main thread: reads the scene tree and builds this shape's own brush.
+	// Clean children keep their cached brush, only the dirty branches are merged again.
+	merge_children.clear();
+	merge_level = 0;
+
+	for (int i = 0; i < get_child_count(); i++) {
+		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (!child) {
+			continue;
+		}
+		if (!child->is_visible()) {
+			continue;
+		}
+
+		if (child->dirty) {
+			child->_collect_dirty_shapes(r_shapes);
+			merge_level = MAX(merge_level, child->merge_level + 1);
 		}
-		brush = nullptr;
 
-		CSGBrush *n = _build_brush();
+		MergeChild merge_child;
+		merge_child.shape = child;
+		merge_child.transform = child->get_transform();
+		merge_child.operation = child->get_operation();
+		merge_children.push_back(merge_child);
+	}
 
-		for (int i = 0; i < get_child_count(); i++) {
-			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
-			if (!child) {
-				continue;
-			}
-			if (!child->is_visible()) {
-				continue;
-			}
+	if (brush) {
+		memdelete(brush);
+	}
+	brush = _build_brush();
 
-			CSGBrush *n2 = child->_get_brush();
-			if (!n2) {
-				continue;
-			}
-			if (!n) {
-				n = memnew(CSGBrush);
+	r_shapes.push_back(this);
+}
 
-				n->copy_from(*n2, child->get_transform());
+void CSGShape3D::_merge_shape_brushes(uint32_t p_index, CSGShape3D **p_shapes) {
+	// Only touches the shape's own brush and the finished brushes of its children, so independent shapes can run on any thread.
+	CSGShape3D *shape = p_shapes[p_index];
+	CSGBrush *n = shape->brush;
 
-			} else {
-				CSGBrush *nn = memnew(CSGBrush);
-				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
-
-				CSGBrushOperation bop;
-
-				switch (child->get_operation()) {
-					case CSGShape3D::OPERATION_UNION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_INTERSECTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_SUBTRACTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
-						break;
-				}
-				memdelete(n);
-				memdelete(nn2);
-				n = nn;
+	for (const MergeChild &merge_child : shape->merge_children) {
+		CSGBrush *n2 = merge_child.shape->brush;
+		if (!n2) {
+			continue;
+		}
+		if (!n) {
+			n = memnew(CSGBrush);
+
+			n->copy_from(*n2, merge_child.transform);
+
+		} else {
+			CSGBrush *nn = memnew(CSGBrush);
+			CSGBrush *nn2 = memnew(CSGBrush);
+			nn2->copy_from(*n2, merge_child.transform);
+
+			CSGBrushOperation bop;
+
+			switch (merge_child.operation) {
+				case CSGShape3D::OPERATION_UNION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, shape->snap);
+					break;
+				case CSGShape3D::OPERATION_INTERSECTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, shape->snap);
+					break;
+				case CSGShape3D::OPERATION_SUBTRACTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, shape->snap);
+					break;
 			}
+			memdelete(n);
+			memdelete(nn2);
+			n = nn;
 		}
+	}
+	shape->merge_children.clear();
 
-		if (n) {
-			AABB aabb;
-			for (int i = 0; i < n->faces.size(); i++) {
-				for (int j = 0; j < 3; j++) {
-					if (i == 0 && j == 0) {
-						aabb.position = n->faces[i].vertices[j];
-					} else {
-						aabb.expand_to(n->faces[i].vertices[j]);
-					}
+	if (n) {
+		AABB aabb;
+		for (int i = 0; i < n->faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				if (i == 0 && j == 0) {
+					aabb.position = n->faces[i].vertices[j];
+				} else {
+					aabb.expand_to(n->faces[i].vertices[j]);
 				}
 			}
-			node_aabb = aabb;
-		} else {
-			node_aabb = AABB();
 		}
+		shape->node_aabb = aabb;
+	} else {
+		shape->node_aabb = AABB();
+	}
+
+	shape->brush = n;
+	shape->dirty = false;
+}
 
-		brush = n;
+CSGBrush *CSGShape3D::_get_brush() {
+	if (dirty) {
+		LocalVector<CSGShape3D *> dirty_shapes;
+		_collect_dirty_shapes(dirty_shapes);
+
+		// A shape's level is above those of all its dirty children, so merging level by level
+		// always finds the children done. This shape has the highest level.
+		LocalVector<CSGShape3D *> level_shapes;
+		for (uint32_t level = 0; level <= merge_level; level++) {
+			level_shapes.clear();
+			for (CSGShape3D *shape : dirty_shapes) {
+				if (shape->merge_level == level) {
+					level_shapes.push_back(shape);
+				}
+			}
 
-		dirty = false;
+			if (level_shapes.size() > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_merge_shape_brushes, level_shapes.ptr(), level_shapes.size(), -1, true, SNAME("CSGMergeBrushes"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else if (level_shapes.size() == 1) {
+				_merge_shape_brushes(0, level_shapes.ptr());
+			}
+		}
 	}
 
 	return brush;
@@ -307,6 +356,13 @@ void CSGShape3D::_update_shape() {
 	CSGBrush *n = _get_brush();
 	ERR_FAIL_NULL_MSG(n, "Cannot get CSGBrush.");
 
+	// The collision faces only need the brush, so they're built on a worker while the render mesh is built here.
+	// They're handed to the shape on this thread after the wait below, so the physics server isn't used from the worker.
+	WorkerThreadPool::TaskID collision_task = WorkerThreadPool::INVALID_TASK_ID;
+	if (use_collision && root_collision_shape.is_valid()) {
+		collision_task = WorkerThreadPool::get_singleton()->add_template_task(this, &CSGShape3D::_build_collision_faces, n, true, SNAME("CSGCollisionFaces"));
+	}
+
 	OAHashMap<Vector3, Vector3> vec_map;
 
 	Vector<int> face_count;
@@ -457,34 +513,32 @@ void CSGShape3D::_update_shape() {
 
 	set_base(root_mesh->get_rid());
 
-	_update_collision_faces();
-}
-
-void CSGShape3D::_update_collision_faces() {
-	if (use_collision && is_root_shape() && root_collision_shape.is_valid()) {
-		CSGBrush *n = _get_brush();
-		ERR_FAIL_NULL_MSG(n, "Cannot get CSGBrush.");
-		Vector<Vector3> physics_faces;
-		physics_faces.resize(n->faces.size() * 3);
-		Vector3 *physicsw = physics_faces.ptrw();
-
-		for (int i = 0; i < n->faces.size(); i++) {
-			int order[3] = { 0, 1, 2 };
+	if (collision_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(collision_task);
 
-			if (n->faces[i].invert) {
-				SWAP(order[1], order[2]);
-			}
+		root_collision_shape->set_faces(collision_faces);
+		collision_faces.clear();
 
-			physicsw[i * 3 + 0] = n->faces[i].vertices[order[0]];
-			physicsw[i * 3 + 1] = n->faces[i].vertices[order[1]];
-			physicsw[i * 3 + 2] = n->faces[i].vertices[order[2]];
+		if (_is_debug_collision_shape_visible()) {
+			_update_debug_collision_shape();
 		}
+	}
+}
 
-		root_collision_shape->set_faces(physics_faces);
+void CSGShape3D::_build_collision_faces(CSGBrush *p_brush) {
+	collision_faces.resize(p_brush->faces.size() * 3);
+	Vector3 *physicsw = collision_faces.ptrw();
 
-		if (_is_debug_collision_shape_visible()) {
-			_update_debug_collision_shape();
+	for (int i = 0; i < p_brush->faces.size(); i++) {
+		int order[3] = { 0, 1, 2 };
+
+		if (p_brush->faces[i].invert) {
+			SWAP(order[1], order[2]);
 		}
+
+		physicsw[i * 3 + 0] = p_brush->faces[i].vertices[order[0]];
+		physicsw[i * 3 + 1] = p_brush->faces[i].vertices[order[1]];
+		physicsw[i * 3 + 2] = p_brush->faces[i].vertices[order[2]];
 	}
 }
 
@@ -33,6 +33,7 @@
 
 #include "csg.h"
 
+#include "core/templates/local_vector.h"
 #include "scene/3d/path_3d.h"
 #include "scene/3d/visual_instance_3d.h"
 #include "scene/resources/3d/concave_polygon_shape_3d.h"
@@ -56,6 +57,16 @@ private:
 
 	CSGBrush *brush = nullptr;
 
+	// Visible child shapes as gathered on the main thread, so merging can run on worker threads.
+	struct MergeChild {
+		CSGShape3D *shape = nullptr;
+		Transform3D transform;
+		Operation operation = OPERATION_UNION;
+	};
+	LocalVector<MergeChild> merge_children;
+	// Distance to the deepest dirty descendant; shapes on the same level merge in parallel.
+	uint32_t merge_level = 0;
+
 	AABB node_aabb;
 
 	bool dirty = false;
@@ -67,6 +78,7 @@ private:
 	uint32_t collision_mask = 1;
 	real_t collision_priority = 1.0;
 	Ref<ConcavePolygonShape3D> root_collision_shape;
+	Vector<Vector3> collision_faces; // Built on a worker by _update_shape().
 	RID root_collision_instance;
 	RID root_collision_debug_instance;
 	Transform3D debug_shape_old_transform;
@@ -107,8 +119,11 @@ private:
 	static void mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const float fvTangent[], const float fvBiTangent[], const float fMagS, const float fMagT,
 			const tbool bIsOrientationPreserving, const int iFace, const int iVert);
 
+	void _collect_dirty_shapes(LocalVector<CSGShape3D *> &r_shapes);
+	void _merge_shape_brushes(uint32_t p_index, CSGShape3D **p_shapes);
+
 	void _update_shape();
-	void _update_collision_faces();
+	void _build_collision_faces(CSGBrush *p_brush);
 	bool _is_debug_collision_shape_visible();
 	void _update_debug_collision_shape();
 	void _clear_debug_collision_shape();
@@ -75,6 +75,9 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	if (network_thread_enabled) {
+		_start_network_thread();
+	}
 	return OK;
 }
 
@@ -106,6 +109,9 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	if (network_thread_enabled) {
+		_start_network_thread();
+	}
 
 	return OK;
 }
@@ -149,11 +155,14 @@ void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event
 
 void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	HashSet<int> to_drop;
-	for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
-		if (E.value->is_active()) {
-			continue;
+	{
+		MutexLock lock(network_mutex);
+		for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
+			if (E.value->is_active()) {
+				continue;
+			}
+			to_drop.insert(E.key);
 		}
-		to_drop.insert(E.key);
 	}
 	for (const int &P : to_drop) {
 		peers.erase(P);
@@ -165,6 +174,56 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	}
 }
 
+void ENetMultiplayerPeer::_on_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		connection_status = CONNECTION_CONNECTED;
+		emit_signal(SNAME("peer_connected"), 1);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		if (connection_status == CONNECTION_CONNECTED) {
+			// Client just disconnected from server.
+			emit_signal(SNAME("peer_disconnected"), 1);
+		}
+		close();
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		_store_packet(1, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error.
+	}
+}
+
+void ENetMultiplayerPeer::_on_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		if (is_refusing_new_connections()) {
+			MutexLock lock(network_mutex);
+			p_event.peer->reset();
+			return;
+		}
+		// Client joined with invalid ID, probably trying to exploit us.
+		if (p_event.data < 2 || peers.has((int)p_event.data)) {
+			MutexLock lock(network_mutex);
+			p_event.peer->reset();
+			return;
+		}
+		int id = p_event.data;
+		p_event.peer->set_meta(SNAME("_net_id"), id);
+		peers[id] = p_event.peer;
+		emit_signal(SNAME("peer_connected"), id);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		int id = p_event.peer->get_meta(SNAME("_net_id"));
+		if (!peers.has(id)) {
+			// Never fully connected.
+			return;
+		}
+		emit_signal(SNAME("peer_disconnected"), id);
+		peers.erase(id);
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		int32_t source = p_event.peer->get_meta(SNAME("_net_id"));
+		_store_packet(source, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error
+	}
+}
+
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
@@ -172,6 +231,33 @@ void ENetMultiplayerPeer::poll() {
 
 	_disconnect_inactive_peers();
 
+	if (_is_network_threaded()) {
+		if (active_mode == MODE_CLIENT && !peers.has(1)) {
+			close();
+			return;
+		}
+		{
+			MutexLock lock(network_mutex);
+			SWAP(network_events, polled_events);
+		}
+		for (HostEvent &E : polled_events) {
+			if (!_is_active()) {
+				// Closed by a previous event, drop what is left.
+				if (E.type == ENetConnection::EVENT_RECEIVE) {
+					enet_packet_destroy(E.event.packet);
+				}
+				continue;
+			}
+			if (active_mode == MODE_CLIENT) {
+				_on_client_event(E.type, E.event);
+			} else {
+				_on_server_event(E.type, E.event);
+			}
+		}
+		polled_events.clear();
+		return;
+	}
+
 	switch (active_mode) {
 		case MODE_CLIENT: {
 			if (!peers.has(1)) {
@@ -181,54 +267,14 @@ void ENetMultiplayerPeer::poll() {
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					connection_status = CONNECTION_CONNECTED;
-					emit_signal(SNAME("peer_connected"), 1);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					if (connection_status == CONNECTION_CONNECTED) {
-						// Client just disconnected from server.
-						emit_signal(SNAME("peer_disconnected"), 1);
-					}
-					close();
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error.
-				}
+				_on_client_event(ret, event);
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_SERVER: {
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					if (is_refusing_new_connections()) {
-						event.peer->reset();
-						continue;
-					}
-					// Client joined with invalid ID, probably trying to exploit us.
-					if (event.data < 2 || peers.has((int)event.data)) {
-						event.peer->reset();
-						continue;
-					}
-					int id = event.data;
-					event.peer->set_meta(SNAME("_net_id"), id);
-					peers[id] = event.peer;
-					emit_signal(SNAME("peer_connected"), id);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					int id = event.peer->get_meta(SNAME("_net_id"));
-					if (!peers.has(id)) {
-						// Never fully connected.
-						continue;
-					}
-					emit_signal(SNAME("peer_disconnected"), id);
-					peers.erase(id);
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					int32_t source = event.peer->get_meta(SNAME("_net_id"));
-					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
-				}
+				_on_server_event(ret, event);
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_MESH: {
@@ -272,12 +318,17 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
-	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
-		hosts[0]->flush();
-	} else {
-		ERR_FAIL_COND(!hosts.has(p_peer));
-		hosts[p_peer]->flush();
+	{
+		MutexLock lock(network_mutex);
+		peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
+		if (_is_network_threaded()) {
+			// Flushed by the network thread.
+		} else if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+			hosts[0]->flush();
+		} else {
+			ERR_FAIL_COND(!hosts.has(p_peer));
+			hosts[p_peer]->flush();
+		}
 	}
 	if (p_force) {
 		peers.erase(p_peer);
@@ -298,6 +349,8 @@ void ENetMultiplayerPeer::close() {
 
 	_pop_current_packet();
 
+	_stop_network_thread();
+
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
 		if (E.value.is_valid() && E.value->get_state() == ENetPacketPeer::STATE_CONNECTED) {
 			E.value->peer_disconnect_now(0);
@@ -370,6 +423,10 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	// The network thread sends what is queued on its next service, so there is no need to flush each packet.
+	MutexLock lock(network_mutex);
+	const bool flush = !_is_network_threaded();
+
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -388,12 +445,16 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 			peers[target_peer]->send(channel, packet);
 		}
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush) {
+			hosts[0]->flush();
+		}
 
 	} else if (active_mode == MODE_CLIENT) {
 		peers[1]->send(channel, packet); // Send to server for broadcast.
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush) {
+			hosts[0]->flush();
+		}
 
 	} else {
 		if (target_peer <= 0) {
@@ -443,6 +504,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(network_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -464,6 +526,60 @@ Ref<ENetPacketPeer> ENetMultiplayerPeer::get_peer(int p_id) const {
 	return peers[p_id];
 }
 
+void ENetMultiplayerPeer::_network_thread_func(void *p_userdata) {
+	ENetMultiplayerPeer *mp = (ENetMultiplayerPeer *)p_userdata;
+	while (!mp->network_thread_exit.is_set()) {
+		{
+			MutexLock lock(mp->network_mutex);
+			HostEvent ev;
+			ev.type = mp->network_host->service(0, ev.event);
+			while (ev.type != ENetConnection::EVENT_NONE) {
+				mp->network_events.push_back(ev);
+				if (ev.type == ENetConnection::EVENT_ERROR) {
+					break;
+				}
+				ev = HostEvent();
+				if (mp->network_host->check_events(ev.type, ev.event) <= 0) {
+					break;
+				}
+			}
+		}
+		OS::get_singleton()->delay_usec(NETWORK_THREAD_INTERVAL_USEC);
+	}
+}
+
+void ENetMultiplayerPeer::_start_network_thread() {
+	ERR_FAIL_COND(network_thread.is_started());
+	ERR_FAIL_COND(!hosts.has(0));
+	network_host = hosts[0];
+	network_thread_exit.clear();
+	network_thread.start(_network_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_network_thread() {
+	if (!network_thread.is_started()) {
+		return;
+	}
+	network_thread_exit.set();
+	network_thread.wait_to_finish();
+	network_host.unref();
+	for (HostEvent &E : network_events) {
+		if (E.type == ENetConnection::EVENT_RECEIVE) {
+			enet_packet_destroy(E.event.packet);
+		}
+	}
+	network_events.clear();
+}
+
+void ENetMultiplayerPeer::set_network_thread_enabled(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The network thread can only be enabled or disabled while the multiplayer instance isn't active.");
+	network_thread_enabled = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_network_thread_enabled() const {
+	return network_thread_enabled;
+}
+
 void ENetMultiplayerPeer::_destroy_unused(ENetPacket *p_packet) {
 	if (p_packet->referenceCount == 0) {
 		enet_packet_destroy(p_packet);
@@ -480,7 +596,11 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
+	ClassDB::bind_method(D_METHOD("set_network_thread_enabled", "enabled"), &ENetMultiplayerPeer::set_network_thread_enabled);
+	ClassDB::bind_method(D_METHOD("is_network_thread_enabled"), &ENetMultiplayerPeer::is_network_thread_enabled);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "network_thread"), "set_network_thread_enabled", "is_network_thread_enabled");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -34,6 +34,10 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -82,6 +86,31 @@ private:
 
 	Packet current_packet;
 
+	// Network thread mode, only used by servers and clients.
+	// The thread services the host and hands events over in batches, every ENet
+	// call made from the main thread must hold network_mutex.
+	static constexpr uint64_t NETWORK_THREAD_INTERVAL_USEC = 1000;
+
+	struct HostEvent {
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	bool network_thread_enabled = false;
+	Thread network_thread;
+	SafeFlag network_thread_exit;
+	Mutex network_mutex;
+	Ref<ENetConnection> network_host;
+	LocalVector<HostEvent> network_events;
+	LocalVector<HostEvent> polled_events;
+
+	static void _network_thread_func(void *p_userdata);
+	void _start_network_thread();
+	void _stop_network_thread();
+	_FORCE_INLINE_ bool _is_network_threaded() const { return network_thread.is_started(); }
+
+	void _on_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
+	void _on_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
@@ -126,6 +155,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_network_thread_enabled(bool p_enabled);
+	bool is_network_thread_enabled() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
@@ -730,6 +730,7 @@ void GDScript::_restore_old_static_data() {
 #endif
 
 Error GDScript::reload(bool p_keep_state) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_SCRIPT);
 	if (reloading) {
 		return OK;
 	}
@@ -744,6 +745,10 @@ Error GDScript::reload(bool p_keep_state) {
 
 	ERR_FAIL_COND_V(!p_keep_state && has_instances, ERR_ALREADY_IN_USE);
 
+	// The script is usually parsed and partially analyzed already, to be used by other scripts
+	// or by the shallow load. If the source didn't change, that work is reused.
+	Ref<GDScriptParserRef> cached_parser;
+
 	String basedir = path;
 
 	if (basedir.is_empty()) {
@@ -784,6 +789,8 @@ Error GDScript::reload(bool p_keep_state) {
 					}
 					if (parser_ref->get_source_hash() != source_hash) {
 						GDScriptCache::remove_parser(source_path);
+					} else if (!parser_ref->is_raising_status()) {
+						cached_parser = parser_ref;
 					}
 				}
 			}
@@ -799,32 +806,45 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
+	GDScriptParser local_parser;
+	GDScriptAnalyzer local_analyzer(&local_parser);
+	GDScriptParser *parser = &local_parser;
 	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
+	if (cached_parser.is_valid()) {
+		parser = cached_parser->get_parser();
+		err = cached_parser->raise_status(GDScriptParserRef::FULLY_SOLVED);
+		if (err == OK) {
+			err = cached_parser->get_analyzer()->resolve_dependencies();
+		}
 	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+		if (!binary_tokens.is_empty()) {
+			err = local_parser.parse_binary(binary_tokens, path);
+		} else {
+			err = local_parser.parse(source, path, false);
+		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), local_parser.get_errors().front()->get().line, "Parser Error: " + local_parser.get_errors().front()->get().message);
+			}
+			// TODO: Show all error messages.
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), local_parser.get_errors().front()->get().line, ("Parse Error: " + local_parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
-	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
+		err = local_analyzer.analyze();
+	}
 
 	if (err) {
+		if (parser->get_errors().is_empty()) {
+			reloading = false;
+			return err;
+		}
 		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().line, "Parser Error: " + parser->get_errors().front()->get().message);
 		}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
+		const List<GDScriptParser::ParserError>::Element *e = parser->get_errors().front();
 		while (e != nullptr) {
 			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
 			e = e->next();
@@ -833,10 +853,10 @@ Error GDScript::reload(bool p_keep_state) {
 		return ERR_PARSE_ERROR;
 	}
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+	can_run = ScriptServer::is_scripting_enabled() || parser->is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	err = compiler.compile(parser, this, p_keep_state);
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -855,11 +875,11 @@ Error GDScript::reload(bool p_keep_state) {
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
+	GDScriptDocGen::generate_docs(this, parser->get_tree());
 #endif
 
 #ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
+	for (const GDScriptWarning &warning : parser->get_warnings()) {
 		if (EngineDebugger::is_active()) {
 			Vector<ScriptLanguage::StackInfo> si;
 			EngineDebugger::get_script_debugger()->send_error("", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
@@ -1646,29 +1666,47 @@ GDScript::~GDScript() {
 //         INSTANCE         //
 //////////////////////////////
 
+bool GDScriptInstance::_set_member(const GDScript::MemberInfo &p_member, const Variant &p_value) {
+	Variant value = p_value;
+	if (p_member.data_type.has_type && !p_member.data_type.is_type(value)) {
+		const Variant *args = &p_value;
+		Callable::CallError err;
+		Variant::construct(p_member.data_type.builtin_type, value, &args, 1, err);
+		if (err.error != Callable::CallError::CALL_OK || !p_member.data_type.is_type(value)) {
+			return false;
+		}
+	}
+	if (likely(script->valid) && p_member.setter) {
+		const Variant *args = &value;
+		Callable::CallError err;
+		callp(p_member.setter, &args, 1, err);
+		return err.error == Callable::CallError::CALL_OK;
+	} else {
+		members.write[p_member.index] = value;
+		return true;
+	}
+}
+
+bool GDScriptInstance::set_member_cached(const StringName &p_name, const Variant &p_value, int &r_slot) {
+	// The slot may be stale if the script was reloaded, so make sure it still refers to the same name.
+	if (r_slot >= 0 && r_slot < (int)script->member_slots.size() && script->member_slots[r_slot]->key == p_name && r_slot < members.size()) {
+		return _set_member(script->member_slots[r_slot]->value, p_value);
+	}
+
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+	if (!E) {
+		r_slot = MEMBER_SLOT_NONE;
+		return false;
+	}
+	r_slot = E->value.index;
+	return _set_member(E->value, p_value);
+}
+
 bool GDScriptInstance::set(const StringName &p_name, const Variant &p_value) {
 	{
 		HashMap<StringName, GDScript::MemberInfo>::Iterator E = script->member_indices.find(p_name);
 		if (E) {
-			const GDScript::MemberInfo *member = &E->value;
-			Variant value = p_value;
-			if (member->data_type.has_type && !member->data_type.is_type(value)) {
-				const Variant *args = &p_value;
-				Callable::CallError err;
-				Variant::construct(member->data_type.builtin_type, value, &args, 1, err);
-				if (err.error != Callable::CallError::CALL_OK || !member->data_type.is_type(value)) {
-					return false;
-				}
-			}
-			if (likely(script->valid) && member->setter) {
-				const Variant *args = &value;
-				Callable::CallError err;
-				callp(member->setter, &args, 1, err);
-				return err.error == Callable::CallError::CALL_OK;
-			} else {
-				members.write[member->index] = value;
-				return true;
-			}
+			return _set_member(E->value, p_value);
 		}
 	}
 
@@ -2181,6 +2219,49 @@ void GDScriptLanguage::_add_global(const StringName &p_name, const Variant &p_va
 	_global_array = global_array.ptrw();
 }
 
+Vector<uint8_t> GDScriptLanguage::_acquire_await_stack(uint32_t p_size) {
+	Vector<uint8_t> stack;
+	uint32_t size = next_power_of_2(MAX(p_size, 1u << AWAIT_STACK_MIN_SHIFT));
+	int size_class = get_shift_from_power_of_2(size) - AWAIT_STACK_MIN_SHIFT;
+	if (size_class >= AWAIT_STACK_SIZE_CLASSES) {
+		stack.resize(p_size);
+		return stack;
+	}
+
+	{
+		MutexLock lock(mutex);
+		LocalVector<Vector<uint8_t>> &pool = await_stack_pool[size_class];
+		if (!pool.is_empty()) {
+			stack = pool[pool.size() - 1];
+			pool.resize(pool.size() - 1);
+			await_stack_pool_bytes -= stack.size();
+			return stack;
+		}
+	}
+
+	stack.resize(size);
+	return stack;
+}
+
+void GDScriptLanguage::_release_await_stack(Vector<uint8_t> &r_stack) {
+	uint32_t size = r_stack.size();
+	// Only buffers handed out by `_acquire_await_stack()` have a size class.
+	int size_class = get_shift_from_power_of_2(size) - AWAIT_STACK_MIN_SHIFT;
+	if (size_class < 0 || size_class >= AWAIT_STACK_SIZE_CLASSES) {
+		r_stack.clear();
+		return;
+	}
+
+	MutexLock lock(mutex);
+	if (finishing || await_stack_pool_bytes + size > AWAIT_STACK_POOL_MAX_BYTES) {
+		r_stack.clear();
+		return;
+	}
+	await_stack_pool[size_class].push_back(r_stack);
+	await_stack_pool_bytes += size;
+	r_stack.clear();
+}
+
 void GDScriptLanguage::add_global_constant(const StringName &p_variable, const Variant &p_value) {
 	_add_global(p_variable, p_value);
 }
@@ -2257,6 +2338,14 @@ void GDScriptLanguage::finish() {
 
 	_call_stack.free();
 
+	{
+		MutexLock lock(mutex);
+		for (LocalVector<Vector<uint8_t>> &pool : await_stack_pool) {
+			pool.clear();
+		}
+		await_stack_pool_bytes = 0;
+	}
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -98,6 +98,7 @@ class GDScript : public Script {
 
 	// Members are just indices to the instantiated script.
 	HashMap<StringName, MemberInfo> member_indices; // Includes member info of all base GDScript classes.
+	LocalVector<const KeyValue<StringName, MemberInfo> *> member_slots; // Entries of `member_indices` by index.
 	HashSet<StringName> members; // Only members of the current class.
 
 	// Only static variables of the current class.
@@ -367,11 +368,13 @@ class GDScriptInstance : public ScriptInstance {
 	SelfList<GDScriptFunctionState>::List pending_func_states;
 
 	void _call_implicit_ready_recursively(GDScript *p_script);
+	bool _set_member(const GDScript::MemberInfo &p_member, const Variant &p_value);
 
 public:
 	virtual Object *get_owner() { return owner; }
 
 	virtual bool set(const StringName &p_name, const Variant &p_value);
+	virtual bool set_member_cached(const StringName &p_name, const Variant &p_value, int &r_slot);
 	virtual bool get(const StringName &p_name, Variant &r_ret) const;
 	virtual void get_property_list(List<PropertyInfo> *p_properties) const;
 	virtual Variant::Type get_property_type(const StringName &p_name, bool *r_is_valid = nullptr) const;
@@ -459,6 +462,18 @@ class GDScriptLanguage : public ScriptLanguage {
 	friend class GDScriptFunction;
 
 	SelfList<GDScriptFunction>::List function_list;
+
+	// Stack buffers of `await` states that are gone, reused by the next ones instead of allocating.
+	// Sizes are rounded up to a power of two.
+	static constexpr int AWAIT_STACK_MIN_SHIFT = 8;
+	static constexpr int AWAIT_STACK_SIZE_CLASSES = 10; // 256 bytes to 128 KiB.
+	static constexpr uint64_t AWAIT_STACK_POOL_MAX_BYTES = 8 * 1024 * 1024;
+	LocalVector<Vector<uint8_t>> await_stack_pool[AWAIT_STACK_SIZE_CLASSES];
+	uint64_t await_stack_pool_bytes = 0;
+
+	Vector<uint8_t> _acquire_await_stack(uint32_t p_size);
+	void _release_await_stack(Vector<uint8_t> &r_stack);
+
 	bool profiling;
 	bool profile_native_calls;
 	uint64_t script_frame_time;
@@ -536,6 +551,9 @@ public:
 
 	} strings;
 
+	// Increased every time a script is compiled, which can invalidate what inline caches resolved.
+	SafeNumeric<uint32_t> compilation_version;
+
 	_FORCE_INLINE_ int get_global_array_size() const { return global_array.size(); }
 	_FORCE_INLINE_ Variant *get_global_array() { return _global_array; }
 	_FORCE_INLINE_ const HashMap<StringName, int> &get_global_map() const { return globals; }
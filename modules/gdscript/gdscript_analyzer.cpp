@@ -199,6 +199,29 @@ static GDScriptParser::DataType make_builtin_meta_type(Variant::Type p_type) {
 	return type;
 }
 
+// Values of these types are stored by reference, so folding them at compile time
+// would make every evaluation of the expression share the same instance.
+static bool is_type_safe_to_fold(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::OBJECT:
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+		case Variant::PACKED_BYTE_ARRAY:
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_COLOR_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return false;
+		default:
+			return true;
+	}
+}
+
 bool GDScriptAnalyzer::has_member_name_conflict_in_script_class(const StringName &p_member_name, const GDScriptParser::ClassNode *p_class, const GDScriptParser::Node *p_member) {
 	if (p_class->members_indices.has(p_member_name)) {
 		int index = p_class->members_indices[p_member_name];
@@ -3057,30 +3080,7 @@ void GDScriptAnalyzer::reduce_call(GDScriptParser::CallNode *p_call, bool p_is_a
 			call_type.kind = GDScriptParser::DataType::BUILTIN;
 			call_type.builtin_type = builtin_type;
 
-			bool safe_to_fold = true;
-			switch (builtin_type) {
-				// Those are stored by reference so not suited for compile-time construction.
-				// Because in this case they would be the same reference in all constructed values.
-				case Variant::OBJECT:
-				case Variant::DICTIONARY:
-				case Variant::ARRAY:
-				case Variant::PACKED_BYTE_ARRAY:
-				case Variant::PACKED_INT32_ARRAY:
-				case Variant::PACKED_INT64_ARRAY:
-				case Variant::PACKED_FLOAT32_ARRAY:
-				case Variant::PACKED_FLOAT64_ARRAY:
-				case Variant::PACKED_STRING_ARRAY:
-				case Variant::PACKED_VECTOR2_ARRAY:
-				case Variant::PACKED_VECTOR3_ARRAY:
-				case Variant::PACKED_COLOR_ARRAY:
-				case Variant::PACKED_VECTOR4_ARRAY:
-					safe_to_fold = false;
-					break;
-				default:
-					break;
-			}
-
-			if (all_is_constant && safe_to_fold) {
+			if (all_is_constant && is_type_safe_to_fold(builtin_type)) {
 				// Construct here.
 				Vector<const Variant *> args;
 				for (int i = 0; i < p_call->arguments.size(); i++) {
@@ -3462,6 +3462,27 @@ void GDScriptAnalyzer::reduce_call(GDScriptParser::CallNode *p_call, bool p_is_a
 #endif // DEBUG_ENABLED
 
 		call_type = return_type;
+
+		// Static methods of builtin types only depend on their arguments, so they can be called on compilation.
+		// Callables and signals are left out since they may point to an object.
+		if (all_is_constant && p_call->is_static && base_type.is_meta_type && base_type.kind == GDScriptParser::DataType::BUILTIN &&
+				return_type.is_hard_type() && return_type.kind == GDScriptParser::DataType::BUILTIN && return_type.builtin_type != Variant::NIL &&
+				return_type.builtin_type != Variant::CALLABLE && return_type.builtin_type != Variant::SIGNAL && is_type_safe_to_fold(return_type.builtin_type)) {
+			Vector<const Variant *> args;
+			for (int i = 0; i < p_call->arguments.size(); i++) {
+				args.push_back(&(p_call->arguments[i]->reduced_value));
+			}
+
+			Variant value;
+			Callable::CallError err;
+			Variant::call_static(base_type.builtin_type, p_call->function_name, (const Variant **)args.ptr(), args.size(), value, err);
+
+			// Argument errors were already reported above, otherwise they are raised at runtime.
+			if (err.error == Callable::CallError::CALL_OK) {
+				p_call->is_constant = true;
+				p_call->reduced_value = value;
+			}
+		}
 	} else {
 		bool found = false;
 
@@ -395,6 +395,15 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (named_cache_count) {
+		function->named_caches.resize(named_cache_count);
+		function->_named_caches_ptr = function->named_caches.ptrw();
+		function->_named_caches_count = named_cache_count;
+	} else {
+		function->_named_caches_ptr = nullptr;
+		function->_named_caches_count = 0;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -595,8 +604,28 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		Variant::Type left_type = p_left_operand.type.builtin_type;
+		Variant::Type right_type = p_right_operand.type.builtin_type;
+
+		// Integer addition and subtraction (e.g. loop counters) don't need to go through an evaluator.
+		if (left_type == Variant::INT && right_type == Variant::INT && (p_operator == Variant::OP_ADD || p_operator == Variant::OP_SUBTRACT)) {
+			append_opcode(p_operator == Variant::OP_ADD ? GDScriptFunction::OPCODE_OPERATOR_ADD_INT : GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			return;
+		}
+
+		bool is_comparison = p_operator == Variant::OP_EQUAL || p_operator == Variant::OP_NOT_EQUAL || p_operator == Variant::OP_LESS || p_operator == Variant::OP_LESS_EQUAL || p_operator == Variant::OP_GREATER || p_operator == Variant::OP_GREATER_EQUAL;
+		if (is_comparison && p_target.mode == Address::TEMPORARY && left_type == right_type && (left_type == Variant::INT || left_type == Variant::FLOAT)) {
+			fusable_comparison_pos = opcodes.size();
+			fusable_comparison_temp = p_target.address;
+			fusable_comparison_operator = p_operator;
+			fusable_comparison_opcode = left_type == Variant::INT ? GDScriptFunction::OPCODE_JUMP_IF_NOT_INT_COMPARE : GDScriptFunction::OPCODE_JUMP_IF_NOT_FLOAT_COMPARE;
+		}
+
 		// Gather specific operator.
-		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, left_type, right_type);
 
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
@@ -790,7 +819,14 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source)) {
-		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
+		if (p_source.type.builtin_type == Variant::ARRAY && IS_BUILTIN_TYPE(p_index, Variant::INT)) {
+			// Arrays are indexed in place, without going through the indexed getter.
+			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_ARRAY);
+			append(p_source);
+			append(p_index);
+			append(p_target);
+			return;
+		} else if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
 			Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(p_source.type.builtin_type);
 			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED);
@@ -832,6 +868,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_named_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -850,6 +887,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_named_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -1040,6 +1078,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_named_cache();
 	ct.cleanup();
 }
 
@@ -1065,6 +1104,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_named_cache();
 	ct.cleanup();
 }
 
@@ -1290,7 +1330,7 @@ void GDScriptByteCodeGenerator::write_call_method_bind_validated(const Address &
 }
 
 void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
-	append_opcode_and_argcount(p_target.mode == Address::NIL ? GDScriptFunction::OPCODE_CALL : GDScriptFunction::OPCODE_CALL_RETURN, 2 + p_arguments.size());
+	append_opcode_and_argcount(p_target.mode == Address::NIL ? GDScriptFunction::OPCODE_CALL_SELF : GDScriptFunction::OPCODE_CALL_SELF_RETURN, 2 + p_arguments.size());
 	for (int i = 0; i < p_arguments.size(); i++) {
 		append(p_arguments[i]);
 	}
@@ -1299,6 +1339,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_named_cache();
 	ct.cleanup();
 }
 
@@ -1312,6 +1353,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_named_cache();
 	ct.cleanup();
 }
 
@@ -1325,6 +1367,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_named_cache();
 	ct.cleanup();
 }
 
@@ -1441,9 +1484,26 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 	append(p_target);
 }
 
+bool GDScriptByteCodeGenerator::fuse_comparison_jump(const Address &p_condition) {
+	// The comparison must be the instruction right before, and produce the condition.
+	constexpr int operator_size = 5;
+	if (fusable_comparison_pos == -1 || fusable_comparison_pos + operator_size != opcodes.size() || p_condition.mode != Address::TEMPORARY || p_condition.address != fusable_comparison_temp) {
+		return false;
+	}
+
+	// Turn the validated operator into a compare-and-jump. It keeps the operands and still stores
+	// the result, but the operator function is replaced by the operator itself.
+	opcodes.write[fusable_comparison_pos] = fusable_comparison_opcode;
+	opcodes.write[fusable_comparison_pos + 4] = fusable_comparison_operator;
+	fusable_comparison_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_comparison_jump(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1537,10 +1597,23 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_DICTIONARY;
 					iterate_opcode = GDScriptFunction::OPCODE_ITERATE_DICTIONARY;
 					break;
-				case Variant::ARRAY:
+				case Variant::ARRAY: {
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY;
 					iterate_opcode = GDScriptFunction::OPCODE_ITERATE_ARRAY;
-					break;
+					if (!p_use_conversion && container.type.has_container_element_type(0)) {
+						// Typed arrays of scalars can write the element straight into the iterator.
+						const GDScriptDataType element_type = container.type.get_container_element_type(0);
+						if (element_type.has_type && element_type.kind == GDScriptDataType::BUILTIN) {
+							if (element_type.builtin_type == Variant::INT) {
+								begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY_INT;
+								iterate_opcode = GDScriptFunction::OPCODE_ITERATE_ARRAY_INT;
+							} else if (element_type.builtin_type == Variant::FLOAT) {
+								begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY_FLOAT;
+								iterate_opcode = GDScriptFunction::OPCODE_ITERATE_ARRAY_FLOAT;
+							}
+						}
+					}
+				} break;
 				case Variant::PACKED_BYTE_ARRAY:
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY;
 					iterate_opcode = GDScriptFunction::OPCODE_ITERATE_PACKED_BYTE_ARRAY;
@@ -1649,12 +1722,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	fusable_comparison_pos = -1;
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_comparison_jump(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
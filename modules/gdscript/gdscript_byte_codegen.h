@@ -99,6 +99,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	// Last validated comparison of two ints or two floats into a temporary. If it's the
+	// condition of the next `if` or `while`, it's fused with the conditional jump.
+	int fusable_comparison_pos = -1;
+	uint32_t fusable_comparison_temp = 0;
+	Variant::Operator fusable_comparison_operator = Variant::OP_EQUAL;
+	GDScriptFunction::Opcode fusable_comparison_opcode = GDScriptFunction::OPCODE_JUMP_IF_NOT_INT_COMPARE;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -121,6 +128,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	RBMap<GDScriptUtilityFunctions::FunctionPtr, int> gds_utilities_map;
 	RBMap<MethodBind *, int> method_bind_map;
 	RBMap<GDScriptFunction *, int> lambdas_map;
+	int named_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	// Keep method and property names for pointer and validated operations.
@@ -395,6 +403,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_name_map_pos(p_name));
 	}
 
+	void append_named_cache() {
+		opcodes.push_back(named_cache_count++);
+	}
+
 	void append(const Variant::ValidatedOperatorEvaluator p_operation) {
 		opcodes.push_back(get_operation_pos(p_operation));
 	}
@@ -449,8 +461,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		fusable_comparison_pos = -1; // Code can jump between the comparison and what follows.
 	}
 
+	bool fuse_comparison_jump(const Address &p_condition);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -64,10 +64,52 @@ GDScriptAnalyzer *GDScriptParserRef::get_analyzer() {
 	return analyzer;
 }
 
+void GDScriptParserRef::_parse() {
+	String remapped_path = ResourceLoader::path_remap(path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+		source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+		result = parser->parse_binary(tokens, path);
+	} else {
+		String source = GDScriptCache::get_source_code(remapped_path);
+		source_hash = source.hash();
+		result = parser->parse(source, path, false);
+	}
+}
+
+void GDScriptParserRef::_parse_task(void *p_ref) {
+	GDScriptParserRef *ref = static_cast<GDScriptParserRef *>(p_ref);
+	MutexLock lock(ref->parse_mutex);
+	if (ref->parse_pending) {
+		ref->parse_pending = false;
+		ref->_parse();
+	}
+}
+
+void GDScriptParserRef::_finish_parse() {
+	if (!prefetching) {
+		return;
+	}
+	{
+		// Parses here if no worker got to it yet, or waits for the one doing it.
+		MutexLock lock(parse_mutex);
+		if (parse_pending) {
+			parse_pending = false;
+			_parse();
+		}
+	}
+	prefetching = false;
+	status = PARSED;
+}
+
 Error GDScriptParserRef::raise_status(Status p_new_status) {
 	ERR_FAIL_COND_V(clearing, ERR_BUG);
 	ERR_FAIL_COND_V(parser == nullptr && status != EMPTY, ERR_BUG);
 
+	// Even when no status is requested, so the source hash is known.
+	_finish_parse();
+
+	raising_depth++;
 	while (result == OK && p_new_status > status) {
 		switch (status) {
 			case EMPTY: {
@@ -75,16 +117,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				// It's ok if its the first thing done here.
 				get_parser()->clear();
 				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
-					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
-					result = get_parser()->parse_binary(tokens, path);
-				} else {
-					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
-				}
+				_parse();
 			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -99,10 +132,11 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				result = get_analyzer()->resolve_body();
 			} break;
 			case FULLY_SOLVED: {
-				return result;
+				break;
 			}
 		}
 	}
+	raising_depth--;
 
 	return result;
 }
@@ -113,6 +147,12 @@ void GDScriptParserRef::clear() {
 	}
 	clearing = true;
 
+	if (prefetching) {
+		MutexLock lock(parse_mutex);
+		parse_pending = false;
+		prefetching = false;
+	}
+
 	GDScriptParser *lparser = parser;
 	GDScriptAnalyzer *lanalyzer = analyzer;
 
@@ -121,6 +161,7 @@ void GDScriptParserRef::clear() {
 	status = EMPTY;
 	result = OK;
 	source_hash = 0;
+	dependencies_prefetched = false;
 
 	clearing = false;
 
@@ -224,11 +265,88 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 		ref->path = p_path;
 		singleton->parser_map[p_path] = ref.ptr();
 	}
+	singleton->prefetched_parsers.erase(p_path);
+
+	_expand_finished_prefetches();
 	r_error = ref->raise_status(p_status);
+	if (ref->status >= GDScriptParserRef::PARSED && !ref->dependencies_prefetched) {
+		_prefetch_dependencies(ref.ptr());
+	}
 
 	return ref;
 }
 
+// Scripts are usually loaded one dependency at a time, as the analyzer finds them. Once a
+// script is parsed, the scripts it names are parsed on worker threads while the analyzer is
+// busy, so they are ready when asked for. Analysis stays serial, it loads other resources.
+void GDScriptCache::_prefetch_dependencies(GDScriptParserRef *p_ref) {
+	p_ref->dependencies_prefetched = true;
+	if (p_ref->result != OK || WorkerThreadPool::get_singleton()->get_thread_count() == 0) {
+		return;
+	}
+
+	const GDScriptParser *parser = p_ref->get_parser();
+	HashSet<String> paths;
+	for (const String &E : parser->get_dependency_paths()) {
+		if (E.is_relative_path()) {
+			paths.insert(p_ref->path.get_base_dir().path_join(E).simplify_path());
+		} else {
+			paths.insert(E);
+		}
+	}
+	// Global classes are registered from the main thread, so they're looked up here rather than by the parser.
+	for (const StringName &E : parser->get_dependency_names()) {
+		if (ScriptServer::is_global_class(E) && ScriptServer::get_global_class_language(E) == SNAME("GDScript")) {
+			paths.insert(ScriptServer::get_global_class_path(E));
+		}
+	}
+
+	// Lazily filled by the first parser, not while parsing in parallel.
+	GDScriptParser::get_builtin_type(StringName());
+
+	for (const String &E : paths) {
+		if (E.get_extension().to_lower() != "gd" || singleton->parser_map.has(E) || !FileAccess::exists(ResourceLoader::path_remap(E))) {
+			continue;
+		}
+
+		Ref<GDScriptParserRef> ref;
+		ref.instantiate();
+		ref->path = E;
+		ref->get_parser();
+		ref->prefetching = true;
+		ref->parse_pending = true;
+
+		singleton->parser_map[E] = ref.ptr();
+		singleton->prefetched_parsers[E] = ref;
+
+		PrefetchTask prefetch;
+		// The task keeps the reference, so the parser outlives it even if it's removed meanwhile.
+		prefetch.parser_ref = ref;
+		prefetch.task = WorkerThreadPool::get_singleton()->add_native_task(&GDScriptParserRef::_parse_task, ref.ptr(), false, "Parse GDScript");
+		singleton->prefetch_tasks.push_back(prefetch);
+	}
+}
+
+// Finished prefetches start parsing their own dependencies, without waiting for the analyzer to reach them.
+void GDScriptCache::_expand_finished_prefetches() {
+	for (uint32_t i = 0; i < singleton->prefetch_tasks.size();) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(singleton->prefetch_tasks[i].task)) {
+			i++;
+			continue;
+		}
+
+		// Returns right away, but the task has to be reclaimed.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(singleton->prefetch_tasks[i].task);
+		Ref<GDScriptParserRef> ref = singleton->prefetch_tasks[i].parser_ref;
+		singleton->prefetch_tasks.remove_at_unordered(i);
+
+		if (ref->prefetching && !ref->dependencies_prefetched && singleton->prefetched_parsers.has(ref->path)) {
+			ref->_finish_parse();
+			_prefetch_dependencies(ref.ptr()); // May append to the tasks.
+		}
+	}
+}
+
 bool GDScriptCache::has_parser(const String &p_path) {
 	MutexLock lock(singleton->mutex);
 	return singleton->parser_map.has(p_path);
@@ -245,6 +363,7 @@ void GDScriptCache::remove_parser(const String &p_path) {
 
 	// Can't clear the parser because some other parser might be currently using it in the chain of calls.
 	singleton->parser_map.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
 
 	// Have to copy while iterating, because parser_inverse_dependencies is modified.
 	HashSet<String> ideps = singleton->parser_inverse_dependencies[p_path];
@@ -471,6 +590,12 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->prefetched_parsers.clear();
+	for (const PrefetchTask &E : singleton->prefetch_tasks) {
+		// The parsers were cleared, so the tasks that are left have nothing to do.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(E.task);
+	}
+	singleton->prefetch_tasks.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
 }
@@ -34,9 +34,11 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -60,6 +62,19 @@ private:
 	uint32_t source_hash = 0;
 	bool clearing = false;
 	bool abandoned = false;
+	int raising_depth = 0;
+
+	// Set when the source is parsed ahead of time, see `GDScriptCache::_prefetch_dependencies()`.
+	// Whoever takes `parse_mutex` first while the parse is pending does it, so nobody waits for a
+	// task that hasn't started. The parser isn't used otherwise until `_finish_parse()` is called.
+	bool prefetching = false;
+	bool dependencies_prefetched = false;
+	BinaryMutex parse_mutex;
+	bool parse_pending = false;
+
+	void _parse();
+	void _finish_parse();
+	static void _parse_task(void *p_ref);
 
 	friend class GDScriptCache;
 	friend class GDScript;
@@ -68,6 +83,7 @@ public:
 	Status get_status() const;
 	String get_path() const;
 	uint32_t get_source_hash() const;
+	bool is_raising_status() const { return raising_depth > 0; }
 	GDScriptParser *get_parser();
 	GDScriptAnalyzer *get_analyzer();
 	Error raise_status(Status p_new_status);
@@ -86,6 +102,13 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	// Parsers started ahead of time, kept alive until someone asks for them.
+	HashMap<String, Ref<GDScriptParserRef>> prefetched_parsers;
+	struct PrefetchTask {
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		Ref<GDScriptParserRef> parser_ref;
+	};
+	LocalVector<PrefetchTask> prefetch_tasks;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -97,6 +120,9 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	static void _prefetch_dependencies(GDScriptParserRef *p_ref);
+	static void _expand_finished_prefetches();
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
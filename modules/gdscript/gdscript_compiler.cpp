@@ -251,6 +251,41 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+// Returns the bounds type a non-constant `range()` call can be iterated as without
+// allocating an array, or `Variant::VARIANT_MAX` if it has to be called.
+static Variant::Type _get_range_bounds_type(const GDScriptParser::ExpressionNode *p_list) {
+	if (p_list->is_constant || p_list->type != GDScriptParser::Node::CALL) {
+		return Variant::VARIANT_MAX;
+	}
+	const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(p_list);
+	if (call->is_super || call->get_callee_type() != GDScriptParser::Node::IDENTIFIER || call->function_name != SNAME("range")) {
+		return Variant::VARIANT_MAX;
+	}
+	if (call->arguments.is_empty() || call->arguments.size() > 3) {
+		return Variant::VARIANT_MAX;
+	}
+	for (int i = 0; i < call->arguments.size(); i++) {
+		const GDScriptParser::DataType argument_type = call->arguments[i]->get_datatype();
+		if (!argument_type.is_hard_type() || argument_type.kind != GDScriptParser::DataType::BUILTIN || argument_type.builtin_type != Variant::INT) {
+			return Variant::VARIANT_MAX;
+		}
+	}
+	switch (call->arguments.size()) {
+		case 1:
+			return Variant::INT;
+		case 2:
+			return Variant::VECTOR2I;
+		default: {
+			// A zero step must still reach `range()` so it reports the error.
+			const GDScriptParser::ExpressionNode *step = call->arguments[2];
+			if (step->is_constant && step->reduced_value.get_type() == Variant::INT && int64_t(step->reduced_value) != 0) {
+				return Variant::VECTOR3I;
+			}
+			return Variant::VARIANT_MAX;
+		}
+	}
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1336,6 +1371,20 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 
 				GDScriptCodeGenerator::Address to_assign;
 				bool has_operation = assignment->operation != GDScriptParser::AssignmentNode::OP_NONE;
+
+				// Typed locals (e.g. `i += 1` on an `int`) take the result of the operation directly,
+				// as long as it has the same type and needs neither a setter nor a conversion.
+				if (has_operation && !is_member && (target.mode == GDScriptCodeGenerator::Address::LOCAL_VARIABLE || target.mode == GDScriptCodeGenerator::Address::FUNCTION_PARAMETER) &&
+						target.type.has_type && target.type.kind == GDScriptDataType::BUILTIN && target.type.builtin_type != Variant::ARRAY &&
+						assigned_value.type.has_type && assigned_value.type.kind == GDScriptDataType::BUILTIN &&
+						Variant::get_operator_return_type(assignment->variant_op, target.type.builtin_type, assigned_value.type.builtin_type) == target.type.builtin_type) {
+					gen->write_binary_operator(target, assignment->variant_op, target, assigned_value);
+					if (assigned_value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						gen->pop_temporary();
+					}
+					return GDScriptCodeGenerator::Address(); // Assignment does not return a value.
+				}
+
 				if (has_operation) {
 					// Perform operation.
 					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
@@ -2003,6 +2052,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+
+				if (if_n->condition->is_constant && !if_n->condition->get_datatype().is_meta_type) {
+					// Only compile the branch that can be taken, e.g. code behind `const DEBUG := false`.
+					const GDScriptParser::SuiteNode *taken_block = if_n->condition->reduced_value.booleanize() ? if_n->true_block : if_n->false_block;
+					if (taken_block) {
+						err = _parse_block(codegen, taken_block);
+						if (err) {
+							return err;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
 				if (err) {
 					return err;
@@ -2039,11 +2101,51 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
+				// Hard typed `range()` arguments are iterated like a constant range, without building an array.
+				const Variant::Type range_bounds_type = _get_range_bounds_type(for_n->list);
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
-				if (err) {
-					return err;
+				GDScriptDataType list_type;
+				if (range_bounds_type != Variant::VARIANT_MAX) {
+					list_type.has_type = true;
+					list_type.kind = GDScriptDataType::BUILTIN;
+					list_type.builtin_type = range_bounds_type;
+				} else {
+					list_type = _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script);
+				}
+
+				gen->start_for(iterator.type, list_type);
+
+				GDScriptCodeGenerator::Address list;
+				if (range_bounds_type != Variant::VARIANT_MAX) {
+					const GDScriptParser::CallNode *range_call = static_cast<const GDScriptParser::CallNode *>(for_n->list);
+					if (range_bounds_type != Variant::INT) {
+						list = codegen.add_temporary(list_type);
+					}
+
+					Vector<GDScriptCodeGenerator::Address> bounds;
+					for (int j = 0; j < range_call->arguments.size(); j++) {
+						GDScriptCodeGenerator::Address bound = _parse_expression(codegen, err, range_call->arguments[j]);
+						if (err) {
+							return err;
+						}
+						bounds.push_back(bound);
+					}
+
+					if (range_bounds_type == Variant::INT) {
+						list = bounds[0];
+					} else {
+						gen->write_construct(list, range_bounds_type, bounds);
+						for (int j = 0; j < bounds.size(); j++) {
+							if (bounds[j].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+								gen->pop_temporary();
+							}
+						}
+					}
+				} else {
+					list = _parse_expression(codegen, err, for_n->list);
+					if (err) {
+						return err;
+					}
 				}
 
 				gen->write_for_assignment(list);
@@ -2073,6 +2175,10 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			case GDScriptParser::Node::WHILE: {
 				const GDScriptParser::WhileNode *while_n = static_cast<const GDScriptParser::WhileNode *>(s);
 
+				if (while_n->condition->is_constant && !while_n->condition->get_datatype().is_meta_type && !while_n->condition->reduced_value.booleanize()) {
+					break; // The loop body can never run.
+				}
+
 				codegen.start_block(); // Add an extra block, since we use custom logic to clear block locals.
 
 				gen->start_while_condition();
@@ -2673,6 +2779,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 
 	p_script->member_functions.clear();
 	p_script->member_indices.clear();
+	p_script->member_slots.clear();
 	p_script->static_variables_indices.clear();
 	p_script->static_variables.clear();
 	p_script->_signals.clear();
@@ -2883,6 +2990,11 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 
 	p_script->static_variables.resize(p_script->static_variables_indices.size());
 
+	p_script->member_slots.resize(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		p_script->member_slots[E.value.index] = &E;
+	}
+
 	parsed_classes.insert(p_script);
 	parsing_classes.erase(p_script);
 
@@ -3232,6 +3344,9 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 
 	source = p_script->get_path();
 
+	// Functions and members are about to change, so anything resolved from the old ones is stale.
+	GDScriptLanguage::get_singleton()->compilation_version.increment();
+
 	ScriptLambdaInfo old_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	// Create scripts for subclasses beforehand so they can be referenced
@@ -141,6 +141,18 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_OPERATOR_ADD_INT:
+			case OPCODE_OPERATOR_SUBTRACT_INT: {
+				text += "int operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += opcode == OPCODE_OPERATOR_ADD_INT ? " + " : " - ";
+				text += DADDR(2);
+
+				incr += 4;
+			} break;
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -259,6 +271,17 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_GET_INDEXED_ARRAY: {
+				text += "get indexed array ";
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += "[";
+				text += DADDR(2);
+				text += "]";
+
+				incr += 4;
+			} break;
 			case OPCODE_SET_NAMED: {
 				text += "set_named ";
 				text += DADDR(1);
@@ -267,7 +290,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -288,7 +311,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -566,18 +589,21 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_CALL:
 			case OPCODE_CALL_RETURN:
-			case OPCODE_CALL_ASYNC: {
-				bool ret = (_code_ptr[ip]) == OPCODE_CALL_RETURN;
+			case OPCODE_CALL_ASYNC:
+			case OPCODE_CALL_SELF:
+			case OPCODE_CALL_SELF_RETURN: {
+				bool ret = (_code_ptr[ip]) == OPCODE_CALL_RETURN || (_code_ptr[ip]) == OPCODE_CALL_SELF_RETURN;
 				bool async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
+				bool self = (_code_ptr[ip]) == OPCODE_CALL_SELF || (_code_ptr[ip]) == OPCODE_CALL_SELF_RETURN;
 
 				int instr_var_args = _code_ptr[++ip];
 
 				if (ret) {
-					text += "call-ret ";
+					text += self ? "call-self-ret " : "call-ret ";
 				} else if (async) {
 					text += "call-async ";
 				} else {
-					text += "call ";
+					text += self ? "call-self " : "call ";
 				}
 
 				int argc = _code_ptr[ip + 1 + instr_var_args];
@@ -597,7 +623,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -945,6 +971,21 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+			case OPCODE_JUMP_IF_NOT_INT_COMPARE:
+			case OPCODE_JUMP_IF_NOT_FLOAT_COMPARE: {
+				text += opcode == OPCODE_JUMP_IF_NOT_INT_COMPARE ? "jump-if-not int compare " : "jump-if-not float compare ";
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+				text += " to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr = 6;
+			} break;
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
@@ -1037,6 +1078,8 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 	m_macro(STRING);                       \
 	m_macro(DICTIONARY);                   \
 	m_macro(ARRAY);                        \
+	m_macro(ARRAY_INT);                    \
+	m_macro(ARRAY_FLOAT);                  \
 	m_macro(PACKED_BYTE_ARRAY);            \
 	m_macro(PACKED_INT32_ARRAY);           \
 	m_macro(PACKED_INT64_ARRAY);           \
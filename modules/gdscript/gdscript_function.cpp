@@ -288,4 +288,58 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
 	}
+	// Reused as raw memory: the variants in it belong to the VM or to `_clear_stack()`.
+	GDScriptLanguage::singleton->_release_await_stack(state.stack);
+}
+
+/////////////////////
+
+bool GDScriptFunctionStateCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+	// Same type is assured by the caller.
+	return static_cast<const GDScriptFunctionStateCallable *>(p_a)->state == static_cast<const GDScriptFunctionStateCallable *>(p_b)->state;
+}
+
+bool GDScriptFunctionStateCallable::compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return static_cast<const GDScriptFunctionStateCallable *>(p_a)->state.ptr() < static_cast<const GDScriptFunctionStateCallable *>(p_b)->state.ptr();
+}
+
+uint32_t GDScriptFunctionStateCallable::hash() const {
+	return hash_murmur3_one_64((uint64_t)state.ptr());
+}
+
+String GDScriptFunctionStateCallable::get_as_text() const {
+	return "GDScriptFunctionState::_signal_callback";
+}
+
+CallableCustom::CompareEqualFunc GDScriptFunctionStateCallable::get_compare_equal_func() const {
+	return compare_equal;
+}
+
+CallableCustom::CompareLessFunc GDScriptFunctionStateCallable::get_compare_less_func() const {
+	return compare_less;
+}
+
+ObjectID GDScriptFunctionStateCallable::get_object() const {
+	return state->get_instance_id();
+}
+
+StringName GDScriptFunctionStateCallable::get_method() const {
+	return SNAME("_signal_callback");
+}
+
+void GDScriptFunctionStateCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
+	// Same as `_signal_callback()`, without the bound state.
+	Variant arg;
+	if (p_argcount == 1) {
+		arg = *p_arguments[0];
+	} else if (p_argcount > 1) {
+		Array extra_args;
+		for (int i = 0; i < p_argcount; i++) {
+			extra_args.push_back(*p_arguments[i]);
+		}
+		arg = extra_args;
+	}
+
+	r_call_error.error = Callable::CallError::CALL_OK;
+	r_return_value = state->resume(arg);
 }
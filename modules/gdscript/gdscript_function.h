@@ -39,6 +39,7 @@
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
+#include "core/variant/callable.h"
 #include "core/variant/variant.h"
 
 class GDScriptInstance;
@@ -218,6 +219,8 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -228,6 +231,7 @@ public:
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_ARRAY,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -255,6 +259,8 @@ public:
 		OPCODE_CALL,
 		OPCODE_CALL_RETURN,
 		OPCODE_CALL_ASYNC,
+		OPCODE_CALL_SELF,
+		OPCODE_CALL_SELF_RETURN,
 		OPCODE_CALL_UTILITY,
 		OPCODE_CALL_UTILITY_VALIDATED,
 		OPCODE_CALL_GDSCRIPT_UTILITY,
@@ -275,6 +281,8 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_JUMP_IF_NOT_INT_COMPARE, // Fused validated comparison and jump-if-not.
+		OPCODE_JUMP_IF_NOT_FLOAT_COMPARE,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
 		OPCODE_RETURN,
@@ -292,6 +300,8 @@ public:
 		OPCODE_ITERATE_BEGIN_STRING,
 		OPCODE_ITERATE_BEGIN_DICTIONARY,
 		OPCODE_ITERATE_BEGIN_ARRAY,
+		OPCODE_ITERATE_BEGIN_ARRAY_INT,
+		OPCODE_ITERATE_BEGIN_ARRAY_FLOAT,
 		OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,
 		OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,
 		OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,
@@ -313,6 +323,8 @@ public:
 		OPCODE_ITERATE_STRING,
 		OPCODE_ITERATE_DICTIONARY,
 		OPCODE_ITERATE_ARRAY,
+		OPCODE_ITERATE_ARRAY_INT,
+		OPCODE_ITERATE_ARRAY_FLOAT,
 		OPCODE_ITERATE_PACKED_BYTE_ARRAY,
 		OPCODE_ITERATE_PACKED_INT32_ARRAY,
 		OPCODE_ITERATE_PACKED_INT64_ARRAY,
@@ -440,6 +452,35 @@ private:
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
 
+	// Monomorphic inline cache of a named access or call on an untyped base. It stores what the name
+	// resolved to for the last object class and script seen, so accesses to the same kind of object skip
+	// the lookups. Caches are only used from the main thread, so they don't need any locking.
+	struct NamedCache {
+		enum Kind {
+			NONE, // Not cacheable, use the regular path.
+			SCRIPT_MEMBER, // Member variable without getter or setter.
+			SCRIPT_FUNCTION,
+			NATIVE_PROPERTY, // Native property with a getter or setter method.
+			NATIVE_METHOD,
+		};
+
+		enum Usage {
+			USAGE_GET,
+			USAGE_SET,
+			USAGE_CALL,
+		};
+
+		Kind kind = NONE;
+		StringName class_name;
+		const GDScript *script = nullptr;
+		uint32_t compilation_version = 0;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+	};
+	Vector<NamedCache> named_caches;
+
 	int _code_size = 0;
 	int _default_arg_count = 0;
 	int _constant_count = 0;
@@ -457,6 +498,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _named_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -475,6 +517,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	NamedCache *_named_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -512,6 +555,14 @@ private:
 	_FORCE_INLINE_ String _get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	static bool _get_named_cache_object(const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance);
+	static bool _is_named_cache_valid(const NamedCache &p_cache, const Object *p_object, const GDScriptInstance *p_instance);
+	static bool _script_resolves_name(const GDScript *p_script, const StringName &p_name, const StringName &p_fallback_function);
+	static void _resolve_named_cache(NamedCache &r_cache, const Object *p_object, const GDScriptInstance *p_instance, const StringName &p_name, NamedCache::Usage p_usage);
+	static bool _named_cache_get(NamedCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	static bool _named_cache_set(NamedCache &p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid);
+	static bool _named_cache_call(NamedCache &p_cache, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
@@ -580,4 +631,25 @@ public:
 	~GDScriptFunctionState();
 };
 
+// Resumes an awaiting function when the signal it awaits is emitted, and keeps its state alive
+// until then. Does what binding the state to `_signal_callback()` does, with fewer allocations.
+class GDScriptFunctionStateCallable : public CallableCustom {
+	Ref<GDScriptFunctionState> state;
+
+	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
+	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
+
+public:
+	uint32_t hash() const override;
+	String get_as_text() const override;
+	CompareEqualFunc get_compare_equal_func() const override;
+	CompareLessFunc get_compare_less_func() const override;
+	ObjectID get_object() const override;
+	StringName get_method() const override;
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
+
+	GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_state) :
+			state(p_state) {}
+};
+
 #endif // GDSCRIPT_FUNCTION_H
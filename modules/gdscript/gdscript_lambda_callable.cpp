@@ -34,6 +34,22 @@
 
 #include "core/templates/hashfuncs.h"
 
+void GDScriptLambdaCaptures::init(void *p_callable, size_t p_callable_size, const Variant *const *p_captures, int p_count) {
+	count = p_count;
+	ptr = p_count > 0 ? reinterpret_cast<Variant *>(static_cast<uint8_t *>(p_callable) + get_offset(p_callable_size)) : nullptr;
+	for (int i = 0; i < p_count; i++) {
+		memnew_placement(&ptr[i], Variant(*p_captures[i]));
+	}
+}
+
+void GDScriptLambdaCaptures::release() {
+	for (int i = 0; i < count; i++) {
+		ptr[i].~Variant();
+	}
+	count = 0;
+	ptr = nullptr;
+}
+
 bool GDScriptLambdaCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
 	// Lambda callables are only compared by reference.
 	return p_a == p_b;
@@ -97,25 +113,25 @@ void GDScriptLambdaCallable::call(const Variant **p_arguments, int p_argcount, V
 	}
 
 	if (captures_amount > 0) {
-		Vector<const Variant *> args;
-		args.resize(p_argcount + captures_amount);
+		int args_count = p_argcount + captures_amount;
+		const Variant **args = (const Variant **)alloca(sizeof(const Variant *) * args_count);
 		for (int i = 0; i < captures_amount; i++) {
-			args.write[i] = &captures[i];
+			args[i] = &captures[i];
 			if (captures[i].get_type() == Variant::OBJECT) {
 				bool was_freed = false;
 				captures[i].get_validated_object_with_check(was_freed);
 				if (was_freed) {
 					ERR_PRINT(vformat(R"(Lambda capture at index %d was freed. Passed "null" instead.)", i));
 					static Variant nil;
-					args.write[i] = &nil;
+					args[i] = &nil;
 				}
 			}
 		}
 		for (int i = 0; i < p_argcount; i++) {
-			args.write[i + captures_amount] = p_arguments[i];
+			args[i + captures_amount] = p_arguments[i];
 		}
 
-		r_return_value = function->call(nullptr, args.ptrw(), args.size(), r_call_error);
+		r_return_value = function->call(nullptr, args, args_count, r_call_error);
 		switch (r_call_error.error) {
 			case Callable::CallError::CALL_ERROR_INVALID_ARGUMENT:
 				r_call_error.argument -= captures_amount;
@@ -148,12 +164,18 @@ void GDScriptLambdaCallable::call(const Variant **p_arguments, int p_argcount, V
 	}
 }
 
-GDScriptLambdaCallable::GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
+GDScriptLambdaCallable *GDScriptLambdaCallable::create(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count) {
+	void *memory = GDScriptLambdaCaptures::allocate(sizeof(GDScriptLambdaCallable), p_captures_count);
+	GDScriptLambdaCallable *callable = memnew_placement(memory, GDScriptLambdaCallable(p_script, p_function));
+	callable->captures.init(callable, sizeof(GDScriptLambdaCallable), p_captures, p_captures_count);
+	return callable;
+}
+
+GDScriptLambdaCallable::GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function) :
 		function(p_function) {
 	ERR_FAIL_NULL(p_script.ptr());
 	ERR_FAIL_NULL(p_function);
 	script = p_script;
-	captures = p_captures;
 
 	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
 }
@@ -229,25 +251,25 @@ void GDScriptLambdaSelfCallable::call(const Variant **p_arguments, int p_argcoun
 	}
 
 	if (captures_amount > 0) {
-		Vector<const Variant *> args;
-		args.resize(p_argcount + captures_amount);
+		int args_count = p_argcount + captures_amount;
+		const Variant **args = (const Variant **)alloca(sizeof(const Variant *) * args_count);
 		for (int i = 0; i < captures_amount; i++) {
-			args.write[i] = &captures[i];
+			args[i] = &captures[i];
 			if (captures[i].get_type() == Variant::OBJECT) {
 				bool was_freed = false;
 				captures[i].get_validated_object_with_check(was_freed);
 				if (was_freed) {
 					ERR_PRINT(vformat(R"(Lambda capture at index %d was freed. Passed "null" instead.)", i));
 					static Variant nil;
-					args.write[i] = &nil;
+					args[i] = &nil;
 				}
 			}
 		}
 		for (int i = 0; i < p_argcount; i++) {
-			args.write[i + captures_amount] = p_arguments[i];
+			args[i + captures_amount] = p_arguments[i];
 		}
 
-		r_return_value = function->call(static_cast<GDScriptInstance *>(object->get_script_instance()), args.ptrw(), args.size(), r_call_error);
+		r_return_value = function->call(static_cast<GDScriptInstance *>(object->get_script_instance()), args, args_count, r_call_error);
 		switch (r_call_error.error) {
 			case Callable::CallError::CALL_ERROR_INVALID_ARGUMENT:
 				r_call_error.argument -= captures_amount;
@@ -280,23 +302,35 @@ void GDScriptLambdaSelfCallable::call(const Variant **p_arguments, int p_argcoun
 	}
 }
 
-GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
+GDScriptLambdaSelfCallable *GDScriptLambdaSelfCallable::create(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count) {
+	void *memory = GDScriptLambdaCaptures::allocate(sizeof(GDScriptLambdaSelfCallable), p_captures_count);
+	GDScriptLambdaSelfCallable *callable = memnew_placement(memory, GDScriptLambdaSelfCallable(p_self, p_function));
+	callable->captures.init(callable, sizeof(GDScriptLambdaSelfCallable), p_captures, p_captures_count);
+	return callable;
+}
+
+GDScriptLambdaSelfCallable *GDScriptLambdaSelfCallable::create(Object *p_self, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count) {
+	void *memory = GDScriptLambdaCaptures::allocate(sizeof(GDScriptLambdaSelfCallable), p_captures_count);
+	GDScriptLambdaSelfCallable *callable = memnew_placement(memory, GDScriptLambdaSelfCallable(p_self, p_function));
+	callable->captures.init(callable, sizeof(GDScriptLambdaSelfCallable), p_captures, p_captures_count);
+	return callable;
+}
+
+GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function) :
 		function(p_function) {
 	ERR_FAIL_NULL(p_self.ptr());
 	ERR_FAIL_NULL(p_function);
 	reference = p_self;
 	object = p_self.ptr();
-	captures = p_captures;
 
 	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
 }
 
-GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
+GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function) :
 		function(p_function) {
 	ERR_FAIL_NULL(p_self);
 	ERR_FAIL_NULL(p_function);
 	object = p_self;
-	captures = p_captures;
 
 	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
 }
@@ -41,16 +41,34 @@
 class GDScriptFunction;
 class GDScriptInstance;
 
+// Lambdas are created every time their expression is evaluated, so the captured values are
+// stored right after the callable, in the same allocation, instead of in a `Vector`.
+struct GDScriptLambdaCaptures {
+	int count = 0;
+	Variant *ptr = nullptr;
+
+	static size_t get_offset(size_t p_callable_size) { return (p_callable_size + alignof(Variant) - 1) & ~(alignof(Variant) - 1); }
+	static void *allocate(size_t p_callable_size, int p_count) { return Memory::alloc_static(get_offset(p_callable_size) + sizeof(Variant) * p_count); }
+
+	void init(void *p_callable, size_t p_callable_size, const Variant *const *p_captures, int p_count);
+	void release();
+
+	_FORCE_INLINE_ int size() const { return count; }
+	_FORCE_INLINE_ const Variant &operator[](int p_index) const { return ptr[p_index]; }
+};
+
 class GDScriptLambdaCallable : public CallableCustom {
 	GDScript::UpdatableFuncPtr function;
 	Ref<GDScript> script;
 	uint32_t h;
 
-	Vector<Variant> captures;
+	GDScriptLambdaCaptures captures;
 
 	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
 
+	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function);
+
 public:
 	bool is_valid() const override;
 	uint32_t hash() const override;
@@ -62,10 +80,12 @@ public:
 	int get_argument_count(bool &r_is_valid) const override;
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
 
+	// The callable is freed with `memdelete()`, like other custom callables.
+	static GDScriptLambdaCallable *create(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count);
+
 	GDScriptLambdaCallable(GDScriptLambdaCallable &) = delete;
 	GDScriptLambdaCallable(const GDScriptLambdaCallable &) = delete;
-	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	virtual ~GDScriptLambdaCallable() = default;
+	virtual ~GDScriptLambdaCallable() { captures.release(); }
 };
 
 // Lambda callable that references a particular object, so it can use `self` in the body.
@@ -75,11 +95,14 @@ class GDScriptLambdaSelfCallable : public CallableCustom {
 	Object *object = nullptr; // For non RefCounted objects, use a direct pointer.
 	uint32_t h;
 
-	Vector<Variant> captures;
+	GDScriptLambdaCaptures captures;
 
 	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
 
+	GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function);
+	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function);
+
 public:
 	bool is_valid() const override;
 	uint32_t hash() const override;
@@ -91,11 +114,13 @@ public:
 	int get_argument_count(bool &r_is_valid) const override;
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
 
+	// The callable is freed with `memdelete()`, like other custom callables.
+	static GDScriptLambdaSelfCallable *create(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count);
+	static GDScriptLambdaSelfCallable *create(Object *p_self, GDScriptFunction *p_function, const Variant *const *p_captures, int p_captures_count);
+
 	GDScriptLambdaSelfCallable(GDScriptLambdaSelfCallable &) = delete;
 	GDScriptLambdaSelfCallable(const GDScriptLambdaSelfCallable &) = delete;
-	GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	virtual ~GDScriptLambdaSelfCallable() = default;
+	virtual ~GDScriptLambdaSelfCallable() { captures.release(); }
 };
 
 #endif // GDSCRIPT_LAMBDA_CALLABLE_H
@@ -44,6 +44,7 @@
 #include "core/string/string_name.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/vector.h"
@@ -1336,6 +1337,11 @@ private:
 	List<bool> multiline_stack;
 	HashMap<String, Ref<GDScriptParserRef>> depended_parsers;
 
+	// Scripts referenced by path (`extends` and `preload()`) or by name (`extends` and type hints),
+	// as written in the source. Lets the cache start parsing them before the analyzer asks for them.
+	HashSet<String> dependency_paths;
+	HashSet<StringName> dependency_names;
+
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
@@ -1567,6 +1573,8 @@ public:
 	bool is_tool() const { return _is_tool; }
 	Ref<GDScriptParserRef> get_depended_parser_for(const String &p_path);
 	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers();
+	const HashSet<String> &get_dependency_paths() const { return dependency_paths; }
+	const HashSet<StringName> &get_dependency_names() const { return dependency_names; }
 	ClassNode *find_class(const String &p_qualified_name) const;
 	bool has_class(const GDScriptParser::ClassNode *p_class) const;
 	static Variant::Type get_builtin_type(const StringName &p_type); // Excluding `Variant::NIL` and `Variant::OBJECT`.
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript.h"
+
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+GDScriptFunction *GDScriptSamplingProfiler::stack[MAX_DEPTH] = {};
+SafeNumeric<int> GDScriptSamplingProfiler::depth;
+SafeFlag GDScriptSamplingProfiler::active;
+SafeNumeric<uint32_t> GDScriptSamplingProfiler::pending_samples;
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::singleton = nullptr;
+
+void GDScriptSamplingProfiler::_thread_func(void *p_user) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_user);
+	Thread::set_name("GDScript Sampling Profiler");
+
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		if (depth.get() > 0) {
+			pending_samples.increment();
+		} else {
+			profiler->idle_samples.increment();
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::_record_sample(uint32_t p_count) {
+	if (!singleton) {
+		return;
+	}
+
+	String folded;
+	int current = depth.get();
+	for (int i = 0; i < current; i++) {
+		const GDScriptFunction *function = stack[i];
+		if (i > 0) {
+			folded += ";";
+		}
+		// Semicolons separate frames, so they can't appear in names.
+		folded += (function->get_script() ? function->get_script()->get_fully_qualified_name() : String()).replace(";", "_");
+		folded += ":";
+		folded += String(function->get_name());
+	}
+
+	singleton->samples[folded] += p_count;
+	if (!singleton->output_path.is_empty()) {
+		singleton->session_samples[folded] += p_count;
+	}
+}
+
+void GDScriptSamplingProfiler::_send_samples() {
+	PackedStringArray stacks;
+	PackedInt64Array counts;
+	for (const KeyValue<String, uint64_t> &E : samples) {
+		stacks.push_back(E.key);
+		counts.push_back(E.value);
+	}
+	samples.clear();
+
+	Array message;
+	message.push_back(interval_usec);
+	message.push_back(idle_samples.get());
+	message.push_back(stacks);
+	message.push_back(counts);
+	idle_samples.set(0);
+
+	EngineDebugger::get_singleton()->send_message("gdscript:sampling", message);
+}
+
+void GDScriptSamplingProfiler::_write_output() {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot write GDScript sampling profile to: " + output_path);
+
+	for (const KeyValue<String, uint64_t> &E : session_samples) {
+		f->store_line(E.key + " " + itos(E.value));
+	}
+	print_line(vformat("GDScript sampling profile written to: %s (%d stacks).", output_path, session_samples.size()));
+}
+
+void GDScriptSamplingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	if (p_enable == active.is_set()) {
+		return;
+	}
+
+	if (p_enable) {
+#ifdef THREADS_ENABLED
+		interval_usec = 1000;
+		output_path = String();
+		if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+			interval_usec = CLAMP(int(p_opts[0]), 50, 1000000);
+		}
+		if (p_opts.size() > 1 && p_opts[1].get_type() == Variant::STRING) {
+			output_path = p_opts[1];
+		}
+
+		samples.clear();
+		session_samples.clear();
+		idle_samples.set(0);
+		pending_samples.set(0);
+		last_message_msec = OS::get_singleton()->get_ticks_msec();
+
+		active.set();
+		exit_thread.clear();
+		thread.start(_thread_func, this);
+#else
+		WARN_PRINT("The GDScript sampling profiler needs thread support.");
+#endif
+	} else {
+		active.clear();
+		exit_thread.set();
+		if (thread.is_started()) {
+			thread.wait_to_finish();
+		}
+		pending_samples.set(0);
+
+		if (!output_path.is_empty()) {
+			_write_output();
+		}
+		samples.clear();
+		session_samples.clear();
+	}
+}
+
+void GDScriptSamplingProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	uint64_t now = OS::get_singleton()->get_ticks_msec();
+	if (now - last_message_msec < 1000 || !EngineDebugger::get_singleton()) {
+		return;
+	}
+	last_message_msec = now;
+	_send_samples();
+}
+
+GDScriptSamplingProfiler::GDScriptSamplingProfiler() {
+	singleton = this;
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	toggle(false, Array());
+	singleton = nullptr;
+}
@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "gdscript_function.h"
+
+#include "core/debugger/engine_profiler.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
+
+// Statistical profiler for GDScript, available in all builds.
+//
+// While enabled, a background thread periodically requests a sample. The VM keeps a list of the
+// functions running on the main thread, and records it at the next safe point (function entry
+// or exit, or a new line) so the stack never has to be read from another thread. Samples are
+// folded into `caller;callee count` lines, which is what flame graph tools expect.
+//
+// Enable it with `EngineDebugger.profiler_enable("gdscript:sampling", true, [interval_usec, path])`.
+// Both options are optional. The interval defaults to 1000 microseconds. When a path is given,
+// the folded stacks of the whole session are written to it when the profiler is disabled.
+// When a debugger is connected, the stacks sampled since the previous message are also sent
+// once per second as `gdscript:sampling` messages.
+class GDScriptSamplingProfiler : public EngineProfiler {
+	static constexpr int MAX_DEPTH = GDScriptFunction::MAX_CALL_DEPTH;
+
+	// Only accessed by the main thread, except for the current depth.
+	static GDScriptFunction *stack[MAX_DEPTH];
+	static SafeNumeric<int> depth;
+
+	static SafeFlag active;
+	static SafeNumeric<uint32_t> pending_samples;
+
+	Thread thread;
+	SafeFlag exit_thread;
+	uint32_t interval_usec = 1000;
+	String output_path;
+
+	HashMap<String, uint64_t> samples; // Since the last message.
+	HashMap<String, uint64_t> session_samples; // Since the profiler was enabled, when writing to a file.
+	SafeNumeric<uint64_t> idle_samples; // Requested while no script was running.
+	uint64_t last_message_msec = 0;
+
+	static GDScriptSamplingProfiler *singleton;
+
+	static void _thread_func(void *p_user);
+	static void _record_sample(uint32_t p_count);
+	void _send_samples();
+	void _write_output();
+
+public:
+	// Called by the VM, see `gdscript_vm.cpp`.
+	_FORCE_INLINE_ static bool enter_function(GDScriptFunction *p_function) {
+		if (likely(!active.is_set()) || !Thread::is_main_thread()) {
+			return false;
+		}
+		int current = depth.get();
+		if (current >= MAX_DEPTH) {
+			return false;
+		}
+		stack[current] = p_function;
+		depth.set(current + 1);
+		check_sample();
+		return true;
+	}
+
+	_FORCE_INLINE_ static void exit_function() {
+		check_sample();
+		depth.set(depth.get() - 1);
+	}
+
+	_FORCE_INLINE_ static void check_sample() {
+		uint32_t count = pending_samples.get();
+		if (unlikely(count > 0) && depth.get() > 0 && Thread::is_main_thread()) {
+			pending_samples.sub(count);
+			_record_sample(count);
+		}
+	}
+
+	virtual void toggle(bool p_enable, const Array &p_opts) override;
+	virtual void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+
+	GDScriptSamplingProfiler();
+	~GDScriptSamplingProfiler();
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
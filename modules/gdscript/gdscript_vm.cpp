@@ -31,8 +31,10 @@
 #include "gdscript.h"
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -109,6 +111,220 @@ void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_
 
 #endif // DEBUG_ENABLED
 
+// Used by the fused compare-and-jump opcodes, which the code generator only emits for comparison operators.
+template <typename T>
+static _FORCE_INLINE_ bool _compare_validated(int p_operator, T p_left, T p_right) {
+	switch (p_operator) {
+		case Variant::OP_EQUAL:
+			return p_left == p_right;
+		case Variant::OP_NOT_EQUAL:
+			return p_left != p_right;
+		case Variant::OP_LESS:
+			return p_left < p_right;
+		case Variant::OP_LESS_EQUAL:
+			return p_left <= p_right;
+		case Variant::OP_GREATER:
+			return p_left > p_right;
+		default:
+			return p_left >= p_right;
+	}
+}
+
+bool GDScriptFunction::_get_named_cache_object(const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance) {
+	if (p_base->get_type() != Variant::OBJECT || !Thread::is_main_thread()) {
+		return false;
+	}
+
+	Object *object = p_base->get_validated_object();
+	if (!object) {
+		return false;
+	}
+
+	ScriptInstance *script_instance = object->get_script_instance();
+	if (script_instance && (script_instance->get_language() != GDScriptLanguage::get_singleton() || script_instance->is_placeholder())) {
+		return false;
+	}
+
+	r_object = object;
+	r_instance = static_cast<GDScriptInstance *>(script_instance);
+	return true;
+}
+
+bool GDScriptFunction::_is_named_cache_valid(const NamedCache &p_cache, const Object *p_object, const GDScriptInstance *p_instance) {
+	const GDScript *script = p_instance ? p_instance->script.ptr() : nullptr;
+	return p_cache.script == script && p_cache.class_name == p_object->get_class_name() && p_cache.compilation_version == GDScriptLanguage::get_singleton()->compilation_version.get();
+}
+
+// Whether the names the instance looks up after its member variables (constants, functions, `_get()`, etc.) could answer to this one.
+bool GDScriptFunction::_script_resolves_name(const GDScript *p_script, const StringName &p_name, const StringName &p_fallback_function) {
+	for (const GDScript *sptr = p_script; sptr; sptr = sptr->_base) {
+		if (sptr->constants.has(p_name) || sptr->static_variables_indices.has(p_name) || sptr->_signals.has(p_name) || sptr->subclasses.has(p_name)) {
+			return true;
+		}
+		if (sptr->member_functions.has(p_name) || sptr->member_functions.has(p_fallback_function)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void GDScriptFunction::_resolve_named_cache(NamedCache &r_cache, const Object *p_object, const GDScriptInstance *p_instance, const StringName &p_name, NamedCache::Usage p_usage) {
+	r_cache = NamedCache();
+	r_cache.class_name = p_object->get_class_name();
+	r_cache.script = p_instance ? p_instance->script.ptr() : nullptr;
+	r_cache.compilation_version = GDScriptLanguage::get_singleton()->compilation_version.get();
+
+	ClassDB::APIType api = ClassDB::get_api_type(r_cache.class_name);
+	if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+		return; // Extensions can handle names on their own.
+	}
+
+#ifdef TOOLS_ENABLED
+	if (p_usage == NamedCache::USAGE_SET && Engine::get_singleton()->is_editor_hint()) {
+		return; // Objects have to be marked as edited.
+	}
+#endif
+
+	if (r_cache.script) {
+		if (!r_cache.script->valid) {
+			return;
+		}
+
+		if (p_usage == NamedCache::USAGE_CALL) {
+			if (p_name == SceneStringName(_ready)) {
+				return; // Also runs the implicit initializers.
+			}
+			for (const GDScript *sptr = r_cache.script; sptr; sptr = sptr->_base) {
+				HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+				if (E) {
+					r_cache.kind = NamedCache::SCRIPT_FUNCTION;
+					r_cache.function = E->value;
+					return;
+				}
+			}
+		} else {
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = r_cache.script->member_indices.find(p_name);
+			if (E) {
+				if (p_usage == NamedCache::USAGE_GET ? E->value.getter == StringName() : E->value.setter == StringName()) {
+					r_cache.kind = NamedCache::SCRIPT_MEMBER;
+					r_cache.member_index = E->value.index;
+					r_cache.member_type = &E->value.data_type;
+				}
+				return;
+			}
+
+			const StringName &fallback = p_usage == NamedCache::USAGE_GET ? GDScriptLanguage::get_singleton()->strings._get : GDScriptLanguage::get_singleton()->strings._set;
+			if (_script_resolves_name(r_cache.script, p_name, fallback)) {
+				return;
+			}
+		}
+	}
+
+	if (p_usage == NamedCache::USAGE_CALL) {
+		if (p_name == CoreStringName(free_)) {
+			return;
+		}
+		MethodBind *method = ClassDB::get_method(r_cache.class_name, p_name);
+		if (method) {
+			r_cache.kind = NamedCache::NATIVE_METHOD;
+			r_cache.method = method;
+		}
+		return;
+	}
+
+	bool is_property = false;
+	if (ClassDB::get_property_index(r_cache.class_name, p_name, &is_property) >= 0 || !is_property) {
+		return; // Indexed properties pass their index to a shared accessor.
+	}
+	StringName accessor = p_usage == NamedCache::USAGE_GET ? ClassDB::get_property_getter(r_cache.class_name, p_name) : ClassDB::get_property_setter(r_cache.class_name, p_name);
+	if (accessor == StringName()) {
+		return;
+	}
+	MethodBind *method = ClassDB::get_method(r_cache.class_name, accessor);
+	if (method) {
+		r_cache.kind = NamedCache::NATIVE_PROPERTY;
+		r_cache.method = method;
+	}
+}
+
+bool GDScriptFunction::_named_cache_get(NamedCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	Object *object = nullptr;
+	GDScriptInstance *instance = nullptr;
+	if (!_get_named_cache_object(p_base, object, instance)) {
+		return false;
+	}
+	if (unlikely(!_is_named_cache_valid(p_cache, object, instance))) {
+		_resolve_named_cache(p_cache, object, instance, p_name, NamedCache::USAGE_GET);
+	}
+
+	switch (p_cache.kind) {
+		case NamedCache::SCRIPT_MEMBER: {
+			r_ret = instance->members[p_cache.member_index];
+			return true;
+		}
+		case NamedCache::NATIVE_PROPERTY: {
+			Callable::CallError ce;
+			r_ret = p_cache.method->call(object, nullptr, 0, ce);
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+bool GDScriptFunction::_named_cache_set(NamedCache &p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+	Object *object = nullptr;
+	GDScriptInstance *instance = nullptr;
+	if (!_get_named_cache_object(p_base, object, instance)) {
+		return false;
+	}
+	if (unlikely(!_is_named_cache_valid(p_cache, object, instance))) {
+		_resolve_named_cache(p_cache, object, instance, p_name, NamedCache::USAGE_SET);
+	}
+
+	switch (p_cache.kind) {
+		case NamedCache::SCRIPT_MEMBER: {
+			if (p_cache.member_type->has_type && !p_cache.member_type->is_type(p_value)) {
+				return false; // Needs a conversion.
+			}
+			instance->members.write[p_cache.member_index] = p_value;
+			r_valid = true;
+			return true;
+		}
+		case NamedCache::NATIVE_PROPERTY: {
+			Callable::CallError ce;
+			const Variant *args[1] = { &p_value };
+			p_cache.method->call(object, args, 1, ce);
+			r_valid = ce.error == Callable::CallError::CALL_OK;
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+bool GDScriptFunction::_named_cache_call(NamedCache &p_cache, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (unlikely(!_is_named_cache_valid(p_cache, p_object, p_instance))) {
+		_resolve_named_cache(p_cache, p_object, p_instance, p_name, NamedCache::USAGE_CALL);
+	}
+
+	switch (p_cache.kind) {
+		case NamedCache::SCRIPT_FUNCTION: {
+			r_ret = p_cache.function->call(p_instance, p_args, p_argcount, r_err);
+			return true;
+		}
+		case NamedCache::NATIVE_METHOD: {
+			r_ret = p_cache.method->call(p_object, p_args, p_argcount, r_err);
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
 Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataType &p_data_type) {
 	if (p_data_type.kind == GDScriptDataType::BUILTIN) {
 		if (p_data_type.builtin_type == Variant::ARRAY) {
@@ -215,6 +431,8 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_NATIVE,                       \
@@ -225,6 +443,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_GET_KEYED,                              \
 		&&OPCODE_GET_KEYED_VALIDATED,                    \
 		&&OPCODE_GET_INDEXED_VALIDATED,                  \
+		&&OPCODE_GET_INDEXED_ARRAY,                      \
 		&&OPCODE_SET_NAMED,                              \
 		&&OPCODE_SET_NAMED_VALIDATED,                    \
 		&&OPCODE_GET_NAMED,                              \
@@ -252,6 +471,8 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_CALL,                                   \
 		&&OPCODE_CALL_RETURN,                            \
 		&&OPCODE_CALL_ASYNC,                             \
+		&&OPCODE_CALL_SELF,                              \
+		&&OPCODE_CALL_SELF_RETURN,                       \
 		&&OPCODE_CALL_UTILITY,                           \
 		&&OPCODE_CALL_UTILITY_VALIDATED,                 \
 		&&OPCODE_CALL_GDSCRIPT_UTILITY,                  \
@@ -272,6 +493,8 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                                   \
 		&&OPCODE_JUMP_IF,                                \
 		&&OPCODE_JUMP_IF_NOT,                            \
+		&&OPCODE_JUMP_IF_NOT_INT_COMPARE,                \
+		&&OPCODE_JUMP_IF_NOT_FLOAT_COMPARE,              \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
 		&&OPCODE_RETURN,                                 \
@@ -289,6 +512,8 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_BEGIN_STRING,                   \
 		&&OPCODE_ITERATE_BEGIN_DICTIONARY,               \
 		&&OPCODE_ITERATE_BEGIN_ARRAY,                    \
+		&&OPCODE_ITERATE_BEGIN_ARRAY_INT,                \
+		&&OPCODE_ITERATE_BEGIN_ARRAY_FLOAT,              \
 		&&OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,        \
 		&&OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,       \
 		&&OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,       \
@@ -310,6 +535,8 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_STRING,                         \
 		&&OPCODE_ITERATE_DICTIONARY,                     \
 		&&OPCODE_ITERATE_ARRAY,                          \
+		&&OPCODE_ITERATE_ARRAY_INT,                      \
+		&&OPCODE_ITERATE_ARRAY_FLOAT,                    \
 		&&OPCODE_ITERATE_PACKED_BYTE_ARRAY,              \
 		&&OPCODE_ITERATE_PACKED_INT32_ARRAY,             \
 		&&OPCODE_ITERATE_PACKED_INT64_ARRAY,             \
@@ -446,6 +673,7 @@ void (*type_init_function_table[])(Variant *) = {
 #define METHOD_CALL_ON_FREED_INSTANCE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a previously freed instance."
 
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_SCRIPT);
 	OPCODES_TABLE;
 
 	if (!_code_ptr) {
@@ -503,7 +731,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		instruction_args = (Variant **)&p_state->stack.ptr()[sizeof(Variant) * p_state->stack_size]; //ptr() to avoid bounds check
 		line = p_state->line;
 		ip = p_state->ip;
-		alloca_size = p_state->stack.size();
+		alloca_size = p_state->alloca_size;
 		script = p_state->script;
 		p_instance = p_state->instance;
 		defarg = p_state->defarg;
@@ -597,6 +825,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	String err_text;
 
+	bool sampled = GDScriptSamplingProfiler::enter_function(this);
+
 #ifdef DEBUG_ENABLED
 
 	if (EngineDebugger::is_active()) {
@@ -792,6 +1022,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_ADD_INT) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				*VariantInternal::get_int(dst) = *VariantInternal::get_int(a) + *VariantInternal::get_int(b);
+
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_SUBTRACT_INT) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				*VariantInternal::get_int(dst) = *VariantInternal::get_int(a) - *VariantInternal::get_int(b);
+
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1105,8 +1361,34 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_INDEXED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				const Array *array = VariantInternal::get_array(src);
+				int64_t size = array->size();
+				int64_t int_index = *VariantInternal::get_int(index);
+				if (int_index < 0) {
+					int_index += size;
+				}
+
+				if (int_index < 0 || int_index >= size) {
+#ifdef DEBUG_ENABLED
+					err_text = "Out of bounds get index '" + itos(*VariantInternal::get_int(index)) + "' (on base: '" + _get_var_type(src) + "')";
+					OPCODE_BREAK;
+#endif
+				} else {
+					*dst = (*array)[int_index];
+				}
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1116,8 +1398,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _named_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				if (!_named_cache_set(_named_caches_ptr[cache_index], dst, *index, *value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1138,7 +1425,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1158,7 +1445,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1168,22 +1455,23 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _named_caches_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				//allow better error message in cases where src and dst are the same stack position
+				Variant ret;
+				bool valid = true;
+				if (!_named_cache_get(_named_caches_ptr[cache_index], src, *index, ret)) {
+					ret = src->get_named(*index, valid);
+				}
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1713,13 +2001,16 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 			OPCODE(OPCODE_CALL_ASYNC)
 			OPCODE(OPCODE_CALL_RETURN)
+			OPCODE(OPCODE_CALL_SELF)
+			OPCODE(OPCODE_CALL_SELF_RETURN)
 			OPCODE(OPCODE_CALL) {
-				bool call_ret = (_code_ptr[ip]) != OPCODE_CALL;
+				bool call_ret = (_code_ptr[ip]) != OPCODE_CALL && (_code_ptr[ip]) != OPCODE_CALL_SELF;
+				bool call_self = (_code_ptr[ip]) == OPCODE_CALL_SELF || (_code_ptr[ip]) == OPCODE_CALL_SELF_RETURN;
 #ifdef DEBUG_ENABLED
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1744,10 +2035,46 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				StringName base_class = base_obj ? base_obj->get_class_name() : StringName();
 #endif
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _named_caches_count);
+
+				// Calls on objects go through the inline cache, which resolves the name once for each class and script.
+				Object *cache_object = nullptr;
+				GDScriptInstance *cache_instance = nullptr;
+				bool use_cache = false;
+				GDScriptFunction *self_function = nullptr;
+				if (call_self && p_instance) {
+					if (Thread::is_main_thread()) {
+						cache_object = p_instance->owner;
+						cache_instance = p_instance;
+						use_cache = true;
+					} else if (*methodname != SceneStringName(_ready)) {
+						// Script functions called on `self` are still looked up and called directly, skipping
+						// the Variant, Object and ScriptInstance layers. `_ready()` goes through them, since
+						// calling it also runs the implicit initializers.
+						for (GDScript *sptr = p_instance->script.ptr(); sptr; sptr = sptr->_base) {
+							if (likely(sptr->valid)) {
+								HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(*methodname);
+								if (E) {
+									self_function = E->value;
+									break;
+								}
+							}
+						}
+					}
+				} else {
+					use_cache = _get_named_cache_object(base, cache_object, cache_instance);
+				}
+
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					bool called = use_cache && _named_cache_call(_named_caches_ptr[cache_index], cache_object, cache_instance, *methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (!called && self_function) {
+						*ret = self_function->call(p_instance, (const Variant **)argptrs, argc, err);
+					} else if (!called) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1777,7 +2104,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					bool called = use_cache && _named_cache_call(_named_caches_ptr[cache_index], cache_object, cache_instance, *methodname, (const Variant **)argptrs, argc, ret, err);
+					if (!called && self_function) {
+						self_function->call(p_instance, (const Variant **)argptrs, argc, err);
+					} else if (!called) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1827,7 +2159,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2391,7 +2723,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
+					gdfs->state.stack = GDScriptLanguage::get_singleton()->_acquire_await_stack(alloca_size);
 
 					// First 3 stack addresses are special, so we just skip them here.
 					for (int i = 3; i < _stack_size; i++) {
@@ -2421,7 +2753,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 					retvalue = gdfs;
 
-					Error err = sig.connect(Callable(gdfs.ptr(), "_signal_callback").bind(retvalue), Object::CONNECT_ONE_SHOT);
+					Error err = sig.connect(Callable(memnew(GDScriptFunctionStateCallable(gdfs))), Object::CONNECT_ONE_SHOT);
 					if (err != OK) {
 						err_text = "Error connecting to signal: " + sig.get_name() + " during await.";
 						OPCODE_BREAK;
@@ -2463,14 +2795,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(lambda_index < 0 || lambda_index >= _lambdas_count);
 				GDScriptFunction *lambda = _lambdas_ptr[lambda_index];
 
-				Vector<Variant> captures;
-				captures.resize(captures_count);
-				for (int i = 0; i < captures_count; i++) {
-					GET_INSTRUCTION_ARG(arg, i);
-					captures.write[i] = *arg;
-				}
-
-				GDScriptLambdaCallable *callable = memnew(GDScriptLambdaCallable(Ref<GDScript>(script), lambda, captures));
+				GDScriptLambdaCallable *callable = GDScriptLambdaCallable::create(Ref<GDScript>(script), lambda, instruction_args, captures_count);
 
 				GET_INSTRUCTION_ARG(result, captures_count);
 				*result = Callable(callable);
@@ -2494,18 +2819,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(lambda_index < 0 || lambda_index >= _lambdas_count);
 				GDScriptFunction *lambda = _lambdas_ptr[lambda_index];
 
-				Vector<Variant> captures;
-				captures.resize(captures_count);
-				for (int i = 0; i < captures_count; i++) {
-					GET_INSTRUCTION_ARG(arg, i);
-					captures.write[i] = *arg;
-				}
-
 				GDScriptLambdaSelfCallable *callable;
 				if (Object::cast_to<RefCounted>(p_instance->owner)) {
-					callable = memnew(GDScriptLambdaSelfCallable(Ref<RefCounted>(Object::cast_to<RefCounted>(p_instance->owner)), lambda, captures));
+					callable = GDScriptLambdaSelfCallable::create(Ref<RefCounted>(Object::cast_to<RefCounted>(p_instance->owner)), lambda, instruction_args, captures_count);
 				} else {
-					callable = memnew(GDScriptLambdaSelfCallable(p_instance->owner, lambda, captures));
+					callable = GDScriptLambdaSelfCallable::create(p_instance->owner, lambda, instruction_args, captures_count);
 				}
 
 				GET_INSTRUCTION_ARG(result, captures_count);
@@ -2558,6 +2876,46 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_JUMP_IF_NOT_INT_COMPARE) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				bool result = _compare_validated(_code_ptr[ip + 4], *VariantInternal::get_int(a), *VariantInternal::get_int(b));
+				*VariantInternal::get_bool(dst) = result;
+
+				if (!result) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_JUMP_IF_NOT_FLOAT_COMPARE) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				bool result = _compare_validated(_code_ptr[ip + 4], *VariantInternal::get_float(a), *VariantInternal::get_float(b));
+				*VariantInternal::get_bool(dst) = result;
+
+				if (!result) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -3045,6 +3403,36 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_ITERATE_BEGIN_TYPED_ARRAY(m_var_type, m_elem_type, m_get_func)                        \
+	OPCODE(OPCODE_ITERATE_BEGIN_ARRAY_##m_var_type) {                                                \
+		CHECK_SPACE(8);                                                                              \
+		GET_VARIANT_PTR(counter, 0);                                                                 \
+		GET_VARIANT_PTR(container, 1);                                                               \
+		const Array *array = VariantInternal::get_array((const Variant *)container);                 \
+		VariantInternal::initialize(counter, Variant::INT);                                          \
+		*VariantInternal::get_int(counter) = 0;                                                      \
+		if (!array->is_empty()) {                                                                    \
+			GET_VARIANT_PTR(iterator, 2);                                                            \
+			const Variant &element = (*array)[0];                                                    \
+			VariantInternal::initialize(iterator, Variant::m_var_type);                              \
+			if (likely(element.get_type() == Variant::m_var_type)) {                                 \
+				*VariantInternal::m_get_func(iterator) = *VariantInternal::m_get_func(&element);     \
+			} else {                                                                                 \
+				*VariantInternal::m_get_func(iterator) = (m_elem_type)element;                       \
+			}                                                                                        \
+			ip += 5;                                                                                 \
+		} else {                                                                                     \
+			int jumpto = _code_ptr[ip + 4];                                                          \
+			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                         \
+			ip = jumpto;                                                                             \
+		}                                                                                            \
+	}                                                                                                \
+	DISPATCH_OPCODE
+
+			// Elements of typed arrays can be copied without going through the Variant assignment.
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(INT, int64_t, get_int);
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(FLOAT, double, get_float);
+
 #define OPCODE_ITERATE_BEGIN_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_var_ret_type, m_ret_type, m_ret_get_func) \
 	OPCODE(OPCODE_ITERATE_BEGIN_PACKED_##m_var_type##_ARRAY) {                                                             \
 		CHECK_SPACE(8);                                                                                                    \
@@ -3383,6 +3771,37 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_ITERATE_TYPED_ARRAY(m_var_type, m_elem_type, m_get_func)                          \
+	OPCODE(OPCODE_ITERATE_ARRAY_##m_var_type) {                                                      \
+		CHECK_SPACE(4);                                                                              \
+		GET_VARIANT_PTR(counter, 0);                                                                 \
+		GET_VARIANT_PTR(container, 1);                                                               \
+		const Array *array = VariantInternal::get_array((const Variant *)container);                 \
+		int64_t *idx = VariantInternal::get_int(counter);                                            \
+		(*idx)++;                                                                                    \
+		if (*idx >= array->size()) {                                                                 \
+			int jumpto = _code_ptr[ip + 4];                                                          \
+			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                         \
+			ip = jumpto;                                                                             \
+		} else {                                                                                     \
+			GET_VARIANT_PTR(iterator, 2);                                                            \
+			const Variant &element = (*array)[*idx];                                                 \
+			if (unlikely(iterator->get_type() != Variant::m_var_type)) {                             \
+				VariantInternal::initialize(iterator, Variant::m_var_type);                          \
+			}                                                                                        \
+			if (likely(element.get_type() == Variant::m_var_type)) {                                 \
+				*VariantInternal::m_get_func(iterator) = *VariantInternal::m_get_func(&element);     \
+			} else {                                                                                 \
+				*VariantInternal::m_get_func(iterator) = (m_elem_type)element;                       \
+			}                                                                                        \
+			ip += 5;                                                                                 \
+		}                                                                                            \
+	}                                                                                                \
+	DISPATCH_OPCODE
+
+			OPCODE_ITERATE_TYPED_ARRAY(INT, int64_t, get_int);
+			OPCODE_ITERATE_TYPED_ARRAY(FLOAT, double, get_float);
+
 #define OPCODE_ITERATE_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_ret_get_func)            \
 	OPCODE(OPCODE_ITERATE_PACKED_##m_var_type##_ARRAY) {                                            \
 		CHECK_SPACE(4);                                                                             \
@@ -3591,6 +4010,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
+				GDScriptSamplingProfiler::check_sample();
+
 				if (EngineDebugger::is_active()) {
 					// line
 					bool do_break = false;
@@ -3672,6 +4093,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	}
 
 	OPCODES_OUT
+	if (unlikely(sampled)) {
+		GDScriptSamplingProfiler::exit_function();
+	}
+
 #ifdef DEBUG_ENABLED
 	if (GDScriptLanguage::get_singleton()->profiling) {
 		uint64_t time_taken = OS::get_singleton()->get_ticks_usec() - function_start_time;
@@ -33,6 +33,7 @@
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
@@ -74,6 +75,7 @@ GDScriptLanguage *script_language_gd = nullptr;
 Ref<ResourceFormatLoaderGDScript> resource_loader_gd;
 Ref<ResourceFormatSaverGDScript> resource_saver_gd;
 GDScriptCache *gdscript_cache = nullptr;
+Ref<GDScriptSamplingProfiler> gdscript_sampling_profiler;
 
 #ifdef TOOLS_ENABLED
 
@@ -157,6 +159,9 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		gdscript_cache = memnew(GDScriptCache);
 
 		GDScriptUtilityFunctions::register_functions();
+
+		gdscript_sampling_profiler.instantiate();
+		gdscript_sampling_profiler->bind("gdscript:sampling");
 	}
 
 #ifdef TOOLS_ENABLED
@@ -171,6 +176,9 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
+		gdscript_sampling_profiler->unbind();
+		gdscript_sampling_profiler.unref();
+
 		ScriptServer::unregister_language(script_language_gd);
 
 		if (gdscript_cache) {
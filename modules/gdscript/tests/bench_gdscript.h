@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  bench_gdscript.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCH_GDSCRIPT_H
+#define BENCH_GDSCRIPT_H
+
+#include "../gdscript.h"
+
+#include "tests/test_bench.h"
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+TEST_SUITE("[Benchmark][Modules][GDScript]") {
+	TEST_CASE("Typed VM loops") {
+		static const int LOOP_COUNT = 100000;
+
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_source_code(R"(
+extends RefCounted
+
+func compare_and_branch(n: int) -> int:
+	var count := 0
+	var i := 0
+	while i < n:
+		if i < n / 2:
+			count += 1
+		i += 1
+	return count
+
+func increment(n: int) -> int:
+	var total := 0
+	for i in n:
+		total += 1
+	return total
+
+func array_index(values: Array[int]) -> int:
+	var sum := 0
+	for i in values.size():
+		sum += values[i]
+	return sum
+
+func float_math(n: int) -> float:
+	var x := 0.0
+	for i in n:
+		x = x * 0.5 + float(i) * 0.25
+	return x
+
+func call_method(n: int) -> int:
+	var total := 0
+	for i in n:
+		total += add_one(i)
+	return total
+
+func add_one(value: int) -> int:
+	return value + 1
+)");
+		ERR_PRINT_OFF;
+		const Error error = gdscript->reload();
+		ERR_PRINT_ON;
+		REQUIRE(error == OK);
+
+		Ref<RefCounted> instance = memnew(RefCounted);
+		instance->set_script(gdscript);
+
+		Array values;
+		values.set_typed(Variant::INT, StringName(), Variant());
+		values.resize(LOOP_COUNT);
+		for (int i = 0; i < LOOP_COUNT; i++) {
+			values[i] = i;
+		}
+
+		BENCHMARK("GDScript/typed_compare_and_branch", LOOP_COUNT) {
+			bench_do_not_optimize(instance->call("compare_and_branch", LOOP_COUNT));
+		}
+
+		BENCHMARK("GDScript/typed_increment", LOOP_COUNT) {
+			bench_do_not_optimize(instance->call("increment", LOOP_COUNT));
+		}
+
+		BENCHMARK("GDScript/typed_array_index", LOOP_COUNT) {
+			bench_do_not_optimize(instance->call("array_index", values));
+		}
+
+		BENCHMARK("GDScript/typed_float_math", LOOP_COUNT) {
+			bench_do_not_optimize(instance->call("float_math", LOOP_COUNT));
+		}
+
+		BENCHMARK("GDScript/method_call", LOOP_COUNT) {
+			bench_do_not_optimize(instance->call("call_method", LOOP_COUNT));
+		}
+	}
+}
+
+} // namespace GDScriptTests
+
+#endif // BENCH_GDSCRIPT_H
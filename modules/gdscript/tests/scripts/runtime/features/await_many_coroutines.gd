@@ -0,0 +1,36 @@
+# Stacks of finished coroutines are reused by the next ones, locals must not leak between them.
+
+signal step(value)
+
+var done := 0
+
+func small(id):
+	var total = id
+	for i in 3:
+		total += await step
+	print("small %d: %d" % [id, total])
+	done += 1
+
+func large(id):
+	var a = id
+	var b = "large"
+	var c = [id]
+	var d = { id = id }
+	var e = Vector3(id, id, id)
+	for i in 3:
+		c.push_back(await step)
+	print("%s %d: %s %s %s %s" % [b, a, c, d, e])
+	done += 1
+
+func test():
+	for i in 3:
+		small(i)
+		large(i)
+	for i in 3:
+		step.emit(10)
+	for i in 2:
+		large(i + 10)
+		small(i + 10)
+	for i in 3:
+		step.emit(1)
+	print(done)
@@ -0,0 +1,21 @@
+const DEBUG := false
+const RED := Color.html("#ff0000")
+const RIGHT := Vector2.from_angle(0.0)
+const HALF := String.num(0.5)
+
+func test():
+	print(RED)
+	print(RIGHT)
+	print(HALF)
+
+	if DEBUG:
+		print("Unreachable: debug branch.")
+	elif not DEBUG:
+		print("Release branch.")
+
+	while DEBUG:
+		print("Unreachable: debug loop.")
+
+	if not DEBUG:
+		var local := "Locals in a folded branch."
+		print(local)
@@ -0,0 +1,41 @@
+func count_up(from: int, to: int) -> Array[int]:
+	var result: Array[int] = []
+	for i in range(from, to):
+		result.push_back(i)
+	return result
+
+func count_down(from: int, to: int) -> Array[int]:
+	var result: Array[int] = []
+	for i in range(from, to, -2):
+		result.push_back(i)
+	return result
+
+func test():
+	var n := 4
+	var total := 0
+	for i in range(n):
+		total += i
+	print(total)
+
+	print(count_up(2, 6))
+	print(count_up(6, 2))
+	print(count_down(6, 0))
+
+	var ints: Array[int] = [1, 2, 3]
+	for value in ints:
+		print(value, " ", typeof(value) == TYPE_INT)
+
+	var floats: Array[float] = [1.5, 2.5]
+	floats.push_back(3)
+	for value in floats:
+		print(value, " ", typeof(value) == TYPE_FLOAT)
+
+	# The iterator may be reassigned in the loop body.
+	for value in ints:
+		if value == 1:
+			value = 10
+		print(value)
+
+	var empty: Array[int] = []
+	for value in empty:
+		print("Unreachable: ", value)
@@ -0,0 +1,32 @@
+func make_adder(amount):
+	return func(value): return value + amount
+
+func test():
+	var adders = []
+	for i in 3:
+		adders.push_back(make_adder(i * 10))
+	for adder in adders:
+		print(adder.call(1))
+
+	var a = 1
+	var b = "two"
+	var c = [3]
+	var d = { four = 4 }
+	var e = Vector2(5, 6)
+	var many := func(): return [a, b, c, d, e]
+	a = 100
+	c.push_back(30)
+	print(many.call())
+	print(many.get_argument_count())
+
+	var threshold = 2
+	var factor = 3
+	print([1, 2, 3, 4].filter(func(x): return x > threshold).map(func(x): return x * factor))
+
+	var none := func(x, y): return x - y
+	print(none.get_argument_count())
+
+	var sorted = [3, 1, 2]
+	var descending = true
+	sorted.sort_custom(func(x, y): return x > y if descending else x < y)
+	print(sorted)
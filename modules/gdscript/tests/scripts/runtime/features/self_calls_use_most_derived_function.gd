@@ -0,0 +1,23 @@
+# Calls to script functions on `self` are dispatched directly,
+# but must still pick overrides from the most derived script.
+
+class Base:
+	func name() -> String:
+		return "base"
+
+	func describe() -> String:
+		return "I am " + name()
+
+	func count_down(n: int) -> int:
+		if n <= 0:
+			return 0
+		return 1 + count_down(n - 1)
+
+class Derived extends Base:
+	func name() -> String:
+		return "derived"
+
+func test():
+	print(Base.new().describe())
+	print(Derived.new().describe())
+	print(Derived.new().count_down(10))
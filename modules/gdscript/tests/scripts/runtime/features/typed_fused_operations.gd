@@ -0,0 +1,45 @@
+# Typed comparisons, compound assignments and array indexing use specialized
+# instructions. They must behave like the generic ones.
+
+func test():
+	var count := 0
+	var i := 0
+	while i < 5:
+		count += 2
+		i += 1
+	print(count)
+
+	var j := 10
+	while j > 0:
+		j -= 3
+	print(j)
+
+	var f := 0.5
+	if f < 1.0:
+		print("float less")
+	if f >= 1.0:
+		print("unreachable")
+	else:
+		print("float not greater or equal")
+
+	var a := 3
+	var b := 3
+	if a == b:
+		print("int equal")
+	if a != b:
+		print("unreachable")
+	var cond := a <= b
+	print(cond)
+
+	var arr := [10, 20, 30]
+	var sum := 0
+	for k in arr.size():
+		sum += arr[k]
+	print(sum)
+	var last := -1
+	print(arr[last])
+
+	var total := 1.5
+	total *= 2.0
+	total -= 0.5
+	print(total)
@@ -0,0 +1,54 @@
+# Untyped accesses cache what names resolve to for each kind of object.
+# The same access must keep working when the kind of object changes.
+
+class A:
+	var value = 1
+	func get_name() -> String:
+		return "A"
+
+class B:
+	var other = 0
+	var value = 2
+	func get_name() -> String:
+		return "B"
+
+class C extends A:
+	var typed_value: int = 3
+	func get_name() -> String:
+		return "C"
+
+class WithGet:
+	func _get(property):
+		if property == &"value":
+			return 4
+		return null
+
+func read_value(object):
+	return object.value
+
+func write_value(object, value):
+	object.value = value
+
+func call_name(object):
+	return object.get_name()
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), A.new(), WithGet.new()]
+	for object in objects:
+		print(read_value(object))
+	for object in objects.slice(0, 4):
+		write_value(object, 10)
+		print(read_value(object))
+	for object in objects.slice(0, 4):
+		print(call_name(object))
+
+	var c = C.new()
+	c.typed_value = 5.0
+	print(c.typed_value)
+
+	var nodes = [Node.new(), Node2D.new(), Node.new()]
+	for node in nodes:
+		node.name = "Named"
+		print(node.name)
+		print(node.get_child_count())
+		node.free()
@@ -43,6 +43,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/3d/bone_attachment_3d.h"
 #include "scene/3d/camera_3d.h"
@@ -2758,548 +2759,596 @@ Error GLTFDocument::_serialize_meshes(Ref<GLTFState> p_state) {
 	return OK;
 }
 
-Error GLTFDocument::_parse_meshes(Ref<GLTFState> p_state) {
-	if (!p_state->json.has("meshes")) {
-		return OK;
-	}
-
-	Array meshes = p_state->json["meshes"];
-	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
-		print_verbose("glTF: Parsing mesh: " + itos(i));
-		Dictionary d = meshes[i];
+Error GLTFDocument::_parse_mesh(Ref<GLTFState> p_state, const Dictionary &p_mesh_dict, GLTFMeshIndex p_index, const String &p_name, Ref<GLTFMesh> &r_mesh, LocalVector<int> &r_vertex_color_materials) {
+	print_verbose("glTF: Parsing mesh: " + itos(p_index));
+	const Dictionary &d = p_mesh_dict;
 
-		Ref<GLTFMesh> mesh;
-		mesh.instantiate();
-		bool has_vertex_color = false;
-
-		ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
-
-		Array primitives = d["primitives"];
-		const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
-		Ref<ImporterMesh> import_mesh;
-		import_mesh.instantiate();
-		String mesh_name = "mesh";
-		if (d.has("name") && !String(d["name"]).is_empty()) {
-			mesh_name = d["name"];
-			mesh->set_original_name(mesh_name);
-		}
-		import_mesh->set_name(_gen_unique_name(p_state, vformat("%s_%s", p_state->scene_name, mesh_name)));
-		mesh->set_name(import_mesh->get_name());
-
-		for (int j = 0; j < primitives.size(); j++) {
-			uint64_t flags = RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
-			Dictionary p = primitives[j];
-
-			Array array;
-			array.resize(Mesh::ARRAY_MAX);
-
-			ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
-
-			Dictionary a = p["attributes"];
-
-			Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
-			if (p.has("mode")) {
-				const int mode = p["mode"];
-				ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
-				// Convert mesh.primitive.mode to Godot Mesh enum. See:
-				// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
-				static const Mesh::PrimitiveType primitives2[7] = {
-					Mesh::PRIMITIVE_POINTS, // 0 POINTS
-					Mesh::PRIMITIVE_LINES, // 1 LINES
-					Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
-					Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
-					Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
-					// TODO: Line loop and triangle fan are not supported and need to be converted to lines and triangles.
-				};
-
-				primitive = primitives2[mode];
-			}
-
-			int32_t orig_vertex_num = 0;
-			ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
-			if (a.has("POSITION")) {
-				PackedVector3Array vertices = _decode_accessor_as_vec3(p_state, a["POSITION"], true);
-				array[Mesh::ARRAY_VERTEX] = vertices;
-				orig_vertex_num = vertices.size();
-			}
-			int32_t vertex_num = orig_vertex_num;
-
-			Vector<int> indices;
-			Vector<int> indices_mapping;
-			Vector<int> indices_rev_mapping;
-			Vector<int> indices_vec4_mapping;
-			if (p.has("indices")) {
-				indices = _decode_accessor_as_ints(p_state, p["indices"], false);
-				const int is = indices.size();
-
-				if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-					// Swap around indices, convert ccw to cw for front face.
-
-					int *w = indices.ptrw();
-					for (int k = 0; k < is; k += 3) {
-						SWAP(w[k + 1], w[k + 2]);
-					}
-				}
+	Ref<GLTFMesh> mesh;
+	mesh.instantiate();
+	bool has_vertex_color = false;
+
+	ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
+
+	Array primitives = d["primitives"];
+	const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
+	Ref<ImporterMesh> import_mesh;
+	import_mesh.instantiate();
+	String mesh_name = "mesh";
+	if (d.has("name") && !String(d["name"]).is_empty()) {
+		mesh_name = d["name"];
+		mesh->set_original_name(mesh_name);
+	}
+	import_mesh->set_name(p_name);
+	mesh->set_name(import_mesh->get_name());
+
+	for (int j = 0; j < primitives.size(); j++) {
+		uint64_t flags = RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
+		Dictionary p = primitives[j];
+
+		Array array;
+		array.resize(Mesh::ARRAY_MAX);
+
+		ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
+
+		Dictionary a = p["attributes"];
+
+		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+		if (p.has("mode")) {
+			const int mode = p["mode"];
+			ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
+			// Convert mesh.primitive.mode to Godot Mesh enum. See:
+			// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
+			static const Mesh::PrimitiveType primitives2[7] = {
+				Mesh::PRIMITIVE_POINTS, // 0 POINTS
+				Mesh::PRIMITIVE_LINES, // 1 LINES
+				Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
+				Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
+				Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
+				Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
+				Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
+				// TODO: Line loop and triangle fan are not supported and need to be converted to lines and triangles.
+			};
+
+			primitive = primitives2[mode];
+		}
+
+		int32_t orig_vertex_num = 0;
+		ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
+		if (a.has("POSITION")) {
+			PackedVector3Array vertices = _decode_accessor_as_vec3(p_state, a["POSITION"], true);
+			array[Mesh::ARRAY_VERTEX] = vertices;
+			orig_vertex_num = vertices.size();
+		}
+		int32_t vertex_num = orig_vertex_num;
+
+		Vector<int> indices;
+		Vector<int> indices_mapping;
+		Vector<int> indices_rev_mapping;
+		Vector<int> indices_vec4_mapping;
+		if (p.has("indices")) {
+			indices = _decode_accessor_as_ints(p_state, p["indices"], false);
+			const int is = indices.size();
+
+			if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+				// Swap around indices, convert ccw to cw for front face.
 
-				const int *indices_w = indices.ptrw();
-				Vector<bool> used_indices;
-				used_indices.resize_zeroed(orig_vertex_num);
-				bool *used_w = used_indices.ptrw();
-				for (int idx_i = 0; idx_i < is; idx_i++) {
-					ERR_FAIL_INDEX_V(indices_w[idx_i], orig_vertex_num, ERR_INVALID_DATA);
-					used_w[indices_w[idx_i]] = true;
-				}
-				indices_rev_mapping.resize_zeroed(orig_vertex_num);
-				int *rev_w = indices_rev_mapping.ptrw();
-				vertex_num = 0;
-				for (int vert_i = 0; vert_i < orig_vertex_num; vert_i++) {
-					if (used_w[vert_i]) {
-						rev_w[vert_i] = indices_mapping.size();
-						indices_mapping.push_back(vert_i);
-						indices_vec4_mapping.push_back(vert_i * 4 + 0);
-						indices_vec4_mapping.push_back(vert_i * 4 + 1);
-						indices_vec4_mapping.push_back(vert_i * 4 + 2);
-						indices_vec4_mapping.push_back(vert_i * 4 + 3);
-						vertex_num++;
-					}
+				int *w = indices.ptrw();
+				for (int k = 0; k < is; k += 3) {
+					SWAP(w[k + 1], w[k + 2]);
 				}
 			}
-			ERR_FAIL_COND_V(vertex_num <= 0, ERR_INVALID_DECLARATION);
 
-			if (a.has("POSITION")) {
-				PackedVector3Array vertices = _decode_accessor_as_vec3(p_state, a["POSITION"], true, indices_mapping);
-				array[Mesh::ARRAY_VERTEX] = vertices;
+			const int *indices_w = indices.ptrw();
+			Vector<bool> used_indices;
+			used_indices.resize_zeroed(orig_vertex_num);
+			bool *used_w = used_indices.ptrw();
+			for (int idx_i = 0; idx_i < is; idx_i++) {
+				ERR_FAIL_INDEX_V(indices_w[idx_i], orig_vertex_num, ERR_INVALID_DATA);
+				used_w[indices_w[idx_i]] = true;
 			}
-			if (a.has("NORMAL")) {
-				array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(p_state, a["NORMAL"], true, indices_mapping);
+			indices_rev_mapping.resize_zeroed(orig_vertex_num);
+			int *rev_w = indices_rev_mapping.ptrw();
+			vertex_num = 0;
+			for (int vert_i = 0; vert_i < orig_vertex_num; vert_i++) {
+				if (used_w[vert_i]) {
+					rev_w[vert_i] = indices_mapping.size();
+					indices_mapping.push_back(vert_i);
+					indices_vec4_mapping.push_back(vert_i * 4 + 0);
+					indices_vec4_mapping.push_back(vert_i * 4 + 1);
+					indices_vec4_mapping.push_back(vert_i * 4 + 2);
+					indices_vec4_mapping.push_back(vert_i * 4 + 3);
+					vertex_num++;
+				}
 			}
-			if (a.has("TANGENT")) {
-				array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(p_state, a["TANGENT"], true, indices_vec4_mapping);
+		}
+		ERR_FAIL_COND_V(vertex_num <= 0, ERR_INVALID_DECLARATION);
+
+		if (a.has("POSITION")) {
+			PackedVector3Array vertices = _decode_accessor_as_vec3(p_state, a["POSITION"], true, indices_mapping);
+			array[Mesh::ARRAY_VERTEX] = vertices;
+		}
+		if (a.has("NORMAL")) {
+			array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(p_state, a["NORMAL"], true, indices_mapping);
+		}
+		if (a.has("TANGENT")) {
+			array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(p_state, a["TANGENT"], true, indices_vec4_mapping);
+		}
+		if (a.has("TEXCOORD_0")) {
+			array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(p_state, a["TEXCOORD_0"], true, indices_mapping);
+		}
+		if (a.has("TEXCOORD_1")) {
+			array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(p_state, a["TEXCOORD_1"], true, indices_mapping);
+		}
+		for (int custom_i = 0; custom_i < 3; custom_i++) {
+			Vector<float> cur_custom;
+			Vector<Vector2> texcoord_first;
+			Vector<Vector2> texcoord_second;
+
+			int texcoord_i = 2 + 2 * custom_i;
+			String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
+			int num_channels = 0;
+			if (a.has(gltf_texcoord_key)) {
+				texcoord_first = _decode_accessor_as_vec2(p_state, a[gltf_texcoord_key], true, indices_mapping);
+				num_channels = 2;
 			}
-			if (a.has("TEXCOORD_0")) {
-				array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(p_state, a["TEXCOORD_0"], true, indices_mapping);
+			gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
+			if (a.has(gltf_texcoord_key)) {
+				texcoord_second = _decode_accessor_as_vec2(p_state, a[gltf_texcoord_key], true, indices_mapping);
+				num_channels = 4;
 			}
-			if (a.has("TEXCOORD_1")) {
-				array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(p_state, a["TEXCOORD_1"], true, indices_mapping);
+			if (!num_channels) {
+				break;
 			}
-			for (int custom_i = 0; custom_i < 3; custom_i++) {
-				Vector<float> cur_custom;
-				Vector<Vector2> texcoord_first;
-				Vector<Vector2> texcoord_second;
-
-				int texcoord_i = 2 + 2 * custom_i;
-				String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
-				int num_channels = 0;
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_first = _decode_accessor_as_vec2(p_state, a[gltf_texcoord_key], true, indices_mapping);
-					num_channels = 2;
-				}
-				gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_second = _decode_accessor_as_vec2(p_state, a[gltf_texcoord_key], true, indices_mapping);
-					num_channels = 4;
-				}
-				if (!num_channels) {
-					break;
+			if (num_channels == 2 || num_channels == 4) {
+				cur_custom.resize(vertex_num * num_channels);
+				for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
+					cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
 				}
-				if (num_channels == 2 || num_channels == 4) {
-					cur_custom.resize(vertex_num * num_channels);
-					for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = 0;
-						cur_custom.write[uv_i * num_channels + 1] = 0;
-					}
+				// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+				for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 0] = 0;
+					cur_custom.write[uv_i * num_channels + 1] = 0;
 				}
-				if (num_channels == 4) {
-					for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
-						// num_channels must be 4
-						cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 2] = 0;
-						cur_custom.write[uv_i * num_channels + 3] = 0;
-					}
+			}
+			if (num_channels == 4) {
+				for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
+					// num_channels must be 4
+					cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
+					cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
 				}
-				if (cur_custom.size() > 0) {
-					array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
-					int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
-					if (num_channels == 2) {
-						flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
-					} else {
-						flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
-					}
+				// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+				for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
+					cur_custom.write[uv_i * num_channels + 2] = 0;
+					cur_custom.write[uv_i * num_channels + 3] = 0;
 				}
 			}
-			if (a.has("COLOR_0")) {
-				array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(p_state, a["COLOR_0"], true, indices_mapping);
-				has_vertex_color = true;
-			}
-			if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
-				PackedInt32Array joints_0 = _decode_accessor_as_ints(p_state, a["JOINTS_0"], true, indices_vec4_mapping);
-				ERR_FAIL_COND_V(joints_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
-				array[Mesh::ARRAY_BONES] = joints_0;
-			} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				PackedInt32Array joints_0 = _decode_accessor_as_ints(p_state, a["JOINTS_0"], true, indices_vec4_mapping);
-				PackedInt32Array joints_1 = _decode_accessor_as_ints(p_state, a["JOINTS_1"], true, indices_vec4_mapping);
-				ERR_FAIL_COND_V(joints_0.size() != joints_1.size(), ERR_INVALID_DATA);
-				ERR_FAIL_COND_V(joints_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				Vector<int> joints;
-				joints.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				array[Mesh::ARRAY_BONES] = joints;
-			}
-			if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
-				Vector<float> weights = _decode_accessor_as_floats(p_state, a["WEIGHTS_0"], true, indices_vec4_mapping);
-				ERR_FAIL_COND_V(weights.size() != 4 * vertex_num, ERR_INVALID_DATA);
-				{ // glTF does not seem to normalize the weights for some reason.
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += 4) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-						}
+			if (cur_custom.size() > 0) {
+				array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
+				int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
+				if (num_channels == 2) {
+					flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
+				} else {
+					flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
+				}
+			}
+		}
+		if (a.has("COLOR_0")) {
+			array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(p_state, a["COLOR_0"], true, indices_mapping);
+			has_vertex_color = true;
+		}
+		if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
+			PackedInt32Array joints_0 = _decode_accessor_as_ints(p_state, a["JOINTS_0"], true, indices_vec4_mapping);
+			ERR_FAIL_COND_V(joints_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
+			array[Mesh::ARRAY_BONES] = joints_0;
+		} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+			PackedInt32Array joints_0 = _decode_accessor_as_ints(p_state, a["JOINTS_0"], true, indices_vec4_mapping);
+			PackedInt32Array joints_1 = _decode_accessor_as_ints(p_state, a["JOINTS_1"], true, indices_vec4_mapping);
+			ERR_FAIL_COND_V(joints_0.size() != joints_1.size(), ERR_INVALID_DATA);
+			ERR_FAIL_COND_V(joints_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			Vector<int> joints;
+			joints.resize(vertex_num * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+				joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			array[Mesh::ARRAY_BONES] = joints;
+		}
+		if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
+			Vector<float> weights = _decode_accessor_as_floats(p_state, a["WEIGHTS_0"], true, indices_vec4_mapping);
+			ERR_FAIL_COND_V(weights.size() != 4 * vertex_num, ERR_INVALID_DATA);
+			{ // glTF does not seem to normalize the weights for some reason.
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += 4) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
-			} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
-				Vector<float> weights_0 = _decode_accessor_as_floats(p_state, a["WEIGHTS_0"], true, indices_vec4_mapping);
-				Vector<float> weights_1 = _decode_accessor_as_floats(p_state, a["WEIGHTS_1"], true, indices_vec4_mapping);
-				Vector<float> weights;
-				ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
-				ERR_FAIL_COND_V(weights_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				weights.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				{ // glTF does not seem to normalize the weights for some reason.
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += weight_8_count) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						total += w[k + 4];
-						total += w[k + 5];
-						total += w[k + 6];
-						total += w[k + 7];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-							w[k + 4] /= total;
-							w[k + 5] /= total;
-							w[k + 6] /= total;
-							w[k + 7] /= total;
-						}
+			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
+			Vector<float> weights_0 = _decode_accessor_as_floats(p_state, a["WEIGHTS_0"], true, indices_vec4_mapping);
+			Vector<float> weights_1 = _decode_accessor_as_floats(p_state, a["WEIGHTS_1"], true, indices_vec4_mapping);
+			Vector<float> weights;
+			ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
+			ERR_FAIL_COND_V(weights_0.size() != 4 * vertex_num, ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			weights.resize(vertex_num * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+				weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			{ // glTF does not seem to normalize the weights for some reason.
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += weight_8_count) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					total += w[k + 4];
+					total += w[k + 5];
+					total += w[k + 6];
+					total += w[k + 7];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
+						w[k + 4] /= total;
+						w[k + 5] /= total;
+						w[k + 6] /= total;
+						w[k + 7] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
 			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		}
+
+		if (!indices.is_empty()) {
+			int *w = indices.ptrw();
+			const int is = indices.size();
+			for (int ind_i = 0; ind_i < is; ind_i++) {
+				w[ind_i] = indices_rev_mapping[indices[ind_i]];
+			}
+			array[Mesh::ARRAY_INDEX] = indices;
 
-			if (!indices.is_empty()) {
+		} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+			// Generate indices because they need to be swapped for CW/CCW.
+			const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
+			ERR_FAIL_COND_V(vertices.is_empty(), ERR_PARSE_ERROR);
+			const int vs = vertices.size();
+			indices.resize(vs);
+			{
 				int *w = indices.ptrw();
-				const int is = indices.size();
-				for (int ind_i = 0; ind_i < is; ind_i++) {
-					w[ind_i] = indices_rev_mapping[indices[ind_i]];
-				}
-				array[Mesh::ARRAY_INDEX] = indices;
-
-			} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-				// Generate indices because they need to be swapped for CW/CCW.
-				const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
-				ERR_FAIL_COND_V(vertices.is_empty(), ERR_PARSE_ERROR);
-				const int vs = vertices.size();
-				indices.resize(vs);
-				{
-					int *w = indices.ptrw();
-					for (int k = 0; k < vs; k += 3) {
-						w[k] = k;
-						w[k + 1] = k + 2;
-						w[k + 2] = k + 1;
-					}
+				for (int k = 0; k < vs; k += 3) {
+					w[k] = k;
+					w[k + 1] = k + 2;
+					w[k + 2] = k + 1;
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
 			}
+			array[Mesh::ARRAY_INDEX] = indices;
+		}
 
-			bool generate_tangents = p_state->force_generate_tangents && (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("NORMAL"));
+		bool generate_tangents = p_state->force_generate_tangents && (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("NORMAL"));
 
-			if (generate_tangents && !a.has("TEXCOORD_0")) {
-				// If we don't have UVs we provide a dummy tangent array.
-				Vector<float> tangents;
-				tangents.resize(vertex_num * 4);
-				float *tangentsw = tangents.ptrw();
+		if (generate_tangents && !a.has("TEXCOORD_0")) {
+			// If we don't have UVs we provide a dummy tangent array.
+			Vector<float> tangents;
+			tangents.resize(vertex_num * 4);
+			float *tangentsw = tangents.ptrw();
 
-				Vector<Vector3> normals = array[Mesh::ARRAY_NORMAL];
-				for (int k = 0; k < vertex_num; k++) {
-					Vector3 tan = Vector3(normals[k].z, -normals[k].x, normals[k].y).cross(normals[k].normalized()).normalized();
-					tangentsw[k * 4 + 0] = tan.x;
-					tangentsw[k * 4 + 1] = tan.y;
-					tangentsw[k * 4 + 2] = tan.z;
-					tangentsw[k * 4 + 3] = 1.0;
-				}
-				array[Mesh::ARRAY_TANGENT] = tangents;
+			Vector<Vector3> normals = array[Mesh::ARRAY_NORMAL];
+			for (int k = 0; k < vertex_num; k++) {
+				Vector3 tan = Vector3(normals[k].z, -normals[k].x, normals[k].y).cross(normals[k].normalized()).normalized();
+				tangentsw[k * 4 + 0] = tan.x;
+				tangentsw[k * 4 + 1] = tan.y;
+				tangentsw[k * 4 + 2] = tan.z;
+				tangentsw[k * 4 + 3] = 1.0;
 			}
+			array[Mesh::ARRAY_TANGENT] = tangents;
+		}
 
-			// Disable compression if all z equals 0 (the mesh is 2D).
-			const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
-			bool is_mesh_2d = true;
-			for (int k = 0; k < vertices.size(); k++) {
-				if (!Math::is_zero_approx(vertices[k].z)) {
-					is_mesh_2d = false;
-					break;
-				}
+		// Disable compression if all z equals 0 (the mesh is 2D).
+		const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
+		bool is_mesh_2d = true;
+		for (int k = 0; k < vertices.size(); k++) {
+			if (!Math::is_zero_approx(vertices[k].z)) {
+				is_mesh_2d = false;
+				break;
 			}
+		}
 
-			if (p_state->force_disable_compression || is_mesh_2d || !a.has("POSITION") || !a.has("NORMAL") || p.has("targets") || (a.has("JOINTS_0") || a.has("JOINTS_1"))) {
-				flags &= ~RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
-			}
+		if (p_state->force_disable_compression || is_mesh_2d || !a.has("POSITION") || !a.has("NORMAL") || p.has("targets") || (a.has("JOINTS_0") || a.has("JOINTS_1"))) {
+			flags &= ~RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
+		}
 
-			Ref<SurfaceTool> mesh_surface_tool;
-			mesh_surface_tool.instantiate();
-			mesh_surface_tool->create_from_triangle_arrays(array);
-			if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-			}
-			mesh_surface_tool->index();
-			if (generate_tangents && a.has("TEXCOORD_0")) {
-				//must generate mikktspace tangents.. ergh..
-				mesh_surface_tool->generate_tangents();
-			}
-			array = mesh_surface_tool->commit_to_arrays();
+		Ref<SurfaceTool> mesh_surface_tool;
+		mesh_surface_tool.instantiate();
+		mesh_surface_tool->create_from_triangle_arrays(array);
+		if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+			mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+		}
+		mesh_surface_tool->index();
+		if (generate_tangents && a.has("TEXCOORD_0")) {
+			//must generate mikktspace tangents.. ergh..
+			mesh_surface_tool->generate_tangents();
+		}
+		array = mesh_surface_tool->commit_to_arrays();
 
-			if ((flags & RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES) && a.has("NORMAL") && (a.has("TANGENT") || generate_tangents)) {
-				// Compression is enabled, so let's validate that the normals and tangents are correct.
-				Vector<Vector3> normals = array[Mesh::ARRAY_NORMAL];
-				Vector<float> tangents = array[Mesh::ARRAY_TANGENT];
-				for (int vert = 0; vert < normals.size(); vert++) {
-					Vector3 tan = Vector3(tangents[vert * 4 + 0], tangents[vert * 4 + 1], tangents[vert * 4 + 2]);
-					if (abs(tan.dot(normals[vert])) > 0.0001) {
-						// Tangent is not perpendicular to the normal, so we can't use compression.
-						flags &= ~RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
-					}
+		if ((flags & RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES) && a.has("NORMAL") && (a.has("TANGENT") || generate_tangents)) {
+			// Compression is enabled, so let's validate that the normals and tangents are correct.
+			Vector<Vector3> normals = array[Mesh::ARRAY_NORMAL];
+			Vector<float> tangents = array[Mesh::ARRAY_TANGENT];
+			for (int vert = 0; vert < normals.size(); vert++) {
+				Vector3 tan = Vector3(tangents[vert * 4 + 0], tangents[vert * 4 + 1], tangents[vert * 4 + 2]);
+				if (abs(tan.dot(normals[vert])) > 0.0001) {
+					// Tangent is not perpendicular to the normal, so we can't use compression.
+					flags &= ~RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES;
 				}
 			}
+		}
 
-			Array morphs;
-			// Blend shapes
-			if (p.has("targets")) {
-				print_verbose("glTF: Mesh has targets");
-				const Array &targets = p["targets"];
-
-				import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
-
-				if (j == 0) {
-					const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
-					for (int k = 0; k < targets.size(); k++) {
-						String bs_name;
-						if (k < target_names.size() && ((String)target_names[k]).size() != 0) {
-							bs_name = (String)target_names[k];
-						} else {
-							bs_name = String("morph_") + itos(k);
-						}
-						import_mesh->add_blend_shape(bs_name);
+		Array morphs;
+		// Blend shapes
+		if (p.has("targets")) {
+			print_verbose("glTF: Mesh has targets");
+			const Array &targets = p["targets"];
+
+			import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
+
+			if (j == 0) {
+				const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
+				for (int k = 0; k < targets.size(); k++) {
+					String bs_name;
+					if (k < target_names.size() && ((String)target_names[k]).size() != 0) {
+						bs_name = (String)target_names[k];
+					} else {
+						bs_name = String("morph_") + itos(k);
 					}
+					import_mesh->add_blend_shape(bs_name);
 				}
+			}
 
-				for (int k = 0; k < targets.size(); k++) {
-					const Dictionary &t = targets[k];
+			for (int k = 0; k < targets.size(); k++) {
+				const Dictionary &t = targets[k];
 
-					Array array_copy;
-					array_copy.resize(Mesh::ARRAY_MAX);
+				Array array_copy;
+				array_copy.resize(Mesh::ARRAY_MAX);
 
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						array_copy[l] = array[l];
-					}
+				for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+					array_copy[l] = array[l];
+				}
 
-					if (t.has("POSITION")) {
-						Vector<Vector3> varr = _decode_accessor_as_vec3(p_state, t["POSITION"], true, indices_mapping);
-						const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
-						const int size = src_varr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							const int max_idx = varr.size();
-							varr.resize(size);
-
-							Vector3 *w_varr = varr.ptrw();
-							const Vector3 *r_varr = varr.ptr();
-							const Vector3 *r_src_varr = src_varr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_varr[l] = r_varr[l] + r_src_varr[l];
-								} else {
-									w_varr[l] = r_src_varr[l];
-								}
+				if (t.has("POSITION")) {
+					Vector<Vector3> varr = _decode_accessor_as_vec3(p_state, t["POSITION"], true, indices_mapping);
+					const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
+					const int size = src_varr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						const int max_idx = varr.size();
+						varr.resize(size);
+
+						Vector3 *w_varr = varr.ptrw();
+						const Vector3 *r_varr = varr.ptr();
+						const Vector3 *r_src_varr = src_varr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_varr[l] = r_varr[l] + r_src_varr[l];
+							} else {
+								w_varr[l] = r_src_varr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_VERTEX] = varr;
 					}
-					if (t.has("NORMAL")) {
-						Vector<Vector3> narr = _decode_accessor_as_vec3(p_state, t["NORMAL"], true, indices_mapping);
-						const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
-						int size = src_narr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							int max_idx = narr.size();
-							narr.resize(size);
-
-							Vector3 *w_narr = narr.ptrw();
-							const Vector3 *r_narr = narr.ptr();
-							const Vector3 *r_src_narr = src_narr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_narr[l] = r_narr[l] + r_src_narr[l];
-								} else {
-									w_narr[l] = r_src_narr[l];
-								}
+					array_copy[Mesh::ARRAY_VERTEX] = varr;
+				}
+				if (t.has("NORMAL")) {
+					Vector<Vector3> narr = _decode_accessor_as_vec3(p_state, t["NORMAL"], true, indices_mapping);
+					const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
+					int size = src_narr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						int max_idx = narr.size();
+						narr.resize(size);
+
+						Vector3 *w_narr = narr.ptrw();
+						const Vector3 *r_narr = narr.ptr();
+						const Vector3 *r_src_narr = src_narr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_narr[l] = r_narr[l] + r_src_narr[l];
+							} else {
+								w_narr[l] = r_src_narr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_NORMAL] = narr;
 					}
-					if (t.has("TANGENT")) {
-						const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(p_state, t["TANGENT"], true, indices_mapping);
-						const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
-						ERR_FAIL_COND_V(src_tangents.is_empty(), ERR_PARSE_ERROR);
+					array_copy[Mesh::ARRAY_NORMAL] = narr;
+				}
+				if (t.has("TANGENT")) {
+					const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(p_state, t["TANGENT"], true, indices_mapping);
+					const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
+					ERR_FAIL_COND_V(src_tangents.is_empty(), ERR_PARSE_ERROR);
 
-						Vector<float> tangents_v4;
+					Vector<float> tangents_v4;
 
-						{
-							int max_idx = tangents_v3.size();
-
-							int size4 = src_tangents.size();
-							tangents_v4.resize(size4);
-							float *w4 = tangents_v4.ptrw();
-
-							const Vector3 *r3 = tangents_v3.ptr();
-							const float *r4 = src_tangents.ptr();
-
-							for (int l = 0; l < size4 / 4; l++) {
-								if (l < max_idx) {
-									w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
-									w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
-									w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
-								} else {
-									w4[l * 4 + 0] = r4[l * 4 + 0];
-									w4[l * 4 + 1] = r4[l * 4 + 1];
-									w4[l * 4 + 2] = r4[l * 4 + 2];
-								}
-								w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
+					{
+						int max_idx = tangents_v3.size();
+
+						int size4 = src_tangents.size();
+						tangents_v4.resize(size4);
+						float *w4 = tangents_v4.ptrw();
+
+						const Vector3 *r3 = tangents_v3.ptr();
+						const float *r4 = src_tangents.ptr();
+
+						for (int l = 0; l < size4 / 4; l++) {
+							if (l < max_idx) {
+								w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
+								w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
+								w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
+							} else {
+								w4[l * 4 + 0] = r4[l * 4 + 0];
+								w4[l * 4 + 1] = r4[l * 4 + 1];
+								w4[l * 4 + 2] = r4[l * 4 + 2];
 							}
+							w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
 						}
-
-						array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
 					}
 
-					Ref<SurfaceTool> blend_surface_tool;
-					blend_surface_tool.instantiate();
-					blend_surface_tool->create_from_triangle_arrays(array_copy);
-					if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-						blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-					}
-					blend_surface_tool->index();
-					if (generate_tangents) {
-						blend_surface_tool->generate_tangents();
-					}
-					array_copy = blend_surface_tool->commit_to_arrays();
+					array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
+				}
 
-					// Enforce blend shape mask array format
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1ULL << l))) {
-							array_copy[l] = Variant();
-						}
-					}
+				Ref<SurfaceTool> blend_surface_tool;
+				blend_surface_tool.instantiate();
+				blend_surface_tool->create_from_triangle_arrays(array_copy);
+				if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+					blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+				}
+				blend_surface_tool->index();
+				if (generate_tangents) {
+					blend_surface_tool->generate_tangents();
+				}
+				array_copy = blend_surface_tool->commit_to_arrays();
 
-					morphs.push_back(array_copy);
+				// Enforce blend shape mask array format
+				for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+					if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1ULL << l))) {
+						array_copy[l] = Variant();
+					}
 				}
+
+				morphs.push_back(array_copy);
 			}
+		}
 
-			Ref<Material> mat;
-			String mat_name;
-			if (!p_state->discard_meshes_and_materials) {
-				if (p.has("material")) {
-					const int material = p["material"];
-					ERR_FAIL_INDEX_V(material, p_state->materials.size(), ERR_FILE_CORRUPT);
-					Ref<Material> mat3d = p_state->materials[material];
-					ERR_FAIL_NULL_V(mat3d, ERR_FILE_CORRUPT);
-
-					Ref<BaseMaterial3D> base_material = mat3d;
-					if (has_vertex_color && base_material.is_valid()) {
-						base_material->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
-					}
-					mat = mat3d;
+		Ref<Material> mat;
+		String mat_name;
+		if (!p_state->discard_meshes_and_materials) {
+			if (p.has("material")) {
+				const int material = p["material"];
+				ERR_FAIL_INDEX_V(material, p_state->materials.size(), ERR_FILE_CORRUPT);
+				Ref<Material> mat3d = p_state->materials[material];
+				ERR_FAIL_NULL_V(mat3d, ERR_FILE_CORRUPT);
 
-				} else {
-					Ref<StandardMaterial3D> mat3d;
-					mat3d.instantiate();
-					if (has_vertex_color) {
-						mat3d->set_flag(StandardMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
-					}
-					mat = mat3d;
+				// Flagged once all meshes are parsed, materials are shared between meshes parsed on different threads.
+				if (has_vertex_color) {
+					r_vertex_color_materials.push_back(material);
 				}
-				ERR_FAIL_NULL_V(mat, ERR_FILE_CORRUPT);
-				mat_name = mat->get_name();
+				mat = mat3d;
+
+			} else {
+				Ref<StandardMaterial3D> mat3d;
+				mat3d.instantiate();
+				if (has_vertex_color) {
+					mat3d->set_flag(StandardMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
+				}
+				mat = mat3d;
 			}
-			import_mesh->add_surface(primitive, array, morphs,
-					Dictionary(), mat, mat_name, flags);
+			ERR_FAIL_NULL_V(mat, ERR_FILE_CORRUPT);
+			mat_name = mat->get_name();
 		}
+		import_mesh->add_surface(primitive, array, morphs,
+				Dictionary(), mat, mat_name, flags);
+	}
 
-		Vector<float> blend_weights;
-		blend_weights.resize(import_mesh->get_blend_shape_count());
-		for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
-			blend_weights.write[weight_i] = 0.0f;
-		}
+	Vector<float> blend_weights;
+	blend_weights.resize(import_mesh->get_blend_shape_count());
+	for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
+		blend_weights.write[weight_i] = 0.0f;
+	}
 
-		if (d.has("weights")) {
-			const Array &weights = d["weights"];
-			for (int j = 0; j < weights.size(); j++) {
-				if (j >= blend_weights.size()) {
-					break;
-				}
-				blend_weights.write[j] = weights[j];
+	if (d.has("weights")) {
+		const Array &weights = d["weights"];
+		for (int j = 0; j < weights.size(); j++) {
+			if (j >= blend_weights.size()) {
+				break;
 			}
+			blend_weights.write[j] = weights[j];
+		}
+	}
+	mesh->set_blend_weights(blend_weights);
+	mesh->set_mesh(import_mesh);
+
+	r_mesh = mesh;
+	return OK;
+}
+
+void GLTFDocument::_parse_mesh_task(uint32_t p_index, MeshParseData *p_data) {
+	p_data->errors[p_index] = _parse_mesh(p_data->state, p_data->meshes[p_index], p_index, p_data->names[p_index], p_data->results[p_index], p_data->vertex_color_materials[p_index]);
+}
+
+Error GLTFDocument::_parse_meshes(Ref<GLTFState> p_state) {
+	if (!p_state->json.has("meshes")) {
+		return OK;
+	}
+
+	const Array &meshes = p_state->json["meshes"];
+	const uint32_t mesh_count = meshes.size();
+
+	MeshParseData data;
+	data.state = p_state;
+	data.meshes.resize(mesh_count);
+	data.names.resize(mesh_count);
+	data.results.resize(mesh_count);
+	data.errors.resize(mesh_count);
+	data.vertex_color_materials.resize(mesh_count);
+
+	// Unique names depend on the order, so they are generated before parsing.
+	for (uint32_t i = 0; i < mesh_count; i++) {
+		const Dictionary &d = meshes[i];
+		String mesh_name = "mesh";
+		if (d.has("name") && !String(d["name"]).is_empty()) {
+			mesh_name = d["name"];
+		}
+		data.meshes[i] = d;
+		data.names[i] = _gen_unique_name(p_state, vformat("%s_%s", p_state->scene_name, mesh_name));
+	}
+
+	// Decoding the accessors and building the surfaces of each mesh is independent from the other meshes.
+	if (mesh_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_parse_mesh_task, &data, mesh_count, -1, true, SNAME("GLTFParseMeshes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (mesh_count == 1) {
+		_parse_mesh_task(0, &data);
+	}
+
+	for (uint32_t i = 0; i < mesh_count; i++) {
+		if (data.errors[i] != OK) {
+			return data.errors[i];
 		}
-		mesh->set_blend_weights(blend_weights);
-		mesh->set_mesh(import_mesh);
 
-		p_state->meshes.push_back(mesh);
+		for (int material : data.vertex_color_materials[i]) {
+			Ref<BaseMaterial3D> base_material = p_state->materials[material];
+			if (base_material.is_valid()) {
+				base_material->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
+			}
+		}
+		p_state->meshes.push_back(data.results[i]);
 	}
 
 	print_verbose("glTF: Total meshes: " + itos(p_state->meshes.size()));
@@ -3576,6 +3625,24 @@ void GLTFDocument::_parse_image_save_image(Ref<GLTFState> p_state, const Vector<
 	p_state->source_images.push_back(p_image);
 }
 
+bool GLTFDocument::_can_parse_images_on_threads() const {
+	for (const Ref<GLTFDocumentExtension> &ext : document_extensions) {
+		if (ext.is_valid() && (ext->get_script_instance() || ClassDB::get_api_type(ext->get_class_name()) == ClassDB::API_EXTENSION)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GLTFDocument::_parse_image_task(uint32_t p_index, ImageParseData *p_data) {
+	ImageParseEntry &entry = p_data->entries[p_index];
+	if (!entry.decode) {
+		return;
+	}
+	entry.image = _parse_image_bytes_into_image(p_data->state, entry.data, entry.mime_type, entry.index, entry.file_extension);
+	entry.image->set_name(entry.name);
+}
+
 Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_path) {
 	ERR_FAIL_NULL_V(p_state, ERR_INVALID_PARAMETER);
 	if (!p_state->json.has("images")) {
@@ -3586,8 +3653,12 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 	const Array &images = p_state->json["images"];
 	HashSet<String> used_names;
+	ImageParseData parse_data;
+	parse_data.state = p_state;
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &dict = images[i];
+		ImageParseEntry entry;
+		entry.index = i;
 
 		// glTF 2.0 supports PNG and JPEG types, which can be specified as (from spec):
 		// "- a URI to an external file in one of the supported images formats, or
@@ -3643,8 +3714,8 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				// the material), so we only do that only as fallback.
 				Ref<Texture2D> texture = ResourceLoader::load(uri);
 				if (texture.is_valid()) {
-					p_state->images.push_back(texture);
-					p_state->source_images.push_back(texture->get_image());
+					entry.texture = texture;
+					parse_data.entries.push_back(entry);
 					continue;
 				}
 				// mimeType is optional, but if we have it in the file extension, let's use it.
@@ -3658,8 +3729,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				data = FileAccess::get_file_as_bytes(uri);
 				if (data.size() == 0) {
 					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, mime_type, uri));
-					p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-					p_state->source_images.push_back(Ref<Image>());
+					parse_data.entries.push_back(entry); // Placeholder to keep count.
 					continue;
 				}
 			}
@@ -3679,15 +3749,40 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		// Note: There are paths above that return early, so this point might not be reached.
 		if (data.is_empty()) {
 			WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded, no data found. Skipping it.", i));
-			p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-			p_state->source_images.push_back(Ref<Image>());
+			parse_data.entries.push_back(entry); // Placeholder to keep count.
 			continue;
 		}
-		// Parse the image data from bytes into an Image resource and save if needed.
-		String file_extension;
-		Ref<Image> img = _parse_image_bytes_into_image(p_state, data, mime_type, i, file_extension);
-		img->set_name(image_name);
-		_parse_image_save_image(p_state, data, file_extension, i, img);
+		entry.data = data;
+		entry.mime_type = mime_type;
+		entry.name = image_name;
+		entry.decode = true;
+		parse_data.entries.push_back(entry);
+	}
+
+	// Parse the image data from bytes into Image resources. PNG and JPEG decoding
+	// dominates the import of many files, so it's spread over the worker threads
+	// unless an extension that may not be thread-safe takes part in it.
+	const uint32_t entry_count = parse_data.entries.size();
+	if (entry_count > 1 && _can_parse_images_on_threads()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_parse_image_task, &parse_data, entry_count, -1, true, SNAME("GLTFParseImages"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < entry_count; i++) {
+			_parse_image_task(i, &parse_data);
+		}
+	}
+
+	// Saving may import the images in the editor, so it's done in order on this thread.
+	for (const ImageParseEntry &entry : parse_data.entries) {
+		if (entry.decode) {
+			_parse_image_save_image(p_state, entry.data, entry.file_extension, entry.index, entry.image);
+		} else if (entry.texture.is_valid()) {
+			p_state->images.push_back(entry.texture);
+			p_state->source_images.push_back(entry.texture->get_image());
+		} else {
+			p_state->images.push_back(Ref<Texture2D>());
+			p_state->source_images.push_back(Ref<Image>());
+		}
 	}
 
 	print_verbose("glTF: Total images: " + itos(p_state->images.size()));
@@ -176,6 +176,16 @@ private:
 	Vector<Transform3D> _decode_accessor_as_xform(Ref<GLTFState> p_state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
+	struct MeshParseData {
+		Ref<GLTFState> state;
+		LocalVector<Dictionary> meshes;
+		LocalVector<String> names;
+		LocalVector<Ref<GLTFMesh>> results;
+		LocalVector<Error> errors;
+		LocalVector<LocalVector<int>> vertex_color_materials;
+	};
+	Error _parse_mesh(Ref<GLTFState> p_state, const Dictionary &p_mesh_dict, GLTFMeshIndex p_index, const String &p_name, Ref<GLTFMesh> &r_mesh, LocalVector<int> &r_vertex_color_materials);
+	void _parse_mesh_task(uint32_t p_index, MeshParseData *p_data);
 	Error _parse_meshes(Ref<GLTFState> p_state);
 	Error _serialize_textures(Ref<GLTFState> p_state);
 	Error _serialize_texture_samplers(Ref<GLTFState> p_state);
@@ -183,6 +193,22 @@ private:
 	Error _serialize_lights(Ref<GLTFState> p_state);
 	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_file_extension, int p_index, Ref<Image> p_image);
+	struct ImageParseEntry {
+		int index = 0;
+		bool decode = false;
+		Ref<Texture2D> texture; // Loaded directly from an external file.
+		Vector<uint8_t> data;
+		String mime_type;
+		String name;
+		Ref<Image> image;
+		String file_extension;
+	};
+	struct ImageParseData {
+		Ref<GLTFState> state;
+		LocalVector<ImageParseEntry> entries;
+	};
+	bool _can_parse_images_on_threads() const;
+	void _parse_image_task(uint32_t p_index, ImageParseData *p_data);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
 	Error _parse_textures(Ref<GLTFState> p_state);
 	Error _parse_texture_samplers(Ref<GLTFState> p_state);
@@ -31,7 +31,9 @@
 #include "grid_map.h"
 
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/light_3d.h"
+#include "scene/resources/3d/box_shape_3d.h"
 #include "scene/resources/3d/mesh_library.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "scene/resources/physics_material.h"
@@ -191,6 +193,18 @@ real_t GridMap::get_collision_priority() const {
 	return collision_priority;
 }
 
+void GridMap::set_collision_merge_boxes(bool p_enable) {
+	if (collision_merge_boxes == p_enable) {
+		return;
+	}
+	collision_merge_boxes = p_enable;
+	_recreate_octant_data();
+}
+
+bool GridMap::is_collision_merge_boxes_enabled() const {
+	return collision_merge_boxes;
+}
+
 void GridMap::set_physics_material(Ref<PhysicsMaterial> p_material) {
 	physics_material = p_material;
 	_update_physics_bodies_characteristics();
@@ -540,6 +554,183 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
+// Returns the axis-aligned bounds of a box shape placed at p_xform, if it stays axis-aligned there.
+static bool _get_aligned_box(const MeshLibrary::ShapeData &p_shape, const Transform3D &p_xform, AABB &r_aabb) {
+	Ref<BoxShape3D> box = p_shape.shape;
+	if (box.is_null()) {
+		return false;
+	}
+
+	Transform3D xform = p_xform * p_shape.local_transform;
+	for (int i = 0; i < 3; i++) {
+		int axes = 0;
+		for (int j = 0; j < 3; j++) {
+			if (!Math::is_zero_approx(xform.basis.rows[i][j])) {
+				axes++;
+			}
+		}
+		if (axes != 1) {
+			return false;
+		}
+	}
+
+	Vector3 size = box->get_size();
+	r_aabb = xform.xform(AABB(-size * 0.5, size));
+	return true;
+}
+
+// Whether p_next sits right after p_box along p_axis and matches it on the other two axes.
+static bool _boxes_stack(const AABB &p_box, const AABB &p_next, int p_axis) {
+	for (int i = 0; i < 3; i++) {
+		if (i == p_axis) {
+			if (!Math::is_equal_approx(p_box.position[i] + p_box.size[i], p_next.position[i])) {
+				return false;
+			}
+		} else if (!Math::is_equal_approx(p_box.position[i], p_next.position[i]) || !Math::is_equal_approx(p_box.size[i], p_next.size[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GridMap::_octant_prepare(uint32_t p_index, Octant **p_octants) {
+	// Only reads the cell map and the mesh library, so octants can be prepared on any thread.
+	Octant &g = *p_octants[p_index];
+
+	g.prepared_multimeshes.clear();
+	g.prepared_shapes.clear();
+	g.prepared_boxes.clear();
+	g.prepared_collision_debug.clear();
+
+	if (!mesh_library.is_valid()) {
+		return;
+	}
+
+	const Vector3 ofs = _get_offset();
+	const bool use_multimeshes = baked_meshes.is_empty();
+	const bool collision_debug = g.collision_debug.is_valid();
+
+	HashMap<int, uint32_t> multimesh_indices;
+	HashMap<IndexKey, AABB, IndexKey> boxes;
+
+	for (const IndexKey &E : g.cells) {
+		HashMap<IndexKey, Cell, IndexKey>::ConstIterator cell = cell_map.find(E);
+		ERR_CONTINUE(!cell);
+		const Cell &c = cell->value;
+
+		if (!mesh_library->has_item(c.item)) {
+			continue;
+		}
+
+		Vector3 cellpos = Vector3(E.x, E.y, E.z);
+
+		Transform3D xform;
+
+		xform.basis = _ortho_bases[c.rot];
+		xform.set_origin(cellpos * cell_size + ofs);
+		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+		if (use_multimeshes && mesh_library->get_item_mesh(c.item).is_valid()) {
+			HashMap<int, uint32_t>::Iterator index = multimesh_indices.find(c.item);
+			if (!index) {
+				index = multimesh_indices.insert(c.item, g.prepared_multimeshes.size());
+				g.prepared_multimeshes.push_back(Octant::PreparedMultimesh());
+				g.prepared_multimeshes[index->value].item = c.item;
+			}
+
+			Octant::PreparedMultimesh &multimesh = g.prepared_multimeshes[index->value];
+			multimesh.transforms.push_back(xform * mesh_library->get_item_mesh_transform(c.item));
+			multimesh.keys.push_back(E);
+		}
+
+		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
+		AABB box;
+		if (collision_merge_boxes && shapes.size() == 1 && _get_aligned_box(shapes[0], xform, box)) {
+			boxes.insert(E, box);
+		} else {
+			for (int i = 0; i < shapes.size(); i++) {
+				if (shapes[i].shape.is_valid()) {
+					g.prepared_shapes.push_back(Pair<RID, Transform3D>(shapes[i].shape->get_rid(), xform * shapes[i].local_transform));
+				}
+			}
+		}
+
+		if (collision_debug) {
+			for (int i = 0; i < shapes.size(); i++) {
+				if (shapes[i].shape.is_valid()) {
+					shapes.write[i].shape->add_vertices_to_array(g.prepared_collision_debug, xform * shapes[i].local_transform);
+				}
+			}
+		}
+	}
+
+	// Multimesh buffers are uploaded in one call each, in the layout of RS::MULTIMESH_TRANSFORM_3D.
+	for (Octant::PreparedMultimesh &multimesh : g.prepared_multimeshes) {
+		multimesh.buffer.resize(multimesh.transforms.size() * 12);
+		float *w = multimesh.buffer.ptrw();
+		for (const Transform3D &xform : multimesh.transforms) {
+			for (int i = 0; i < 3; i++) {
+				*w++ = xform.basis.rows[i][0];
+				*w++ = xform.basis.rows[i][1];
+				*w++ = xform.basis.rows[i][2];
+				*w++ = xform.origin[i];
+			}
+		}
+	}
+
+	_merge_cell_boxes(boxes, g.prepared_boxes);
+}
+
+void GridMap::_merge_cell_boxes(const HashMap<IndexKey, AABB, IndexKey> &p_boxes, LocalVector<AABB> &r_merged) {
+	// Greedily grow each box into the largest run along X, then into rows along Y and slabs along Z.
+	HashSet<IndexKey, IndexKey> merged;
+	for (const KeyValue<IndexKey, AABB> &E : p_boxes) {
+		if (merged.has(E.key)) {
+			continue;
+		}
+
+		const IndexKey from = E.key;
+		int size[3] = { 1, 1, 1 };
+		for (int axis = 0; axis < 3; axis++) {
+			while (true) {
+				// Every box on the next layer must stack on the one below it.
+				bool layer_fits = true;
+				for (int a = 0; a < (axis == 0 ? 1 : size[0]) && layer_fits; a++) {
+					for (int b = 0; b < (axis == 2 ? size[1] : 1) && layer_fits; b++) {
+						IndexKey below = from;
+						below.x += axis == 0 ? size[0] - 1 : a;
+						below.y += axis == 1 ? size[1] - 1 : (axis == 2 ? b : 0);
+						below.z += axis == 2 ? size[2] - 1 : 0;
+						IndexKey next = below;
+						(axis == 0 ? next.x : (axis == 1 ? next.y : next.z))++;
+
+						HashMap<IndexKey, AABB, IndexKey>::ConstIterator next_box = p_boxes.find(next);
+						layer_fits = next_box && !merged.has(next) && _boxes_stack(p_boxes[below], next_box->value, axis);
+					}
+				}
+				if (!layer_fits) {
+					break;
+				}
+				size[axis]++;
+			}
+		}
+
+		AABB run = E.value;
+		for (int x = 0; x < size[0]; x++) {
+			for (int y = 0; y < size[1]; y++) {
+				for (int z = 0; z < size[2]; z++) {
+					IndexKey key = from;
+					key.x += x;
+					key.y += y;
+					key.z += z;
+					merged.insert(key);
+					run.merge_with(p_boxes[key]);
+				}
+			}
+		}
+		r_merged.push_back(run);
+	}
+}
+
 bool GridMap::_octant_update(const OctantKey &p_key) {
 	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
 	Octant &g = *octant_map[p_key];
@@ -549,6 +740,10 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 
 	//erase body shapes
 	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
+	for (const RID &shape : g.merged_box_shapes) {
+		PhysicsServer3D::get_singleton()->free(shape);
+	}
+	g.merged_box_shapes.clear();
 
 	//erase body shapes debug
 	if (g.collision_debug.is_valid()) {
@@ -582,15 +777,16 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		return true;
 	}
 
-	Vector<Vector3> col_debug;
-
-	/*
-	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
-	 */
-
-	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
+	// add the items' shapes at their cell transforms to octant's static_body
+	for (const Pair<RID, Transform3D> &shape : g.prepared_shapes) {
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shape.first, shape.second);
+	}
+	for (const AABB &box : g.prepared_boxes) {
+		RID shape = PhysicsServer3D::get_singleton()->box_shape_create();
+		PhysicsServer3D::get_singleton()->shape_set_data(shape, box.size * 0.5);
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shape, Transform3D(Basis(), box.get_center()));
+		g.merged_box_shapes.push_back(shape);
+	}
 
 	for (const IndexKey &E : g.cells) {
 		ERR_CONTINUE(!cell_map.has(E));
@@ -600,43 +796,18 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 			continue;
 		}
 
-		Vector3 cellpos = Vector3(E.x, E.y, E.z);
-		Vector3 ofs = _get_offset();
-
-		Transform3D xform;
-
-		xform.basis = _ortho_bases[c.rot];
-		xform.set_origin(cellpos * cell_size + ofs);
-		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-		if (baked_meshes.size() == 0) {
-			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
-				}
-
-				Pair<Transform3D, IndexKey> p;
-				p.first = xform * mesh_library->get_item_mesh_transform(c.item);
-				p.second = E;
-				multimesh_items[c.item].push_back(p);
-			}
-		}
-
-		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-		// add the item's shape at given xform to octant's static_body
-		for (int i = 0; i < shapes.size(); i++) {
-			// add the item's shape
-			if (!shapes[i].shape.is_valid()) {
-				continue;
-			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
-			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
-			}
-		}
-
 		// add the item's navigation_mesh at given xform to GridMap's Navigation ancestor
 		Ref<NavigationMesh> navigation_mesh = mesh_library->get_item_navigation_mesh(c.item);
 		if (navigation_mesh.is_valid()) {
+			Vector3 cellpos = Vector3(E.x, E.y, E.z);
+			Vector3 ofs = _get_offset();
+
+			Transform3D xform;
+
+			xform.basis = _ortho_bases[c.rot];
+			xform.set_origin(cellpos * cell_size + ofs);
+			xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+
 			Octant::NavigationCell nm;
 			nm.xform = xform * mesh_library->get_item_navigation_mesh_transform(c.item);
 			nm.navigation_layers = mesh_library->get_item_navigation_layers(c.item);
@@ -684,27 +855,23 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 
 	//update multimeshes, only if not baked
 	if (baked_meshes.size() == 0) {
-		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
+		for (const Octant::PreparedMultimesh &E : g.prepared_multimeshes) {
 			Octant::MultimeshInstance mmi;
 
 			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
+			RS::get_singleton()->multimesh_allocate_data(mm, E.transforms.size(), RS::MULTIMESH_TRANSFORM_3D);
+			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.item)->get_rid());
+			RS::get_singleton()->multimesh_set_buffer(mm, E.buffer);
 
-			int idx = 0;
-			for (const Pair<Transform3D, IndexKey> &F : E.value) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
 #ifdef TOOLS_ENABLED
-
+			for (uint32_t idx = 0; idx < E.transforms.size(); idx++) {
 				Octant::MultimeshInstance::Item it;
 				it.index = idx;
-				it.transform = F.first;
-				it.key = F.second;
+				it.transform = E.transforms[idx];
+				it.key = E.keys[idx];
 				mmi.items.push_back(it);
-#endif
-
-				idx++;
 			}
+#endif
 
 			RID instance = RS::get_singleton()->instance_create();
 			RS::get_singleton()->instance_set_base(instance, mm);
@@ -721,10 +888,10 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		}
 	}
 
-	if (col_debug.size()) {
+	if (g.prepared_collision_debug.size()) {
 		Array arr;
 		arr.resize(RS::ARRAY_MAX);
-		arr[RS::ARRAY_VERTEX] = col_debug;
+		arr[RS::ARRAY_VERTEX] = g.prepared_collision_debug;
 
 		RS::get_singleton()->mesh_add_surface_from_arrays(g.collision_debug, RS::PRIMITIVE_LINES, arr);
 		SceneTree *st = SceneTree::get_singleton();
@@ -733,6 +900,11 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		}
 	}
 
+	g.prepared_multimeshes.clear();
+	g.prepared_shapes.clear();
+	g.prepared_boxes.clear();
+	g.prepared_collision_debug.clear();
+
 	g.dirty = false;
 
 	return false;
@@ -869,6 +1041,10 @@ void GridMap::_octant_clean_up(const OctantKey &p_key) {
 	}
 
 	PhysicsServer3D::get_singleton()->free(g.static_body);
+	for (const RID &shape : g.merged_box_shapes) {
+		PhysicsServer3D::get_singleton()->free(shape);
+	}
+	g.merged_box_shapes.clear();
 
 	// Erase navigation
 	for (const KeyValue<IndexKey, Octant::NavigationCell> &E : g.navigation_cell_ids) {
@@ -1028,6 +1204,21 @@ void GridMap::_update_octants_callback() {
 		return;
 	}
 
+	// Cell transforms, collision shapes and multimesh buffers don't touch any server,
+	// so dirty octants are prepared in parallel before being applied in order.
+	LocalVector<Octant *> dirty_octants;
+	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
+		if (E.value->dirty && E.value->cells.size()) {
+			dirty_octants.push_back(E.value);
+		}
+	}
+	if (dirty_octants.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_octant_prepare, dirty_octants.ptr(), dirty_octants.size(), -1, true, SNAME("GridMapPrepareOctants"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (dirty_octants.size() == 1) {
+		_octant_prepare(0, dirty_octants.ptr());
+	}
+
 	List<OctantKey> to_delete;
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
 		if (_octant_update(E.key)) {
@@ -1061,6 +1252,9 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_collision_priority", "priority"), &GridMap::set_collision_priority);
 	ClassDB::bind_method(D_METHOD("get_collision_priority"), &GridMap::get_collision_priority);
 
+	ClassDB::bind_method(D_METHOD("set_collision_merge_boxes", "enable"), &GridMap::set_collision_merge_boxes);
+	ClassDB::bind_method(D_METHOD("is_collision_merge_boxes_enabled"), &GridMap::is_collision_merge_boxes_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_physics_material", "material"), &GridMap::set_physics_material);
 	ClassDB::bind_method(D_METHOD("get_physics_material"), &GridMap::get_physics_material);
 
@@ -1128,6 +1322,7 @@ void GridMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_layer", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_layer", "get_collision_layer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_mask", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_mask", "get_collision_mask");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_priority"), "set_collision_priority", "get_collision_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merge_boxes"), "set_collision_merge_boxes", "is_collision_merge_boxes_enabled");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bake_navigation"), "set_bake_navigation", "is_baking_navigation");
 
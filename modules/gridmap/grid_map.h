@@ -31,6 +31,7 @@
 #ifndef GRID_MAP_H
 #define GRID_MAP_H
 
+#include "core/templates/local_vector.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/3d/mesh_library.h"
 #include "scene/resources/multimesh.h"
@@ -42,6 +43,7 @@ class PhysicsMaterial;
 
 class GridMap : public Node3D {
 	GDCLASS(GridMap, Node3D);
+	friend class TestGridMapInternalsAccessor;
 
 	enum {
 		MAP_DIRTY_TRANSFORMS = 1,
@@ -126,6 +128,21 @@ class GridMap : public Node3D {
 		bool dirty = false;
 		RID static_body;
 		HashMap<IndexKey, NavigationCell> navigation_cell_ids;
+
+		// Box shapes created for runs of merged cell boxes, owned by this octant.
+		LocalVector<RID> merged_box_shapes;
+
+		// Filled on a worker thread by _octant_prepare(), then sent to the servers by _octant_update().
+		struct PreparedMultimesh {
+			int item = 0;
+			LocalVector<Transform3D> transforms;
+			LocalVector<IndexKey> keys;
+			Vector<float> buffer;
+		};
+		LocalVector<PreparedMultimesh> prepared_multimeshes;
+		LocalVector<Pair<RID, Transform3D>> prepared_shapes;
+		LocalVector<AABB> prepared_boxes;
+		Vector<Vector3> prepared_collision_debug;
 	};
 
 	union OctantKey {
@@ -152,6 +169,7 @@ class GridMap : public Node3D {
 	uint32_t collision_layer = 1;
 	uint32_t collision_mask = 1;
 	real_t collision_priority = 1.0;
+	bool collision_merge_boxes = false;
 	Ref<PhysicsMaterial> physics_material;
 	bool bake_navigation = false;
 	RID map_override;
@@ -190,6 +208,8 @@ class GridMap : public Node3D {
 	void _update_physics_bodies_characteristics();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
+	void _octant_prepare(uint32_t p_index, Octant **p_octants);
+	static void _merge_cell_boxes(const HashMap<IndexKey, AABB, IndexKey> &p_boxes, LocalVector<AABB> &r_merged);
 	bool _octant_update(const OctantKey &p_key);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
@@ -247,6 +267,9 @@ public:
 	void set_collision_priority(real_t p_priority);
 	real_t get_collision_priority() const;
 
+	void set_collision_merge_boxes(bool p_enable);
+	bool is_collision_merge_boxes_enabled() const;
+
 	void set_physics_material(Ref<PhysicsMaterial> p_material);
 	Ref<PhysicsMaterial> get_physics_material() const;
 
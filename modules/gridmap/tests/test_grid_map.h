@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  test_grid_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GRID_MAP_H
+#define TEST_GRID_MAP_H
+
+#include "../grid_map.h"
+
+#include "tests/test_macros.h"
+
+class TestGridMapInternalsAccessor {
+public:
+	static LocalVector<AABB> merge_cell_boxes(const Vector<Vector3i> &p_cells, const Vector3 &p_box_size = Vector3(1, 1, 1)) {
+		HashMap<GridMap::IndexKey, AABB, GridMap::IndexKey> boxes;
+		for (const Vector3i &cell : p_cells) {
+			boxes.insert(GridMap::IndexKey(cell), AABB(Vector3(cell), p_box_size));
+		}
+		LocalVector<AABB> merged;
+		GridMap::_merge_cell_boxes(boxes, merged);
+		return merged;
+	}
+
+	static LocalVector<AABB> merge_cell_boxes(const HashMap<Vector3i, AABB> &p_boxes) {
+		HashMap<GridMap::IndexKey, AABB, GridMap::IndexKey> boxes;
+		for (const KeyValue<Vector3i, AABB> &E : p_boxes) {
+			boxes.insert(GridMap::IndexKey(E.key), E.value);
+		}
+		LocalVector<AABB> merged;
+		GridMap::_merge_cell_boxes(boxes, merged);
+		return merged;
+	}
+};
+
+namespace TestGridMap {
+
+static real_t total_volume(const LocalVector<AABB> &p_boxes) {
+	real_t volume = 0;
+	for (const AABB &box : p_boxes) {
+		volume += box.get_volume();
+	}
+	return volume;
+}
+
+TEST_CASE("[GridMap] Merging cell boxes") {
+	SUBCASE("A solid block becomes a single box") {
+		Vector<Vector3i> cells;
+		for (int x = 0; x < 4; x++) {
+			for (int y = 0; y < 2; y++) {
+				for (int z = 0; z < 3; z++) {
+					cells.push_back(Vector3i(x, y, z));
+				}
+			}
+		}
+		const LocalVector<AABB> merged = TestGridMapInternalsAccessor::merge_cell_boxes(cells);
+		REQUIRE(merged.size() == 1);
+		CHECK(merged[0].is_equal_approx(AABB(Vector3(0, 0, 0), Vector3(4, 2, 3))));
+	}
+
+	SUBCASE("An L shape is split without overlap") {
+		const Vector<Vector3i> cells = { Vector3i(0, 0, 0), Vector3i(1, 0, 0), Vector3i(0, 1, 0) };
+		const LocalVector<AABB> merged = TestGridMapInternalsAccessor::merge_cell_boxes(cells);
+		CHECK(merged.size() == 2);
+		CHECK(Math::is_equal_approx(total_volume(merged), 3));
+		CHECK_FALSE(merged[0].intersects(merged[1]));
+	}
+
+	SUBCASE("Separate cells are not merged") {
+		const Vector<Vector3i> cells = { Vector3i(0, 0, 0), Vector3i(2, 0, 0), Vector3i(0, 0, 2) };
+		const LocalVector<AABB> merged = TestGridMapInternalsAccessor::merge_cell_boxes(cells);
+		CHECK(merged.size() == 3);
+	}
+
+	SUBCASE("Boxes that don't line up are not merged") {
+		HashMap<Vector3i, AABB> boxes;
+		boxes.insert(Vector3i(0, 0, 0), AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)));
+		boxes.insert(Vector3i(1, 0, 0), AABB(Vector3(1, 0, 0), Vector3(1, 0.5, 1)));
+		boxes.insert(Vector3i(2, 0, 0), AABB(Vector3(2, 0, 0), Vector3(1, 0.5, 1)));
+		const LocalVector<AABB> merged = TestGridMapInternalsAccessor::merge_cell_boxes(boxes);
+		REQUIRE(merged.size() == 2);
+		CHECK(merged[0].is_equal_approx(AABB(Vector3(0, 0, 0), Vector3(1, 1, 1))));
+		CHECK(merged[1].is_equal_approx(AABB(Vector3(1, 0, 0), Vector3(2, 0.5, 1))));
+	}
+}
+
+} // namespace TestGridMap
+
+#endif // TEST_GRID_MAP_H
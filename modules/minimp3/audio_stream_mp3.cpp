@@ -77,7 +77,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 					}
 				}
 				loop_fade_remaining = 0;
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			}
 		}
@@ -85,7 +85,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (use_loop) {
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -106,18 +106,16 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
-	active = true;
-	seek(p_from_pos);
-	loops = 0;
+	start_decoder(p_from_pos);
 	begin_resample();
 }
 
 void AudioStreamPlaybackMP3::stop() {
-	active = false;
+	stop_decoder();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	return is_decoder_playing(active);
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
@@ -125,10 +123,14 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
-	return double(frames_mixed) / mp3_stream->sample_rate;
+	return MAX(0.0, double(frames_mixed) / mp3_stream->sample_rate - get_decoded_time());
 }
 
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	seek_decoder(p_time);
+}
+
+void AudioStreamPlaybackMP3::_seek(double p_time) {
 	if (!active) {
 		return;
 	}
@@ -141,6 +143,20 @@ void AudioStreamPlaybackMP3::seek(double p_time) {
 	mp3dec_ex_seek(mp3d, (uint64_t)frames_mixed * mp3_stream->channels);
 }
 
+void AudioStreamPlaybackMP3::_start_decoder(double p_from_pos) {
+	active = true;
+	_seek(p_from_pos);
+	loops = 0;
+}
+
+void AudioStreamPlaybackMP3::_seek_decoder(double p_time) {
+	_seek(p_time);
+}
+
+void AudioStreamPlaybackMP3::_stop_decoder() {
+	active = false;
+}
+
 void AudioStreamPlaybackMP3::tag_used_streams() {
 	mp3_stream->tag_used(get_playback_position());
 }
@@ -209,6 +225,8 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	mp3s->set_background_decode(true);
+
 	return mp3s;
 }
 
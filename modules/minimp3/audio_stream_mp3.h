@@ -61,9 +61,14 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	bool _is_sample = false;
 	Ref<AudioSamplePlayback> sample_playback;
 
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
+	virtual void _start_decoder(double p_from_pos) override;
+	virtual void _seek_decoder(double p_time) override;
+	virtual void _stop_decoder() override;
 
 public:
 	virtual void start(double p_from_pos = 0.0) override;
@@ -914,6 +914,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<byte> AsSpan()
+            => new ReadOnlySpan<byte>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -945,6 +950,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<int> AsSpan()
+            => new ReadOnlySpan<int>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -976,6 +986,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<long> AsSpan()
+            => new ReadOnlySpan<long>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1007,6 +1022,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<float> AsSpan()
+            => new ReadOnlySpan<float>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1038,6 +1058,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<double> AsSpan()
+            => new ReadOnlySpan<double>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1100,6 +1125,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<Vector2> AsSpan()
+            => new ReadOnlySpan<Vector2>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1131,6 +1161,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<Vector3> AsSpan()
+            => new ReadOnlySpan<Vector3>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1163,6 +1198,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<Vector4> AsSpan()
+            => new ReadOnlySpan<Vector4>(_ptr, Size);
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -1195,6 +1235,11 @@ namespace Godot.NativeInterop
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
             get => _ptr != null ? (int)(*((ulong*)_ptr - 1)) : 0;
         }
+
+        // Reads the elements in place. Only valid while the array is alive and unmodified.
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public readonly unsafe ReadOnlySpan<Color> AsSpan()
+            => new ReadOnlySpan<Color>(_ptr, Size);
     }
 
     public enum godot_error_handler_type
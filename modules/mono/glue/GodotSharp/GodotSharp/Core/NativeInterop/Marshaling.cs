@@ -404,18 +404,8 @@ namespace Godot.NativeInterop
 
         // PackedInt32Array
 
-        public static unsafe int[] ConvertNativePackedInt32ArrayToSystemArray(godot_packed_int32_array p_array)
-        {
-            int* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<int>();
-            int sizeInBytes = size * sizeof(int);
-            var array = new int[size];
-            fixed (int* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static int[] ConvertNativePackedInt32ArrayToSystemArray(godot_packed_int32_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_int32_array ConvertSystemArrayToNativePackedInt32Array(Span<int> p_array)
         {
@@ -427,18 +417,8 @@ namespace Godot.NativeInterop
 
         // PackedInt64Array
 
-        public static unsafe long[] ConvertNativePackedInt64ArrayToSystemArray(godot_packed_int64_array p_array)
-        {
-            long* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<long>();
-            int sizeInBytes = size * sizeof(long);
-            var array = new long[size];
-            fixed (long* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static long[] ConvertNativePackedInt64ArrayToSystemArray(godot_packed_int64_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_int64_array ConvertSystemArrayToNativePackedInt64Array(Span<long> p_array)
         {
@@ -450,18 +430,8 @@ namespace Godot.NativeInterop
 
         // PackedFloat32Array
 
-        public static unsafe float[] ConvertNativePackedFloat32ArrayToSystemArray(godot_packed_float32_array p_array)
-        {
-            float* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<float>();
-            int sizeInBytes = size * sizeof(float);
-            var array = new float[size];
-            fixed (float* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static float[] ConvertNativePackedFloat32ArrayToSystemArray(godot_packed_float32_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_float32_array ConvertSystemArrayToNativePackedFloat32Array(
             Span<float> p_array)
@@ -474,18 +444,8 @@ namespace Godot.NativeInterop
 
         // PackedFloat64Array
 
-        public static unsafe double[] ConvertNativePackedFloat64ArrayToSystemArray(godot_packed_float64_array p_array)
-        {
-            double* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<double>();
-            int sizeInBytes = size * sizeof(double);
-            var array = new double[size];
-            fixed (double* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static double[] ConvertNativePackedFloat64ArrayToSystemArray(godot_packed_float64_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_float64_array ConvertSystemArrayToNativePackedFloat64Array(
             Span<double> p_array)
@@ -531,18 +491,8 @@ namespace Godot.NativeInterop
 
         // PackedVector2Array
 
-        public static unsafe Vector2[] ConvertNativePackedVector2ArrayToSystemArray(godot_packed_vector2_array p_array)
-        {
-            Vector2* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<Vector2>();
-            int sizeInBytes = size * sizeof(Vector2);
-            var array = new Vector2[size];
-            fixed (Vector2* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static Vector2[] ConvertNativePackedVector2ArrayToSystemArray(godot_packed_vector2_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_vector2_array ConvertSystemArrayToNativePackedVector2Array(
             Span<Vector2> p_array)
@@ -555,18 +505,8 @@ namespace Godot.NativeInterop
 
         // PackedVector3Array
 
-        public static unsafe Vector3[] ConvertNativePackedVector3ArrayToSystemArray(godot_packed_vector3_array p_array)
-        {
-            Vector3* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<Vector3>();
-            int sizeInBytes = size * sizeof(Vector3);
-            var array = new Vector3[size];
-            fixed (Vector3* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static Vector3[] ConvertNativePackedVector3ArrayToSystemArray(godot_packed_vector3_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_vector3_array ConvertSystemArrayToNativePackedVector3Array(
             Span<Vector3> p_array)
@@ -579,18 +519,8 @@ namespace Godot.NativeInterop
 
         // PackedVector4Array
 
-        public static unsafe Vector4[] ConvertNativePackedVector4ArrayToSystemArray(godot_packed_vector4_array p_array)
-        {
-            Vector4* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<Vector4>();
-            int sizeInBytes = size * sizeof(Vector4);
-            var array = new Vector4[size];
-            fixed (Vector4* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static Vector4[] ConvertNativePackedVector4ArrayToSystemArray(godot_packed_vector4_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_vector4_array ConvertSystemArrayToNativePackedVector4Array(
             Span<Vector4> p_array)
@@ -603,18 +533,8 @@ namespace Godot.NativeInterop
 
         // PackedColorArray
 
-        public static unsafe Color[] ConvertNativePackedColorArrayToSystemArray(godot_packed_color_array p_array)
-        {
-            Color* buffer = p_array.Buffer;
-            int size = p_array.Size;
-            if (size == 0)
-                return Array.Empty<Color>();
-            int sizeInBytes = size * sizeof(Color);
-            var array = new Color[size];
-            fixed (Color* dest = array)
-                Buffer.MemoryCopy(buffer, dest, sizeInBytes, sizeInBytes);
-            return array;
-        }
+        public static Color[] ConvertNativePackedColorArrayToSystemArray(godot_packed_color_array p_array)
+            => p_array.AsSpan().ToArray();
 
         public static unsafe godot_packed_color_array ConvertSystemArrayToNativePackedColorArray(Span<Color> p_array)
         {
@@ -190,6 +190,15 @@ void MultiplayerSynchronizer::set_visibility_public(bool p_visible) {
 	set_visibility_for(0, p_visible);
 }
 
+bool MultiplayerSynchronizer::is_visibility_spatial() const {
+	return spatial_visibility;
+}
+
+void MultiplayerSynchronizer::set_visibility_spatial(bool p_spatial) {
+	// Applied by the replication interface on its next update.
+	spatial_visibility = p_spatial;
+}
+
 bool MultiplayerSynchronizer::is_visible_to(int p_peer) {
 	if (visibility_filters.size()) {
 		Variant arg = p_peer;
@@ -261,6 +270,8 @@ void MultiplayerSynchronizer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_visibility_public", "visible"), &MultiplayerSynchronizer::set_visibility_public);
 	ClassDB::bind_method(D_METHOD("is_visibility_public"), &MultiplayerSynchronizer::is_visibility_public);
+	ClassDB::bind_method(D_METHOD("set_visibility_spatial", "spatial"), &MultiplayerSynchronizer::set_visibility_spatial);
+	ClassDB::bind_method(D_METHOD("is_visibility_spatial"), &MultiplayerSynchronizer::is_visibility_spatial);
 
 	ClassDB::bind_method(D_METHOD("add_visibility_filter", "filter"), &MultiplayerSynchronizer::add_visibility_filter);
 	ClassDB::bind_method(D_METHOD("remove_visibility_filter", "filter"), &MultiplayerSynchronizer::remove_visibility_filter);
@@ -273,6 +284,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "spatial_visibility"), "set_visibility_spatial", "is_visibility_spatial");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -59,6 +59,7 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool spatial_visibility = false;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -108,6 +109,8 @@ public:
 
 	bool is_visibility_public() const;
 	void set_visibility_public(bool p_public);
+	bool is_visibility_spatial() const;
+	void set_visibility_spatial(bool p_spatial);
 	bool is_visible_to(int p_peer);
 	void set_visibility_for(int p_peer, bool p_visible);
 	bool get_visibility_for(int p_peer) const;
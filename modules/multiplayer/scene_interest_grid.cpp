@@ -0,0 +1,255 @@
+/**************************************************************************/
+/*  scene_interest_grid.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_interest_grid.h"
+
+Vector3i SceneInterestGrid::_get_cell(const Vector3 &p_position) const {
+	return Vector3i((p_position / cell_size).floor());
+}
+
+void SceneInterestGrid::_add_peer_cells(int p_peer, const PeerData &p_data) {
+	for (int x = p_data.cell_min.x; x <= p_data.cell_max.x; x++) {
+		for (int y = p_data.cell_min.y; y <= p_data.cell_max.y; y++) {
+			for (int z = p_data.cell_min.z; z <= p_data.cell_max.z; z++) {
+				peer_cells[Vector3i(x, y, z)].push_back(p_peer);
+			}
+		}
+	}
+}
+
+void SceneInterestGrid::_remove_peer_cells(int p_peer, const PeerData &p_data) {
+	for (int x = p_data.cell_min.x; x <= p_data.cell_max.x; x++) {
+		for (int y = p_data.cell_min.y; y <= p_data.cell_max.y; y++) {
+			for (int z = p_data.cell_min.z; z <= p_data.cell_max.z; z++) {
+				_erase_from_cell(peer_cells, Vector3i(x, y, z), p_peer);
+			}
+		}
+	}
+}
+
+void SceneInterestGrid::_set_visible(int p_peer, PeerData &p_peer_data, const ObjectID &p_object, ObjectData &p_object_data, bool p_visible, LocalVector<Change> &r_changes) {
+	if (p_peer_data.objects.has(p_object) == p_visible) {
+		return;
+	}
+	if (p_visible) {
+		p_peer_data.objects.insert(p_object);
+		p_object_data.peers.insert(p_peer);
+	} else {
+		p_peer_data.objects.erase(p_object);
+		p_object_data.peers.erase(p_peer);
+	}
+	Change change;
+	change.peer = p_peer;
+	change.object = p_object;
+	change.visible = p_visible;
+	r_changes.push_back(change);
+}
+
+void SceneInterestGrid::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "The interest cell size must be greater than 0.");
+	if (cell_size == p_size) {
+		return;
+	}
+	cell_size = p_size;
+
+	// Rebuild the cells, visibility itself doesn't depend on them.
+	object_cells.clear();
+	peer_cells.clear();
+	for (KeyValue<ObjectID, ObjectData> &E : objects) {
+		E.value.cell = _get_cell(E.value.position);
+		object_cells[E.value.cell].push_back(E.key);
+	}
+	for (KeyValue<int, PeerData> &E : peers) {
+		const Vector3 extents(E.value.radius, E.value.radius, E.value.radius);
+		E.value.cell_min = _get_cell(E.value.position - extents);
+		E.value.cell_max = _get_cell(E.value.position + extents);
+		_add_peer_cells(E.key, E.value);
+	}
+}
+
+void SceneInterestGrid::set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "The interest radius must be positive.");
+	PeerData *data = peers.getptr(p_peer);
+	if (!data) {
+		data = &peers.insert(p_peer, PeerData())->value;
+	} else if (data->position == p_position && data->radius == p_radius) {
+		return;
+	} else {
+		_remove_peer_cells(p_peer, *data);
+	}
+
+	data->position = p_position;
+	data->radius = p_radius;
+	const Vector3 extents(p_radius, p_radius, p_radius);
+	data->cell_min = _get_cell(p_position - extents);
+	data->cell_max = _get_cell(p_position + extents);
+	_add_peer_cells(p_peer, *data);
+
+	if (!data->dirty) {
+		data->dirty = true;
+		dirty_peers.push_back(p_peer);
+	}
+}
+
+void SceneInterestGrid::remove_peer(int p_peer) {
+	PeerData *data = peers.getptr(p_peer);
+	if (!data) {
+		return;
+	}
+	_remove_peer_cells(p_peer, *data);
+	for (const ObjectID &oid : data->objects) {
+		ObjectData *object = objects.getptr(oid);
+		if (object) {
+			object->peers.erase(p_peer);
+		}
+	}
+	peers.erase(p_peer);
+}
+
+void SceneInterestGrid::set_object_position(const ObjectID &p_object, const Vector3 &p_position) {
+	ObjectData *data = objects.getptr(p_object);
+	const Vector3i cell = _get_cell(p_position);
+	if (!data) {
+		data = &objects.insert(p_object, ObjectData())->value;
+		object_cells[cell].push_back(p_object);
+	} else if (data->position == p_position) {
+		return;
+	} else if (data->cell != cell) {
+		_erase_from_cell(object_cells, data->cell, p_object);
+		object_cells[cell].push_back(p_object);
+	}
+
+	data->position = p_position;
+	data->cell = cell;
+	if (!data->dirty) {
+		data->dirty = true;
+		dirty_objects.push_back(p_object);
+	}
+}
+
+void SceneInterestGrid::remove_object(const ObjectID &p_object) {
+	ObjectData *data = objects.getptr(p_object);
+	if (!data) {
+		return;
+	}
+	_erase_from_cell(object_cells, data->cell, p_object);
+	for (int peer : data->peers) {
+		PeerData *peer_data = peers.getptr(peer);
+		if (peer_data) {
+			peer_data->objects.erase(p_object);
+		}
+	}
+	objects.erase(p_object);
+}
+
+bool SceneInterestGrid::is_visible(int p_peer, const ObjectID &p_object) const {
+	const PeerData *data = peers.getptr(p_peer);
+	return data && data->objects.has(p_object);
+}
+
+void SceneInterestGrid::update(LocalVector<Change> &r_changes) {
+	// Peers that moved look at the objects around them.
+	for (int peer : dirty_peers) {
+		PeerData *data = peers.getptr(peer);
+		if (!data) {
+			continue; // Removed since.
+		}
+		data->dirty = false;
+		const real_t radius_squared = data->radius * data->radius;
+
+		// What is no longer in range.
+		LocalVector<ObjectID> hidden;
+		for (const ObjectID &oid : data->objects) {
+			if (objects[oid].position.distance_squared_to(data->position) > radius_squared) {
+				hidden.push_back(oid);
+			}
+		}
+		for (const ObjectID &oid : hidden) {
+			_set_visible(peer, *data, oid, objects[oid], false, r_changes);
+		}
+
+		for (int x = data->cell_min.x; x <= data->cell_max.x; x++) {
+			for (int y = data->cell_min.y; y <= data->cell_max.y; y++) {
+				for (int z = data->cell_min.z; z <= data->cell_max.z; z++) {
+					const LocalVector<ObjectID> *cell = object_cells.getptr(Vector3i(x, y, z));
+					if (!cell) {
+						continue;
+					}
+					for (const ObjectID &oid : *cell) {
+						ObjectData &object = objects[oid];
+						if (object.position.distance_squared_to(data->position) <= radius_squared) {
+							_set_visible(peer, *data, oid, object, true, r_changes);
+						}
+					}
+				}
+			}
+		}
+	}
+	dirty_peers.clear();
+
+	// Objects that moved are checked against the peers that could see them.
+	LocalVector<int> candidates;
+	for (const ObjectID &oid : dirty_objects) {
+		ObjectData *data = objects.getptr(oid);
+		if (!data) {
+			continue; // Removed since.
+		}
+		data->dirty = false;
+
+		candidates.clear();
+		for (int peer : data->peers) {
+			candidates.push_back(peer);
+		}
+		const LocalVector<int> *cell = peer_cells.getptr(data->cell);
+		if (cell) {
+			for (int peer : *cell) {
+				if (!data->peers.has(peer)) {
+					candidates.push_back(peer);
+				}
+			}
+		}
+
+		for (int peer : candidates) {
+			PeerData &peer_data = peers[peer];
+			const bool visible = data->position.distance_squared_to(peer_data.position) <= peer_data.radius * peer_data.radius;
+			_set_visible(peer, peer_data, oid, *data, visible, r_changes);
+		}
+	}
+	dirty_objects.clear();
+}
+
+void SceneInterestGrid::clear() {
+	objects.clear();
+	peers.clear();
+	object_cells.clear();
+	peer_cells.clear();
+	dirty_objects.clear();
+	dirty_peers.clear();
+}
@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*  scene_interest_grid.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_INTEREST_GRID_H
+#define SCENE_INTEREST_GRID_H
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Tracks which objects are within the area of interest of each peer. Objects and
+// peers are bucketed in a uniform grid, and only those that moved since the last
+// update are re-evaluated, against what is around them.
+class SceneInterestGrid {
+public:
+	struct Change {
+		int peer = 0;
+		ObjectID object;
+		bool visible = false;
+	};
+
+private:
+	struct ObjectData {
+		Vector3 position;
+		Vector3i cell;
+		bool dirty = false;
+		HashSet<int> peers;
+	};
+
+	struct PeerData {
+		Vector3 position;
+		real_t radius = 0.0;
+		Vector3i cell_min;
+		Vector3i cell_max;
+		bool dirty = false;
+		HashSet<ObjectID> objects;
+	};
+
+	real_t cell_size = 64.0;
+
+	HashMap<ObjectID, ObjectData> objects;
+	HashMap<int, PeerData> peers;
+	HashMap<Vector3i, LocalVector<ObjectID>> object_cells;
+	HashMap<Vector3i, LocalVector<int>> peer_cells; // Peers whose area overlaps the cell.
+
+	LocalVector<ObjectID> dirty_objects;
+	LocalVector<int> dirty_peers;
+
+	Vector3i _get_cell(const Vector3 &p_position) const;
+	void _add_peer_cells(int p_peer, const PeerData &p_data);
+	void _remove_peer_cells(int p_peer, const PeerData &p_data);
+	void _set_visible(int p_peer, PeerData &p_peer_data, const ObjectID &p_object, ObjectData &p_object_data, bool p_visible, LocalVector<Change> &r_changes);
+
+	template <typename T>
+	static void _erase_from_cell(HashMap<Vector3i, LocalVector<T>> &p_cells, const Vector3i &p_cell, const T &p_value) {
+		LocalVector<T> *cell = p_cells.getptr(p_cell);
+		if (!cell) {
+			return;
+		}
+		int64_t idx = cell->find(p_value);
+		if (idx >= 0) {
+			cell->remove_at_unordered(idx);
+		}
+		if (cell->is_empty()) {
+			p_cells.erase(p_cell);
+		}
+	}
+
+public:
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const { return cell_size; }
+
+	void set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius);
+	void remove_peer(int p_peer);
+	bool has_peer(int p_peer) const { return peers.has(p_peer); }
+
+	void set_object_position(const ObjectID &p_object, const Vector3 &p_position);
+	void remove_object(const ObjectID &p_object);
+	bool has_object(const ObjectID &p_object) const { return objects.has(p_object); }
+
+	bool is_visible(int p_peer, const ObjectID &p_object) const;
+
+	// Re-evaluates what moved since the last call, and reports the visibility changes.
+	void update(LocalVector<Change> &r_changes);
+	void clear();
+};
+
+#endif // SCENE_INTEREST_GRID_H
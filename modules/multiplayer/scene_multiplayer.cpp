@@ -165,6 +165,7 @@ Error SceneMultiplayer::poll() {
 	}
 
 	replicator->on_network_process();
+	rpc->flush_batches();
 	return OK;
 }
 
@@ -174,6 +175,7 @@ void SceneMultiplayer::clear() {
 	connected_peers.clear();
 	packet_cache.clear();
 	replicator->on_reset();
+	rpc->clear_batches();
 	cache->clear();
 	relay_buffer->clear();
 }
@@ -637,6 +639,46 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_compact_sync_enabled(bool p_enabled) {
+	replicator->set_compact_sync_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_compact_sync_enabled() const {
+	return replicator->is_compact_sync_enabled();
+}
+
+void SceneMultiplayer::set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius) {
+	replicator->set_peer_interest(p_peer, p_position, p_radius);
+}
+
+void SceneMultiplayer::remove_peer_interest(int p_peer) {
+	replicator->remove_peer_interest(p_peer);
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
+void SceneMultiplayer::set_rpc_batching_enabled(bool p_enabled) {
+	rpc->set_batching_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_batching_enabled() const {
+	return rpc->is_batching_enabled();
+}
+
+void SceneMultiplayer::set_rpc_coalescing_enabled(bool p_enabled) {
+	rpc->set_coalescing_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_coalescing_enabled() const {
+	return rpc->is_coalescing_enabled();
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -665,6 +707,16 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("set_compact_sync_enabled", "enabled"), &SceneMultiplayer::set_compact_sync_enabled);
+	ClassDB::bind_method(D_METHOD("is_compact_sync_enabled"), &SceneMultiplayer::is_compact_sync_enabled);
+	ClassDB::bind_method(D_METHOD("set_peer_interest", "peer", "position", "radius"), &SceneMultiplayer::set_peer_interest);
+	ClassDB::bind_method(D_METHOD("remove_peer_interest", "peer"), &SceneMultiplayer::remove_peer_interest);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_rpc_batching_enabled", "enabled"), &SceneMultiplayer::set_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_rpc_batching_enabled"), &SceneMultiplayer::is_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("set_rpc_coalescing_enabled", "enabled"), &SceneMultiplayer::set_rpc_coalescing_enabled);
+	ClassDB::bind_method(D_METHOD("is_rpc_coalescing_enabled"), &SceneMultiplayer::is_rpc_coalescing_enabled);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -674,6 +726,10 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compact_sync"), "set_compact_sync_enabled", "is_compact_sync_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "0.01,1024,0.01,or_greater,suffix:m"), "set_interest_cell_size", "get_interest_cell_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_batching"), "set_rpc_batching_enabled", "is_rpc_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_coalescing"), "set_rpc_coalescing_enabled", "is_rpc_coalescing_enabled");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
@@ -201,6 +201,21 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_compact_sync_enabled(bool p_enabled);
+	bool is_compact_sync_enabled() const;
+
+	void set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius);
+	void remove_peer_interest(int p_peer);
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_rpc_batching_enabled(bool p_enabled);
+	bool is_rpc_batching_enabled() const;
+
+	void set_rpc_coalescing_enabled(bool p_enabled);
+	bool is_rpc_coalescing_enabled() const;
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
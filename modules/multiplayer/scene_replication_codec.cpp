@@ -0,0 +1,487 @@
+/**************************************************************************/
+/*  scene_replication_codec.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_codec.h"
+
+#include "core/io/marshalls.h"
+#include "scene/main/multiplayer_api.h"
+
+// Bits needed to store values from 0 to p_max.
+static int _get_bits_for(uint64_t p_max) {
+	int bits = 0;
+	while (bits < 64 && (p_max >> bits) != 0) {
+		bits++;
+	}
+	return MAX(bits, 1);
+}
+
+int SceneReplicationCodec::Quantization::get_range_bits() const {
+	if (!is_enabled() || range.y <= range.x) {
+		return 0;
+	}
+	const double steps = Math::round((double(range.y) - double(range.x)) / precision);
+	if (steps >= double(1u << 31)) {
+		return 0; // Too fine for a fixed width.
+	}
+	return _get_bits_for(uint64_t(steps));
+}
+
+void SceneReplicationCodec::BitWriter::put_bits(uint64_t p_value, int p_bits) {
+	while (p_bits > 0) {
+		const uint32_t byte = bit_pos >> 3;
+		const int offset = bit_pos & 7;
+		if (byte >= data.size()) {
+			data.push_back(0);
+		}
+		const int count = MIN(8 - offset, p_bits);
+		data[byte] |= uint8_t((p_value & ((1u << count) - 1)) << offset);
+		p_value >>= count;
+		p_bits -= count;
+		bit_pos += count;
+	}
+}
+
+void SceneReplicationCodec::BitWriter::put_varint(uint64_t p_value) {
+	do {
+		const uint64_t group = p_value & 0x7F;
+		p_value >>= 7;
+		put_bits(group | (p_value ? 0x80 : 0), 8);
+	} while (p_value);
+}
+
+void SceneReplicationCodec::BitWriter::put_bytes(const uint8_t *p_data, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		put_bits(p_data[i], 8);
+	}
+}
+
+void SceneReplicationCodec::BitWriter::clear() {
+	data.clear();
+	bit_pos = 0;
+}
+
+uint64_t SceneReplicationCodec::BitReader::get_bits(int p_bits) {
+	if (overflowed || bit_pos + p_bits > size * 8) {
+		overflowed = true;
+		return 0;
+	}
+	uint64_t value = 0;
+	int shift = 0;
+	while (p_bits > 0) {
+		const int offset = bit_pos & 7;
+		const int count = MIN(8 - offset, p_bits);
+		value |= uint64_t((data[bit_pos >> 3] >> offset) & ((1u << count) - 1)) << shift;
+		shift += count;
+		p_bits -= count;
+		bit_pos += count;
+	}
+	return value;
+}
+
+uint64_t SceneReplicationCodec::BitReader::get_varint() {
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		const uint64_t group = get_bits(8);
+		value |= (group & 0x7F) << shift;
+		if (!(group & 0x80)) {
+			break;
+		}
+	}
+	return value;
+}
+
+bool SceneReplicationCodec::BitReader::get_bytes(uint8_t *r_data, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_data[i] = get_bits(8);
+	}
+	return !overflowed;
+}
+
+/* Scalars */
+
+static int64_t _quantize_scalar(double p_value, const SceneReplicationCodec::Quantization &p_quantization) {
+	if (!Math::is_finite(p_value)) {
+		p_value = 0.0;
+	}
+	double steps;
+	if (p_quantization.get_range_bits()) {
+		steps = Math::round((CLAMP(p_value, double(p_quantization.range.x), double(p_quantization.range.y)) - p_quantization.range.x) / p_quantization.precision);
+	} else {
+		// Keep within the exactly representable integers.
+		steps = CLAMP(Math::round(p_value / p_quantization.precision), -4503599627370496.0, 4503599627370496.0);
+	}
+	return int64_t(steps);
+}
+
+static double _dequantize_scalar(int64_t p_steps, const SceneReplicationCodec::Quantization &p_quantization) {
+	if (p_quantization.get_range_bits()) {
+		return p_quantization.range.x + p_steps * double(p_quantization.precision);
+	}
+	return p_steps * double(p_quantization.precision);
+}
+
+static void _put_scalar(SceneReplicationCodec::BitWriter &p_writer, double p_value, const double *p_baseline, const SceneReplicationCodec::Quantization &p_quantization) {
+	const int64_t steps = _quantize_scalar(p_value, p_quantization);
+	const int bits = p_quantization.get_range_bits();
+	if (bits) {
+		p_writer.put_bits(steps, bits);
+	} else {
+		p_writer.put_zigzag(p_baseline ? steps - _quantize_scalar(*p_baseline, p_quantization) : steps);
+	}
+}
+
+static double _get_scalar(SceneReplicationCodec::BitReader &p_reader, const double *p_baseline, const SceneReplicationCodec::Quantization &p_quantization) {
+	const int bits = p_quantization.get_range_bits();
+	int64_t steps;
+	if (bits) {
+		steps = p_reader.get_bits(bits);
+	} else {
+		steps = p_reader.get_zigzag();
+		if (p_baseline) {
+			steps += _quantize_scalar(*p_baseline, p_quantization);
+		}
+	}
+	return _dequantize_scalar(steps, p_quantization);
+}
+
+static void _put_real(SceneReplicationCodec::BitWriter &p_writer, real_t p_value) {
+	MarshallReal m;
+	m.r = p_value;
+	p_writer.put_bits(m.i, sizeof(real_t) * 8);
+}
+
+static real_t _get_real(SceneReplicationCodec::BitReader &p_reader) {
+	MarshallReal m;
+	m.i = p_reader.get_bits(sizeof(real_t) * 8);
+	return m.r;
+}
+
+/* Vectors */
+
+template <typename T, int N>
+static T _quantize_vector(const T &p_value, const SceneReplicationCodec::Quantization &p_quantization) {
+	T ret;
+	for (int i = 0; i < N; i++) {
+		ret[i] = _dequantize_scalar(_quantize_scalar(p_value[i], p_quantization), p_quantization);
+	}
+	return ret;
+}
+
+template <typename T, int N>
+static void _put_vector(SceneReplicationCodec::BitWriter &p_writer, const T &p_value, const Variant *p_baseline, const SceneReplicationCodec::Quantization &p_quantization) {
+	const T baseline = p_baseline ? T(*p_baseline) : T();
+	for (int i = 0; i < N; i++) {
+		if (p_quantization.is_enabled()) {
+			const double base = baseline[i];
+			_put_scalar(p_writer, p_value[i], p_baseline ? &base : nullptr, p_quantization);
+		} else {
+			_put_real(p_writer, p_value[i]);
+		}
+	}
+}
+
+template <typename T, int N>
+static T _get_vector(SceneReplicationCodec::BitReader &p_reader, const Variant *p_baseline, const SceneReplicationCodec::Quantization &p_quantization) {
+	const T baseline = p_baseline ? T(*p_baseline) : T();
+	T ret;
+	for (int i = 0; i < N; i++) {
+		if (p_quantization.is_enabled()) {
+			const double base = baseline[i];
+			ret[i] = _get_scalar(p_reader, p_baseline ? &base : nullptr, p_quantization);
+		} else {
+			ret[i] = _get_real(p_reader);
+		}
+	}
+	return ret;
+}
+
+template <typename T, int N>
+static void _put_int_vector(SceneReplicationCodec::BitWriter &p_writer, const T &p_value, const Variant *p_baseline) {
+	const T baseline = p_baseline ? T(*p_baseline) : T();
+	for (int i = 0; i < N; i++) {
+		p_writer.put_zigzag(int64_t(p_value[i]) - int64_t(baseline[i]));
+	}
+}
+
+template <typename T, int N>
+static T _get_int_vector(SceneReplicationCodec::BitReader &p_reader, const Variant *p_baseline) {
+	const T baseline = p_baseline ? T(*p_baseline) : T();
+	T ret;
+	for (int i = 0; i < N; i++) {
+		ret[i] = int32_t(int64_t(baseline[i]) + p_reader.get_zigzag());
+	}
+	return ret;
+}
+
+/* Quaternions, with the smallest three components. */
+
+struct QuaternionCode {
+	int largest = 3;
+	uint32_t components[3] = {};
+};
+
+static int _get_quaternion_bits(const SceneReplicationCodec::Quantization &p_quantization) {
+	return CLAMP(_get_bits_for(uint64_t(Math::ceil(2.0 * Math_SQRT12 / p_quantization.precision))), 2, 24);
+}
+
+static QuaternionCode _encode_quaternion(const Quaternion &p_value, int p_bits) {
+	Quaternion q = p_value;
+	const real_t length = q.length();
+	q = length > CMP_EPSILON ? q / length : Quaternion();
+
+	QuaternionCode code;
+	for (int i = 0; i < 3; i++) {
+		if (Math::abs(q[i]) > Math::abs(q[code.largest])) {
+			code.largest = i;
+		}
+	}
+	// q and -q are the same rotation, make the dropped component positive.
+	if (q[code.largest] < 0) {
+		q = -q;
+	}
+
+	const uint32_t max_code = (1u << p_bits) - 1;
+	for (int i = 0, j = 0; i < 4; i++) {
+		if (i == code.largest) {
+			continue;
+		}
+		const double c = CLAMP(double(q[i]), -Math_SQRT12, Math_SQRT12);
+		code.components[j++] = MIN(uint32_t(Math::round((c + Math_SQRT12) / (2.0 * Math_SQRT12) * max_code)), max_code);
+	}
+	return code;
+}
+
+static Quaternion _decode_quaternion(const QuaternionCode &p_code, int p_bits) {
+	const uint32_t max_code = (1u << p_bits) - 1;
+	Quaternion q;
+	double sum = 0.0;
+	for (int i = 0, j = 0; i < 4; i++) {
+		if (i == p_code.largest) {
+			continue;
+		}
+		const double c = double(p_code.components[j++]) / max_code * (2.0 * Math_SQRT12) - Math_SQRT12;
+		q[i] = c;
+		sum += c * c;
+	}
+	q[p_code.largest] = Math::sqrt(MAX(1.0 - sum, 0.0));
+	return q;
+}
+
+/* Values */
+
+Variant SceneReplicationCodec::quantize(const Variant &p_value, const Quantization &p_quantization) {
+	if (!p_quantization.is_enabled()) {
+		return p_value;
+	}
+	switch (p_value.get_type()) {
+		case Variant::FLOAT:
+			return _dequantize_scalar(_quantize_scalar(p_value, p_quantization), p_quantization);
+		case Variant::VECTOR2:
+			return _quantize_vector<Vector2, 2>(p_value, p_quantization);
+		case Variant::VECTOR3:
+			return _quantize_vector<Vector3, 3>(p_value, p_quantization);
+		case Variant::VECTOR4:
+			return _quantize_vector<Vector4, 4>(p_value, p_quantization);
+		case Variant::QUATERNION: {
+			const int bits = _get_quaternion_bits(p_quantization);
+			return _decode_quaternion(_encode_quaternion(p_value, bits), bits);
+		}
+		default:
+			return p_value;
+	}
+}
+
+Error SceneReplicationCodec::encode_value(BitWriter &p_writer, const Variant &p_value, const Variant *p_baseline, const Quantization &p_quantization) {
+	const Variant::Type type = p_value.get_type();
+	const bool same_type = p_baseline && p_baseline->get_type() == type;
+	p_writer.put_bool(same_type);
+	if (!same_type) {
+		p_writer.put_bits(type, 6);
+	}
+	const Variant *baseline = same_type ? p_baseline : nullptr;
+
+	switch (type) {
+		case Variant::NIL: {
+		} break;
+		case Variant::BOOL: {
+			p_writer.put_bool(p_value);
+		} break;
+		case Variant::INT: {
+			const uint64_t base = baseline ? uint64_t(int64_t(*baseline)) : 0;
+			p_writer.put_zigzag(int64_t(uint64_t(int64_t(p_value)) - base));
+		} break;
+		case Variant::FLOAT: {
+			if (p_quantization.is_enabled()) {
+				const double base = baseline ? double(*baseline) : 0.0;
+				_put_scalar(p_writer, p_value, baseline ? &base : nullptr, p_quantization);
+				break;
+			}
+			const double d = p_value;
+			MarshallFloat mf;
+			mf.f = d;
+			p_writer.put_bool(double(mf.f) == d);
+			if (double(mf.f) == d) {
+				p_writer.put_bits(mf.i, 32);
+			} else {
+				MarshallDouble md;
+				md.d = d;
+				p_writer.put_bits(md.l, 64);
+			}
+		} break;
+		case Variant::VECTOR2: {
+			_put_vector<Vector2, 2>(p_writer, p_value, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR3: {
+			_put_vector<Vector3, 3>(p_writer, p_value, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR4: {
+			_put_vector<Vector4, 4>(p_writer, p_value, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR2I: {
+			_put_int_vector<Vector2i, 2>(p_writer, p_value, baseline);
+		} break;
+		case Variant::VECTOR3I: {
+			_put_int_vector<Vector3i, 3>(p_writer, p_value, baseline);
+		} break;
+		case Variant::VECTOR4I: {
+			_put_int_vector<Vector4i, 4>(p_writer, p_value, baseline);
+		} break;
+		case Variant::QUATERNION: {
+			const Quaternion q = p_value;
+			if (!p_quantization.is_enabled()) {
+				for (int i = 0; i < 4; i++) {
+					_put_real(p_writer, q[i]);
+				}
+				break;
+			}
+			const int bits = _get_quaternion_bits(p_quantization);
+			const QuaternionCode code = _encode_quaternion(q, bits);
+			p_writer.put_bits(code.largest, 2);
+			for (int i = 0; i < 3; i++) {
+				p_writer.put_bits(code.components[i], bits);
+			}
+		} break;
+		default: {
+			// Everything else uses the regular variant encoding.
+			int len = 0;
+			Error err = MultiplayerAPI::encode_and_compress_variant(p_value, nullptr, len, false);
+			ERR_FAIL_COND_V(err != OK, err);
+			LocalVector<uint8_t> buf;
+			buf.resize(len);
+			MultiplayerAPI::encode_and_compress_variant(p_value, buf.ptr(), len, false);
+			p_writer.put_varint(len);
+			p_writer.put_bytes(buf.ptr(), len);
+		} break;
+	}
+	return OK;
+}
+
+Error SceneReplicationCodec::decode_value(BitReader &p_reader, const Variant *p_baseline, const Quantization &p_quantization, Variant &r_value) {
+	const bool same_type = p_reader.get_bool();
+	ERR_FAIL_COND_V(same_type && !p_baseline, ERR_INVALID_DATA);
+	const Variant::Type type = same_type ? p_baseline->get_type() : Variant::Type(p_reader.get_bits(6));
+	ERR_FAIL_COND_V(type >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+	const Variant *baseline = same_type ? p_baseline : nullptr;
+
+	switch (type) {
+		case Variant::NIL: {
+			r_value = Variant();
+		} break;
+		case Variant::BOOL: {
+			r_value = p_reader.get_bool();
+		} break;
+		case Variant::INT: {
+			const uint64_t base = baseline ? uint64_t(int64_t(*baseline)) : 0;
+			r_value = int64_t(base + uint64_t(p_reader.get_zigzag()));
+		} break;
+		case Variant::FLOAT: {
+			if (p_quantization.is_enabled()) {
+				const double base = baseline ? double(*baseline) : 0.0;
+				r_value = _get_scalar(p_reader, baseline ? &base : nullptr, p_quantization);
+			} else if (p_reader.get_bool()) {
+				MarshallFloat mf;
+				mf.i = p_reader.get_bits(32);
+				r_value = mf.f;
+			} else {
+				MarshallDouble md;
+				md.l = p_reader.get_bits(64);
+				r_value = md.d;
+			}
+		} break;
+		case Variant::VECTOR2: {
+			r_value = _get_vector<Vector2, 2>(p_reader, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR3: {
+			r_value = _get_vector<Vector3, 3>(p_reader, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR4: {
+			r_value = _get_vector<Vector4, 4>(p_reader, baseline, p_quantization);
+		} break;
+		case Variant::VECTOR2I: {
+			r_value = _get_int_vector<Vector2i, 2>(p_reader, baseline);
+		} break;
+		case Variant::VECTOR3I: {
+			r_value = _get_int_vector<Vector3i, 3>(p_reader, baseline);
+		} break;
+		case Variant::VECTOR4I: {
+			r_value = _get_int_vector<Vector4i, 4>(p_reader, baseline);
+		} break;
+		case Variant::QUATERNION: {
+			if (!p_quantization.is_enabled()) {
+				Quaternion q;
+				for (int i = 0; i < 4; i++) {
+					q[i] = _get_real(p_reader);
+				}
+				r_value = q;
+				break;
+			}
+			const int bits = _get_quaternion_bits(p_quantization);
+			QuaternionCode code;
+			code.largest = p_reader.get_bits(2);
+			for (int i = 0; i < 3; i++) {
+				code.components[i] = p_reader.get_bits(bits);
+			}
+			r_value = _decode_quaternion(code, bits);
+		} break;
+		default: {
+			const uint64_t len = p_reader.get_varint();
+			ERR_FAIL_COND_V(len == 0 || len > uint64_t(p_reader.get_remaining_bytes()), ERR_INVALID_DATA);
+			LocalVector<uint8_t> buf;
+			buf.resize(len);
+			ERR_FAIL_COND_V(!p_reader.get_bytes(buf.ptr(), len), ERR_INVALID_DATA);
+			int consumed = 0;
+			Error err = MultiplayerAPI::decode_and_decompress_variant(r_value, buf.ptr(), len, &consumed, false);
+			ERR_FAIL_COND_V(err != OK, err);
+			ERR_FAIL_COND_V(uint64_t(consumed) != len, ERR_INVALID_DATA);
+		} break;
+	}
+	ERR_FAIL_COND_V(p_reader.has_overflowed(), ERR_INVALID_DATA);
+	return OK;
+}
@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  scene_replication_codec.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_REPLICATION_CODEC_H
+#define SCENE_REPLICATION_CODEC_H
+
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Bit-packed encoding of replicated property values, optionally quantized and
+// delta encoded against a baseline state known to the receiver.
+class SceneReplicationCodec {
+public:
+	struct Quantization {
+		real_t precision = 0.0; // Step between two encoded values, 0 keeps full precision.
+		Vector2 range; // When y is greater than x, values are clamped and encoded with a fixed bit width.
+
+		bool is_enabled() const { return precision > 0.0; }
+		int get_range_bits() const;
+	};
+
+	class BitWriter {
+		LocalVector<uint8_t> data;
+		uint32_t bit_pos = 0;
+
+	public:
+		void put_bits(uint64_t p_value, int p_bits);
+		void put_bool(bool p_value) { put_bits(p_value ? 1 : 0, 1); }
+		void put_varint(uint64_t p_value);
+		void put_zigzag(int64_t p_value) { put_varint((uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63)); }
+		void put_bytes(const uint8_t *p_data, int p_size);
+
+		const uint8_t *get_data() const { return data.ptr(); }
+		int get_size() const { return data.size(); }
+		void clear();
+	};
+
+	class BitReader {
+		const uint8_t *data = nullptr;
+		uint32_t size = 0;
+		uint32_t bit_pos = 0;
+		bool overflowed = false;
+
+	public:
+		uint64_t get_bits(int p_bits);
+		bool get_bool() { return get_bits(1) != 0; }
+		uint64_t get_varint();
+		int64_t get_zigzag() {
+			uint64_t v = get_varint();
+			return int64_t(v >> 1) ^ -int64_t(v & 1);
+		}
+		bool get_bytes(uint8_t *r_data, int p_size);
+
+		// True once a read went past the end of the data, reads then return 0.
+		bool has_overflowed() const { return overflowed; }
+		int get_remaining_bytes() const { return overflowed ? 0 : int(size - (bit_pos + 7) / 8); }
+
+		BitReader(const uint8_t *p_data, int p_size) {
+			data = p_data;
+			size = p_size;
+		}
+	};
+
+	// Returns the value as the receiver will decode it. Comparing quantized values
+	// ignores changes smaller than the precision.
+	static Variant quantize(const Variant &p_value, const Quantization &p_quantization);
+
+	// p_value must already be quantized. p_baseline may be null when the receiver has no baseline.
+	static Error encode_value(BitWriter &p_writer, const Variant &p_value, const Variant *p_baseline, const Quantization &p_quantization);
+	static Error decode_value(BitReader &p_reader, const Variant *p_baseline, const Quantization &p_quantization, Variant &r_value);
+};
+
+#endif // SCENE_REPLICATION_CODEC_H
@@ -31,6 +31,8 @@
 #ifndef SCENE_REPLICATION_CONFIG_H
 #define SCENE_REPLICATION_CONFIG_H
 
+#include "scene_replication_codec.h"
+
 #include "core/io/resource.h"
 #include "core/variant/typed_array.h"
 
@@ -51,6 +53,7 @@ private:
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		SceneReplicationCodec::Quantization quantization;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -67,6 +70,7 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	Vector<SceneReplicationCodec::Quantization> sync_quantizations;
 	bool dirty = false;
 
 	void _update();
@@ -100,9 +104,16 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	real_t property_get_precision(const NodePath &p_path);
+	void property_set_precision(const NodePath &p_path, real_t p_precision);
+
+	Vector2 property_get_range(const NodePath &p_path);
+	void property_set_range(const NodePath &p_path, const Vector2 &p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
+	const Vector<SceneReplicationCodec::Quantization> &get_sync_quantizations(); // Matches get_sync_properties().
 
 	SceneReplicationConfig() {}
 };
@@ -34,6 +34,8 @@
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/node.h"
 
 #define MAKE_ROOM(m_amount)             \
@@ -105,6 +107,7 @@ void SceneReplicationInterface::on_peer_change(int p_id, bool p_connected) {
 		ERR_FAIL_COND(!peers_info.has(p_id));
 		_free_remotes(peers_info[p_id]);
 		peers_info.erase(p_id);
+		interest_grid.remove_peer(p_id);
 	}
 }
 
@@ -113,6 +116,7 @@ void SceneReplicationInterface::on_reset() {
 		_free_remotes(E.value);
 	}
 	peers_info.clear();
+	interest_grid.clear();
 	// Tracked nodes are cleared on deletion, here we only reset the ids so they can be later re-assigned.
 	for (KeyValue<ObjectID, TrackedNode> &E : tracked_nodes) {
 		TrackedNode &tobj = E.value;
@@ -141,15 +145,24 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	_update_interest();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		if (E.value.sync_acks.size()) {
+			_send_sync_acks(E.key, E.value);
+		}
 		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
 		}
 		uint16_t sync_net_time = ++E.value.last_sent_sync;
-		_send_sync(E.key, to_sync, sync_net_time, usec);
+		if (compact_sync) {
+			_send_compact_sync(E.key, to_sync, sync_net_time, usec);
+		} else {
+			_send_sync(E.key, to_sync, sync_net_time, usec);
+		}
 		_send_delta(E.key, to_sync, usec, E.value.last_watch_usecs);
 	}
 }
@@ -280,11 +293,14 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	interest_grid.remove_object(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
+			E.value.sync_baselines.erase(sync->get_net_id());
+			E.value.recv_sync_states.erase(sync->get_net_id());
 		}
 	}
 	return OK;
@@ -333,7 +349,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (sync->is_visible_to(p_peer) && _is_in_interest(p_peer, sync)) {
 				return true;
 			}
 		}
@@ -341,6 +357,54 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 	}
 }
 
+bool SceneReplicationInterface::_is_in_interest(int p_peer, MultiplayerSynchronizer *p_sync) const {
+	return !p_sync->is_visibility_spatial() || interest_grid.is_visible(p_peer, p_sync->get_instance_id());
+}
+
+void SceneReplicationInterface::_update_interest() {
+	LocalVector<ObjectID> added;
+	LocalVector<ObjectID> removed;
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		const bool tracked = interest_grid.has_object(sid);
+		Node *node = sync->is_visibility_spatial() && _has_authority(sync) ? sync->get_root_node() : nullptr;
+		Node3D *node_3d = Object::cast_to<Node3D>(node);
+		Node2D *node_2d = node_3d ? nullptr : Object::cast_to<Node2D>(node);
+		if (node_3d && node_3d->is_inside_tree()) {
+			interest_grid.set_object_position(sid, node_3d->get_global_position());
+		} else if (node_2d && node_2d->is_inside_tree()) {
+			const Vector2 position = node_2d->get_global_position();
+			interest_grid.set_object_position(sid, Vector3(position.x, position.y, 0));
+		} else if (tracked) {
+			interest_grid.remove_object(sid);
+			if (sync->get_root_node()) {
+				removed.push_back(sid);
+			}
+			continue;
+		} else {
+			continue;
+		}
+		if (!tracked) {
+			added.push_back(sid);
+		}
+	}
+
+	interest_changes.clear();
+	interest_grid.update(interest_changes);
+	for (const SceneInterestGrid::Change &change : interest_changes) {
+		_visibility_changed(change.peer, change.object);
+	}
+
+	// Peers that could see them regardless of their position need a full update.
+	for (const ObjectID &sid : added) {
+		_visibility_changed(0, sid);
+	}
+	for (const ObjectID &sid : removed) {
+		_visibility_changed(0, sid);
+	}
+}
+
 Error SceneReplicationInterface::_update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync) {
 	ERR_FAIL_NULL_V(p_sync, ERR_BUG);
 	if (!_has_authority(p_sync) || p_peer == multiplayer->get_unique_id()) {
@@ -352,7 +416,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	if (p_peer == 0) {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			bool is_visible_to_peer = (is_visible || p_sync->is_visible_to(E.key)) && _is_in_interest(E.key, p_sync);
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -366,6 +430,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		return OK;
 	} else {
 		ERR_FAIL_COND_V(!peers_info.has(p_peer), ERR_INVALID_PARAMETER);
+		is_visible = is_visible && _is_in_interest(p_peer, p_sync);
 		if (is_visible == peers_info[p_peer].sync_nodes.has(sid)) {
 			return OK;
 		}
@@ -397,7 +462,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (sync->is_visible_to(p_peer) && _is_in_interest(p_peer, sync)) {
 			is_visible = true;
 			break;
 		}
@@ -854,6 +919,11 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 }
 
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	if (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_2_SHIFT)) {
+		return on_sync_ack_receive(p_from, p_buffer, p_buffer_len);
+	} else if (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT)) {
+		return on_compact_sync_receive(p_from, p_buffer, p_buffer_len);
+	}
 	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	bool is_delta = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT)) != 0;
 	if (is_delta) {
@@ -901,6 +971,242 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 	return OK;
 }
 
+void SceneReplicationInterface::_send_compact_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
+	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 2 + sync_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+	int ofs = 1;
+	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
+	PeerInfo &pinfo = peers_info[p_peer];
+	for (const ObjectID &oid : p_synchronizers) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
+		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
+		if (!sync->update_outbound_sync_time(p_usec)) {
+			continue; // nothing to sync.
+		}
+
+		Node *node = sync->get_root_node();
+		ERR_CONTINUE(!node);
+		uint32_t net_id = sync->get_net_id();
+		if (!_verify_synchronizer(p_peer, sync, net_id)) {
+			// The path based sync is not yet confirmed, skipping.
+			continue;
+		}
+		Vector<Variant> vars;
+		Vector<const Variant *> varp;
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		const List<NodePath> props = config->get_sync_properties();
+		const Vector<SceneReplicationCodec::Quantization> &quantizations = config->get_sync_quantizations();
+		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
+		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
+		for (int i = 0; i < vars.size(); i++) {
+			vars.write[i] = SceneReplicationCodec::quantize(vars[i], quantizations[i]);
+		}
+
+		// Only send what changed since the last state the peer acknowledged.
+		SyncBaseline &sb = pinfo.sync_baselines[sync->get_net_id()];
+		const bool use_baseline = sb.acked && sb.baseline.values.size() == vars.size();
+		const Variant *baseline = use_baseline ? sb.baseline.values.ptr() : nullptr;
+		sync_writer.clear();
+		sync_writer.put_bool(use_baseline);
+		if (use_baseline) {
+			sync_writer.put_bits(sb.baseline.time, 16);
+		}
+		bool changed = false;
+		for (int i = 0; i < vars.size(); i++) {
+			const bool dirty = !baseline || vars[i] != baseline[i];
+			sync_writer.put_bool(dirty);
+			changed = changed || dirty;
+		}
+		if (!changed) {
+			continue;
+		}
+		for (int i = 0; i < vars.size() && err == OK; i++) {
+			if (!baseline || vars[i] != baseline[i]) {
+				err = SceneReplicationCodec::encode_value(sync_writer, vars[i], baseline ? &baseline[i] : nullptr, quantizations[i]);
+			}
+		}
+		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+
+		int size = sync_writer.get_size();
+		ERR_CONTINUE_MSG(size > sync_mtu || size > UINT16_MAX, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (ofs + 4 + 2 + size > sync_mtu) {
+			// Send what we got, and reset write.
+			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+			ofs = 3;
+		}
+		ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
+		ofs += encode_uint16(size, &ptr[ofs]);
+		memcpy(&ptr[ofs], sync_writer.get_data(), size);
+		ofs += size;
+
+		SyncState state;
+		state.time = p_sync_net_time;
+		state.values = vars;
+		sb.pending.push_back(state);
+		if (sb.pending.size() > SYNC_MAX_PENDING_STATES) {
+			// The peer stopped acknowledging, send full states until it does again.
+			sb.pending.remove_at(0);
+			sb.acked = false;
+		}
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_out", oid, size);
+#endif
+	}
+	if (ofs > 3) {
+		// Got some left over to send.
+		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+	}
+}
+
+void SceneReplicationInterface::_send_sync_acks(int p_peer, PeerInfo &p_info) {
+	MAKE_ROOM(sync_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_2_SHIFT);
+	int ofs = 1;
+	for (const SyncAck &ack : p_info.sync_acks) {
+		if (ofs + 4 + 2 > sync_mtu) {
+			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+			ofs = 1;
+		}
+		ofs += encode_uint32(ack.net_id, &ptr[ofs]);
+		ofs += encode_uint16(ack.time, &ptr[ofs]);
+	}
+	if (ofs > 1) {
+		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+	}
+	p_info.sync_acks.clear();
+}
+
+Error SceneReplicationInterface::on_compact_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 10, ERR_INVALID_DATA, "Invalid sync packet received");
+	uint16_t time = decode_uint16(&p_buffer[1]);
+	int ofs = 3;
+	while (ofs + 6 < p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		uint32_t size = decode_uint16(&p_buffer[ofs]);
+		ofs += 2;
+		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_INVALID_DATA);
+		const uint8_t *data = &p_buffer[ofs];
+		ofs += size;
+
+		// Signals emitted below may change the peers.
+		PeerInfo *pinfo = peers_info.getptr(p_from);
+		ERR_FAIL_NULL_V(pinfo, ERR_UNAVAILABLE);
+		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
+		if (!sync) {
+			// Not received yet.
+			continue;
+		}
+		Node *node = sync->get_root_node();
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		if (sync->get_multiplayer_authority() != p_from || !node || !config) {
+			// Not valid for me.
+			ERR_CONTINUE_MSG(true, "Ignoring sync data from non-authority or for missing node.");
+		}
+		if (!sync->update_inbound_sync_time(time)) {
+			// State is too old.
+			continue;
+		}
+
+		const List<NodePath> props = config->get_sync_properties();
+		const Vector<SceneReplicationCodec::Quantization> &quantizations = config->get_sync_quantizations();
+		LocalVector<SyncState> &states = pinfo->recv_sync_states[net_id];
+		SceneReplicationCodec::BitReader reader(data, size);
+
+		SyncState state;
+		state.time = time;
+		const Variant *baseline = nullptr;
+		if (reader.get_bool()) {
+			const uint16_t baseline_time = reader.get_bits(16);
+			for (const SyncState &E : states) {
+				if (E.time == baseline_time) {
+					state.values = E.values;
+					baseline = E.values.ptr();
+					break;
+				}
+			}
+			ERR_CONTINUE_MSG(!baseline || state.values.size() != props.size(), "Ignoring sync data relative to an unknown state.");
+		} else {
+			state.values.resize(props.size());
+		}
+
+		LocalVector<bool> dirty;
+		dirty.resize(props.size());
+		bool complete = true;
+		for (int i = 0; i < props.size(); i++) {
+			dirty[i] = reader.get_bool();
+			complete = complete && (dirty[i] || baseline);
+		}
+		ERR_FAIL_COND_V(!complete || reader.has_overflowed(), ERR_INVALID_DATA);
+
+		List<NodePath> changed_props;
+		Vector<Variant> changed_vars;
+		int i = 0;
+		for (const NodePath &prop : props) {
+			if (dirty[i]) {
+				Variant value;
+				Error err = SceneReplicationCodec::decode_value(reader, baseline ? &baseline[i] : nullptr, quantizations[i], value);
+				ERR_FAIL_COND_V(err != OK, err);
+				state.values.write[i] = value;
+				changed_props.push_back(prop);
+				changed_vars.push_back(value);
+			}
+			i++;
+		}
+		Error err = MultiplayerSynchronizer::set_state(changed_props, node, changed_vars);
+		ERR_FAIL_COND_V(err, err);
+
+		// Keep it as a possible baseline, and let the authority know.
+		states.push_back(state);
+		if (states.size() > SYNC_MAX_RECV_STATES) {
+			states.remove_at(0);
+		}
+		SyncAck ack;
+		ack.net_id = net_id;
+		ack.time = time;
+		pinfo->sync_acks.push_back(ack);
+
+		sync->emit_signal(SNAME("synchronized"));
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_in", sync->get_instance_id(), size);
+#endif
+	}
+	return OK;
+}
+
+Error SceneReplicationInterface::on_sync_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	PeerInfo *pinfo = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(pinfo, ERR_UNAVAILABLE);
+	int ofs = 1;
+	while (ofs + 6 <= p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		uint16_t time = decode_uint16(&p_buffer[ofs]);
+		ofs += 2;
+		SyncBaseline *sb = pinfo->sync_baselines.getptr(net_id);
+		if (!sb) {
+			continue;
+		}
+		for (uint32_t i = 0; i < sb->pending.size(); i++) {
+			if (sb->pending[i].time != time) {
+				continue;
+			}
+			sb->baseline = sb->pending[i];
+			sb->acked = true;
+			// Older states will never be used as baselines.
+			const uint32_t remaining = sb->pending.size() - i - 1;
+			for (uint32_t j = 0; j < remaining; j++) {
+				sb->pending[j] = sb->pending[i + 1 + j];
+			}
+			sb->pending.resize(remaining);
+			break;
+		}
+	}
+	return OK;
+}
+
 void SceneReplicationInterface::set_max_sync_packet_size(int p_size) {
 	ERR_FAIL_COND_MSG(p_size < 128, "Sync maximum packet size must be at least 128 bytes.");
 	sync_mtu = p_size;
@@ -918,3 +1224,38 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_compact_sync_enabled(bool p_enabled) {
+	compact_sync = p_enabled;
+}
+
+bool SceneReplicationInterface::is_compact_sync_enabled() const {
+	return compact_sync;
+}
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius) {
+	ERR_FAIL_COND_MSG(!peers_info.has(p_peer), vformat("Unknown peer %d.", p_peer));
+	interest_grid.set_peer_interest(p_peer, p_position, p_radius);
+}
+
+void SceneReplicationInterface::remove_peer_interest(int p_peer) {
+	if (!interest_grid.has_peer(p_peer)) {
+		return;
+	}
+	interest_grid.remove_peer(p_peer);
+	// Synchronizers with spatial visibility are now hidden to that peer.
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		if (sync && sync->is_visibility_spatial()) {
+			_visibility_changed(p_peer, sid);
+		}
+	}
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	interest_grid.set_cell_size(p_size);
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_grid.get_cell_size();
+}
@@ -33,6 +33,8 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_interest_grid.h"
+#include "scene_replication_codec.h"
 
 #include "core/object/ref_counted.h"
 
@@ -60,6 +62,28 @@ private:
 		}
 	};
 
+	// A synchronizer state as the receiver decoded it, used as a baseline for compact syncs.
+	struct SyncState {
+		uint16_t time = 0;
+		Vector<Variant> values;
+	};
+
+	struct SyncBaseline {
+		bool acked = false;
+		SyncState baseline;
+		LocalVector<SyncState> pending; // Sent after the baseline, not acknowledged yet.
+	};
+
+	struct SyncAck {
+		uint32_t net_id = 0;
+		uint16_t time = 0;
+	};
+
+	enum {
+		SYNC_MAX_PENDING_STATES = 16,
+		SYNC_MAX_RECV_STATES = 32, // Must stay above SYNC_MAX_PENDING_STATES.
+	};
+
 	struct PeerInfo {
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
@@ -67,6 +91,11 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Compact sync, by synchronizer net ID.
+		HashMap<uint32_t, SyncBaseline> sync_baselines;
+		HashMap<uint32_t, LocalVector<SyncState>> recv_sync_states;
+		LocalVector<SyncAck> sync_acks;
 	};
 
 	// Replication state.
@@ -76,6 +105,10 @@ private:
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Areas of interest, for synchronizers with spatial visibility.
+	SceneInterestGrid interest_grid;
+	LocalVector<SceneInterestGrid::Change> interest_changes;
+
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
 
@@ -92,6 +125,8 @@ private:
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	bool compact_sync = false;
+	SceneReplicationCodec::BitWriter sync_writer;
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
@@ -102,12 +137,16 @@ private:
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
+	void _send_compact_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
+	void _send_sync_acks(int p_peer, PeerInfo &p_info);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
 
 	void _visibility_changed(int p_peer, ObjectID p_oid);
+	bool _is_in_interest(int p_peer, MultiplayerSynchronizer *p_sync) const;
+	void _update_interest();
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
@@ -137,6 +176,8 @@ public:
 	Error on_despawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_delta_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	Error on_compact_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	Error on_sync_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 
 	bool is_rpc_visible(const ObjectID &p_oid, int p_peer) const;
 
@@ -146,6 +187,15 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_compact_sync_enabled(bool p_enabled);
+	bool is_compact_sync_enabled() const;
+
+	void set_peer_interest(int p_peer, const Vector3 &p_position, real_t p_radius);
+	void remove_peer_interest(int p_peer);
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
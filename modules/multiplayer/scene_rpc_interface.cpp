@@ -164,6 +164,11 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 	int node_id_compression = (p_packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT;
 	int name_id_compression = (p_packet[0] & NAME_ID_COMPRESSION_FLAG) >> NAME_ID_COMPRESSION_SHIFT;
 
+	if (node_id_compression == NETWORK_NODE_ID_COMPRESSION_BATCH) {
+		_process_batch(p_from, p_packet, p_packet_len);
+		return;
+	}
+
 	switch (node_id_compression) {
 		case NETWORK_NODE_ID_COMPRESSION_8:
 			packet_min_size += 1;
@@ -228,6 +233,29 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 	_process_rpc(node, name_id, p_from, p_packet, packet_len, packet_min_size);
 }
 
+void SceneRPCInterface::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	// Each entry is a regular RPC packet prefixed by its size (LEB128).
+	int ofs = 1;
+	while (ofs < p_packet_len) {
+		uint32_t size = 0;
+		int shift = 0;
+		uint8_t byte;
+		do {
+			ERR_FAIL_COND_MSG(ofs >= p_packet_len || shift > 28, "Invalid packet received. Malformed RPC batch.");
+			byte = p_packet[ofs++];
+			size |= uint32_t(byte & 0x7F) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+		ERR_FAIL_COND_MSG(size == 0 || size > uint32_t(p_packet_len - ofs), "Invalid packet received. Size smaller than declared.");
+
+		const uint8_t *entry = &p_packet[ofs];
+		ERR_FAIL_COND_MSG((entry[0] & SceneMultiplayer::CMD_MASK) != SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL, "Invalid packet received. RPC batches can only contain RPCs.");
+		ERR_FAIL_COND_MSG(((entry[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT) == NETWORK_NODE_ID_COMPRESSION_BATCH, "Invalid packet received. Nested RPC batch.");
+		process_rpc(p_from, entry, size);
+		ofs += size;
+	}
+}
+
 void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset) {
 	ERR_FAIL_COND_MSG(p_offset > p_packet_len, "Invalid packet received. Size too small.");
 
@@ -429,7 +457,7 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 
 	if (has_all_peers) {
 		for (const int P : targets) {
-			multiplayer->send_command(P, packet_cache.ptr(), ofs);
+			_send_command(P, p_config, p_node, p_rpc_id, packet_cache.ptr(), ofs);
 		}
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
@@ -449,16 +477,144 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				multiplayer->send_command(P, packet_cache.ptr(), ofs);
+				_send_command(P, p_config, p_node, p_rpc_id, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len);
+				_send_command(P, p_config, p_node, p_rpc_id, packet_cache.ptr(), ofs + path_len);
+			}
+		}
+	}
+}
+
+void SceneRPCInterface::_send_command(int p_to, const RPCConfig &p_config, const Node *p_node, uint16_t p_rpc_id, const uint8_t *p_packet, int p_packet_len) {
+	if (!batching) {
+		multiplayer->send_command(p_to, p_packet, p_packet_len);
+		return;
+	}
+
+	const uint64_t key = (uint64_t(uint32_t(p_to)) << 32) | (uint64_t(uint32_t(p_config.channel)) << 2) | uint64_t(p_config.transfer_mode);
+	uint32_t *idx = batch_ids.getptr(key);
+	if (!idx) {
+		RPCBatch batch;
+		batch.peer = p_to;
+		batch.channel = p_config.channel;
+		batch.transfer_mode = p_config.transfer_mode;
+		batches.push_back(batch);
+		idx = &batch_ids.insert(key, batches.size() - 1)->value;
+	}
+	RPCBatch &batch = batches[*idx];
+
+	// Header, plus at most 2 bytes for the entry size.
+	const int entry_size = p_packet_len + 2;
+	if (1 + (int)batch.data.size() + (int)batch.entries.size() * 2 + entry_size > BATCH_MAX_SIZE) {
+		// Send what is queued first, so ordering is kept on this channel.
+		_send_batch(batch);
+		if (1 + entry_size > BATCH_MAX_SIZE) {
+			multiplayer->get_multiplayer_peer()->set_transfer_channel(p_config.channel);
+			multiplayer->get_multiplayer_peer()->set_transfer_mode(p_config.transfer_mode);
+			multiplayer->send_command(p_to, p_packet, p_packet_len);
+			return;
+		}
+	}
+
+	if (coalescing && p_config.transfer_mode != MultiplayerPeer::TRANSFER_MODE_RELIABLE) {
+		// Only the last unreliable call to a method in each flush is worth sending.
+		CoalesceKey ck;
+		ck.object = p_node->get_instance_id();
+		ck.rpc_id = p_rpc_id;
+		uint32_t *prev = batch.coalesced.getptr(ck);
+		if (prev) {
+			batch.entries[*prev].size = 0;
+			*prev = batch.entries.size();
+		} else {
+			batch.coalesced.insert(ck, batch.entries.size());
+		}
+	}
+
+	BatchEntry entry;
+	entry.offset = batch.data.size();
+	entry.size = p_packet_len;
+	batch.entries.push_back(entry);
+	batch.data.resize(entry.offset + p_packet_len);
+	memcpy(batch.data.ptr() + entry.offset, p_packet, p_packet_len);
+}
+
+void SceneRPCInterface::_send_batch(RPCBatch &p_batch) {
+	uint32_t live = 0;
+	const BatchEntry *last = nullptr;
+	for (const BatchEntry &E : p_batch.entries) {
+		if (E.size) {
+			live++;
+			last = &E;
+		}
+	}
+	if (live && multiplayer->get_connected_peers().has(p_batch.peer)) {
+		Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+		peer->set_transfer_channel(p_batch.channel);
+		peer->set_transfer_mode(p_batch.transfer_mode);
+		if (live == 1) {
+			// Not worth the batch header.
+			multiplayer->send_command(p_batch.peer, p_batch.data.ptr() + last->offset, last->size);
+		} else {
+			batch_packet.clear();
+			batch_packet.push_back(SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL | (NETWORK_NODE_ID_COMPRESSION_BATCH << NODE_ID_COMPRESSION_SHIFT));
+			for (const BatchEntry &E : p_batch.entries) {
+				if (!E.size) {
+					continue;
+				}
+				uint32_t size = E.size;
+				while (size >= 0x80) {
+					batch_packet.push_back(uint8_t(size & 0x7F) | 0x80);
+					size >>= 7;
+				}
+				batch_packet.push_back(uint8_t(size));
+				const uint32_t ofs = batch_packet.size();
+				batch_packet.resize(ofs + E.size);
+				memcpy(batch_packet.ptr() + ofs, p_batch.data.ptr() + E.offset, E.size);
 			}
+			multiplayer->send_command(p_batch.peer, batch_packet.ptr(), batch_packet.size());
+		}
+	}
+	p_batch.data.clear();
+	p_batch.entries.clear();
+	p_batch.coalesced.clear();
+}
+
+void SceneRPCInterface::flush_batches() {
+	if (batches.is_empty()) {
+		return;
+	}
+	bool removed = false;
+	for (uint32_t i = 0; i < batches.size(); i++) {
+		_send_batch(batches[i]);
+		if (!multiplayer->get_connected_peers().has(batches[i].peer)) {
+			batches.remove_at_unordered(i);
+			removed = true;
+			i--;
+		}
+	}
+	if (removed) {
+		batch_ids.clear();
+		for (uint32_t i = 0; i < batches.size(); i++) {
+			const RPCBatch &B = batches[i];
+			batch_ids.insert((uint64_t(uint32_t(B.peer)) << 32) | (uint64_t(uint32_t(B.channel)) << 2) | uint64_t(B.transfer_mode), i);
 		}
 	}
 }
 
+void SceneRPCInterface::clear_batches() {
+	batches.clear();
+	batch_ids.clear();
+}
+
+void SceneRPCInterface::set_batching_enabled(bool p_enabled) {
+	if (batching && !p_enabled && multiplayer->get_multiplayer_peer().is_valid()) {
+		flush_batches();
+	}
+	batching = p_enabled;
+}
+
 Error SceneRPCInterface::rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	ERR_FAIL_COND_V_MSG(!peer.is_valid(), ERR_UNCONFIGURED, "Trying to call an RPC while no multiplayer peer is active.");
@@ -32,6 +32,7 @@
 #define SCENE_RPC_INTERFACE_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_api.h"
 
 class SceneMultiplayer;
@@ -71,6 +72,7 @@ private:
 		NETWORK_NODE_ID_COMPRESSION_8 = 0,
 		NETWORK_NODE_ID_COMPRESSION_16,
 		NETWORK_NODE_ID_COMPRESSION_32,
+		NETWORK_NODE_ID_COMPRESSION_BATCH, // Not a node ID, the packet is a batch of RPCs.
 	};
 
 	enum NetworkNameIdCompression {
@@ -86,6 +88,45 @@ private:
 
 	HashMap<ObjectID, RPCConfigCache> rpc_cache;
 
+	// RPCs queued for a peer on a given channel and transfer mode, sent together on flush.
+	static constexpr int BATCH_MAX_SIZE = 1200; // Keep unreliable batches below the usual MTU.
+
+	struct CoalesceKey {
+		ObjectID object;
+		uint16_t rpc_id = 0;
+
+		static uint32_t hash(const CoalesceKey &p_key) {
+			return hash_murmur3_one_32(p_key.rpc_id, hash_murmur3_one_64((uint64_t)p_key.object));
+		}
+		bool operator==(const CoalesceKey &p_other) const {
+			return object == p_other.object && rpc_id == p_other.rpc_id;
+		}
+	};
+
+	struct BatchEntry {
+		uint32_t offset = 0;
+		uint32_t size = 0; // Zero when replaced by a newer call.
+	};
+
+	struct RPCBatch {
+		int peer = 0;
+		int channel = 0;
+		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		LocalVector<uint8_t> data;
+		LocalVector<BatchEntry> entries;
+		HashMap<CoalesceKey, uint32_t, CoalesceKey> coalesced;
+	};
+
+	bool batching = false;
+	bool coalescing = false;
+	LocalVector<RPCBatch> batches;
+	HashMap<uint64_t, uint32_t> batch_ids;
+	LocalVector<uint8_t> batch_packet;
+
+	void _send_command(int p_to, const RPCConfig &p_config, const Node *p_node, uint16_t p_rpc_id, const uint8_t *p_packet, int p_packet_len);
+	void _send_batch(RPCBatch &p_batch);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len);
+
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_node_data(const String &p_what, ObjectID p_id, int p_size);
 #endif
@@ -104,6 +145,14 @@ public:
 	void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len);
 	String get_rpc_md5(const Object *p_obj);
 
+	void flush_batches();
+	void clear_batches();
+
+	void set_batching_enabled(bool p_enabled);
+	bool is_batching_enabled() const { return batching; }
+	void set_coalescing_enabled(bool p_enabled) { coalescing = p_enabled; }
+	bool is_coalescing_enabled() const { return coalescing; }
+
 	SceneRPCInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache, SceneReplicationInterface *p_replicator) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
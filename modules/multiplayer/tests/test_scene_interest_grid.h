@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  test_scene_interest_grid.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_INTEREST_GRID_H
+#define TEST_SCENE_INTEREST_GRID_H
+
+#include "../scene_interest_grid.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneInterestGrid {
+
+TEST_CASE("[SceneInterestGrid] Incremental visibility") {
+	SceneInterestGrid grid;
+	grid.set_cell_size(10);
+	LocalVector<SceneInterestGrid::Change> changes;
+
+	const ObjectID near = ObjectID(uint64_t(1));
+	const ObjectID far = ObjectID(uint64_t(2));
+	grid.set_object_position(near, Vector3(5, 0, 0));
+	grid.set_object_position(far, Vector3(100, 0, 0));
+	grid.set_peer_interest(2, Vector3(), 20);
+	grid.update(changes);
+
+	REQUIRE(changes.size() == 1);
+	CHECK(changes[0].peer == 2);
+	CHECK(changes[0].object == near);
+	CHECK(changes[0].visible);
+	CHECK(grid.is_visible(2, near));
+	CHECK_FALSE(grid.is_visible(2, far));
+
+	// Nothing moved.
+	changes.clear();
+	grid.update(changes);
+	CHECK(changes.is_empty());
+
+	SUBCASE("Objects moving") {
+		grid.set_object_position(far, Vector3(15, 0, 0));
+		grid.set_object_position(near, Vector3(0, 50, 0));
+		grid.update(changes);
+		CHECK(changes.size() == 2);
+		CHECK(grid.is_visible(2, far));
+		CHECK_FALSE(grid.is_visible(2, near));
+	}
+
+	SUBCASE("Peers moving") {
+		grid.set_peer_interest(2, Vector3(90, 0, 0), 20);
+		grid.update(changes);
+		CHECK(changes.size() == 2);
+		CHECK(grid.is_visible(2, far));
+		CHECK_FALSE(grid.is_visible(2, near));
+	}
+
+	SUBCASE("Cell size change") {
+		grid.set_cell_size(3);
+		grid.set_object_position(far, Vector3(-19, 0, 0));
+		grid.update(changes);
+		CHECK(changes.size() == 1);
+		CHECK(grid.is_visible(2, far));
+		CHECK(grid.is_visible(2, near));
+	}
+
+	SUBCASE("Removal") {
+		grid.remove_object(near);
+		CHECK_FALSE(grid.is_visible(2, near));
+		grid.remove_peer(2);
+		grid.set_object_position(far, Vector3(1, 0, 0));
+		grid.update(changes);
+		CHECK(changes.is_empty());
+	}
+}
+
+} // namespace TestSceneInterestGrid
+
+#endif // TEST_SCENE_INTEREST_GRID_H
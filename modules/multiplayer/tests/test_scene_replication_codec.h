@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_scene_replication_codec.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_REPLICATION_CODEC_H
+#define TEST_SCENE_REPLICATION_CODEC_H
+
+#include "../scene_replication_codec.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneReplicationCodec {
+
+static Variant round_trip(const Variant &p_value, const Variant *p_baseline, const SceneReplicationCodec::Quantization &p_quantization, int *r_size = nullptr) {
+	SceneReplicationCodec::BitWriter writer;
+	CHECK(SceneReplicationCodec::encode_value(writer, SceneReplicationCodec::quantize(p_value, p_quantization), p_baseline, p_quantization) == OK);
+	if (r_size) {
+		*r_size = writer.get_size();
+	}
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size());
+	Variant ret;
+	CHECK(SceneReplicationCodec::decode_value(reader, p_baseline, p_quantization, ret) == OK);
+	return ret;
+}
+
+TEST_CASE("[SceneReplicationCodec] Bit packing") {
+	SceneReplicationCodec::BitWriter writer;
+	writer.put_bool(true);
+	writer.put_bits(5, 3);
+	writer.put_varint(300);
+	writer.put_zigzag(-70000);
+	writer.put_bits(0xDEADBEEFCAFEull, 48);
+	CHECK(writer.get_size() == 12);
+
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size());
+	CHECK(reader.get_bool());
+	CHECK(reader.get_bits(3) == 5);
+	CHECK(reader.get_varint() == 300);
+	CHECK(reader.get_zigzag() == -70000);
+	CHECK(reader.get_bits(48) == 0xDEADBEEFCAFEull);
+	CHECK_FALSE(reader.has_overflowed());
+
+	reader.get_bits(8);
+	CHECK(reader.has_overflowed());
+}
+
+TEST_CASE("[SceneReplicationCodec] Full precision values") {
+	SceneReplicationCodec::Quantization none;
+	const Variant values[] = { Variant(), true, int64_t(-123456789012), 0.5, 0.1, Vector3(1.5, -2.25, 1e6), Vector2i(-7, 9), Quaternion(Vector3(0, 1, 0), 0.3), String("hello"), PackedInt32Array({ 1, 2, 3 }) };
+	for (const Variant &value : values) {
+		CHECK(round_trip(value, nullptr, none) == value);
+	}
+
+	const Variant baseline = int64_t(1000);
+	int size = 0;
+	CHECK(round_trip(int64_t(1001), &baseline, none, &size) == Variant(int64_t(1001)));
+	CHECK(size == 2);
+}
+
+TEST_CASE("[SceneReplicationCodec] Quantization") {
+	SceneReplicationCodec::Quantization quantization;
+	quantization.precision = 0.01;
+
+	CHECK(SceneReplicationCodec::quantize(Vector3(1.004, 2.006, -3.0), quantization) == SceneReplicationCodec::quantize(Vector3(1.001, 2.009, -3.003), quantization));
+
+	const Vector3 position(10.123, -4.567, 250.0);
+	const Vector3 decoded = round_trip(position, nullptr, quantization);
+	CHECK(decoded.is_equal_approx(SceneReplicationCodec::quantize(position, quantization)));
+	CHECK((decoded - position).length() < 0.01);
+
+	// Small changes against a baseline take a few bits per component.
+	const Variant baseline = SceneReplicationCodec::quantize(position, quantization);
+	int size = 0;
+	const Vector3 moved = round_trip(position + Vector3(0.05, 0, -0.02), &baseline, quantization, &size);
+	CHECK((moved - (position + Vector3(0.05, 0, -0.02))).length() < 0.01);
+	CHECK(size <= 4);
+
+	SUBCASE("Range") {
+		quantization.range = Vector2(-1, 1);
+		CHECK(quantization.get_range_bits() == 8);
+		CHECK(double(round_trip(0.5, nullptr, quantization)) == doctest::Approx(0.5).epsilon(0.01));
+		CHECK(double(round_trip(3.0, nullptr, quantization)) == doctest::Approx(1.0));
+	}
+}
+
+TEST_CASE("[SceneReplicationCodec] Quaternion smallest three") {
+	SceneReplicationCodec::Quantization quantization;
+	quantization.precision = 0.001;
+
+	const Quaternion rotations[] = { Quaternion(), Quaternion(Vector3(1, 2, 3).normalized(), 2.5), Quaternion(Vector3(0, 0, 1), Math_PI), -Quaternion(Vector3(0, 1, 0), 0.7) };
+	for (const Quaternion &rotation : rotations) {
+		int size = 0;
+		const Quaternion decoded = round_trip(rotation, nullptr, quantization, &size);
+		CHECK(decoded.is_normalized());
+		// Either sign is the same rotation.
+		CHECK(Math::abs(decoded.dot(rotation)) > 0.9999);
+		CHECK(size <= 6);
+	}
+}
+
+} // namespace TestSceneReplicationCodec
+
+#endif // TEST_SCENE_REPLICATION_CODEC_H
@@ -1263,6 +1263,7 @@ void GodotNavigationServer3D::map_force_update(RID p_map) {
 	NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
 
+	_finish_path_query_batches(true);
 	flush_queries();
 
 	map->sync();
@@ -1276,6 +1277,8 @@ uint32_t GodotNavigationServer3D::map_get_iteration_id(RID p_map) const {
 }
 
 void GodotNavigationServer3D::sync() {
+	_finish_path_query_batches(false);
+
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->sync();
@@ -1284,6 +1287,9 @@ void GodotNavigationServer3D::sync() {
 }
 
 void GodotNavigationServer3D::process(real_t p_delta_time) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_NAVIGATION);
+	// The batches query the maps as they were when submitted, finish them before anything changes.
+	_finish_path_query_batches(true);
 	flush_queries();
 
 	if (!active) {
@@ -1341,6 +1347,12 @@ void GodotNavigationServer3D::init() {
 }
 
 void GodotNavigationServer3D::finish() {
+	for (PathQueryBatch *batch : path_query_batches) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+		memdelete(batch);
+	}
+	path_query_batches.clear();
+
 	flush_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
@@ -1352,17 +1364,86 @@ void GodotNavigationServer3D::finish() {
 }
 
 PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &p_parameters) const {
-	PathQueryResult r_query_result;
-
 	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_NULL_V(map, r_query_result);
+	ERR_FAIL_NULL_V(map, PathQueryResult());
+
+	return _query_path_on_map(map, p_parameters);
+}
+
+void GodotNavigationServer3D::query_paths_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_callback.is_valid());
+
+	PathQueryBatch *batch = memnew(PathQueryBatch);
+	batch->callback = p_callback;
+	batch->maps.resize(p_query_parameters.size());
+	batch->parameters.resize(p_query_parameters.size());
+	batch->results.resize(p_query_parameters.size());
+
+	for (int i = 0; i < p_query_parameters.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		// Invalid queries are kept with a null map so the results still match the submitted order.
+		batch->maps[i] = nullptr;
+		ERR_CONTINUE(!query_parameters.is_valid());
+
+		batch->parameters[i] = query_parameters->get_parameters();
+		// Maps are resolved here as the RID owner can't be read on the worker threads.
+		batch->maps[i] = map_owner.get_or_null(batch->parameters[i].map);
+		ERR_CONTINUE_MSG(batch->maps[i] == nullptr, "Path query parameters have an invalid map.");
+	}
+
+	if (batch->parameters.size() > 0) {
+		batch->group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_process_path_query, batch, batch->parameters.size(), -1, false, SNAME("NavigationPathQueries3D"));
+	}
+	path_query_batches.push_back(batch);
+}
+
+void GodotNavigationServer3D::_process_path_query(uint32_t p_index, PathQueryBatch *p_batch) {
+	if (p_batch->maps[p_index]) {
+		p_batch->results[p_index] = _query_path_on_map(p_batch->maps[p_index], p_batch->parameters[p_index]);
+	}
+}
+
+void GodotNavigationServer3D::_finish_path_query_batches(bool p_wait) {
+	for (uint32_t i = 0; i < path_query_batches.size();) {
+		PathQueryBatch *batch = path_query_batches[i];
+		if (batch->group_id != -1) {
+			if (!p_wait && !WorkerThreadPool::get_singleton()->is_group_task_completed(batch->group_id)) {
+				i++;
+				continue;
+			}
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+		}
+		// Keep the order of the remaining batches, callbacks are called in the order of submission.
+		path_query_batches.remove_at(i);
+
+		TypedArray<NavigationPathQueryResult3D> query_results;
+		query_results.resize(batch->results.size());
+		for (uint32_t j = 0; j < batch->results.size(); j++) {
+			const PathQueryResult &result = batch->results[j];
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			query_result->set_path(result.path);
+			query_result->set_path_types(result.path_types);
+			query_result->set_path_rids(result.path_rids);
+			query_result->set_path_owner_ids(result.path_owner_ids);
+			query_results[j] = query_result;
+		}
+		Callable callback = batch->callback;
+		memdelete(batch);
+
+		callback.call(query_results);
+	}
+}
+
+PathQueryResult GodotNavigationServer3D::_query_path_on_map(const NavMap *p_map, const PathQueryParameters &p_parameters) const {
+	PathQueryResult r_query_result;
 
 	// run the pathfinding
 
 	if (p_parameters.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR) {
 		// while postprocessing is still part of map.get_path() need to check and route it here for the correct "optimize" post-processing
 		if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					true,
@@ -1371,7 +1452,7 @@ PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
 		} else if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					false,
@@ -37,6 +37,7 @@
 #include "../nav_obstacle.h"
 #include "../nav_region.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "core/templates/rid_owner.h"
@@ -86,6 +87,17 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 #endif // _3D_DISABLED
 
+	struct PathQueryBatch {
+		LocalVector<const NavMap *> maps;
+		LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+		LocalVector<NavigationUtilities::PathQueryResult> results;
+		Callable callback;
+		WorkerThreadPool::GroupID group_id = -1;
+	};
+
+	/// Batches still running or waiting for their callback, only accessed on the main thread.
+	LocalVector<PathQueryBatch *> path_query_batches;
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -285,10 +297,15 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_paths_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
+	NavigationUtilities::PathQueryResult _query_path_on_map(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) const;
+	void _process_path_query(uint32_t p_index, PathQueryBatch *p_batch);
+	void _finish_path_query_batches(bool p_wait);
+
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
 };
@@ -35,6 +35,7 @@
 #include "core/config/project_settings.h"
 #include "core/math/convex_hull.h"
 #include "core/os/thread.h"
+#include "core/templates/pair.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/multimesh_instance_3d.h"
 #include "scene/3d/navigation_obstacle_3d.h"
@@ -75,6 +76,31 @@ HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *>
 RID_Owner<NavMeshGenerator3D::NavMeshGeometryParser3D> NavMeshGenerator3D::generator_parser_owner;
 LocalVector<NavMeshGenerator3D::NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
 
+struct NavMeshGenerator3D::NavMeshTiledBake3D {
+	struct DirtyTile {
+		Vector2i coords;
+		// Bounds of the tile without its border, in cells.
+		Vector2i cells_min;
+		Vector2i cells_max;
+		LocalVector<int> indices;
+		NavigationMesh::BakedTile result;
+	};
+
+	Ref<NavigationMesh> navigation_mesh;
+	Vector<float> vertices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	// Tile settings, only the bounds and the grid size change per tile.
+	rcConfig cfg;
+	int tile_cells = 0;
+	Vector2i first_tile;
+	Vector2i last_tile;
+	uint64_t settings_hash = 0;
+
+	HashMap<Vector2i, NavigationMesh::BakedTile> tiles;
+	LocalVector<DirtyTile> dirty_tiles;
+};
+
 NavMeshGenerator3D *NavMeshGenerator3D::get_singleton() {
 	return singleton;
 }
@@ -106,19 +132,33 @@ void NavMeshGenerator3D::sync() {
 	LocalVector<WorkerThreadPool::TaskID> finished_task_ids;
 
 	for (KeyValue<WorkerThreadPool::TaskID, NavMeshGeneratorTask3D *> &E : generator_tasks) {
-		if (WorkerThreadPool::get_singleton()->is_task_completed(E.key)) {
+		NavMeshGeneratorTask3D *generator_task = E.value;
+		if (generator_task->tiled_bake) {
+			if (!WorkerThreadPool::get_singleton()->is_group_task_completed(E.key)) {
+				continue;
+			}
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(E.key);
+
+			// The tiles are merged here, on the main thread.
+			generator_finish_tiled_bake(generator_task->tiled_bake);
+			memdelete(generator_task->tiled_bake);
+			generator_task->tiled_bake = nullptr;
+			generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED;
+			finished_task_ids.push_back(E.key);
+		} else if (WorkerThreadPool::get_singleton()->is_task_completed(E.key)) {
 			WorkerThreadPool::get_singleton()->wait_for_task_completion(E.key);
 			finished_task_ids.push_back(E.key);
+		} else {
+			continue;
+		}
 
-			NavMeshGeneratorTask3D *generator_task = E.value;
-			DEV_ASSERT(generator_task->status == NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED);
+		DEV_ASSERT(generator_task->status == NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED);
 
-			baking_navmeshes.erase(generator_task->navigation_mesh);
-			if (generator_task->callback.is_valid()) {
-				generator_emit_callback(generator_task->callback);
-			}
-			memdelete(generator_task);
+		baking_navmeshes.erase(generator_task->navigation_mesh);
+		if (generator_task->callback.is_valid()) {
+			generator_emit_callback(generator_task->callback);
 		}
+		memdelete(generator_task);
 	}
 
 	for (WorkerThreadPool::TaskID finished_task_id : finished_task_ids) {
@@ -136,8 +176,13 @@ void NavMeshGenerator3D::cleanup() {
 	baking_navmeshes.clear();
 
 	for (KeyValue<WorkerThreadPool::TaskID, NavMeshGeneratorTask3D *> &E : generator_tasks) {
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(E.key);
 		NavMeshGeneratorTask3D *generator_task = E.value;
+		if (generator_task->tiled_bake) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(E.key);
+			memdelete(generator_task->tiled_bake);
+		} else {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(E.key);
+		}
 		memdelete(generator_task);
 	}
 	generator_tasks.clear();
@@ -226,6 +271,38 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	baking_navmeshes.insert(p_navigation_mesh);
 	baking_navmesh_mutex.unlock();
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		// Tiled bakes are prepared here, only the dirty tiles are baked on the worker threads.
+		NavMeshTiledBake3D *tiled_bake = generator_prepare_tiled_bake(p_navigation_mesh, p_source_geometry_data);
+		if (!tiled_bake || tiled_bake->dirty_tiles.is_empty()) {
+			if (tiled_bake) {
+				generator_finish_tiled_bake(tiled_bake);
+				memdelete(tiled_bake);
+			}
+
+			baking_navmesh_mutex.lock();
+			baking_navmeshes.erase(p_navigation_mesh);
+			baking_navmesh_mutex.unlock();
+
+			if (p_callback.is_valid()) {
+				generator_emit_callback(p_callback);
+			}
+			return;
+		}
+
+		generator_task_mutex.lock();
+		NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
+		generator_task->navigation_mesh = p_navigation_mesh;
+		generator_task->source_geometry_data = p_source_geometry_data;
+		generator_task->callback = p_callback;
+		generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+		generator_task->tiled_bake = tiled_bake;
+		generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_bake_tile, tiled_bake, tiled_bake->dirty_tiles.size(), -1, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		generator_tasks.insert(generator_task->thread_task_id, generator_task);
+		generator_task_mutex.unlock();
+		return;
+	}
+
 	generator_task_mutex.lock();
 	NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
 	generator_task->navigation_mesh = p_navigation_mesh;
@@ -672,6 +749,16 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		NavMeshTiledBake3D *tiled_bake = generator_prepare_tiled_bake(p_navigation_mesh, p_source_geometry_data);
+		if (tiled_bake) {
+			generator_bake_dirty_tiles(tiled_bake);
+			generator_finish_tiled_bake(tiled_bake);
+			memdelete(tiled_bake);
+		}
+		return;
+	}
+
 	Vector<float> source_geometry_vertices;
 	Vector<int> source_geometry_indices;
 	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
@@ -685,13 +772,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
 	// added to keep track of steps, no functionality right now
 	String bake_state = "";
 
@@ -706,52 +786,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	rcCalcBounds(verts, nverts, bmin, bmax);
 
 	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
-	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
-
-	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
-		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
-		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
-		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
-		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
-		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
-		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
-		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
-		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
-	}
-	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
-		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
-	}
+	generator_create_config(p_navigation_mesh, cfg);
 
 	cfg.bmin[0] = bmin[0];
 	cfg.bmin[1] = bmin[1];
@@ -785,48 +820,117 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (!generator_bake_heightfield(cfg, p_navigation_mesh, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+}
+
+void NavMeshGenerator3D::generator_create_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
+
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
+	if (p_navigation_mesh->get_border_size() > 0.0) {
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+
+	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
+		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
+		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
+		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
+	}
+	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
+		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+	}
+}
+
+bool NavMeshGenerator3D::generator_bake_heightfield(const rcConfig &p_cfg, const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
+
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -843,11 +947,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -865,30 +969,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -897,9 +1001,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
-
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
 	recast_index_to_native_index.resize(detail_mesh->nverts);
@@ -912,7 +1013,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -936,12 +1037,10 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
 	bake_state = "Cleanup..."; // step #11
 
 	rcFreePolyMesh(poly_mesh);
@@ -950,6 +1049,350 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	detail_mesh = nullptr;
 
 	bake_state = "Baking finished."; // step #12
+
+	return true;
+}
+
+NavMeshGenerator3D::NavMeshTiledBake3D *NavMeshGenerator3D::generator_prepare_tiled_bake(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
+	Vector<int> source_geometry_indices;
+	NavMeshTiledBake3D *tiled_bake = memnew(NavMeshTiledBake3D);
+	tiled_bake->navigation_mesh = p_navigation_mesh;
+	p_source_geometry_data->get_data(tiled_bake->vertices, source_geometry_indices, tiled_bake->projected_obstructions);
+
+	if (tiled_bake->vertices.size() < 3 || source_geometry_indices.size() < 3) {
+		memdelete(tiled_bake);
+		return nullptr;
+	}
+
+	const float *verts = tiled_bake->vertices.ptr();
+	const int nverts = tiled_bake->vertices.size() / 3;
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = source_geometry_indices.size() / 3;
+
+	rcConfig &cfg = tiled_bake->cfg;
+	generator_create_config(p_navigation_mesh, cfg);
+
+	tiled_bake->tile_cells = MAX((int)Math::ceil(p_navigation_mesh->get_tile_size() / cfg.cs), 1);
+	if (!Math::is_equal_approx((float)tiled_bake->tile_cells * cfg.cs, p_navigation_mesh->get_tile_size())) {
+		WARN_PRINT("Property tile_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	// Tiles need a border wide enough for the erosion and the region building to match across tiles.
+	cfg.borderSize = MAX(cfg.borderSize, cfg.walkableRadius + 3);
+	cfg.tileSize = tiled_bake->tile_cells;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		bmax[0] = bmin[0] + baking_aabb.size[0];
+		bmax[1] = bmin[1] + baking_aabb.size[1];
+		bmax[2] = bmin[2] + baking_aabb.size[2];
+	}
+
+	// The tile grid is anchored at the world origin so tiles stay in place when the geometry bounds change.
+	// The height is snapped to cell_height for all tiles to quantize the spans the same way.
+	cfg.bmin[1] = Math::floor(bmin[1] / cfg.ch) * cfg.ch;
+	cfg.bmax[1] = bmax[1];
+
+	const float tile_world_size = tiled_bake->tile_cells * cfg.cs;
+	tiled_bake->first_tile = Vector2i(Math::floor(bmin[0] / tile_world_size), Math::floor(bmin[2] / tile_world_size));
+	tiled_bake->last_tile = Vector2i(Math::floor(bmax[0] / tile_world_size), Math::floor(bmax[2] / tile_world_size));
+	const Vector2i bake_cells_min = Vector2i(Math::floor(bmin[0] / cfg.cs), Math::floor(bmin[2] / cfg.cs));
+	const Vector2i bake_cells_max = Vector2i(Math::ceil(bmax[0] / cfg.cs), Math::ceil(bmax[2] / cfg.cs));
+	const Vector2i tile_count = tiled_bake->last_tile - tiled_bake->first_tile + Vector2i(1, 1);
+
+	// Any change of these invalidates all the tiles of the previous bake.
+	uint64_t settings_hash = hash_djb2_one_64(tiled_bake->tile_cells);
+	settings_hash = hash_djb2_one_float_64(cfg.cs, settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.ch, settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.bmin[1], settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.bmax[1], settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.walkableSlopeAngle, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.borderSize, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.walkableHeight, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.walkableClimb, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.walkableRadius, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.maxEdgeLen, settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.maxSimplificationError, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.minRegionArea, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.mergeRegionArea, settings_hash);
+	settings_hash = hash_djb2_one_64(cfg.maxVertsPerPoly, settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.detailSampleDist, settings_hash);
+	settings_hash = hash_djb2_one_float_64(cfg.detailSampleMaxError, settings_hash);
+	settings_hash = hash_djb2_one_64(p_navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_djb2_one_64(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_djb2_one_64(p_navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_djb2_one_64(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+	settings_hash = hash_djb2_one_64(bake_cells_min.x, settings_hash);
+	settings_hash = hash_djb2_one_64(bake_cells_min.y, settings_hash);
+	settings_hash = hash_djb2_one_64(bake_cells_max.x, settings_hash);
+	settings_hash = hash_djb2_one_64(bake_cells_max.y, settings_hash);
+	tiled_bake->settings_hash = settings_hash;
+
+	// Bin the triangles in every tile they touch, border included.
+	LocalVector<LocalVector<int>> tile_triangles;
+	tile_triangles.resize(tile_count.x * tile_count.y);
+	const float border_world_size = cfg.borderSize * cfg.cs;
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+		const float min_x = MIN(MIN(v0[0], v1[0]), v2[0]) - border_world_size;
+		const float max_x = MAX(MAX(v0[0], v1[0]), v2[0]) + border_world_size;
+		const float min_z = MIN(MIN(v0[2], v1[2]), v2[2]) - border_world_size;
+		const float max_z = MAX(MAX(v0[2], v1[2]), v2[2]) + border_world_size;
+
+		const int from_x = MAX((int)Math::floor(min_x / tile_world_size), tiled_bake->first_tile.x);
+		const int to_x = MIN((int)Math::floor(max_x / tile_world_size), tiled_bake->last_tile.x);
+		const int from_z = MAX((int)Math::floor(min_z / tile_world_size), tiled_bake->first_tile.y);
+		const int to_z = MIN((int)Math::floor(max_z / tile_world_size), tiled_bake->last_tile.y);
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				tile_triangles[(z - tiled_bake->first_tile.y) * tile_count.x + (x - tiled_bake->first_tile.x)].push_back(i);
+			}
+		}
+	}
+
+	const HashMap<Vector2i, NavigationMesh::BakedTile> previous_tiles = p_navigation_mesh->get_baked_tiles(settings_hash);
+
+	for (int tile_z = 0; tile_z < tile_count.y; tile_z++) {
+		for (int tile_x = 0; tile_x < tile_count.x; tile_x++) {
+			const LocalVector<int> &triangles = tile_triangles[tile_z * tile_count.x + tile_x];
+			if (triangles.is_empty()) {
+				continue;
+			}
+
+			const Vector2i coords = tiled_bake->first_tile + Vector2i(tile_x, tile_z);
+			const Vector2i cells_min = Vector2i(MAX(coords.x * tiled_bake->tile_cells, bake_cells_min.x), MAX(coords.y * tiled_bake->tile_cells, bake_cells_min.y));
+			const Vector2i cells_max = Vector2i(MIN((coords.x + 1) * tiled_bake->tile_cells, bake_cells_max.x), MIN((coords.y + 1) * tiled_bake->tile_cells, bake_cells_max.y));
+			if (cells_min.x >= cells_max.x || cells_min.y >= cells_max.y) {
+				continue;
+			}
+
+			// Hash everything the tile is baked from, an unchanged hash means the previous result can be kept.
+			uint64_t source_hash = 5381;
+			for (int triangle : triangles) {
+				for (int j = 0; j < 3; j++) {
+					const float *v = &verts[tris[triangle * 3 + j] * 3];
+					source_hash = hash_djb2_one_float_64(v[0], source_hash);
+					source_hash = hash_djb2_one_float_64(v[1], source_hash);
+					source_hash = hash_djb2_one_float_64(v[2], source_hash);
+				}
+			}
+			const float tile_min_x = (cells_min.x - cfg.borderSize) * cfg.cs;
+			const float tile_max_x = (cells_max.x + cfg.borderSize) * cfg.cs;
+			const float tile_min_z = (cells_min.y - cfg.borderSize) * cfg.cs;
+			const float tile_max_z = (cells_max.y + cfg.borderSize) * cfg.cs;
+			for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : tiled_bake->projected_obstructions) {
+				const Vector<float> &obstruction_vertices = projected_obstruction.vertices;
+				bool overlaps = false;
+				for (int j = 0; j + 2 < obstruction_vertices.size() && !overlaps; j += 3) {
+					overlaps = obstruction_vertices[j] >= tile_min_x && obstruction_vertices[j] <= tile_max_x && obstruction_vertices[j + 2] >= tile_min_z && obstruction_vertices[j + 2] <= tile_max_z;
+				}
+				if (!overlaps) {
+					continue;
+				}
+				for (float value : obstruction_vertices) {
+					source_hash = hash_djb2_one_float_64(value, source_hash);
+				}
+				source_hash = hash_djb2_one_float_64(projected_obstruction.elevation, source_hash);
+				source_hash = hash_djb2_one_float_64(projected_obstruction.height, source_hash);
+				source_hash = hash_djb2_one_64(projected_obstruction.carve, source_hash);
+			}
+
+			const NavigationMesh::BakedTile *previous_tile = previous_tiles.getptr(coords);
+			if (previous_tile && previous_tile->source_hash == source_hash) {
+				tiled_bake->tiles.insert(coords, *previous_tile);
+				continue;
+			}
+
+			tiled_bake->dirty_tiles.push_back(NavMeshTiledBake3D::DirtyTile());
+			NavMeshTiledBake3D::DirtyTile &dirty_tile = tiled_bake->dirty_tiles[tiled_bake->dirty_tiles.size() - 1];
+			dirty_tile.coords = coords;
+			dirty_tile.cells_min = cells_min;
+			dirty_tile.cells_max = cells_max;
+			dirty_tile.result.source_hash = source_hash;
+			dirty_tile.indices.resize(triangles.size() * 3);
+			for (uint32_t j = 0; j < triangles.size(); j++) {
+				dirty_tile.indices[j * 3 + 0] = tris[triangles[j] * 3 + 0];
+				dirty_tile.indices[j * 3 + 1] = tris[triangles[j] * 3 + 1];
+				dirty_tile.indices[j * 3 + 2] = tris[triangles[j] * 3 + 2];
+			}
+		}
+	}
+
+	return tiled_bake;
+}
+
+void NavMeshGenerator3D::generator_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshTiledBake3D *tiled_bake = static_cast<NavMeshTiledBake3D *>(p_arg);
+	NavMeshTiledBake3D::DirtyTile &dirty_tile = tiled_bake->dirty_tiles[p_index];
+
+	rcConfig cfg = tiled_bake->cfg;
+	cfg.width = dirty_tile.cells_max.x - dirty_tile.cells_min.x + cfg.borderSize * 2;
+	cfg.height = dirty_tile.cells_max.y - dirty_tile.cells_min.y + cfg.borderSize * 2;
+	cfg.bmin[0] = (dirty_tile.cells_min.x - cfg.borderSize) * cfg.cs;
+	cfg.bmin[2] = (dirty_tile.cells_min.y - cfg.borderSize) * cfg.cs;
+	cfg.bmax[0] = (dirty_tile.cells_max.x + cfg.borderSize) * cfg.cs;
+	cfg.bmax[2] = (dirty_tile.cells_max.y + cfg.borderSize) * cfg.cs;
+
+	generator_bake_heightfield(cfg, tiled_bake->navigation_mesh,
+			tiled_bake->vertices.ptr(), tiled_bake->vertices.size() / 3,
+			dirty_tile.indices.ptr(), dirty_tile.indices.size() / 3,
+			tiled_bake->projected_obstructions,
+			dirty_tile.result.vertices, dirty_tile.result.polygons);
+}
+
+void NavMeshGenerator3D::generator_bake_dirty_tiles(NavMeshTiledBake3D *p_tiled_bake) {
+	const uint32_t dirty_tile_count = p_tiled_bake->dirty_tiles.size();
+	if (baking_use_multiple_threads && dirty_tile_count > 1 && WorkerThreadPool::get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_bake_tile, p_tiled_bake, dirty_tile_count, -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < dirty_tile_count; i++) {
+			generator_bake_tile(p_tiled_bake, i);
+		}
+	}
+}
+
+void NavMeshGenerator3D::generator_finish_tiled_bake(NavMeshTiledBake3D *p_tiled_bake) {
+	for (NavMeshTiledBake3D::DirtyTile &dirty_tile : p_tiled_bake->dirty_tiles) {
+		p_tiled_bake->tiles.insert(dirty_tile.coords, dirty_tile.result);
+	}
+
+	const rcConfig &cfg = p_tiled_bake->cfg;
+	const int tile_cells = p_tiled_bake->tile_cells;
+
+	LocalVector<Vector2i> tile_coords;
+	for (const KeyValue<Vector2i, NavigationMesh::BakedTile> &E : p_tiled_bake->tiles) {
+		tile_coords.push_back(E.key);
+	}
+	tile_coords.sort();
+
+	// Vertices shared by neighbor tiles come out of different heightfields and are only equal
+	// up to float precision, weld them on a grid much finer than the cells.
+	const float weld_size = cfg.cs * 0.01f;
+	const float weld_height = cfg.ch * 0.01f;
+	HashMap<Vector3i, int> welded_vertex_indices;
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	for (const Vector2i &coords : tile_coords) {
+		const NavigationMesh::BakedTile &tile = p_tiled_bake->tiles[coords];
+		LocalVector<int> tile_to_nav_index;
+		tile_to_nav_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			const Vector3 &vertex = tile.vertices[i];
+			const Vector3i weld_key(Math::round(vertex.x / weld_size), Math::round(vertex.y / weld_height), Math::round(vertex.z / weld_size));
+			int *existing_index_ptr = welded_vertex_indices.getptr(weld_key);
+			if (existing_index_ptr) {
+				tile_to_nav_index[i] = *existing_index_ptr;
+			} else {
+				tile_to_nav_index[i] = nav_vertices.size();
+				welded_vertex_indices.insert(weld_key, nav_vertices.size());
+				nav_vertices.push_back(vertex);
+			}
+		}
+
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> nav_polygon;
+			for (int index : tile_polygon) {
+				const int nav_index = tile_to_nav_index[index];
+				if (nav_polygon.is_empty() || (nav_polygon[nav_polygon.size() - 1] != nav_index && nav_polygon[0] != nav_index)) {
+					nav_polygon.push_back(nav_index);
+				}
+			}
+			if (nav_polygon.size() >= 3) {
+				nav_polygons.push_back(nav_polygon);
+			}
+		}
+	}
+
+	// Neighbor tiles don't always split their shared border at the same vertices. Edges on a tile
+	// border get the vertices of the other side inserted, so the polygons share full edges and connect.
+	HashMap<int, LocalVector<int>> seam_vertices_x; // Keyed by the cell of the border line.
+	HashMap<int, LocalVector<int>> seam_vertices_z;
+	LocalVector<int> vertex_seam_x;
+	LocalVector<int> vertex_seam_z;
+	vertex_seam_x.resize(nav_vertices.size());
+	vertex_seam_z.resize(nav_vertices.size());
+	for (int i = 0; i < nav_vertices.size(); i++) {
+		vertex_seam_x[i] = INT_MAX;
+		vertex_seam_z[i] = INT_MAX;
+		const float cell_x = nav_vertices[i].x / cfg.cs;
+		const float cell_z = nav_vertices[i].z / cfg.cs;
+		const int seam_x = (int)Math::round(cell_x / tile_cells) * tile_cells;
+		const int seam_z = (int)Math::round(cell_z / tile_cells) * tile_cells;
+		if (Math::abs(cell_x - seam_x) < 0.01f) {
+			vertex_seam_x[i] = seam_x;
+			seam_vertices_x[seam_x].push_back(i);
+		}
+		if (Math::abs(cell_z - seam_z) < 0.01f) {
+			vertex_seam_z[i] = seam_z;
+			seam_vertices_z[seam_z].push_back(i);
+		}
+	}
+
+	if (!seam_vertices_x.is_empty() || !seam_vertices_z.is_empty()) {
+		LocalVector<Pair<float, int>> inserted_vertices;
+		for (Vector<int> &nav_polygon : nav_polygons) {
+			Vector<int> split_polygon;
+			bool split = false;
+			for (int i = 0; i < nav_polygon.size(); i++) {
+				const int index_a = nav_polygon[i];
+				const int index_b = nav_polygon[(i + 1) % nav_polygon.size()];
+				split_polygon.push_back(index_a);
+
+				const LocalVector<int> *seam_vertices = nullptr;
+				if (vertex_seam_x[index_a] != INT_MAX && vertex_seam_x[index_a] == vertex_seam_x[index_b]) {
+					seam_vertices = seam_vertices_x.getptr(vertex_seam_x[index_a]);
+				} else if (vertex_seam_z[index_a] != INT_MAX && vertex_seam_z[index_a] == vertex_seam_z[index_b]) {
+					seam_vertices = seam_vertices_z.getptr(vertex_seam_z[index_a]);
+				}
+				if (!seam_vertices) {
+					continue;
+				}
+
+				const Vector3 &a = nav_vertices[index_a];
+				const Vector3 edge = nav_vertices[index_b] - a;
+				const real_t edge_length_squared = edge.length_squared();
+				if (edge_length_squared == 0.0) {
+					continue;
+				}
+				inserted_vertices.clear();
+				for (int seam_index : *seam_vertices) {
+					if (seam_index == index_a || seam_index == index_b) {
+						continue;
+					}
+					const Vector3 &vertex = nav_vertices[seam_index];
+					const real_t t = edge.dot(vertex - a) / edge_length_squared;
+					if (t <= 0.0 || t >= 1.0 || (a + edge * t).distance_to(vertex) > cfg.ch) {
+						continue;
+					}
+					inserted_vertices.push_back(Pair<float, int>(t, seam_index));
+				}
+				if (inserted_vertices.is_empty()) {
+					continue;
+				}
+				inserted_vertices.sort_custom<PairSort<float, int>>();
+				for (const Pair<float, int> &inserted_vertex : inserted_vertices) {
+					split_polygon.push_back(inserted_vertex.second);
+				}
+				split = true;
+			}
+			if (split) {
+				nav_polygon = split_polygon;
+			}
+		}
+	}
+
+	p_tiled_bake->navigation_mesh->set_data(nav_vertices, nav_polygons);
+	p_tiled_bake->navigation_mesh->set_baked_tiles(p_tiled_bake->settings_hash, p_tiled_bake->tiles);
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
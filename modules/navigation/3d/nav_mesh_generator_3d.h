@@ -38,9 +38,11 @@
 #include "core/templates/rid_owner.h"
 #include "modules/modules_enabled.gen.h" // For csg, gridmap.
 
+#include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
+
 class Node;
 class NavigationMesh;
-class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	static NavMeshGenerator3D *singleton;
@@ -60,6 +62,8 @@ class NavMeshGenerator3D : public Object {
 	static bool baking_use_multiple_threads;
 	static bool baking_use_high_priority_threads;
 
+	struct NavMeshTiledBake3D;
+
 	struct NavMeshGeneratorTask3D {
 		enum TaskStatus {
 			BAKING_STARTED,
@@ -73,6 +77,8 @@ class NavMeshGenerator3D : public Object {
 		Ref<NavigationMeshSourceGeometryData3D> source_geometry_data;
 		Callable callback;
 		WorkerThreadPool::TaskID thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
+		// Set for tiled bakes, `thread_task_id` is then the group task baking the dirty tiles.
+		NavMeshTiledBake3D *tiled_bake = nullptr;
 		NavMeshGeneratorTask3D::TaskStatus status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 	};
 
@@ -85,6 +91,13 @@ class NavMeshGenerator3D : public Object {
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	static void generator_create_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg);
+	static bool generator_bake_heightfield(const rcConfig &p_cfg, const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+
+	static NavMeshTiledBake3D *generator_prepare_tiled_bake(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	static void generator_bake_tile(void *p_arg, uint32_t p_index);
+	static void generator_bake_dirty_tiles(NavMeshTiledBake3D *p_tiled_bake);
+	static void generator_finish_tiled_bake(NavMeshTiledBake3D *p_tiled_bake);
 
 	static void generator_parse_meshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
 	static void generator_parse_multimeshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
@@ -0,0 +1,295 @@
+/**************************************************************************/
+/*  nav_avoidance_grid.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_AVOIDANCE_GRID_H
+#define NAV_AVOIDANCE_GRID_H
+
+#include "core/math/vector3i.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+#include <Agent2d.h>
+#include <Agent3d.h>
+
+// Uniform grid used to find the avoidance neighbors of the RVO agents of a map.
+// The grid keeps the agent data it needs in flat arrays sorted by cell, so a
+// neighbor query only touches the cells around the agent instead of walking a
+// tree of agent pointers. When no agent changed cell since the last update the
+// cell layout is kept and only the positions are refreshed.
+template <typename TAgent>
+class NavAvoidanceGrid {
+	struct Cell {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+	};
+
+	HashMap<Vector3i, uint32_t> cell_indices;
+	LocalVector<Cell> cells;
+	Vector3i cells_min;
+	Vector3i cells_max;
+
+	real_t cell_size = 0.0;
+	real_t inv_cell_size = 0.0;
+
+	// Input order.
+	LocalVector<TAgent *> agents;
+	LocalVector<Vector3i> agent_cells;
+	LocalVector<uint32_t> agent_slots;
+
+	// Cell order.
+	LocalVector<float> slot_x;
+	LocalVector<float> slot_y;
+	LocalVector<float> slot_z;
+	LocalVector<uint32_t> slot_layers;
+	LocalVector<TAgent *> slot_agents;
+
+	static _FORCE_INLINE_ void _get_agent_position(const RVO2D::Agent2D *p_agent, float *r_position) {
+		r_position[0] = p_agent->position_.x();
+		r_position[1] = p_agent->position_.y();
+		r_position[2] = 0.0f;
+	}
+
+	static _FORCE_INLINE_ void _get_agent_position(const RVO3D::Agent3D *p_agent, float *r_position) {
+		r_position[0] = p_agent->position_.x();
+		r_position[1] = p_agent->position_.y();
+		r_position[2] = p_agent->position_.z();
+	}
+
+	_FORCE_INLINE_ Vector3i _get_cell(const float *p_position) const {
+		return Vector3i(
+				int32_t(Math::floor(p_position[0] * inv_cell_size)),
+				int32_t(Math::floor(p_position[1] * inv_cell_size)),
+				int32_t(Math::floor(p_position[2] * inv_cell_size)));
+	}
+
+	_FORCE_INLINE_ void _store_slot(uint32_t p_slot, const TAgent *p_agent, const float *p_position) {
+		slot_x[p_slot] = p_position[0];
+		slot_y[p_slot] = p_position[1];
+		slot_z[p_slot] = p_position[2];
+		slot_layers[p_slot] = p_agent->avoidance_layers_;
+	}
+
+	_FORCE_INLINE_ void _query_cell(const Cell &p_cell, TAgent *p_agent, const float *p_position, float &r_range_sq) const {
+		const uint32_t mask = p_agent->avoidance_mask_;
+		for (uint32_t i = p_cell.begin; i < p_cell.end; i++) {
+			if ((slot_layers[i] & mask) == 0) {
+				continue;
+			}
+			const float dx = slot_x[i] - p_position[0];
+			const float dy = slot_y[i] - p_position[1];
+			const float dz = slot_z[i] - p_position[2];
+			if (dx * dx + dy * dy + dz * dz < r_range_sq) {
+				// Does the self, priority and height checks and shrinks the range once the neighbor list is full.
+				p_agent->insertAgentNeighbor(slot_agents[i], r_range_sq);
+			}
+		}
+	}
+
+	void _rebuild() {
+		const uint32_t agent_count = agents.size();
+
+		cell_indices.clear();
+		cells.clear();
+
+		float position[3];
+		for (uint32_t i = 0; i < agent_count; i++) {
+			_get_agent_position(agents[i], position);
+			const Vector3i cell = _get_cell(position);
+			agent_cells[i] = cell;
+
+			uint32_t *cell_index = cell_indices.getptr(cell);
+			if (cell_index) {
+				cells[*cell_index].end++;
+			} else {
+				cell_indices.insert(cell, cells.size());
+				Cell new_cell;
+				new_cell.end = 1;
+				cells.push_back(new_cell);
+			}
+
+			if (i == 0) {
+				cells_min = cell;
+				cells_max = cell;
+			} else {
+				cells_min = cells_min.min(cell);
+				cells_max = cells_max.max(cell);
+			}
+		}
+
+		// Turn the per cell counts into ranges.
+		uint32_t offset = 0;
+		for (Cell &cell : cells) {
+			const uint32_t count = cell.end;
+			cell.begin = offset;
+			cell.end = offset;
+			offset += count;
+		}
+
+		for (uint32_t i = 0; i < agent_count; i++) {
+			Cell &cell = cells[cell_indices[agent_cells[i]]];
+			const uint32_t slot = cell.end++;
+			agent_slots[i] = slot;
+			slot_agents[slot] = agents[i];
+			_get_agent_position(agents[i], position);
+			_store_slot(slot, agents[i], position);
+		}
+	}
+
+public:
+	// Requires the agent positions and neighbor distances to be up to date.
+	void update(const LocalVector<TAgent *> &p_agents) {
+		const uint32_t agent_count = p_agents.size();
+
+		// Size the cells after the average neighbor distance, so most queries only visit the cells next to the agent.
+		real_t neighbor_distance_sum = 0.0;
+		uint32_t neighbor_distance_count = 0;
+		for (const TAgent *agent : p_agents) {
+			if (agent->maxNeighbors_ > 0 && agent->neighborDist_ > 0.0f) {
+				neighbor_distance_sum += agent->neighborDist_;
+				neighbor_distance_count++;
+			}
+		}
+		const real_t wanted_cell_size = neighbor_distance_count > 0 ? neighbor_distance_sum / neighbor_distance_count : 1.0;
+
+		// Small changes of the neighbor distances do not warrant a new layout.
+		bool rebuild = agent_count != agents.size() || cell_size == 0.0 || wanted_cell_size < cell_size * 0.75 || wanted_cell_size > cell_size * 1.25;
+		if (rebuild) {
+			cell_size = wanted_cell_size;
+			inv_cell_size = 1.0 / cell_size;
+		}
+
+		if (!rebuild) {
+			for (uint32_t i = 0; i < agent_count; i++) {
+				if (p_agents[i] != agents[i]) {
+					rebuild = true;
+					break;
+				}
+			}
+		}
+
+		if (!rebuild) {
+			// Same agents, refresh them in place as long as none of them moved to another cell.
+			float position[3];
+			for (uint32_t i = 0; i < agent_count; i++) {
+				_get_agent_position(agents[i], position);
+				if (_get_cell(position) != agent_cells[i]) {
+					rebuild = true;
+					break;
+				}
+				_store_slot(agent_slots[i], agents[i], position);
+			}
+		}
+
+		if (!rebuild) {
+			return;
+		}
+
+		agents = p_agents;
+		agent_cells.resize(agent_count);
+		agent_slots.resize(agent_count);
+		slot_x.resize(agent_count);
+		slot_y.resize(agent_count);
+		slot_z.resize(agent_count);
+		slot_layers.resize(agent_count);
+		slot_agents.resize(agent_count);
+
+		_rebuild();
+	}
+
+	// Fills the agent neighbors of the agent, nearest first, like RVO's own kd-tree query.
+	void compute_agent_neighbors(TAgent *p_agent) const {
+		p_agent->agentNeighbors_.clear();
+
+		if (p_agent->maxNeighbors_ == 0 || cells.is_empty()) {
+			return;
+		}
+
+		float position[3];
+		_get_agent_position(p_agent, position);
+		float range_sq = p_agent->neighborDist_ * p_agent->neighborDist_;
+
+		// Start with the agent's own cell, the range shrinks quickly once the neighbor list is full.
+		const Vector3i own_cell = _get_cell(position);
+		const uint32_t *own_cell_index = cell_indices.getptr(own_cell);
+		if (own_cell_index) {
+			_query_cell(cells[*own_cell_index], p_agent, position, range_sq);
+		}
+
+		const float range = p_agent->neighborDist_;
+		const float range_min[3] = { position[0] - range, position[1] - range, position[2] - range };
+		const float range_max[3] = { position[0] + range, position[1] + range, position[2] + range };
+		const Vector3i from = _get_cell(range_min).max(cells_min);
+		const Vector3i to = _get_cell(range_max).min(cells_max);
+
+		for (int32_t z = from.z; z <= to.z; z++) {
+			for (int32_t y = from.y; y <= to.y; y++) {
+				for (int32_t x = from.x; x <= to.x; x++) {
+					const Vector3i cell_key(x, y, z);
+					if (cell_key == own_cell) {
+						continue;
+					}
+
+					// Skip the cells that are entirely out of the current range.
+					float cell_distance_sq = 0.0f;
+					const int32_t key[3] = { x, y, z };
+					for (int axis = 0; axis < 3; axis++) {
+						const float cell_begin = key[axis] * cell_size;
+						const float cell_end = cell_begin + cell_size;
+						const float d = position[axis] < cell_begin ? cell_begin - position[axis] : (position[axis] > cell_end ? position[axis] - cell_end : 0.0f);
+						cell_distance_sq += d * d;
+					}
+					if (cell_distance_sq >= range_sq) {
+						continue;
+					}
+
+					const uint32_t *cell_index = cell_indices.getptr(cell_key);
+					if (cell_index) {
+						_query_cell(cells[*cell_index], p_agent, position, range_sq);
+					}
+				}
+			}
+		}
+	}
+
+	void clear() {
+		cell_indices.clear();
+		cells.clear();
+		agents.clear();
+		agent_cells.clear();
+		agent_slots.clear();
+		slot_x.clear();
+		slot_y.clear();
+		slot_z.clear();
+		slot_layers.clear();
+		slot_agents.clear();
+	}
+};
+
+#endif // NAV_AVOIDANCE_GRID_H
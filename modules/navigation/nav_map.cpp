@@ -63,6 +63,28 @@
 #define NAVMAP_ITERATION_ZERO_ERROR_MSG()
 #endif // DEBUG_ENABLED
 
+// Path queries run on any thread, each thread keeps its own buffers between queries.
+struct PathQueryScratch {
+	LocalVector<gd::NavigationPoly> navigation_polys;
+	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer> traversable_polys;
+	uint32_t query_id = 0;
+
+	// Navigation polys stamped with the returned id are the ones reached by the current query.
+	uint32_t next_query_id() {
+		query_id++;
+		if (unlikely(query_id == 0)) {
+			// Wrapped around, old stamps could be mistaken for new ones.
+			for (gd::NavigationPoly &np : navigation_polys) {
+				np.query_id = 0;
+			}
+			query_id = 1;
+		}
+		return query_id;
+	}
+};
+
+static thread_local PathQueryScratch path_query_scratch;
+
 void NavMap::set_up(Vector3 p_up) {
 	if (up == p_up) {
 		return;
@@ -119,7 +141,7 @@ void NavMap::set_link_connection_radius(real_t p_link_connection_radius) {
 		return;
 	}
 	link_connection_radius = p_link_connection_radius;
-	regenerate_links = true;
+	regenerate_link_polygons = true;
 }
 
 gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
@@ -219,24 +241,32 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
-	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	// Navigation polys of every polygon in the map, indexed by polygon id. Only the ones
+	// stamped with the current query id were reached by this query.
+	PathQueryScratch &scratch = path_query_scratch;
+	LocalVector<gd::NavigationPoly> &navigation_polys = scratch.navigation_polys;
+	// Heap of polygons to visit, the cheapest one first. Cleared before the resize as it
+	// may still point into the buffer from the previous query.
+	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer> &traversable_polys = scratch.traversable_polys;
+	traversable_polys.clear();
+
+	const uint32_t polygon_count = polygons.size() + link_polygons.size();
+	if (navigation_polys.size() < polygon_count) {
+		navigation_polys.resize(polygon_count);
+	}
+	uint32_t query_id = scratch.next_query_id();
 
 	// Add the start polygon to the reachable navigation polygons.
-	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
-	begin_navigation_poly.self_id = 0;
+	gd::NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
+	begin_navigation_poly = gd::NavigationPoly(begin_poly);
+	begin_navigation_poly.self_id = begin_poly->id;
+	begin_navigation_poly.query_id = query_id;
 	begin_navigation_poly.entry = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
-	navigation_polys.push_back(begin_navigation_poly);
-
-	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
-	to_visit.push_back(0);
 
 	// This is an implementation of the A* algorithm.
-	int least_cost_id = 0;
+	int least_cost_id = begin_poly->id;
 	int prev_least_cost_id = -1;
 	bool found_route = false;
 
@@ -269,42 +299,44 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, pathway);
 				const real_t new_distance = (least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost) + poly_enter_cost + least_cost_poly.traveled_distance;
 
-				int64_t already_visited_polygon_index = navigation_polys.find(gd::NavigationPoly(connection.polygon));
+				gd::NavigationPoly &neighbor_poly = navigation_polys[connection.polygon->id];
 
-				if (already_visited_polygon_index != -1) {
+				if (neighbor_poly.query_id == query_id) {
 					// Polygon already visited, check if we can reduce the travel cost.
-					gd::NavigationPoly &avp = navigation_polys[already_visited_polygon_index];
-					if (new_distance < avp.traveled_distance) {
-						avp.back_navigation_poly_id = least_cost_id;
-						avp.back_navigation_edge = connection.edge;
-						avp.back_navigation_edge_pathway_start = connection.pathway_start;
-						avp.back_navigation_edge_pathway_end = connection.pathway_end;
-						avp.traveled_distance = new_distance;
-						avp.entry = new_entry;
+					if (new_distance < neighbor_poly.traveled_distance) {
+						neighbor_poly.back_navigation_poly_id = least_cost_id;
+						neighbor_poly.back_navigation_edge = connection.edge;
+						neighbor_poly.back_navigation_edge_pathway_start = connection.pathway_start;
+						neighbor_poly.back_navigation_edge_pathway_end = connection.pathway_end;
+						neighbor_poly.traveled_distance = new_distance;
+						neighbor_poly.entry = new_entry;
+						neighbor_poly.total_cost = new_distance + new_entry.distance_to(end_point) * connection.polygon->owner->get_travel_cost();
+
+						if (neighbor_poly.traversable_poly_index != UINT32_MAX) {
+							traversable_polys.shift(neighbor_poly.traversable_poly_index);
+						}
 					}
 				} else {
 					// Add the neighbor polygon to the reachable ones.
-					gd::NavigationPoly new_navigation_poly = gd::NavigationPoly(connection.polygon);
-					new_navigation_poly.self_id = navigation_polys.size();
-					new_navigation_poly.back_navigation_poly_id = least_cost_id;
-					new_navigation_poly.back_navigation_edge = connection.edge;
-					new_navigation_poly.back_navigation_edge_pathway_start = connection.pathway_start;
-					new_navigation_poly.back_navigation_edge_pathway_end = connection.pathway_end;
-					new_navigation_poly.traveled_distance = new_distance;
-					new_navigation_poly.entry = new_entry;
-					navigation_polys.push_back(new_navigation_poly);
+					neighbor_poly = gd::NavigationPoly(connection.polygon);
+					neighbor_poly.self_id = connection.polygon->id;
+					neighbor_poly.query_id = query_id;
+					neighbor_poly.back_navigation_poly_id = least_cost_id;
+					neighbor_poly.back_navigation_edge = connection.edge;
+					neighbor_poly.back_navigation_edge_pathway_start = connection.pathway_start;
+					neighbor_poly.back_navigation_edge_pathway_end = connection.pathway_end;
+					neighbor_poly.traveled_distance = new_distance;
+					neighbor_poly.entry = new_entry;
+					neighbor_poly.total_cost = new_distance + new_entry.distance_to(end_point) * connection.polygon->owner->get_travel_cost();
 
 					// Add the neighbor polygon to the polygons to visit.
-					to_visit.push_back(navigation_polys.size() - 1);
+					traversable_polys.push(&neighbor_poly);
 				}
 			}
 		}
 
-		// Removes the least cost polygon from the list of polygons to visit so we can advance.
-		to_visit.erase(least_cost_id);
-
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
-		if (to_visit.size() == 0) {
+		if (traversable_polys.is_empty()) {
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -367,12 +399,12 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			}
 
 			// Reset open and navigation_polys
-			gd::NavigationPoly np = navigation_polys[0];
-			navigation_polys.clear();
-			navigation_polys.push_back(np);
-			to_visit.clear();
-			to_visit.push_back(0);
-			least_cost_id = 0;
+			gd::NavigationPoly np = navigation_polys[begin_poly->id];
+			query_id = scratch.next_query_id();
+			np.query_id = query_id;
+			navigation_polys[begin_poly->id] = np;
+			traversable_polys.clear();
+			least_cost_id = begin_poly->id;
 			prev_least_cost_id = -1;
 
 			reachable_end = nullptr;
@@ -380,20 +412,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			continue;
 		}
 
-		// Find the polygon with the minimum cost from the list of polygons to visit.
-		least_cost_id = -1;
-		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
-			real_t cost = np->traveled_distance;
-			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
-			if (cost < least_cost) {
-				least_cost_id = np->self_id;
-				least_cost = cost;
-			}
-		}
-
-		ERR_BREAK(least_cost_id == -1);
+		// Take the polygon with the minimum cost from the polygons to visit.
+		least_cost_id = traversable_polys.pop()->self_id;
 
 		// Stores the further reachable end polygon, in case our goal is not reachable.
 		if (is_reachable) {
@@ -738,14 +758,14 @@ void NavMap::remove_region(NavRegion *p_region) {
 
 void NavMap::add_link(NavLink *p_link) {
 	links.push_back(p_link);
-	regenerate_links = true;
+	regenerate_link_polygons = true;
 }
 
 void NavMap::remove_link(NavLink *p_link) {
 	int64_t link_index = links.find(p_link);
 	if (link_index >= 0) {
 		links.remove_at_unordered(link_index);
-		regenerate_links = true;
+		regenerate_link_polygons = true;
 	}
 }
 
@@ -924,7 +944,7 @@ void NavMap::sync() {
 
 	for (NavLink *link : links) {
 		if (link->check_dirty()) {
-			regenerate_links = true;
+			regenerate_link_polygons = true;
 		}
 	}
 
@@ -959,12 +979,27 @@ void NavMap::sync() {
 			const LocalVector<gd::Polygon> &polygons_source = region->get_polygons();
 			for (uint32_t n = 0; n < polygons_source.size(); n++) {
 				polygons[count + n] = polygons_source[n];
+				polygons[count + n].id = count + n;
 			}
 			count += region->get_polygons().size();
 		}
 
 		_new_pm_polygon_count = polygons.size();
 
+		// Polygon bounds let the link connection skip the polygons out of reach.
+		polygon_bounds.resize(polygons.size());
+		for (uint32_t i = 0; i < polygons.size(); i++) {
+			const gd::Polygon &poly = polygons[i];
+			AABB bounds;
+			if (!poly.points.is_empty()) {
+				bounds.position = poly.points[0].pos;
+				for (uint32_t p = 1; p < poly.points.size(); p++) {
+					bounds.expand_to(poly.points[p].pos);
+				}
+			}
+			polygon_bounds[i] = bounds;
+		}
+
 		// Group all edges per key.
 		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
 		for (gd::Polygon &poly : polygons) {
@@ -972,19 +1007,19 @@ void NavMap::sync() {
 				int next_point = (p + 1) % poly.points.size();
 				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
 
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
-				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
+				Vector<gd::Edge::Connection> *edge_connections = connections.getptr(ek);
+				if (!edge_connections) {
+					edge_connections = &connections.insert(ek, Vector<gd::Edge::Connection>())->value;
 					_new_pm_edge_count += 1;
 				}
-				if (connections[ek].size() <= 1) {
+				if (edge_connections->size() <= 1) {
 					// Add the polygon/edge tuple to this key.
 					gd::Edge::Connection new_connection;
 					new_connection.polygon = &poly;
 					new_connection.edge = p;
 					new_connection.pathway_start = poly.points[p].pos;
 					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
+					edge_connections->push_back(new_connection);
 				} else {
 					// The edge is already connected with another edge, skip.
 					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
@@ -1018,170 +1053,14 @@ void NavMap::sync() {
 		// not really useful and would result in wasteful computation during
 		// connection, integration and path finding.
 		_new_pm_edge_free_count = free_edges.size();
+		_new_pm_edge_connection_count = _connect_free_edges(free_edges);
 
-		for (int i = 0; i < free_edges.size(); i++) {
-			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
-
-			for (int j = 0; j < free_edges.size(); j++) {
-				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
-
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
-
-				// Compute the projection of the opposite edge on the current one
-				Vector3 edge_vector = edge_p2 - edge_p1;
-				real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-				real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-				if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-					continue;
-				}
-
-				// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-				Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other1;
-				if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-					other1 = other_edge_p1;
-				} else {
-					other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other1.distance_to(self1) > edge_connection_margin) {
-					continue;
-				}
-
-				Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other2;
-				if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-					other2 = other_edge_p2;
-				} else {
-					other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other2.distance_to(self2) > edge_connection_margin) {
-					continue;
-				}
-
-				// The edges can now be connected.
-				gd::Edge::Connection new_connection = other_edge;
-				new_connection.pathway_start = (self1 + other1) / 2.0;
-				new_connection.pathway_end = (self2 + other2) / 2.0;
-				free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
-
-				// Add the connection to the region_connection map.
-				((NavRegion *)free_edge.polygon->owner)->get_connections().push_back(new_connection);
-				_new_pm_edge_connection_count += 1;
-			}
-		}
-
-		uint32_t link_poly_idx = 0;
-		link_polygons.resize(links.size());
-
-		// Search for polygons within range of a nav link.
-		for (const NavLink *link : links) {
-			if (!link->get_enabled()) {
-				continue;
-			}
-			const Vector3 start = link->get_start_position();
-			const Vector3 end = link->get_end_position();
-
-			gd::Polygon *closest_start_polygon = nullptr;
-			real_t closest_start_distance = link_connection_radius;
-			Vector3 closest_start_point;
-
-			gd::Polygon *closest_end_polygon = nullptr;
-			real_t closest_end_distance = link_connection_radius;
-			Vector3 closest_end_point;
-
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
-
-				// For each face check the distance to the start
-				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
-					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
-					const Vector3 start_point = start_face.get_closest_point_to(start);
-					const real_t start_distance = start_point.distance_to(start);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
-						closest_start_distance = start_distance;
-						closest_start_point = start_point;
-						closest_start_polygon = &start_poly;
-					}
-				}
-			}
-
-			// Find any polygons within the search radius of the end point.
-			for (gd::Polygon &end_poly : polygons) {
-				// For each face check the distance to the end
-				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
-					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
-					const Vector3 end_point = end_face.get_closest_point_to(end);
-					const real_t end_distance = end_point.distance_to(end);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
-						closest_end_distance = end_distance;
-						closest_end_point = end_point;
-						closest_end_polygon = &end_poly;
-					}
-				}
-			}
-
-			// If we have both a start and end point, then create a synthetic polygon to route through.
-			if (closest_start_polygon && closest_end_polygon) {
-				gd::Polygon &new_polygon = link_polygons[link_poly_idx++];
-				new_polygon.owner = link;
-
-				new_polygon.edges.clear();
-				new_polygon.edges.resize(4);
-				new_polygon.points.clear();
-				new_polygon.points.reserve(4);
-
-				// Build a set of vertices that create a thin polygon going from the start to the end point.
-				new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
-				new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
-				new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
-				new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
-
-				// Setup connections to go forward in the link.
-				{
-					gd::Edge::Connection entry_connection;
-					entry_connection.polygon = &new_polygon;
-					entry_connection.edge = -1;
-					entry_connection.pathway_start = new_polygon.points[0].pos;
-					entry_connection.pathway_end = new_polygon.points[1].pos;
-					closest_start_polygon->edges[0].connections.push_back(entry_connection);
-
-					gd::Edge::Connection exit_connection;
-					exit_connection.polygon = closest_end_polygon;
-					exit_connection.edge = -1;
-					exit_connection.pathway_start = new_polygon.points[2].pos;
-					exit_connection.pathway_end = new_polygon.points[3].pos;
-					new_polygon.edges[2].connections.push_back(exit_connection);
-				}
+		// The map polygons moved, the links have to be connected again.
+		regenerate_link_polygons = true;
+	}
 
-				// If the link is bi-directional, create connections from the end to the start.
-				if (link->is_bidirectional()) {
-					gd::Edge::Connection entry_connection;
-					entry_connection.polygon = &new_polygon;
-					entry_connection.edge = -1;
-					entry_connection.pathway_start = new_polygon.points[2].pos;
-					entry_connection.pathway_end = new_polygon.points[3].pos;
-					closest_end_polygon->edges[0].connections.push_back(entry_connection);
-
-					gd::Edge::Connection exit_connection;
-					exit_connection.polygon = closest_start_polygon;
-					exit_connection.edge = -1;
-					exit_connection.pathway_start = new_polygon.points[0].pos;
-					exit_connection.pathway_end = new_polygon.points[1].pos;
-					new_polygon.edges[0].connections.push_back(exit_connection);
-				}
-			}
-		}
+	if (regenerate_link_polygons) {
+		_sync_link_polygons(!regenerate_links);
 
 		// Some code treats 0 as a failure case, so we avoid returning 0 and modulo wrap UINT32_MAX manually.
 		iteration_id = iteration_id % UINT32_MAX + 1;
@@ -1207,6 +1086,7 @@ void NavMap::sync() {
 
 	regenerate_polygons = false;
 	regenerate_links = false;
+	regenerate_link_polygons = false;
 	obstacles_dirty = false;
 	agents_dirty = false;
 
@@ -1221,6 +1101,292 @@ void NavMap::sync() {
 	pm_edge_free_count = _new_pm_edge_free_count;
 }
 
+int NavMap::_connect_free_edges(const Vector<gd::Edge::Connection> &p_free_edges) {
+	const int free_edge_count = p_free_edges.size();
+	if (free_edge_count < 2) {
+		return 0;
+	}
+
+	// Free edges are bucketed in a grid so each edge is only tested against the edges near it.
+	// The cell size follows the average edge length so an edge covers a handful of cells.
+	LocalVector<AABB> edge_bounds;
+	edge_bounds.resize(free_edge_count);
+	real_t edge_length_sum = 0.0;
+	for (int i = 0; i < free_edge_count; i++) {
+		const gd::Edge::Connection &free_edge = p_free_edges[i];
+		const Vector3 &edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
+		const Vector3 &edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+		AABB bounds(edge_p1, Vector3());
+		bounds.expand_to(edge_p2);
+		edge_bounds[i] = bounds.grow(edge_connection_margin);
+		edge_length_sum += edge_p1.distance_to(edge_p2);
+	}
+	const real_t grid_cell_size = MAX(edge_length_sum / free_edge_count, edge_connection_margin * 2.0);
+
+	// Edges spanning too many cells are kept aside and tested against every other edge.
+	const int64_t max_edge_cells = 64;
+	HashMap<Vector3i, LocalVector<int>> grid;
+	LocalVector<int> oversized_edges;
+	for (int i = 0; i < free_edge_count; i++) {
+		const Vector3i from = (edge_bounds[i].position / grid_cell_size).floor();
+		const Vector3i to = (edge_bounds[i].get_end() / grid_cell_size).floor();
+		const Vector3i extent = to - from + Vector3i(1, 1, 1);
+		if (int64_t(extent.x) * extent.y * extent.z > max_edge_cells) {
+			oversized_edges.push_back(i);
+			continue;
+		}
+		for (int x = from.x; x <= to.x; x++) {
+			for (int y = from.y; y <= to.y; y++) {
+				for (int z = from.z; z <= to.z; z++) {
+					const Vector3i cell(x, y, z);
+					LocalVector<int> *cell_edges = grid.getptr(cell);
+					if (!cell_edges) {
+						cell_edges = &grid.insert(cell, LocalVector<int>())->value;
+					}
+					cell_edges->push_back(i);
+				}
+			}
+		}
+	}
+
+	int connection_count = 0;
+	LocalVector<int> candidates;
+	LocalVector<int> candidate_stamps;
+	candidate_stamps.resize(free_edge_count);
+	for (int &stamp : candidate_stamps) {
+		stamp = -1;
+	}
+
+	for (int i = 0; i < free_edge_count; i++) {
+		// Gather the edges sharing a cell with this one, in edge order like a plain scan would.
+		candidates.clear();
+		const bool is_oversized = oversized_edges.has(i);
+		if (is_oversized) {
+			for (int j = 0; j < free_edge_count; j++) {
+				candidates.push_back(j);
+			}
+		} else {
+			const Vector3i from = (edge_bounds[i].position / grid_cell_size).floor();
+			const Vector3i to = (edge_bounds[i].get_end() / grid_cell_size).floor();
+			for (int x = from.x; x <= to.x; x++) {
+				for (int y = from.y; y <= to.y; y++) {
+					for (int z = from.z; z <= to.z; z++) {
+						const LocalVector<int> *cell_edges = grid.getptr(Vector3i(x, y, z));
+						if (!cell_edges) {
+							continue;
+						}
+						for (int j : *cell_edges) {
+							if (candidate_stamps[j] != i) {
+								candidate_stamps[j] = i;
+								candidates.push_back(j);
+							}
+						}
+					}
+				}
+			}
+			for (int j : oversized_edges) {
+				candidates.push_back(j);
+			}
+			candidates.sort();
+		}
+
+		const gd::Edge::Connection &free_edge = p_free_edges[i];
+		Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
+		Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+
+		for (int j : candidates) {
+			const gd::Edge::Connection &other_edge = p_free_edges[j];
+			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
+				continue;
+			}
+			if (!edge_bounds[i].intersects(edge_bounds[j])) {
+				continue;
+			}
+			Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
+			Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
+
+			// Compute the projection of the opposite edge on the current one
+			Vector3 edge_vector = edge_p2 - edge_p1;
+			real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+			real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+			if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+				continue;
+			}
+
+			// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+			Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+			Vector3 other1;
+			if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+				other1 = other_edge_p1;
+			} else {
+				other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+			}
+			if (other1.distance_to(self1) > edge_connection_margin) {
+				continue;
+			}
+
+			Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+			Vector3 other2;
+			if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+				other2 = other_edge_p2;
+			} else {
+				other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+			}
+			if (other2.distance_to(self2) > edge_connection_margin) {
+				continue;
+			}
+
+			// The edges can now be connected.
+			gd::Edge::Connection new_connection = other_edge;
+			new_connection.pathway_start = (self1 + other1) / 2.0;
+			new_connection.pathway_end = (self2 + other2) / 2.0;
+			free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+
+			// Add the connection to the region_connection map.
+			((NavRegion *)free_edge.polygon->owner)->get_connections().push_back(new_connection);
+			connection_count += 1;
+		}
+	}
+
+	return connection_count;
+}
+
+void NavMap::_sync_link_polygons(bool p_remove_previous_connections) {
+	if (p_remove_previous_connections) {
+		// The map polygons are unchanged, only drop the connections leading into the previous link polygons.
+		for (gd::Polygon &poly : polygons) {
+			if (poly.edges.is_empty()) {
+				continue;
+			}
+			Vector<gd::Edge::Connection> &edge_connections = poly.edges[0].connections;
+			for (int i = 0; i < edge_connections.size();) {
+				if (edge_connections[i].edge == -1) {
+					edge_connections.remove_at(i);
+				} else {
+					i++;
+				}
+			}
+		}
+	}
+
+	uint32_t link_poly_idx = 0;
+	link_polygons.resize(links.size());
+
+	// Search for polygons within range of a nav link.
+	for (const NavLink *link : links) {
+		if (!link->get_enabled()) {
+			continue;
+		}
+		const Vector3 start = link->get_start_position();
+		const Vector3 end = link->get_end_position();
+
+		gd::Polygon *closest_start_polygon = nullptr;
+		real_t closest_start_distance = link_connection_radius;
+		Vector3 closest_start_point;
+
+		gd::Polygon *closest_end_polygon = nullptr;
+		real_t closest_end_distance = link_connection_radius;
+		Vector3 closest_end_point;
+
+		// Create link to any polygons within the search radius of the start point.
+		for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
+			gd::Polygon &start_poly = polygons[start_index];
+			if (!polygon_bounds[start_index].grow(link_connection_radius).has_point(start)) {
+				continue;
+			}
+
+			// For each face check the distance to the start
+			for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
+				const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
+				const Vector3 start_point = start_face.get_closest_point_to(start);
+				const real_t start_distance = start_point.distance_to(start);
+
+				// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+				if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
+					closest_start_distance = start_distance;
+					closest_start_point = start_point;
+					closest_start_polygon = &start_poly;
+				}
+			}
+		}
+
+		// Find any polygons within the search radius of the end point.
+		for (uint32_t end_index = 0; end_index < polygons.size(); end_index++) {
+			gd::Polygon &end_poly = polygons[end_index];
+			if (!polygon_bounds[end_index].grow(link_connection_radius).has_point(end)) {
+				continue;
+			}
+
+			// For each face check the distance to the end
+			for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
+				const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
+				const Vector3 end_point = end_face.get_closest_point_to(end);
+				const real_t end_distance = end_point.distance_to(end);
+
+				// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+				if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
+					closest_end_distance = end_distance;
+					closest_end_point = end_point;
+					closest_end_polygon = &end_poly;
+				}
+			}
+		}
+
+		// If we have both a start and end point, then create a synthetic polygon to route through.
+		if (closest_start_polygon && closest_end_polygon) {
+			gd::Polygon &new_polygon = link_polygons[link_poly_idx];
+			new_polygon.id = polygons.size() + link_poly_idx;
+			new_polygon.owner = link;
+			link_poly_idx++;
+
+			new_polygon.edges.clear();
+			new_polygon.edges.resize(4);
+			new_polygon.points.clear();
+			new_polygon.points.reserve(4);
+
+			// Build a set of vertices that create a thin polygon going from the start to the end point.
+			new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
+			new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
+			new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
+			new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
+
+			// Setup connections to go forward in the link.
+			{
+				gd::Edge::Connection entry_connection;
+				entry_connection.polygon = &new_polygon;
+				entry_connection.edge = -1;
+				entry_connection.pathway_start = new_polygon.points[0].pos;
+				entry_connection.pathway_end = new_polygon.points[1].pos;
+				closest_start_polygon->edges[0].connections.push_back(entry_connection);
+
+				gd::Edge::Connection exit_connection;
+				exit_connection.polygon = closest_end_polygon;
+				exit_connection.edge = -1;
+				exit_connection.pathway_start = new_polygon.points[2].pos;
+				exit_connection.pathway_end = new_polygon.points[3].pos;
+				new_polygon.edges[2].connections.push_back(exit_connection);
+			}
+
+			// If the link is bi-directional, create connections from the end to the start.
+			if (link->is_bidirectional()) {
+				gd::Edge::Connection entry_connection;
+				entry_connection.polygon = &new_polygon;
+				entry_connection.edge = -1;
+				entry_connection.pathway_start = new_polygon.points[2].pos;
+				entry_connection.pathway_end = new_polygon.points[3].pos;
+				closest_end_polygon->edges[0].connections.push_back(entry_connection);
+
+				gd::Edge::Connection exit_connection;
+				exit_connection.polygon = closest_start_polygon;
+				exit_connection.edge = -1;
+				exit_connection.pathway_start = new_polygon.points[0].pos;
+				exit_connection.pathway_end = new_polygon.points[1].pos;
+				new_polygon.edges[0].connections.push_back(exit_connection);
+			}
+		}
+	}
+}
+
 void NavMap::_update_rvo_obstacles_tree_2d() {
 	int obstacle_vertex_count = 0;
 	for (NavObstacle *obstacle : obstacles) {
@@ -1300,23 +1466,28 @@ void NavMap::_update_rvo_obstacles_tree_2d() {
 }
 
 void NavMap::_update_rvo_agents_tree_2d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO2D::Agent2D *> raw_agents;
-	raw_agents.reserve(active_2d_avoidance_agents.size());
-	for (NavAgent *agent : active_2d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_2d());
+	rvo_agents_2d.resize(active_2d_avoidance_agents.size());
+	for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+		rvo_agents_2d[i] = active_2d_avoidance_agents[i]->get_rvo_agent_2d();
 	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
+	rvo_agent_grid_2d.update(rvo_agents_2d);
 }
 
 void NavMap::_update_rvo_agents_tree_3d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO3D::Agent3D *> raw_agents;
-	raw_agents.reserve(active_3d_avoidance_agents.size());
-	for (NavAgent *agent : active_3d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_3d());
+	rvo_agents_3d.resize(active_3d_avoidance_agents.size());
+	for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+		rvo_agents_3d[i] = active_3d_avoidance_agents[i]->get_rvo_agent_3d();
 	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
+	rvo_agent_grid_3d.update(rvo_agents_3d);
+}
+
+void NavMap::_compute_rvo_neighbors_2d(RVO2D::Agent2D *p_agent) const {
+	// Static obstacles still come from RVO's obstacle tree, the agent neighbors from the grid.
+	p_agent->obstacleNeighbors_.clear();
+	const float obstacle_range = p_agent->timeHorizonObst_ * p_agent->maxSpeed_ + p_agent->radius_;
+	rvo_simulation_2d.kdTree_->computeObstacleNeighbors(p_agent, obstacle_range * obstacle_range);
+
+	rvo_agent_grid_2d.compute_agent_neighbors(p_agent);
 }
 
 void NavMap::_update_rvo_simulation() {
@@ -1330,14 +1501,14 @@ void NavMap::_update_rvo_simulation() {
 }
 
 void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+	_compute_rvo_neighbors_2d((*(agent + index))->get_rvo_agent_2d());
 	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 	(*(agent + index))->update();
 }
 
 void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+	rvo_agent_grid_3d.compute_agent_neighbors((*(agent + index))->get_rvo_agent_3d());
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 	(*(agent + index))->update();
@@ -1355,7 +1526,7 @@ void NavMap::step(real_t p_deltatime) {
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+				_compute_rvo_neighbors_2d(agent->get_rvo_agent_2d());
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 				agent->update();
@@ -1369,7 +1540,7 @@ void NavMap::step(real_t p_deltatime) {
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+				rvo_agent_grid_3d.compute_agent_neighbors(agent->get_rvo_agent_3d());
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 				agent->update();
@@ -31,6 +31,7 @@
 #ifndef NAV_MAP_H
 #define NAV_MAP_H
 
+#include "nav_avoidance_grid.h"
 #include "nav_rid.h"
 #include "nav_utils.h"
 
@@ -72,7 +73,10 @@ class NavMap : public NavRid {
 	real_t link_connection_radius = 1.0;
 
 	bool regenerate_polygons = true;
+	/// Rebuilds the connections between the map polygons, and the links after them.
 	bool regenerate_links = true;
+	/// Only connects the links again, the map polygons are unchanged.
+	bool regenerate_link_polygons = true;
 
 	/// Map regions
 	LocalVector<NavRegion *> regions;
@@ -83,6 +87,8 @@ class NavMap : public NavRid {
 
 	/// Map polygons
 	LocalVector<gd::Polygon> polygons;
+	/// Bounds of each map polygon, in the same order.
+	LocalVector<AABB> polygon_bounds;
 
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
@@ -92,6 +98,12 @@ class NavMap : public NavRid {
 	LocalVector<NavAgent *> active_2d_avoidance_agents;
 	LocalVector<NavAgent *> active_3d_avoidance_agents;
 
+	/// Neighbor search grids of the avoidance controlled agents
+	LocalVector<RVO2D::Agent2D *> rvo_agents_2d;
+	LocalVector<RVO3D::Agent3D *> rvo_agents_3d;
+	NavAvoidanceGrid<RVO2D::Agent2D> rvo_agent_grid_2d;
+	NavAvoidanceGrid<RVO3D::Agent3D> rvo_agent_grid_3d;
+
 	/// dirty flag when one of the agent's arrays are modified
 	bool agents_dirty = true;
 
@@ -228,8 +240,12 @@ private:
 	void _update_rvo_obstacles_tree_2d();
 	void _update_rvo_agents_tree_2d();
 	void _update_rvo_agents_tree_3d();
+	void _compute_rvo_neighbors_2d(RVO2D::Agent2D *p_agent) const;
 
 	void _update_merge_rasterizer_cell_dimensions();
+
+	int _connect_free_edges(const Vector<gd::Edge::Connection> &p_free_edges);
+	void _sync_link_polygons(bool p_remove_previous_connections);
 };
 
 #endif // NAV_MAP_H
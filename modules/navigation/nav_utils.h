@@ -98,6 +98,9 @@ struct Edge {
 };
 
 struct Polygon {
+	/// Index of this polygon in the map, map polygons come first and link polygons after.
+	uint32_t id = UINT32_MAX;
+
 	/// Navigation region or link that contains this polygon.
 	const NavBase *owner = nullptr;
 
@@ -115,6 +118,11 @@ struct NavigationPoly {
 	/// This poly.
 	const Polygon *poly;
 
+	/// The path query this poly was last reached in, the other data is stale if it isn't the current one.
+	uint32_t query_id = 0;
+	/// Index in the heap of polys to visit, or UINT32_MAX if it isn't in it.
+	uint32_t traversable_poly_index = UINT32_MAX;
+
 	/// Those 4 variables are used to travel the path backwards.
 	int back_navigation_poly_id = -1;
 	int back_navigation_edge = -1;
@@ -125,6 +133,8 @@ struct NavigationPoly {
 	Vector3 entry;
 	/// The distance to the destination.
 	real_t traveled_distance = 0.0;
+	/// The traveled distance plus the estimated cost to the end point.
+	real_t total_cost = 0.0;
 
 	NavigationPoly() { poly = nullptr; }
 
@@ -140,6 +150,112 @@ struct NavigationPoly {
 	}
 };
 
+struct NavPolyTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`, this makes the heap a min-heap.
+	bool operator()(const NavigationPoly *p_poly_a, const NavigationPoly *p_poly_b) const {
+		return p_poly_a->total_cost > p_poly_b->total_cost;
+	}
+};
+
+struct NavPolyHeapIndexer {
+	void operator()(NavigationPoly *p_poly, uint32_t p_heap_index) const {
+		p_poly->traversable_poly_index = p_heap_index;
+	}
+};
+
+/**
+ * Binary heap keeping the element preferred by `LessThan` at the top. `Indexer` is told about
+ * every change of element position, so elements can be found again to update their priority.
+ */
+template <typename T, typename LessThan, typename Indexer>
+class Heap {
+	LocalVector<T> _buffer;
+
+	LessThan _less_than;
+	Indexer _indexer;
+
+	bool _shift_up(uint32_t p_index) {
+		T value = _buffer[p_index];
+		uint32_t index = p_index;
+		while (index > 0) {
+			uint32_t parent = (index - 1) / 2;
+			if (!_less_than(_buffer[parent], value)) {
+				break;
+			}
+			_buffer[index] = _buffer[parent];
+			_indexer(_buffer[index], index);
+			index = parent;
+		}
+		_buffer[index] = value;
+		_indexer(value, index);
+		return index != p_index;
+	}
+
+	void _shift_down(uint32_t p_index) {
+		T value = _buffer[p_index];
+		uint32_t index = p_index;
+		uint32_t size = _buffer.size();
+		while (true) {
+			uint32_t child = index * 2 + 1;
+			if (child >= size) {
+				break;
+			}
+			if (child + 1 < size && _less_than(_buffer[child], _buffer[child + 1])) {
+				child++;
+			}
+			if (!_less_than(value, _buffer[child])) {
+				break;
+			}
+			_buffer[index] = _buffer[child];
+			_indexer(_buffer[index], index);
+			index = child;
+		}
+		_buffer[index] = value;
+		_indexer(value, index);
+	}
+
+public:
+	void reserve(uint32_t p_size) { _buffer.reserve(p_size); }
+	uint32_t size() const { return _buffer.size(); }
+	bool is_empty() const { return _buffer.is_empty(); }
+
+	void push(const T &p_element) {
+		_buffer.push_back(p_element);
+		_shift_up(_buffer.size() - 1);
+	}
+
+	T pop() {
+		ERR_FAIL_COND_V_MSG(_buffer.is_empty(), T(), "Can't pop an empty heap.");
+		T top = _buffer[0];
+		_indexer(top, UINT32_MAX);
+
+		uint32_t last = _buffer.size() - 1;
+		if (last > 0) {
+			_buffer[0] = _buffer[last];
+			_buffer.resize(last);
+			_shift_down(0);
+		} else {
+			_buffer.clear();
+		}
+		return top;
+	}
+
+	/// Moves the element at `p_index` to its place after its priority changed.
+	void shift(uint32_t p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, _buffer.size());
+		if (!_shift_up(p_index)) {
+			_shift_down(p_index);
+		}
+	}
+
+	void clear() {
+		for (const T &element : _buffer) {
+			_indexer(element, UINT32_MAX);
+		}
+		_buffer.clear();
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
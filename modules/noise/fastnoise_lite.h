@@ -215,6 +215,9 @@ public:
 	real_t get_noise_3dv(Vector3 p_v) const override;
 	real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const override;
 
+	void _get_noise_2d_batch(const Vector2 *p_points, real_t *r_values, int p_count) const override;
+	void _get_noise_3d_batch(const Vector3 *p_points, real_t *r_values, int p_count) const override;
+
 	void _changed();
 };
 
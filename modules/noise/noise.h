@@ -275,10 +275,27 @@ class Noise : public Resource {
 		return out.l;
 	}
 
+	struct ImageRows {
+		int width = 0;
+		int height = 0;
+		bool in_3d_space = false;
+		real_t *values = nullptr;
+	};
+
+	void _generate_image_row(uint32_t p_row, const ImageRows *p_rows) const;
+
 protected:
 	static void _bind_methods();
 
 public:
+	// Batch sampling, implementations can override these to avoid a virtual call per point.
+	// Must be safe to call from several threads at once, since images are generated row by row on the WorkerThreadPool.
+	virtual void _get_noise_2d_batch(const Vector2 *p_points, real_t *r_values, int p_count) const;
+	virtual void _get_noise_3d_batch(const Vector3 *p_points, real_t *r_values, int p_count) const;
+
+	PackedFloat32Array get_noise_2d_batch(const PackedVector2Array &p_points) const;
+	PackedFloat32Array get_noise_3d_batch(const PackedVector3Array &p_points) const;
+
 	// Virtual destructor so we can delete any Noise derived object when referenced as a Noise*.
 	virtual ~Noise() {}
 
@@ -577,6 +577,34 @@ TEST_CASE("[FastNoiseLite] Domain warp") {
 	}
 }
 
+TEST_CASE("[FastNoiseLite] Batch sampling matches single samples") {
+	FastNoiseLite noise;
+	noise.set_noise_type(FastNoiseLite::NoiseType::TYPE_PERLIN);
+	noise.set_fractal_type(FastNoiseLite::FractalType::FRACTAL_FBM);
+	noise.set_offset(Vector3(3.5, -7, 12));
+
+	PackedVector2Array points_2d;
+	PackedVector3Array points_3d;
+	for (int i = 0; i < 64; i++) {
+		points_2d.push_back(Vector2(i * 1.5, i * -0.75));
+		points_3d.push_back(Vector3(i * 1.5, i * -0.75, i * 0.25));
+	}
+
+	for (bool domain_warp : { false, true }) {
+		noise.set_domain_warp_enabled(domain_warp);
+
+		PackedFloat32Array values_2d = noise.get_noise_2d_batch(points_2d);
+		PackedFloat32Array values_3d = noise.get_noise_3d_batch(points_3d);
+		REQUIRE(values_2d.size() == points_2d.size());
+		REQUIRE(values_3d.size() == points_3d.size());
+
+		for (int i = 0; i < points_2d.size(); i++) {
+			CHECK(values_2d[i] == doctest::Approx(noise.get_noise_2dv(points_2d[i])));
+			CHECK(values_3d[i] == doctest::Approx(noise.get_noise_3dv(points_3d[i])));
+		}
+	}
+}
+
 // Raw image data for the reference images used in the regression tests.
 // Generated with the following code:
 //     for (int y = 0; y < img->get_data().size(); y++) {
@@ -37,6 +37,7 @@
 #endif
 
 RTCDevice StaticRaycasterEmbree::embree_device;
+BinaryMutex StaticRaycasterEmbree::embree_device_mutex;
 
 StaticRaycaster *StaticRaycasterEmbree::create_embree_raycaster() {
 	return memnew(StaticRaycasterEmbree);
@@ -123,9 +124,13 @@ StaticRaycasterEmbree::StaticRaycasterEmbree() {
 	_MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
 #endif
 
-	if (!embree_device) {
-		embree_device = rtcNewDevice(nullptr);
-		rtcSetDeviceErrorFunction(embree_device, &embree_error_handler, nullptr);
+	{
+		// Raycasters may be created from several threads, e.g. when generating LODs for many surfaces.
+		MutexLock lock(embree_device_mutex);
+		if (!embree_device) {
+			embree_device = rtcNewDevice(nullptr);
+			rtcSetDeviceErrorFunction(embree_device, &embree_error_handler, nullptr);
+		}
 	}
 
 	embree_scene = rtcNewScene(embree_device);
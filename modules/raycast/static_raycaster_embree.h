@@ -34,6 +34,7 @@
 #ifdef TOOLS_ENABLED
 
 #include "core/math/static_raycaster.h"
+#include "core/os/mutex.h"
 
 #include <embree4/rtcore.h>
 
@@ -42,6 +43,7 @@ class StaticRaycasterEmbree : public StaticRaycaster {
 
 private:
 	static RTCDevice embree_device;
+	static BinaryMutex embree_device_mutex;
 	RTCScene embree_scene;
 
 	HashSet<int> filter_meshes;
@@ -46,6 +46,44 @@ static void _regex_free(void *ptr, void *user) {
 	}
 }
 
+// Match data and context reused by every search on the same thread, so matching doesn't allocate per call.
+// The match data only grows, a larger ovector than the pattern needs is fine for PCRE2.
+struct RegExMatchScratch {
+	pcre2_general_context_32 *gctx = nullptr;
+	pcre2_match_context_32 *mctx = nullptr;
+	pcre2_match_data_32 *match = nullptr;
+	uint32_t pairs = 0;
+
+	pcre2_match_data_32 *get_match_data(uint32_t p_pairs) {
+		if (!gctx) {
+			gctx = pcre2_general_context_create_32(&_regex_malloc, &_regex_free, nullptr);
+			mctx = pcre2_match_context_create_32(gctx);
+		}
+		if (p_pairs > pairs) {
+			if (match) {
+				pcre2_match_data_free_32(match);
+			}
+			match = pcre2_match_data_create_32(p_pairs, gctx);
+			pairs = p_pairs;
+		}
+		return match;
+	}
+
+	~RegExMatchScratch() {
+		if (match) {
+			pcre2_match_data_free_32(match);
+		}
+		if (mctx) {
+			pcre2_match_context_free_32(mctx);
+		}
+		if (gctx) {
+			pcre2_general_context_free_32(gctx);
+		}
+	}
+};
+
+static thread_local RegExMatchScratch match_scratch;
+
 int RegExMatch::_find(const Variant &p_name) const {
 	if (p_name.is_num()) {
 		int i = (int)p_name;
@@ -173,6 +211,8 @@ void RegEx::clear() {
 		pcre2_code_free_32((pcre2_code_32 *)code);
 		code = nullptr;
 	}
+	capture_count = 0;
+	group_names.clear();
 }
 
 Error RegEx::compile(const String &p_pattern) {
@@ -198,90 +238,104 @@ Error RegEx::compile(const String &p_pattern) {
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
-	return OK;
-}
 
-Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
-	ERR_FAIL_COND_V(!is_valid(), nullptr);
-	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
+	// pcre2_match() uses the JIT code when there is some. Without JIT support
+	// (e.g. builtin_pcre2_with_jit=no) this fails and matching stays interpreted.
+	pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE);
 
-	Ref<RegExMatch> result = memnew(RegExMatch);
+	_pattern_info(PCRE2_INFO_CAPTURECOUNT, &capture_count);
 
-	int length = p_subject.length();
-	if (p_end >= 0 && p_end < length) {
-		length = p_end;
+	uint32_t count;
+	const char32_t *table;
+	uint32_t entry_size;
+
+	_pattern_info(PCRE2_INFO_NAMECOUNT, &count);
+	_pattern_info(PCRE2_INFO_NAMETABLE, &table);
+	_pattern_info(PCRE2_INFO_NAMEENTRYSIZE, &entry_size);
+
+	for (uint32_t i = 0; i < count; i++) {
+		group_names.push_back(Pair<String, int>(String(&table[i * entry_size + 1]), table[i * entry_size]));
 	}
 
+	return OK;
+}
+
+Ref<RegExMatch> RegEx::_search(const String &p_subject, int p_offset, int p_length) const {
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	uint32_t size = capture_count + 1;
+	pcre2_match_data_32 *match = match_scratch.get_match_data(size);
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	int res = pcre2_match_32(c, s, p_length, p_offset, 0, match, match_scratch.mctx);
 
 	if (res < 0) {
-		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
-
 		return nullptr;
 	}
 
-	uint32_t size = pcre2_get_ovector_count_32(match);
 	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
 
+	Ref<RegExMatch> result = memnew(RegExMatch);
 	result->data.resize(size);
 
+	RegExMatch::Range *data = result->data.ptrw();
 	for (uint32_t i = 0; i < size; i++) {
-		result->data.write[i].start = ovector[i * 2];
-		result->data.write[i].end = ovector[i * 2 + 1];
+		data[i].start = ovector[i * 2];
+		data[i].end = ovector[i * 2 + 1];
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	result->subject = p_subject;
 
-	uint32_t count;
-	const char32_t *table;
-	uint32_t entry_size;
-
-	_pattern_info(PCRE2_INFO_NAMECOUNT, &count);
-	_pattern_info(PCRE2_INFO_NAMETABLE, &table);
-	_pattern_info(PCRE2_INFO_NAMEENTRYSIZE, &entry_size);
-
-	for (uint32_t i = 0; i < count; i++) {
-		char32_t id = table[i * entry_size];
-		if (result->data[id].start == -1) {
+	for (const Pair<String, int> &E : group_names) {
+		if (data[E.second].start == -1) {
 			continue;
 		}
-		String name = &table[i * entry_size + 1];
-		if (result->names.has(name)) {
+		if (result->names.has(E.first)) {
 			continue;
 		}
 
-		result->names.insert(name, id);
+		result->names.insert(E.first, E.second);
 	}
 
 	return result;
 }
 
+Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), nullptr);
+	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
+
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	return _search(p_subject, p_offset, length);
+}
+
 TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), Array());
 	ERR_FAIL_COND_V_MSG(p_offset < 0, Array(), "RegEx search offset must be >= 0");
 
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
 	int last_end = 0;
 	TypedArray<RegExMatch> result;
-	Ref<RegExMatch> match = search(p_subject, p_offset, p_end);
+	Ref<RegExMatch> match = _search(p_subject, p_offset, length);
 
 	while (match.is_valid()) {
-		last_end = match->get_end(0);
-		if (match->get_start(0) == last_end) {
+		last_end = match->data[0].end;
+		if (match->data[0].start == last_end) {
 			last_end++;
 		}
 
 		result.push_back(match);
-		match = search(p_subject, last_end, p_end);
+		if (last_end > length) {
+			break;
+		}
+		match = _search(p_subject, last_end, length);
 	}
 	return result;
 }
@@ -311,13 +365,12 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 	}
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 	PCRE2_SPTR32 r = (PCRE2_SPTR32)p_replacement.get_data();
 	PCRE2_UCHAR32 *o = (PCRE2_UCHAR32 *)output.ptrw();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	pcre2_match_data_32 *match = match_scratch.get_match_data(capture_count + 1);
+	pcre2_match_context_32 *mctx = match_scratch.mctx;
 
 	int res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 
@@ -327,9 +380,6 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	if (res < 0) {
 		return String();
 	}
@@ -348,11 +398,7 @@ String RegEx::get_pattern() const {
 int RegEx::get_group_count() const {
 	ERR_FAIL_COND_V(!is_valid(), 0);
 
-	uint32_t count;
-
-	_pattern_info(PCRE2_INFO_CAPTURECOUNT, &count);
-
-	return count;
+	return capture_count;
 }
 
 PackedStringArray RegEx::get_names() const {
@@ -360,18 +406,9 @@ PackedStringArray RegEx::get_names() const {
 
 	ERR_FAIL_COND_V(!is_valid(), result);
 
-	uint32_t count;
-	const char32_t *table;
-	uint32_t entry_size;
-
-	_pattern_info(PCRE2_INFO_NAMECOUNT, &count);
-	_pattern_info(PCRE2_INFO_NAMETABLE, &table);
-	_pattern_info(PCRE2_INFO_NAMEENTRYSIZE, &entry_size);
-
-	for (uint32_t i = 0; i < count; i++) {
-		String name = &table[i * entry_size + 1];
-		if (!result.has(name)) {
-			result.append(name);
+	for (const Pair<String, int> &E : group_names) {
+		if (!result.has(E.first)) {
+			result.append(E.first);
 		}
 	}
 
@@ -34,6 +34,7 @@
 #include "core/object/ref_counted.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/pair.h"
 #include "core/templates/vector.h"
 #include "core/variant/array.h"
 #include "core/variant/dictionary.h"
@@ -76,7 +77,12 @@ class RegEx : public RefCounted {
 	void *code = nullptr;
 	String pattern;
 
+	// Read from the pattern once on compile, rather than on every match.
+	uint32_t capture_count = 0;
+	Vector<Pair<String, int>> group_names;
+
 	void _pattern_info(uint32_t what, void *where) const;
+	Ref<RegExMatch> _search(const String &p_subject, int p_offset, int p_length) const;
 
 protected:
 	static void _bind_methods();
@@ -413,6 +413,29 @@ TEST_CASE("[RegEx] Lookbehind groups empty matches") {
 	CHECK(match->get_string(1) == String("b"));
 }
 
+TEST_CASE("[RegEx] Interleaved patterns with different group counts") {
+	// Searches on the same thread share their match data, which must not leak groups between patterns.
+	RegEx re_many("(a)(b)(c)(d)");
+	RegEx re_optional("(x)(y)?");
+	REQUIRE(re_many.is_valid());
+	REQUIRE(re_optional.is_valid());
+
+	Ref<RegExMatch> match = re_many.search("abcd");
+	REQUIRE(match != nullptr);
+	CHECK(match->get_group_count() == 4);
+	CHECK(match->get_string(4) == "d");
+
+	match = re_optional.search("x");
+	REQUIRE(match != nullptr);
+	CHECK(match->get_group_count() == 2);
+	CHECK(match->get_string(1) == "x");
+	CHECK(match->get_start(2) == -1);
+	CHECK(match->get_end(2) == -1);
+
+	CHECK(re_many.sub("abcd abcd", "$4$3$2$1", true) == "dcba dcba");
+	CHECK(re_optional.search_all("xy x xy").size() == 3);
+}
+
 } // namespace TestRegEx
 
 #endif // TEST_REGEX_H
@@ -1852,6 +1852,7 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	}
 	p_font_data->cache.clear();
 	p_font_data->face_init = false;
+	p_font_data->shape_cache_id = 0;
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
 	p_font_data->supported_scripts.clear();
@@ -5884,6 +5885,55 @@ _FORCE_INLINE_ void TextServerAdvanced::_add_featuers(const Dictionary &p_source
 	}
 }
 
+bool TextServerAdvanced::_shape_cache_get(const ShapeCacheKey &p_key, int64_t p_start, Vector<hb_glyph_info_t> &r_info, Vector<hb_glyph_position_t> &r_pos) {
+	MutexLock lock(shape_cache_mutex);
+
+	ShapeCacheData *E = shape_cache.getptr(p_key);
+	if (!E) {
+		return false;
+	}
+	E->last_used = ++shape_cache_tick;
+	r_info = E->info;
+	r_pos = E->pos;
+
+	hb_glyph_info_t *w = r_info.ptrw();
+	for (int i = 0; i < r_info.size(); i++) {
+		w[i].cluster += p_start;
+	}
+	return true;
+}
+
+void TextServerAdvanced::_shape_cache_add(const ShapeCacheKey &p_key, int64_t p_start, const hb_glyph_info_t *p_info, const hb_glyph_position_t *p_pos, unsigned int p_count) {
+	MutexLock lock(shape_cache_mutex);
+
+	if (shape_cache.size() >= (uint32_t)SHAPE_CACHE_MAX_SIZE) {
+		// Drop everything not used during the last half cache size lookups,
+		// which is at least half of the entries.
+		const uint64_t threshold = shape_cache_tick - MIN(shape_cache_tick, (uint64_t)SHAPE_CACHE_MAX_SIZE / 2);
+		Vector<ShapeCacheKey> expired;
+		for (const KeyValue<ShapeCacheKey, ShapeCacheData> &E : shape_cache) {
+			if (E.value.last_used <= threshold) {
+				expired.push_back(E.key);
+			}
+		}
+		for (const ShapeCacheKey &key : expired) {
+			shape_cache.erase(key);
+		}
+	}
+
+	ShapeCacheData data;
+	data.info.resize(p_count);
+	data.pos.resize(p_count);
+	hb_glyph_info_t *w = data.info.ptrw();
+	for (unsigned int i = 0; i < p_count; i++) {
+		w[i] = p_info[i];
+		w[i].cluster -= p_start;
+	}
+	memcpy(data.pos.ptrw(), p_pos, p_count * sizeof(hb_glyph_position_t));
+	data.last_used = ++shape_cache_tick;
+	shape_cache.insert(p_key, data);
+}
+
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, TypedArray<RID> p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end, RID p_prev_font) {
 	RID f;
 	int fs = p_sd->spans[p_span].font_size;
@@ -6001,8 +6051,6 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
 	ERR_FAIL_NULL(hb_font);
 
-	hb_buffer_clear_contents(p_sd->hb_buffer);
-	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
 	int flags = (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0);
 	if (p_sd->preserve_control) {
 		flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
@@ -6012,28 +6060,77 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 #if HB_VERSION_ATLEAST(5, 1, 0)
 	flags |= HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL;
 #endif
-	hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
-	hb_buffer_set_script(p_sd->hb_buffer, p_script);
 
+	hb_language_t lang;
 	if (p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
 	} else {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
 	}
 
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
-
 	Vector<hb_feature_t> ftrs;
 	_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+	// Build the shared cache key, HarfBuzz only looks at a few characters around the run.
+	if (fd->shape_cache_id == 0) {
+		MutexLock cache_lock(shape_cache_mutex);
+		fd->shape_cache_id = ++shape_cache_last_font_id;
+	}
+	const int64_t ctx_start = MAX<int64_t>(0, p_start - SHAPE_CACHE_CONTEXT_LENGTH);
+	const int64_t ctx_end = MIN<int64_t>(p_sd->text.length(), p_end + SHAPE_CACHE_CONTEXT_LENGTH);
+	const uint64_t lang_id = (uint64_t)(uintptr_t)lang; // Languages are interned by HarfBuzz.
+
+	ShapeCacheKey key;
+	key.data.resize(12 + ftrs.size() * 4 + (ctx_end - ctx_start));
+	uint32_t *kw = key.data.ptrw();
+	int kp = 0;
+	kw[kp++] = (uint32_t)fd->shape_cache_id;
+	kw[kp++] = (uint32_t)(fd->shape_cache_id >> 32);
+	kw[kp++] = fs;
+	kw[kp++] = fss.x;
+	kw[kp++] = p_script;
+	kw[kp++] = p_direction;
+	kw[kp++] = flags;
+	kw[kp++] = (uint32_t)lang_id;
+	kw[kp++] = (uint32_t)(lang_id >> 32);
+	kw[kp++] = p_start - ctx_start;
+	kw[kp++] = ctx_end - p_end;
+	kw[kp++] = ftrs.size();
+	for (const hb_feature_t &ftr : ftrs) {
+		kw[kp++] = ftr.tag;
+		kw[kp++] = ftr.value;
+		kw[kp++] = ftr.start;
+		kw[kp++] = ftr.end;
+	}
+	memcpy(&kw[kp], p_sd->text.ptr() + ctx_start, (ctx_end - ctx_start) * sizeof(uint32_t));
+	key.hash = hash_murmur3_buffer(kw, key.data.size() * sizeof(uint32_t));
 
 	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+	hb_glyph_info_t *glyph_info = nullptr;
+	hb_glyph_position_t *glyph_pos = nullptr;
+
+	Vector<hb_glyph_info_t> cached_info;
+	Vector<hb_glyph_position_t> cached_pos;
+	if (_shape_cache_get(key, p_start, cached_info, cached_pos)) {
+		glyph_count = cached_info.size();
+		glyph_info = cached_info.ptrw();
+		glyph_pos = cached_pos.ptrw();
+	} else {
+		hb_buffer_clear_contents(p_sd->hb_buffer);
+		hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
+		hb_buffer_set_script(p_sd->hb_buffer, p_script);
+		hb_buffer_set_language(p_sd->hb_buffer, lang);
+
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+		_shape_cache_add(key, p_start, glyph_info, glyph_pos, glyph_count);
+	}
 
 	int mod = 0;
 	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
@@ -344,6 +344,8 @@ class TextServerAdvanced : public TextServerExtension {
 		size_t data_size;
 		int face_index = 0;
 
+		uint64_t shape_cache_id = 0; // Changes whenever shaping results might change, 0 if not assigned yet.
+
 		~FontAdvanced() {
 			for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : cache) {
 				memdelete(E.value);
@@ -647,6 +649,41 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// HarfBuzz output for a run, shared by all shaped texts. The key contains
+	// everything hb_shape() depends on: font, size, script, direction,
+	// language, buffer flags, features and the run text with its context.
+	struct ShapeCacheKey {
+		Vector<uint32_t> data;
+		uint32_t hash = 0;
+
+		bool operator==(const ShapeCacheKey &p_b) const {
+			return (hash == p_b.hash) && (data.size() == p_b.data.size()) && (memcmp(data.ptr(), p_b.data.ptr(), data.size() * sizeof(uint32_t)) == 0);
+		}
+	};
+
+	struct ShapeCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapeCacheKey &p_a) {
+			return p_a.hash;
+		}
+	};
+
+	struct ShapeCacheData {
+		Vector<hb_glyph_info_t> info; // Clusters are relative to the run start.
+		Vector<hb_glyph_position_t> pos;
+		uint64_t last_used = 0;
+	};
+
+	const int SHAPE_CACHE_MAX_SIZE = 4096;
+	const int SHAPE_CACHE_CONTEXT_LENGTH = 5; // Same as HB_BUFFER_CONTEXT_LENGTH.
+
+	Mutex shape_cache_mutex;
+	HashMap<ShapeCacheKey, ShapeCacheData, ShapeCacheKeyHasher> shape_cache;
+	uint64_t shape_cache_tick = 0;
+	uint64_t shape_cache_last_font_id = 0;
+
+	bool _shape_cache_get(const ShapeCacheKey &p_key, int64_t p_start, Vector<hb_glyph_info_t> &r_info, Vector<hb_glyph_position_t> &r_pos);
+	void _shape_cache_add(const ShapeCacheKey &p_key, int64_t p_start, const hb_glyph_info_t *p_info, const hb_glyph_position_t *p_pos, unsigned int p_count);
+
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
@@ -31,6 +31,7 @@
 #include "video_stream_theora.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "scene/resources/image_texture.h"
 
@@ -91,24 +92,44 @@ int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
 	return 0;
 }
 
+void VideoStreamPlaybackTheora::_yuv_to_rgba_band(uint32_t p_band, const YUVFrame *p_frame) {
+	const int from = p_band * YUV_BAND_HEIGHT;
+	const int rows = MIN(int(YUV_BAND_HEIGHT), size.y - from);
+	const th_img_plane *planes = p_frame->yuv;
+	const int chroma_from = px_fmt == TH_PF_420 ? from >> 1 : from;
+
+	uint8_t *dst = p_frame->dst + from * (size.x << 2);
+	const uint8_t *y = planes[0].data + from * planes[0].stride;
+	const uint8_t *u = planes[1].data + chroma_from * planes[1].stride;
+	const uint8_t *v = planes[2].data + chroma_from * planes[2].stride;
+
+	if (px_fmt == TH_PF_444) {
+		yuv444_2_rgb8888(dst, y, u, v, size.x, rows, planes[0].stride, planes[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_422) {
+		yuv422_2_rgb8888(dst, y, u, v, size.x, rows, planes[0].stride, planes[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_420) {
+		yuv420_2_rgb8888(dst, y, u, v, size.x, rows, planes[0].stride, planes[1].stride, size.x << 2);
+	}
+}
+
 void VideoStreamPlaybackTheora::video_write() {
-	th_ycbcr_buffer yuv;
-	th_decode_ycbcr_out(td, yuv);
+	YUVFrame frame;
+	th_decode_ycbcr_out(td, frame.yuv);
 
 	int pitch = 4;
 	frame_data.resize(size.x * size.y * pitch);
 	{
-		uint8_t *w = frame_data.ptrw();
-		char *dst = (char *)w;
-
-		if (px_fmt == TH_PF_444) {
-			yuv444_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+		frame.dst = frame_data.ptrw();
 
-		} else if (px_fmt == TH_PF_422) {
-			yuv422_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_420) {
-			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+		// The conversion has no state, so the frame is converted in horizontal bands on the WorkerThreadPool.
+		const int band_count = (size.y + YUV_BAND_HEIGHT - 1) / YUV_BAND_HEIGHT;
+		if (band_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &VideoStreamPlaybackTheora::_yuv_to_rgba_band, &frame, band_count, -1, true, SNAME("TheoraYUVToRGBA"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_yuv_to_rgba_band(0, &frame);
 		}
 
 		format = Image::FORMAT_RGBA8;
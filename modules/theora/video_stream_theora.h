@@ -52,6 +52,12 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 
 	enum {
 		MAX_FRAMES = 4,
+		YUV_BAND_HEIGHT = 16, // Must be even, so 4:2:0 chroma rows aren't split between bands.
+	};
+
+	struct YUVFrame {
+		th_ycbcr_buffer yuv;
+		uint8_t *dst = nullptr;
 	};
 
 	//Image frames[MAX_FRAMES];
@@ -66,6 +72,7 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	int buffer_data();
 	int queue_page(ogg_page *page);
 	void video_write();
+	void _yuv_to_rgba_band(uint32_t p_band, const YUVFrame *p_frame);
 	double get_time() const;
 
 	bool theora_eos = false;
@@ -116,7 +116,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -129,7 +129,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (use_loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -231,19 +231,16 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
-	loop_fade_remaining = FADE_SIZE;
-	active = true;
-	seek(p_from_pos);
-	loops = 0;
+	start_decoder(p_from_pos);
 	begin_resample();
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
-	active = false;
+	stop_decoder();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	return is_decoder_playing(active);
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
@@ -251,7 +248,7 @@ int AudioStreamPlaybackOggVorbis::get_loop_count() const {
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	return MAX(0.0, double(frames_mixed) / (double)vorbis_data->get_sampling_rate() - get_decoded_time());
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -278,6 +275,25 @@ Variant AudioStreamPlaybackOggVorbis::get_parameter(const StringName &p_name) co
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	seek_decoder(p_time);
+}
+
+void AudioStreamPlaybackOggVorbis::_start_decoder(double p_from_pos) {
+	loop_fade_remaining = FADE_SIZE;
+	active = true;
+	_seek(p_from_pos);
+	loops = 0;
+}
+
+void AudioStreamPlaybackOggVorbis::_seek_decoder(double p_time) {
+	_seek(p_time);
+}
+
+void AudioStreamPlaybackOggVorbis::_stop_decoder() {
+	active = false;
+}
+
+void AudioStreamPlaybackOggVorbis::_seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -419,6 +435,7 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->active = false;
 	ovs->loops = 0;
 	if (ovs->_alloc_vorbis()) {
+		ovs->set_background_decode(true);
 		return ovs;
 	}
 	// Failed to allocate data structures.
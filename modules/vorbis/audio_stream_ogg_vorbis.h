@@ -84,9 +84,14 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
 
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
+	virtual void _start_decoder(double p_from_pos) override;
+	virtual void _seek_decoder(double p_time) override;
+	virtual void _stop_decoder() override;
 
 public:
 	virtual void start(double p_from_pos = 0.0) override;
@@ -31,12 +31,17 @@
 #ifndef PACKET_BUFFER_H
 #define PACKET_BUFFER_H
 
-#include "core/templates/ring_buffer.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
 
+// Queue of packets sharing a circular payload buffer. Each payload is stored
+// contiguously (wrapping to the start of the buffer when it doesn't fit at the
+// end), so packets can be read in place with read_packet_ptr().
 template <typename T>
 class PacketBuffer {
 private:
 	typedef struct {
+		uint32_t offset;
 		uint32_t size;
 		T info;
 	} _Packet;
@@ -45,71 +50,119 @@ private:
 	int _queued = 0;
 	int _write_pos = 0;
 	int _read_pos = 0;
-	RingBuffer<uint8_t> _payload;
+	LocalVector<uint8_t> _payload;
+	uint32_t _payload_write = 0;
+	uint32_t _payload_used = 0;
+
+	bool _find_space(uint32_t p_size, uint32_t &r_offset) const {
+		const uint32_t capacity = _payload.size();
+		if (_queued == 0) {
+			r_offset = 0;
+			return p_size <= capacity;
+		}
+		const uint32_t tail = _packets[_read_pos].offset;
+		if (_payload_write > tail || _payload_used == 0) {
+			if (capacity - _payload_write >= p_size) {
+				r_offset = _payload_write;
+				return true;
+			}
+			// Skip the end of the buffer.
+			r_offset = 0;
+			return p_size <= tail;
+		}
+		r_offset = _payload_write;
+		return tail - _payload_write >= p_size;
+	}
+
+	void _pop(_Packet &r_packet) {
+		r_packet = _packets[_read_pos];
+		_read_pos += 1;
+		if (_read_pos >= _packets.size()) {
+			_read_pos = 0;
+		}
+		_queued -= 1;
+		_payload_used -= r_packet.size;
+	}
 
 public:
 	Error write_packet(const uint8_t *p_payload, uint32_t p_size, const T *p_info) {
-		ERR_FAIL_COND_V_MSG(p_payload && (uint32_t)_payload.space_left() < p_size, ERR_OUT_OF_MEMORY, "Buffer payload full! Dropping data.");
-		ERR_FAIL_COND_V_MSG(p_info && _queued >= _packets.size(), ERR_OUT_OF_MEMORY, "Too many packets in queue! Dropping data.");
-
-		// If p_info is nullptr, only the payload is written
-		if (p_info) {
-			ERR_FAIL_COND_V(_write_pos > _packets.size(), ERR_OUT_OF_MEMORY);
-			_Packet p;
-			p.size = p_size;
-			p.info = *p_info;
-			_packets.write[_write_pos] = p;
-			_queued += 1;
-			_write_pos++;
-			if (_write_pos >= _packets.size()) {
-				_write_pos = 0;
-			}
+		ERR_FAIL_NULL_V(p_info, ERR_INVALID_PARAMETER);
+		ERR_FAIL_COND_V(p_size && !p_payload, ERR_INVALID_PARAMETER);
+		ERR_FAIL_COND_V_MSG(_queued >= _packets.size(), ERR_OUT_OF_MEMORY, "Too many packets in queue! Dropping data.");
+		uint32_t offset = 0;
+		ERR_FAIL_COND_V_MSG(!_find_space(p_size, offset), ERR_OUT_OF_MEMORY, "Buffer payload full! Dropping data.");
+
+		_Packet p;
+		p.offset = offset;
+		p.size = p_size;
+		p.info = *p_info;
+		_packets.write[_write_pos] = p;
+		_queued += 1;
+		_write_pos++;
+		if (_write_pos >= _packets.size()) {
+			_write_pos = 0;
 		}
 
-		// If p_payload is nullptr, only the packet information is written.
-		if (p_payload) {
-			_payload.write((const uint8_t *)p_payload, p_size);
+		if (p_size) {
+			memcpy(_payload.ptr() + offset, p_payload, p_size);
 		}
-
+		_payload_write = offset + p_size;
+		_payload_used += p_size;
 		return OK;
 	}
 
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
 		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
-		_Packet p = _packets[_read_pos];
-		_read_pos += 1;
-		if (_read_pos >= _packets.size()) {
-			_read_pos = 0;
+		ERR_FAIL_COND_V(p_bytes < (int)_packets[_read_pos].size, ERR_OUT_OF_MEMORY);
+		_Packet p;
+		_pop(p);
+
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		if (p.size) {
+			memcpy(r_payload, _payload.ptr() + p.offset, p.size);
 		}
-		_queued -= 1;
+		return OK;
+	}
 
-		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
-		ERR_FAIL_COND_V(p_bytes < (int)p.size, ERR_OUT_OF_MEMORY);
+	// The returned payload stays valid until the next write.
+	Error read_packet_ptr(const uint8_t **r_payload, T *r_info, int &r_read) {
+		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
+		_Packet p;
+		_pop(p);
 
 		r_read = p.size;
 		memcpy(r_info, &p.info, sizeof(T));
-		_payload.read(r_payload, p.size);
+		*r_payload = _payload.ptr() + p.offset;
 		return OK;
 	}
 
 	void resize(int p_buf_shift, int p_max_packets) {
-		_payload.resize(p_buf_shift);
+		_payload.resize(1 << p_buf_shift);
 		_packets.resize(p_max_packets);
 		_read_pos = 0;
 		_write_pos = 0;
 		_queued = 0;
+		_payload_write = 0;
+		_payload_used = 0;
 	}
 
 	int packets_left() const {
 		return _queued;
 	}
 
+	int payload_capacity() const {
+		return _payload.size();
+	}
+
 	void clear() {
-		_payload.resize(0);
+		_payload.reset();
 		_packets.resize(0);
 		_read_pos = 0;
 		_write_pos = 0;
 		_queued = 0;
+		_payload_write = 0;
+		_payload_used = 0;
 	}
 
 	PacketBuffer() {
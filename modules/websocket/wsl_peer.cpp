@@ -297,7 +297,7 @@ Error WSLPeer::_do_server_handshake() {
 			wslay_event_context_server_init(&wsl_ctx, &_wsl_callbacks, this);
 			wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
 			in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
-			packet_buffer.resize(inbound_buffer_size);
+			out_buffer.resize(OUT_BUFFER_SIZE);
 			ready_state = STATE_OPEN;
 		}
 	}
@@ -405,7 +405,7 @@ void WSLPeer::_do_client_handshake() {
 				wslay_event_context_client_init(&wsl_ctx, &_wsl_callbacks, this);
 				wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
 				in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
-				packet_buffer.resize(inbound_buffer_size);
+				out_buffer.resize(OUT_BUFFER_SIZE);
 				ready_state = STATE_OPEN;
 				break;
 			}
@@ -680,7 +680,7 @@ void WSLPeer::poll() {
 	if (ready_state == STATE_OPEN || ready_state == STATE_CLOSING) {
 		ERR_FAIL_NULL(wsl_ctx);
 		int err = 0;
-		if ((err = wslay_event_recv(wsl_ctx)) != 0 || (err = wslay_event_send(wsl_ctx)) != 0) {
+		if ((err = wslay_event_recv(wsl_ctx)) != 0 || (err = _flush_send()) != 0) {
 			// Error close.
 			print_verbose("Websocket (wslay) poll error: " + itos(err));
 			wslay_event_context_free(wsl_ctx);
@@ -688,7 +688,7 @@ void WSLPeer::poll() {
 			close(-1);
 			return;
 		}
-		if (wslay_event_get_close_sent(wsl_ctx) && wslay_event_get_close_received(wsl_ctx)) {
+		if (wslay_event_get_close_sent(wsl_ctx) && wslay_event_get_close_received(wsl_ctx) && out_pos == out_size) {
 			// Clean close.
 			wslay_event_context_free(wsl_ctx);
 			wsl_ctx = nullptr;
@@ -701,7 +701,7 @@ void WSLPeer::poll() {
 Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode) {
 	ERR_FAIL_COND_V(ready_state != STATE_OPEN, FAILED);
 	ERR_FAIL_COND_V(wslay_event_get_queued_msg_count(wsl_ctx) >= (uint32_t)max_queued_packets, ERR_OUT_OF_MEMORY);
-	ERR_FAIL_COND_V(outbound_buffer_size > 0 && (wslay_event_get_queued_msg_length(wsl_ctx) + p_buffer_size > (uint32_t)outbound_buffer_size), ERR_OUT_OF_MEMORY);
+	ERR_FAIL_COND_V(outbound_buffer_size > 0 && (wslay_event_get_queued_msg_length(wsl_ctx) + (out_size - out_pos) + p_buffer_size > (uint32_t)outbound_buffer_size), ERR_OUT_OF_MEMORY);
 
 	struct wslay_event_msg msg;
 	msg.opcode = p_opcode;
@@ -709,13 +709,44 @@ Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_
 	msg.msg_length = p_buffer_size;
 
 	// Queue & send message.
-	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || wslay_event_send(wsl_ctx) != 0) {
+	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || _flush_send() != 0) {
 		close(-1);
 		return FAILED;
 	}
 	return OK;
 }
 
+int WSLPeer::_flush_send() {
+	// Rather than sending each frame header and payload separately through the
+	// send callback, let wslay serialize all the queued frames into out_buffer.
+	if (connection.is_null()) {
+		return WSLAY_ERR_CALLBACK_FAILURE;
+	}
+	while (true) {
+		if (out_pos < out_size) {
+			int sent = 0;
+			Error err = connection->put_partial_data(out_buffer.ptr() + out_pos, out_size - out_pos, sent);
+			if (err != OK) {
+				return WSLAY_ERR_CALLBACK_FAILURE;
+			}
+			out_pos += sent;
+			if (out_pos < out_size) {
+				return 0; // Would block, try again on next poll.
+			}
+		}
+		out_pos = 0;
+		out_size = 0;
+		if (!wslay_event_want_write(wsl_ctx)) {
+			return 0;
+		}
+		ssize_t written = wslay_event_write(wsl_ctx, out_buffer.ptr(), out_buffer.size());
+		if (written <= 0) {
+			return (int)written;
+		}
+		out_size = written;
+	}
+}
+
 Error WSLPeer::send(const uint8_t *p_buffer, int p_buffer_size, WriteMode p_mode) {
 	wslay_opcode opcode = p_mode == WRITE_MODE_TEXT ? WSLAY_TEXT_FRAME : WSLAY_BINARY_FRAME;
 	return _send(p_buffer, p_buffer_size, opcode);
@@ -734,11 +765,9 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 		return ERR_UNAVAILABLE;
 	}
 
+	// The payload is handed out in place, it stays valid until the next poll.
 	int read = 0;
-	uint8_t *rw = packet_buffer.ptrw();
-	in_buffer.read_packet(rw, packet_buffer.size(), &was_string, read);
-
-	*r_buffer = rw;
+	in_buffer.read_packet_ptr(r_buffer, &was_string, read);
 	r_buffer_size = read;
 
 	return OK;
@@ -757,7 +786,7 @@ int WSLPeer::get_current_outbound_buffered_amount() const {
 		return 0;
 	}
 
-	return wslay_event_get_queued_msg_length(wsl_ctx);
+	return wslay_event_get_queued_msg_length(wsl_ctx) + (out_size - out_pos);
 }
 
 void WSLPeer::close(int p_code, String p_reason) {
@@ -769,7 +798,7 @@ void WSLPeer::close(int p_code, String p_reason) {
 	if (ready_state == STATE_OPEN && !wslay_event_get_close_sent(wsl_ctx)) {
 		CharString cs = p_reason.utf8();
 		wslay_event_queue_close(wsl_ctx, p_code, (uint8_t *)cs.ptr(), cs.length());
-		wslay_event_send(wsl_ctx);
+		_flush_send();
 		ready_state = STATE_CLOSING;
 	} else if (ready_state == STATE_CONNECTING || ready_state == STATE_CLOSED) {
 		ready_state = STATE_CLOSED;
@@ -781,7 +810,6 @@ void WSLPeer::close(int p_code, String p_reason) {
 	}
 
 	in_buffer.clear();
-	packet_buffer.resize(0);
 }
 
 IPAddress WSLPeer::get_connected_host() const {
@@ -832,7 +860,9 @@ void WSLPeer::_clear() {
 	// Pending packets info.
 	was_string = 0;
 	in_buffer.clear();
-	packet_buffer.clear();
+	out_buffer.reset();
+	out_pos = 0;
+	out_size = 0;
 
 	// Close code info.
 	close_code = -1;
@@ -40,7 +40,7 @@
 #include "core/error/error_list.h"
 #include "core/io/packet_peer.h"
 #include "core/io/stream_peer_tcp.h"
-#include "core/templates/ring_buffer.h"
+#include "core/templates/local_vector.h"
 
 #include <wslay/wslay.h>
 
@@ -105,11 +105,17 @@ private:
 	Ref<TLSOptions> tls_options;
 
 	// Packet buffers.
-	Vector<uint8_t> packet_buffer;
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
 	PacketBuffer<uint8_t> in_buffer;
 
+	// Queued frames are written here by wslay, then sent in as few writes as possible.
+	static constexpr int OUT_BUFFER_SIZE = 65536;
+	LocalVector<uint8_t> out_buffer;
+	int out_pos = 0;
+	int out_size = 0;
+
 	Error _send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode);
+	int _flush_send();
 
 	Error _do_server_handshake();
 	bool _parse_client_request();
@@ -127,7 +133,7 @@ public:
 	virtual int get_available_packet_count() const override;
 	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override;
 	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override;
-	virtual int get_max_packet_size() const override { return packet_buffer.size(); };
+	virtual int get_max_packet_size() const override { return in_buffer.payload_capacity(); };
 
 	// WebSocketPeer
 	virtual Error send(const uint8_t *p_buffer, int p_buffer_size, WriteMode p_mode) override;
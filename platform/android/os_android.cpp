@@ -755,18 +755,24 @@ String OS_Android::get_config_path() const {
 }
 
 void OS_Android::benchmark_begin_measure(const String &p_context, const String &p_what) {
+	_startup_trace_begin(p_context, p_what);
+
 #ifdef TOOLS_ENABLED
 	godot_java->begin_benchmark_measure(p_context, p_what);
 #endif
 }
 
 void OS_Android::benchmark_end_measure(const String &p_context, const String &p_what) {
+	_startup_trace_end(p_context, p_what);
+
 #ifdef TOOLS_ENABLED
 	godot_java->end_benchmark_measure(p_context, p_what);
 #endif
 }
 
 void OS_Android::benchmark_dump() {
+	_startup_trace_dump();
+
 #ifdef TOOLS_ENABLED
 	if (!is_use_benchmark_set()) {
 		return;
@@ -134,6 +134,9 @@ public:
 	void set_max_polyphony(int p_max_polyphony);
 	int get_max_polyphony() const;
 
+	void set_voice_priority(int p_voice_priority);
+	int get_voice_priority() const;
+
 	void set_panning_strength(float p_panning_strength);
 	float get_panning_strength() const;
 
@@ -99,6 +99,23 @@ private:
 		uint32_t seed = 0;
 	};
 
+	// Set by the serial emission pass of _particles_process(), read by _particle_process_step().
+	struct ParticleStep {
+		double delta = 0.0;
+		float tv = 0.0;
+		bool advance = false;
+		bool process = false;
+	};
+
+	struct ParticleProcessData {
+		Particle *particles = nullptr;
+		const ParticleStep *steps = nullptr;
+		Vector2 emission_origin;
+	};
+
+	static constexpr int PARALLEL_PROCESS_MIN_PARTICLES = 256;
+	LocalVector<ParticleStep> particle_steps;
+
 	double time = 0.0;
 	double frame_remainder = 0.0;
 	int cycle = 0;
@@ -178,6 +195,7 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particle_process_step(uint32_t p_index, const ParticleProcessData *p_data);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
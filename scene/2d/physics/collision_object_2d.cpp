@@ -30,6 +30,7 @@
 
 #include "collision_object_2d.h"
 
+#include "scene/main/viewport.h"
 #include "scene/resources/world_2d.h"
 
 void CollisionObject2D::_notification(int p_what) {
@@ -77,6 +78,10 @@ void CollisionObject2D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			if (pickable) {
+				Viewport::notify_physics_picking_changed();
+			}
+
 			if (only_update_transform_changes) {
 				return;
 			}
@@ -91,6 +96,8 @@ void CollisionObject2D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			Viewport::notify_physics_picking_changed();
+
 			bool disabled = !is_enabled();
 
 			if (!disabled || (disable_mode != DISABLE_MODE_REMOVE)) {
@@ -130,10 +137,14 @@ void CollisionObject2D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_DISABLED: {
+			Viewport::notify_physics_picking_changed();
+
 			_apply_disabled();
 		} break;
 
 		case NOTIFICATION_ENABLED: {
+			Viewport::notify_physics_picking_changed();
+
 			_apply_enabled();
 		} break;
 	}
@@ -318,6 +329,7 @@ void CollisionObject2D::remove_shape_owner(uint32_t owner) {
 
 void CollisionObject2D::shape_owner_set_disabled(uint32_t p_owner, bool p_disabled) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 	sd.disabled = p_disabled;
@@ -393,6 +405,7 @@ PackedInt32Array CollisionObject2D::_get_shape_owners() {
 
 void CollisionObject2D::shape_owner_set_transform(uint32_t p_owner, const Transform2D &p_transform) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 
@@ -421,6 +434,7 @@ Object *CollisionObject2D::shape_owner_get_owner(uint32_t p_owner) const {
 void CollisionObject2D::shape_owner_add_shape(uint32_t p_owner, const Ref<Shape2D> &p_shape) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_COND(p_shape.is_null());
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 	ShapeData::Shape s;
@@ -459,6 +473,7 @@ int CollisionObject2D::shape_owner_get_shape_index(uint32_t p_owner, int p_shape
 void CollisionObject2D::shape_owner_remove_shape(uint32_t p_owner, int p_shape) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_INDEX(p_shape, shapes[p_owner].shapes.size());
+	Viewport::notify_physics_picking_changed();
 
 	int index_to_remove = shapes[p_owner].shapes[p_shape].index;
 	if (area) {
@@ -573,6 +588,8 @@ void CollisionObject2D::_update_pickable() {
 		return;
 	}
 
+	Viewport::notify_physics_picking_changed();
+
 	bool is_pickable = pickable && is_visible_in_tree();
 	if (area) {
 		PhysicsServer2D::get_singleton()->area_set_pickable(rid, is_pickable);
@@ -687,23 +687,54 @@ void TileMapLayer::_rendering_draw_cell_debug(const RID &p_canvas_item, const Ve
 void TileMapLayer::_physics_update(bool p_force_cleanup) {
 	// Check if we should cleanup everything.
 	bool forced_cleanup = p_force_cleanup || !enabled || !collision_enabled || !is_inside_tree() || tile_set.is_null();
-	if (forced_cleanup) {
+	if (forced_cleanup || dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE]) {
 		// Clean everything.
 		for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
 			_physics_clear_cell(kv.value);
 		}
-	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
+		_physics_clear_quadrants();
+	}
+
+	if (!forced_cleanup) {
+		// With quadrants, cells only get assigned to them here. Bodies are rebuilt per quadrant afterwards.
+		SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
+		bool use_quadrants = physics_quadrant_size > 1;
+
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE] || dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				_physics_update_cell(kv.value);
+				if (use_quadrants) {
+					_physics_quadrants_update_cell(kv.value, dirty_physics_quadrant_list);
+				} else {
+					_physics_update_cell(kv.value);
+				}
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_physics_update_cell(cell_data);
+				if (use_quadrants) {
+					_physics_quadrants_update_cell(cell_data, dirty_physics_quadrant_list);
+				} else {
+					_physics_update_cell(cell_data);
+				}
+			}
+		}
+
+		// Rebuild the bodies of dirty quadrants.
+		for (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first(); quadrant_list_element;) {
+			SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next();
+			Ref<PhysicsQuadrant> physics_quadrant = quadrant_list_element->self();
+			dirty_physics_quadrant_list.remove(quadrant_list_element);
+
+			if (physics_quadrant->cells.first()) {
+				_physics_update_quadrant(**physics_quadrant);
+			} else {
+				_physics_clear_quadrant(**physics_quadrant);
+				physics_quadrant_map.erase(physics_quadrant->quadrant_coords);
 			}
+
+			quadrant_list_element = next_quadrant_list_element;
 		}
 	}
 
@@ -731,6 +762,13 @@ void TileMapLayer::_physics_notification(int p_what) {
 						}
 					}
 				}
+
+				// Quadrant bodies sit at the layer's origin, their shapes carry the tile positions.
+				for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_TRANSFORM, gl_transform);
+					}
+				}
 			}
 			break;
 		case NOTIFICATION_ENTER_TREE:
@@ -747,6 +785,12 @@ void TileMapLayer::_physics_notification(int p_what) {
 						}
 					}
 				}
+
+				for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						ps->body_set_space(body.rid, space);
+					}
+				}
 			}
 	}
 }
@@ -878,6 +922,244 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	_physics_clear_cell(r_cell_data);
 }
 
+void TileMapLayer::_physics_clear_quadrants() {
+	for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+		for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			cell_data_list_element->self()->physics_quadrant = Ref<PhysicsQuadrant>();
+		}
+		kv.value->cells.clear();
+		_physics_clear_quadrant(**kv.value);
+	}
+	physics_quadrant_map.clear();
+}
+
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
+	// Check if the cell is valid.
+	bool is_valid = false;
+	if (tile_set->has_source(r_cell_data.cell.source_id)) {
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(r_cell_data.cell.source_id));
+		is_valid = atlas_source && atlas_source->has_tile(r_cell_data.cell.get_atlas_coords()) && atlas_source->has_alternative_tile(r_cell_data.cell.get_atlas_coords(), r_cell_data.cell.alternative_tile);
+	}
+
+	// Mark the old quadrant as dirty, then remove the cell from it.
+	Ref<PhysicsQuadrant> old_physics_quadrant = r_cell_data.physics_quadrant;
+	if (old_physics_quadrant.is_valid()) {
+		if (!old_physics_quadrant->dirty_quadrant_list_element.in_list()) {
+			r_dirty_physics_quadrant_list.add(&old_physics_quadrant->dirty_quadrant_list_element);
+		}
+		if (r_cell_data.physics_quadrant_list_element.in_list()) {
+			old_physics_quadrant->cells.remove(&r_cell_data.physics_quadrant_list_element);
+		}
+		r_cell_data.physics_quadrant = Ref<PhysicsQuadrant>();
+	}
+
+	if (!is_valid) {
+		return;
+	}
+
+	// Rounding down, instead of simply rounding towards zero (truncating).
+	const Vector2i &coords = r_cell_data.coords;
+	Vector2i quadrant_coords = Vector2i(
+			coords.x > 0 ? coords.x / physics_quadrant_size : (coords.x - (physics_quadrant_size - 1)) / physics_quadrant_size,
+			coords.y > 0 ? coords.y / physics_quadrant_size : (coords.y - (physics_quadrant_size - 1)) / physics_quadrant_size);
+
+	Ref<PhysicsQuadrant> physics_quadrant;
+	Ref<PhysicsQuadrant> *found = physics_quadrant_map.getptr(quadrant_coords);
+	if (found) {
+		physics_quadrant = *found;
+	} else {
+		physics_quadrant.instantiate();
+		physics_quadrant->quadrant_coords = quadrant_coords;
+		physics_quadrant_map[quadrant_coords] = physics_quadrant;
+	}
+
+	r_cell_data.physics_quadrant = physics_quadrant;
+	physics_quadrant->cells.add(&r_cell_data.physics_quadrant_list_element);
+
+	if (!physics_quadrant->dirty_quadrant_list_element.in_list()) {
+		r_dirty_physics_quadrant_list.add(&physics_quadrant->dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(PhysicsQuadrant &r_physics_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	for (const PhysicsQuadrant::Body &body : r_physics_quadrant.bodies) {
+		bodies_coords.erase(body.rid);
+		ps->free(body.rid);
+	}
+	r_physics_quadrant.bodies.clear();
+
+	for (const RID &shape : r_physics_quadrant.merged_shapes) {
+		ps->free(shape);
+	}
+	r_physics_quadrant.merged_shapes.clear();
+}
+
+RID TileMapLayer::_physics_get_quadrant_body(PhysicsQuadrant &r_physics_quadrant, int p_physics_layer, const TileData *p_tile_data) {
+	const Vector2 linear_velocity = p_tile_data->get_constant_linear_velocity(p_physics_layer);
+	const real_t angular_velocity = p_tile_data->get_constant_angular_velocity(p_physics_layer);
+	for (const PhysicsQuadrant::Body &body : r_physics_quadrant.bodies) {
+		if (body.physics_layer == p_physics_layer && body.linear_velocity == linear_velocity && body.angular_velocity == angular_velocity) {
+			return body.rid;
+		}
+	}
+
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(p_physics_layer);
+
+	RID body = ps->body_create();
+	bodies_coords[body] = r_physics_quadrant.quadrant_coords * physics_quadrant_size;
+	ps->body_set_mode(body, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(body, get_world_2d()->get_space());
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, get_global_transform());
+	ps->body_attach_object_instance_id(body, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
+	ps->body_set_collision_layer(body, tile_set->get_physics_layer_collision_layer(p_physics_layer));
+	ps->body_set_collision_mask(body, tile_set->get_physics_layer_collision_mask(p_physics_layer));
+	ps->body_set_pickable(body, false);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, linear_velocity);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, angular_velocity);
+
+	if (!physics_material.is_valid()) {
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+	} else {
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+		ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+	}
+
+	PhysicsQuadrant::Body quadrant_body;
+	quadrant_body.rid = body;
+	quadrant_body.physics_layer = p_physics_layer;
+	quadrant_body.linear_velocity = linear_velocity;
+	quadrant_body.angular_velocity = angular_velocity;
+	r_physics_quadrant.bodies.push_back(quadrant_body);
+	return body;
+}
+
+// True if the tile collides with a single, two-way polygon covering exactly its square cell.
+static bool _is_tile_collision_full_square(const TileData *p_tile_data, int p_physics_layer, const Vector2 &p_half_tile_size) {
+	if (p_tile_data->get_collision_polygons_count(p_physics_layer) != 1 || p_tile_data->is_collision_polygon_one_way(p_physics_layer, 0)) {
+		return false;
+	}
+
+	const Vector<Vector2> points = p_tile_data->get_collision_polygon_points(p_physics_layer, 0);
+	if (points.size() != 4) {
+		return false;
+	}
+
+	int corners = 0;
+	for (const Vector2 &point : points) {
+		if (!Math::is_equal_approx(Math::abs(point.x), p_half_tile_size.x) || !Math::is_equal_approx(Math::abs(point.y), p_half_tile_size.y)) {
+			return false;
+		}
+		corners |= 1 << ((point.x > 0 ? 1 : 0) + (point.y > 0 ? 2 : 0));
+	}
+	return corners == 0b1111;
+}
+
+void TileMapLayer::_physics_update_quadrant(PhysicsQuadrant &r_physics_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	_physics_clear_quadrant(r_physics_quadrant);
+
+	// Fully solid tiles of square tile sets are merged into rectangles, so large solid areas don't flood the broadphase.
+	const bool merge_full_tiles = tile_set->get_tile_shape() == TileSet::TILE_SHAPE_SQUARE;
+	const Vector2 tile_size = tile_set->get_tile_size();
+
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		HashMap<RID, HashSet<Vector2i>> full_tiles;
+
+		for (SelfList<CellData> *cell_data_list_element = r_physics_quadrant.cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			const CellData &cell_data = *cell_data_list_element->self();
+			const TileMapCell &c = cell_data.cell;
+
+			const TileData *tile_data = cell_data.runtime_tile_data_cache;
+			if (!tile_data) {
+				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+				tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+			}
+
+			int polygons_count = tile_data->get_collision_polygons_count(tile_set_physics_layer);
+			if (polygons_count == 0) {
+				continue;
+			}
+
+			RID body = _physics_get_quadrant_body(r_physics_quadrant, tile_set_physics_layer, tile_data);
+			if (merge_full_tiles && _is_tile_collision_full_square(tile_data, tile_set_physics_layer, tile_size * 0.5)) {
+				full_tiles[body].insert(cell_data.coords);
+				continue;
+			}
+
+			// Transform flags.
+			bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+			bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+			bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+
+			Transform2D shape_xform(0, tile_set->map_to_local(cell_data.coords));
+			for (int polygon_index = 0; polygon_index < polygons_count; polygon_index++) {
+				bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+				float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+				int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+				for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
+					ps->body_add_shape(body, shape->get_rid(), shape_xform);
+					ps->body_set_shape_as_one_way_collision(body, ps->body_get_shape_count(body) - 1, one_way_collision, one_way_collision_margin);
+				}
+			}
+		}
+
+		// Greedily cover the full tiles with rectangles: grow a column first, then widen it while whole columns fit.
+		for (KeyValue<RID, HashSet<Vector2i>> &kv : full_tiles) {
+			HashSet<Vector2i> &remaining = kv.value;
+			LocalVector<Vector2i> sorted_coords;
+			for (const Vector2i &coords : remaining) {
+				sorted_coords.push_back(coords);
+			}
+			sorted_coords.sort();
+
+			for (const Vector2i &origin : sorted_coords) {
+				if (!remaining.has(origin)) {
+					continue;
+				}
+
+				int height = 1;
+				while (remaining.has(origin + Vector2i(0, height))) {
+					height++;
+				}
+
+				int width = 1;
+				while (true) {
+					bool column_full = true;
+					for (int y = 0; y < height; y++) {
+						if (!remaining.has(origin + Vector2i(width, y))) {
+							column_full = false;
+							break;
+						}
+					}
+					if (!column_full) {
+						break;
+					}
+					width++;
+				}
+
+				for (int x = 0; x < width; x++) {
+					for (int y = 0; y < height; y++) {
+						remaining.erase(origin + Vector2i(x, y));
+					}
+				}
+
+				RID shape = ps->rectangle_shape_create();
+				ps->shape_set_data(shape, Vector2(width, height) * tile_size * 0.5);
+				r_physics_quadrant.merged_shapes.push_back(shape);
+
+				Vector2 center = (tile_set->map_to_local(origin) + tile_set->map_to_local(origin + Vector2i(width - 1, height - 1))) * 0.5;
+				ps->body_add_shape(kv.key, shape, Transform2D(0, center));
+			}
+		}
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data) {
 	// Draw the debug collision shapes.
@@ -929,6 +1211,33 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
 		}
 	}
+
+	// Cells merged into a physics quadrant have no body of their own, draw their collision polygons instead.
+	if (r_cell_data.physics_quadrant.is_valid()) {
+		const TileData *tile_data = r_cell_data.runtime_tile_data_cache;
+		if (!tile_data) {
+			tile_data = get_cell_tile_data(r_cell_data.coords);
+		}
+		if (!tile_data) {
+			return;
+		}
+
+		const TileMapCell &c = r_cell_data.cell;
+		bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+		bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+		bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+
+		rs->canvas_item_add_set_transform(p_canvas_item, Transform2D(0, tile_set->map_to_local(r_cell_data.coords) - p_quadrant_pos));
+		for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+			for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+				for (int shape_index = 0; shape_index < tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index); shape_index++) {
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
+					rs->canvas_item_add_polygon(p_canvas_item, shape->get_points(), color);
+				}
+			}
+		}
+		rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
+	}
 };
 #endif // DEBUG_ENABLED
 
@@ -1821,6 +2130,8 @@ void TileMapLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_collision_enabled"), &TileMapLayer::is_collision_enabled);
 	ClassDB::bind_method(D_METHOD("set_use_kinematic_bodies", "use_kinematic_bodies"), &TileMapLayer::set_use_kinematic_bodies);
 	ClassDB::bind_method(D_METHOD("is_using_kinematic_bodies"), &TileMapLayer::is_using_kinematic_bodies);
+	ClassDB::bind_method(D_METHOD("set_physics_quadrant_size", "size"), &TileMapLayer::set_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_physics_quadrant_size"), &TileMapLayer::get_physics_quadrant_size);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "visibility_mode"), &TileMapLayer::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMapLayer::get_collision_visibility_mode);
 
@@ -1845,6 +2156,7 @@ void TileMapLayer::_bind_methods() {
 	ADD_GROUP("Physics", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_enabled"), "set_collision_enabled", "is_collision_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_kinematic_bodies"), "set_use_kinematic_bodies", "is_using_kinematic_bodies");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_quadrant_size"), "set_physics_quadrant_size", "get_physics_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "navigation_enabled"), "set_navigation_enabled", "is_navigation_enabled");
@@ -2930,6 +3242,21 @@ bool TileMapLayer::is_using_kinematic_bodies() const {
 	return use_kinematic_bodies;
 }
 
+void TileMapLayer::set_physics_quadrant_size(int p_size) {
+	if (physics_quadrant_size == p_size) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_size < 1, "Physics quadrant size cannot be smaller than 1.");
+	physics_quadrant_size = p_size;
+	dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+int TileMapLayer::get_physics_quadrant_size() const {
+	return physics_quadrant_size;
+}
+
 void TileMapLayer::set_collision_visibility_mode(TileMapLayer::DebugVisibilityMode p_show_collision) {
 	if (collision_visibility_mode == p_show_collision) {
 		return;
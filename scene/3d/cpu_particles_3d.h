@@ -101,6 +101,23 @@ private:
 		uint32_t seed = 0;
 	};
 
+	// What the serial emission pass decided for each particle.
+	struct ParticleStep {
+		double delta = 0.0;
+		float tv = 0.0;
+		bool advance = false;
+		bool process = false;
+	};
+
+	struct ParticleProcessData {
+		Particle *particles = nullptr;
+		const ParticleStep *steps = nullptr;
+		Vector3 emission_origin;
+	};
+
+	static constexpr int PARALLEL_PROCESS_MIN_PARTICLES = 256;
+	LocalVector<ParticleStep> particle_steps;
+
 	double time = 0.0;
 	double frame_remainder = 0.0;
 	int cycle = 0;
@@ -188,6 +205,7 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particle_process_step(uint32_t p_index, const ParticleProcessData *p_data);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
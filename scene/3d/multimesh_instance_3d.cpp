@@ -30,10 +30,138 @@
 
 #include "multimesh_instance_3d.h"
 
+#include "scene/resources/3d/world_3d.h"
+
+void MultiMeshInstance3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_WORLD: {
+			_build_chunks();
+		} break;
+
+		case NOTIFICATION_EXIT_WORLD: {
+			_clear_chunks();
+		} break;
+
+		case NOTIFICATION_TRANSFORM_CHANGED:
+		case NOTIFICATION_VISIBILITY_CHANGED: {
+			_update_chunk_instances();
+		} break;
+	}
+}
+
 void MultiMeshInstance3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_multimesh", "multimesh"), &MultiMeshInstance3D::set_multimesh);
 	ClassDB::bind_method(D_METHOD("get_multimesh"), &MultiMeshInstance3D::get_multimesh);
+	ClassDB::bind_method(D_METHOD("set_chunk_size", "size"), &MultiMeshInstance3D::set_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_chunk_size"), &MultiMeshInstance3D::get_chunk_size);
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "multimesh", PROPERTY_HINT_RESOURCE_TYPE, "MultiMesh"), "set_multimesh", "get_multimesh");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "chunk_size", PROPERTY_HINT_RANGE, "0,1024,0.01,or_greater,suffix:m"), "set_chunk_size", "get_chunk_size");
+}
+
+void MultiMeshInstance3D::_build_chunks() {
+	_clear_chunks();
+
+	if (chunk_size <= 0.0 || multimesh.is_null() || multimesh->get_mesh().is_null() || multimesh->get_transform_format() != MultiMesh::TRANSFORM_3D || !is_inside_world()) {
+		return;
+	}
+
+	int count = multimesh->get_visible_instance_count();
+	if (count == -1) {
+		count = multimesh->get_instance_count();
+	}
+	if (count == 0) {
+		return;
+	}
+
+	const bool use_colors = multimesh->is_using_colors();
+	const bool use_custom_data = multimesh->is_using_custom_data();
+	const int stride = 12 + (use_colors ? 4 : 0) + (use_custom_data ? 4 : 0);
+
+	const Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid());
+	ERR_FAIL_COND(buffer.size() < count * stride);
+	const float *r = buffer.ptr();
+
+	// Bucket instances by the grid cell their origin falls in.
+	HashMap<Vector3i, LocalVector<int>> cells;
+	for (int i = 0; i < count; i++) {
+		const float *instance_data = r + i * stride;
+		Vector3 origin(instance_data[3], instance_data[7], instance_data[11]);
+		cells[Vector3i((origin / chunk_size).floor())].push_back(i);
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID mesh = multimesh->get_mesh()->get_rid();
+	RID scenario = get_world_3d()->get_scenario();
+
+	for (const KeyValue<Vector3i, LocalVector<int>> &kv : cells) {
+		Vector<float> chunk_buffer;
+		chunk_buffer.resize(kv.value.size() * stride);
+		float *w = chunk_buffer.ptrw();
+		for (uint32_t i = 0; i < kv.value.size(); i++) {
+			memcpy(w + i * stride, r + kv.value[i] * stride, sizeof(float) * stride);
+		}
+
+		Chunk chunk;
+		chunk.multimesh = rs->multimesh_create();
+		rs->multimesh_set_mesh(chunk.multimesh, mesh);
+		rs->multimesh_allocate_data(chunk.multimesh, kv.value.size(), RS::MULTIMESH_TRANSFORM_3D, use_colors, use_custom_data);
+		rs->multimesh_set_buffer(chunk.multimesh, chunk_buffer);
+		chunk.instance = rs->instance_create2(chunk.multimesh, scenario);
+		rs->instance_attach_object_instance_id(chunk.instance, get_instance_id());
+		chunks.push_back(chunk);
+	}
+
+	// The chunks draw everything, the node's own instance would only duplicate it.
+	set_base(RID());
+	_update_chunk_instances();
+}
+
+void MultiMeshInstance3D::_clear_chunks() {
+	if (chunks.is_empty()) {
+		return;
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (const Chunk &chunk : chunks) {
+		rs->free(chunk.instance);
+		rs->free(chunk.multimesh);
+	}
+	chunks.clear();
+
+	set_base(multimesh.is_valid() ? multimesh->get_rid() : RID());
+}
+
+void MultiMeshInstance3D::_update_chunk_instances() {
+	if (chunks.is_empty()) {
+		return;
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const Transform3D global_transform = get_global_transform();
+	const bool visible = is_visible_in_tree();
+	const Ref<Material> override_material = get_material_override();
+	const Ref<Material> overlay_material = get_material_overlay();
+	const GIMode instance_gi_mode = get_gi_mode();
+
+	for (const Chunk &chunk : chunks) {
+		rs->instance_set_transform(chunk.instance, global_transform);
+		rs->instance_set_visible(chunk.instance, visible);
+		rs->instance_set_layer_mask(chunk.instance, get_layer_mask());
+		rs->instance_set_extra_visibility_margin(chunk.instance, get_extra_cull_margin());
+		rs->instance_geometry_set_material_override(chunk.instance, override_material.is_valid() ? override_material->get_rid() : RID());
+		rs->instance_geometry_set_material_overlay(chunk.instance, overlay_material.is_valid() ? overlay_material->get_rid() : RID());
+		rs->instance_geometry_set_transparency(chunk.instance, get_transparency());
+		rs->instance_geometry_set_visibility_range(chunk.instance, get_visibility_range_begin(), get_visibility_range_end(), get_visibility_range_begin_margin(), get_visibility_range_end_margin(), (RS::VisibilityRangeFadeMode)get_visibility_range_fade_mode());
+		rs->instance_geometry_set_cast_shadows_setting(chunk.instance, (RS::ShadowCastingSetting)get_cast_shadows_setting());
+		rs->instance_geometry_set_lod_bias(chunk.instance, get_lod_bias());
+		rs->instance_geometry_set_flag(chunk.instance, RS::INSTANCE_FLAG_USE_BAKED_LIGHT, instance_gi_mode == GI_MODE_STATIC);
+		rs->instance_geometry_set_flag(chunk.instance, RS::INSTANCE_FLAG_USE_DYNAMIC_GI, instance_gi_mode == GI_MODE_DYNAMIC);
+		rs->instance_geometry_set_flag(chunk.instance, RS::INSTANCE_FLAG_IGNORE_OCCLUSION_CULLING, is_ignoring_occlusion_culling());
+	}
+}
+
+void MultiMeshInstance3D::_instance_settings_changed() {
+	_update_chunk_instances();
 }
 
 void MultiMeshInstance3D::set_multimesh(const Ref<MultiMesh> &p_multimesh) {
@@ -43,12 +171,26 @@ void MultiMeshInstance3D::set_multimesh(const Ref<MultiMesh> &p_multimesh) {
 	} else {
 		set_base(RID());
 	}
+	_build_chunks();
 }
 
 Ref<MultiMesh> MultiMeshInstance3D::get_multimesh() const {
 	return multimesh;
 }
 
+void MultiMeshInstance3D::set_chunk_size(real_t p_size) {
+	ERR_FAIL_COND(p_size < 0.0);
+	if (chunk_size == p_size) {
+		return;
+	}
+	chunk_size = p_size;
+	_build_chunks();
+}
+
+real_t MultiMeshInstance3D::get_chunk_size() const {
+	return chunk_size;
+}
+
 Array MultiMeshInstance3D::get_meshes() const {
 	if (multimesh.is_null() || multimesh->get_mesh().is_null() || multimesh->get_transform_format() != MultiMesh::TransformFormat::TRANSFORM_3D) {
 		return Array();
@@ -81,4 +223,5 @@ MultiMeshInstance3D::MultiMeshInstance3D() {
 }
 
 MultiMeshInstance3D::~MultiMeshInstance3D() {
+	_clear_chunks();
 }
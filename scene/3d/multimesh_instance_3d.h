@@ -39,14 +39,33 @@ class MultiMeshInstance3D : public GeometryInstance3D {
 
 	Ref<MultiMesh> multimesh;
 
+	// Spatial chunks of the multimesh, each drawn by its own rendering server instance so it's culled separately.
+	struct Chunk {
+		RID multimesh;
+		RID instance;
+	};
+
+	real_t chunk_size = 0.0;
+	LocalVector<Chunk> chunks;
+
+	void _build_chunks();
+	void _clear_chunks();
+	void _update_chunk_instances();
+
 protected:
+	void _notification(int p_what);
 	static void _bind_methods();
 	// bind helpers
 
+	virtual void _instance_settings_changed() override;
+
 public:
 	void set_multimesh(const Ref<MultiMesh> &p_multimesh);
 	Ref<MultiMesh> get_multimesh() const;
 
+	void set_chunk_size(real_t p_size);
+	real_t get_chunk_size() const;
+
 	Array get_meshes() const;
 
 	virtual AABB get_aabb() const override;
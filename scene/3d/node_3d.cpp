@@ -107,25 +107,62 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// Subtrees that were already made dirty and queued for notification since the last transform flush are skipped,
+	// so moving a node and then its children (or a whole hierarchy, bone by bone) doesn't walk the same nodes again.
+	// Thread groups don't track this, as other threads may be propagating through the same ancestors.
+	const uint64_t pass = is_group_processing() ? 0 : get_tree()->xform_change_pass;
+	if (!_propagate_transform_changed_subtree(pass) && pass) {
+		_invalidate_transform_propagation();
+	}
+}
+
+bool Node3D::_propagate_transform_changed_subtree(uint64_t p_pass) {
+	bool complete = true;
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		if (p_pass && E->data.xform_change_pass == p_pass && E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			continue; // Whole subtree is still dirty and queued.
+		}
+		complete = E->_propagate_transform_changed_subtree(p_pass) && complete;
 	}
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !xform_change.in_list()) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform && !xform_change.in_list()) {
 #endif
-		if (likely(is_accessible_from_caller_thread())) {
+		if (data.ignore_notification) {
+			// Not queued now, so a later change must reach this node again.
+			complete = false;
+		} else if (likely(is_accessible_from_caller_thread())) {
 			get_tree()->xform_change_list.add(&xform_change);
 		} else {
 			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+			complete = false;
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+
+	if (p_pass) {
+		data.xform_change_pass = complete ? p_pass : 0;
+	}
+	return complete;
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	// Called when a node's subtree may no longer be fully queued (for example a node started requesting
+	// notifications or a child entered). Ancestors marked in the current pass must be walked again.
+	data.xform_change_pass = 0;
+	if (!is_inside_tree() || is_group_processing()) {
+		return; // Thread groups discard all passes when they finish.
+	}
+	const uint64_t pass = get_tree()->xform_change_pass;
+	for (Node3D *n = data.parent; n && n->data.xform_change_pass == pass; n = n->data.parent) {
+		n->data.xform_change_pass = 0;
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -158,6 +195,7 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			_invalidate_transform_propagation();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -175,6 +213,7 @@ void Node3D::_notification(int p_what) {
 			}
 			data.parent = nullptr;
 			data.C = nullptr;
+			data.xform_change_pass = 0;
 			_update_visibility_parent(true);
 		} break;
 
@@ -611,6 +650,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -750,6 +790,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_propagation();
 }
 
 void Node3D::set_as_top_level_keep_local(bool p_enabled) {
@@ -758,6 +799,7 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 		return;
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_propagation();
 	_propagate_transform_changed(this);
 }
 
@@ -966,6 +1008,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform) {
+		_invalidate_transform_propagation();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -991,6 +1036,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
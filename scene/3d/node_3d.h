@@ -110,6 +110,8 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		uint64_t xform_change_pass = 0; // SceneTree pass in which this whole subtree was last made dirty and queued.
+
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
 		bool notify_transform = false;
@@ -137,6 +139,8 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	bool _propagate_transform_changed_subtree(uint64_t p_pass);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
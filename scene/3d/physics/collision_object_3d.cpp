@@ -30,6 +30,7 @@
 
 #include "collision_object_3d.h"
 
+#include "scene/main/viewport.h"
 #include "scene/resources/3d/shape_3d.h"
 
 void CollisionObject3D::_notification(int p_what) {
@@ -88,6 +89,10 @@ void CollisionObject3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			if (ray_pickable) {
+				Viewport::notify_physics_picking_changed();
+			}
+
 			if (only_update_transform_changes) {
 				return;
 			}
@@ -106,6 +111,8 @@ void CollisionObject3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			Viewport::notify_physics_picking_changed();
+
 			bool disabled = !is_enabled();
 
 			if (!disabled || (disable_mode != DISABLE_MODE_REMOVE)) {
@@ -127,10 +134,14 @@ void CollisionObject3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_DISABLED: {
+			Viewport::notify_physics_picking_changed();
+
 			_apply_disabled();
 		} break;
 
 		case NOTIFICATION_ENABLED: {
+			Viewport::notify_physics_picking_changed();
+
 			_apply_enabled();
 		} break;
 	}
@@ -335,6 +346,8 @@ void CollisionObject3D::_update_pickable() {
 		return;
 	}
 
+	Viewport::notify_physics_picking_changed();
+
 	bool pickable = ray_pickable && is_visible_in_tree();
 	if (area) {
 		PhysicsServer3D::get_singleton()->area_set_ray_pickable(rid, pickable);
@@ -542,6 +555,7 @@ void CollisionObject3D::remove_shape_owner(uint32_t owner) {
 
 void CollisionObject3D::shape_owner_set_disabled(uint32_t p_owner, bool p_disabled) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 	if (sd.disabled == p_disabled) {
@@ -582,6 +596,7 @@ PackedInt32Array CollisionObject3D::_get_shape_owners() {
 
 void CollisionObject3D::shape_owner_set_transform(uint32_t p_owner, const Transform3D &p_transform) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 	sd.xform = p_transform;
@@ -610,6 +625,7 @@ Object *CollisionObject3D::shape_owner_get_owner(uint32_t p_owner) const {
 void CollisionObject3D::shape_owner_add_shape(uint32_t p_owner, const Ref<Shape3D> &p_shape) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_COND(p_shape.is_null());
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData &sd = shapes[p_owner];
 	ShapeData::ShapeBase s;
@@ -653,6 +669,7 @@ void CollisionObject3D::shape_owner_remove_shape(uint32_t p_owner, int p_shape)
 	ERR_FAIL_NULL(RenderingServer::get_singleton());
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_INDEX(p_shape, shapes[p_owner].shapes.size());
+	Viewport::notify_physics_picking_changed();
 
 	ShapeData::ShapeBase &s = shapes[p_owner].shapes.write[p_shape];
 	int index_to_remove = s.index;
@@ -32,7 +32,9 @@
 #include "skeleton_3d.compat.inc"
 
 #include "core/variant/type_info.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/skeleton_modifier_3d.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/surface_tool.h"
 #ifndef DISABLE_DEPRECATED
 #include "scene/3d/physical_bone_simulator_3d.h"
@@ -320,6 +322,14 @@ void Skeleton3D::_notification(int p_what) {
 			// Update bone transforms to apply unprocessed poses.
 			force_update_all_dirty_bones();
 
+			if (_is_skin_update_skipped()) {
+				// Global poses stay current for scripts, modifiers and skins catch up on a later frame.
+				lod_update_pending = true;
+				update_flags = UPDATE_FLAG_NONE;
+				return;
+			}
+			lod_update_pending = false;
+
 			updating = true;
 
 			Bone *bonesptr = bones.ptrw();
@@ -417,6 +427,9 @@ void Skeleton3D::_notification(int p_what) {
 			if (!modifiers.is_empty()) {
 				_update_deferred(UPDATE_FLAG_MODIFIER);
 			}
+			if (lod_update_pending) {
+				_update_deferred(UPDATE_FLAG_POSE);
+			}
 		} break;
 	}
 }
@@ -433,6 +446,44 @@ Skeleton3D::ModifierCallbackModeProcess Skeleton3D::get_modifier_callback_mode_p
 	return modifier_callback_mode_process;
 }
 
+void Skeleton3D::set_lod_distance(float p_distance) {
+	lod_distance = MAX(0, p_distance);
+}
+
+float Skeleton3D::get_lod_distance() const {
+	return lod_distance;
+}
+
+void Skeleton3D::set_lod_update_interval(int p_interval) {
+	lod_update_interval = MAX(1, p_interval);
+}
+
+int Skeleton3D::get_lod_update_interval() const {
+	return lod_update_interval;
+}
+
+bool Skeleton3D::_is_skin_update_skipped() {
+	if (lod_distance <= 0 || lod_update_interval <= 1 || is_group_processing()) {
+		return false; // Disabled, or the camera can't be read from this thread.
+	}
+
+	bool far = !is_visible_in_tree();
+	if (!far) {
+		Viewport *viewport = get_viewport();
+		Camera3D *camera = viewport ? viewport->get_camera_3d() : nullptr;
+		if (!camera) {
+			return false;
+		}
+		far = camera->get_global_position().distance_squared_to(get_global_position()) > lod_distance * lod_distance;
+	}
+
+	if (!far) {
+		lod_frame = 0;
+		return false;
+	}
+	return (lod_frame++ % lod_update_interval) != 0;
+}
+
 void Skeleton3D::_process_changed() {
 	if (modifier_callback_mode_process == MODIFIER_CALLBACK_MODE_PROCESS_IDLE) {
 		set_process_internal(true);
@@ -1073,9 +1124,18 @@ void Skeleton3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "motion_scale", PROPERTY_HINT_RANGE, "0.001,10,0.001,or_greater"), "set_motion_scale", "get_motion_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "show_rest_only"), "set_show_rest_only", "is_show_rest_only");
 
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &Skeleton3D::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &Skeleton3D::get_lod_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval", "interval"), &Skeleton3D::set_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &Skeleton3D::get_lod_update_interval);
+
 	ADD_GROUP("Modifier", "modifier_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "modifier_callback_mode_process", PROPERTY_HINT_ENUM, "Physics,Idle"), "set_modifier_callback_mode_process", "get_modifier_callback_mode_process");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_update_interval", "get_lod_update_interval");
+
 	ADD_SIGNAL(MethodInfo("pose_updated"));
 	ADD_SIGNAL(MethodInfo("skeleton_updated"));
 	ADD_SIGNAL(MethodInfo("bone_enabled_changed", PropertyInfo(Variant::INT, "bone_idx")));
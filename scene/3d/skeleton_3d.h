@@ -181,6 +181,13 @@ private:
 	void _make_modifiers_dirty();
 	LocalVector<BonePoseBackup> bones_backup;
 
+	// Skipping modifiers and skin updates for far away or hidden skeletons.
+	float lod_distance = 0.0;
+	int lod_update_interval = 4;
+	uint32_t lod_frame = 0;
+	bool lod_update_pending = false;
+	bool _is_skin_update_skipped();
+
 #ifndef DISABLE_DEPRECATED
 	void _add_bone_bind_compat_88791(const String &p_name);
 
@@ -267,6 +274,11 @@ public:
 	void set_modifier_callback_mode_process(ModifierCallbackModeProcess p_mode);
 	ModifierCallbackModeProcess get_modifier_callback_mode_process() const;
 
+	void set_lod_distance(float p_distance);
+	float get_lod_distance() const;
+	void set_lod_update_interval(int p_interval);
+	int get_lod_update_interval() const;
+
 #ifndef DISABLE_DEPRECATED
 	Transform3D get_bone_global_pose_no_override(int p_bone) const;
 	void clear_bones_global_pose_override();
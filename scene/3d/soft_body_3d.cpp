@@ -51,7 +51,10 @@ void SoftBodyRenderingServerHandler::prepare(RID p_mesh, int p_surface) {
 	uint32_t skin_stride;
 	RS::get_singleton()->mesh_surface_make_offsets_from_format(surface_data.format, surface_data.vertex_count, surface_data.index_count, surface_offsets, vertex_stride, normal_tangent_stride, attrib_stride, skin_stride);
 
-	buffer = surface_data.vertex_data;
+	buffers[0] = surface_data.vertex_data;
+	buffers[1] = surface_data.vertex_data;
+	current_buffer = 0;
+	aabb = AABB();
 	stride = vertex_stride;
 	normal_stride = normal_tangent_stride;
 	offset_vertices = surface_offsets[RS::ARRAY_VERTEX];
@@ -59,7 +62,10 @@ void SoftBodyRenderingServerHandler::prepare(RID p_mesh, int p_surface) {
 }
 
 void SoftBodyRenderingServerHandler::clear() {
-	buffer.resize(0);
+	buffers[0].resize(0);
+	buffers[1].resize(0);
+	current_buffer = 0;
+	aabb = AABB();
 	stride = 0;
 	normal_stride = 0;
 	offset_vertices = 0;
@@ -70,7 +76,7 @@ void SoftBodyRenderingServerHandler::clear() {
 }
 
 void SoftBodyRenderingServerHandler::open() {
-	write_buffer = buffer.ptrw();
+	write_buffer = buffers[current_buffer].ptrw();
 }
 
 void SoftBodyRenderingServerHandler::close() {
@@ -78,7 +84,8 @@ void SoftBodyRenderingServerHandler::close() {
 }
 
 void SoftBodyRenderingServerHandler::commit_changes() {
-	RS::get_singleton()->mesh_surface_update_vertex_region(mesh, surface, 0, buffer);
+	RS::get_singleton()->mesh_surface_update_vertex_region(mesh, surface, 0, buffers[current_buffer]);
+	current_buffer = 1 - current_buffer;
 }
 
 void SoftBodyRenderingServerHandler::set_vertex(int p_vertex_id, const Vector3 &p_vertex) {
@@ -97,6 +104,11 @@ void SoftBodyRenderingServerHandler::set_normal(int p_vertex_id, const Vector3 &
 }
 
 void SoftBodyRenderingServerHandler::set_aabb(const AABB &p_aabb) {
+	// Changing the custom AABB updates every instance of the mesh, skip it for resting bodies.
+	if (p_aabb == aabb) {
+		return;
+	}
+	aabb = p_aabb;
 	RS::get_singleton()->mesh_set_custom_aabb(mesh, p_aabb);
 }
 
@@ -42,7 +42,11 @@ class SoftBodyRenderingServerHandler : public PhysicsServer3DRenderingServerHand
 
 	RID mesh;
 	int surface = 0;
-	Vector<uint8_t> buffer;
+	// Written alternately, so the one still referenced by a queued rendering server command
+	// doesn't have to be copied before writing the next frame.
+	Vector<uint8_t> buffers[2];
+	int current_buffer = 0;
+	AABB aabb;
 	uint32_t stride = 0;
 	uint32_t normal_stride = 0;
 	uint32_t offset_vertices = 0;
@@ -49,12 +49,27 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_ENTER_WORLD: {
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
 			_update_visibility();
+			physics_interpolation_reset_pending = true;
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			Transform3D gt = get_global_transform();
+			// With physics interpolation, this is sent once per tick and the server interpolates for each frame.
 			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			if (physics_interpolation_reset_pending) {
+				physics_interpolation_reset_pending = false;
+				if (is_physics_interpolated_and_enabled()) {
+					RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+				}
+			}
+		} break;
+
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			if (is_physics_interpolated_and_enabled()) {
+				RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
@@ -68,6 +83,10 @@ void VisualInstance3D::_notification(int p_what) {
 	}
 }
 
+void VisualInstance3D::_physics_interpolated_changed() {
+	RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
+}
+
 RID VisualInstance3D::get_instance() const {
 	return instance;
 }
@@ -75,6 +94,7 @@ RID VisualInstance3D::get_instance() const {
 void VisualInstance3D::set_layer_mask(uint32_t p_mask) {
 	layers = p_mask;
 	RenderingServer::get_singleton()->instance_set_layer_mask(instance, p_mask);
+	_instance_settings_changed();
 }
 
 uint32_t VisualInstance3D::get_layer_mask() const {
@@ -173,6 +193,7 @@ void GeometryInstance3D::set_material_override(const Ref<Material> &p_material)
 		material_override->connect(CoreStringName(property_list_changed), callable_mp((Object *)this, &Object::notify_property_list_changed));
 	}
 	RS::get_singleton()->instance_geometry_set_material_override(get_instance(), p_material.is_valid() ? p_material->get_rid() : RID());
+	_instance_settings_changed();
 }
 
 Ref<Material> GeometryInstance3D::get_material_override() const {
@@ -182,6 +203,7 @@ Ref<Material> GeometryInstance3D::get_material_override() const {
 void GeometryInstance3D::set_material_overlay(const Ref<Material> &p_material) {
 	material_overlay = p_material;
 	RS::get_singleton()->instance_geometry_set_material_overlay(get_instance(), p_material.is_valid() ? p_material->get_rid() : RID());
+	_instance_settings_changed();
 }
 
 Ref<Material> GeometryInstance3D::get_material_overlay() const {
@@ -191,6 +213,7 @@ Ref<Material> GeometryInstance3D::get_material_overlay() const {
 void GeometryInstance3D::set_transparency(float p_transparency) {
 	transparency = CLAMP(p_transparency, 0.0f, 1.0f);
 	RS::get_singleton()->instance_geometry_set_transparency(get_instance(), transparency);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -201,6 +224,7 @@ float GeometryInstance3D::get_transparency() const {
 void GeometryInstance3D::set_visibility_range_begin(float p_dist) {
 	visibility_range_begin = p_dist;
 	RS::get_singleton()->instance_geometry_set_visibility_range(get_instance(), visibility_range_begin, visibility_range_end, visibility_range_begin_margin, visibility_range_end_margin, (RS::VisibilityRangeFadeMode)visibility_range_fade_mode);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -211,6 +235,7 @@ float GeometryInstance3D::get_visibility_range_begin() const {
 void GeometryInstance3D::set_visibility_range_end(float p_dist) {
 	visibility_range_end = p_dist;
 	RS::get_singleton()->instance_geometry_set_visibility_range(get_instance(), visibility_range_begin, visibility_range_end, visibility_range_begin_margin, visibility_range_end_margin, (RS::VisibilityRangeFadeMode)visibility_range_fade_mode);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -221,6 +246,7 @@ float GeometryInstance3D::get_visibility_range_end() const {
 void GeometryInstance3D::set_visibility_range_begin_margin(float p_dist) {
 	visibility_range_begin_margin = p_dist;
 	RS::get_singleton()->instance_geometry_set_visibility_range(get_instance(), visibility_range_begin, visibility_range_end, visibility_range_begin_margin, visibility_range_end_margin, (RS::VisibilityRangeFadeMode)visibility_range_fade_mode);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -231,6 +257,7 @@ float GeometryInstance3D::get_visibility_range_begin_margin() const {
 void GeometryInstance3D::set_visibility_range_end_margin(float p_dist) {
 	visibility_range_end_margin = p_dist;
 	RS::get_singleton()->instance_geometry_set_visibility_range(get_instance(), visibility_range_begin, visibility_range_end, visibility_range_begin_margin, visibility_range_end_margin, (RS::VisibilityRangeFadeMode)visibility_range_fade_mode);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -241,6 +268,7 @@ float GeometryInstance3D::get_visibility_range_end_margin() const {
 void GeometryInstance3D::set_visibility_range_fade_mode(VisibilityRangeFadeMode p_mode) {
 	visibility_range_fade_mode = p_mode;
 	RS::get_singleton()->instance_geometry_set_visibility_range(get_instance(), visibility_range_begin, visibility_range_end, visibility_range_begin_margin, visibility_range_end_margin, (RS::VisibilityRangeFadeMode)visibility_range_fade_mode);
+	_instance_settings_changed();
 	update_configuration_warnings();
 }
 
@@ -323,6 +351,7 @@ void GeometryInstance3D::set_cast_shadows_setting(ShadowCastingSetting p_shadow_
 	shadow_casting_setting = p_shadow_casting_setting;
 
 	RS::get_singleton()->instance_geometry_set_cast_shadows_setting(get_instance(), (RS::ShadowCastingSetting)p_shadow_casting_setting);
+	_instance_settings_changed();
 }
 
 GeometryInstance3D::ShadowCastingSetting GeometryInstance3D::get_cast_shadows_setting() const {
@@ -333,6 +362,7 @@ void GeometryInstance3D::set_extra_cull_margin(float p_margin) {
 	ERR_FAIL_COND(p_margin < 0);
 	extra_cull_margin = p_margin;
 	RS::get_singleton()->instance_set_extra_visibility_margin(get_instance(), extra_cull_margin);
+	_instance_settings_changed();
 }
 
 float GeometryInstance3D::get_extra_cull_margin() const {
@@ -343,6 +373,7 @@ void GeometryInstance3D::set_lod_bias(float p_bias) {
 	ERR_FAIL_COND(p_bias < 0.0);
 	lod_bias = p_bias;
 	RS::get_singleton()->instance_geometry_set_lod_bias(get_instance(), lod_bias);
+	_instance_settings_changed();
 }
 
 float GeometryInstance3D::get_lod_bias() const {
@@ -409,6 +440,7 @@ void GeometryInstance3D::set_gi_mode(GIMode p_mode) {
 	}
 
 	gi_mode = p_mode;
+	_instance_settings_changed();
 }
 
 GeometryInstance3D::GIMode GeometryInstance3D::get_gi_mode() const {
@@ -418,6 +450,7 @@ GeometryInstance3D::GIMode GeometryInstance3D::get_gi_mode() const {
 void GeometryInstance3D::set_ignore_occlusion_culling(bool p_enabled) {
 	ignore_occlusion_culling = p_enabled;
 	RS::get_singleton()->instance_geometry_set_flag(get_instance(), RS::INSTANCE_FLAG_IGNORE_OCCLUSION_CULLING, ignore_occlusion_culling);
+	_instance_settings_changed();
 }
 
 bool GeometryInstance3D::is_ignoring_occlusion_culling() {
@@ -41,9 +41,14 @@ class VisualInstance3D : public Node3D {
 	uint32_t layers = 1;
 	float sorting_offset = 0.0;
 	bool sorting_use_aabb_center = true;
+	// Set on entering the world, so the first transform sent isn't interpolated from the previous location.
+	bool physics_interpolation_reset_pending = false;
 
 protected:
 	void _update_visibility();
+	// Called after a setting forwarded to the rendering server instance changes.
+	virtual void _instance_settings_changed() {}
+	virtual void _physics_interpolated_changed() override;
 
 	void _notification(int p_what);
 	static void _bind_methods();
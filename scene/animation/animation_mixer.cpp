@@ -33,6 +33,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/audio/audio_stream_player.h"
@@ -1107,6 +1108,20 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 #endif // TOOLS_ENABLED
+#ifndef _3D_DISABLED
+	// Transform and blend shape tracks (except root motion) only write to their own track cache, so in large mixers
+	// they are collected here and blended on worker threads once the other tracks are processed.
+	// A script or extension overriding _post_process_key_value() keeps everything on this thread.
+	bool sample_in_threads = false;
+	if (!GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		uint32_t track_total = 0;
+		for (const AnimationInstance &ai : animation_instances) {
+			track_total += ai.animation_data.animation->get_track_count();
+		}
+		sample_in_threads = track_total >= BLEND_SAMPLES_THREADING_THRESHOLD;
+	}
+	blend_samples.clear();
+#endif // _3D_DISABLED
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		double time = ai.playback_info.time;
@@ -1145,6 +1160,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			}
 			Animation::TrackType ttype = a->track_get_type(i);
 			track->root_motion = root_motion_track == a->track_get_path(i);
+#ifndef _3D_DISABLED
+			if (sample_in_threads && !track->root_motion && (ttype == Animation::TYPE_POSITION_3D || ttype == Animation::TYPE_ROTATION_3D || ttype == Animation::TYPE_SCALE_3D || ttype == Animation::TYPE_BLEND_SHAPE)) {
+				if (!Math::is_zero_approx(blend)) {
+					blend_samples.push_back({ &ai.animation_data.animation, i, ttype, time, blend, track });
+				}
+				continue;
+			}
+#endif // _3D_DISABLED
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1223,15 +1246,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						root_motion_cache.loc += (loc[1] - loc[0]) * blend;
 						prev_time = !backward ? 0 : (double)a->get_length();
 					}
-					{
-						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
-						if (err != OK) {
-							continue;
-						}
-						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
-						t->loc += (loc - t->init_loc) * blend;
-					}
+					_blend_sample({ &ai.animation_data.animation, i, ttype, time, blend, track }, false);
 #endif // _3D_DISABLED
 				} break;
 				case Animation::TYPE_ROTATION_3D: {
@@ -1310,15 +1325,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						root_motion_cache.rot = (root_motion_cache.rot * Quaternion().slerp(rot[0].inverse() * rot[1], blend)).normalized();
 						prev_time = !backward ? 0 : (double)a->get_length();
 					}
-					{
-						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
-						if (err != OK) {
-							continue;
-						}
-						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
-						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
-					}
+					_blend_sample({ &ai.animation_data.animation, i, ttype, time, blend, track }, false);
 #endif // _3D_DISABLED
 				} break;
 				case Animation::TYPE_SCALE_3D: {
@@ -1398,15 +1405,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						root_motion_cache.scale += (scale[1] - scale[0]) * blend;
 						prev_time = !backward ? 0 : (double)a->get_length();
 					}
-					{
-						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
-						if (err != OK) {
-							continue;
-						}
-						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
-						t->scale += (scale - t->init_scale) * blend;
-					}
+					_blend_sample({ &ai.animation_data.animation, i, ttype, time, blend, track }, false);
 #endif // _3D_DISABLED
 				} break;
 				case Animation::TYPE_BLEND_SHAPE: {
@@ -1414,15 +1413,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					if (Math::is_zero_approx(blend)) {
 						continue; // Nothing to blend.
 					}
-					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
-					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
-					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
-					if (err != OK) {
-						continue;
-					}
-					value = post_process_key_value(a, i, value, t->object_id, t->shape_index);
-					t->value += (value - t->init_value) * blend;
+					_blend_sample({ &ai.animation_data.animation, i, ttype, time, blend, track }, false);
 #endif // _3D_DISABLED
 				} break;
 				case Animation::TYPE_BEZIER:
@@ -1500,7 +1491,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							value = post_process_key_value(a, i, value, t->object_id);
 							Object *t_obj = ObjectDB::get_instance(t->object_id);
 							if (t_obj) {
-								t_obj->set_indexed(t->subpath, value);
+								t_obj->set_indexed_cached(t->subpath, value, t->script_member_slot);
 							}
 						} else {
 							List<int> indices;
@@ -1511,7 +1502,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 								value = post_process_key_value(a, i, value, t->object_id);
 								Object *t_obj = ObjectDB::get_instance(t->object_id);
 								if (t_obj) {
-									t_obj->set_indexed(t->subpath, value);
+									t_obj->set_indexed_cached(t->subpath, value, t->script_member_slot);
 								}
 							}
 						}
@@ -1717,8 +1708,112 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			}
 		}
 	}
+#ifndef _3D_DISABLED
+	if (!blend_samples.is_empty()) {
+		_blend_samples();
+	}
+#endif // _3D_DISABLED
 }
 
+#ifndef _3D_DISABLED
+void AnimationMixer::_blend_sample(const BlendSample &p_sample, bool p_threaded) {
+	const Ref<Animation> &a = *p_sample.animation;
+	int i = p_sample.track;
+	real_t blend = p_sample.blend;
+
+	// From worker threads, post-process natively: only reached when _post_process_key_value() isn't overridden.
+#define POST_PROCESS_KEY_VALUE(m_value, m_object_id, m_sub_idx) \
+	(p_threaded ? _post_process_key_value(a, i, m_value, m_object_id, m_sub_idx) : post_process_key_value(a, i, m_value, m_object_id, m_sub_idx))
+
+	switch (p_sample.type) {
+		case Animation::TYPE_POSITION_3D: {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(p_sample.track_cache);
+			Vector3 loc;
+			Error err = a->try_position_track_interpolate(i, p_sample.time, &loc);
+			if (err != OK) {
+				return;
+			}
+			loc = POST_PROCESS_KEY_VALUE(loc, t->object_id, t->bone_idx);
+			t->loc += (loc - t->init_loc) * blend;
+		} break;
+		case Animation::TYPE_ROTATION_3D: {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(p_sample.track_cache);
+			Quaternion rot;
+			Error err = a->try_rotation_track_interpolate(i, p_sample.time, &rot);
+			if (err != OK) {
+				return;
+			}
+			rot = POST_PROCESS_KEY_VALUE(rot, t->object_id, t->bone_idx);
+			t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+		} break;
+		case Animation::TYPE_SCALE_3D: {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(p_sample.track_cache);
+			Vector3 scale;
+			Error err = a->try_scale_track_interpolate(i, p_sample.time, &scale);
+			if (err != OK) {
+				return;
+			}
+			scale = POST_PROCESS_KEY_VALUE(scale, t->object_id, t->bone_idx);
+			t->scale += (scale - t->init_scale) * blend;
+		} break;
+		case Animation::TYPE_BLEND_SHAPE: {
+			TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(p_sample.track_cache);
+			float value;
+			Error err = a->try_blend_shape_track_interpolate(i, p_sample.time, &value);
+			if (err != OK) {
+				return;
+			}
+			value = POST_PROCESS_KEY_VALUE(value, t->object_id, t->shape_index);
+			t->value += (value - t->init_value) * blend;
+		} break;
+		default: {
+		} break;
+	}
+
+#undef POST_PROCESS_KEY_VALUE
+}
+
+void AnimationMixer::_blend_samples_thread(uint32_t p_group, const BlendSample *p_samples) {
+	uint32_t from = p_group > 0 ? blend_sample_group_ends[p_group - 1] : 0;
+	uint32_t to = blend_sample_group_ends[p_group];
+	for (uint32_t i = from; i < to; i++) {
+		_blend_sample(p_samples[i], true);
+	}
+}
+
+void AnimationMixer::_blend_samples() {
+	// Group samples by track cache, keeping animation instance order inside each group. Every group is then
+	// blended by a single thread in the same order as the serial path, so results are identical.
+	blend_sample_groups.clear();
+	blend_sample_group_ends.clear();
+	for (const BlendSample &sample : blend_samples) {
+		uint32_t *group = blend_sample_groups.getptr(sample.track_cache);
+		if (!group) {
+			group = &blend_sample_groups.insert(sample.track_cache, blend_sample_group_ends.size())->value;
+			blend_sample_group_ends.push_back(0);
+		}
+		blend_sample_group_ends[*group]++;
+	}
+
+	const uint32_t group_count = blend_sample_group_ends.size();
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < group_count; i++) {
+		uint32_t count = blend_sample_group_ends[i];
+		blend_sample_group_ends[i] = offset; // Start for now, becomes the end once filled below.
+		offset += count;
+	}
+	blend_samples_grouped.resize(blend_samples.size());
+	for (const BlendSample &sample : blend_samples) {
+		blend_samples_grouped[blend_sample_group_ends[blend_sample_groups[sample.track_cache]]++] = sample;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AnimationMixer::_blend_samples_thread, (const BlendSample *)blend_samples_grouped.ptr(), group_count, -1, true, SNAME("AnimationMixerBlend"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	blend_samples.clear();
+}
+#endif // _3D_DISABLED
+
 void AnimationMixer::_blend_apply() {
 	// Finally, set the tracks.
 	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
@@ -1817,7 +1912,7 @@ void AnimationMixer::_blend_apply() {
 
 				Object *t_obj = ObjectDB::get_instance(t->object_id);
 				if (t_obj) {
-					t_obj->set_indexed(t->subpath, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
+					t_obj->set_indexed_cached(t->subpath, Animation::cast_from_blendwise(t->value, t->init_value.get_type()), t->script_member_slot);
 				}
 
 			} break;
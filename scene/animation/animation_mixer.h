@@ -222,6 +222,7 @@ protected:
 		Variant init_value;
 		Variant value;
 		Vector<StringName> subpath;
+		int script_member_slot = ScriptInstance::MEMBER_SLOT_UNRESOLVED;
 
 		// TODO: There are many boolean, can be packed into one integer.
 		bool is_init = false;
@@ -237,6 +238,7 @@ protected:
 				init_value(p_other.init_value),
 				value(p_other.value),
 				subpath(p_other.subpath),
+				script_member_slot(p_other.script_member_slot),
 				is_init(p_other.is_init),
 				use_continuous(p_other.use_continuous),
 				use_discrete(p_other.use_discrete),
@@ -309,6 +311,28 @@ protected:
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
+#ifndef _3D_DISABLED
+	// Transform and blend shape tracks of large mixers are blended on worker threads, see _blend_samples().
+	static constexpr uint32_t BLEND_SAMPLES_THREADING_THRESHOLD = 256;
+
+	struct BlendSample {
+		const Ref<Animation> *animation = nullptr;
+		int track = -1;
+		Animation::TrackType type = Animation::TYPE_POSITION_3D;
+		double time = 0.0;
+		real_t blend = 0.0;
+		TrackCache *track_cache = nullptr;
+	};
+	LocalVector<BlendSample> blend_samples;
+	LocalVector<BlendSample> blend_samples_grouped;
+	LocalVector<uint32_t> blend_sample_group_ends;
+	HashMap<TrackCache *, uint32_t> blend_sample_groups;
+
+	void _blend_sample(const BlendSample &p_sample, bool p_threaded);
+	void _blend_samples_thread(uint32_t p_group, const BlendSample *p_samples);
+	void _blend_samples();
+#endif // _3D_DISABLED
+
 	// Helpers.
 	void _clear_caches();
 	void _clear_audio_streams();
@@ -30,6 +30,7 @@
 
 #include "tween.h"
 
+#include "core/variant/variant_internal.h"
 #include "scene/animation/easing_equations.h"
 #include "scene/main/node.h"
 #include "scene/resources/animation.h"
@@ -564,6 +565,49 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = Animation::subtract_variant(final_val, initial_val);
+	_update_lerp_type();
+}
+
+void PropertyTweener::_update_lerp_type() {
+	lerp_type = Variant::NIL;
+	if (initial_val.get_type() != final_val.get_type()) {
+		return;
+	}
+	switch (initial_val.get_type()) {
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::VECTOR4:
+		case Variant::COLOR: {
+			lerp_type = initial_val.get_type();
+		} break;
+		default: {
+		}
+	}
+}
+
+Variant PropertyTweener::_lerp(float p_weight) const {
+	// Same results as Animation::interpolate_variant(), without going through the generic Variant operators every step.
+	switch (lerp_type) {
+		case Variant::FLOAT: {
+			return Math::lerp(*VariantInternal::get_float(&initial_val), *VariantInternal::get_float(&final_val), (double)p_weight);
+		}
+		case Variant::VECTOR2: {
+			return VariantInternal::get_vector2(&initial_val)->lerp(*VariantInternal::get_vector2(&final_val), p_weight);
+		}
+		case Variant::VECTOR3: {
+			return VariantInternal::get_vector3(&initial_val)->lerp(*VariantInternal::get_vector3(&final_val), p_weight);
+		}
+		case Variant::VECTOR4: {
+			return VariantInternal::get_vector4(&initial_val)->lerp(*VariantInternal::get_vector4(&final_val), p_weight);
+		}
+		case Variant::COLOR: {
+			return VariantInternal::get_color(&initial_val)->lerp(*VariantInternal::get_color(&final_val), p_weight);
+		}
+		default: {
+			return Animation::interpolate_variant(initial_val, final_val, p_weight);
+		}
+	}
 }
 
 bool PropertyTweener::step(double &r_delta) {
@@ -584,13 +628,19 @@ bool PropertyTweener::step(double &r_delta) {
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
 		initial_val = target_instance->get_indexed(property);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
+		_update_lerp_type();
 		do_continue_delayed = false;
 	}
 
-	Ref<Tween> tween = _get_tween();
-
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
+		if (lerp_type != Variant::NIL && !custom_method.is_valid()) {
+			target_instance->set_indexed_cached(property, _lerp(Tween::run_equation(trans_type, ease_type, time, 0.0, 1.0, duration)), script_member_slot);
+			r_delta = 0;
+			return true;
+		}
+
+		Ref<Tween> tween = _get_tween();
 		if (custom_method.is_valid()) {
 			const Variant t = tween->interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
 			const Variant *argptr = &t;
@@ -604,14 +654,14 @@ bool PropertyTweener::step(double &r_delta) {
 				ERR_FAIL_V_MSG(false, vformat("Wrong return type in PropertyTweener custom method. Expected float, got %s.", Variant::get_type_name(result.get_type())));
 			}
 
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+			target_instance->set_indexed_cached(property, Animation::interpolate_variant(initial_val, final_val, result), script_member_slot);
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			target_instance->set_indexed_cached(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type), script_member_slot);
 		}
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		target_instance->set_indexed_cached(property, final_val, script_member_slot);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SceneStringName(finished));
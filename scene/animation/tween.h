@@ -32,6 +32,7 @@
 #define TWEEN_H
 
 #include "core/object/ref_counted.h"
+#include "core/object/script_instance.h"
 
 class Tween;
 class Node;
@@ -215,10 +216,12 @@ protected:
 private:
 	ObjectID target;
 	Vector<StringName> property;
+	int script_member_slot = ScriptInstance::MEMBER_SLOT_UNRESOLVED;
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
 	Variant delta_val;
+	Variant::Type lerp_type = Variant::NIL; // Set when initial and final values can be lerped directly.
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
 
@@ -231,6 +234,9 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	void _update_lerp_type();
+	Variant _lerp(float p_weight) const;
 };
 
 class IntervalTweener : public Tweener {
@@ -312,6 +312,21 @@ void AudioStreamPlayerInternal::set_max_polyphony(int p_max_polyphony) {
 	}
 }
 
+void AudioStreamPlayerInternal::set_voice_priority(int p_voice_priority) {
+	voice_priority = p_voice_priority;
+
+	for (const Ref<AudioStreamPlayback> &playback : stream_playbacks) {
+		update_voice_params(playback);
+	}
+}
+
+void AudioStreamPlayerInternal::update_voice_params(const Ref<AudioStreamPlayback> &p_playback) {
+	if (stream.is_null()) {
+		return;
+	}
+	AudioServer::get_singleton()->set_playback_voice_params(p_playback, voice_priority, stream->get_length(), stream->has_loop());
+}
+
 bool AudioStreamPlayerInternal::has_stream_playback() {
 	return !stream_playbacks.is_empty();
 }
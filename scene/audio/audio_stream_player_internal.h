@@ -76,6 +76,7 @@ public:
 	bool autoplay = false;
 	StringName bus;
 	int max_polyphony = 1;
+	int voice_priority = 0;
 
 	void process();
 	void ensure_playback_limit();
@@ -89,6 +90,8 @@ public:
 	void set_stream(Ref<AudioStream> p_stream);
 	void set_pitch_scale(float p_pitch_scale);
 	void set_max_polyphony(int p_max_polyphony);
+	void set_voice_priority(int p_voice_priority);
+	void update_voice_params(const Ref<AudioStreamPlayback> &p_playback);
 
 	StringName get_bus() const;
 
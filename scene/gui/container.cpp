@@ -84,6 +84,16 @@ void Container::_sort_children() {
 		return;
 	}
 
+	// Sort top-down: a pending sort higher up may resize this container and queue it again.
+	// Waiting for it lets a change deep in nested containers re-sort each level only once.
+	for (Control *c = this; c && !c->is_set_as_top_level(); c = c->get_parent_control()) {
+		Container *ancestor = Object::cast_to<Container>(c->get_parent_control());
+		if (ancestor && ancestor->pending_sort) {
+			callable_mp(this, &Container::_sort_children).call_deferred();
+			return;
+		}
+	}
+
 	notification(NOTIFICATION_PRE_SORT_CHILDREN);
 	emit_signal(SceneStringName(pre_sort_children));
 
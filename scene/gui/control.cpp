@@ -2573,14 +2573,16 @@ Ref<Texture2D> Control::get_theme_icon(const StringName &p_name, const StringNam
 		}
 	}
 
-	if (data.theme_icon_cache.has(p_theme_type) && data.theme_icon_cache[p_theme_type].has(p_name)) {
-		return data.theme_icon_cache[p_theme_type][p_name];
+	Theme::ThemeIconMap &type_cache = data.theme_icon_cache[p_theme_type];
+	const Ref<Texture2D> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<Texture2D> icon = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
-	data.theme_icon_cache[p_theme_type][p_name] = icon;
+	type_cache.insert(p_name, icon);
 	return icon;
 }
 
@@ -2597,14 +2599,16 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
 		}
 	}
 
-	if (data.theme_style_cache.has(p_theme_type) && data.theme_style_cache[p_theme_type].has(p_name)) {
-		return data.theme_style_cache[p_theme_type][p_name];
+	Theme::ThemeStyleMap &type_cache = data.theme_style_cache[p_theme_type];
+	const Ref<StyleBox> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<StyleBox> style = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
-	data.theme_style_cache[p_theme_type][p_name] = style;
+	type_cache.insert(p_name, style);
 	return style;
 }
 
@@ -2621,14 +2625,16 @@ Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_
 		}
 	}
 
-	if (data.theme_font_cache.has(p_theme_type) && data.theme_font_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_cache[p_theme_type][p_name];
+	Theme::ThemeFontMap &type_cache = data.theme_font_cache[p_theme_type];
+	const Ref<Font> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<Font> font = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
-	data.theme_font_cache[p_theme_type][p_name] = font;
+	type_cache.insert(p_name, font);
 	return font;
 }
 
@@ -2645,14 +2651,16 @@ int Control::get_theme_font_size(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (data.theme_font_size_cache.has(p_theme_type) && data.theme_font_size_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_size_cache[p_theme_type][p_name];
+	Theme::ThemeFontSizeMap &type_cache = data.theme_font_size_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	int font_size = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
-	data.theme_font_size_cache[p_theme_type][p_name] = font_size;
+	type_cache.insert(p_name, font_size);
 	return font_size;
 }
 
@@ -2669,14 +2677,16 @@ Color Control::get_theme_color(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (data.theme_color_cache.has(p_theme_type) && data.theme_color_cache[p_theme_type].has(p_name)) {
-		return data.theme_color_cache[p_theme_type][p_name];
+	Theme::ThemeColorMap &type_cache = data.theme_color_cache[p_theme_type];
+	const Color *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Color color = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
-	data.theme_color_cache[p_theme_type][p_name] = color;
+	type_cache.insert(p_name, color);
 	return color;
 }
 
@@ -2693,14 +2703,16 @@ int Control::get_theme_constant(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (data.theme_constant_cache.has(p_theme_type) && data.theme_constant_cache[p_theme_type].has(p_name)) {
-		return data.theme_constant_cache[p_theme_type][p_name];
+	Theme::ThemeConstantMap &type_cache = data.theme_constant_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	data.theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	int constant = data.theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
-	data.theme_constant_cache[p_theme_type][p_name] = constant;
+	type_cache.insert(p_name, constant);
 	return constant;
 }
 
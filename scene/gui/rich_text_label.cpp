@@ -2821,7 +2821,7 @@ int RichTextLabel::get_progress_bar_delay() const {
 	return progress_delay;
 }
 
-_FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height, float p_ctrl_height, float p_width, int p_idx, float p_old_scroll, float p_text_rect_height) {
+_FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height, float p_ctrl_height, float p_width, int p_idx) {
 	updating_scroll = true;
 
 	float total_height = p_total_height;
@@ -2846,16 +2846,21 @@ _FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height,
 			main->first_resized_line.store(j);
 		}
 	}
-	vscroll->set_max(total_height);
+	updating_scroll = false;
+
+	return total_height;
+}
+
+void RichTextLabel::_update_scroll_range(float p_total_height, float p_old_scroll, float p_text_rect_height) {
+	updating_scroll = true;
+	vscroll->set_max(p_total_height);
 	vscroll->set_page(p_text_rect_height);
 	if (scroll_follow && scroll_following) {
-		vscroll->set_value(total_height);
+		vscroll->set_value(p_total_height);
 	} else {
 		vscroll->set_value(p_old_scroll);
 	}
 	updating_scroll = false;
-
-	return total_height;
 }
 
 bool RichTextLabel::_validate_line_caches() {
@@ -2894,9 +2899,10 @@ bool RichTextLabel::_validate_line_caches() {
 		float total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
 		for (int i = fi; i < (int)main->lines.size(); i++) {
 			total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i);
 			main->first_resized_line.store(i);
 		}
+		_update_scroll_range(total_height, old_scroll, text_rect.size.height);
 
 		main->first_resized_line.store(main->lines.size());
 
@@ -2966,7 +2972,10 @@ void RichTextLabel::_process_line_caches() {
 
 		for (int i = sr; i < fi; i++) {
 			total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i);
+			if (threaded) {
+				_update_scroll_range(total_height, old_scroll, text_rect.size.height);
+			}
 
 			main->first_resized_line.store(i);
 
@@ -2979,7 +2988,11 @@ void RichTextLabel::_process_line_caches() {
 	total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
 	for (int i = fi; i < (int)main->lines.size(); i++) {
 		total_height = _shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height, &total_chars);
-		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i);
+		if (threaded) {
+			// Lines are drawn as they get shaped, keep the scroll bar in sync.
+			_update_scroll_range(total_height, old_scroll, text_rect.size.height);
+		}
 
 		main->first_invalid_line.store(i);
 		main->first_resized_line.store(i);
@@ -2994,6 +3007,7 @@ void RichTextLabel::_process_line_caches() {
 	main->first_invalid_line.store(main->lines.size());
 	main->first_resized_line.store(main->lines.size());
 	main->first_invalid_font_line.store(main->lines.size());
+	_update_scroll_range(total_height, old_scroll, text_rect.size.height);
 
 	if (fit_content) {
 		update_minimum_size();
@@ -355,16 +355,38 @@ void TextEdit::Text::set(int p_line, const String &p_text, const Array &p_bidi_o
 	invalidate_cache(p_line, -1, true);
 }
 
+void TextEdit::Text::_rotate_lines(int p_from, int p_middle, int p_to) {
+	// Moves [p_middle, p_to) in front of [p_from, p_middle).
+	// Lines are relocated with raw memory moves, like CowData does when it reallocates, instead of
+	// copy-assigning every following line. This keeps edits near the top of huge files cheap.
+	const int head = p_middle - p_from;
+	const int tail = p_to - p_middle;
+	if (head <= 0 || tail <= 0) {
+		return;
+	}
+
+	Line *lines = text.ptrw();
+	if (tail <= head) {
+		uint8_t *tmp = (uint8_t *)memalloc(tail * sizeof(Line));
+		memcpy(tmp, (const void *)(lines + p_middle), tail * sizeof(Line));
+		memmove((void *)(lines + p_from + tail), (const void *)(lines + p_from), head * sizeof(Line));
+		memcpy((void *)(lines + p_from), tmp, tail * sizeof(Line));
+		memfree(tmp);
+	} else {
+		uint8_t *tmp = (uint8_t *)memalloc(head * sizeof(Line));
+		memcpy(tmp, (const void *)(lines + p_from), head * sizeof(Line));
+		memmove((void *)(lines + p_from), (const void *)(lines + p_middle), tail * sizeof(Line));
+		memcpy((void *)(lines + p_from + tail), tmp, head * sizeof(Line));
+		memfree(tmp);
+	}
+}
+
 void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector<Array> &p_bidi_override) {
 	int new_line_count = p_text.size() - 1;
 	if (new_line_count > 0) {
-		text.resize(text.size() + new_line_count);
-		for (int i = (text.size() - 1); i > p_at; i--) {
-			if ((i - new_line_count) <= 0) {
-				break;
-			}
-			text.write[i] = text[i - new_line_count];
-		}
+		int old_size = text.size();
+		text.resize(old_size + new_line_count);
+		_rotate_lines(p_at + 1, old_size, text.size());
 	}
 
 	for (int i = 0; i < p_text.size(); i++) {
@@ -403,9 +425,7 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 	}
 
 	int diff = (p_to_line - p_from_line);
-	for (int i = p_to_line; i < text.size() - 1; i++) {
-		text.write[(i - diff) + 1] = text[i + 1];
-	}
+	_rotate_lines(p_from_line + 1, p_to_line + 1, text.size());
 	text.resize(text.size() - diff);
 
 	if (dirty_height) {
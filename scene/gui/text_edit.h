@@ -188,6 +188,7 @@ private:
 
 		void _calculate_line_height();
 		void _calculate_max_line_width();
+		void _rotate_lines(int p_from, int p_middle, int p_to);
 
 	public:
 		void set_tab_size(int p_tab_size);
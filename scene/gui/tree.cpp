@@ -138,12 +138,15 @@ void TreeItem::_change_tree(Tree *p_tree) {
 			tree->pressing_for_editor = false;
 		}
 
+		tree->item_height_version++;
 		tree->queue_redraw();
 	}
 
 	tree = p_tree;
+	cached_height_version = 0;
 
 	if (tree) {
+		tree->item_height_version++;
 		tree->queue_redraw();
 		cells.resize(tree->columns.size());
 	}
@@ -360,6 +363,9 @@ void TreeItem::set_autowrap_mode(int p_column, TextServer::AutowrapMode p_mode)
 	}
 
 	cells.write[p_column].autowrap_mode = p_mode;
+	if (tree && p_mode != TextServer::AUTOWRAP_OFF) {
+		tree->has_autowrap_cells = true;
+	}
 	cells.write[p_column].dirty = true;
 	_changed_notify(p_column);
 	cells.write[p_column].cached_minimum_size_dirty = true;
@@ -767,6 +773,7 @@ TreeItem *TreeItem::create_child(int p_index) {
 	TreeItem *ti = memnew(TreeItem(tree));
 	if (tree) {
 		ti->cells.resize(tree->columns.size());
+		tree->item_height_version++;
 		tree->queue_redraw();
 	}
 
@@ -1105,6 +1112,7 @@ void TreeItem::move_before(TreeItem *p_item) {
 	p_item->prev = this;
 
 	if (tree && old_tree == tree) {
+		tree->item_height_version++;
 		tree->queue_redraw();
 	}
 
@@ -1149,6 +1157,7 @@ void TreeItem::move_after(TreeItem *p_item) {
 	}
 
 	if (tree && old_tree == tree) {
+		tree->item_height_version++;
 		tree->queue_redraw();
 	}
 	validate_cache();
@@ -1873,6 +1882,9 @@ int Tree::get_item_height(TreeItem *p_item) const {
 	if (!p_item->is_visible_in_tree()) {
 		return 0;
 	}
+	if (!has_autowrap_cells && p_item->cached_height_version == item_height_version) {
+		return p_item->cached_height;
+	}
 	int height = compute_item_height(p_item);
 	height += theme_cache.v_separation;
 
@@ -1887,6 +1899,8 @@ int Tree::get_item_height(TreeItem *p_item) const {
 		}
 	}
 
+	p_item->cached_height = height;
+	p_item->cached_height_version = item_height_version;
 	return height;
 }
 
@@ -2524,7 +2538,13 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 			int child_h = -1;
 			int child_self_height = 0;
 			if (htotal >= 0) {
-				child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c, child_self_height);
+				if (!has_autowrap_cells && c->is_visible_in_tree() && children_pos.y + get_item_height(c) - theme_cache.offset.y < 0) {
+					// Nothing in this branch is visible, step over it.
+					child_h = get_item_height(c);
+					child_self_height = compute_item_height(c);
+				} else {
+					child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c, child_self_height);
+				}
 				child_self_height += theme_cache.v_separation;
 			}
 
@@ -3131,7 +3151,12 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, int
 			TreeItem *c = p_item->first_child;
 
 			while (c) {
-				int child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, x_limit, p_double_click, c, p_button, p_mod);
+				int child_h;
+				if (!has_autowrap_cells && new_pos.y >= get_item_height(c)) {
+					child_h = get_item_height(c); // The event is below this branch.
+				} else {
+					child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, x_limit, p_double_click, c, p_button, p_mod);
+				}
 
 				if (child_h < 0) {
 					return -1; // break, stop propagating, no need to anymore
@@ -4409,6 +4434,7 @@ void Tree::_notification(int p_what) {
 }
 
 void Tree::_update_all() {
+	item_height_version++;
 	for (int i = 0; i < columns.size(); i++) {
 		update_column(i);
 	}
@@ -4487,6 +4513,7 @@ void Tree::item_edited(int p_column, TreeItem *p_item, MouseButton p_custom_mous
 	edited_col = p_column;
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		edited_item->cells.write[p_column].dirty = true;
+		item_height_version++;
 	}
 	emit_signal(SNAME("item_edited"));
 	if (p_custom_mouse_index != MouseButton::NONE) {
@@ -4499,6 +4526,7 @@ void Tree::item_changed(int p_column, TreeItem *p_item) {
 		p_item->cells.write[p_column].dirty = true;
 		columns.write[p_column].cached_minimum_width_dirty = true;
 	}
+	item_height_version++;
 	queue_redraw();
 }
 
@@ -4611,6 +4639,7 @@ void Tree::set_hide_root(bool p_enabled) {
 	}
 
 	hide_root = p_enabled;
+	item_height_version++;
 	queue_redraw();
 	update_minimum_size();
 }
@@ -4846,6 +4875,7 @@ void Tree::set_columns(int p_columns) {
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
 	}
+	item_height_version++;
 	queue_redraw();
 }
 
@@ -5288,7 +5318,12 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
 	TreeItem *n = p_item->get_first_child();
 	while (n) {
 		int ch;
-		TreeItem *r = _find_item_at_pos(n, pos, r_column, ch, section);
+		TreeItem *r = nullptr;
+		if (!has_autowrap_cells && pos.y >= get_item_height(n)) {
+			ch = get_item_height(n);
+		} else {
+			r = _find_item_at_pos(n, pos, r_column, ch, section);
+		}
 		pos.y -= ch;
 		h += ch;
 		if (r) {
@@ -132,6 +132,10 @@ private:
 	bool disable_folding = false;
 	int custom_min_height = 0;
 
+	// Height of this item and its visible children, valid while the tree's item_height_version is unchanged.
+	mutable int cached_height = 0;
+	mutable uint64_t cached_height_version = 0;
+
 	TreeItem *parent = nullptr; // parent item
 	TreeItem *prev = nullptr; // previous in list
 	TreeItem *next = nullptr; // next in list
@@ -451,6 +455,11 @@ private:
 	bool hide_root = false;
 	SelectMode select_mode = SELECT_SINGLE;
 
+	// Bumped on any change that can affect item heights, invalidating the cached ones.
+	uint64_t item_height_version = 1;
+	// Autowrapped cells get their height from the width assigned while drawing, so those trees are always walked entirely.
+	bool has_autowrap_cells = false;
+
 	int blocked = 0;
 
 	int drop_mode_flags = 0;
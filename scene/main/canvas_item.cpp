@@ -64,6 +64,9 @@ bool CanvasItem::is_visible_in_tree() const {
 }
 
 void CanvasItem::_propagate_visibility_changed(bool p_parent_visible_in_tree) {
+	if (parent_visible_in_tree == p_parent_visible_in_tree) {
+		return; // Nothing changes for this subtree.
+	}
 	parent_visible_in_tree = p_parent_visible_in_tree;
 	if (!visible) {
 		return;
@@ -85,7 +88,10 @@ void CanvasItem::set_visible(bool p_visible) {
 		return;
 	}
 
+	// Hiding or showing a large subtree updates every item in it, hand those calls to the server at once.
+	RenderingServer::get_singleton()->begin_batch();
 	_handle_visibility_change(p_visible);
+	RenderingServer::get_singleton()->end_batch();
 }
 
 void CanvasItem::_handle_visibility_change(bool p_visible) {
@@ -416,7 +422,9 @@ void CanvasItem::update_draw_order() {
 }
 
 void CanvasItem::_window_visibility_changed() {
+	RenderingServer::get_singleton()->begin_batch();
 	_propagate_visibility_changed(window->is_visible());
+	RenderingServer::get_singleton()->end_batch();
 }
 
 void CanvasItem::queue_redraw() {
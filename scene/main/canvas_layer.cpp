@@ -54,6 +54,7 @@ void CanvasLayer::set_visible(bool p_visible) {
 	visible = p_visible;
 	emit_signal(SceneStringName(visibility_changed));
 
+	RenderingServer::get_singleton()->begin_batch();
 	for (int i = 0; i < get_child_count(); i++) {
 		CanvasItem *c = Object::cast_to<CanvasItem>(get_child(i));
 		if (c) {
@@ -62,6 +63,7 @@ void CanvasLayer::set_visible(bool p_visible) {
 			c->_propagate_visibility_changed(p_visible);
 		}
 	}
+	RenderingServer::get_singleton()->end_batch();
 }
 
 void CanvasLayer::show() {
@@ -32,10 +32,123 @@
 #include "core/io/compression.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+HashMap<String, LocalVector<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+
+String HTTPRequest::_get_pool_key() const {
+	if (!use_tls) {
+		return vformat("http://%s:%d", url, port);
+	}
+	const Ref<X509Certificate> ca = tls_options.is_valid() ? tls_options->get_trusted_ca_chain() : Ref<X509Certificate>();
+	return vformat("https://%s:%d/%d/%s/%d", url, port, tls_options.is_valid() && tls_options->is_unsafe_client(), tls_options.is_valid() ? tls_options->get_common_name_override() : String(), ca.is_valid() ? (uint64_t)ca->get_instance_id() : 0);
+}
+
+Ref<HTTPClient> HTTPRequest::_acquire_connection(const String &p_key) {
+	MutexLock lock(connection_pool_mutex);
+	LocalVector<PooledConnection> *connections = connection_pool.getptr(p_key);
+	if (!connections) {
+		return Ref<HTTPClient>();
+	}
+	const uint64_t now = OS::get_singleton()->get_ticks_msec();
+	while (!connections->is_empty()) {
+		// Most recently released first, it is the least likely to have been closed by the server.
+		PooledConnection pc = (*connections)[connections->size() - 1];
+		connections->resize(connections->size() - 1);
+		if (now - pc.released_msec < CONNECTION_POOL_IDLE_TIMEOUT_MSEC) {
+			pc.client->set_blocking_mode(false);
+			pc.client->poll();
+			if (pc.client->get_status() == HTTPClient::STATUS_CONNECTED) {
+				return pc.client;
+			}
+		}
+		pc.client->close();
+	}
+	connection_pool.erase(p_key);
+	return Ref<HTTPClient>();
+}
+
+void HTTPRequest::_release_connection(const String &p_key, const Ref<HTTPClient> &p_client) {
+	MutexLock lock(connection_pool_mutex);
+	LocalVector<PooledConnection> &connections = connection_pool[p_key];
+	if ((int)connections.size() >= CONNECTION_POOL_MAX_PER_HOST) {
+		connections[0].client->close();
+		connections.remove_at(0);
+	}
+	PooledConnection pc;
+	pc.client = p_client;
+	pc.released_msec = OS::get_singleton()->get_ticks_msec();
+	connections.push_back(pc);
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	for (KeyValue<String, LocalVector<PooledConnection>> &E : connection_pool) {
+		for (PooledConnection &pc : E.value) {
+			pc.client->close();
+		}
+	}
+	connection_pool.clear();
+}
+
+void HTTPRequest::_set_client(const Ref<HTTPClient> &p_client) {
+	p_client->set_blocking_mode(client->is_blocking_mode_enabled());
+	p_client->set_read_chunk_size(client->get_read_chunk_size());
+	if (client != own_client) {
+		retired_client = client;
+	}
+	client = p_client;
+}
+
 Error HTTPRequest::_request() {
+	reused_connection = false;
+	if (_can_pool()) {
+		pool_key = _get_pool_key();
+		Ref<HTTPClient> pooled = _acquire_connection(pool_key);
+		if (pooled.is_valid()) {
+			_set_client(pooled);
+			reused_connection = true;
+			return OK;
+		}
+	}
+	if (client != own_client) {
+		client->close();
+		_set_client(own_client);
+	}
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+bool HTTPRequest::_is_method_idempotent(HTTPClient::Method p_method) {
+	switch (p_method) {
+		case HTTPClient::METHOD_GET:
+		case HTTPClient::METHOD_HEAD:
+		case HTTPClient::METHOD_PUT:
+		case HTTPClient::METHOD_DELETE:
+		case HTTPClient::METHOD_OPTIONS:
+		case HTTPClient::METHOD_TRACE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool HTTPRequest::_retry_on_fresh_connection() {
+	// A pooled connection might have been closed by the server while idle,
+	// only give up if a new connection fails too.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+	// The server may have acted on a request that was already written before the
+	// connection dropped, so only repeat it if doing so twice is harmless.
+	if (request_sent && !_is_method_idempotent(method)) {
+		return false;
+	}
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	_set_client(own_client);
+	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr) == OK;
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -182,6 +295,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_finish_request(false);
+}
+
+void HTTPRequest::_finish_request(bool p_keep_alive) {
 	timer->stop();
 
 	if (!requesting) {
@@ -199,7 +316,20 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	if (p_keep_alive && _can_pool() && client->get_status() == HTTPClient::STATUS_CONNECTED) {
+		_release_connection(pool_key, client);
+		if (client == own_client) {
+			own_client = Ref<HTTPClient>(HTTPClient::create());
+			own_client->set_read_chunk_size(client->get_read_chunk_size());
+		}
+	} else {
+		client->close();
+	}
+	if (client != own_client) {
+		_set_client(own_client);
+	}
+	retired_client.unref();
+	reused_connection = false;
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -209,6 +339,10 @@ void HTTPRequest::cancel_request() {
 
 bool HTTPRequest::_handle_response(bool *ret_value) {
 	if (!client->has_response()) {
+		if (_retry_on_fresh_connection()) {
+			*ret_value = false;
+			return true;
+		}
 		_defer_done(RESULT_NO_RESPONSE, 0, PackedStringArray(), PackedByteArray());
 		*ret_value = true;
 		return true;
@@ -290,6 +424,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_on_fresh_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -461,6 +598,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_on_fresh_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -478,7 +618,7 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	_finish_request(p_status == RESULT_SUCCESS);
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
 }
@@ -514,6 +654,15 @@ bool HTTPRequest::is_using_threads() const {
 	return use_threads.is_set();
 }
 
+void HTTPRequest::set_use_connection_pool(bool p_use) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+	use_connection_pool = p_use;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
 void HTTPRequest::set_accept_gzip(bool p_gzip) {
 	accept_gzip = p_gzip;
 }
@@ -574,10 +723,12 @@ int HTTPRequest::get_body_size() const {
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
 	client->set_http_proxy(p_host, p_port);
+	http_proxy_set = !p_host.is_empty();
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
 	client->set_https_proxy(p_host, p_port);
+	https_proxy_set = !p_host.is_empty();
 }
 
 void HTTPRequest::set_timeout(double p_timeout) {
@@ -610,6 +761,9 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_use_threads", "enable"), &HTTPRequest::set_use_threads);
 	ClassDB::bind_method(D_METHOD("is_using_threads"), &HTTPRequest::is_using_threads);
 
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
@@ -637,6 +791,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "download_file", PROPERTY_HINT_FILE), "set_download_file", "get_download_file");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
@@ -661,7 +816,8 @@ void HTTPRequest::_bind_methods() {
 }
 
 HTTPRequest::HTTPRequest() {
-	client = Ref<HTTPClient>(HTTPClient::create());
+	own_client = Ref<HTTPClient>(HTTPClient::create());
+	client = own_client;
 	tls_options = TLSOptions::client();
 	timer = memnew(Timer);
 	timer->set_one_shot(true);
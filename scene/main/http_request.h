@@ -33,7 +33,9 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -74,7 +76,9 @@ private:
 	Vector<uint8_t> request_data;
 
 	bool request_sent = false;
-	Ref<HTTPClient> client;
+	Ref<HTTPClient> client; // Either own_client or a connection taken from the pool.
+	Ref<HTTPClient> own_client;
+	Ref<HTTPClient> retired_client; // Kept alive until the request ends, client may still be read from the main thread.
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
@@ -95,6 +99,33 @@ private:
 
 	int redirections = 0;
 
+	// Keep-alive connections shared by all HTTPRequest nodes, by host and TLS configuration.
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t released_msec = 0;
+	};
+
+	static constexpr int CONNECTION_POOL_MAX_PER_HOST = 4;
+	static constexpr uint64_t CONNECTION_POOL_IDLE_TIMEOUT_MSEC = 30000;
+
+	static Mutex connection_pool_mutex;
+	static HashMap<String, LocalVector<PooledConnection>> connection_pool;
+
+	bool use_connection_pool = false;
+	bool http_proxy_set = false;
+	bool https_proxy_set = false;
+	bool reused_connection = false;
+	String pool_key;
+
+	_FORCE_INLINE_ bool _can_pool() const { return use_connection_pool && !http_proxy_set && !https_proxy_set; }
+	String _get_pool_key() const;
+	static Ref<HTTPClient> _acquire_connection(const String &p_key);
+	static void _release_connection(const String &p_key, const Ref<HTTPClient> &p_client);
+	void _set_client(const Ref<HTTPClient> &p_client);
+	static bool _is_method_idempotent(HTTPClient::Method p_method);
+	bool _retry_on_fresh_connection();
+	void _finish_request(bool p_keep_alive);
+
 	bool _update_connection();
 
 	int max_redirects = 8;
@@ -133,6 +164,11 @@ public:
 	void set_use_threads(bool p_use);
 	bool is_using_threads() const;
 
+	void set_use_connection_pool(bool p_use);
+	bool is_using_connection_pool() const;
+
+	static void clear_connection_pool();
+
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
@@ -46,6 +46,7 @@
 #include <stdint.h>
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint64_t> Node::node_path_version;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
 
@@ -1315,6 +1316,7 @@ void Node::set_name(const String &p_name) {
 	}
 	String old_name = data.name;
 	data.name = name;
+	node_path_version.increment();
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
@@ -1522,6 +1524,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	node_path_version.increment();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1620,12 +1623,28 @@ void Node::remove_child(Node *p_child) {
 
 	data.blocked--;
 
-	data.children_cache_dirty = true;
+	if (!data.children_cache_dirty) {
+		// Leave a hole instead of rebuilding the whole cache, so removing many children is linear overall.
+		// The other children keep their positions until the cache is read again.
+		uint32_t position = p_child->data.index;
+		if (p_child->data.internal_mode == INTERNAL_MODE_DISABLED) {
+			position += data.internal_children_front_count_cache;
+		} else if (p_child->data.internal_mode == INTERNAL_MODE_BACK) {
+			position += data.internal_children_front_count_cache + data.external_children_count_cache;
+		}
+		if (position < data.children_cache.size() && data.children_cache[position] == p_child) {
+			data.children_cache[position] = nullptr;
+			data.children_cache_holes++;
+		} else {
+			data.children_cache_dirty = true;
+		}
+	}
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
+	node_path_version.increment();
 
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
@@ -1636,6 +1655,36 @@ void Node::remove_child(Node *p_child) {
 }
 
 void Node::_update_children_cache_impl() const {
+	if (!data.children_cache_dirty) {
+		// Only removals happened since the last update, compact the cache keeping its order.
+		data.external_children_count_cache = 0;
+		data.internal_children_back_count_cache = 0;
+		data.internal_children_front_count_cache = 0;
+
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < data.children_cache.size(); i++) {
+			Node *child = data.children_cache[i];
+			if (!child) {
+				continue;
+			}
+			switch (child->data.internal_mode) {
+				case INTERNAL_MODE_DISABLED: {
+					child->data.index = data.external_children_count_cache++;
+				} break;
+				case INTERNAL_MODE_FRONT: {
+					child->data.index = data.internal_children_front_count_cache++;
+				} break;
+				case INTERNAL_MODE_BACK: {
+					child->data.index = data.internal_children_back_count_cache++;
+				} break;
+			}
+			data.children_cache[count++] = child;
+		}
+		data.children_cache.resize(count);
+		data.children_cache_holes = 0;
+		return;
+	}
+
 	// Assign children
 	data.children_cache.resize(data.children.size());
 	int idx = 0;
@@ -1664,6 +1713,7 @@ void Node::_update_children_cache_impl() const {
 		}
 	}
 	data.children_cache_dirty = false;
+	data.children_cache_holes = 0;
 }
 
 int Node::get_child_count(bool p_include_internal) const {
@@ -1726,6 +1776,16 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Single names are a lookup already, longer paths (as used by `$A/B` in scripts) are remembered until the tree changes.
+	const bool use_cache = p_path.get_name_count() > 1;
+	const uint64_t version = use_cache ? node_path_version.get() : 0;
+	if (use_cache && data.node_path_cache && data.node_path_cache_version == version) {
+		Node *const *cached = data.node_path_cache->getptr(p_path);
+		if (cached) {
+			return *cached;
+		}
+	}
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1777,6 +1837,16 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (use_cache && current) {
+		if (!data.node_path_cache) {
+			data.node_path_cache = memnew((HashMap<NodePath, Node *>));
+		} else if (data.node_path_cache_version != version || data.node_path_cache->size() >= 64) {
+			data.node_path_cache->clear();
+		}
+		data.node_path_cache_version = version;
+		data.node_path_cache->insert(p_path, current);
+	}
+
 	return current;
 }
 
@@ -2036,6 +2106,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	node_path_version.increment();
 
 	owner_changed_notify();
 }
@@ -2048,6 +2119,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	node_path_version.increment();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2062,6 +2134,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	node_path_version.increment();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2132,6 +2205,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	node_path_version.increment();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -3839,6 +3913,11 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
+	node_path_version.increment();
+
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
@@ -128,6 +128,8 @@ public:
 	};
 
 	static int orphan_node_count;
+	// Bumped whenever a change could alter what a NodePath resolves to, which invalidates every node's path cache.
+	static SafeNumeric<uint64_t> node_path_version;
 
 	void _update_process(bool p_enable, bool p_for_children);
 
@@ -168,8 +170,12 @@ private:
 		HashMap<StringName, Node *> children;
 		mutable bool children_cache_dirty = true;
 		mutable LocalVector<Node *> children_cache;
+		mutable uint32_t children_cache_holes = 0; // Removed children still in children_cache as null, see remove_child().
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
+		// Paths with several names already resolved from this node, see get_node_or_null().
+		mutable HashMap<NodePath, Node *> *node_path_cache = nullptr;
+		mutable uint64_t node_path_cache_version = 0;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
@@ -290,7 +296,7 @@ private:
 	void _clean_up_owner();
 
 	_FORCE_INLINE_ void _update_children_cache() const {
-		if (unlikely(data.children_cache_dirty)) {
+		if (unlikely(data.children_cache_dirty || data.children_cache_holes)) {
 			_update_children_cache_impl();
 		}
 	}
@@ -178,7 +178,18 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_change_pass++;
+
 	SelfList<Node> *n = xform_change_list.first();
+	if (!n) {
+		return;
+	}
+
+	// Most of these notifications end up as instance_set_transform() calls, send them in one go.
+	RenderingServer *rs = RenderingServer::get_singleton();
+	if (rs) {
+		rs->begin_batch();
+	}
 	while (n) {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
@@ -186,6 +197,9 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+	if (rs) {
+		rs->end_batch();
+	}
 }
 
 void SceneTree::_flush_ugc() {
@@ -226,6 +240,8 @@ void SceneTree::_update_group_order(Group &g) {
 }
 
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	ERR_FAIL_COND_MSG((p_call_flags & GROUP_CALL_THREAD_GROUP) && (p_call_flags & GROUP_CALL_UNIQUE), "GROUP_CALL_THREAD_GROUP can't be combined with GROUP_CALL_UNIQUE.");
+
 	Vector<Node *> nodes_copy;
 
 	{
@@ -264,7 +280,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read-only, so the copy stays shared with the group.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -278,7 +294,9 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->call_deferred_thread_groupp(p_function, p_args, p_argcount);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
 				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
 			} else {
@@ -292,7 +310,9 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->call_deferred_thread_groupp(p_function, p_args, p_argcount);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
 				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
 			} else {
@@ -328,7 +348,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -342,7 +362,9 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->notify_deferred_thread_group(p_notification);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				gr_nodes[i]->notification(p_notification, true);
 			} else {
 				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
@@ -355,7 +377,9 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->notify_deferred_thread_group(p_notification);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				gr_nodes[i]->notification(p_notification);
 			} else {
 				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
@@ -390,7 +414,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -404,7 +428,9 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->set_deferred_thread_group(p_name, p_value);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				gr_nodes[i]->set(p_name, p_value);
 			} else {
 				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
@@ -417,7 +443,9 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 				continue;
 			}
 
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			if (p_call_flags & GROUP_CALL_THREAD_GROUP) {
+				gr_nodes[i]->set_deferred_thread_group(p_name, p_value);
+			} else if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				gr_nodes[i]->set(p_name, p_value);
 			} else {
 				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
@@ -487,6 +515,7 @@ bool SceneTree::physics_process(double p_time) {
 	call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
 
 	_process(true);
+	_call_process_batches(true);
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -524,6 +553,7 @@ bool SceneTree::process(double p_time) {
 	flush_transform_notifications();
 
 	_process(false);
+	_call_process_batches(false);
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -967,6 +997,57 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
+void SceneTree::_call_process_batches(bool p_physics) {
+	if (process_batches.is_empty()) {
+		return;
+	}
+
+	// Callbacks may add or remove batches.
+	FrameLocalVector<ProcessBatch> batches;
+	batches.reserve(process_batches.size());
+	for (const ProcessBatch &batch : process_batches) {
+		batches.push_back(batch);
+	}
+	const Variant delta = p_physics ? physics_process_time : process_time;
+
+	for (const ProcessBatch &batch : batches) {
+		if (batch.physics != p_physics) {
+			continue;
+		}
+		if (!batch.callback.is_valid()) {
+			remove_process_batch(batch.group, batch.callback, batch.physics);
+			continue;
+		}
+
+		TypedArray<Node> nodes;
+		{
+			_THREAD_SAFE_METHOD_
+			HashMap<StringName, Group>::Iterator E = group_map.find(batch.group);
+			if (!E || E->value.nodes.is_empty()) {
+				continue;
+			}
+
+			_update_group_order(E->value);
+			Node **ptr = E->value.nodes.ptrw();
+			int node_count = E->value.nodes.size();
+			nodes.resize(node_count);
+
+			int valid_count = 0;
+			for (int i = 0; i < node_count; i++) {
+				if (ptr[i]->can_process()) {
+					nodes[valid_count++] = ptr[i];
+				}
+			}
+			if (valid_count == 0) {
+				continue;
+			}
+			nodes.resize(valid_count);
+		}
+
+		batch.callback.call(nodes, delta);
+	}
+}
+
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
 	_process_group(local_process_group_cache[p_index], p_physics);
@@ -1044,6 +1125,7 @@ void SceneTree::_process(bool p_physics) {
 				if (using_threads) {
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					xform_change_pass++; // Propagation passes aren't tracked in threads, forget the current one.
 				}
 			}
 
@@ -1181,7 +1263,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -1308,6 +1390,39 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	return ret;
 }
 
+void SceneTree::add_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_MSG(!p_callback.is_valid(), "Invalid callback for process batch.");
+	ERR_FAIL_COND_MSG(has_process_batch(p_group, p_callback, p_physics), vformat("Callback is already registered to process group \"%s\".", p_group));
+
+	ProcessBatch batch;
+	batch.group = p_group;
+	batch.callback = p_callback;
+	batch.physics = p_physics;
+	process_batches.push_back(batch);
+}
+
+void SceneTree::remove_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics) {
+	_THREAD_SAFE_METHOD_
+	for (uint32_t i = 0; i < process_batches.size(); i++) {
+		const ProcessBatch &batch = process_batches[i];
+		if (batch.group == p_group && batch.callback == p_callback && batch.physics == p_physics) {
+			process_batches.remove_at(i);
+			return;
+		}
+	}
+}
+
+bool SceneTree::has_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics) const {
+	_THREAD_SAFE_METHOD_
+	for (const ProcessBatch &batch : process_batches) {
+		if (batch.group == p_group && batch.callback == p_callback && batch.physics == p_physics) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool SceneTree::has_group(const StringName &p_identifier) const {
 	_THREAD_SAFE_METHOD_
 	return group_map.has(p_identifier);
@@ -1643,6 +1758,10 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
 	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
 
+	ClassDB::bind_method(D_METHOD("add_process_batch", "group", "callback", "physics"), &SceneTree::add_process_batch, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("remove_process_batch", "group", "callback", "physics"), &SceneTree::remove_process_batch, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("has_process_batch", "group", "callback", "physics"), &SceneTree::has_process_batch, DEFVAL(false));
+
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
 
@@ -1683,6 +1802,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_THREAD_GROUP);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -1706,7 +1826,7 @@ void SceneTree::get_argument_options(const StringName &p_function, int p_idx, Li
 	const String pf = p_function;
 	bool add_options = false;
 	if (p_idx == 0) {
-		add_options = pf == "get_nodes_in_group" || pf == "has_group" || pf == "get_first_node_in_group" || pf == "set_group" || pf == "notify_group" || pf == "call_group" || pf == "add_to_group";
+		add_options = pf == "get_nodes_in_group" || pf == "has_group" || pf == "get_first_node_in_group" || pf == "set_group" || pf == "notify_group" || pf == "call_group" || pf == "add_to_group" || pf == "add_process_batch" || pf == "remove_process_batch" || pf == "has_process_batch";
 	} else if (p_idx == 1) {
 		add_options = pf == "set_group_flags" || pf == "call_group_flags" || pf == "notify_group_flags";
 	}
@@ -1801,7 +1921,7 @@ SceneTree::SceneTree() {
 	root->set_snap_2d_vertices_to_pixel(snap_2d_vertices);
 
 	// We setup VRS for the main viewport here, in the editor this will have little effect.
-	const int vrs_mode = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/vrs/mode", PROPERTY_HINT_ENUM, String::utf8("Disabled,Texture,XR")), 0);
+	const int vrs_mode = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/vrs/mode", PROPERTY_HINT_ENUM, String::utf8("Disabled,Texture,XR,Adaptive")), 0);
 	root->set_vrs_mode(Viewport::VRSMode(vrs_mode));
 	const String vrs_texture_path = String(GLOBAL_DEF(PropertyInfo(Variant::STRING, "rendering/vrs/texture", PROPERTY_HINT_FILE, "*.bmp,*.png,*.tga,*.webp"), String())).strip_edges();
 	if (vrs_mode == 1 && !vrs_texture_path.is_empty()) {
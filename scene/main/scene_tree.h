@@ -137,6 +137,15 @@ private:
 	HashMap<StringName, Group> group_map;
 	bool _quit = false;
 
+	// Callbacks that process all nodes of a group at once.
+	struct ProcessBatch {
+		StringName group;
+		Callable callback;
+		bool physics = false;
+	};
+	LocalVector<ProcessBatch> process_batches;
+	void _call_process_batches(bool p_physics);
+
 	bool _physics_interpolation_enabled = false;
 
 	StringName tree_changed_name = "tree_changed";
@@ -233,6 +242,7 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	uint64_t xform_change_pass = 1; // Bumped on every transform flush, see Node3D::_propagate_transform_changed().
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -274,6 +284,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_THREAD_GROUP = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
@@ -382,6 +393,10 @@ public:
 	bool has_group(const StringName &p_identifier) const;
 	int get_node_count_in_group(const StringName &p_group) const;
 
+	void add_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics = false);
+	void remove_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics = false);
+	bool has_process_batch(const StringName &p_group, const Callable &p_callback, bool p_physics = false) const;
+
 	//void change_scene(const String& p_path);
 	//Node *get_loaded_scene();
 
@@ -673,6 +673,31 @@ void Viewport::_notification(int p_what) {
 	}
 }
 
+SafeNumeric<uint64_t> Viewport::physics_picking_version;
+
+bool Viewport::_update_physics_picking_state() {
+	Vector2 mouse_position = get_mouse_position();
+	Transform2D xform = get_global_canvas_transform() * get_canvas_transform();
+	Transform3D camera_3d_transform;
+#ifndef _3D_DISABLED
+	if (camera_3d) {
+		camera_3d_transform = camera_3d->get_global_transform();
+	}
+#endif // _3D_DISABLED
+	uint64_t version = physics_picking_version.get();
+	bool paused = get_tree()->is_paused();
+
+	bool changed = !physics_picking_state_valid || mouse_position != physics_picking_last_mouse_position || xform != physics_picking_last_canvas_transform || camera_3d_transform != physics_picking_last_camera_3d_transform || version != physics_picking_last_version || paused != physics_picking_last_paused;
+
+	physics_picking_state_valid = true;
+	physics_picking_last_mouse_position = mouse_position;
+	physics_picking_last_canvas_transform = xform;
+	physics_picking_last_camera_3d_transform = camera_3d_transform;
+	physics_picking_last_version = version;
+	physics_picking_last_paused = paused;
+	return changed;
+}
+
 void Viewport::_process_picking() {
 	if (!is_inside_tree()) {
 		return;
@@ -686,6 +711,7 @@ void Viewport::_process_picking() {
 	if (!gui.mouse_in_viewport) {
 		// Clear picking events if mouse has left viewport.
 		physics_picking_events.clear();
+		physics_picking_state_valid = false;
 		return;
 	}
 #ifndef _3D_DISABLED
@@ -719,6 +745,7 @@ void Viewport::_process_picking() {
 		// When the mouse is over a Control node, passive hovering would cause input events for Colliders, that are behind Control nodes.
 		// When parent SubViewportContainer ignores mouse, that setting should be respected.
 		create_passive_hover_event = false;
+		physics_picking_state_valid = false;
 	} else {
 		for (const Ref<InputEvent> &e : physics_picking_events) {
 			Ref<InputEventMouse> m = e;
@@ -730,6 +757,12 @@ void Viewport::_process_picking() {
 		}
 	}
 
+	if (create_passive_hover_event && !_update_physics_picking_state()) {
+		// Neither the mouse, the cameras nor any pickable object moved since the last passive hover event,
+		// so picking again would give the same results.
+		create_passive_hover_event = false;
+	}
+
 	if (create_passive_hover_event) {
 		// Create a mouse motion event. This is necessary because objects or camera may have moved.
 		// While this extra event is sent, it is checked if both camera and last object and last ID did not move.
@@ -2581,6 +2614,9 @@ void Viewport::_drop_mouse_focus() {
 }
 
 void Viewport::_drop_physics_mouseover(bool p_paused_only) {
+	if (!p_paused_only) {
+		physics_picking_state_valid = false;
+	}
 	_cleanup_mouseover_colliders(true, p_paused_only);
 
 #ifndef _3D_DISABLED
@@ -3335,6 +3371,7 @@ void Viewport::set_physics_object_picking(bool p_enable) {
 		add_to_group("_picking_viewports");
 	} else {
 		physics_picking_events.clear();
+		physics_picking_state_valid = false;
 		if (is_in_group("_picking_viewports")) {
 			remove_from_group("_picking_viewports");
 		}
@@ -3731,6 +3768,9 @@ void Viewport::set_vrs_mode(Viewport::VRSMode p_vrs_mode) {
 		case VRS_XR: {
 			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_XR);
 		} break;
+		case VRS_ADAPTIVE: {
+			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_ADAPTIVE);
+		} break;
 		default: {
 			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_DISABLED);
 		} break;
@@ -4587,6 +4627,49 @@ float Viewport::get_scaling_3d_scale() const {
 	return scaling_3d_scale;
 }
 
+void Viewport::set_scaling_3d_dynamic(bool p_enabled) {
+	ERR_MAIN_THREAD_GUARD;
+	if (scaling_3d_dynamic == p_enabled) {
+		return;
+	}
+
+	scaling_3d_dynamic = p_enabled;
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic(viewport, p_enabled);
+	notify_property_list_changed();
+}
+
+bool Viewport::is_scaling_3d_dynamic() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return scaling_3d_dynamic;
+}
+
+void Viewport::set_scaling_3d_dynamic_target_frame_time(float p_msec) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_target_frame_time = MAX(p_msec, 1.0);
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic_target_frame_time(viewport, scaling_3d_dynamic_target_frame_time);
+}
+
+float Viewport::get_scaling_3d_dynamic_target_frame_time() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_target_frame_time;
+}
+
+void Viewport::set_scaling_3d_dynamic_min_scale(float p_scale) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_min_scale = CLAMP(p_scale, 0.1, 2.0);
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic_min_scale(viewport, scaling_3d_dynamic_min_scale);
+}
+
+float Viewport::get_scaling_3d_dynamic_min_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_min_scale;
+}
+
+float Viewport::get_scaling_3d_dynamic_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return RS::get_singleton()->viewport_get_scaling_3d_dynamic_scale(viewport);
+}
+
 void Viewport::set_fsr_sharpness(float p_fsr_sharpness) {
 	ERR_MAIN_THREAD_GUARD;
 	if (fsr_sharpness == p_fsr_sharpness) {
@@ -4796,6 +4879,17 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_scaling_3d_scale", "scale"), &Viewport::set_scaling_3d_scale);
 	ClassDB::bind_method(D_METHOD("get_scaling_3d_scale"), &Viewport::get_scaling_3d_scale);
 
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic", "enabled"), &Viewport::set_scaling_3d_dynamic);
+	ClassDB::bind_method(D_METHOD("is_scaling_3d_dynamic"), &Viewport::is_scaling_3d_dynamic);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_target_frame_time", "msec"), &Viewport::set_scaling_3d_dynamic_target_frame_time);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_target_frame_time"), &Viewport::get_scaling_3d_dynamic_target_frame_time);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_min_scale", "scale"), &Viewport::set_scaling_3d_dynamic_min_scale);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_min_scale"), &Viewport::get_scaling_3d_dynamic_min_scale);
+
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_scale"), &Viewport::get_scaling_3d_dynamic_scale);
+
 	ClassDB::bind_method(D_METHOD("set_fsr_sharpness", "fsr_sharpness"), &Viewport::set_fsr_sharpness);
 	ClassDB::bind_method(D_METHOD("get_fsr_sharpness"), &Viewport::get_fsr_sharpness);
 
@@ -4836,10 +4930,13 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("Scaling 3D", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "scaling_3d_mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),FSR 2.2 (Slow)"), "set_scaling_3d_mode", "get_scaling_3d_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_scale", "get_scaling_3d_scale");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scaling_3d_dynamic"), "set_scaling_3d_dynamic", "is_scaling_3d_dynamic");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_target_frame_time", PROPERTY_HINT_RANGE, "1,100,0.1,suffix:ms"), "set_scaling_3d_dynamic_target_frame_time", "get_scaling_3d_dynamic_target_frame_time");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_min_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_dynamic_min_scale", "get_scaling_3d_dynamic_min_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), "set_texture_mipmap_bias", "get_texture_mipmap_bias");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), "set_fsr_sharpness", "get_fsr_sharpness");
 	ADD_GROUP("Variable Rate Shading", "vrs_");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_mode", PROPERTY_HINT_ENUM, "Disabled,Texture,Depth buffer,XR"), "set_vrs_mode", "get_vrs_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_mode", PROPERTY_HINT_ENUM, "Disabled,Texture,XR,Adaptive"), "set_vrs_mode", "get_vrs_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,Always"), "set_vrs_update_mode", "get_vrs_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "vrs_texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_vrs_texture", "get_vrs_texture");
 #endif
@@ -4963,6 +5060,7 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(VRS_DISABLED);
 	BIND_ENUM_CONSTANT(VRS_TEXTURE);
 	BIND_ENUM_CONSTANT(VRS_XR);
+	BIND_ENUM_CONSTANT(VRS_ADAPTIVE);
 	BIND_ENUM_CONSTANT(VRS_MAX);
 
 	BIND_ENUM_CONSTANT(VRS_UPDATE_DISABLED);
@@ -4979,6 +5077,10 @@ void Viewport::_validate_property(PropertyInfo &p_property) const {
 	if (vrs_mode == VRS_DISABLED && (p_property.name == "vrs_update_mode")) {
 		p_property.usage = PROPERTY_USAGE_NO_EDITOR;
 	}
+
+	if (!scaling_3d_dynamic && (p_property.name == "scaling_3d_dynamic_target_frame_time" || p_property.name == "scaling_3d_dynamic_min_scale")) {
+		p_property.usage = PROPERTY_USAGE_NO_EDITOR;
+	}
 }
 
 Viewport::Viewport() {
@@ -5019,6 +5121,9 @@ Viewport::Viewport() {
 #ifndef _3D_DISABLED
 	set_scaling_3d_mode((Viewport::Scaling3DMode)(int)GLOBAL_GET("rendering/scaling_3d/mode"));
 	set_scaling_3d_scale(GLOBAL_GET("rendering/scaling_3d/scale"));
+	set_scaling_3d_dynamic_target_frame_time(GLOBAL_GET("rendering/scaling_3d/dynamic/target_frame_time"));
+	set_scaling_3d_dynamic_min_scale(GLOBAL_GET("rendering/scaling_3d/dynamic/min_scale"));
+	set_scaling_3d_dynamic(GLOBAL_GET("rendering/scaling_3d/dynamic/enabled"));
 	set_fsr_sharpness((float)GLOBAL_GET("rendering/scaling_3d/fsr_sharpness"));
 	set_texture_mipmap_bias((float)GLOBAL_GET("rendering/textures/default_filters/texture_mipmap_bias"));
 #endif // _3D_DISABLED
@@ -210,6 +210,7 @@ public:
 		VRS_DISABLED,
 		VRS_TEXTURE,
 		VRS_XR,
+		VRS_ADAPTIVE,
 		VRS_MAX
 	};
 
@@ -267,6 +268,16 @@ private:
 	Transform3D physics_last_camera_transform;
 	ObjectID physics_last_id;
 
+	// What hover picking results depend on, as of the last picking pass.
+	bool physics_picking_state_valid = false;
+	Vector2 physics_picking_last_mouse_position;
+	Transform2D physics_picking_last_canvas_transform;
+	Transform3D physics_picking_last_camera_3d_transform;
+	uint64_t physics_picking_last_version = 0;
+	bool physics_picking_last_paused = false;
+	static SafeNumeric<uint64_t> physics_picking_version;
+	bool _update_physics_picking_state();
+
 	bool handle_input_locally = true;
 	bool local_input_handled = false;
 
@@ -300,6 +311,9 @@ private:
 
 	Scaling3DMode scaling_3d_mode = SCALING_3D_MODE_BILINEAR;
 	float scaling_3d_scale = 1.0;
+	bool scaling_3d_dynamic = false;
+	float scaling_3d_dynamic_target_frame_time = 16.6;
+	float scaling_3d_dynamic_min_scale = 0.5;
 	float fsr_sharpness = 0.2f;
 	float texture_mipmap_bias = 0.0f;
 	bool use_debanding = false;
@@ -493,6 +507,9 @@ public:
 
 	uint64_t get_processed_events_count() const { return event_count; }
 
+	// Called when pickable collision objects move or change, so hover picking runs again.
+	static void notify_physics_picking_changed() { physics_picking_version.increment(); }
+
 	void update_canvas_items();
 
 	Rect2 get_visible_rect() const;
@@ -553,6 +570,17 @@ public:
 	void set_scaling_3d_scale(float p_scaling_3d_scale);
 	float get_scaling_3d_scale() const;
 
+	void set_scaling_3d_dynamic(bool p_enabled);
+	bool is_scaling_3d_dynamic() const;
+
+	void set_scaling_3d_dynamic_target_frame_time(float p_msec);
+	float get_scaling_3d_dynamic_target_frame_time() const;
+
+	void set_scaling_3d_dynamic_min_scale(float p_scale);
+	float get_scaling_3d_dynamic_min_scale() const;
+
+	float get_scaling_3d_dynamic_scale() const;
+
 	void set_fsr_sharpness(float p_fsr_sharpness);
 	float get_fsr_sharpness() const;
 
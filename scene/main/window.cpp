@@ -2145,14 +2145,16 @@ Ref<Texture2D> Window::get_theme_icon(const StringName &p_name, const StringName
 		}
 	}
 
-	if (theme_icon_cache.has(p_theme_type) && theme_icon_cache[p_theme_type].has(p_name)) {
-		return theme_icon_cache[p_theme_type][p_name];
+	Theme::ThemeIconMap &type_cache = theme_icon_cache[p_theme_type];
+	const Ref<Texture2D> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<Texture2D> icon = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_ICON, p_name, theme_types);
-	theme_icon_cache[p_theme_type][p_name] = icon;
+	type_cache.insert(p_name, icon);
 	return icon;
 }
 
@@ -2169,14 +2171,16 @@ Ref<StyleBox> Window::get_theme_stylebox(const StringName &p_name, const StringN
 		}
 	}
 
-	if (theme_style_cache.has(p_theme_type) && theme_style_cache[p_theme_type].has(p_name)) {
-		return theme_style_cache[p_theme_type][p_name];
+	Theme::ThemeStyleMap &type_cache = theme_style_cache[p_theme_type];
+	const Ref<StyleBox> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<StyleBox> style = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_STYLEBOX, p_name, theme_types);
-	theme_style_cache[p_theme_type][p_name] = style;
+	type_cache.insert(p_name, style);
 	return style;
 }
 
@@ -2193,14 +2197,16 @@ Ref<Font> Window::get_theme_font(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (theme_font_cache.has(p_theme_type) && theme_font_cache[p_theme_type].has(p_name)) {
-		return theme_font_cache[p_theme_type][p_name];
+	Theme::ThemeFontMap &type_cache = theme_font_cache[p_theme_type];
+	const Ref<Font> *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Ref<Font> font = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT, p_name, theme_types);
-	theme_font_cache[p_theme_type][p_name] = font;
+	type_cache.insert(p_name, font);
 	return font;
 }
 
@@ -2217,14 +2223,16 @@ int Window::get_theme_font_size(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (theme_font_size_cache.has(p_theme_type) && theme_font_size_cache[p_theme_type].has(p_name)) {
-		return theme_font_size_cache[p_theme_type][p_name];
+	Theme::ThemeFontSizeMap &type_cache = theme_font_size_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	int font_size = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, p_name, theme_types);
-	theme_font_size_cache[p_theme_type][p_name] = font_size;
+	type_cache.insert(p_name, font_size);
 	return font_size;
 }
 
@@ -2241,14 +2249,16 @@ Color Window::get_theme_color(const StringName &p_name, const StringName &p_them
 		}
 	}
 
-	if (theme_color_cache.has(p_theme_type) && theme_color_cache[p_theme_type].has(p_name)) {
-		return theme_color_cache[p_theme_type][p_name];
+	Theme::ThemeColorMap &type_cache = theme_color_cache[p_theme_type];
+	const Color *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	Color color = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, p_name, theme_types);
-	theme_color_cache[p_theme_type][p_name] = color;
+	type_cache.insert(p_name, color);
 	return color;
 }
 
@@ -2265,14 +2275,16 @@ int Window::get_theme_constant(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (theme_constant_cache.has(p_theme_type) && theme_constant_cache[p_theme_type].has(p_name)) {
-		return theme_constant_cache[p_theme_type][p_name];
+	Theme::ThemeConstantMap &type_cache = theme_constant_cache[p_theme_type];
+	const int *cached = type_cache.getptr(p_name);
+	if (cached) {
+		return *cached;
 	}
 
 	List<StringName> theme_types;
 	theme_owner->get_theme_type_dependencies(this, p_theme_type, &theme_types);
 	int constant = theme_owner->get_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, p_name, theme_types);
-	theme_constant_cache[p_theme_type][p_name] = constant;
+	type_cache.insert(p_name, constant);
 	return constant;
 }
 
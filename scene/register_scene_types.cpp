@@ -134,6 +134,7 @@
 #include "scene/resources/placeholder_textures.h"
 #include "scene/resources/portable_compressed_texture.h"
 #include "scene/resources/resource_format_text.h"
+#include "scene/resources/scene_pool.h"
 #include "scene/resources/shader_include.h"
 #include "scene/resources/skeleton_profile.h"
 #include "scene/resources/sky.h"
@@ -302,6 +303,7 @@
 #include "scene/resources/3d/separation_ray_shape_3d.h"
 #include "scene/resources/3d/sky_material.h"
 #include "scene/resources/3d/sphere_shape_3d.h"
+#include "scene/resources/3d/streamed_mesh.h"
 #include "scene/resources/3d/world_3d.h"
 #include "scene/resources/3d/world_boundary_shape_3d.h"
 #endif // _3D_DISABLED
@@ -319,6 +321,11 @@ static Ref<ResourceFormatLoaderShader> resource_loader_shader;
 static Ref<ResourceFormatSaverShaderInclude> resource_saver_shader_include;
 static Ref<ResourceFormatLoaderShaderInclude> resource_loader_shader_include;
 
+#ifndef _3D_DISABLED
+static Ref<ResourceFormatSaverMeshLODChunks> resource_saver_mesh_lod_chunks;
+static Ref<ResourceFormatLoaderMeshLODChunks> resource_loader_mesh_lod_chunks;
+#endif // _3D_DISABLED
+
 void register_scene_types() {
 	OS::get_singleton()->benchmark_begin_measure("Scene", "Register Types");
 
@@ -355,6 +362,14 @@ void register_scene_types() {
 	resource_loader_shader_include.instantiate();
 	ResourceLoader::add_resource_format_loader(resource_loader_shader_include, true);
 
+#ifndef _3D_DISABLED
+	resource_saver_mesh_lod_chunks.instantiate();
+	ResourceSaver::add_resource_format_saver(resource_saver_mesh_lod_chunks);
+
+	resource_loader_mesh_lod_chunks.instantiate();
+	ResourceLoader::add_resource_format_loader(resource_loader_mesh_lod_chunks);
+#endif // _3D_DISABLED
+
 	OS::get_singleton()->yield(); // may take time to init
 
 	GDREGISTER_CLASS(Object);
@@ -886,6 +901,8 @@ void register_scene_types() {
 	BaseMaterial3D::init_shaders();
 
 	GDREGISTER_CLASS(MeshLibrary);
+	GDREGISTER_CLASS(MeshLODChunks);
+	GDREGISTER_CLASS(StreamedMesh);
 	GDREGISTER_CLASS(NavigationMeshSourceGeometryData3D);
 
 	OS::get_singleton()->yield(); // may take time to init
@@ -1018,6 +1035,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -1241,6 +1259,8 @@ void unregister_scene_types() {
 
 	SceneDebugger::deinitialize();
 
+	FontFile::save_glyph_cache();
+
 	ResourceLoader::remove_resource_format_loader(resource_loader_texture_layered);
 	resource_loader_texture_layered.unref();
 
@@ -1268,6 +1288,14 @@ void unregister_scene_types() {
 	ResourceLoader::remove_resource_format_loader(resource_loader_shader_include);
 	resource_loader_shader_include.unref();
 
+#ifndef _3D_DISABLED
+	ResourceSaver::remove_resource_format_saver(resource_saver_mesh_lod_chunks);
+	resource_saver_mesh_lod_chunks.unref();
+
+	ResourceLoader::remove_resource_format_loader(resource_loader_mesh_lod_chunks);
+	resource_loader_mesh_lod_chunks.unref();
+#endif // _3D_DISABLED
+
 	// StandardMaterial3D is not initialized when 3D is disabled, so it shouldn't be cleaned up either
 #ifndef _3D_DISABLED
 	BaseMaterial3D::finish_shaders();
@@ -1281,6 +1309,7 @@ void unregister_scene_types() {
 	CanvasItemMaterial::finish_shaders();
 	ColorPicker::finish_shaders();
 	GraphEdit::finish_shaders();
+	HTTPRequest::clear_connection_pool();
 	SceneStringNames::free();
 
 	OS::get_singleton()->benchmark_end_measure("Scene", "Unregister Types");
@@ -34,6 +34,7 @@
 #include "core/math/convex_hull.h"
 #include "core/math/random_pcg.h"
 #include "core/math/static_raycaster.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/surface_tool.h"
 
 #include <cstdint>
@@ -134,6 +135,61 @@ void ImporterMesh::Surface::_split_normals(Array &r_arrays, const LocalVector<in
 	}
 }
 
+template <typename T>
+static Vector<T> _remap_vertex_array(const Vector<T> &p_data, int p_vertex_count, const LocalVector<uint32_t> &p_remap, int p_new_vertex_count) {
+	const int elements = p_data.size() / p_vertex_count;
+	Vector<T> remapped;
+	remapped.resize(p_new_vertex_count * elements);
+	SurfaceTool::remap_vertex_func(remapped.ptrw(), p_data.ptr(), p_vertex_count, sizeof(T) * elements, p_remap.ptr());
+	return remapped;
+}
+
+void ImporterMesh::Surface::remap_vertices(const LocalVector<uint32_t> &p_remap, int p_new_vertex_count) {
+	_remap_vertices(arrays, p_remap, p_new_vertex_count);
+
+	for (BlendShape &blend_shape : blend_shape_data) {
+		_remap_vertices(blend_shape.arrays, p_remap, p_new_vertex_count);
+	}
+}
+
+void ImporterMesh::Surface::_remap_vertices(Array &r_arrays, const LocalVector<uint32_t> &p_remap, int p_new_vertex_count) {
+	ERR_FAIL_COND(r_arrays.size() != RS::ARRAY_MAX);
+
+	const int vertex_count = p_remap.size();
+
+	for (int i = 0; i < r_arrays.size(); i++) {
+		if (i == RS::ARRAY_INDEX) {
+			continue;
+		}
+
+		switch (r_arrays[i].get_type()) {
+			case Variant::NIL: {
+			} break;
+			case Variant::PACKED_VECTOR3_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<Vector3>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			case Variant::PACKED_VECTOR2_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<Vector2>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			case Variant::PACKED_FLOAT32_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<float>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			case Variant::PACKED_INT32_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<int32_t>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			case Variant::PACKED_BYTE_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<uint8_t>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			case Variant::PACKED_COLOR_ARRAY: {
+				r_arrays[i] = _remap_vertex_array<Color>(r_arrays[i], vertex_count, p_remap, p_new_vertex_count);
+			} break;
+			default: {
+				ERR_FAIL_MSG("Unhandled array type.");
+			} break;
+		}
+	}
+}
+
 void ImporterMesh::add_blend_shape(const String &p_name) {
 	ERR_FAIL_COND(surfaces.size() > 0);
 	blend_shapes.push_back(p_name);
@@ -156,6 +212,88 @@ Mesh::BlendShapeMode ImporterMesh::get_blend_shape_mode() const {
 	return blend_shape_mode;
 }
 
+Array ImporterMesh::Surface::_gather_vertices(const Array &p_arrays, const LocalVector<int> &p_vertices) {
+	Array new_arrays;
+	new_arrays.resize(RS::ARRAY_MAX);
+	ERR_FAIL_COND_V(p_arrays.size() != RS::ARRAY_MAX, new_arrays);
+
+	const PackedVector3Array &vertices = p_arrays[RS::ARRAY_VERTEX];
+	int vertex_count = vertices.size();
+	int new_vertex_count = p_vertices.size();
+	const int *vertices_ptr = p_vertices.ptr();
+
+	for (int i = 0; i < p_arrays.size(); i++) {
+		if (i == RS::ARRAY_INDEX || p_arrays[i].get_type() == Variant::NIL) {
+			continue;
+		}
+
+		switch (p_arrays[i].get_type()) {
+			case Variant::PACKED_VECTOR3_ARRAY: {
+				PackedVector3Array data = p_arrays[i];
+				PackedVector3Array new_data;
+				new_data.resize(new_vertex_count);
+				for (int j = 0; j < new_vertex_count; j++) {
+					new_data.write[j] = data[vertices_ptr[j]];
+				}
+				new_arrays[i] = new_data;
+			} break;
+			case Variant::PACKED_VECTOR2_ARRAY: {
+				PackedVector2Array data = p_arrays[i];
+				PackedVector2Array new_data;
+				new_data.resize(new_vertex_count);
+				for (int j = 0; j < new_vertex_count; j++) {
+					new_data.write[j] = data[vertices_ptr[j]];
+				}
+				new_arrays[i] = new_data;
+			} break;
+			case Variant::PACKED_FLOAT32_ARRAY: {
+				PackedFloat32Array data = p_arrays[i];
+				int elements = data.size() / vertex_count;
+				PackedFloat32Array new_data;
+				new_data.resize(new_vertex_count * elements);
+				for (int j = 0; j < new_vertex_count; j++) {
+					memcpy(&new_data.ptrw()[j * elements], &data.ptr()[vertices_ptr[j] * elements], sizeof(float) * elements);
+				}
+				new_arrays[i] = new_data;
+			} break;
+			case Variant::PACKED_INT32_ARRAY: {
+				PackedInt32Array data = p_arrays[i];
+				int elements = data.size() / vertex_count;
+				PackedInt32Array new_data;
+				new_data.resize(new_vertex_count * elements);
+				for (int j = 0; j < new_vertex_count; j++) {
+					memcpy(&new_data.ptrw()[j * elements], &data.ptr()[vertices_ptr[j] * elements], sizeof(int32_t) * elements);
+				}
+				new_arrays[i] = new_data;
+			} break;
+			case Variant::PACKED_BYTE_ARRAY: {
+				PackedByteArray data = p_arrays[i];
+				int elements = data.size() / vertex_count;
+				PackedByteArray new_data;
+				new_data.resize(new_vertex_count * elements);
+				for (int j = 0; j < new_vertex_count; j++) {
+					memcpy(&new_data.ptrw()[j * elements], &data.ptr()[vertices_ptr[j] * elements], sizeof(uint8_t) * elements);
+				}
+				new_arrays[i] = new_data;
+			} break;
+			case Variant::PACKED_COLOR_ARRAY: {
+				PackedColorArray data = p_arrays[i];
+				PackedColorArray new_data;
+				new_data.resize(new_vertex_count);
+				for (int j = 0; j < new_vertex_count; j++) {
+					new_data.write[j] = data[vertices_ptr[j]];
+				}
+				new_arrays[i] = new_data;
+			} break;
+			default: {
+				ERR_FAIL_V_MSG(new_arrays, "Unhandled array type.");
+			} break;
+		}
+	}
+
+	return new_arrays;
+}
+
 void ImporterMesh::add_surface(Mesh::PrimitiveType p_primitive, const Array &p_arrays, const TypedArray<Array> &p_blend_shapes, const Dictionary &p_lods, const Ref<Material> &p_material, const String &p_name, const uint64_t p_flags) {
 	ERR_FAIL_COND(p_blend_shapes.size() != blend_shapes.size());
 	ERR_FAIL_COND(p_arrays.size() != Mesh::ARRAY_MAX);
@@ -269,6 +407,62 @@ void ImporterMesh::set_surface_material(int p_surface, const Ref<Material> &p_ma
 	}                                                                                                              \
 	write_array[vert_idx] = transformed_vert;
 
+void ImporterMesh::optimize_vertex_order() {
+	if (!SurfaceTool::optimize_vertex_cache_func || !SurfaceTool::optimize_overdraw_func || !SurfaceTool::optimize_vertex_fetch_remap_func || !SurfaceTool::remap_vertex_func || !SurfaceTool::remap_index_func) {
+		return;
+	}
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+
+		Surface &surface = surfaces.write[i];
+		const PackedVector3Array vertices = surface.arrays[RS::ARRAY_VERTEX];
+		PackedInt32Array indices = surface.arrays[RS::ARRAY_INDEX];
+		const int vertex_count = vertices.size();
+		const int index_count = indices.size();
+		if (vertex_count == 0 || index_count == 0 || index_count % 3 != 0) {
+			continue;
+		}
+
+		LocalVector<float> positions;
+		positions.resize(vertex_count * 3);
+		for (int j = 0; j < vertex_count; j++) {
+			positions[j * 3 + 0] = vertices[j].x;
+			positions[j * 3 + 1] = vertices[j].y;
+			positions[j * 3 + 2] = vertices[j].z;
+		}
+
+		// Overdraw reordering works on cache optimized triangles, and may give up to 5% of the cache hits for it.
+		unsigned int *indices_ptr = (unsigned int *)indices.ptrw();
+		SurfaceTool::optimize_vertex_cache_func(indices_ptr, indices_ptr, index_count, vertex_count);
+		SurfaceTool::optimize_overdraw_func(indices_ptr, indices_ptr, index_count, positions.ptr(), vertex_count, sizeof(float) * 3, 1.05f);
+
+		// Store vertices in the order they are first used, so vertex fetches walk memory linearly.
+		LocalVector<uint32_t> remap;
+		remap.resize(vertex_count);
+		int new_vertex_count = SurfaceTool::optimize_vertex_fetch_remap_func(remap.ptr(), indices_ptr, index_count, vertex_count);
+		if (!surface.lods.is_empty()) {
+			// Imported LODs may use vertices the base indices don't, keep those at the end.
+			for (uint32_t &index : remap) {
+				if (index == UINT32_MAX) {
+					index = new_vertex_count++;
+				}
+			}
+		}
+
+		SurfaceTool::remap_index_func(indices_ptr, indices_ptr, index_count, remap.ptr());
+		surface.arrays[RS::ARRAY_INDEX] = indices;
+		for (Surface::LOD &lod : surface.lods) {
+			unsigned int *lod_indices_ptr = (unsigned int *)lod.indices.ptrw();
+			SurfaceTool::remap_index_func(lod_indices_ptr, lod_indices_ptr, lod.indices.size(), remap.ptr());
+		}
+
+		surface.remap_vertices(remap, new_vertex_count);
+	}
+}
+
 void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_split_angle, Array p_bone_transform_array) {
 	if (!SurfaceTool::simplify_scale_func) {
 		return;
@@ -280,120 +474,127 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 		return;
 	}
 
-	LocalVector<Transform3D> bone_transform_vector;
+	GenerateLODsParams params;
+	params.normal_merge_angle = p_normal_merge_angle;
+	params.normal_split_angle = p_normal_split_angle;
 	for (int i = 0; i < p_bone_transform_array.size(); i++) {
 		ERR_FAIL_COND(p_bone_transform_array[i].get_type() != Variant::TRANSFORM3D);
-		bone_transform_vector.push_back(p_bone_transform_array[i]);
+		params.bone_transforms.push_back(p_bone_transform_array[i]);
 	}
 
 	for (int i = 0; i < surfaces.size(); i++) {
-		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
-			continue;
-		}
-
-		surfaces.write[i].lods.clear();
-		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
-		PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
-		Vector<Vector3> normals = surfaces[i].arrays[RS::ARRAY_NORMAL];
-		Vector<float> tangents = surfaces[i].arrays[RS::ARRAY_TANGENT];
-		Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
-		Vector<Vector2> uv2s = surfaces[i].arrays[RS::ARRAY_TEX_UV2];
-		Vector<int> bones = surfaces[i].arrays[RS::ARRAY_BONES];
-		Vector<float> weights = surfaces[i].arrays[RS::ARRAY_WEIGHTS];
-
-		unsigned int index_count = indices.size();
-		unsigned int vertex_count = vertices.size();
-
-		if (index_count == 0) {
-			continue; //no lods if no indices
+		if (surfaces[i].primitive == Mesh::PRIMITIVE_TRIANGLES) {
+			params.surfaces.push_back(i);
 		}
+	}
 
-		const Vector3 *vertices_ptr = vertices.ptr();
-		const int *indices_ptr = indices.ptr();
-
-		if (normals.is_empty()) {
-			normals.resize(index_count);
-			Vector3 *n_ptr = normals.ptrw();
-			for (unsigned int j = 0; j < index_count; j += 3) {
-				const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
-				const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
-				const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
-				Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
-				n_ptr[j + 0] = n;
-				n_ptr[j + 1] = n;
-				n_ptr[j + 2] = n;
-			}
-		}
+	if (params.surfaces.size() > 1) {
+		// Surfaces are simplified independently, so spread them over the worker threads.
+		// Make sure the surface array is unique first, so writing to it from the tasks never copies it.
+		surfaces.ptrw();
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ImporterMesh::_generate_surface_lods, (const GenerateLODsParams *)&params, params.surfaces.size(), -1, false, SNAME("ImporterMeshGenerateLODs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (params.surfaces.size() == 1) {
+		_generate_surface_lods(0, &params);
+	}
+}
 
-		if (bones.size() > 0 && weights.size() && bone_transform_vector.size() > 0) {
-			Vector3 *vertices_ptrw = vertices.ptrw();
+void ImporterMesh::_generate_surface_lods(uint32_t p_index, const GenerateLODsParams *p_params) {
+	int i = p_params->surfaces[p_index];
 
-			// Apply bone transforms to regular surface.
-			unsigned int bone_weight_length = surfaces[i].flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
+	surfaces.write[i].lods.clear();
+	Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+	PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+	Vector<Vector3> normals = surfaces[i].arrays[RS::ARRAY_NORMAL];
+	Vector<float> tangents = surfaces[i].arrays[RS::ARRAY_TANGENT];
+	Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
+	Vector<Vector2> uv2s = surfaces[i].arrays[RS::ARRAY_TEX_UV2];
+	Vector<int> bones = surfaces[i].arrays[RS::ARRAY_BONES];
+	Vector<float> weights = surfaces[i].arrays[RS::ARRAY_WEIGHTS];
 
-			const int *bo = bones.ptr();
-			const float *we = weights.ptr();
+	unsigned int index_count = indices.size();
+	unsigned int vertex_count = vertices.size();
 
-			for (unsigned int j = 0; j < vertex_count; j++) {
-				VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, bone_transform_vector, bo, we)
-			}
+	if (index_count == 0) {
+		return; //no lods if no indices
+	}
 
-			vertices_ptr = vertices.ptr();
+	const Vector3 *vertices_ptr = vertices.ptr();
+	const int *indices_ptr = indices.ptr();
+
+	if (normals.is_empty()) {
+		normals.resize(index_count);
+		Vector3 *n_ptr = normals.ptrw();
+		for (unsigned int j = 0; j < index_count; j += 3) {
+			const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
+			const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
+			const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
+			Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
+			n_ptr[j + 0] = n;
+			n_ptr[j + 1] = n;
+			n_ptr[j + 2] = n;
 		}
+	}
 
-		float normal_merge_threshold = Math::cos(Math::deg_to_rad(p_normal_merge_angle));
-		float normal_pre_split_threshold = Math::cos(Math::deg_to_rad(MIN(180.0f, p_normal_split_angle * 2.0f)));
-		float normal_split_threshold = Math::cos(Math::deg_to_rad(p_normal_split_angle));
-		const Vector3 *normals_ptr = normals.ptr();
+	if (bones.size() > 0 && weights.size() && p_params->bone_transforms.size() > 0) {
+		Vector3 *vertices_ptrw = vertices.ptrw();
 
-		HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
+		// Apply bone transforms to regular surface.
+		unsigned int bone_weight_length = surfaces[i].flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
 
-		LocalVector<int> vertex_remap;
-		LocalVector<int> vertex_inverse_remap;
-		LocalVector<Vector3> merged_vertices;
-		LocalVector<Vector3> merged_normals;
-		LocalVector<int> merged_normals_counts;
-		const Vector2 *uvs_ptr = uvs.ptr();
-		const Vector2 *uv2s_ptr = uv2s.ptr();
-		const float *tangents_ptr = tangents.ptr();
+		const int *bo = bones.ptr();
+		const float *we = weights.ptr();
 
 		for (unsigned int j = 0; j < vertex_count; j++) {
-			const Vector3 &v = vertices_ptr[j];
-			const Vector3 &n = normals_ptr[j];
-
-			HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
-
-			if (E) {
-				const LocalVector<Pair<int, int>> &close_verts = E->value;
-
-				bool found = false;
-				for (const Pair<int, int> &idx : close_verts) {
-					bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
-					bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
-					bool is_tang_aligned = !tangents_ptr || (tangents_ptr[j * 4 + 3] < 0) == (tangents_ptr[idx.second * 4 + 3] < 0);
-					ERR_FAIL_INDEX(idx.second, normals.size());
-					bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
-					if (is_uvs_close && is_uv2s_close && is_normals_close && is_tang_aligned) {
-						vertex_remap.push_back(idx.first);
-						merged_normals[idx.first] += normals[idx.second];
-						merged_normals_counts[idx.first]++;
-						found = true;
-						break;
-					}
-				}
+			VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, p_params->bone_transforms, bo, we)
+		}
 
-				if (!found) {
-					int vcount = merged_vertices.size();
-					unique_vertices[v].push_back(Pair<int, int>(vcount, j));
-					vertex_inverse_remap.push_back(j);
-					merged_vertices.push_back(v);
-					vertex_remap.push_back(vcount);
-					merged_normals.push_back(normals_ptr[j]);
-					merged_normals_counts.push_back(1);
+		vertices_ptr = vertices.ptr();
+	}
+
+	float normal_merge_threshold = Math::cos(Math::deg_to_rad(p_params->normal_merge_angle));
+	float normal_pre_split_threshold = Math::cos(Math::deg_to_rad(MIN(180.0f, p_params->normal_split_angle * 2.0f)));
+	float normal_split_threshold = Math::cos(Math::deg_to_rad(p_params->normal_split_angle));
+	const Vector3 *normals_ptr = normals.ptr();
+
+	HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
+
+	LocalVector<int> vertex_remap;
+	LocalVector<int> vertex_inverse_remap;
+	LocalVector<Vector3> merged_vertices;
+	LocalVector<Vector3> merged_normals;
+	LocalVector<int> merged_normals_counts;
+	const Vector2 *uvs_ptr = uvs.ptr();
+	const Vector2 *uv2s_ptr = uv2s.ptr();
+	const float *tangents_ptr = tangents.ptr();
+
+	for (unsigned int j = 0; j < vertex_count; j++) {
+		const Vector3 &v = vertices_ptr[j];
+		const Vector3 &n = normals_ptr[j];
+
+		HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
+
+		if (E) {
+			const LocalVector<Pair<int, int>> &close_verts = E->value;
+
+			bool found = false;
+			for (const Pair<int, int> &idx : close_verts) {
+				bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
+				bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
+				bool is_tang_aligned = !tangents_ptr || (tangents_ptr[j * 4 + 3] < 0) == (tangents_ptr[idx.second * 4 + 3] < 0);
+				ERR_FAIL_INDEX(idx.second, normals.size());
+				bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
+				if (is_uvs_close && is_uv2s_close && is_normals_close && is_tang_aligned) {
+					vertex_remap.push_back(idx.first);
+					merged_normals[idx.first] += normals[idx.second];
+					merged_normals_counts[idx.first]++;
+					found = true;
+					break;
 				}
-			} else {
+			}
+
+			if (!found) {
 				int vcount = merged_vertices.size();
-				unique_vertices[v] = LocalVector<Pair<int, int>>();
 				unique_vertices[v].push_back(Pair<int, int>(vcount, j));
 				vertex_inverse_remap.push_back(j);
 				merged_vertices.push_back(v);
@@ -401,283 +602,303 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 				merged_normals.push_back(normals_ptr[j]);
 				merged_normals_counts.push_back(1);
 			}
+		} else {
+			int vcount = merged_vertices.size();
+			unique_vertices[v] = LocalVector<Pair<int, int>>();
+			unique_vertices[v].push_back(Pair<int, int>(vcount, j));
+			vertex_inverse_remap.push_back(j);
+			merged_vertices.push_back(v);
+			vertex_remap.push_back(vcount);
+			merged_normals.push_back(normals_ptr[j]);
+			merged_normals_counts.push_back(1);
 		}
+	}
 
-		LocalVector<int> merged_indices;
-		merged_indices.resize(index_count);
-		for (unsigned int j = 0; j < index_count; j++) {
-			merged_indices[j] = vertex_remap[indices[j]];
-		}
+	LocalVector<int> merged_indices;
+	merged_indices.resize(index_count);
+	for (unsigned int j = 0; j < index_count; j++) {
+		merged_indices[j] = vertex_remap[indices[j]];
+	}
 
-		unsigned int merged_vertex_count = merged_vertices.size();
-		const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
-		const int32_t *merged_indices_ptr = merged_indices.ptr();
+	unsigned int merged_vertex_count = merged_vertices.size();
+	const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
+	const int32_t *merged_indices_ptr = merged_indices.ptr();
 
-		{
-			const int *counts_ptr = merged_normals_counts.ptr();
-			Vector3 *merged_normals_ptrw = merged_normals.ptr();
-			for (unsigned int j = 0; j < merged_vertex_count; j++) {
-				merged_normals_ptrw[j] /= counts_ptr[j];
-			}
+	{
+		const int *counts_ptr = merged_normals_counts.ptr();
+		Vector3 *merged_normals_ptrw = merged_normals.ptr();
+		for (unsigned int j = 0; j < merged_vertex_count; j++) {
+			merged_normals_ptrw[j] /= counts_ptr[j];
 		}
+	}
 
-		const float normal_weights[3] = {
-			// Give some weight to normal preservation, may be worth exposing as an import setting
-			2.0f, 2.0f, 2.0f
-		};
+	const float normal_weights[3] = {
+		// Give some weight to normal preservation, may be worth exposing as an import setting
+		2.0f, 2.0f, 2.0f
+	};
 
-		Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
-		float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
+	Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
+	float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
 
-		unsigned int index_target = 12; // Start with the smallest target, 4 triangles
-		unsigned int last_index_count = 0;
+	unsigned int index_target = 12; // Start with the smallest target, 4 triangles
+	unsigned int last_index_count = 0;
 
-		int split_vertex_count = vertex_count;
-		LocalVector<Vector3> split_vertex_normals;
-		LocalVector<int> split_vertex_indices;
-		split_vertex_normals.reserve(index_count / 3);
-		split_vertex_indices.reserve(index_count / 3);
+	int split_vertex_count = vertex_count;
+	LocalVector<Vector3> split_vertex_normals;
+	LocalVector<int> split_vertex_indices;
+	split_vertex_normals.reserve(index_count / 3);
+	split_vertex_indices.reserve(index_count / 3);
 
-		RandomPCG pcg;
-		pcg.seed(123456789); // Keep seed constant across imports
+	RandomPCG pcg;
+	pcg.seed(123456789); // Keep seed constant across imports
 
-		Ref<StaticRaycaster> raycaster = StaticRaycaster::create();
-		if (raycaster.is_valid()) {
-			raycaster->add_mesh(vertices, indices, 0);
-			raycaster->commit();
+	Ref<StaticRaycaster> raycaster = StaticRaycaster::create();
+	if (raycaster.is_valid()) {
+		raycaster->add_mesh(vertices, indices, 0);
+		raycaster->commit();
+	}
+
+	const float max_mesh_error = FLT_MAX; // We don't want to limit by error, just by index target
+	float mesh_error = 0.0f;
+
+	while (index_target < index_count) {
+		PackedInt32Array new_indices;
+		new_indices.resize(index_count);
+
+		Vector<float> merged_normals_f32 = vector3_to_float32_array(merged_normals.ptr(), merged_normals.size());
+		const int simplify_options = SurfaceTool::SIMPLIFY_LOCK_BORDER;
+
+		size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
+				(unsigned int *)new_indices.ptrw(),
+				(const uint32_t *)merged_indices_ptr, index_count,
+				merged_vertices_f32.ptr(), merged_vertex_count,
+				sizeof(float) * 3, // Vertex stride
+				merged_normals_f32.ptr(),
+				sizeof(float) * 3, // Attribute stride
+				normal_weights, 3,
+				index_target,
+				max_mesh_error,
+				simplify_options,
+				&mesh_error);
+
+		if (new_index_count < last_index_count * 1.5f) {
+			index_target = index_target * 1.5f;
+			continue;
 		}
 
-		const float max_mesh_error = FLT_MAX; // We don't want to limit by error, just by index target
-		float mesh_error = 0.0f;
-
-		while (index_target < index_count) {
-			PackedInt32Array new_indices;
-			new_indices.resize(index_count);
-
-			Vector<float> merged_normals_f32 = vector3_to_float32_array(merged_normals.ptr(), merged_normals.size());
-			const int simplify_options = SurfaceTool::SIMPLIFY_LOCK_BORDER;
-
-			size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
-					(unsigned int *)new_indices.ptrw(),
-					(const uint32_t *)merged_indices_ptr, index_count,
-					merged_vertices_f32.ptr(), merged_vertex_count,
-					sizeof(float) * 3, // Vertex stride
-					merged_normals_f32.ptr(),
-					sizeof(float) * 3, // Attribute stride
-					normal_weights, 3,
-					index_target,
-					max_mesh_error,
-					simplify_options,
-					&mesh_error);
-
-			if (new_index_count < last_index_count * 1.5f) {
-				index_target = index_target * 1.5f;
-				continue;
-			}
+		if (new_index_count == 0 || (new_index_count >= (index_count * 0.75f))) {
+			break;
+		}
+		if (new_index_count > 5000000) {
+			// This limit theoretically shouldn't be needed, but it's here
+			// as an ad-hoc fix to prevent a crash with complex meshes.
+			// The crash still happens with limit of 6000000, but 5000000 works.
+			// In the future, identify what's causing that crash and fix it.
+			WARN_PRINT("Mesh LOD generation failed for mesh " + get_name() + " surface " + itos(i) + ", mesh is too complex. Some automatic LODs were not generated.");
+			break;
+		}
 
-			if (new_index_count == 0 || (new_index_count >= (index_count * 0.75f))) {
-				break;
-			}
-			if (new_index_count > 5000000) {
-				// This limit theoretically shouldn't be needed, but it's here
-				// as an ad-hoc fix to prevent a crash with complex meshes.
-				// The crash still happens with limit of 6000000, but 5000000 works.
-				// In the future, identify what's causing that crash and fix it.
-				WARN_PRINT("Mesh LOD generation failed for mesh " + get_name() + " surface " + itos(i) + ", mesh is too complex. Some automatic LODs were not generated.");
-				break;
-			}
+		new_indices.resize(new_index_count);
 
-			new_indices.resize(new_index_count);
+		LocalVector<LocalVector<int>> vertex_corners;
+		vertex_corners.resize(vertex_count);
+		{
+			int *ptrw = new_indices.ptrw();
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				const int &remapped = vertex_inverse_remap[ptrw[j]];
+				vertex_corners[remapped].push_back(j);
+				ptrw[j] = remapped;
+			}
+		}
 
-			LocalVector<LocalVector<int>> vertex_corners;
-			vertex_corners.resize(vertex_count);
-			{
-				int *ptrw = new_indices.ptrw();
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					const int &remapped = vertex_inverse_remap[ptrw[j]];
-					vertex_corners[remapped].push_back(j);
-					ptrw[j] = remapped;
+		if (raycaster.is_valid()) {
+			float error_factor = 1.0f / (scale * MAX(mesh_error, 0.15));
+			const float ray_bias = 0.05;
+			float ray_length = ray_bias + mesh_error * scale * 3.0f;
+
+			Vector<StaticRaycaster::Ray> rays;
+			LocalVector<Vector2> ray_uvs;
+
+			int32_t *new_indices_ptr = new_indices.ptrw();
+
+			int current_ray_count = 0;
+			for (unsigned int j = 0; j < new_index_count; j += 3) {
+				const Vector3 &v0 = vertices_ptr[new_indices_ptr[j + 0]];
+				const Vector3 &v1 = vertices_ptr[new_indices_ptr[j + 1]];
+				const Vector3 &v2 = vertices_ptr[new_indices_ptr[j + 2]];
+				Vector3 face_normal = vec3_cross(v0 - v2, v0 - v1);
+				float face_area = face_normal.length(); // Actually twice the face area, since it's the same error_factor on all faces, we don't care
+				if (!Math::is_finite(face_area) || face_area == 0) {
+					WARN_PRINT_ONCE("Ignoring face with non-finite normal in LOD generation.");
+					continue;
 				}
-			}
 
-			if (raycaster.is_valid()) {
-				float error_factor = 1.0f / (scale * MAX(mesh_error, 0.15));
-				const float ray_bias = 0.05;
-				float ray_length = ray_bias + mesh_error * scale * 3.0f;
-
-				Vector<StaticRaycaster::Ray> rays;
-				LocalVector<Vector2> ray_uvs;
-
-				int32_t *new_indices_ptr = new_indices.ptrw();
-
-				int current_ray_count = 0;
-				for (unsigned int j = 0; j < new_index_count; j += 3) {
-					const Vector3 &v0 = vertices_ptr[new_indices_ptr[j + 0]];
-					const Vector3 &v1 = vertices_ptr[new_indices_ptr[j + 1]];
-					const Vector3 &v2 = vertices_ptr[new_indices_ptr[j + 2]];
-					Vector3 face_normal = vec3_cross(v0 - v2, v0 - v1);
-					float face_area = face_normal.length(); // Actually twice the face area, since it's the same error_factor on all faces, we don't care
-					if (!Math::is_finite(face_area) || face_area == 0) {
-						WARN_PRINT_ONCE("Ignoring face with non-finite normal in LOD generation.");
-						continue;
-					}
+				Vector3 dir = face_normal / face_area;
+				int ray_count = CLAMP(5.0 * face_area * error_factor, 16, 64);
 
-					Vector3 dir = face_normal / face_area;
-					int ray_count = CLAMP(5.0 * face_area * error_factor, 16, 64);
+				rays.resize(current_ray_count + ray_count);
+				StaticRaycaster::Ray *rays_ptr = rays.ptrw();
 
-					rays.resize(current_ray_count + ray_count);
-					StaticRaycaster::Ray *rays_ptr = rays.ptrw();
+				ray_uvs.resize(current_ray_count + ray_count);
+				Vector2 *ray_uvs_ptr = ray_uvs.ptr();
 
-					ray_uvs.resize(current_ray_count + ray_count);
-					Vector2 *ray_uvs_ptr = ray_uvs.ptr();
+				for (int k = 0; k < ray_count; k++) {
+					float u = pcg.randf();
+					float v = pcg.randf();
 
-					for (int k = 0; k < ray_count; k++) {
-						float u = pcg.randf();
-						float v = pcg.randf();
+					if (u + v >= 1.0f) {
+						u = 1.0f - u;
+						v = 1.0f - v;
+					}
 
-						if (u + v >= 1.0f) {
-							u = 1.0f - u;
-							v = 1.0f - v;
-						}
+					u = 0.9f * u + 0.05f / 3.0f; // Give barycentric coordinates some padding, we don't want to sample right on the edge
+					v = 0.9f * v + 0.05f / 3.0f; // v = (v - one_third) * 0.95f + one_third;
+					float w = 1.0f - u - v;
 
-						u = 0.9f * u + 0.05f / 3.0f; // Give barycentric coordinates some padding, we don't want to sample right on the edge
-						v = 0.9f * v + 0.05f / 3.0f; // v = (v - one_third) * 0.95f + one_third;
-						float w = 1.0f - u - v;
+					Vector3 org = v0 * w + v1 * u + v2 * v;
+					org -= dir * ray_bias;
+					rays_ptr[current_ray_count + k] = StaticRaycaster::Ray(org, dir, 0.0f, ray_length);
+					rays_ptr[current_ray_count + k].id = j / 3;
+					ray_uvs_ptr[current_ray_count + k] = Vector2(u, v);
+				}
 
-						Vector3 org = v0 * w + v1 * u + v2 * v;
-						org -= dir * ray_bias;
-						rays_ptr[current_ray_count + k] = StaticRaycaster::Ray(org, dir, 0.0f, ray_length);
-						rays_ptr[current_ray_count + k].id = j / 3;
-						ray_uvs_ptr[current_ray_count + k] = Vector2(u, v);
-					}
+				current_ray_count += ray_count;
+			}
 
-					current_ray_count += ray_count;
-				}
+			raycaster->intersect(rays);
 
-				raycaster->intersect(rays);
+			LocalVector<Vector3> ray_normals;
+			LocalVector<real_t> ray_normal_weights;
 
-				LocalVector<Vector3> ray_normals;
-				LocalVector<real_t> ray_normal_weights;
+			ray_normals.resize(new_index_count);
+			ray_normal_weights.resize(new_index_count);
 
-				ray_normals.resize(new_index_count);
-				ray_normal_weights.resize(new_index_count);
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				ray_normal_weights[j] = 0.0f;
+			}
 
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					ray_normal_weights[j] = 0.0f;
+			const StaticRaycaster::Ray *rp = rays.ptr();
+			for (int j = 0; j < rays.size(); j++) {
+				if (rp[j].geomID != 0) { // Ray missed
+					continue;
 				}
 
-				const StaticRaycaster::Ray *rp = rays.ptr();
-				for (int j = 0; j < rays.size(); j++) {
-					if (rp[j].geomID != 0) { // Ray missed
-						continue;
-					}
-
-					if (rp[j].normal.normalized().dot(rp[j].dir) > 0.0f) { // Hit a back face.
-						continue;
-					}
+				if (rp[j].normal.normalized().dot(rp[j].dir) > 0.0f) { // Hit a back face.
+					continue;
+				}
 
-					const float &u = rp[j].u;
-					const float &v = rp[j].v;
-					const float w = 1.0f - u - v;
-
-					const unsigned int &hit_tri_id = rp[j].primID;
-					const unsigned int &orig_tri_id = rp[j].id;
-
-					const Vector3 &n0 = normals_ptr[indices_ptr[hit_tri_id * 3 + 0]];
-					const Vector3 &n1 = normals_ptr[indices_ptr[hit_tri_id * 3 + 1]];
-					const Vector3 &n2 = normals_ptr[indices_ptr[hit_tri_id * 3 + 2]];
-					Vector3 normal = n0 * w + n1 * u + n2 * v;
-
-					Vector2 orig_uv = ray_uvs[j];
-					const real_t orig_bary[3] = { 1.0f - orig_uv.x - orig_uv.y, orig_uv.x, orig_uv.y };
-					for (int k = 0; k < 3; k++) {
-						int idx = orig_tri_id * 3 + k;
-						real_t weight = orig_bary[k];
-						ray_normals[idx] += normal * weight;
-						ray_normal_weights[idx] += weight;
-					}
+				const float &u = rp[j].u;
+				const float &v = rp[j].v;
+				const float w = 1.0f - u - v;
+
+				const unsigned int &hit_tri_id = rp[j].primID;
+				const unsigned int &orig_tri_id = rp[j].id;
+
+				const Vector3 &n0 = normals_ptr[indices_ptr[hit_tri_id * 3 + 0]];
+				const Vector3 &n1 = normals_ptr[indices_ptr[hit_tri_id * 3 + 1]];
+				const Vector3 &n2 = normals_ptr[indices_ptr[hit_tri_id * 3 + 2]];
+				Vector3 normal = n0 * w + n1 * u + n2 * v;
+
+				Vector2 orig_uv = ray_uvs[j];
+				const real_t orig_bary[3] = { 1.0f - orig_uv.x - orig_uv.y, orig_uv.x, orig_uv.y };
+				for (int k = 0; k < 3; k++) {
+					int idx = orig_tri_id * 3 + k;
+					real_t weight = orig_bary[k];
+					ray_normals[idx] += normal * weight;
+					ray_normal_weights[idx] += weight;
 				}
+			}
 
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					if (ray_normal_weights[j] < 1.0f) { // Not enough data, the new normal would be just a bad guess
-						ray_normals[j] = Vector3();
-					} else {
-						ray_normals[j] /= ray_normal_weights[j];
-					}
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				if (ray_normal_weights[j] < 1.0f) { // Not enough data, the new normal would be just a bad guess
+					ray_normals[j] = Vector3();
+				} else {
+					ray_normals[j] /= ray_normal_weights[j];
 				}
+			}
 
-				LocalVector<LocalVector<int>> normal_group_indices;
-				LocalVector<Vector3> normal_group_averages;
-				normal_group_indices.reserve(24);
-				normal_group_averages.reserve(24);
+			LocalVector<LocalVector<int>> normal_group_indices;
+			LocalVector<Vector3> normal_group_averages;
+			normal_group_indices.reserve(24);
+			normal_group_averages.reserve(24);
 
-				for (unsigned int j = 0; j < vertex_count; j++) {
-					const LocalVector<int> &corners = vertex_corners[j];
-					const Vector3 &vertex_normal = normals_ptr[j];
+			for (unsigned int j = 0; j < vertex_count; j++) {
+				const LocalVector<int> &corners = vertex_corners[j];
+				const Vector3 &vertex_normal = normals_ptr[j];
 
-					for (const int &corner_idx : corners) {
-						const Vector3 &ray_normal = ray_normals[corner_idx];
+				for (const int &corner_idx : corners) {
+					const Vector3 &ray_normal = ray_normals[corner_idx];
 
-						if (ray_normal.length_squared() < CMP_EPSILON2) {
-							continue;
-						}
+					if (ray_normal.length_squared() < CMP_EPSILON2) {
+						continue;
+					}
 
-						bool found = false;
-						for (unsigned int l = 0; l < normal_group_indices.size(); l++) {
-							LocalVector<int> &group_indices = normal_group_indices[l];
-							Vector3 n = normal_group_averages[l] / group_indices.size();
-							if (n.dot(ray_normal) > normal_pre_split_threshold) {
-								found = true;
-								group_indices.push_back(corner_idx);
-								normal_group_averages[l] += ray_normal;
-								break;
-							}
+					bool found = false;
+					for (unsigned int l = 0; l < normal_group_indices.size(); l++) {
+						LocalVector<int> &group_indices = normal_group_indices[l];
+						Vector3 n = normal_group_averages[l] / group_indices.size();
+						if (n.dot(ray_normal) > normal_pre_split_threshold) {
+							found = true;
+							group_indices.push_back(corner_idx);
+							normal_group_averages[l] += ray_normal;
+							break;
 						}
+					}
 
-						if (!found) {
-							normal_group_indices.push_back({ corner_idx });
-							normal_group_averages.push_back(ray_normal);
-						}
+					if (!found) {
+						normal_group_indices.push_back({ corner_idx });
+						normal_group_averages.push_back(ray_normal);
 					}
+				}
+
+				for (unsigned int k = 0; k < normal_group_indices.size(); k++) {
+					LocalVector<int> &group_indices = normal_group_indices[k];
+					Vector3 n = normal_group_averages[k] / group_indices.size();
 
-					for (unsigned int k = 0; k < normal_group_indices.size(); k++) {
-						LocalVector<int> &group_indices = normal_group_indices[k];
-						Vector3 n = normal_group_averages[k] / group_indices.size();
-
-						if (vertex_normal.dot(n) < normal_split_threshold) {
-							split_vertex_indices.push_back(j);
-							split_vertex_normals.push_back(n);
-							int new_idx = split_vertex_count++;
-							for (const int &index : group_indices) {
-								new_indices_ptr[index] = new_idx;
-							}
+					if (vertex_normal.dot(n) < normal_split_threshold) {
+						split_vertex_indices.push_back(j);
+						split_vertex_normals.push_back(n);
+						int new_idx = split_vertex_count++;
+						for (const int &index : group_indices) {
+							new_indices_ptr[index] = new_idx;
 						}
 					}
-
-					normal_group_indices.clear();
-					normal_group_averages.clear();
 				}
-			}
 
-			Surface::LOD lod;
-			lod.distance = MAX(mesh_error * scale, CMP_EPSILON2);
-			lod.indices = new_indices;
-			surfaces.write[i].lods.push_back(lod);
-			index_target = MAX(new_index_count, index_target) * 2;
-			last_index_count = new_index_count;
-
-			if (mesh_error == 0.0f) {
-				break;
+				normal_group_indices.clear();
+				normal_group_averages.clear();
 			}
 		}
 
-		surfaces.write[i].split_normals(split_vertex_indices, split_vertex_normals);
-		surfaces.write[i].lods.sort_custom<Surface::LODComparator>();
+		Surface::LOD lod;
+		lod.distance = MAX(mesh_error * scale, CMP_EPSILON2);
+		lod.indices = new_indices;
+		surfaces.write[i].lods.push_back(lod);
+		index_target = MAX(new_index_count, index_target) * 2;
+		last_index_count = new_index_count;
+
+		if (mesh_error == 0.0f) {
+			break;
+		}
+	}
 
+	surfaces.write[i].split_normals(split_vertex_indices, split_vertex_normals);
+	surfaces.write[i].lods.sort_custom<Surface::LODComparator>();
+
+	for (int j = 0; j < surfaces.write[i].lods.size(); j++) {
+		Surface::LOD &lod = surfaces.write[i].lods.write[j];
+		unsigned int *lod_indices_ptr = (unsigned int *)lod.indices.ptrw();
+		SurfaceTool::optimize_vertex_cache_func(lod_indices_ptr, lod_indices_ptr, lod.indices.size(), split_vertex_count);
+	}
+
+	// Group triangles into compact clusters, so each range of the index buffer covers a small, coherent patch.
+	if (SurfaceTool::build_meshlets_func) {
+		const Vector<Vector3> split_vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		PackedInt32Array base_indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+		SurfaceTool::cluster_mesh_indices(base_indices, split_vertices);
+		surfaces.write[i].arrays[RS::ARRAY_INDEX] = base_indices;
 		for (int j = 0; j < surfaces.write[i].lods.size(); j++) {
-			Surface::LOD &lod = surfaces.write[i].lods.write[j];
-			unsigned int *lod_indices_ptr = (unsigned int *)lod.indices.ptrw();
-			SurfaceTool::optimize_vertex_cache_func(lod_indices_ptr, lod_indices_ptr, lod.indices.size(), split_vertex_count);
+			SurfaceTool::cluster_mesh_indices(surfaces.write[i].lods.write[j].indices, split_vertices);
 		}
 	}
 }
@@ -738,6 +959,130 @@ Ref<ArrayMesh> ImporterMesh::get_mesh(const Ref<ArrayMesh> &p_base) {
 	return mesh;
 }
 
+Ref<StreamedMesh> ImporterMesh::get_streamed_mesh(int p_resident_level, const Ref<StreamedMesh> &p_base) {
+	ERR_FAIL_COND_V(surfaces.is_empty(), Ref<StreamedMesh>());
+	ERR_FAIL_COND_V(p_resident_level < 0, Ref<StreamedMesh>());
+
+	int level_count = 1;
+	for (const Surface &surface : surfaces) {
+		level_count = MAX(level_count, surface.lods.size() + 1);
+	}
+
+	// Level 0 has the full detail, each following level uses the next LOD of every surface
+	// and only keeps the vertices that it and the coarser LODs use.
+	Ref<MeshLODChunks> lod_chunks;
+	lod_chunks.instantiate();
+	for (int level = 0; level < level_count; level++) {
+		Array level_surfaces;
+		float edge_length = level == 0 ? 0.0f : FLT_MAX;
+
+		for (const Surface &surface : surfaces) {
+			Vector<Surface::LOD> lods = surface.lods;
+			lods.sort_custom<Surface::LODComparator>();
+			int surface_level = MIN(level, lods.size());
+			if (level > 0 && surface_level == level) {
+				edge_length = MIN(edge_length, lods[level - 1].distance);
+			}
+
+			Array arrays = surface.arrays;
+			Array blend_shape_arrays;
+			for (const Surface::BlendShape &blend_shape : surface.blend_shape_data) {
+				blend_shape_arrays.push_back(blend_shape.arrays);
+			}
+			Dictionary level_lods;
+
+			Vector<Vector<int>> level_indices;
+			level_indices.push_back(surface_level == 0 ? Vector<int>(surface.arrays[RS::ARRAY_INDEX]) : lods[surface_level - 1].indices);
+			for (int i = surface_level; i < lods.size(); i++) {
+				level_indices.push_back(lods[i].indices);
+			}
+
+			if (!level_indices[0].is_empty()) {
+				int vertex_count = PackedVector3Array(surface.arrays[RS::ARRAY_VERTEX]).size();
+				LocalVector<int> vertex_remap;
+				vertex_remap.resize(vertex_count);
+				for (int i = 0; i < vertex_count; i++) {
+					vertex_remap[i] = -1;
+				}
+				for (const Vector<int> &indices : level_indices) {
+					for (int index : indices) {
+						ERR_FAIL_INDEX_V(index, vertex_count, Ref<StreamedMesh>());
+						vertex_remap[index] = 0;
+					}
+				}
+
+				// Keep the original vertex order, it was optimized for the vertex cache.
+				LocalVector<int> level_vertices;
+				for (int i = 0; i < vertex_count; i++) {
+					if (vertex_remap[i] == 0) {
+						vertex_remap[i] = level_vertices.size();
+						level_vertices.push_back(i);
+					}
+				}
+
+				for (Vector<int> &indices : level_indices) {
+					int *indices_ptr = indices.ptrw();
+					for (int i = 0; i < indices.size(); i++) {
+						indices_ptr[i] = vertex_remap[indices_ptr[i]];
+					}
+				}
+
+				arrays = Surface::_gather_vertices(surface.arrays, level_vertices);
+				arrays[RS::ARRAY_INDEX] = level_indices[0];
+				for (int i = 1; i < level_indices.size(); i++) {
+					level_lods[lods[surface_level + i - 1].distance] = level_indices[i];
+				}
+				for (int i = 0; i < blend_shape_arrays.size(); i++) {
+					blend_shape_arrays[i] = Surface::_gather_vertices(blend_shape_arrays[i], level_vertices);
+				}
+			}
+
+			RS::SurfaceData surface_data;
+			Error err = RS::get_singleton()->mesh_create_surface_data_from_arrays(&surface_data, RS::PrimitiveType(surface.primitive), arrays, blend_shape_arrays, level_lods, surface.flags);
+			ERR_FAIL_COND_V(err != OK, Ref<StreamedMesh>());
+
+			Dictionary data = ArrayMesh::surface_data_to_dictionary(surface_data);
+			if (!surface.name.is_empty()) {
+				data["name"] = surface.name;
+			}
+			level_surfaces.push_back(data);
+		}
+
+		lod_chunks->add_level(level_surfaces, edge_length);
+	}
+
+	Ref<StreamedMesh> streamed_mesh = p_base;
+	if (streamed_mesh.is_null()) {
+		streamed_mesh.instantiate();
+	}
+	streamed_mesh->set_name(get_name());
+	if (has_meta("import_id")) {
+		streamed_mesh->set_meta("import_id", get_meta("import_id"));
+	}
+	for (int i = 0; i < blend_shapes.size(); i++) {
+		streamed_mesh->add_blend_shape(blend_shapes[i]);
+	}
+	streamed_mesh->set_blend_shape_mode(blend_shape_mode);
+
+	int resident_level = MIN(p_resident_level, level_count - 1);
+	streamed_mesh->set_lod_chunks(lod_chunks);
+	streamed_mesh->set_resident_level(resident_level);
+	streamed_mesh->load_lod_level(resident_level);
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].material.is_valid()) {
+			streamed_mesh->surface_set_material(i, surfaces[i].material);
+		}
+	}
+
+	streamed_mesh->set_lightmap_size_hint(lightmap_size_hint);
+
+	if (shadow_mesh.is_valid()) {
+		streamed_mesh->set_shadow_mesh(shadow_mesh->get_mesh());
+	}
+
+	return streamed_mesh;
+}
+
 void ImporterMesh::clear() {
 	surfaces.clear();
 	blend_shapes.clear();
@@ -1367,8 +1712,10 @@ void ImporterMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_surface_name", "surface_idx", "name"), &ImporterMesh::set_surface_name);
 	ClassDB::bind_method(D_METHOD("set_surface_material", "surface_idx", "material"), &ImporterMesh::set_surface_material);
 
+	ClassDB::bind_method(D_METHOD("optimize_vertex_order"), &ImporterMesh::optimize_vertex_order);
 	ClassDB::bind_method(D_METHOD("generate_lods", "normal_merge_angle", "normal_split_angle", "bone_transform_array"), &ImporterMesh::generate_lods);
 	ClassDB::bind_method(D_METHOD("get_mesh", "base_mesh"), &ImporterMesh::get_mesh, DEFVAL(Ref<ArrayMesh>()));
+	ClassDB::bind_method(D_METHOD("get_streamed_mesh", "resident_level", "base_mesh"), &ImporterMesh::get_streamed_mesh, DEFVAL(Ref<StreamedMesh>()));
 	ClassDB::bind_method(D_METHOD("clear"), &ImporterMesh::clear);
 
 	ClassDB::bind_method(D_METHOD("_set_data", "data"), &ImporterMesh::_set_data);
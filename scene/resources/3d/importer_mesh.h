@@ -35,6 +35,7 @@
 #include "core/templates/local_vector.h"
 #include "scene/resources/3d/concave_polygon_shape_3d.h"
 #include "scene/resources/3d/convex_polygon_shape_3d.h"
+#include "scene/resources/3d/streamed_mesh.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/navigation_mesh.h"
 
@@ -71,6 +72,9 @@ class ImporterMesh : public Resource {
 
 		void split_normals(const LocalVector<int> &p_indices, const LocalVector<Vector3> &p_normals);
 		static void _split_normals(Array &r_arrays, const LocalVector<int> &p_indices, const LocalVector<Vector3> &p_normals);
+		static Array _gather_vertices(const Array &p_arrays, const LocalVector<int> &p_vertices);
+		void remap_vertices(const LocalVector<uint32_t> &p_remap, int p_new_vertex_count);
+		static void _remap_vertices(Array &r_arrays, const LocalVector<uint32_t> &p_remap, int p_new_vertex_count);
 	};
 	Vector<Surface> surfaces;
 	Vector<String> blend_shapes;
@@ -82,6 +86,15 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	struct GenerateLODsParams {
+		float normal_merge_angle = 0.0f;
+		float normal_split_angle = 0.0f;
+		LocalVector<Transform3D> bone_transforms;
+		LocalVector<int> surfaces;
+	};
+
+	void _generate_surface_lods(uint32_t p_index, const GenerateLODsParams *p_params);
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
@@ -112,6 +125,7 @@ public:
 
 	void set_surface_material(int p_surface, const Ref<Material> &p_material);
 
+	void optimize_vertex_order();
 	void generate_lods(float p_normal_merge_angle, float p_normal_split_angle, Array p_skin_pose_transform_array);
 
 	void create_shadow_mesh();
@@ -129,6 +143,7 @@ public:
 
 	bool has_mesh() const;
 	Ref<ArrayMesh> get_mesh(const Ref<ArrayMesh> &p_base = Ref<ArrayMesh>());
+	Ref<StreamedMesh> get_streamed_mesh(int p_resident_level, const Ref<StreamedMesh> &p_base = Ref<StreamedMesh>());
 	void clear();
 };
 
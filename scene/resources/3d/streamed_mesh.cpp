@@ -0,0 +1,454 @@
+/**************************************************************************/
+/*  streamed_mesh.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "streamed_mesh.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/io/compression.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+
+// MeshLODChunks
+
+Vector<uint8_t> MeshLODChunks::_get_level_data(int p_level) const {
+	const Level &level = levels[p_level];
+	if (!level.data.is_empty()) {
+		return level.data;
+	}
+
+	Vector<uint8_t> data;
+	Ref<FileAccess> f = FileAccess::open(path_to_file, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), data, vformat("Unable to open mesh LOD chunks: %s.", path_to_file));
+	f->seek(level.offset);
+	data.resize(level.compressed_size);
+	ERR_FAIL_COND_V_MSG(f->get_buffer(data.ptrw(), level.compressed_size) != level.compressed_size, Vector<uint8_t>(), vformat("Truncated mesh LOD chunks: %s.", path_to_file));
+	return data;
+}
+
+Error MeshLODChunks::load(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Unable to open mesh LOD chunks: %s.", p_path));
+
+	uint8_t header[4];
+	f->get_buffer(header, 4);
+	ERR_FAIL_COND_V_MSG(header[0] != 'G' || header[1] != 'D' || header[2] != 'M' || header[3] != 'L', ERR_FILE_CORRUPT, vformat("Mesh LOD chunks file is corrupt (bad header): %s.", p_path));
+	uint32_t version = f->get_32();
+	ERR_FAIL_COND_V_MSG(version > FORMAT_VERSION, ERR_FILE_UNRECOGNIZED, vformat("Mesh LOD chunks file is too new: %s.", p_path));
+
+	Vector<Level> new_levels;
+	new_levels.resize(f->get_32());
+	for (Level &level : new_levels) {
+		level.edge_length = f->get_float();
+		level.size = f->get_32();
+		level.compressed_size = f->get_32();
+		level.offset = f->get_64();
+		ERR_FAIL_COND_V_MSG(level.offset + level.compressed_size > f->get_length(), ERR_FILE_CORRUPT, vformat("Mesh LOD chunks file is corrupt (bad chunk table): %s.", p_path));
+	}
+	ERR_FAIL_COND_V_MSG(f->eof_reached() || new_levels.is_empty(), ERR_FILE_CORRUPT, vformat("Mesh LOD chunks file is corrupt (truncated): %s.", p_path));
+
+	// Chunks are only read when a level is requested.
+	levels = new_levels;
+	path_to_file = p_path;
+	emit_changed();
+	return OK;
+}
+
+Error MeshLODChunks::save(const String &p_path) const {
+	ERR_FAIL_COND_V_MSG(levels.is_empty(), ERR_UNCONFIGURED, "Mesh LOD chunks have no levels to save.");
+
+	// Gather everything first, in case this overwrites the file it was loaded from.
+	Vector<Vector<uint8_t>> data;
+	for (int i = 0; i < levels.size(); i++) {
+		data.push_back(_get_level_data(i));
+		ERR_FAIL_COND_V(data[i].size() != int64_t(levels[i].compressed_size), ERR_FILE_CANT_READ);
+	}
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Unable to save mesh LOD chunks: %s.", p_path));
+
+	f->store_8('G');
+	f->store_8('D');
+	f->store_8('M');
+	f->store_8('L');
+	f->store_32(FORMAT_VERSION);
+	f->store_32(levels.size());
+
+	uint64_t offset = 12 + levels.size() * 20;
+	for (const Level &level : levels) {
+		f->store_float(level.edge_length);
+		f->store_32(level.size);
+		f->store_32(level.compressed_size);
+		f->store_64(offset);
+		offset += level.compressed_size;
+	}
+	for (const Vector<uint8_t> &chunk : data) {
+		f->store_buffer(chunk);
+	}
+
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		return ERR_CANT_CREATE;
+	}
+	return OK;
+}
+
+void MeshLODChunks::add_level(const Array &p_surfaces, float p_edge_length) {
+	ERR_FAIL_COND_MSG(!levels.is_empty() && p_edge_length < levels[levels.size() - 1].edge_length, "LOD levels must be added from the finest to the coarsest.");
+
+	// Materials are resources, they stay with the mesh.
+	Array surfaces;
+	for (int i = 0; i < p_surfaces.size(); i++) {
+		Dictionary surface = p_surfaces[i];
+		if (surface.has("material")) {
+			surface = surface.duplicate();
+			surface.erase("material");
+		}
+		surfaces.push_back(surface);
+	}
+
+	int len;
+	Error err = encode_variant(surfaces, nullptr, len, false);
+	ERR_FAIL_COND_MSG(err != OK, "Unable to encode mesh LOD surfaces.");
+
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	encode_variant(surfaces, buffer.ptrw(), len, false);
+
+	Level level;
+	level.edge_length = p_edge_length;
+	level.size = len;
+	level.data.resize(Compression::get_max_compressed_buffer_size(len, Compression::MODE_ZSTD));
+	int compressed_size = Compression::compress(level.data.ptrw(), buffer.ptr(), len, Compression::MODE_ZSTD);
+	ERR_FAIL_COND_MSG(compressed_size < 0, "Unable to compress mesh LOD surfaces.");
+	level.data.resize(compressed_size);
+	level.compressed_size = compressed_size;
+	levels.push_back(level);
+	emit_changed();
+}
+
+int MeshLODChunks::get_level_count() const {
+	return levels.size();
+}
+
+float MeshLODChunks::get_level_edge_length(int p_level) const {
+	ERR_FAIL_INDEX_V(p_level, levels.size(), 0.0);
+	return levels[p_level].edge_length;
+}
+
+Array MeshLODChunks::get_level_surfaces(int p_level) const {
+	ERR_FAIL_INDEX_V(p_level, levels.size(), Array());
+
+	// Safe to call from any thread, the file is opened for each read.
+	Vector<uint8_t> data = _get_level_data(p_level);
+	ERR_FAIL_COND_V(data.is_empty(), Array());
+
+	const Level &level = levels[p_level];
+	Vector<uint8_t> buffer;
+	buffer.resize(level.size);
+	int size = Compression::decompress(buffer.ptrw(), level.size, data.ptr(), data.size(), Compression::MODE_ZSTD);
+	ERR_FAIL_COND_V_MSG(size != int(level.size), Array(), vformat("Mesh LOD chunk %d is corrupt: %s.", p_level, path_to_file));
+
+	Variant surfaces;
+	Error err = decode_variant(surfaces, buffer.ptr(), size, nullptr, false);
+	ERR_FAIL_COND_V_MSG(err != OK || surfaces.get_type() != Variant::ARRAY, Array(), vformat("Mesh LOD chunk %d is corrupt: %s.", p_level, path_to_file));
+	return surfaces;
+}
+
+void MeshLODChunks::clear() {
+	levels.clear();
+	path_to_file = String();
+	emit_changed();
+}
+
+void MeshLODChunks::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_level", "surfaces", "edge_length"), &MeshLODChunks::add_level);
+	ClassDB::bind_method(D_METHOD("get_level_count"), &MeshLODChunks::get_level_count);
+	ClassDB::bind_method(D_METHOD("get_level_edge_length", "level"), &MeshLODChunks::get_level_edge_length);
+	ClassDB::bind_method(D_METHOD("get_level_surfaces", "level"), &MeshLODChunks::get_level_surfaces);
+	ClassDB::bind_method(D_METHOD("clear"), &MeshLODChunks::clear);
+}
+
+// StreamedMesh
+
+Mutex StreamedMesh::stream_mutex;
+SelfList<StreamedMesh>::List StreamedMesh::stream_meshes;
+int StreamedMesh::stream_loads = 0;
+
+void StreamedMesh::_set_level_surfaces(const Array &p_surfaces) {
+	// Levels don't store materials, keep the ones in use.
+	for (int i = 0; i < p_surfaces.size() && i < get_surface_count(); i++) {
+		Ref<Material> material = surface_get_material(i);
+		if (material.is_valid()) {
+			Dictionary surface = p_surfaces[i];
+			surface["material"] = material;
+		}
+	}
+	_set_surfaces(p_surfaces);
+}
+
+void StreamedMesh::_stream_update() {
+	bool stream = lod_chunks.is_valid() && resident_level > 0 && resident_level < lod_chunks->get_level_count() && !Engine::get_singleton()->is_editor_hint() && RS::get_singleton() && bool(GLOBAL_GET("rendering/mesh_lod/streaming/enabled"));
+	if (stream == streamed) {
+		return;
+	}
+	if (!stream) {
+		_stream_clear();
+		return;
+	}
+
+	MutexLock lock(stream_mutex);
+	streamed = true;
+	stream_demand_frame = Engine::get_singleton()->get_frames_drawn();
+	stream_failed = false;
+	stream_meshes.add(&stream_list);
+	RS::get_singleton()->mesh_set_lod_streaming(get_rid(), true);
+	const Callable update = callable_mp_static(&StreamedMesh::update_streaming);
+	if (!RS::get_singleton()->is_connected(SNAME("frame_pre_draw"), update)) {
+		RS::get_singleton()->connect(SNAME("frame_pre_draw"), update);
+	}
+}
+
+void StreamedMesh::_stream_load_task(void *p_userdata) {
+	StreamLoad *load = (StreamLoad *)p_userdata;
+	load->surfaces = load->lod_chunks->get_level_surfaces(load->level);
+}
+
+void StreamedMesh::_stream_start_load(int p_level) {
+	stream_load = memnew(StreamLoad);
+	stream_load->lod_chunks = lod_chunks;
+	stream_load->level = p_level;
+	stream_task = WorkerThreadPool::get_singleton()->add_native_task(&StreamedMesh::_stream_load_task, stream_load, false, SNAME("StreamedMesh streaming"));
+	stream_loads++;
+}
+
+void StreamedMesh::_stream_finish_load() {
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+	stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	stream_loads--;
+
+	StreamLoad *load = stream_load;
+	stream_load = nullptr;
+
+	if (load->surfaces.size() == get_surface_count()) {
+		_set_level_surfaces(load->surfaces);
+		lod_level = load->level;
+	} else {
+		stream_failed = true; // Keep what is resident rather than retrying every frame.
+		ERR_PRINT(vformat("Failed to stream LOD %d of mesh: %s.", load->level, get_path()));
+	}
+	memdelete(load);
+}
+
+void StreamedMesh::_stream_clear() {
+	if (!streamed) {
+		return;
+	}
+
+	MutexLock lock(stream_mutex);
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+		stream_loads--;
+		memdelete(stream_load);
+		stream_load = nullptr;
+	}
+	stream_meshes.remove(&stream_list);
+	RS::get_singleton()->mesh_set_lod_streaming(get_rid(), false);
+	streamed = false;
+}
+
+void StreamedMesh::set_lod_chunks(const Ref<MeshLODChunks> &p_lod_chunks) {
+	_stream_clear();
+	lod_chunks = p_lod_chunks;
+	_stream_update();
+}
+
+Ref<MeshLODChunks> StreamedMesh::get_lod_chunks() const {
+	return lod_chunks;
+}
+
+void StreamedMesh::set_resident_level(int p_level) {
+	ERR_FAIL_COND(p_level < 0);
+	_stream_clear();
+	resident_level = p_level;
+	lod_level = p_level; // The surfaces saved with the mesh are the resident ones.
+	_stream_update();
+}
+
+int StreamedMesh::get_resident_level() const {
+	return resident_level;
+}
+
+Error StreamedMesh::load_lod_level(int p_level) {
+	ERR_FAIL_COND_V(lod_chunks.is_null(), ERR_UNCONFIGURED);
+	ERR_FAIL_INDEX_V(p_level, lod_chunks->get_level_count(), ERR_INVALID_PARAMETER);
+
+	Array level_surfaces = lod_chunks->get_level_surfaces(p_level);
+	ERR_FAIL_COND_V(level_surfaces.is_empty(), ERR_FILE_CORRUPT);
+
+	MutexLock lock(stream_mutex);
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		_stream_finish_load(); // Would replace these surfaces otherwise.
+	}
+	_set_level_surfaces(level_surfaces);
+	lod_level = p_level;
+	stream_demand_frame = Engine::get_singleton()->get_frames_drawn();
+	return OK;
+}
+
+int StreamedMesh::get_lod_level() const {
+	return lod_level;
+}
+
+bool StreamedMesh::is_streamed() const {
+	return streamed;
+}
+
+void StreamedMesh::update_streaming() {
+	MutexLock lock(stream_mutex);
+	if (!stream_meshes.first()) {
+		return;
+	}
+
+	// Query every mesh at once, each server call waits for the render thread.
+	Vector<RID> mesh_rids;
+	for (SelfList<StreamedMesh> *E = stream_meshes.first(); E; E = E->next()) {
+		mesh_rids.push_back(E->self()->get_rid());
+	}
+	const Vector<float> demands = RS::get_singleton()->mesh_get_lod_stream_demands(mesh_rids);
+	ERR_FAIL_COND(demands.size() != mesh_rids.size());
+
+	const uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+	int mesh_index = 0;
+	for (SelfList<StreamedMesh> *E = stream_meshes.first(); E; E = E->next()) {
+		StreamedMesh *mesh = E->self();
+		if (mesh->stream_task != WorkerThreadPool::INVALID_TASK_ID && WorkerThreadPool::get_singleton()->is_task_completed(mesh->stream_task)) {
+			mesh->_stream_finish_load();
+		}
+
+		// The coarsest level the renderer would still draw at full detail for every instance culled since last frame.
+		float demand = demands[mesh_index++];
+		int level = mesh->resident_level;
+		while (level > 0 && mesh->lod_chunks->get_level_edge_length(level) * demand > 1.0f) {
+			level--;
+		}
+
+		if (level <= mesh->lod_level) {
+			mesh->stream_demand_frame = frame;
+		} else if (frame - mesh->stream_demand_frame <= STREAM_DEMAND_FRAMES) {
+			level = mesh->lod_level; // The camera may come back soon.
+		}
+
+		if (level != mesh->lod_level && mesh->stream_task == WorkerThreadPool::INVALID_TASK_ID && !mesh->stream_failed && stream_loads < STREAM_MAX_LOADS) {
+			mesh->_stream_start_load(level);
+		}
+	}
+}
+
+void StreamedMesh::reset_state() {
+	_stream_clear();
+	lod_chunks.unref();
+	resident_level = 0;
+	lod_level = 0;
+	ArrayMesh::reset_state();
+}
+
+void StreamedMesh::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_lod_chunks", "lod_chunks"), &StreamedMesh::set_lod_chunks);
+	ClassDB::bind_method(D_METHOD("get_lod_chunks"), &StreamedMesh::get_lod_chunks);
+
+	ClassDB::bind_method(D_METHOD("set_resident_level", "level"), &StreamedMesh::set_resident_level);
+	ClassDB::bind_method(D_METHOD("get_resident_level"), &StreamedMesh::get_resident_level);
+
+	ClassDB::bind_method(D_METHOD("load_lod_level", "level"), &StreamedMesh::load_lod_level);
+	ClassDB::bind_method(D_METHOD("get_lod_level"), &StreamedMesh::get_lod_level);
+	ClassDB::bind_method(D_METHOD("is_streamed"), &StreamedMesh::is_streamed);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "lod_chunks", PROPERTY_HINT_RESOURCE_TYPE, "MeshLODChunks"), "set_lod_chunks", "get_lod_chunks");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "resident_level", PROPERTY_HINT_RANGE, "0,16,1,or_greater"), "set_resident_level", "get_resident_level");
+}
+
+StreamedMesh::StreamedMesh() :
+		stream_list(this) {
+}
+
+StreamedMesh::~StreamedMesh() {
+	_stream_clear();
+}
+
+// ResourceFormatLoaderMeshLODChunks
+
+Ref<Resource> ResourceFormatLoaderMeshLODChunks::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
+	Ref<MeshLODChunks> lod_chunks;
+	lod_chunks.instantiate();
+	Error err = lod_chunks->load(p_path);
+	if (r_error) {
+		*r_error = err;
+	}
+	if (err != OK) {
+		return Ref<Resource>();
+	}
+	return lod_chunks;
+}
+
+void ResourceFormatLoaderMeshLODChunks::get_recognized_extensions(List<String> *p_extensions) const {
+	p_extensions->push_back("meshlod");
+}
+
+bool ResourceFormatLoaderMeshLODChunks::handles_type(const String &p_type) const {
+	return p_type == "MeshLODChunks";
+}
+
+String ResourceFormatLoaderMeshLODChunks::get_resource_type(const String &p_path) const {
+	if (p_path.get_extension().to_lower() == "meshlod") {
+		return "MeshLODChunks";
+	}
+	return "";
+}
+
+// ResourceFormatSaverMeshLODChunks
+
+Error ResourceFormatSaverMeshLODChunks::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	Ref<MeshLODChunks> lod_chunks = p_resource;
+	ERR_FAIL_COND_V(lod_chunks.is_null(), ERR_INVALID_PARAMETER);
+	return lod_chunks->save(p_path);
+}
+
+void ResourceFormatSaverMeshLODChunks::get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions) const {
+	if (Object::cast_to<MeshLODChunks>(*p_resource)) {
+		p_extensions->push_back("meshlod");
+	}
+}
+
+bool ResourceFormatSaverMeshLODChunks::recognize(const Ref<Resource> &p_resource) const {
+	return p_resource->get_class_name() == "MeshLODChunks";
+}
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  streamed_mesh.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef STREAMED_MESH_H
+#define STREAMED_MESH_H
+
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/self_list.h"
+#include "scene/resources/mesh.h"
+
+// Surfaces of a mesh at each LOD level, stored so a level can be read without the others.
+class MeshLODChunks : public Resource {
+	GDCLASS(MeshLODChunks, Resource);
+	RES_BASE_EXTENSION("meshlod");
+
+public:
+	enum {
+		FORMAT_VERSION = 1
+	};
+
+private:
+	struct Level {
+		float edge_length = 0.0;
+		uint64_t offset = 0; // Within the file, if loaded from one.
+		uint32_t size = 0;
+		uint32_t compressed_size = 0;
+		Vector<uint8_t> data; // Compressed, kept unless loaded from a file.
+	};
+
+	Vector<Level> levels;
+	String path_to_file;
+
+	Vector<uint8_t> _get_level_data(int p_level) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error load(const String &p_path);
+	Error save(const String &p_path) const;
+
+	void add_level(const Array &p_surfaces, float p_edge_length);
+	int get_level_count() const;
+	float get_level_edge_length(int p_level) const;
+	Array get_level_surfaces(int p_level) const;
+	void clear();
+};
+
+// An ArrayMesh that keeps only its coarser LODs resident, and loads finer ones
+// when the renderer draws it close enough to need them.
+class StreamedMesh : public ArrayMesh {
+	GDCLASS(StreamedMesh, ArrayMesh);
+
+	enum {
+		STREAM_DEMAND_FRAMES = 60, // Finer levels are kept this long after they were last needed.
+		STREAM_MAX_LOADS = 4,
+	};
+
+	struct StreamLoad {
+		Ref<MeshLODChunks> lod_chunks;
+		int level = 0;
+		Array surfaces;
+	};
+
+	Ref<MeshLODChunks> lod_chunks;
+	int resident_level = 0;
+	int lod_level = 0; // Level of the surfaces in use.
+
+	bool streamed = false;
+	uint64_t stream_demand_frame = 0;
+	bool stream_failed = false;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	StreamLoad *stream_load = nullptr;
+	SelfList<StreamedMesh> stream_list;
+
+	static Mutex stream_mutex;
+	static SelfList<StreamedMesh>::List stream_meshes;
+	static int stream_loads;
+
+	void _set_level_surfaces(const Array &p_surfaces);
+	void _stream_update();
+	void _stream_start_load(int p_level);
+	void _stream_finish_load();
+	void _stream_clear();
+	static void _stream_load_task(void *p_userdata);
+
+protected:
+	virtual void reset_state() override;
+
+	static void _bind_methods();
+
+public:
+	void set_lod_chunks(const Ref<MeshLODChunks> &p_lod_chunks);
+	Ref<MeshLODChunks> get_lod_chunks() const;
+
+	void set_resident_level(int p_level);
+	int get_resident_level() const;
+
+	Error load_lod_level(int p_level);
+	int get_lod_level() const;
+	bool is_streamed() const;
+
+	static void update_streaming();
+
+	StreamedMesh();
+	~StreamedMesh();
+};
+
+class ResourceFormatLoaderMeshLODChunks : public ResourceFormatLoader {
+public:
+	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
+	virtual bool handles_type(const String &p_type) const override;
+	virtual String get_resource_type(const String &p_path) const override;
+};
+
+class ResourceFormatSaverMeshLODChunks : public ResourceFormatSaver {
+public:
+	virtual Error save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags = 0) override;
+	virtual void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions) const override;
+	virtual bool recognize(const Ref<Resource> &p_resource) const override;
+};
+
+#endif // STREAMED_MESH_H
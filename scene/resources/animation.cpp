@@ -3456,13 +3456,18 @@ real_t Animation::bezier_track_interpolate(int p_track, double p_time) const {
 
 	BezierTrack *bt = static_cast<BezierTrack *>(track);
 
-	int len = _find(bt->values, length) + 1; // try to find last key (there may be more past the end)
+	const int key_count = bt->values.size();
+	if (key_count == 0) {
+		return 0;
+	}
+	const TKey<BezierKey> *keys = bt->values.ptr();
 
-	if (len <= 0) {
-		// (-1 or -2 returned originally) (plus one above)
+	// Same as counting the keys up to the animation's length with _find(), without the extra binary search:
+	// a first key past the end means no key, a second key past the end (or none) means exactly one.
+	if (keys[0].time > length && !Math::is_equal_approx(length, (double)keys[0].time)) {
 		return 0;
-	} else if (len == 1) { // one key found (0+1), return it
-		return bt->values[0].value.value;
+	} else if (key_count == 1 || (keys[1].time > length && !Math::is_equal_approx(length, (double)keys[1].time))) {
+		return keys[0].value.value;
 	}
 
 	int idx = _find(bt->values, p_time);
@@ -3472,33 +3477,38 @@ real_t Animation::bezier_track_interpolate(int p_track, double p_time) const {
 	//there really is no looping interpolation on bezier
 
 	if (idx < 0) {
-		return bt->values[0].value.value;
+		return keys[0].value.value;
 	}
 
-	if (idx >= bt->values.size() - 1) {
-		return bt->values[bt->values.size() - 1].value.value;
+	if (idx >= key_count - 1) {
+		return keys[key_count - 1].value.value;
 	}
 
-	double t = p_time - bt->values[idx].time;
+	double t = p_time - keys[idx].time;
 
 	int iterations = 10;
 
-	real_t duration = bt->values[idx + 1].time - bt->values[idx].time; // time duration between our two keyframes
+	real_t duration = keys[idx + 1].time - keys[idx].time; // time duration between our two keyframes
 	real_t low = 0.0; // 0% of the current animation segment
 	real_t high = 1.0; // 100% of the current animation segment
 
-	Vector2 start(0, bt->values[idx].value.value);
-	Vector2 start_out = start + bt->values[idx].value.out_handle;
-	Vector2 end(duration, bt->values[idx + 1].value.value);
-	Vector2 end_in = end + bt->values[idx + 1].value.in_handle;
+	Vector2 start(0, keys[idx].value.value);
+	Vector2 start_out = start + keys[idx].value.out_handle;
+	Vector2 end(duration, keys[idx + 1].value.value);
+	Vector2 end_in = end + keys[idx + 1].value.in_handle;
+
+	// Only the time axis is needed while narrowing, expand it once into polynomial form (Horner's method).
+	const real_t cx = 3 * (start_out.x - start.x);
+	const real_t bx = 3 * (end_in.x - start_out.x) - cx;
+	const real_t ax = end.x - start.x - cx - bx;
 
 	//narrow high and low as much as possible
 	for (int i = 0; i < iterations; i++) {
 		real_t middle = (low + high) / 2;
 
-		Vector2 interp = start.bezier_interpolate(start_out, end_in, end, middle);
+		real_t interp_x = ((ax * middle + bx) * middle + cx) * middle + start.x;
 
-		if (interp.x < t) {
+		if (interp_x < t) {
 			low = middle;
 		} else {
 			high = middle;
@@ -30,9 +30,16 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
 #include "scene/resources/bit_map.h"
 
-Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
+Mutex CompressedTexture2D::stream_mutex;
+SelfList<CompressedTexture2D>::List CompressedTexture2D::stream_textures;
+int CompressedTexture2D::stream_loads = 0;
+uint64_t CompressedTexture2D::stream_used_bytes = 0;
+
+Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit, bool *r_streamed) {
 	alpha_cache.unref();
 
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
@@ -79,15 +86,43 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 		p_size_limit = 0;
 	}
 
-	image = load_image_from_file(f, p_size_limit);
+	bool streamable = false;
+	if (p_size_limit > 0) {
+		// Basis Universal stores all mipmaps in one blob, so they can't be loaded separately.
+		uint64_t image_ofs = f->get_position();
+		uint32_t data_format = f->get_32();
+		stream_width = f->get_16();
+		stream_height = f->get_16();
+		uint32_t mipmaps = f->get_32();
+		streamable = mipmaps > 0 && data_format != DATA_FORMAT_BASIS_UNIVERSAL;
+		f->seek(image_ofs);
+	}
+
+	image = load_image_from_file(f, streamable ? p_size_limit : 0);
 
 	if (image.is_null() || image->is_empty()) {
 		return ERR_CANT_OPEN;
 	}
 
+	if (r_streamed) {
+		*r_streamed = streamable;
+	}
+
 	return OK;
 }
 
+void CompressedTexture2D::_set_image(const Ref<Image> &p_image) {
+	if (texture.is_valid()) {
+		RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+		RS::get_singleton()->texture_replace(texture, new_texture);
+	} else {
+		texture = RS::get_singleton()->texture_2d_create(p_image);
+	}
+	if (w || h) {
+		RS::get_singleton()->texture_set_size_override(texture, w, h);
+	}
+}
+
 void CompressedTexture2D::set_path(const String &p_path, bool p_take_over) {
 	if (texture.is_valid()) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -135,25 +170,48 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
-	if (err) {
-		return err;
+	// The editor always edits and previews textures at full size.
+	int resident_size = 0;
+	if (!Engine::get_singleton()->is_editor_hint() && GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		resident_size = MAX(int(GLOBAL_GET("rendering/textures/streaming/resident_size")), 1);
 	}
 
-	if (texture.is_valid()) {
-		RID new_texture = RS::get_singleton()->texture_2d_create(image);
-		RS::get_singleton()->texture_replace(texture, new_texture);
-	} else {
-		texture = RS::get_singleton()->texture_2d_create(image);
-	}
-	if (lw || lh) {
-		RS::get_singleton()->texture_set_size_override(texture, lw, lh);
+	_stream_clear();
+
+	bool stream = false;
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, resident_size, &stream);
+	if (err) {
+		return err;
 	}
 
 	w = lw;
 	h = lh;
 	path_to_file = p_path;
 	format = image->get_format();
+	_set_image(image);
+
+	if (stream) {
+		int level = 0;
+		while (MAX(stream_width >> level, 1) > image->get_width() || MAX(stream_height >> level, 1) > image->get_height()) {
+			level++;
+		}
+
+		// Nothing to stream when the whole texture fits in the resident size.
+		if (level > 0) {
+			MutexLock lock(stream_mutex);
+			streamed = true;
+			stream_min_level = level;
+			stream_level = level;
+			stream_requested_level = -1;
+			stream_failed = false;
+			stream_used_bytes += _get_stream_level_size(level);
+			stream_textures.add(&stream_list);
+			const Callable update = callable_mp_static(&CompressedTexture2D::update_streaming);
+			if (!RS::get_singleton()->is_connected(SNAME("frame_pre_draw"), update)) {
+				RS::get_singleton()->connect(SNAME("frame_pre_draw"), update);
+			}
+		}
+	}
 
 	if (get_path().is_empty()) {
 		//temporarily set path if no path set for resource, helps find errors
@@ -236,6 +294,166 @@ bool CompressedTexture2D::has_alpha() const {
 	return false;
 }
 
+uint64_t CompressedTexture2D::_get_stream_level_size(int p_level) const {
+	return Image::get_image_data_size(MAX(stream_width >> p_level, 1), MAX(stream_height >> p_level, 1), format, true);
+}
+
+int CompressedTexture2D::_get_stream_level_limit(int p_level) const {
+	return MAX(MAX(stream_width >> p_level, stream_height >> p_level), 1);
+}
+
+void CompressedTexture2D::_stream_load_task(void *p_userdata) {
+	StreamLoad *load = (StreamLoad *)p_userdata;
+	Ref<FileAccess> f = FileAccess::open(load->path, FileAccess::READ);
+	if (f.is_null()) {
+		return;
+	}
+	f->seek(36); // Skip the header, it was checked when the texture was loaded.
+	load->image = load_image_from_file(f, load->size_limit);
+}
+
+void CompressedTexture2D::_stream_start_load(int p_level) {
+	stream_load = memnew(StreamLoad);
+	stream_load->path = path_to_file;
+	stream_load->size_limit = _get_stream_level_limit(p_level);
+	stream_load_level = p_level;
+	stream_task = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_load_task, stream_load, false, SNAME("CompressedTexture2D streaming"));
+	stream_loads++;
+}
+
+void CompressedTexture2D::_stream_finish_load() {
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+	stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	stream_loads--;
+
+	Ref<Image> image = stream_load->image;
+	memdelete(stream_load);
+	stream_load = nullptr;
+
+	if (image.is_null() || image->get_width() != MAX(stream_width >> stream_load_level, 1) || image->get_format() != format) {
+		stream_failed = true; // Keep what is resident rather than retrying every frame.
+		ERR_FAIL_MSG(vformat("Failed to stream mipmaps of texture: %s.", path_to_file));
+	}
+
+	stream_used_bytes -= _get_stream_level_size(stream_level);
+	stream_level = stream_load_level;
+	stream_used_bytes += _get_stream_level_size(stream_level);
+
+	alpha_cache.unref();
+	_set_image(image);
+	RS::get_singleton()->texture_set_path(texture, get_path().is_empty() ? path_to_file : get_path());
+}
+
+void CompressedTexture2D::_stream_clear() {
+	if (!streamed) {
+		return;
+	}
+
+	MutexLock lock(stream_mutex);
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+		stream_loads--;
+		memdelete(stream_load);
+		stream_load = nullptr;
+	}
+	stream_used_bytes -= _get_stream_level_size(stream_level);
+	stream_textures.remove(&stream_list);
+	streamed = false;
+}
+
+bool CompressedTexture2D::is_streamed() const {
+	return streamed;
+}
+
+int CompressedTexture2D::get_resident_mipmap() const {
+	return streamed ? stream_level : 0;
+}
+
+void CompressedTexture2D::request_stream_screen_size(float p_pixels) {
+	if (!streamed) {
+		return;
+	}
+
+	// The smallest mipmap that still has at least one texel per pixel.
+	int limit = MAX(stream_width, stream_height);
+	int level = 0;
+	while (level < stream_min_level && (limit >> (level + 1)) >= p_pixels) {
+		level++;
+	}
+
+	MutexLock lock(stream_mutex);
+	uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+	if (stream_requested_level < 0 || frame != stream_request_frame) {
+		stream_requested_level = level;
+	} else {
+		stream_requested_level = MIN(stream_requested_level, level);
+	}
+	stream_request_frame = frame;
+}
+
+void CompressedTexture2D::update_streaming() {
+	MutexLock lock(stream_mutex);
+	if (!stream_textures.first()) {
+		return;
+	}
+
+	const uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+	const uint64_t budget = uint64_t(MAX(int(GLOBAL_GET("rendering/textures/streaming/vram_budget_mb")), 0)) << 20;
+
+	LocalVector<int> desired_levels;
+	for (SelfList<CompressedTexture2D> *E = stream_textures.first(); E; E = E->next()) {
+		CompressedTexture2D *tex = E->self();
+		if (tex->stream_task != WorkerThreadPool::INVALID_TASK_ID && WorkerThreadPool::get_singleton()->is_task_completed(tex->stream_task)) {
+			tex->_stream_finish_load();
+		}
+
+		if (tex->stream_requested_level < 0) {
+			desired_levels.push_back(0);
+		} else if (frame - tex->stream_request_frame > STREAM_DEMAND_FRAMES) {
+			desired_levels.push_back(tex->stream_min_level);
+		} else {
+			desired_levels.push_back(tex->stream_requested_level);
+		}
+	}
+
+	// When everything requested doesn't fit, all textures drop the same number of mipmaps.
+	int bias = 0;
+	if (budget > 0) {
+		for (;; bias++) { // Ends once every texture is at its minimum.
+			uint64_t total = 0;
+			bool all_minimum = true;
+			uint32_t i = 0;
+			for (SelfList<CompressedTexture2D> *E = stream_textures.first(); E; E = E->next(), i++) {
+				CompressedTexture2D *tex = E->self();
+				int level = MIN(desired_levels[i] + bias, tex->stream_min_level);
+				all_minimum = all_minimum && level == tex->stream_min_level;
+				total += tex->_get_stream_level_size(level);
+			}
+			if (total <= budget || all_minimum) {
+				break;
+			}
+		}
+	}
+
+	// Dropping mipmaps first frees memory for the larger ones.
+	for (int pass = 0; pass < 2; pass++) {
+		uint32_t i = 0;
+		for (SelfList<CompressedTexture2D> *E = stream_textures.first(); E && stream_loads < STREAM_MAX_LOADS; E = E->next(), i++) {
+			CompressedTexture2D *tex = E->self();
+			int level = MIN(desired_levels[i] + bias, tex->stream_min_level);
+			if (tex->stream_task == WorkerThreadPool::INVALID_TASK_ID && !tex->stream_failed && (pass == 0 ? level > tex->stream_level : level < tex->stream_level)) {
+				tex->_stream_start_load(level);
+			}
+		}
+	}
+}
+
+uint64_t CompressedTexture2D::get_streaming_used_bytes() {
+	MutexLock lock(stream_mutex);
+	return stream_used_bytes;
+}
+
 Ref<Image> CompressedTexture2D::get_image() const {
 	if (texture.is_valid()) {
 		return RS::get_singleton()->texture_2d_get(texture);
@@ -318,7 +536,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -389,21 +607,15 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
 	} else if (data_format == DATA_FORMAT_BASIS_UNIVERSAL) {
 		int sw = w;
 		int sh = h;
+		// Mipmaps are all in the same blob, so the size limit doesn't apply.
 		uint32_t size = f->get_32();
-		if (p_size_limit > 0 && (sw > p_size_limit || sh > p_size_limit)) {
-			//can't load this due to size limit
-			sw = MAX(sw >> 1, 1);
-			sh = MAX(sh >> 1, 1);
-			f->seek(f->get_position() + size);
-			return Ref<Image>();
-		}
 		Vector<uint8_t> pv;
 		pv.resize(size);
 		{
@@ -421,18 +633,20 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		return img;
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_ofs = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			if (ofs) {
+				f->seek(data_ofs + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -453,13 +667,18 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 void CompressedTexture2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load", "path"), &CompressedTexture2D::load);
 	ClassDB::bind_method(D_METHOD("get_load_path"), &CompressedTexture2D::get_load_path);
+	ClassDB::bind_method(D_METHOD("is_streamed"), &CompressedTexture2D::is_streamed);
+	ClassDB::bind_method(D_METHOD("get_resident_mipmap"), &CompressedTexture2D::get_resident_mipmap);
+	ClassDB::bind_method(D_METHOD("request_stream_screen_size", "pixels"), &CompressedTexture2D::request_stream_screen_size);
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
-CompressedTexture2D::CompressedTexture2D() {}
+CompressedTexture2D::CompressedTexture2D() :
+		stream_list(this) {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_stream_clear();
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
@@ -31,6 +31,8 @@
 #ifndef COMPRESSED_TEXTURE_H
 #define COMPRESSED_TEXTURE_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -67,9 +69,48 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
-	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	// Streamed textures keep their smaller mipmaps resident, and load larger ones when requested and within the budget.
+	// Levels count mipmaps from the full size image, so a lower level means a larger image.
+	struct StreamLoad {
+		String path;
+		int size_limit = 0;
+		Ref<Image> image;
+	};
+
+	enum {
+		STREAM_DEMAND_FRAMES = 60, // Requests are kept for this many frames.
+		STREAM_MAX_LOADS = 4, // Concurrent loads for all textures.
+	};
+
+	bool streamed = false;
+	int stream_width = 0;
+	int stream_height = 0;
+	int stream_min_level = 0; // Always resident.
+	int stream_level = 0;
+	int stream_requested_level = -1; // Full size until anything is requested.
+	uint64_t stream_request_frame = 0;
+	int stream_load_level = -1;
+	bool stream_failed = false;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	StreamLoad *stream_load = nullptr;
+	SelfList<CompressedTexture2D> stream_list;
+
+	static Mutex stream_mutex;
+	static SelfList<CompressedTexture2D>::List stream_textures;
+	static int stream_loads;
+	static uint64_t stream_used_bytes;
+
+	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0, bool *r_streamed = nullptr);
+	void _set_image(const Ref<Image> &p_image);
 	virtual void reload_from_file() override;
 
+	uint64_t _get_stream_level_size(int p_level) const;
+	int _get_stream_level_limit(int p_level) const;
+	void _stream_start_load(int p_level);
+	void _stream_finish_load();
+	void _stream_clear();
+	static void _stream_load_task(void *p_userdata);
+
 	static void _requested_3d(void *p_ud);
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
@@ -107,6 +148,12 @@ public:
 
 	virtual Ref<Image> get_image() const override;
 
+	bool is_streamed() const;
+	int get_resident_mipmap() const;
+	void request_stream_screen_size(float p_pixels);
+	static void update_streaming();
+	static uint64_t get_streaming_used_bytes();
+
 	CompressedTexture2D();
 	~CompressedTexture2D();
 };
@@ -31,6 +31,8 @@
 #include "font.h"
 #include "font.compat.inc"
 
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/string/translation.h"
@@ -1397,6 +1399,7 @@ void FontFile::_get_property_list(List<PropertyInfo> *p_list) const {
 }
 
 void FontFile::reset_state() {
+	_wait_glyph_cache_prerender();
 	_clear_cache();
 	data.clear();
 	data_ptr = nullptr;
@@ -2046,6 +2049,150 @@ Error FontFile::_load_bitmap_font(const String &p_path, List<String> *r_image_fi
 	return OK;
 }
 
+Mutex FontFile::glyph_cache_mutex;
+bool FontFile::glyph_cache_loaded = false;
+Dictionary FontFile::glyph_cache;
+HashSet<FontFile *> FontFile::glyph_cache_fonts;
+
+#define GLYPH_CACHE_VERSION 1
+#define GLYPH_CACHE_FILE "font_glyph_cache.bin"
+
+void FontFile::_load_glyph_cache() {
+	// Called with the mutex locked. A cache shipped with the project is merged with the one from previous runs.
+	glyph_cache_loaded = true;
+	for (const String &dir : { String("res://"), String("user://") }) {
+		Ref<FileAccess> f = FileAccess::open(dir.path_join(GLYPH_CACHE_FILE), FileAccess::READ);
+		if (f.is_null()) {
+			continue;
+		}
+		if (f->get_32() != GLYPH_CACHE_VERSION) {
+			continue;
+		}
+		Dictionary d = f->get_var();
+		for (const Variant &key : d.keys()) {
+			glyph_cache[key] = d[key];
+		}
+	}
+}
+
+void FontFile::save_glyph_cache() {
+	MutexLock lock(glyph_cache_mutex);
+	if (!glyph_cache_loaded) {
+		return; // Nothing was used.
+	}
+	for (FontFile *E : glyph_cache_fonts) {
+		E->_store_glyph_cache();
+	}
+
+	Ref<FileAccess> f = FileAccess::open(String("user://").path_join(GLYPH_CACHE_FILE), FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Can't save font glyph cache.");
+	f->store_32(GLYPH_CACHE_VERSION);
+	f->store_var(glyph_cache);
+}
+
+String FontFile::_get_glyph_cache_key() const {
+	_ensure_rid(0);
+	return TS->font_get_name(cache[0]) + "|" + TS->font_get_style_name(cache[0]) + "|" + itos(data_size);
+}
+
+void FontFile::_store_glyph_cache() {
+	// Called with the mutex locked, merges glyphs rendered by this font.
+	if (data_size == 0) {
+		return;
+	}
+	const String key = _get_glyph_cache_key();
+	Dictionary font_glyphs = glyph_cache.get(key, Dictionary());
+	for (int i = 0; i < cache.size(); i++) {
+		if (!cache[i].is_valid()) {
+			continue;
+		}
+		Dictionary cache_glyphs = font_glyphs.get(i, Dictionary());
+		TypedArray<Vector2i> sizes = TS->font_get_size_cache_list(cache[i]);
+		for (int j = 0; j < sizes.size(); j++) {
+			const Vector2i sz = sizes[j];
+			HashSet<int32_t> unique;
+			PackedInt32Array glyphs = cache_glyphs.get(sz, PackedInt32Array());
+			for (int32_t gl : glyphs) {
+				unique.insert(gl);
+			}
+			for (int32_t gl : TS->font_get_glyph_list(cache[i], sz)) {
+				unique.insert(gl & 0xffffff); // Without subpixel shifts and LCD layout, they are all rendered together.
+			}
+			glyphs.clear();
+			for (int32_t gl : unique) {
+				glyphs.push_back(gl);
+			}
+			cache_glyphs[sz] = glyphs;
+		}
+		if (!cache_glyphs.is_empty()) {
+			font_glyphs[i] = cache_glyphs;
+		}
+	}
+	if (!font_glyphs.is_empty()) {
+		glyph_cache[key] = font_glyphs;
+	}
+}
+
+void FontFile::_queue_glyph_cache_prerender() {
+	if (glyph_cache_queued || data_size == 0 || Engine::get_singleton()->is_editor_hint() || !GLOBAL_GET("gui/fonts/dynamic_fonts/persistent_glyph_cache")) {
+		return;
+	}
+	// Wait for the rest of the font properties to be set.
+	glyph_cache_queued = true;
+	callable_mp(this, &FontFile::_start_glyph_cache_prerender).call_deferred();
+}
+
+void FontFile::_start_glyph_cache_prerender() {
+	glyph_cache_queued = false;
+	if (data_size == 0) {
+		return;
+	}
+	_wait_glyph_cache_prerender();
+
+	MutexLock lock(glyph_cache_mutex);
+	if (!glyph_cache_loaded) {
+		_load_glyph_cache();
+	}
+	glyph_cache_fonts.insert(this);
+
+	const Dictionary font_glyphs = glyph_cache.get(_get_glyph_cache_key(), Dictionary());
+	for (const Variant &idx : font_glyphs.keys()) {
+		const int cache_index = idx;
+		ERR_CONTINUE(cache_index < 0);
+		_ensure_rid(cache_index);
+
+		const Dictionary cache_glyphs = font_glyphs[idx];
+		for (const Variant &sz : cache_glyphs.keys()) {
+			PrerenderGlyphs pg;
+			pg.rid = cache[cache_index];
+			pg.size = sz;
+			pg.glyphs = cache_glyphs[sz];
+			glyph_cache_prerender.push_back(pg);
+		}
+	}
+	if (!glyph_cache_prerender.is_empty()) {
+		// Glyphs that are needed before the task gets to them are rendered on demand as usual.
+		glyph_cache_task = WorkerThreadPool::get_singleton()->add_native_task(&FontFile::_glyph_cache_prerender_task, this, false, "Prerender font glyphs");
+	}
+}
+
+void FontFile::_glyph_cache_prerender_task(void *p_userdata) {
+	FontFile *font = (FontFile *)p_userdata;
+	for (const PrerenderGlyphs &pg : font->glyph_cache_prerender) {
+		for (int32_t gl : pg.glyphs) {
+			TS->font_render_glyph(pg.rid, pg.size, gl);
+		}
+	}
+}
+
+void FontFile::_wait_glyph_cache_prerender() {
+	if (glyph_cache_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(glyph_cache_task);
+		glyph_cache_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	glyph_cache_prerender.clear();
+}
+
 Error FontFile::load_dynamic_font(const String &p_path) {
 	reset_state();
 
@@ -2056,6 +2203,7 @@ Error FontFile::load_dynamic_font(const String &p_path) {
 }
 
 void FontFile::set_data_ptr(const uint8_t *p_data, size_t p_size) {
+	_wait_glyph_cache_prerender();
 	data.clear();
 	data_ptr = p_data;
 	data_size = p_size;
@@ -2065,9 +2213,11 @@ void FontFile::set_data_ptr(const uint8_t *p_data, size_t p_size) {
 			TS->font_set_data_ptr(cache[i], data_ptr, data_size);
 		}
 	}
+	_queue_glyph_cache_prerender();
 }
 
 void FontFile::set_data(const PackedByteArray &p_data) {
+	_wait_glyph_cache_prerender();
 	data = p_data;
 	data_ptr = data.ptr();
 	data_size = data.size();
@@ -2077,6 +2227,7 @@ void FontFile::set_data(const PackedByteArray &p_data) {
 			TS->font_set_data_ptr(cache[i], data_ptr, data_size);
 		}
 	}
+	_queue_glyph_cache_prerender();
 }
 
 PackedByteArray FontFile::get_data() const {
@@ -2394,6 +2545,7 @@ int FontFile::get_cache_count() const {
 }
 
 void FontFile::clear_cache() {
+	_wait_glyph_cache_prerender();
 	_clear_cache();
 	cache.clear();
 	emit_changed();
@@ -2401,6 +2553,7 @@ void FontFile::clear_cache() {
 
 void FontFile::remove_cache(int p_cache_index) {
 	ERR_FAIL_INDEX(p_cache_index, cache.size());
+	_wait_glyph_cache_prerender();
 	if (cache[p_cache_index].is_valid()) {
 		TS->free_rid(cache.write[p_cache_index]);
 	}
@@ -2787,6 +2940,13 @@ FontFile::FontFile() {
 }
 
 FontFile::~FontFile() {
+	_wait_glyph_cache_prerender();
+	{
+		MutexLock lock(glyph_cache_mutex);
+		if (glyph_cache_fonts.erase(this)) {
+			_store_glyph_cache();
+		}
+	}
 	_clear_cache();
 }
 
@@ -32,6 +32,8 @@
 #define FONT_H
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/lru.h"
 #include "core/templates/rb_map.h"
 #include "scene/resources/texture.h"
@@ -210,6 +212,31 @@ class FontFile : public Font {
 	_FORCE_INLINE_ void _clear_cache();
 	_FORCE_INLINE_ void _ensure_rid(int p_cache_index, int p_make_linked_from = -1) const;
 
+	// Glyphs rasterized during previous runs, persisted to disk and prerendered on load.
+	struct PrerenderGlyphs {
+		RID rid;
+		Vector2i size;
+		PackedInt32Array glyphs;
+	};
+
+	static Mutex glyph_cache_mutex;
+	static bool glyph_cache_loaded;
+	static Dictionary glyph_cache;
+	static HashSet<FontFile *> glyph_cache_fonts;
+
+	bool glyph_cache_queued = false;
+	Vector<PrerenderGlyphs> glyph_cache_prerender;
+	WorkerThreadPool::TaskID glyph_cache_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _load_glyph_cache();
+	String _get_glyph_cache_key() const;
+	void _queue_glyph_cache_prerender();
+	void _start_glyph_cache_prerender();
+	// The task reads the font data and cache RIDs, so wait for it before changing them.
+	void _wait_glyph_cache_prerender();
+	static void _glyph_cache_prerender_task(void *p_userdata);
+	void _store_glyph_cache();
+
 	void _convert_packed_8bit(Ref<Image> &p_source, int p_page, int p_sz);
 	void _convert_packed_4bit(Ref<Image> &p_source, int p_page, int p_sz);
 	void _convert_rgba_4bit(Ref<Image> &p_source, int p_page, int p_sz);
@@ -232,6 +259,8 @@ public:
 	Error load_bitmap_font(const String &p_path);
 	Error load_dynamic_font(const String &p_path);
 
+	static void save_glyph_cache();
+
 	// Font source data.
 	virtual void set_data_ptr(const uint8_t *p_data, size_t p_size);
 	virtual void set_data(const PackedByteArray &p_data);
@@ -1493,6 +1493,50 @@ PackedStringArray ArrayMesh::_get_blend_shape_names() const {
 	return sarr;
 }
 
+Dictionary ArrayMesh::surface_data_to_dictionary(const RS::SurfaceData &p_surface) {
+	Dictionary data;
+	data["format"] = p_surface.format;
+	data["primitive"] = p_surface.primitive;
+	data["vertex_data"] = p_surface.vertex_data;
+	data["vertex_count"] = p_surface.vertex_count;
+	if (p_surface.skin_data.size()) {
+		data["skin_data"] = p_surface.skin_data;
+	}
+	if (p_surface.attribute_data.size()) {
+		data["attribute_data"] = p_surface.attribute_data;
+	}
+	data["aabb"] = p_surface.aabb;
+	data["uv_scale"] = p_surface.uv_scale;
+	if (p_surface.index_count) {
+		data["index_data"] = p_surface.index_data;
+		data["index_count"] = p_surface.index_count;
+	}
+
+	Array lods;
+	for (int j = 0; j < p_surface.lods.size(); j++) {
+		lods.push_back(p_surface.lods[j].edge_length);
+		lods.push_back(p_surface.lods[j].index_data);
+	}
+
+	if (lods.size()) {
+		data["lods"] = lods;
+	}
+
+	Array bone_aabbs;
+	for (int j = 0; j < p_surface.bone_aabbs.size(); j++) {
+		bone_aabbs.push_back(p_surface.bone_aabbs[j]);
+	}
+	if (bone_aabbs.size()) {
+		data["bone_aabbs"] = bone_aabbs;
+	}
+
+	if (p_surface.blend_shape_data.size()) {
+		data["blend_shapes"] = p_surface.blend_shape_data;
+	}
+
+	return data;
+}
+
 Array ArrayMesh::_get_surfaces() const {
 	if (mesh.is_null()) {
 		return Array();
@@ -1500,46 +1544,7 @@ Array ArrayMesh::_get_surfaces() const {
 
 	Array ret;
 	for (int i = 0; i < surfaces.size(); i++) {
-		RenderingServer::SurfaceData surface = RS::get_singleton()->mesh_get_surface(mesh, i);
-		Dictionary data;
-		data["format"] = surface.format;
-		data["primitive"] = surface.primitive;
-		data["vertex_data"] = surface.vertex_data;
-		data["vertex_count"] = surface.vertex_count;
-		if (surface.skin_data.size()) {
-			data["skin_data"] = surface.skin_data;
-		}
-		if (surface.attribute_data.size()) {
-			data["attribute_data"] = surface.attribute_data;
-		}
-		data["aabb"] = surface.aabb;
-		data["uv_scale"] = surface.uv_scale;
-		if (surface.index_count) {
-			data["index_data"] = surface.index_data;
-			data["index_count"] = surface.index_count;
-		};
-
-		Array lods;
-		for (int j = 0; j < surface.lods.size(); j++) {
-			lods.push_back(surface.lods[j].edge_length);
-			lods.push_back(surface.lods[j].index_data);
-		}
-
-		if (lods.size()) {
-			data["lods"] = lods;
-		}
-
-		Array bone_aabbs;
-		for (int j = 0; j < surface.bone_aabbs.size(); j++) {
-			bone_aabbs.push_back(surface.bone_aabbs[j]);
-		}
-		if (bone_aabbs.size()) {
-			data["bone_aabbs"] = bone_aabbs;
-		}
-
-		if (surface.blend_shape_data.size()) {
-			data["blend_shapes"] = surface.blend_shape_data;
-		}
+		Dictionary data = surface_data_to_dictionary(RS::get_singleton()->mesh_get_surface(mesh, i));
 
 		if (surfaces[i].material.is_valid()) {
 			data["material"] = surfaces[i].material;
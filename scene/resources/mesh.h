@@ -300,8 +300,6 @@ class ArrayMesh : public Mesh {
 	PackedStringArray _get_blend_shape_names() const;
 	void _set_blend_shape_names(const PackedStringArray &p_names);
 
-	Array _get_surfaces() const;
-	void _set_surfaces(const Array &p_data);
 	Ref<ArrayMesh> shadow_mesh;
 
 private:
@@ -329,6 +327,9 @@ private:
 protected:
 	virtual bool _is_generated() const { return false; }
 
+	Array _get_surfaces() const;
+	void _set_surfaces(const Array &p_data);
+
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
@@ -341,6 +342,9 @@ protected:
 public:
 	void add_surface_from_arrays(PrimitiveType p_primitive, const Array &p_arrays, const TypedArray<Array> &p_blend_shapes = TypedArray<Array>(), const Dictionary &p_lods = Dictionary(), BitField<ArrayFormat> p_flags = 0);
 
+	// Same layout as the surfaces stored in resource files, without the material and name.
+	static Dictionary surface_data_to_dictionary(const RS::SurfaceData &p_surface);
+
 	void add_surface(BitField<ArrayFormat> p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data = Vector<uint8_t>(), const Vector<AABB> &p_bone_aabbs = Vector<AABB>(), const Vector<RS::SurfaceData::LOD> &p_lods = Vector<RS::SurfaceData::LOD>(), const Vector4 p_uv_scale = Vector4());
 
 	Array surface_get_arrays(int p_surface) const override;
@@ -45,6 +45,19 @@ class NavigationMesh : public Resource {
 	Vector<Polygon> polygons;
 	Ref<ArrayMesh> debug_mesh;
 
+public:
+	/// Bake result of one tile, see `tile_size`.
+	struct BakedTile {
+		uint64_t source_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+private:
+	// Not saved, only lets the next bake skip the tiles whose source geometry is unchanged.
+	HashMap<Vector2i, BakedTile> baked_tiles;
+	uint64_t baked_tiles_settings_hash = 0;
+
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
@@ -83,6 +96,7 @@ protected:
 	float cell_size = 0.25f; // Must match ProjectSettings default 3D cell_size and NavigationServer NavMap cell_size.
 	float cell_height = 0.25f; // Must match ProjectSettings default 3D cell_height and NavigationServer NavMap cell_height.
 	float border_size = 0.0f;
+	float tile_size = 0.0f;
 	float agent_height = 1.5f;
 	float agent_radius = 0.5f;
 	float agent_max_climb = 0.25f;
@@ -137,6 +151,9 @@ public:
 	void set_border_size(float p_value);
 	float get_border_size() const;
 
+	void set_tile_size(float p_value);
+	float get_tile_size() const;
+
 	void set_agent_height(float p_value);
 	float get_agent_height() const;
 
@@ -200,6 +217,10 @@ public:
 	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons);
 	void get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
+	void set_baked_tiles(uint64_t p_settings_hash, const HashMap<Vector2i, BakedTile> &p_tiles);
+	// Returns the tiles of the previous bake only if it was made with the same settings.
+	HashMap<Vector2i, BakedTile> get_baked_tiles(uint64_t p_settings_hash) const;
+
 #ifdef DEBUG_ENABLED
 	Ref<ArrayMesh> get_debug_mesh();
 #endif // DEBUG_ENABLED
@@ -124,6 +124,83 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	const uint32_t members_version = ClassDB::get_members_version();
+	InstantiationPlan *current = plan.load(std::memory_order_acquire);
+	if (likely(current && current->members_version == members_version)) {
+		return current;
+	}
+
+	MutexLock lock(plan_mutex);
+	current = plan.load(std::memory_order_acquire);
+	if (current && current->members_version == members_version) {
+		return current; // Built by another thread meanwhile.
+	}
+
+	InstantiationPlan *fresh = memnew(InstantiationPlan);
+	fresh->members_version = members_version;
+	fresh->nodes.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::NodePlan &node_plan = fresh->nodes[i];
+
+		// Only plain nodes of this scene, instances and inherited nodes take the generic path.
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+		const StringName &type = names[n.type];
+		if (!ClassDB::is_parent_class(type, SNAME("Node"))) {
+			continue;
+		}
+		node_plan.creation_func = ClassDB::get_native_creation_func(type);
+		if (!node_plan.creation_func) {
+			continue;
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			node_plan.setters[j] = nullptr;
+
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || prop.value < 0 || prop.value >= variants.size()) {
+				continue;
+			}
+			if (names[prop.name] == CoreStringName(script)) {
+				continue;
+			}
+			// Resources, arrays and dictionaries may need to be made local to the scene.
+			const Variant::Type value_type = variants[prop.value].get_type();
+			if (value_type == Variant::OBJECT || value_type == Variant::ARRAY || value_type == Variant::DICTIONARY) {
+				continue;
+			}
+
+			const ClassDB::PropertySetGet *psg = ClassDB::get_resolved_property_setget(type, names[prop.name]);
+			if (psg && psg->_setptr) {
+				node_plan.setters[j] = psg;
+			}
+		}
+	}
+
+	if (current) {
+		retired_plans.push_back(current);
+	}
+	plan.store(fresh, std::memory_order_release);
+	return fresh;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(plan_mutex);
+	InstantiationPlan *current = plan.exchange(nullptr, std::memory_order_acq_rel);
+	if (current) {
+		memdelete(current);
+	}
+	for (InstantiationPlan *retired : retired_plans) {
+		memdelete(retired);
+	}
+	retired_plans.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -165,8 +242,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor keeps the generic path, it has to track instance and inheritance states.
+	const InstantiationPlan *instantiation_plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		instantiation_plan = _get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const InstantiationPlan::NodePlan *node_plan = instantiation_plan ? &instantiation_plan->nodes[i] : nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -255,6 +339,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				}
 #endif
 			}
+		} else if (node_plan && node_plan->creation_func) {
+			node = static_cast<Node *>(node_plan->creation_func());
 		} else {
 			// Node belongs to this scene and must be created.
 			Object *obj = ClassDB::instantiate(snames[n.type]);
@@ -308,9 +394,30 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
 
+				// Planned properties of nodes without a script yet need no lookups, nor checks
+				// on their values. Object::set() would use the same setters.
+				const ClassDB::PropertySetGet *const *planned_setters = (node_plan && node_plan->creation_func) ? node_plan->setters.ptr() : nullptr;
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 
+					if (planned_setters && planned_setters[j] && !node->get_script_instance()) {
+						const ClassDB::PropertySetGet *psg = planned_setters[j];
+						Callable::CallError ce;
+						if (psg->index >= 0) {
+							Variant index = psg->index;
+							const Variant *args[2] = { &index, &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 2, ce);
+						} else {
+							const Variant *args[1] = { &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 1, ce);
+						}
+#ifdef TOOLS_ENABLED
+						node->set_edited(true);
+#endif
+						continue;
+					}
+
 					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
 
 					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
@@ -1215,6 +1322,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1432,6 +1540,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1906,6 +2016,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1922,6 +2033,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1933,6 +2045,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -2041,6 +2154,10 @@ void SceneState::_bind_methods() {
 SceneState::SceneState() {
 }
 
+SceneState::~SceneState() {
+	_clear_instantiation_plan();
+}
+
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
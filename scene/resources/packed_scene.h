@@ -32,6 +32,8 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +91,27 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Constructors and property setters resolved once, so repeated runtime
+	// instantiation of the same scene skips most ClassDB lookups.
+	struct InstantiationPlan {
+		uint32_t members_version = 0;
+
+		struct NodePlan {
+			// Null when the node is not created by this scene, or not directly.
+			ClassDB::CreationFunc creation_func = nullptr;
+			// One per property, null where it must go through Object::set().
+			LocalVector<const ClassDB::PropertySetGet *> setters;
+		};
+		LocalVector<NodePlan> nodes;
+	};
+
+	mutable Mutex plan_mutex;
+	mutable std::atomic<InstantiationPlan *> plan = { nullptr };
+	mutable LocalVector<InstantiationPlan *> retired_plans; // Outdated plans other threads may still use.
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -223,6 +246,7 @@ public:
 #endif
 
 	SceneState();
+	~SceneState();
 };
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
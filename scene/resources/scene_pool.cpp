@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+void ScenePool::_free_available() {
+	for (const ObjectID &id : available) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+		instances.erase(id);
+	}
+	available.clear();
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	MutexLock lock(mutex);
+	if (scene == p_scene) {
+		return;
+	}
+	_free_available(); // They are instances of the previous scene.
+	instances.clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_reset_method(const StringName &p_method) {
+	reset_method = p_method;
+}
+
+StringName ScenePool::get_reset_method() const {
+	return reset_method;
+}
+
+void ScenePool::set_max_available(int p_max) {
+	ERR_FAIL_COND(p_max < 0);
+	MutexLock lock(mutex);
+	max_available = p_max;
+	while ((int)available.size() > max_available) {
+		const ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		instances.erase(id);
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int ScenePool::get_max_available() const {
+	return max_available;
+}
+
+Node *ScenePool::acquire() {
+	Node *node = nullptr;
+	{
+		MutexLock lock(mutex);
+		while (!node && !available.is_empty()) {
+			const ObjectID id = available[available.size() - 1];
+			available.resize(available.size() - 1);
+			node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+			if (!node) {
+				instances.erase(id); // Freed while in the pool.
+			}
+		}
+	}
+
+	if (node) {
+		if (reset_method != StringName()) {
+			node->propagate_call(reset_method);
+		}
+		return node;
+	}
+
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "ScenePool has no scene to instantiate.");
+	node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	MutexLock lock(mutex);
+	instances.insert(node->get_instance_id());
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	const ObjectID id = p_node->get_instance_id();
+	{
+		MutexLock lock(mutex);
+		ERR_FAIL_COND_MSG(!instances.has(id), vformat("Node '%s' was not acquired from this ScenePool.", p_node->get_name()));
+		ERR_FAIL_COND_MSG(available.has(id), vformat("Node '%s' was already released to this ScenePool.", p_node->get_name()));
+	}
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	MutexLock lock(mutex);
+	if ((int)available.size() < max_available) {
+		available.push_back(id);
+	} else {
+		instances.erase(id);
+		memdelete(p_node);
+	}
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	ERR_FAIL_COND_MSG(scene.is_null(), "ScenePool has no scene to instantiate.");
+	p_count = MIN(p_count, max_available);
+
+	while (get_available_count() < p_count) {
+		Node *node = scene->instantiate();
+		ERR_FAIL_NULL(node);
+
+		MutexLock lock(mutex);
+		instances.insert(node->get_instance_id());
+		available.push_back(node->get_instance_id());
+	}
+}
+
+int ScenePool::get_available_count() const {
+	MutexLock lock(mutex);
+	return available.size();
+}
+
+void ScenePool::clear() {
+	MutexLock lock(mutex);
+	_free_available();
+
+	// Forget the instances that were freed elsewhere.
+	LocalVector<ObjectID> freed;
+	for (const ObjectID &id : instances) {
+		if (!ObjectDB::get_instance(id)) {
+			freed.push_back(id);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		instances.erase(id);
+	}
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_reset_method", "method"), &ScenePool::set_reset_method);
+	ClassDB::bind_method(D_METHOD("get_reset_method"), &ScenePool::get_reset_method);
+	ClassDB::bind_method(D_METHOD("set_max_available", "max"), &ScenePool::set_max_available);
+	ClassDB::bind_method(D_METHOD("get_max_available"), &ScenePool::get_max_available);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "reset_method"), "set_reset_method", "get_reset_method");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_available", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_max_available", "get_max_available");
+}
+
+ScenePool::~ScenePool() {
+	_free_available();
+}
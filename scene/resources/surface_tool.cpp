@@ -33,6 +33,8 @@
 #define EQ_VERTEX_DIST 0.00001
 
 SurfaceTool::OptimizeVertexCacheFunc SurfaceTool::optimize_vertex_cache_func = nullptr;
+SurfaceTool::OptimizeOverdrawFunc SurfaceTool::optimize_overdraw_func = nullptr;
+SurfaceTool::OptimizeVertexFetchRemapFunc SurfaceTool::optimize_vertex_fetch_remap_func = nullptr;
 SurfaceTool::SimplifyFunc SurfaceTool::simplify_func = nullptr;
 SurfaceTool::SimplifyWithAttribFunc SurfaceTool::simplify_with_attrib_func = nullptr;
 SurfaceTool::SimplifyScaleFunc SurfaceTool::simplify_scale_func = nullptr;
@@ -40,6 +42,8 @@ SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::BuildMeshletsBoundFunc SurfaceTool::build_meshlets_bound_func = nullptr;
+SurfaceTool::BuildMeshletsFunc SurfaceTool::build_meshlets_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -76,6 +80,50 @@ void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32A
 	r_indices.resize(filtered_indices_count * 3);
 }
 
+void SurfaceTool::cluster_mesh_indices(PackedInt32Array &r_indices, const Vector<Vector3> &p_vertices) {
+	ERR_FAIL_COND_MSG(!build_meshlets_bound_func || !build_meshlets_func, "Meshoptimizer library is not initialized.");
+	ERR_FAIL_COND(r_indices.size() % 3 != 0);
+
+	const size_t index_count = r_indices.size();
+	if (index_count <= MESHLET_MAX_TRIANGLES * 3) {
+		return; // Fits in a single cluster, nothing to reorder.
+	}
+
+	LocalVector<float> positions;
+	positions.resize(p_vertices.size() * 3);
+	for (int i = 0; i < p_vertices.size(); i++) {
+		positions[i * 3 + 0] = p_vertices[i].x;
+		positions[i * 3 + 1] = p_vertices[i].y;
+		positions[i * 3 + 2] = p_vertices[i].z;
+	}
+
+	const size_t max_meshlets = build_meshlets_bound_func(index_count, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES);
+	LocalVector<Meshlet> meshlets;
+	meshlets.resize(max_meshlets);
+	LocalVector<unsigned int> meshlet_vertices;
+	meshlet_vertices.resize(max_meshlets * MESHLET_MAX_VERTICES);
+	LocalVector<unsigned char> meshlet_triangles;
+	meshlet_triangles.resize(max_meshlets * MESHLET_MAX_TRIANGLES * 3);
+
+	// A non-zero cone weight keeps the clusters usable for backface cone culling.
+	const size_t meshlet_count = build_meshlets_func(meshlets.ptr(), meshlet_vertices.ptr(), meshlet_triangles.ptr(), (const unsigned int *)r_indices.ptr(), index_count, positions.ptr(), p_vertices.size(), sizeof(float) * 3, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES, 0.25);
+
+	PackedInt32Array clustered;
+	clustered.resize(index_count);
+	int *clustered_ptr = clustered.ptrw();
+	size_t written = 0;
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const Meshlet &meshlet = meshlets[i];
+		ERR_FAIL_COND(written + meshlet.triangle_count * 3 > index_count);
+		for (uint32_t j = 0; j < meshlet.triangle_count * 3; j++) {
+			clustered_ptr[written++] = meshlet_vertices[meshlet.vertex_offset + meshlet_triangles[meshlet.triangle_offset + j]];
+		}
+	}
+	ERR_FAIL_COND(written != index_count);
+
+	r_indices = clustered;
+}
+
 bool SurfaceTool::Vertex::operator==(const Vertex &p_vertex) const {
 	if (vertex != p_vertex.vertex) {
 		return false;
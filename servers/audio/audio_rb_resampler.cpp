@@ -31,6 +31,7 @@
 #include "audio_rb_resampler.h"
 #include "core/math/math_funcs.h"
 #include "core/os/os.h"
+#include "servers/audio/audio_sinc_kernel.h"
 #include "servers/audio_server.h"
 
 int AudioRBResampler::get_channel_count() const {
@@ -101,6 +102,48 @@ uint32_t AudioRBResampler::_resample(AudioFrame *p_dest, int p_todo, int32_t p_i
 	return read >> MIX_FRAC_BITS; //rb_read_pos = offset >> MIX_FRAC_BITS;
 }
 
+// Windowed sinc interpolation, the first two channels are used as left and right.
+template <int C, int TAPS>
+uint32_t AudioRBResampler::_resample_sinc(AudioFrame *p_dest, int p_todo, int32_t p_increment, const float *p_table) {
+	uint32_t read = offset & MIX_FRAC_MASK;
+	AudioFrame window[TAPS];
+
+	for (int i = 0; i < p_todo; i++) {
+		offset = (offset + p_increment) & (((1 << (rb_bits + MIX_FRAC_BITS)) - 1));
+		read += p_increment;
+		uint32_t pos = offset >> MIX_FRAC_BITS;
+		float frac = float(offset & MIX_FRAC_MASK) / float(MIX_FRAC_LEN);
+		ERR_FAIL_COND_V(pos >= rb_len, 0);
+
+		for (int j = 0; j < TAPS; j++) {
+			const uint32_t src = (pos + rb_len + j - (TAPS / 2 - 1)) & rb_mask;
+			if constexpr (C == 1) {
+				window[j] = AudioFrame(rb[src], rb[src]);
+			} else {
+				window[j] = AudioFrame(rb[src * C + 0], rb[src * C + 1]);
+			}
+		}
+
+		p_dest[i] = AudioSincKernel::interpolate<TAPS>(p_table, window, frac);
+	}
+
+	return read >> MIX_FRAC_BITS;
+}
+
+template <int C>
+uint32_t AudioRBResampler::_resample_quality(AudioFrame *p_dest, int p_todo, int32_t p_increment) {
+	switch (AudioServer::get_singleton()->get_resampling_quality()) {
+		case AudioServer::RESAMPLING_QUALITY_FAST:
+			return _resample<C>(p_dest, p_todo, p_increment);
+		case AudioServer::RESAMPLING_QUALITY_MEDIUM:
+			return _resample_sinc<C, 8>(p_dest, p_todo, p_increment, AudioSincKernel::get_table(8));
+		case AudioServer::RESAMPLING_QUALITY_HIGH:
+			// The history kept in the ring buffer is enough for 16 taps.
+			return _resample_sinc<C, 16>(p_dest, p_todo, p_increment, AudioSincKernel::get_table(16));
+	}
+	return 0;
+}
+
 bool AudioRBResampler::mix(AudioFrame *p_dest, int p_frames) {
 	if (!rb) {
 		return false;
@@ -114,16 +157,16 @@ bool AudioRBResampler::mix(AudioFrame *p_dest, int p_frames) {
 		int src_read = 0;
 		switch (channels) {
 			case 1:
-				src_read = _resample<1>(p_dest, target_todo, increment);
+				src_read = _resample_quality<1>(p_dest, target_todo, increment);
 				break;
 			case 2:
-				src_read = _resample<2>(p_dest, target_todo, increment);
+				src_read = _resample_quality<2>(p_dest, target_todo, increment);
 				break;
 			case 4:
-				src_read = _resample<4>(p_dest, target_todo, increment);
+				src_read = _resample_quality<4>(p_dest, target_todo, increment);
 				break;
 			case 6:
-				src_read = _resample<6>(p_dest, target_todo, increment);
+				src_read = _resample_quality<6>(p_dest, target_todo, increment);
 				break;
 		}
 
@@ -155,6 +198,10 @@ int AudioRBResampler::get_num_of_ready_frames() {
 	}
 	int32_t increment = (src_mix_rate * MIX_FRAC_LEN) / target_mix_rate;
 	int read_space = get_reader_space();
+	if (AudioServer::get_singleton()->get_resampling_quality() != AudioServer::RESAMPLING_QUALITY_FAST) {
+		// The sinc kernels read a few frames ahead of the interpolated position.
+		read_space = MAX(0, read_space - AudioSincKernel::MAX_TAPS / 2);
+	}
 	return (int64_t(read_space) << MIX_FRAC_BITS) / increment;
 }
 
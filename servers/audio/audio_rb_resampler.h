@@ -60,6 +60,10 @@ struct AudioRBResampler {
 
 	template <int C>
 	uint32_t _resample(AudioFrame *p_dest, int p_todo, int32_t p_increment);
+	template <int C, int TAPS>
+	uint32_t _resample_sinc(AudioFrame *p_dest, int p_todo, int32_t p_increment, const float *p_table);
+	template <int C>
+	uint32_t _resample_quality(AudioFrame *p_dest, int p_todo, int32_t p_increment);
 
 public:
 	_FORCE_INLINE_ void flush() {
@@ -76,6 +80,11 @@ public:
 		return rb_len - 1;
 	}
 
+	// Frames kept behind the read position, for the history of the sinc interpolation.
+	enum {
+		INTERP_HISTORY = 8,
+	};
+
 	_FORCE_INLINE_ int get_writer_space() const {
 		int space, r, w;
 
@@ -90,7 +99,7 @@ public:
 			space = (rb_len - r) + w - 1;
 		}
 
-		return space;
+		return MAX(0, space - INTERP_HISTORY);
 	}
 
 	_FORCE_INLINE_ int get_reader_space() const {
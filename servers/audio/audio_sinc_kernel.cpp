@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  audio_sinc_kernel.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_sinc_kernel.h"
+
+#include "core/math/math_funcs.h"
+#include "core/templates/local_vector.h"
+
+// Zeroth order modified Bessel function of the first kind, for the Kaiser window.
+static double bessel_i0(double p_x) {
+	double sum = 1.0;
+	double term = 1.0;
+	const double half_x = p_x * 0.5;
+	for (int k = 1; k < 32; k++) {
+		term *= (half_x / k) * (half_x / k);
+		sum += term;
+		if (term < sum * 1e-12) {
+			break;
+		}
+	}
+	return sum;
+}
+
+static void build_table(float *r_table, int p_taps, double p_cutoff, double p_beta) {
+	const int half_taps = p_taps / 2;
+	const double i0_beta = bessel_i0(p_beta);
+
+	LocalVector<double> coefs;
+	coefs.resize((AudioSincKernel::PHASES + 1) * p_taps);
+	for (int phase = 0; phase <= AudioSincKernel::PHASES; phase++) {
+		const double frac = double(phase) / AudioSincKernel::PHASES;
+		double sum = 0.0;
+		for (int tap = 0; tap < p_taps; tap++) {
+			// Distance from the interpolated point, which lies between taps half_taps - 1 and half_taps.
+			const double x = (tap - (half_taps - 1)) - frac;
+			const double t = x / half_taps;
+			const double window = t * t < 1.0 ? bessel_i0(p_beta * Math::sqrt(1.0 - t * t)) / i0_beta : 0.0;
+			const double sinc = x == 0.0 ? 1.0 : Math::sin(Math_PI * p_cutoff * x) / (Math_PI * p_cutoff * x);
+			coefs[phase * p_taps + tap] = sinc * window;
+			sum += sinc * window;
+		}
+		// Unity gain at DC for every phase.
+		for (int tap = 0; tap < p_taps; tap++) {
+			coefs[phase * p_taps + tap] /= sum;
+		}
+	}
+
+	for (int phase = 0; phase < AudioSincKernel::PHASES; phase++) {
+		float *dst = r_table + phase * p_taps * 4;
+		for (int tap = 0; tap < p_taps; tap++) {
+			const float coef = coefs[phase * p_taps + tap];
+			const float delta = coefs[(phase + 1) * p_taps + tap] - coefs[phase * p_taps + tap];
+			dst[tap * 2 + 0] = coef;
+			dst[tap * 2 + 1] = coef;
+			dst[p_taps * 2 + tap * 2 + 0] = delta;
+			dst[p_taps * 2 + tap * 2 + 1] = delta;
+		}
+	}
+}
+
+struct AudioSincTables {
+	float table_8[AudioSincKernel::PHASES * 8 * 4];
+	float table_16[AudioSincKernel::PHASES * 16 * 4];
+
+	AudioSincTables() {
+		// Shorter kernels need a wider transition band to keep the stopband attenuation.
+		build_table(table_8, 8, 0.84, 6.0);
+		build_table(table_16, 16, 0.92, 8.0);
+	}
+};
+
+const float *AudioSincKernel::get_table(int p_taps) {
+	static const AudioSincTables tables; // Built on first use, thread-safe.
+	return p_taps == 16 ? tables.table_16 : tables.table_8;
+}
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  audio_sinc_kernel.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_SINC_KERNEL_H
+#define AUDIO_SINC_KERNEL_H
+
+#include "core/math/audio_frame.h"
+#include "core/typedefs.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_SINC_KERNEL_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define AUDIO_SINC_KERNEL_NEON
+#endif
+
+// Windowed sinc (Kaiser) interpolation, used by the resamplers when the resampling quality allows it.
+// The kernel is tabulated for a fixed amount of fractional positions, linearly interpolated in between.
+class AudioSincKernel {
+public:
+	enum {
+		PHASES = 256,
+		MAX_TAPS = 16,
+	};
+
+	// Returns the table for 8 or 16 taps. For each phase, it holds the coefficients with every tap repeated
+	// for the left and right channel, followed by the difference with the coefficients of the next phase.
+	static const float *get_table(int p_taps);
+
+	// p_src points to TAPS frames, the interpolated point lies p_frac after p_src[TAPS / 2 - 1].
+	template <int TAPS>
+	static _FORCE_INLINE_ AudioFrame interpolate(const float *p_table, const AudioFrame *p_src, float p_frac) {
+		static_assert(TAPS % 2 == 0 && TAPS <= MAX_TAPS);
+
+		const float phase_pos = p_frac * PHASES;
+		const int phase = MIN(int(phase_pos), PHASES - 1);
+		const float t = phase_pos - phase;
+
+		const float *coefs = p_table + phase * TAPS * 4;
+		const float *deltas = coefs + TAPS * 2;
+		const float *src = &p_src[0].left;
+
+#if defined(AUDIO_SINC_KERNEL_SSE2)
+		const __m128 t4 = _mm_set1_ps(t);
+		__m128 sum = _mm_setzero_ps();
+		for (int i = 0; i < TAPS * 2; i += 4) {
+			const __m128 c = _mm_add_ps(_mm_loadu_ps(coefs + i), _mm_mul_ps(_mm_loadu_ps(deltas + i), t4));
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + i), c));
+		}
+		// Lanes hold left, right, left, right.
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		float lanes[4];
+		_mm_storeu_ps(lanes, sum);
+		return AudioFrame(lanes[0], lanes[1]);
+#elif defined(AUDIO_SINC_KERNEL_NEON)
+		float32x4_t sum = vdupq_n_f32(0.0f);
+		for (int i = 0; i < TAPS * 2; i += 4) {
+			const float32x4_t c = vmlaq_n_f32(vld1q_f32(coefs + i), vld1q_f32(deltas + i), t);
+			sum = vmlaq_f32(sum, vld1q_f32(src + i), c);
+		}
+		const float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+		return AudioFrame(vget_lane_f32(pair, 0), vget_lane_f32(pair, 1));
+#else
+		float left = 0.0f;
+		float right = 0.0f;
+		for (int i = 0; i < TAPS * 2; i += 2) {
+			left += src[i] * (coefs[i] + deltas[i] * t);
+			right += src[i + 1] * (coefs[i + 1] + deltas[i + 1] * t);
+		}
+		return AudioFrame(left, right);
+#endif
+	}
+};
+
+#endif // AUDIO_SINC_KERNEL_H
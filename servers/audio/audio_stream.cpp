@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
+#include "servers/audio/audio_sinc_kernel.h"
 
 void AudioStreamPlayback::start(double p_from_pos) {
 	if (GDVIRTUAL_CALL(_start, p_from_pos)) {
@@ -120,16 +121,259 @@ AudioStreamPlayback::~AudioStreamPlayback() {
 //////////////////////////////
 
 void AudioStreamPlaybackResampled::begin_resample() {
-	//clear cubic interpolation history
-	internal_buffer[0] = AudioFrame(0.0, 0.0);
-	internal_buffer[1] = AudioFrame(0.0, 0.0);
-	internal_buffer[2] = AudioFrame(0.0, 0.0);
-	internal_buffer[3] = AudioFrame(0.0, 0.0);
+	//clear interpolation history
+	for (int i = 0; i < INTERP_HISTORY; i++) {
+		internal_buffer[i] = AudioFrame(0.0, 0.0);
+	}
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_fill_internal_buffer(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
 }
 
+void AudioStreamPlaybackResampled::set_background_decode(bool p_enable) {
+	// Not mixed yet, so no other thread uses the ring buffer.
+	background_decode = p_enable && AudioServer::get_singleton() && AudioServer::get_singleton()->is_stream_background_decode_enabled();
+	decode_read_pos.set(0);
+	decode_write_pos.set(0);
+	decode_flush_pos.set(0);
+	decode_ended.clear();
+
+	if (!background_decode) {
+		decode_buffer.clear();
+		decode_buffer_frames = 0;
+		decode_buffer_mask = 0;
+		return;
+	}
+
+	decode_sampling_rate = get_stream_sampling_rate();
+	decode_buffer_frames = next_power_of_2(MAX(uint32_t(decode_sampling_rate * AudioServer::get_singleton()->get_stream_prebuffer_time()), (uint32_t)INTERNAL_BUFFER_LEN * 4));
+	decode_buffer.resize(decode_buffer_frames);
+	decode_buffer_mask = decode_buffer_frames - 1;
+}
+
+uint32_t AudioStreamPlaybackResampled::_get_decode_read_pos() const {
+	const uint32_t read_pos = decode_read_pos.get();
+	const uint32_t flush_pos = decode_flush_pos.get();
+	return int32_t(flush_pos - read_pos) > 0 ? flush_pos : read_pos;
+}
+
+void AudioStreamPlaybackResampled::_post_decoder_command(uint32_t p_command, double p_time) {
+	{
+		MutexLock lock(decode_command_mutex);
+		switch (p_command) {
+			case DECODER_COMMAND_START: {
+				decode_commands = (decode_commands & DECODER_COMMAND_STOP) | DECODER_COMMAND_START;
+				decode_start_time = p_time;
+				decode_playing_posted.set();
+			} break;
+			case DECODER_COMMAND_SEEK: {
+				decode_commands |= DECODER_COMMAND_SEEK;
+				decode_seek_time = p_time;
+			} break;
+			case DECODER_COMMAND_STOP: {
+				decode_commands = DECODER_COMMAND_STOP;
+				decode_playing_posted.clear();
+			} break;
+		}
+		decode_commands_posted.increment();
+	}
+	_request_decode();
+}
+
+void AudioStreamPlaybackResampled::_run_decoder_commands() {
+	// Called with decode_mutex held.
+	uint32_t commands;
+	double start_time;
+	double seek_time;
+	uint32_t serial;
+	{
+		MutexLock lock(decode_command_mutex);
+		commands = decode_commands;
+		start_time = decode_start_time;
+		seek_time = decode_seek_time;
+		serial = decode_commands_posted.get();
+		decode_commands = 0;
+	}
+	if (serial == decode_commands_done.get()) {
+		return;
+	}
+
+	if (commands & DECODER_COMMAND_STOP) {
+		_stop_decoder();
+	}
+	if (commands & DECODER_COMMAND_START) {
+		_start_decoder(start_time);
+	}
+	if (commands & DECODER_COMMAND_SEEK) {
+		_seek_decoder(seek_time);
+	}
+
+	// The frames decoded so far belong to the previous position.
+	decode_flush_pos.set(decode_write_pos.get());
+	decode_ended.clear();
+	decode_commands_done.set(serial);
+}
+
+void AudioStreamPlaybackResampled::_request_decode() {
+	if (!decode_requested.is_set()) {
+		decode_requested.set();
+		AudioServer::get_singleton()->request_stream_decode(this);
+	}
+}
+
+void AudioStreamPlaybackResampled::_decode_frames(uint32_t p_max_frames) {
+	// Called with decode_mutex held, from the only thread writing to the ring buffer at this point.
+	AudioFrame chunk[INTERNAL_BUFFER_LEN];
+	uint32_t decoded = 0;
+
+	while (decoded < p_max_frames && !decode_ended.is_set()) {
+		const uint32_t write_pos = decode_write_pos.get();
+		// Only the frames the mix has read can be overwritten, even if a seek discarded the others.
+		if (write_pos - decode_read_pos.get() + INTERNAL_BUFFER_LEN > decode_buffer_frames) {
+			break; // Full.
+		}
+
+		const int mixed_frames = _mix_internal(chunk, INTERNAL_BUFFER_LEN);
+		for (int i = 0; i < mixed_frames; i++) {
+			decode_buffer[(write_pos + i) & decode_buffer_mask] = chunk[i];
+		}
+		decode_write_pos.set(write_pos + mixed_frames);
+		decoded += mixed_frames;
+
+		if (mixed_frames != INTERNAL_BUFFER_LEN) {
+			decode_ended.set();
+		}
+	}
+}
+
+void AudioStreamPlaybackResampled::_decode_ahead() {
+	MutexLock lock(decode_mutex);
+	decode_requested.clear();
+	if (background_decode) {
+		_run_decoder_commands();
+		_decode_frames(decode_buffer_frames);
+	}
+}
+
+void AudioStreamPlaybackResampled::start_decoder(double p_from_pos) {
+	if (background_decode) {
+		_post_decoder_command(DECODER_COMMAND_START, p_from_pos);
+	} else {
+		_start_decoder(p_from_pos);
+	}
+}
+
+void AudioStreamPlaybackResampled::seek_decoder(double p_time) {
+	if (background_decode) {
+		_post_decoder_command(DECODER_COMMAND_SEEK, p_time);
+	} else {
+		_seek_decoder(p_time);
+	}
+}
+
+void AudioStreamPlaybackResampled::stop_decoder() {
+	if (background_decode) {
+		_post_decoder_command(DECODER_COMMAND_STOP, 0.0);
+	} else {
+		_stop_decoder();
+	}
+}
+
+bool AudioStreamPlaybackResampled::is_decoder_playing(bool p_active) const {
+	if (!background_decode) {
+		return p_active;
+	}
+	if (_is_decoder_command_pending()) {
+		return decode_playing_posted.is_set();
+	}
+	return p_active || decode_write_pos.get() != _get_decode_read_pos();
+}
+
+double AudioStreamPlaybackResampled::get_decoded_time() const {
+	if (!background_decode || decode_sampling_rate <= 0) {
+		return 0.0;
+	}
+	const uint32_t frames = decode_write_pos.get() - _get_decode_read_pos();
+	return frames / double(decode_sampling_rate);
+}
+
+uint32_t AudioStreamPlaybackResampled::_read_ring(AudioFrame *p_buffer, uint32_t p_frames) {
+	// Only the frames before the write position are read, the decode thread doesn't touch them until the read
+	// position moves past them.
+	const uint32_t read_pos = _get_decode_read_pos();
+	const uint32_t frames = MIN(decode_write_pos.get() - read_pos, p_frames);
+	for (uint32_t i = 0; i < frames; i++) {
+		p_buffer[i] = decode_buffer[(read_pos + i) & decode_buffer_mask];
+	}
+	decode_read_pos.set(read_pos + frames);
+	return frames;
+}
+
+int AudioStreamPlaybackResampled::_read_decoded(AudioFrame *p_buffer, int p_frames) {
+	const uint32_t commands_done = decode_commands_done.get();
+	bool pending = commands_done != decode_commands_posted.get();
+	bool ended = false;
+	uint32_t frames = 0;
+
+	if (!pending) {
+		// Check for the end first, everything decoded before it was set is visible then.
+		ended = decode_ended.is_set();
+		frames = _read_ring(p_buffer, p_frames);
+		if (ended && decode_commands_done.get() != commands_done) {
+			ended = false; // A seek ran meanwhile, the end belongs to the previous position.
+		}
+	}
+
+	if (frames < (uint32_t)p_frames && !ended) {
+		// The decode thread fell behind, or the playback is mixed faster than real time (e.g. for previews). Other
+		// threads wait for it and decode the rest themselves, while the mix only does so if it is idle and nothing
+		// slow is queued (seeking), and plays silence otherwise.
+		bool locked = false;
+		if (!AudioServer::get_singleton()->is_mix_thread()) {
+			decode_mutex.lock();
+			_run_decoder_commands();
+			locked = true;
+		} else if (!pending && decode_mutex.try_lock()) {
+			locked = true;
+			if (_is_decoder_command_pending()) {
+				decode_mutex.unlock();
+				locked = false;
+			}
+		}
+
+		if (locked) {
+			ended = decode_ended.is_set();
+			frames += _read_ring(p_buffer + frames, p_frames - frames);
+			if (frames < (uint32_t)p_frames && !ended) {
+				const int mixed_frames = _mix_internal(p_buffer + frames, p_frames - frames);
+				frames += mixed_frames;
+				if (frames < (uint32_t)p_frames) {
+					decode_ended.set();
+					ended = true;
+				}
+			}
+			decode_mutex.unlock();
+		}
+	}
+
+	if (!ended && (decode_write_pos.get() - _get_decode_read_pos() < decode_buffer_frames / 2 || _is_decoder_command_pending())) {
+		_request_decode();
+	}
+
+	for (int i = frames; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+	// An underrun is played as silence, only the end of the stream is reported.
+	return ended ? frames : p_frames;
+}
+
+int AudioStreamPlaybackResampled::_fill_internal_buffer(AudioFrame *p_buffer, int p_frames) {
+	if (background_decode) {
+		return _read_decoded(p_buffer, p_frames);
+	}
+	return _mix_internal(p_buffer, p_frames);
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret = 0;
 	GDVIRTUAL_REQUIRED_CALL(_mix_resampled, p_buffer, p_frames, ret);
@@ -156,38 +400,51 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	int mixed_frames_total = -1;
 
+	const AudioServer::ResamplingQuality quality = AudioServer::get_singleton()->get_resampling_quality();
+	const float *sinc_table = quality == AudioServer::RESAMPLING_QUALITY_FAST ? nullptr : AudioSincKernel::get_table(quality == AudioServer::RESAMPLING_QUALITY_HIGH ? 16 : 8);
+
 	int i;
 	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+		uint32_t idx = INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
 		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
 
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
+		if (uint32_t(mix_offset >> FP_BITS) + CUBIC_INTERP_HISTORY >= internal_buffer_end && mixed_frames_total == -1) {
 			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
 			mixed_frames_total = i;
 		}
 
-		float mu2 = mu * mu;
-		AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
-		AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = 2 * y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		switch (quality) {
+			case AudioServer::RESAMPLING_QUALITY_FAST: {
+				//standard cubic interpolation (great quality/performance ratio)
+				//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+				AudioFrame y0 = internal_buffer[idx - 3];
+				AudioFrame y1 = internal_buffer[idx - 2];
+				AudioFrame y2 = internal_buffer[idx - 1];
+				AudioFrame y3 = internal_buffer[idx - 0];
+
+				float mu2 = mu * mu;
+				AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
+				AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
+				AudioFrame a2 = y2 - y0;
+				AudioFrame a3 = 2 * y1;
+
+				p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+			} break;
+			case AudioServer::RESAMPLING_QUALITY_MEDIUM: {
+				p_buffer[i] = AudioSincKernel::interpolate<8>(sinc_table, &internal_buffer[idx - 7], mu);
+			} break;
+			case AudioServer::RESAMPLING_QUALITY_HIGH: {
+				p_buffer[i] = AudioSincKernel::interpolate<16>(sinc_table, &internal_buffer[idx - 15], mu);
+			} break;
+		}
 
 		mix_offset += mix_increment;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			for (int j = 0; j < INTERP_HISTORY; j++) {
+				internal_buffer[j] = internal_buffer[INTERNAL_BUFFER_LEN + j];
+			}
+			int mixed_frames = _fill_internal_buffer(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
@@ -126,15 +126,74 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		CUBIC_INTERP_HISTORY = 4,
+		INTERP_HISTORY = 16, // Enough for the longest sinc kernel.
 	};
 
-	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
+	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	// Background decoding. _mix_internal() runs ahead of time on the AudioServer decode thread and fills a ring
+	// buffer, which the mix reads without locking. Only the decode thread writes frames to the ring buffer, and only
+	// the mix moves the read position. Positions only grow and wrap around uint32_t.
+	friend class AudioServer;
+	bool background_decode = false; // Only changed before the playback is mixed.
+	uint32_t decode_buffer_frames = 0;
+	LocalVector<AudioFrame> decode_buffer; // Allocated by the decode thread, before it first publishes frames.
+	uint32_t decode_buffer_mask = 0;
+	float decode_sampling_rate = 0.0f;
+	SafeNumeric<uint32_t> decode_read_pos; // Written by the mix.
+	SafeNumeric<uint32_t> decode_write_pos; // Written by the decode thread.
+	SafeNumeric<uint32_t> decode_flush_pos; // Frames before this position were discarded by a seek, written with decode_mutex held.
+	SafeFlag decode_ended;
+	SafeFlag decode_requested;
+
+	// Starting, seeking and stopping change the decoder, so they are queued and run by the thread decoding next.
+	enum {
+		DECODER_COMMAND_START = 1,
+		DECODER_COMMAND_SEEK = 2,
+		DECODER_COMMAND_STOP = 4,
+	};
+	// Held while decoding, either on the decode thread or by a thread that can't wait for it to catch up.
+	Mutex decode_mutex;
+	Mutex decode_command_mutex; // Only held to queue or take commands, never while decoding.
+	uint32_t decode_commands = 0;
+	double decode_start_time = 0.0;
+	double decode_seek_time = 0.0;
+	SafeNumeric<uint32_t> decode_commands_posted;
+	SafeNumeric<uint32_t> decode_commands_done;
+	SafeFlag decode_playing_posted; // Whether the last queued start or stop leaves the playback playing.
+
+	uint32_t _get_decode_read_pos() const;
+	_FORCE_INLINE_ bool _is_decoder_command_pending() const { return decode_commands_done.get() != decode_commands_posted.get(); }
+	void _post_decoder_command(uint32_t p_command, double p_time);
+	void _run_decoder_commands();
+	void _request_decode();
+	void _decode_frames(uint32_t p_max_frames);
+	void _decode_ahead();
+	uint32_t _read_ring(AudioFrame *p_buffer, uint32_t p_frames);
+	int _read_decoded(AudioFrame *p_buffer, int p_frames);
+	int _fill_internal_buffer(AudioFrame *p_buffer, int p_frames);
+
 protected:
 	void begin_resample();
+	// Used by playbacks of compressed streams, enabled if the project settings allow it. Must be called before the
+	// playback is started, once the stream sampling rate is known.
+	void set_background_decode(bool p_enable);
+	// Run the matching _start_decoder(), _seek_decoder() and _stop_decoder() right away, or on the decode thread when
+	// decoding in the background. The frames decoded before are dropped then. Seeks done from _mix_internal() (e.g.
+	// to loop) must change the decoder directly instead.
+	void start_decoder(double p_from_pos);
+	void seek_decoder(double p_time);
+	void stop_decoder();
+	// To implement is_playing(), accounts for queued commands and the frames decoded ahead.
+	bool is_decoder_playing(bool p_active) const;
+	// The decoder is ahead of what is heard by this much.
+	double get_decoded_time() const;
+	virtual void _start_decoder(double p_from_pos) {}
+	virtual void _seek_decoder(double p_time) {}
+	virtual void _stop_decoder() {}
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
 	virtual float get_stream_sampling_rate();
@@ -31,6 +31,10 @@
 #include "audio_effect_compressor.h"
 #include "servers/audio_server.h"
 
+bool AudioEffectCompressorInstance::has_sidechain() const {
+	return base->sidechain != StringName();
+}
+
 void AudioEffectCompressorInstance::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
 	float threshold = Math::db_to_linear(base->threshold);
 	float sample_rate = AudioServer::get_singleton()->get_mix_rate();
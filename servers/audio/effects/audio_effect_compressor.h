@@ -45,6 +45,7 @@ class AudioEffectCompressorInstance : public AudioEffectInstance {
 
 public:
 	void set_current_channel(int p_channel) { current_channel = p_channel; }
+	bool has_sidechain() const;
 	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
 };
 
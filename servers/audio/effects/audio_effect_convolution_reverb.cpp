@@ -0,0 +1,474 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_effect_convolution_reverb.h"
+
+#include "servers/audio_server.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONVOLUTION_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CONVOLUTION_NEON
+#endif
+
+typedef AudioEffectConvolutionReverbInstance ConvolutionInstance;
+
+struct ConvolutionFFTTables {
+	float cos_table[ConvolutionInstance::FFT_SIZE / 2];
+	float sin_table[ConvolutionInstance::FFT_SIZE / 2];
+	uint16_t bit_reverse[ConvolutionInstance::FFT_SIZE];
+
+	ConvolutionFFTTables() {
+		const int n = ConvolutionInstance::FFT_SIZE;
+		for (int i = 0; i < n / 2; i++) {
+			double phase = -2.0 * Math_PI * i / n;
+			cos_table[i] = Math::cos(phase);
+			sin_table[i] = Math::sin(phase);
+		}
+
+		int bits = 0;
+		while ((1 << bits) < n) {
+			bits++;
+		}
+		for (int i = 0; i < n; i++) {
+			int reversed = 0;
+			for (int j = 0; j < bits; j++) {
+				reversed |= ((i >> j) & 1) << (bits - 1 - j);
+			}
+			bit_reverse[i] = reversed;
+		}
+	}
+};
+
+static const ConvolutionFFTTables &_get_fft_tables() {
+	static ConvolutionFFTTables tables;
+	return tables;
+}
+
+void AudioEffectConvolutionReverbInstance::fft(float *p_re, float *p_im, bool p_inverse) {
+	const ConvolutionFFTTables &tables = _get_fft_tables();
+
+	for (int i = 0; i < FFT_SIZE; i++) {
+		int j = tables.bit_reverse[i];
+		if (j > i) {
+			SWAP(p_re[i], p_re[j]);
+			SWAP(p_im[i], p_im[j]);
+		}
+	}
+
+	const float sign = p_inverse ? -1.0 : 1.0;
+	for (int size = 2; size <= FFT_SIZE; size <<= 1) {
+		const int half = size >> 1;
+		const int step = FFT_SIZE / size;
+		for (int i = 0; i < FFT_SIZE; i += size) {
+			for (int j = 0; j < half; j++) {
+				const float wr = tables.cos_table[j * step];
+				const float wi = tables.sin_table[j * step] * sign;
+				const int a = i + j;
+				const int b = a + half;
+				const float tr = wr * p_re[b] - wi * p_im[b];
+				const float ti = wr * p_im[b] + wi * p_re[b];
+				p_re[b] = p_re[a] - tr;
+				p_im[b] = p_im[a] - ti;
+				p_re[a] += tr;
+				p_im[a] += ti;
+			}
+		}
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::split_spectrum(const float *p_re, const float *p_im, float *r_spectrum) {
+	// The spectrum of a real signal is Hermitian, which separates the two channels.
+	float *l_re = r_spectrum;
+	float *l_im = r_spectrum + BINS_PADDED;
+	float *r_re = r_spectrum + BINS_PADDED * 2;
+	float *r_im = r_spectrum + BINS_PADDED * 3;
+
+	for (int k = 0; k < BINS; k++) {
+		const int n = (FFT_SIZE - k) & (FFT_SIZE - 1);
+		l_re[k] = (p_re[k] + p_re[n]) * 0.5;
+		l_im[k] = (p_im[k] - p_im[n]) * 0.5;
+		r_re[k] = (p_im[k] + p_im[n]) * 0.5;
+		r_im[k] = (p_re[n] - p_re[k]) * 0.5;
+	}
+	for (int k = BINS; k < BINS_PADDED; k++) {
+		l_re[k] = 0;
+		l_im[k] = 0;
+		r_re[k] = 0;
+		r_im[k] = 0;
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::merge_spectrum(const float *p_spectrum, float *r_re, float *r_im) {
+	const float *l_re = p_spectrum;
+	const float *l_im = p_spectrum + BINS_PADDED;
+	const float *r_re_src = p_spectrum + BINS_PADDED * 2;
+	const float *r_im_src = p_spectrum + BINS_PADDED * 3;
+
+	for (int k = 0; k < BINS; k++) {
+		r_re[k] = l_re[k] - r_im_src[k];
+		r_im[k] = l_im[k] + r_re_src[k];
+		if (k > 0 && k < BLOCK_SIZE) {
+			r_re[FFT_SIZE - k] = l_re[k] + r_im_src[k];
+			r_im[FFT_SIZE - k] = r_re_src[k] - l_im[k];
+		}
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::multiply_accumulate(float *r_acc, const float *p_a, const float *p_b) {
+	for (int c = 0; c < 2; c++) {
+		float *acc_re = r_acc + BINS_PADDED * c * 2;
+		float *acc_im = acc_re + BINS_PADDED;
+		const float *a_re = p_a + BINS_PADDED * c * 2;
+		const float *a_im = a_re + BINS_PADDED;
+		const float *b_re = p_b + BINS_PADDED * c * 2;
+		const float *b_im = b_re + BINS_PADDED;
+
+#if defined(CONVOLUTION_SSE2)
+		for (int k = 0; k < BINS_PADDED; k += 4) {
+			__m128 ar = _mm_loadu_ps(a_re + k);
+			__m128 ai = _mm_loadu_ps(a_im + k);
+			__m128 br = _mm_loadu_ps(b_re + k);
+			__m128 bi = _mm_loadu_ps(b_im + k);
+			__m128 re = _mm_sub_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi));
+			__m128 im = _mm_add_ps(_mm_mul_ps(ar, bi), _mm_mul_ps(ai, br));
+			_mm_storeu_ps(acc_re + k, _mm_add_ps(_mm_loadu_ps(acc_re + k), re));
+			_mm_storeu_ps(acc_im + k, _mm_add_ps(_mm_loadu_ps(acc_im + k), im));
+		}
+#elif defined(CONVOLUTION_NEON)
+		for (int k = 0; k < BINS_PADDED; k += 4) {
+			float32x4_t ar = vld1q_f32(a_re + k);
+			float32x4_t ai = vld1q_f32(a_im + k);
+			float32x4_t br = vld1q_f32(b_re + k);
+			float32x4_t bi = vld1q_f32(b_im + k);
+			float32x4_t re = vmlsq_f32(vmlaq_f32(vld1q_f32(acc_re + k), ar, br), ai, bi);
+			float32x4_t im = vmlaq_f32(vmlaq_f32(vld1q_f32(acc_im + k), ar, bi), ai, br);
+			vst1q_f32(acc_re + k, re);
+			vst1q_f32(acc_im + k, im);
+		}
+#else
+		for (int k = 0; k < BINS_PADDED; k++) {
+			acc_re[k] += a_re[k] * b_re[k] - a_im[k] * b_im[k];
+			acc_im[k] += a_re[k] * b_im[k] + a_im[k] * b_re[k];
+		}
+#endif
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::_reset() {
+	fdl.resize(ir_partitions * SPECTRUM_SIZE);
+	for (uint32_t i = 0; i < fdl.size(); i++) {
+		fdl[i] = 0;
+	}
+	for (int c = 0; c < 2; c++) {
+		for (int i = 0; i < FFT_SIZE; i++) {
+			input[c][i] = 0;
+		}
+		for (int i = 0; i < BLOCK_SIZE; i++) {
+			output[c][i] = 0;
+		}
+	}
+	fifo_pos = 0;
+	block_index = 0;
+	next_tail_block = 0;
+}
+
+void AudioEffectConvolutionReverbInstance::_compute_tails(uint64_t p_last_block) {
+	// The tail of block t only needs input up to block t - HEAD_PARTITIONS, so it can be
+	// convolved that many blocks ahead.
+	const float *ir = ir_spectra.ptr();
+	const uint64_t end = p_last_block + HEAD_PARTITIONS;
+
+	for (; next_tail_block <= end; next_tail_block++) {
+		const uint64_t t = next_tail_block;
+		float *tail = tails[t % TAIL_SLOTS];
+		for (int i = 0; i < SPECTRUM_SIZE; i++) {
+			tail[i] = 0;
+		}
+
+		const uint64_t last_partition = MIN(uint64_t(ir_partitions - 1), t);
+		for (uint64_t p = HEAD_PARTITIONS; p <= last_partition; p++) {
+			multiply_accumulate(tail, &fdl[((t - p) % ir_partitions) * SPECTRUM_SIZE], ir + p * SPECTRUM_SIZE);
+		}
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::_tail_task(uint32_t p_generation) {
+	uint32_t expected = (p_generation << 2) | TAIL_PENDING;
+	if (!tail_state.compare_exchange_strong(expected, (p_generation << 2) | TAIL_RUNNING)) {
+		// Cancelled, the mix thread convolved the tail itself.
+		return;
+	}
+	_compute_tails(tail_target);
+}
+
+void AudioEffectConvolutionReverbInstance::_sync_tail_task() {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	for (uint32_t i = 0; i < cancelled_tail_tasks.size();) {
+		if (pool->is_task_completed(cancelled_tail_tasks[i])) {
+			pool->wait_for_task_completion(cancelled_tail_tasks[i]);
+			cancelled_tail_tasks.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+
+	if (tail_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+
+	uint32_t expected = (tail_generation << 2) | TAIL_PENDING;
+	if (tail_state.compare_exchange_strong(expected, (tail_generation << 2) | TAIL_CANCELLED)) {
+		// Never started, don't wait behind other low priority work. It is freed once it ran.
+		cancelled_tail_tasks.push_back(tail_task);
+	} else {
+		pool->wait_for_task_completion(tail_task);
+	}
+	tail_task = WorkerThreadPool::INVALID_TASK_ID;
+}
+
+void AudioEffectConvolutionReverbInstance::_process_block() {
+	// Overlap-save: transform the previous and the current block, keep the second half of the result.
+	for (int i = 0; i < FFT_SIZE; i++) {
+		fft_re[i] = input[0][i];
+		fft_im[i] = input[1][i];
+	}
+	fft(fft_re, fft_im, false);
+	split_spectrum(fft_re, fft_im, &fdl[(block_index % ir_partitions) * SPECTRUM_SIZE]);
+
+	for (int c = 0; c < 2; c++) {
+		memcpy(input[c], input[c] + BLOCK_SIZE, sizeof(float) * BLOCK_SIZE);
+	}
+
+	for (int i = 0; i < SPECTRUM_SIZE; i++) {
+		accum[i] = 0;
+	}
+
+	const float *ir = ir_spectra.ptr();
+	const uint64_t head_partitions = MIN(uint64_t(MIN(int(HEAD_PARTITIONS), ir_partitions) - 1), block_index);
+	for (uint64_t p = 0; p <= head_partitions; p++) {
+		multiply_accumulate(accum, &fdl[((block_index - p) % ir_partitions) * SPECTRUM_SIZE], ir + p * SPECTRUM_SIZE);
+	}
+
+	if (ir_partitions > HEAD_PARTITIONS) {
+		if (next_tail_block <= block_index) {
+			// Not convolved ahead of time.
+			_compute_tails(block_index);
+		}
+		const float *tail = tails[block_index % TAIL_SLOTS];
+		for (int i = 0; i < SPECTRUM_SIZE; i++) {
+			accum[i] += tail[i];
+		}
+	}
+
+	merge_spectrum(accum, fft_re, fft_im);
+	fft(fft_re, fft_im, true);
+
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		output[0][i] = fft_re[BLOCK_SIZE + i];
+		output[1][i] = fft_im[BLOCK_SIZE + i];
+	}
+
+	block_index++;
+}
+
+void AudioEffectConvolutionReverbInstance::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
+	_sync_tail_task();
+
+	if (ir_version != base->ir_version) {
+		ir_spectra = base->ir_spectra;
+		ir_partitions = base->ir_partitions;
+		ir_version = base->ir_version;
+		_reset();
+	}
+
+	const float dry = base->dry;
+
+	if (ir_partitions == 0) {
+		for (int i = 0; i < p_frame_count; i++) {
+			p_dst_frames[i] = p_src_frames[i] * dry;
+		}
+		return;
+	}
+
+	const float wet = base->wet;
+
+	for (int i = 0; i < p_frame_count; i++) {
+		input[0][BLOCK_SIZE + fifo_pos] = p_src_frames[i].left;
+		input[1][BLOCK_SIZE + fifo_pos] = p_src_frames[i].right;
+
+		p_dst_frames[i].left = p_src_frames[i].left * dry + output[0][fifo_pos] * wet;
+		p_dst_frames[i].right = p_src_frames[i].right * dry + output[1][fifo_pos] * wet;
+
+		fifo_pos++;
+		if (fifo_pos == BLOCK_SIZE) {
+			_process_block();
+			fifo_pos = 0;
+		}
+	}
+
+	if (ir_partitions > HEAD_PARTITIONS && block_index > 0 && next_tail_block <= block_index - 1 + HEAD_PARTITIONS) {
+		// Convolve the tail of the upcoming blocks while the mix is idle.
+		tail_generation++;
+		tail_target = block_index - 1;
+		tail_state.store((tail_generation << 2) | TAIL_PENDING);
+		tail_task = WorkerThreadPool::get_singleton()->add_template_task(this, &AudioEffectConvolutionReverbInstance::_tail_task, tail_generation, false, SNAME("AudioEffectConvolutionReverb"));
+	}
+}
+
+AudioEffectConvolutionReverbInstance::~AudioEffectConvolutionReverbInstance() {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (tail_task != WorkerThreadPool::INVALID_TASK_ID) {
+		pool->wait_for_task_completion(tail_task);
+	}
+	for (WorkerThreadPool::TaskID task : cancelled_tail_tasks) {
+		pool->wait_for_task_completion(task);
+	}
+}
+
+Ref<AudioEffectInstance> AudioEffectConvolutionReverb::instantiate() {
+	Ref<AudioEffectConvolutionReverbInstance> ins;
+	ins.instantiate();
+	ins->base = Ref<AudioEffectConvolutionReverb>(this);
+	return ins;
+}
+
+void AudioEffectConvolutionReverb::_update_impulse_response() {
+	Vector<float> spectra;
+	int partitions = 0;
+
+	Ref<AudioStreamPlayback> playback;
+	if (impulse_response.is_valid()) {
+		playback = impulse_response->instantiate_playback();
+	}
+
+	if (playback.is_valid()) {
+		const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+		int max_frames = MAX_IMPULSE_RESPONSE_SECONDS * mix_rate;
+		const double length = impulse_response->get_length();
+		if (length > 0) {
+			max_frames = MIN(max_frames, int(Math::ceil(length * mix_rate)));
+		}
+
+		LocalVector<AudioFrame> frames;
+		frames.resize(max_frames);
+
+		int frame_count = 0;
+		playback->start(0);
+		while (frame_count < max_frames && playback->is_playing()) {
+			const int todo = MIN(max_frames - frame_count, 512);
+			const int mixed = playback->mix(&frames[frame_count], 1.0, todo);
+			frame_count += mixed;
+			if (mixed < todo) {
+				break;
+			}
+		}
+		playback->stop();
+
+		// Silence at the end would only cost time.
+		while (frame_count > 0 && MAX(Math::abs(frames[frame_count - 1].left), Math::abs(frames[frame_count - 1].right)) < 1e-5) {
+			frame_count--;
+		}
+
+		const int block_size = ConvolutionInstance::BLOCK_SIZE;
+		const int fft_size = ConvolutionInstance::FFT_SIZE;
+		partitions = (frame_count + block_size - 1) / block_size;
+		spectra.resize(partitions * ConvolutionInstance::SPECTRUM_SIZE);
+		float *w = spectra.ptrw();
+
+		float re[ConvolutionInstance::FFT_SIZE];
+		float im[ConvolutionInstance::FFT_SIZE];
+		for (int p = 0; p < partitions; p++) {
+			for (int i = 0; i < fft_size; i++) {
+				const int frame = p * block_size + i;
+				const bool in_partition = i < block_size && frame < frame_count;
+				re[i] = in_partition ? frames[frame].left : 0.0;
+				im[i] = in_partition ? frames[frame].right : 0.0;
+			}
+			ConvolutionInstance::fft(re, im, false);
+
+			// Fold the scale of the inverse transform in.
+			for (int i = 0; i < fft_size; i++) {
+				re[i] /= fft_size;
+				im[i] /= fft_size;
+			}
+			ConvolutionInstance::split_spectrum(re, im, w + p * ConvolutionInstance::SPECTRUM_SIZE);
+		}
+	}
+
+	AudioServer::get_singleton()->lock();
+	ir_spectra = spectra;
+	ir_partitions = partitions;
+	ir_version++;
+	AudioServer::get_singleton()->unlock();
+}
+
+void AudioEffectConvolutionReverb::set_impulse_response(const Ref<AudioStream> &p_stream) {
+	impulse_response = p_stream;
+	_update_impulse_response();
+}
+
+Ref<AudioStream> AudioEffectConvolutionReverb::get_impulse_response() const {
+	return impulse_response;
+}
+
+void AudioEffectConvolutionReverb::set_dry(float p_dry) {
+	dry = p_dry;
+}
+
+float AudioEffectConvolutionReverb::get_dry() const {
+	return dry;
+}
+
+void AudioEffectConvolutionReverb::set_wet(float p_wet) {
+	wet = p_wet;
+}
+
+float AudioEffectConvolutionReverb::get_wet() const {
+	return wet;
+}
+
+void AudioEffectConvolutionReverb::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_impulse_response", "stream"), &AudioEffectConvolutionReverb::set_impulse_response);
+	ClassDB::bind_method(D_METHOD("get_impulse_response"), &AudioEffectConvolutionReverb::get_impulse_response);
+
+	ClassDB::bind_method(D_METHOD("set_dry", "amount"), &AudioEffectConvolutionReverb::set_dry);
+	ClassDB::bind_method(D_METHOD("get_dry"), &AudioEffectConvolutionReverb::get_dry);
+
+	ClassDB::bind_method(D_METHOD("set_wet", "amount"), &AudioEffectConvolutionReverb::set_wet);
+	ClassDB::bind_method(D_METHOD("get_wet"), &AudioEffectConvolutionReverb::get_wet);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "impulse_response", PROPERTY_HINT_RESOURCE_TYPE, "AudioStream"), "set_impulse_response", "get_impulse_response");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dry", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_dry", "get_dry");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wet", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_wet", "get_wet");
+}
@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_EFFECT_CONVOLUTION_REVERB_H
+#define AUDIO_EFFECT_CONVOLUTION_REVERB_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "servers/audio/audio_effect.h"
+#include "servers/audio/audio_stream.h"
+
+#include <atomic>
+
+class AudioEffectConvolutionReverb;
+
+class AudioEffectConvolutionReverbInstance : public AudioEffectInstance {
+	GDCLASS(AudioEffectConvolutionReverbInstance, AudioEffectInstance);
+
+	friend class AudioEffectConvolutionReverb;
+
+public:
+	enum {
+		BLOCK_SIZE = 256,
+		FFT_SIZE = BLOCK_SIZE * 2,
+		BINS = BLOCK_SIZE + 1,
+		BINS_PADDED = (BINS + 3) & ~3,
+		// A spectrum holds the real and imaginary parts of both channels.
+		SPECTRUM_SIZE = BINS_PADDED * 4,
+		// Partitions convolved on the mix thread, the rest of the impulse response
+		// (the tail) is convolved ahead of time on a worker thread.
+		HEAD_PARTITIONS = 4,
+		TAIL_SLOTS = HEAD_PARTITIONS + 1,
+	};
+
+	// Uniformly partitioned convolution with overlap-save. Both channels share one
+	// complex FFT, with the left channel in the real part and the right channel in
+	// the imaginary part.
+	static void fft(float *p_re, float *p_im, bool p_inverse);
+	static void split_spectrum(const float *p_re, const float *p_im, float *r_spectrum);
+	static void merge_spectrum(const float *p_spectrum, float *r_re, float *r_im);
+	static void multiply_accumulate(float *r_acc, const float *p_a, const float *p_b);
+
+private:
+	Ref<AudioEffectConvolutionReverb> base;
+
+	Vector<float> ir_spectra;
+	int ir_partitions = 0;
+	uint32_t ir_version = 0;
+
+	float input[2][FFT_SIZE];
+	float output[2][BLOCK_SIZE];
+	int fifo_pos = 0;
+
+	float fft_re[FFT_SIZE];
+	float fft_im[FFT_SIZE];
+	alignas(16) float accum[SPECTRUM_SIZE];
+
+	// Frequency domain delay line, one spectrum per past input block.
+	LocalVector<float> fdl;
+	uint64_t block_index = 0;
+
+	alignas(16) float tails[TAIL_SLOTS][SPECTRUM_SIZE];
+	uint64_t next_tail_block = 0;
+
+	enum {
+		TAIL_PENDING,
+		TAIL_RUNNING,
+		TAIL_CANCELLED,
+	};
+
+	// Generation of the tail task in the upper bits, its state in the lower two.
+	std::atomic<uint32_t> tail_state = { 0 };
+	uint32_t tail_generation = 0;
+	uint64_t tail_target = 0;
+	WorkerThreadPool::TaskID tail_task = WorkerThreadPool::INVALID_TASK_ID;
+	LocalVector<WorkerThreadPool::TaskID> cancelled_tail_tasks;
+
+	void _reset();
+	void _compute_tails(uint64_t p_last_block);
+	void _tail_task(uint32_t p_generation);
+	void _sync_tail_task();
+	void _process_block();
+
+public:
+	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
+
+	~AudioEffectConvolutionReverbInstance();
+};
+
+class AudioEffectConvolutionReverb : public AudioEffect {
+	GDCLASS(AudioEffectConvolutionReverb, AudioEffect);
+
+	friend class AudioEffectConvolutionReverbInstance;
+
+	Ref<AudioStream> impulse_response;
+	float dry = 1.0;
+	float wet = 0.5;
+
+	Vector<float> ir_spectra;
+	int ir_partitions = 0;
+	uint32_t ir_version = 0;
+
+	void _update_impulse_response();
+
+protected:
+	static void _bind_methods();
+
+public:
+	enum {
+		MAX_IMPULSE_RESPONSE_SECONDS = 20,
+	};
+
+	void set_impulse_response(const Ref<AudioStream> &p_stream);
+	Ref<AudioStream> get_impulse_response() const;
+
+	void set_dry(float p_dry);
+	float get_dry() const;
+
+	void set_wet(float p_wet);
+	float get_wet() const;
+
+	Ref<AudioEffectInstance> instantiate() override;
+};
+
+#endif // AUDIO_EFFECT_CONVOLUTION_REVERB_H
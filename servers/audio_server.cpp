@@ -32,20 +32,127 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_trace.h"
 #include "core/error/error_macros.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_SERVER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define AUDIO_SERVER_NEON
+#endif
+
+// Mixing kernels. AudioFrame is a pair of floats, so a 128-bit register holds two frames.
+
+// p_out += p_source * volume, with the volume ramping linearly from p_vol_start on the first frame towards p_vol_final.
+static void mix_frames_with_ramp(AudioFrame *p_out, const AudioFrame *p_source, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final, uint32_t p_frames) {
+	const AudioFrame vol_delta = p_vol_final - p_vol_start;
+	const float inv_frames = 1.0f / p_frames;
+	uint32_t frame_idx = 0;
+
+#if defined(AUDIO_SERVER_SSE2)
+	const __m128 start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m128 delta = _mm_setr_ps(vol_delta.left, vol_delta.right, vol_delta.left, vol_delta.right);
+	const __m128 inv = _mm_set1_ps(inv_frames);
+	const __m128 two = _mm_set1_ps(2.0f);
+	__m128 index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		const __m128 vol = _mm_add_ps(start, _mm_mul_ps(delta, _mm_mul_ps(index, inv)));
+		const __m128 mixed = _mm_mul_ps(vol, _mm_loadu_ps(&p_source[frame_idx].left));
+		_mm_storeu_ps(&p_out[frame_idx].left, _mm_add_ps(_mm_loadu_ps(&p_out[frame_idx].left), mixed));
+		index = _mm_add_ps(index, two);
+	}
+#elif defined(AUDIO_SERVER_NEON)
+	const float32x4_t start = { p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right };
+	const float32x4_t delta = { vol_delta.left, vol_delta.right, vol_delta.left, vol_delta.right };
+	const float32x4_t two = vdupq_n_f32(2.0f);
+	float32x4_t index = { 0.0f, 0.0f, 1.0f, 1.0f };
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		const float32x4_t vol = vmlaq_f32(start, delta, vmulq_n_f32(index, inv_frames));
+		const float32x4_t mixed = vmulq_f32(vol, vld1q_f32(&p_source[frame_idx].left));
+		vst1q_f32(&p_out[frame_idx].left, vaddq_f32(vld1q_f32(&p_out[frame_idx].left), mixed));
+		index = vaddq_f32(index, two);
+	}
+#endif
+
+	for (; frame_idx < p_frames; frame_idx++) {
+		const float lerp_param = frame_idx * inv_frames;
+		p_out[frame_idx] += (p_vol_start + vol_delta * lerp_param) * p_source[frame_idx];
+	}
+}
+
+// p_buffer *= p_volume, returns the peak of the scaled frames.
+static AudioFrame scale_frames_and_get_peak(AudioFrame *p_buffer, float p_volume, uint32_t p_frames) {
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t frame_idx = 0;
+
+#if defined(AUDIO_SERVER_SSE2)
+	const __m128 volume = _mm_set1_ps(p_volume);
+	const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 peak4 = _mm_setzero_ps();
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(&p_buffer[frame_idx].left), volume);
+		_mm_storeu_ps(&p_buffer[frame_idx].left, scaled);
+		peak4 = _mm_max_ps(peak4, _mm_and_ps(scaled, abs_mask));
+	}
+	float lanes[4];
+	_mm_storeu_ps(lanes, peak4);
+	peak = AudioFrame(MAX(lanes[0], lanes[2]), MAX(lanes[1], lanes[3]));
+#elif defined(AUDIO_SERVER_NEON)
+	float32x4_t peak4 = vdupq_n_f32(0.0f);
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		const float32x4_t scaled = vmulq_n_f32(vld1q_f32(&p_buffer[frame_idx].left), p_volume);
+		vst1q_f32(&p_buffer[frame_idx].left, scaled);
+		peak4 = vmaxq_f32(peak4, vabsq_f32(scaled));
+	}
+	float lanes[4];
+	vst1q_f32(lanes, peak4);
+	peak = AudioFrame(MAX(lanes[0], lanes[2]), MAX(lanes[1], lanes[3]));
+#endif
+
+	for (; frame_idx < p_frames; frame_idx++) {
+		p_buffer[frame_idx] *= p_volume;
+		peak.left = MAX(peak.left, ABS(p_buffer[frame_idx].left));
+		peak.right = MAX(peak.right, ABS(p_buffer[frame_idx].right));
+	}
+
+	return peak;
+}
+
+// p_out += p_source.
+static void add_frames(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+	uint32_t frame_idx = 0;
+
+#if defined(AUDIO_SERVER_SSE2)
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		_mm_storeu_ps(&p_out[frame_idx].left, _mm_add_ps(_mm_loadu_ps(&p_out[frame_idx].left), _mm_loadu_ps(&p_source[frame_idx].left)));
+	}
+#elif defined(AUDIO_SERVER_NEON)
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		vst1q_f32(&p_out[frame_idx].left, vaddq_f32(vld1q_f32(&p_out[frame_idx].left), vld1q_f32(&p_source[frame_idx].left)));
+	}
+#endif
+
+	for (; frame_idx < p_frames; frame_idx++) {
+		p_out[frame_idx] += p_source[frame_idx];
+	}
+}
+
 #ifdef TOOLS_ENABLED
 #define MARK_EDITED set_edited(true);
 #else
@@ -259,6 +366,9 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_AUDIO);
+	TRACE_ZONE("AudioServer::mix");
+	mix_thread_id.set(Thread::get_caller_id());
 	mix_count++;
 	int todo = p_frames;
 
@@ -375,6 +485,8 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	_update_voices();
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -385,6 +497,10 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		if (_update_virtual_voice(playback)) {
+			continue;
+		}
+
 		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
@@ -446,7 +562,7 @@ void AudioServer::_mix_step() {
 
 			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
 				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				if (fading_out) {
+				if (fading_out || playback->voice_culled) {
 					bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
 				}
 				AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
@@ -517,131 +633,309 @@ void AudioServer::_mix_step() {
 		}
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	mix_solo_mode = solo_mode;
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	// Buses only send to buses with a lower index, so they can be sorted in levels where every bus comes after
+	// all the buses sending to it. The effects of the buses in a same level don't depend on each other.
+	const int bus_count = buses.size();
+	bus_levels.resize(bus_count);
+	for (int i = 0; i < bus_count; i++) {
+		bus_levels[i] = 0;
+	}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+	int max_level = 0;
+	bool use_parallel_effects = parallel_bus_effects && bus_count > 2 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_thread_index() == -1;
+	for (int i = bus_count - 1; i >= 0; i--) {
+		Bus *bus = buses[i];
+		if (i > 0) {
+			Bus *send = bus_map.has(bus->send) ? bus_map[bus->send] : buses[0];
+			if (send->index_cache >= bus->index_cache) {
+				send = buses[0];
 			}
+			bus_levels[send->index_cache] = MAX(bus_levels[send->index_cache], bus_levels[i] + 1);
+			max_level = MAX(max_level, bus_levels[send->index_cache]);
 		}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
+		if (use_parallel_effects) {
+			// A compressor sidechain reads another bus while processing, keep the serial order.
+			for (const Ref<AudioEffectInstance> &effect_instance : bus->channels[0].effect_instances) {
+				const AudioEffectCompressorInstance *compressor = Object::cast_to<AudioEffectCompressorInstance>(*effect_instance);
+				if (compressor && compressor->has_sidechain()) {
+					use_parallel_effects = false;
+					break;
 				}
+			}
+		}
+	}
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	if (!use_parallel_effects) {
+		for (int i = bus_count - 1; i >= 0; i--) {
+			_process_bus(i, temp_buffer.ptrw());
+			_send_bus(i);
+		}
+	} else {
+		bus_temp_buffers.resize(bus_count);
+		for (int level = 0; level <= max_level; level++) {
+			level_buses.clear();
+			for (int i = bus_count - 1; i >= 0; i--) {
+				if (bus_levels[i] == level) {
+					level_buses.push_back(i);
+				}
+			}
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			uint32_t buses_with_effects = 0;
+			for (int bus_idx : level_buses) {
+				const Bus *bus = buses[bus_idx];
+				if (!bus->bypass && bus->effects.size() > 0) {
+					buses_with_effects++;
 				}
+			}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+			if (buses_with_effects > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AudioServer::_process_bus_task, (const int *)level_buses.ptr(), level_buses.size(), -1, true, SNAME("AudioBusEffects"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				for (int bus_idx : level_buses) {
+					_process_bus(bus_idx, temp_buffer.ptrw());
 				}
+			}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+			// Sends are accumulated serially, in the same order as without levels.
+			for (int bus_idx : level_buses) {
+				_send_bus(bus_idx);
 			}
 		}
+	}
 
-		//process send
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-		Bus *send = nullptr;
+// Loudest linear volume a playback is mixed with, on any bus and channel.
+float AudioServer::_get_playback_loudness(const AudioStreamPlaybackBusDetails &p_bus_details, int p_channel_count) {
+	float loudness = 0.0f;
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!p_bus_details.bus_active[idx]) {
+			continue;
+		}
+		for (int channel_idx = 0; channel_idx < p_channel_count; channel_idx++) {
+			const AudioFrame &volume = p_bus_details.volume[idx][channel_idx];
+			loudness = MAX(loudness, MAX(ABS(volume.left), ABS(volume.right)));
+		}
+	}
+	return loudness;
+}
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+void AudioServer::_update_voices() {
+	voice_candidates.clear();
+
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->voice_culled = false;
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING || playback->stream_playback->get_is_sample()) {
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
-			}
+		const AudioStreamPlaybackBusDetails *bus_details = playback->bus_details.load();
+		if (!bus_details) {
+			continue;
+		}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		playback->loudness = _get_playback_loudness(*bus_details, channel_count);
+		playback->prev_loudness = _get_playback_loudness(*playback->prev_bus_details, channel_count);
+
+		if (max_voices > 0 && playback->stream_length.get() > 0 && playback->loudness >= voice_virtual_threshold) {
+			VoiceCandidate candidate;
+			candidate.playback = playback;
+			candidate.priority = playback->voice_priority.get();
+			candidate.loudness = playback->loudness;
+			voice_candidates.push_back(candidate);
+		}
+	}
+
+	if (max_voices > 0 && voice_candidates.size() > (uint32_t)max_voices) {
+		// Keep the voices with the highest priority, then the loudest ones. The others fade out and become virtual.
+		voice_candidates.sort();
+		for (uint32_t i = max_voices; i < voice_candidates.size(); i++) {
+			voice_candidates[i].playback->voice_culled = true;
+		}
+	}
+}
 
-			AudioFrame peak = AudioFrame(0, 0);
+bool AudioServer::_update_virtual_voice(AudioStreamPlaybackListNode *p_playback) {
+	const float stream_length = p_playback->stream_length.get();
+	if (stream_length <= 0) {
+		return false;
+	}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	const bool loops = p_playback->stream_loops.is_set();
+	const float mix_time_step = buffer_size / get_mix_rate();
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
+	if (p_playback->state.load() == AudioStreamPlaybackListNode::PLAYING) {
+		// Only become virtual once the volume ramp reached silence, so there is no pop.
+		const bool inaudible = p_playback->voice_culled || p_playback->loudness < voice_virtual_threshold;
+		if (inaudible && p_playback->prev_loudness < voice_virtual_threshold) {
+			if (!p_playback->is_virtual) {
+				p_playback->is_virtual = true;
+				virtual_voice_count.increment();
+
+				for (AudioFrame &frame : p_playback->lookahead) {
+					frame = AudioFrame(0, 0);
 				}
+				// Fade in from silence when it becomes audible again.
+				memset(p_playback->prev_bus_details->volume, 0, sizeof(p_playback->prev_bus_details->volume));
+			}
+
+			const float virtual_time = p_playback->virtual_time.get() + mix_time_step * p_playback->pitch_scale.get() * playback_speed_scale;
+			p_playback->virtual_time.set(virtual_time);
+
+			// Streams that don't loop are woken up right before their end, so they finish (or loop, for formats
+			// that loop without reporting it) on their own.
+			if (loops || p_playback->stream_playback->get_playback_position() + virtual_time < stream_length - mix_time_step) {
+				return true;
 			}
+		}
+	}
 
-			//apply volume and compute peak
+	if (p_playback->is_virtual) {
+		p_playback->is_virtual = false;
+		virtual_voice_count.decrement();
+
+		double position = p_playback->stream_playback->get_playback_position() + p_playback->virtual_time.get();
+		if (loops) {
+			position = Math::fmod(position, (double)stream_length);
+		} else {
+			position = MAX(0.0, MIN(position, (double)stream_length - mix_time_step));
+		}
+		p_playback->virtual_time.set(0);
+		p_playback->stream_playback->seek(position);
+	}
+
+	return false;
+}
+
+void AudioServer::_process_bus(int p_bus, Vector<AudioFrame> *p_temp_buffers) {
+	Bus *bus = buses[p_bus];
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
+
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
+
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 
-				float l = ABS(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-				float r = ABS(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), p_temp_buffers[k].ptrw(), buffer_size);
+			}
+
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, p_temp_buffers[k]);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
+
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		float volume = Math::db_to_linear(bus->volume_db);
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		if (mix_solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//apply volume and compute peak
+		const AudioFrame peak = scale_frames_and_get_peak(buf, volume, buffer_size);
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false;
 			}
 		}
 	}
+}
+
+void AudioServer::_process_bus_task(uint32_t p_index, const int *p_buses) {
+	const int bus_idx = p_buses[p_index];
+
+	// Each bus needs its own scratch buffers when processed in parallel.
+	Vector<Vector<AudioFrame>> &temp_buffers = bus_temp_buffers[bus_idx];
+	if (temp_buffers.size() != channel_count) {
+		temp_buffers.resize(channel_count);
+	}
+	for (int k = 0; k < channel_count; k++) {
+		if (temp_buffers[k].size() != (int)buffer_size) {
+			temp_buffers.write[k].resize(buffer_size);
+		}
+	}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+	_process_bus(bus_idx, temp_buffers.ptrw());
+}
+
+void AudioServer::_send_bus(int p_bus) {
+	if (p_bus == 0) {
+		return; //everything has a send save for master bus
+	}
+
+	Bus *bus = buses[p_bus];
+	Bus *send = nullptr;
+	if (!bus_map.has(bus->send)) {
+		send = buses[0];
+	} else {
+		send = bus_map[bus->send];
+		if (send->index_cache >= bus->index_cache) { //invalid, send to master
+			send = buses[0];
+		}
+	}
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			continue;
+		}
+
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		add_frames(target_buf, bus->channels[k].buffer.ptr(), buffer_size);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -674,11 +968,8 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		mix_frames_with_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -1361,6 +1652,23 @@ void AudioServer::set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playb
 	playback_node->highshelf_gain.set(p_gain);
 }
 
+void AudioServer::set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, float p_stream_length, bool p_stream_loops) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	if (p_playback->get_is_sample()) {
+		return;
+	}
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->voice_priority.set(p_priority);
+	playback_node->stream_loops.set_to(p_stream_loops);
+	playback_node->stream_length.set(MAX(0.0f, p_stream_length));
+}
+
 bool AudioServer::is_playback_active(Ref<AudioStreamPlayback> p_playback) {
 	ERR_FAIL_COND_V(p_playback.is_null(), false);
 
@@ -1384,7 +1692,12 @@ float AudioServer::get_playback_position(Ref<AudioStreamPlayback> p_playback) {
 		return 0;
 	}
 
-	return playback_node->stream_playback->get_playback_position();
+	double position = playback_node->stream_playback->get_playback_position() + playback_node->virtual_time.get();
+	const float stream_length = playback_node->stream_length.get();
+	if (playback_node->stream_loops.is_set() && stream_length > 0) {
+		position = Math::fmod(position, (double)stream_length);
+	}
+	return position;
 }
 
 bool AudioServer::is_playback_paused(Ref<AudioStreamPlayback> p_playback) {
@@ -1398,6 +1711,41 @@ bool AudioServer::is_playback_paused(Ref<AudioStreamPlayback> p_playback) {
 	return playback_node->state.load() == AudioStreamPlaybackListNode::PAUSED || playback_node->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 }
 
+int AudioServer::get_virtual_voice_count() const {
+	return virtual_voice_count.get();
+}
+
+void AudioServer::request_stream_decode(AudioStreamPlaybackResampled *p_playback) {
+	ERR_FAIL_NULL(p_playback);
+	{
+		MutexLock lock(stream_decode_mutex);
+		stream_decode_queue.push_back(Ref<AudioStreamPlaybackResampled>(p_playback));
+	}
+	stream_decode_semaphore.post();
+}
+
+void AudioServer::_stream_decode_thread_func(void *p_userdata) {
+	AudioServer *as = static_cast<AudioServer *>(p_userdata);
+	LocalVector<Ref<AudioStreamPlaybackResampled>> playbacks;
+
+	while (true) {
+		as->stream_decode_semaphore.wait();
+		if (as->stream_decode_exit.is_set()) {
+			break;
+		}
+
+		{
+			MutexLock lock(as->stream_decode_mutex);
+			SWAP(playbacks, as->stream_decode_queue);
+		}
+
+		for (const Ref<AudioStreamPlaybackResampled> &playback : playbacks) {
+			playback->_decode_ahead();
+		}
+		playbacks.clear();
+	}
+}
+
 uint64_t AudioServer::get_mix_count() const {
 	return mix_count;
 }
@@ -1433,8 +1781,23 @@ void AudioServer::init_channels_and_buffers() {
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
+	parallel_bus_effects = GLOBAL_DEF_RST("audio/buses/parallel_effects", true);
+
+	max_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/voices/max_voices", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
+	voice_virtual_threshold = Math::db_to_linear(float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/voices/virtual_threshold_db", PROPERTY_HINT_RANGE, "-120,0,0.1,suffix:dB"), -60.0)));
 	buffer_size = 512; //hardcoded for now
 
+	resampling_quality = ResamplingQuality(int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/resampling_quality", PROPERTY_HINT_ENUM, "Fast,Medium,High"), RESAMPLING_QUALITY_MEDIUM)));
+	stream_background_decode = GLOBAL_DEF_RST("audio/general/stream_background_decode", true) && OS::get_singleton()->get_processor_count() > 1;
+#ifndef THREADS_ENABLED
+	stream_background_decode = false;
+#endif
+	stream_prebuffer_time = GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/general/stream_prebuffer_time", PROPERTY_HINT_RANGE, "0.02,1,0.01,or_greater,suffix:s"), 0.1);
+	if (stream_background_decode) {
+		stream_decode_exit.clear();
+		stream_decode_thread.start(_stream_decode_thread_func, this);
+	}
+
 	init_channels_and_buffers();
 
 	mix_count = 0;
@@ -1551,6 +1914,13 @@ void AudioServer::load_default_bus_layout() {
 }
 
 void AudioServer::finish() {
+	if (stream_decode_thread.is_started()) {
+		stream_decode_exit.set();
+		stream_decode_semaphore.post();
+		stream_decode_thread.wait_to_finish();
+	}
+	stream_decode_queue.clear();
+
 	for (int i = 0; i < AudioDriverManager::get_driver_count(); i++) {
 		AudioDriverManager::get_driver(i)->finish();
 	}
@@ -1898,6 +2268,8 @@ void AudioServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_playback_speed_scale", "scale"), &AudioServer::set_playback_speed_scale);
 	ClassDB::bind_method(D_METHOD("get_playback_speed_scale"), &AudioServer::get_playback_speed_scale);
 
+	ClassDB::bind_method(D_METHOD("get_virtual_voice_count"), &AudioServer::get_virtual_voice_count);
+
 	ClassDB::bind_method(D_METHOD("lock"), &AudioServer::lock);
 	ClassDB::bind_method(D_METHOD("unlock"), &AudioServer::unlock);
 
@@ -34,6 +34,9 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -46,6 +49,7 @@ class AudioSample;
 class AudioStream;
 class AudioStreamWAV;
 class AudioStreamPlayback;
+class AudioStreamPlaybackResampled;
 class AudioSamplePlayback;
 
 class AudioDriver {
@@ -206,6 +210,12 @@ public:
 
 	typedef void (*AudioCallback)(void *p_userdata);
 
+	enum ResamplingQuality {
+		RESAMPLING_QUALITY_FAST, // Cubic interpolation, linear for AudioRBResampler.
+		RESAMPLING_QUALITY_MEDIUM, // 8 tap windowed sinc.
+		RESAMPLING_QUALITY_HIGH, // 16 tap windowed sinc.
+	};
+
 private:
 	uint64_t mix_time = 0;
 	int mix_size = 0;
@@ -213,12 +223,30 @@ private:
 	uint32_t buffer_size = 0;
 	uint64_t mix_count = 0;
 	uint64_t mix_frames = 0;
+	SafeNumeric<Thread::ID> mix_thread_id; // The thread the driver mixes on, it must never wait for stream decoding.
 #ifdef DEBUG_ENABLED
 	SafeNumeric<uint64_t> prof_time;
 #endif
 
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
+	bool parallel_bus_effects = true;
+
+	int max_voices = 0;
+	float voice_virtual_threshold = 0.0f;
+
+	ResamplingQuality resampling_quality = RESAMPLING_QUALITY_MEDIUM;
+
+	// Compressed streams are decoded ahead of the mix on this thread, see AudioStreamPlaybackResampled.
+	bool stream_background_decode = false;
+	float stream_prebuffer_time = 0.1f;
+	Thread stream_decode_thread;
+	Semaphore stream_decode_semaphore;
+	Mutex stream_decode_mutex;
+	LocalVector<Ref<AudioStreamPlaybackResampled>> stream_decode_queue;
+	SafeFlag stream_decode_exit;
+
+	static void _stream_decode_thread_func(void *p_userdata);
 
 	int channel_count = 0;
 	int to_mix = 0;
@@ -292,6 +320,31 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+
+		// Voice virtualization. A virtual playback is not mixed, only the time it skipped is kept, and it seeks
+		// forward when it becomes audible again. Playbacks with an unknown stream length are never virtualized.
+		SafeNumeric<int> voice_priority;
+		SafeNumeric<float> stream_length;
+		SafeFlag stream_loops;
+		SafeNumeric<float> virtual_time;
+		// These are only accessed on the audio thread.
+		bool is_virtual = false;
+		bool voice_culled = false;
+		float loudness = 0.0f;
+		float prev_loudness = 0.0f;
+	};
+
+	struct VoiceCandidate {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		int priority = 0;
+		float loudness = 0.0f;
+
+		_FORCE_INLINE_ bool operator<(const VoiceCandidate &p_other) const {
+			if (priority != p_other.priority) {
+				return priority > p_other.priority;
+			}
+			return loudness > p_other.loudness;
+		}
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -305,6 +358,15 @@ private:
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
+	// Used to process the effects of independent buses in parallel.
+	bool mix_solo_mode = false;
+	LocalVector<int> bus_levels;
+	LocalVector<int> level_buses;
+	LocalVector<Vector<Vector<AudioFrame>>> bus_temp_buffers;
+
+	LocalVector<VoiceCandidate> voice_candidates;
+	SafeNumeric<uint32_t> virtual_voice_count;
+
 	void _update_bus_effects(int p_bus);
 
 	static AudioServer *singleton;
@@ -312,6 +374,12 @@ private:
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _process_bus(int p_bus, Vector<AudioFrame> *p_temp_buffers);
+	void _process_bus_task(uint32_t p_index, const int *p_buses);
+	void _send_bus(int p_bus);
+	static float _get_playback_loudness(const AudioStreamPlaybackBusDetails &p_bus_details, int p_channel_count);
+	void _update_voices();
+	bool _update_virtual_voice(AudioStreamPlaybackListNode *p_playback);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -416,11 +484,22 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	// The stream length is used to keep track of the position while the playback is virtual, zero if unknown.
+	void set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, float p_stream_length, bool p_stream_loops);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
 	bool is_playback_paused(Ref<AudioStreamPlayback> p_playback);
 
+	int get_virtual_voice_count() const;
+
+	ResamplingQuality get_resampling_quality() const { return resampling_quality; }
+	bool is_stream_background_decode_enabled() const { return stream_background_decode; }
+	float get_stream_prebuffer_time() const { return stream_prebuffer_time; }
+	// Can be called from the mix thread, the decoding happens on the decode thread.
+	void request_stream_decode(AudioStreamPlaybackResampled *p_playback);
+	bool is_mix_thread() const { return mix_thread_id.get() == Thread::get_caller_id(); }
+
 	uint64_t get_mix_count() const;
 	uint64_t get_mixed_frames() const;
 
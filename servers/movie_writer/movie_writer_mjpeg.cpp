@@ -190,32 +190,58 @@ Error MovieWriterMJPEG::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 	return OK;
 }
 
-Error MovieWriterMJPEG::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
-	ERR_FAIL_COND_V(!f.is_valid(), ERR_UNCONFIGURED);
+void MovieWriterMJPEG::_encode_frame(PendingFrame *p_frame) {
+	p_frame->jpg_buffer = p_frame->image->save_jpg_to_buffer(quality);
+	p_frame->image.unref();
+}
+
+void MovieWriterMJPEG::_write_pending_frames(bool p_wait_all) {
+	while (!pending_frames.is_empty()) {
+		PendingFrame &frame = pending_frames.front()->get();
+		if (!p_wait_all && pending_frames.size() < MAX_PENDING_FRAMES && !WorkerThreadPool::get_singleton()->is_task_completed(frame.task_id)) {
+			break;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(frame.task_id);
 
-	Vector<uint8_t> jpg_buffer = p_image->save_jpg_to_buffer(quality);
-	uint32_t s = jpg_buffer.size();
+		uint32_t s = frame.jpg_buffer.size();
+
+		f->store_buffer((const uint8_t *)"00db", 4); // Stream 0, Video
+		f->store_32(frame.jpg_buffer.size()); // sizes
+		f->store_buffer(frame.jpg_buffer.ptr(), frame.jpg_buffer.size());
+		if (frame.jpg_buffer.size() & 1) {
+			f->store_8(0);
+			s++;
+		}
+		jpg_frame_sizes.push_back(s);
 
-	f->store_buffer((const uint8_t *)"00db", 4); // Stream 0, Video
-	f->store_32(jpg_buffer.size()); // sizes
-	f->store_buffer(jpg_buffer.ptr(), jpg_buffer.size());
-	if (jpg_buffer.size() & 1) {
-		f->store_8(0);
-		s++;
+		f->store_buffer((const uint8_t *)"01wb", 4); // Stream 1, Audio.
+		f->store_32(audio_block_size);
+		f->store_buffer(frame.audio_data.ptr(), audio_block_size);
+
+		frame_count++;
+
+		pending_frames.pop_front();
 	}
-	jpg_frame_sizes.push_back(s);
+}
 
-	f->store_buffer((const uint8_t *)"01wb", 4); // Stream 1, Audio.
-	f->store_32(audio_block_size);
-	f->store_buffer((const uint8_t *)p_audio_data, audio_block_size);
+Error MovieWriterMJPEG::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
+	ERR_FAIL_COND_V(!f.is_valid(), ERR_UNCONFIGURED);
+
+	PendingFrame &frame = pending_frames.push_back(PendingFrame())->get();
+	frame.image = p_image;
+	frame.audio_data.resize(audio_block_size);
+	memcpy(frame.audio_data.ptrw(), p_audio_data, audio_block_size);
+	frame.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriterMJPEG::_encode_frame, &frame, true, SNAME("MovieWriterMJPEGEncode"));
 
-	frame_count++;
+	_write_pending_frames(false);
 
 	return OK;
 }
 
 void MovieWriterMJPEG::write_end() {
 	if (f.is_valid()) {
+		_write_pending_frames(true);
+
 		// Finalize the file (frame indices)
 		f->store_buffer((const uint8_t *)"idx1", 4);
 		f->store_32(8 * 4 * frame_count);
@@ -31,11 +31,25 @@
 #ifndef MOVIE_WRITER_MJPEG_H
 #define MOVIE_WRITER_MJPEG_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/list.h"
 #include "servers/movie_writer/movie_writer.h"
 
 class MovieWriterMJPEG : public MovieWriter {
 	GDCLASS(MovieWriterMJPEG, MovieWriter)
 
+	enum {
+		MAX_PENDING_FRAMES = 8
+	};
+
+	// Frames are compressed on the WorkerThreadPool and written to the file in order once done.
+	struct PendingFrame {
+		Ref<Image> image;
+		Vector<uint8_t> jpg_buffer;
+		Vector<uint8_t> audio_data;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
 	uint32_t mix_rate = 48000;
 	AudioServer::SpeakerMode speaker_mode = AudioServer::SPEAKER_MODE_STEREO;
 	String base_path;
@@ -55,6 +69,11 @@ class MovieWriterMJPEG : public MovieWriter {
 
 	Ref<FileAccess> f;
 
+	List<PendingFrame> pending_frames;
+
+	void _encode_frame(PendingFrame *p_frame);
+	void _write_pending_frames(bool p_wait_all);
+
 protected:
 	virtual uint32_t get_audio_mix_rate() const override;
 	virtual AudioServer::SpeakerMode get_audio_speaker_mode() const override;
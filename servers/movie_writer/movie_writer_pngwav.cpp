@@ -139,22 +139,47 @@ Error MovieWriterPNGWAV::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 	return OK;
 }
 
+void MovieWriterPNGWAV::_encode_frame(PendingFrame *p_frame) {
+	p_frame->png_buffer = p_frame->image->save_png_to_buffer();
+	p_frame->image.unref();
+}
+
+void MovieWriterPNGWAV::_write_pending_frames(bool p_wait_all) {
+	while (!pending_frames.is_empty()) {
+		PendingFrame &frame = pending_frames.front()->get();
+		if (!p_wait_all && pending_frames.size() < MAX_PENDING_FRAMES && !WorkerThreadPool::get_singleton()->is_task_completed(frame.task_id)) {
+			break;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(frame.task_id);
+
+		Ref<FileAccess> fi = FileAccess::open(base_path + zeros_str(frame_count) + ".png", FileAccess::WRITE);
+		fi->store_buffer(frame.png_buffer.ptr(), frame.png_buffer.size());
+		f_wav->store_buffer(frame.audio_data.ptr(), audio_block_size);
+
+		frame_count++;
+
+		pending_frames.pop_front();
+	}
+}
+
 Error MovieWriterPNGWAV::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
 	ERR_FAIL_COND_V(!f_wav.is_valid(), ERR_UNCONFIGURED);
 
-	Vector<uint8_t> png_buffer = p_image->save_png_to_buffer();
-
-	Ref<FileAccess> fi = FileAccess::open(base_path + zeros_str(frame_count) + ".png", FileAccess::WRITE);
-	fi->store_buffer(png_buffer.ptr(), png_buffer.size());
-	f_wav->store_buffer((const uint8_t *)p_audio_data, audio_block_size);
+	PendingFrame &frame = pending_frames.push_back(PendingFrame())->get();
+	frame.image = p_image;
+	frame.audio_data.resize(audio_block_size);
+	memcpy(frame.audio_data.ptrw(), p_audio_data, audio_block_size);
+	frame.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriterPNGWAV::_encode_frame, &frame, true, SNAME("MovieWriterPNGEncode"));
 
-	frame_count++;
+	_write_pending_frames(false);
 
 	return OK;
 }
 
 void MovieWriterPNGWAV::write_end() {
 	if (f_wav.is_valid()) {
+		_write_pending_frames(true);
+
 		uint32_t total_size = 4 /* WAVE */ + 8 /* fmt+size */ + 16 /* format */ + 8 /* data+size */;
 		uint32_t datasize = f_wav->get_position() - wav_data_size_pos;
 		f_wav->seek(4);
@@ -31,13 +31,24 @@
 #ifndef MOVIE_WRITER_PNGWAV_H
 #define MOVIE_WRITER_PNGWAV_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/list.h"
 #include "servers/movie_writer/movie_writer.h"
 
 class MovieWriterPNGWAV : public MovieWriter {
 	GDCLASS(MovieWriterPNGWAV, MovieWriter)
 
 	enum {
-		MAX_TRAILING_ZEROS = 8 // more than 10 days at 60fps, no hard drive can put up with this anyway :)
+		MAX_TRAILING_ZEROS = 8, // more than 10 days at 60fps, no hard drive can put up with this anyway :)
+		MAX_PENDING_FRAMES = 8,
+	};
+
+	// Frames are compressed on the WorkerThreadPool and written in order once done.
+	struct PendingFrame {
+		Ref<Image> image;
+		Vector<uint8_t> png_buffer;
+		Vector<uint8_t> audio_data;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
 	};
 
 	uint32_t mix_rate = 48000;
@@ -51,8 +62,13 @@ class MovieWriterPNGWAV : public MovieWriter {
 	Ref<FileAccess> f_wav;
 	uint32_t wav_data_size_pos = 0;
 
+	List<PendingFrame> pending_frames;
+
 	String zeros_str(uint32_t p_index);
 
+	void _encode_frame(PendingFrame *p_frame);
+	void _write_pending_frames(bool p_wait_all);
+
 protected:
 	virtual uint32_t get_audio_mix_rate() const override;
 	virtual AudioServer::SpeakerMode get_audio_speaker_mode() const override;
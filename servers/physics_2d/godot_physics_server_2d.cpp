@@ -36,6 +36,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_trace.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -1288,6 +1289,8 @@ void GodotPhysicsServer2D::init() {
 }
 
 void GodotPhysicsServer2D::step(real_t p_step) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
+	TRACE_ZONE("PhysicsServer2D::step");
 	if (!active) {
 		return;
 	}
@@ -1310,6 +1313,7 @@ void GodotPhysicsServer2D::sync() {
 }
 
 void GodotPhysicsServer2D::flush_queries() {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
 	if (!active) {
 		return;
 	}
@@ -60,19 +60,40 @@ void GodotBodyPair3D::contact_added_callback(const Vector3 &p_point_A, int p_ind
 	contact.used = true;
 
 	// Attempt to determine if the contact will be reused.
+	// Contacts from the previous step are matched one to one, with the closest one winning, so
+	// each keeps its own accumulated impulses to warm start the solver. Contacts added during
+	// this step are only matched to merge duplicates.
 	real_t contact_recycle_radius = space->get_contact_recycle_radius();
+	real_t contact_recycle_radius2 = contact_recycle_radius * contact_recycle_radius;
 
+	int recycled = -1;
+	int duplicate = -1;
+	real_t recycled_distance = 0.0;
 	for (int i = 0; i < contact_count; i++) {
-		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (contact_recycle_radius * contact_recycle_radius) &&
-				c.local_B.distance_squared_to(local_B) < (contact_recycle_radius * contact_recycle_radius)) {
-			contact.acc_normal_impulse = c.acc_normal_impulse;
-			contact.acc_bias_impulse = c.acc_bias_impulse;
-			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
-			c = contact;
-			return;
+		const Contact &c = contacts[i];
+		real_t distance_A = c.local_A.distance_squared_to(local_A);
+		real_t distance_B = c.local_B.distance_squared_to(local_B);
+		if (distance_A >= contact_recycle_radius2 || distance_B >= contact_recycle_radius2) {
+			continue;
 		}
+
+		if (c.used) {
+			duplicate = i;
+		} else if (recycled == -1 || distance_A + distance_B < recycled_distance) {
+			recycled = i;
+			recycled_distance = distance_A + distance_B;
+		}
+	}
+
+	int match = recycled != -1 ? recycled : duplicate;
+	if (match != -1) {
+		Contact &c = contacts[match];
+		contact.acc_normal_impulse = c.acc_normal_impulse;
+		contact.acc_bias_impulse = c.acc_bias_impulse;
+		contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		contact.acc_tangent_impulse = c.acc_tangent_impulse;
+		c = contact;
+		return;
 	}
 
 	// Figure out if the contact amount must be reduced to fit the new contact.
@@ -39,6 +39,7 @@
 #include "joints/godot_slider_joint_3d.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_trace.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -1629,6 +1630,8 @@ void GodotPhysicsServer3D::init() {
 }
 
 void GodotPhysicsServer3D::step(real_t p_step) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
+	TRACE_ZONE("PhysicsServer3D::step");
 #ifndef _3D_DISABLED
 
 	if (!active) {
@@ -1654,6 +1657,7 @@ void GodotPhysicsServer3D::sync() {
 }
 
 void GodotPhysicsServer3D::flush_queries() {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
 #ifndef _3D_DISABLED
 
 	if (!active) {
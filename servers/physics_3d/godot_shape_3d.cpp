@@ -33,7 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
-#include "core/templates/sort_array.h"
+#include "core/object/worker_thread_pool.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
 
@@ -254,21 +254,6 @@ real_t GodotSphereShape3D::get_radius() const {
 	return radius;
 }
 
-void GodotSphereShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	real_t d = p_normal.dot(p_transform.origin);
-
-	// figure out scale at point
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-	real_t scale = local_normal.length();
-
-	r_min = d - (radius)*scale;
-	r_max = d + (radius)*scale;
-}
-
-Vector3 GodotSphereShape3D::get_support(const Vector3 &p_normal) const {
-	return p_normal * radius;
-}
-
 void GodotSphereShape3D::get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const {
 	*r_supports = p_normal * radius;
 	r_amount = 1;
@@ -314,26 +299,6 @@ GodotSphereShape3D::GodotSphereShape3D() {}
 
 /********** BOX *************/
 
-void GodotBoxShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	// no matter the angle, the box is mirrored anyway
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-
-	real_t length = local_normal.abs().dot(half_extents);
-	real_t distance = p_normal.dot(p_transform.origin);
-
-	r_min = distance - length;
-	r_max = distance + length;
-}
-
-Vector3 GodotBoxShape3D::get_support(const Vector3 &p_normal) const {
-	Vector3 point(
-			(p_normal.x < 0) ? -half_extents.x : half_extents.x,
-			(p_normal.y < 0) ? -half_extents.y : half_extents.y,
-			(p_normal.z < 0) ? -half_extents.z : half_extents.z);
-
-	return point;
-}
-
 void GodotBoxShape3D::get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const {
 	static const int next[3] = { 1, 2, 0 };
 	static const int next2[3] = { 2, 0, 1 };
@@ -503,27 +468,6 @@ GodotBoxShape3D::GodotBoxShape3D() {}
 
 /********** CAPSULE *************/
 
-void GodotCapsuleShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
-	real_t h = height * 0.5 - radius;
-
-	n *= radius;
-	n.y += (n.y > 0) ? h : -h;
-
-	r_max = p_normal.dot(p_transform.xform(n));
-	r_min = p_normal.dot(p_transform.xform(-n));
-}
-
-Vector3 GodotCapsuleShape3D::get_support(const Vector3 &p_normal) const {
-	Vector3 n = p_normal;
-
-	real_t h = height * 0.5 - radius;
-
-	n *= radius;
-	n.y += (n.y > 0) ? h : -h;
-	return n;
-}
-
 void GodotCapsuleShape3D::get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const {
 	Vector3 n = p_normal;
 
@@ -1288,11 +1232,15 @@ Vector<Vector3> GodotConcavePolygonShape3D::get_faces() const {
 	Vector<Vector3> rfaces;
 	rfaces.resize(faces.size() * 3);
 
-	for (int i = 0; i < faces.size(); i++) {
-		Face f = faces.get(i);
+	Vector3 *rfacesw = rfaces.ptrw();
+	const Face *fr = faces.ptr();
+	const int *idr = face_ids.ptr();
+	const Vector3 *vr = vertices.ptr();
 
+	for (int i = 0; i < faces.size(); i++) {
+		// Restore the source order, faces are stored sorted by BVH leaf.
 		for (int j = 0; j < 3; j++) {
-			rfaces.set(i * 3 + j, vertices.get(f.indices[j]));
+			rfacesw[idr[i] * 3 + j] = vr[fr[i].indices[j]];
 		}
 	}
 
@@ -1348,38 +1296,39 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
+	if (!_get_bvh_aabb(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
 		return;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->data & BVH_LEAF_FLAG) {
+		int first = params_bvh->data & BVH_LEAF_FACE_MASK;
+		int last = first + ((params_bvh->data & ~BVH_LEAF_FLAG) >> BVH_LEAF_COUNT_SHIFT);
 		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->face_index = face_index;
-				p_params->collisions++;
+
+		for (int i = first; i <= last; i++) {
+			const Face *f = &p_params->faces[i];
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+
+			Vector3 res;
+			Vector3 normal;
+			int face_index = p_params->face_ids[i];
+			if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
+				real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+				if ((d > 0) && (d < p_params->min_d)) {
+					p_params->min_d = d;
+					p_params->result = res;
+					p_params->normal = normal;
+					p_params->face_index = face_index;
+					p_params->collisions++;
+				}
 			}
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
+		_cull_segment(p_idx + 1, p_params);
+		_cull_segment(params_bvh->data, p_params);
 	}
 }
 
@@ -1403,6 +1352,7 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 
 	params.faces = fr;
 	params.vertices = vr;
+	params.face_ids = face_ids.ptr();
 	params.bvh = br;
 
 	params.face = &face;
@@ -1431,31 +1381,32 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
+	if (!p_params->aabb.intersects(_get_bvh_aabb(*params_bvh))) {
 		return false;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->data & BVH_LEAF_FLAG) {
+		int first = params_bvh->data & BVH_LEAF_FACE_MASK;
+		int last = first + ((params_bvh->data & ~BVH_LEAF_FLAG) >> BVH_LEAF_COUNT_SHIFT);
 		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
+
+		for (int i = first; i <= last; i++) {
+			const Face *f = &p_params->faces[i];
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+			if (p_params->callback(p_params->userdata, face)) {
 				return true;
 			}
 		}
+	} else {
+		if (_cull(p_idx + 1, p_params)) {
+			return true;
+		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		if (_cull(params_bvh->data, p_params)) {
+			return true;
 		}
 	}
 
@@ -1508,161 +1459,294 @@ struct _Volume_BVH_Element {
 	int face_index = 0;
 };
 
-struct _Volume_BVH_CompareX {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.x < b.center.x;
-	}
+struct _Volume_BVH_Node {
+	AABB aabb;
+	int right = -1; // The left child of a branch is the next node.
+	int first_element = 0;
+	int element_count = 0; // Zero for branches.
+	int subtree = -1; // Placeholder for a subtree built on a worker thread.
 };
 
-struct _Volume_BVH_CompareY {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.y < b.center.y;
-	}
-};
+struct _Volume_BVH_Builder {
+	static const int MAX_LEAF_ELEMENTS = 4;
+	static const int SAH_BINS = 16;
+	// Large meshes build the subtrees below this depth in parallel.
+	static const int PARALLEL_DEPTH = 3;
+	static const int PARALLEL_MIN_ELEMENTS = 16384;
+
+	struct Subtree {
+		int begin = 0;
+		int end = 0;
+		LocalVector<_Volume_BVH_Node> nodes;
+	};
+
+	_Volume_BVH_Element *elements = nullptr;
+	LocalVector<Subtree> subtrees;
 
-struct _Volume_BVH_CompareZ {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.z < b.center.z;
+	static _FORCE_INLINE_ real_t _get_half_area(const AABB &p_aabb) {
+		const Vector3 &size = p_aabb.size;
+		return size.x * size.y + size.y * size.z + size.z * size.x;
 	}
-};
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
+	// Partitions the elements with a binned SAH split, returns -1 if a leaf is cheaper.
+	int _partition(int p_begin, int p_end, const AABB &p_aabb) {
+		int count = p_end - p_begin;
 
-	int face_index = 0;
-};
+		AABB centers(elements[p_begin].center, Vector3());
+		for (int i = p_begin + 1; i < p_end; i++) {
+			centers.expand_to(elements[i].center);
+		}
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
-	}
+		struct Bin {
+			AABB aabb;
+			int count = 0;
+		};
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
+		int best_axis = -1;
+		int best_bin = 0;
+		real_t best_cost = FLT_MAX;
+
+		for (int axis = 0; axis < 3; axis++) {
+			real_t extent = centers.size[axis];
+			if (extent <= CMP_EPSILON) {
+				continue;
+			}
+
+			Bin bins[SAH_BINS];
+			real_t bin_scale = SAH_BINS / extent;
+			for (int i = p_begin; i < p_end; i++) {
+				int b = MIN(int((elements[i].center[axis] - centers.position[axis]) * bin_scale), SAH_BINS - 1);
+				if (bins[b].count == 0) {
+					bins[b].aabb = elements[i].aabb;
+				} else {
+					bins[b].aabb.merge_with(elements[i].aabb);
+				}
+				bins[b].count++;
+			}
+
+			// Sweep from the right to get the cost of everything above each split plane.
+			real_t right_cost[SAH_BINS - 1];
+			AABB right_aabb;
+			int right_count = 0;
+			for (int b = SAH_BINS - 1; b > 0; b--) {
+				if (bins[b].count) {
+					right_aabb = right_count ? right_aabb.merge(bins[b].aabb) : bins[b].aabb;
+					right_count += bins[b].count;
+				}
+				right_cost[b - 1] = right_count ? right_count * _get_half_area(right_aabb) : 0;
+			}
+
+			AABB left_aabb;
+			int left_count = 0;
+			for (int b = 0; b < SAH_BINS - 1; b++) {
+				if (bins[b].count) {
+					left_aabb = left_count ? left_aabb.merge(bins[b].aabb) : bins[b].aabb;
+					left_count += bins[b].count;
+				}
+				if (left_count == 0 || left_count == count) {
+					continue;
+				}
+				real_t cost = left_count * _get_half_area(left_aabb) + right_cost[b];
+				if (cost < best_cost) {
+					best_cost = cost;
+					best_axis = axis;
+					best_bin = b;
+				}
+			}
 		}
-	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
-		case 0: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
 
-		} break;
-		case 1: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
-		} break;
-		case 2: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
-		} break;
-	}
+		if (best_axis == -1) {
+			// All centers coincide, only a count based split is possible.
+			return count > MAX_LEAF_ELEMENTS ? p_begin + count / 2 : -1;
+		}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
+		// Traversing a branch is assumed to cost about as much as testing one face.
+		if (count <= MAX_LEAF_ELEMENTS && best_cost + _get_half_area(p_aabb) >= count * _get_half_area(p_aabb)) {
+			return -1;
+		}
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
+		real_t bin_scale = SAH_BINS / centers.size[best_axis];
+		int split = p_begin;
+		for (int i = p_begin; i < p_end; i++) {
+			int b = MIN(int((elements[i].center[best_axis] - centers.position[best_axis]) * bin_scale), SAH_BINS - 1);
+			if (b <= best_bin) {
+				SWAP(elements[i], elements[split]);
+				split++;
+			}
+		}
+
+		return split;
+	}
+
+	void build(LocalVector<_Volume_BVH_Node> &r_nodes, int p_begin, int p_end, int p_depth, bool p_parallel) {
+		int index = r_nodes.size();
+		r_nodes.push_back(_Volume_BVH_Node());
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+		AABB aabb = elements[p_begin].aabb;
+		for (int i = p_begin + 1; i < p_end; i++) {
+			aabb.merge_with(elements[i].aabb);
+		}
+		r_nodes[index].aabb = aabb;
+
+		if (p_parallel && p_depth == PARALLEL_DEPTH) {
+			r_nodes[index].subtree = subtrees.size();
+			Subtree subtree;
+			subtree.begin = p_begin;
+			subtree.end = p_end;
+			subtrees.push_back(subtree);
+			return;
+		}
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+		int split = _partition(p_begin, p_end, aabb);
+		if (split == -1) {
+			r_nodes[index].first_element = p_begin;
+			r_nodes[index].element_count = p_end - p_begin;
+			return;
+		}
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+		build(r_nodes, p_begin, split, p_depth + 1, p_parallel);
+		r_nodes[index].right = r_nodes.size();
+		build(r_nodes, split, p_end, p_depth + 1, p_parallel);
+	}
 
-	} else {
-		p_bvh_array[p_idx].left = -1;
+	void _build_subtree(uint32_t p_index, void *p_userdata) {
+		Subtree &subtree = subtrees[p_index];
+		build(subtree.nodes, subtree.begin, subtree.end, 0, false);
 	}
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
+	void _splice(LocalVector<_Volume_BVH_Node> &r_nodes, const LocalVector<_Volume_BVH_Node> &p_top, int p_index) {
+		const _Volume_BVH_Node &node = p_top[p_index];
 
-	} else {
-		p_bvh_array[p_idx].right = -1;
+		if (node.subtree >= 0) {
+			int offset = r_nodes.size();
+			for (const _Volume_BVH_Node &subtree_node : subtrees[node.subtree].nodes) {
+				r_nodes.push_back(subtree_node);
+				if (subtree_node.element_count == 0) {
+					r_nodes[r_nodes.size() - 1].right += offset;
+				}
+			}
+			return;
+		}
+
+		int index = r_nodes.size();
+		r_nodes.push_back(node);
+		if (node.element_count == 0) {
+			_splice(r_nodes, p_top, p_index + 1);
+			r_nodes[index].right = r_nodes.size();
+			_splice(r_nodes, p_top, node.right);
+		}
 	}
 
-	memdelete(p_bvh_tree);
-}
+	void build_tree(LocalVector<_Volume_BVH_Node> &r_nodes, int p_count) {
+		// Waiting on the pool from one of its own threads would only stall it.
+		bool parallel = p_count >= PARALLEL_MIN_ELEMENTS && WorkerThreadPool::get_thread_index() == -1;
+		if (!parallel) {
+			build(r_nodes, 0, p_count, 0, false);
+			return;
+		}
+
+		LocalVector<_Volume_BVH_Node> top;
+		build(top, 0, p_count, 0, true);
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &_Volume_BVH_Builder::_build_subtree, nullptr, subtrees.size(), -1, true, SNAME("ConcavePolygonShape3DBuildBVH"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		_splice(r_nodes, top, 0);
+	}
+};
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
+		faces.clear();
+		face_ids.clear();
+		vertices.clear();
+		bvh.clear();
 		configure(AABB());
 		return;
 	}
 	ERR_FAIL_COND(src_face_count % 3);
 	src_face_count /= 3;
+	ERR_FAIL_COND_MSG(uint32_t(src_face_count) > BVH_LEAF_FACE_MASK + 1, "Too many faces in concave polygon shape.");
 
 	const Vector3 *facesr = p_faces.ptr();
 
-	Vector<_Volume_BVH_Element> bvh_array;
-	bvh_array.resize(src_face_count);
+	LocalVector<_Volume_BVH_Element> bvh_elements;
+	bvh_elements.resize(src_face_count);
 
-	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
+	AABB _aabb;
 
-	faces.resize(src_face_count);
-	Face *facesw = faces.ptrw();
+	for (int i = 0; i < src_face_count; i++) {
+		AABB face_aabb(facesr[i * 3 + 0], Vector3());
+		face_aabb.expand_to(facesr[i * 3 + 1]);
+		face_aabb.expand_to(facesr[i * 3 + 2]);
+
+		bvh_elements[i].aabb = face_aabb;
+		bvh_elements[i].center = face_aabb.get_center();
+		bvh_elements[i].face_index = i;
+		if (i == 0) {
+			_aabb = face_aabb;
+		} else {
+			_aabb.merge_with(face_aabb);
+		}
+	}
+
+	_Volume_BVH_Builder builder;
+	builder.elements = bvh_elements.ptr();
 
+	LocalVector<_Volume_BVH_Node> nodes;
+	builder.build_tree(nodes, src_face_count);
+
+	// Store the faces in leaf order so leaves reference contiguous ranges.
+	faces.resize(src_face_count);
+	face_ids.resize(src_face_count);
 	vertices.resize(src_face_count * 3);
 
+	Face *facesw = faces.ptrw();
+	int *face_idsw = face_ids.ptrw();
 	Vector3 *verticesw = vertices.ptrw();
 
-	AABB _aabb;
-
 	for (int i = 0; i < src_face_count; i++) {
-		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+		int src = bvh_elements[i].face_index;
+		Face3 face(facesr[src * 3 + 0], facesr[src * 3 + 1], facesr[src * 3 + 2]);
 
-		bvh_arrayw[i].aabb = face.get_aabb();
-		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
-		bvh_arrayw[i].face_index = i;
 		facesw[i].indices[0] = i * 3 + 0;
 		facesw[i].indices[1] = i * 3 + 1;
 		facesw[i].indices[2] = i * 3 + 2;
 		facesw[i].normal = face.get_plane().normal;
+		face_idsw[i] = src;
 		verticesw[i * 3 + 0] = face.vertex[0];
 		verticesw[i * 3 + 1] = face.vertex[1];
 		verticesw[i * 3 + 2] = face.vertex[2];
-		if (i == 0) {
-			_aabb = bvh_arrayw[i].aabb;
-		} else {
-			_aabb.merge_with(bvh_arrayw[i].aabb);
-		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
+	// Quantized coordinates of the shape bounds map to [1, 65534], so rounding
+	// outwards by one step never needs clamping and absorbs precision errors.
+	bvh_scale = _aabb.size / 65533.0;
+	bvh_origin = _aabb.position - bvh_scale;
+	Vector3 inv_scale;
+	for (int i = 0; i < 3; i++) {
+		inv_scale[i] = bvh_scale[i] > 0 ? 1.0 / bvh_scale[i] : 0.0;
+	}
 
-	bvh.resize(count + 1);
+	bvh.resize(nodes.size());
+	BVH *bvhw = bvh.ptrw();
 
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		const _Volume_BVH_Node &node = nodes[i];
+		Vector3 min = (node.aabb.position - bvh_origin) * inv_scale;
+		Vector3 max = (node.aabb.get_end() - bvh_origin) * inv_scale;
+		for (int j = 0; j < 3; j++) {
+			bvhw[i].min[j] = CLAMP(Math::floor(min[j]) - 1, 0, 65535);
+			bvhw[i].max[j] = CLAMP(Math::ceil(max[j]) + 1, 0, 65535);
+		}
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+		if (node.element_count) {
+			bvhw[i].data = BVH_LEAF_FLAG | (uint32_t(node.element_count - 1) << BVH_LEAF_COUNT_SHIFT) | uint32_t(node.first_element);
+		} else {
+			bvhw[i].data = node.right;
+		}
+	}
 
 	backface_collision = p_backface_collision;
 
@@ -2053,26 +2137,61 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
+	if (bounds_grid.is_empty() || start_x >= end_x || start_z >= end_z) {
+		_cull_cells(start_x, end_x, start_z, end_z, face, p_callback, p_userdata);
+		return;
+	}
+
+	// Skip the chunks whose height range doesn't reach the aabb,
+	// so large bodies don't test every cell of a flat terrain under them.
+	real_t min_y = local_aabb.position.y;
+	real_t max_y = local_aabb.position.y + local_aabb.size.y;
+
+	int start_cx = start_x / BOUNDS_CHUNK_SIZE;
+	int end_cx = (end_x - 1) / BOUNDS_CHUNK_SIZE;
+	int start_cz = start_z / BOUNDS_CHUNK_SIZE;
+	int end_cz = (end_z - 1) / BOUNDS_CHUNK_SIZE;
+
+	for (int cz = start_cz; cz <= end_cz; cz++) {
+		for (int cx = start_cx; cx <= end_cx; cx++) {
+			const Range &chunk = _get_bounds_chunk(cx, cz);
+			if (chunk.min > max_y || chunk.max < min_y) {
+				continue;
+			}
+
+			int chunk_start_x = MAX(start_x, cx * BOUNDS_CHUNK_SIZE);
+			int chunk_end_x = MIN(end_x, (cx + 1) * BOUNDS_CHUNK_SIZE);
+			int chunk_start_z = MAX(start_z, cz * BOUNDS_CHUNK_SIZE);
+			int chunk_end_z = MIN(end_z, (cz + 1) * BOUNDS_CHUNK_SIZE);
+			if (_cull_cells(chunk_start_x, chunk_end_x, chunk_start_z, chunk_end_z, face, p_callback, p_userdata)) {
 				return;
 			}
+		}
+	}
+}
+
+bool GodotHeightMapShape3D::_cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
+			// First triangle.
+			_get_point(x, z, p_face.vertex[0]);
+			_get_point(x + 1, z, p_face.vertex[1]);
+			_get_point(x, z + 1, p_face.vertex[2]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
+			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			p_face.vertex[0] = p_face.vertex[1];
+			_get_point(x + 1, z + 1, p_face.vertex[1]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 		}
 	}
+	return false;
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2085,76 +2204,114 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
-void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+void GodotHeightMapShape3D::_compute_bounds_chunk(int p_x, int p_z) {
+	int x0 = p_x * BOUNDS_CHUNK_SIZE;
+	int z0 = p_z * BOUNDS_CHUNK_SIZE;
+
+	Range r;
+
+	r.min = _get_height(x0, z0);
+	r.max = r.min;
+
+	// Compute min and max height for this chunk.
+	// We have to include one extra cell to account for neighbors.
+	// Here is why:
+	// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+	//
+	//   Left        Right
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	//           x
+	//
+	// If the AABB for the Left chunk did not share vertices with the Right,
+	// then we would fail collision tests at x due to a gap.
+	//
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+	for (int z = z0; z < z_max; ++z) {
+		for (int x = x0; x < x_max; ++x) {
+			real_t height = _get_height(x, z);
+			if (height < r.min) {
+				r.min = height;
+			} else if (height > r.max) {
+				r.max = height;
+			}
+		}
+	}
+
+	bounds_grid[p_x + p_z * bounds_grid_width] = r;
+}
+
+bool GodotHeightMapShape3D::_is_bounds_chunk_changed(int p_x, int p_z, const Vector<real_t> &p_previous_heights) const {
+	int x0 = p_x * BOUNDS_CHUNK_SIZE;
+	int z0 = p_z * BOUNDS_CHUNK_SIZE;
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+
+	const real_t *previous = p_previous_heights.ptr();
+	const real_t *current = heights.ptr();
+	for (int z = z0; z < z_max; ++z) {
+		int row = z * width + x0;
+		if (memcmp(previous + row, current + row, (x_max - x0) * sizeof(real_t)) != 0) {
+			return true;
+		}
+	}
+	return false;
+}
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+void GodotHeightMapShape3D::_build_accelerator(const Vector<real_t> &p_previous_heights) {
+	int grid_width = width / BOUNDS_CHUNK_SIZE;
+	int grid_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
+		++grid_width; // In case terrain size isn't dividable by chunk size.
 	}
 
 	if (depth % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_depth;
+		++grid_depth;
 	}
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
+	uint32_t bound_grid_size = (uint32_t)(grid_width * grid_depth);
+
+	// When only some heights changed, the bounds of the other chunks are still valid.
+	bool incremental = p_previous_heights.size() == heights.size() && grid_width == bounds_grid_width && grid_depth == bounds_grid_depth && bounds_grid.size() == bound_grid_size;
+
+	bounds_grid_width = grid_width;
+	bounds_grid_depth = grid_depth;
 
 	if (bound_grid_size < 2) {
 		// Grid is empty or just one chunk.
+		bounds_grid.clear();
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
+	if (!incremental) {
+		bounds_grid.clear();
+		bounds_grid.resize(bound_grid_size);
+	}
 
 	// Compute min and max height for all chunks.
 	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
 		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
-					}
-				}
+			if (incremental && !_is_bounds_chunk_changed(cx, cz, p_previous_heights)) {
+				continue;
 			}
-
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+			_compute_bounds_chunk(cx, cz);
 		}
 	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
+	// Keep the previous heights around while the accelerator is updated, when the size doesn't change
+	// (e.g. a deforming terrain), only the chunks with modified heights need new bounds.
+	Vector<real_t> previous_heights;
+	if (p_width == width && p_depth == depth) {
+		previous_heights = heights;
+	}
+
 	heights = p_heights;
 	width = p_width;
 	depth = p_depth;
@@ -2170,7 +2327,7 @@ void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width,
 
 	aabb_new.position -= local_origin;
 
-	_build_accelerator();
+	_build_accelerator(previous_heights);
 
 	configure(aabb_new);
 }
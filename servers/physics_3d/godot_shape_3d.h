@@ -165,7 +165,7 @@ public:
 	GodotSeparationRayShape3D();
 };
 
-class GodotSphereShape3D : public GodotShape3D {
+class GodotSphereShape3D final : public GodotShape3D {
 	real_t radius = 0.0;
 
 	void _setup(real_t p_radius);
@@ -177,8 +177,17 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_SPHERE; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
-	virtual Vector3 get_support(const Vector3 &p_normal) const override;
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override {
+		real_t d = p_normal.dot(p_transform.origin);
+
+		// figure out scale at point
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+		real_t scale = local_normal.length();
+
+		r_min = d - (radius)*scale;
+		r_max = d + (radius)*scale;
+	}
+	virtual Vector3 get_support(const Vector3 &p_normal) const override { return p_normal * radius; }
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
 	virtual bool intersect_point(const Vector3 &p_point) const override;
@@ -192,7 +201,7 @@ public:
 	GodotSphereShape3D();
 };
 
-class GodotBoxShape3D : public GodotShape3D {
+class GodotBoxShape3D final : public GodotShape3D {
 	Vector3 half_extents;
 	void _setup(const Vector3 &p_half_extents);
 
@@ -202,8 +211,22 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_BOX; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
-	virtual Vector3 get_support(const Vector3 &p_normal) const override;
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override {
+		// no matter the angle, the box is mirrored anyway
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+
+		real_t length = local_normal.abs().dot(half_extents);
+		real_t distance = p_normal.dot(p_transform.origin);
+
+		r_min = distance - length;
+		r_max = distance + length;
+	}
+	virtual Vector3 get_support(const Vector3 &p_normal) const override {
+		return Vector3(
+				(p_normal.x < 0) ? -half_extents.x : half_extents.x,
+				(p_normal.y < 0) ? -half_extents.y : half_extents.y,
+				(p_normal.z < 0) ? -half_extents.z : half_extents.z);
+	}
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
 	virtual bool intersect_point(const Vector3 &p_point) const override;
@@ -217,7 +240,7 @@ public:
 	GodotBoxShape3D();
 };
 
-class GodotCapsuleShape3D : public GodotShape3D {
+class GodotCapsuleShape3D final : public GodotShape3D {
 	real_t height = 0.0;
 	real_t radius = 0.0;
 
@@ -231,8 +254,25 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_CAPSULE; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
-	virtual Vector3 get_support(const Vector3 &p_normal) const override;
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override {
+		Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
+		real_t h = height * 0.5 - radius;
+
+		n *= radius;
+		n.y += (n.y > 0) ? h : -h;
+
+		r_max = p_normal.dot(p_transform.xform(n));
+		r_min = p_normal.dot(p_transform.xform(-n));
+	}
+	virtual Vector3 get_support(const Vector3 &p_normal) const override {
+		Vector3 n = p_normal;
+
+		real_t h = height * 0.5 - radius;
+
+		n *= radius;
+		n.y += (n.y > 0) ? h : -h;
+		return n;
+	}
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
 	virtual bool intersect_point(const Vector3 &p_point) const override;
@@ -246,7 +286,7 @@ public:
 	GodotCapsuleShape3D();
 };
 
-class GodotCylinderShape3D : public GodotShape3D {
+class GodotCylinderShape3D final : public GodotShape3D {
 	real_t height = 0.0;
 	real_t radius = 0.0;
 
@@ -275,7 +315,7 @@ public:
 	GodotCylinderShape3D();
 };
 
-struct GodotConvexPolygonShape3D : public GodotShape3D {
+struct GodotConvexPolygonShape3D final : public GodotShape3D {
 	Geometry3D::MeshData mesh;
 	LocalVector<int> extreme_vertices;
 	LocalVector<LocalVector<int>> vertex_neighbors;
@@ -302,7 +342,6 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -313,18 +352,33 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		int indices[3] = {};
 	};
 
-	Vector<Face> faces;
+	Vector<Face> faces; // Sorted in BVH leaf order.
+	Vector<int> face_ids; // Index of each face in the source data.
 	Vector<Vector3> vertices;
 
+	// Bounds are quantized relative to the shape AABB and rounded outwards.
+	// The left child of a branch is always the next node.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Branch: index of the right child.
+		// Leaf: BVH_LEAF_FLAG | (face count - 1) << BVH_LEAF_COUNT_SHIFT | first face.
+		uint32_t data = 0;
 	};
 
+	static constexpr uint32_t BVH_LEAF_FLAG = 1u << 31;
+	static constexpr uint32_t BVH_LEAF_COUNT_SHIFT = 29;
+	static constexpr uint32_t BVH_LEAF_FACE_MASK = (1u << BVH_LEAF_COUNT_SHIFT) - 1;
+
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_scale;
+
+	_FORCE_INLINE_ AABB _get_bvh_aabb(const BVH &p_node) const {
+		Vector3 min(p_node.min[0], p_node.min[1], p_node.min[2]);
+		Vector3 max(p_node.max[0], p_node.max[1], p_node.max[2]);
+		return AABB(bvh_origin + min * bvh_scale, (max - min) * bvh_scale);
+	}
 
 	struct _CullParams {
 		AABB aabb;
@@ -342,6 +396,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		Vector3 dir;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
+		const int *face_ids = nullptr;
 		const BVH *bvh = nullptr;
 		GodotFaceShape3D *face = nullptr;
 
@@ -357,8 +412,6 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
-
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
 public:
@@ -383,6 +436,8 @@ public:
 	GodotConcavePolygonShape3D();
 };
 
+struct GodotFaceShape3D;
+
 struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	Vector<real_t> heights;
 	int width = 0;
@@ -416,7 +471,11 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
-	void _build_accelerator();
+	void _compute_bounds_chunk(int p_x, int p_z);
+	bool _is_bounds_chunk_changed(int p_x, int p_z, const Vector<real_t> &p_previous_heights) const;
+	void _build_accelerator(const Vector<real_t> &p_previous_heights = Vector<real_t>());
+
+	bool _cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
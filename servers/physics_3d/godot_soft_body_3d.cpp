@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
@@ -582,6 +583,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	color_links();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -826,6 +828,65 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::color_links() {
+	link_color_ends.clear();
+
+	const uint32_t link_count = links.size();
+	if (link_count == 0) {
+		return;
+	}
+
+	// Greedy coloring, each node keeps a mask of the colors of its links.
+	LocalVector<uint64_t> node_masks;
+	node_masks.resize(nodes.size());
+	memset(node_masks.ptr(), 0, node_masks.size() * sizeof(uint64_t));
+
+	LocalVector<uint8_t> link_colors;
+	link_colors.resize(link_count);
+
+	const uint8_t uncolored = 64;
+	uint32_t color_counts[65] = {};
+	uint32_t color_count = 0;
+
+	for (uint32_t i = 0; i < link_count; ++i) {
+		uint64_t &mask_a = node_masks[links[i].n[0]->index];
+		uint64_t &mask_b = node_masks[links[i].n[1]->index];
+		uint64_t used = mask_a | mask_b;
+
+		uint8_t color = 0;
+		while (color < uncolored && (used & (uint64_t(1) << color))) {
+			color++;
+		}
+		if (color < uncolored) {
+			mask_a |= uint64_t(1) << color;
+			mask_b |= uint64_t(1) << color;
+			color_count = MAX(color_count, uint32_t(color) + 1);
+		}
+
+		link_colors[i] = color;
+		color_counts[color]++;
+	}
+
+	// Counting sort, this keeps the cache friendly order within each color.
+	uint32_t color_offsets[65];
+	uint32_t offset = 0;
+	for (uint32_t color = 0; color < 65; ++color) {
+		color_offsets[color] = offset;
+		offset += color_counts[color];
+		if (color < color_count) {
+			link_color_ends.push_back(offset);
+		}
+	}
+
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	for (uint32_t i = 0; i < link_count; ++i) {
+		sorted_links[color_offsets[link_colors[i]]++] = links[i];
+	}
+
+	links = sorted_links;
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -1099,7 +1160,36 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 }
 
 void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
+	// Waiting on the pool from one of its threads (when several bodies are solved at once) would only stall it.
+	const bool parallel = WorkerThreadPool::get_thread_index() == -1;
+
+	uint32_t begin = 0;
+	for (uint32_t end : link_color_ends) {
+		if (parallel && end - begin >= PARALLEL_MIN_COLOR_LINKS) {
+			link_batch_begin = begin;
+			link_batch_end = end;
+			link_batch_kst = kst;
+
+			uint32_t batch_count = (end - begin + LINK_BATCH_SIZE - 1) / LINK_BATCH_SIZE;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_batch, nullptr, batch_count, -1, true, SNAME("Physics3DSoftBodySolveLinks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_solve_link_range(begin, end, kst);
+		}
+		begin = end;
+	}
+
+	_solve_link_range(begin, links.size(), kst);
+}
+
+void GodotSoftBody3D::_solve_link_batch(uint32_t p_batch_index, void *p_userdata) {
+	uint32_t begin = link_batch_begin + p_batch_index * LINK_BATCH_SIZE;
+	_solve_link_range(begin, MIN(begin + LINK_BATCH_SIZE, link_batch_end), link_batch_kst);
+}
+
+void GodotSoftBody3D::_solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst) {
+	for (uint32_t i = p_begin; i < p_end; ++i) {
+		Link &link = links[i];
 		if (link.c0 > 0) {
 			Node &node_a = *link.n[0];
 			Node &node_b = *link.n[1];
@@ -1221,6 +1311,7 @@ void GodotSoftBody3D::destroy() {
 
 	nodes.clear();
 	links.clear();
+	link_color_ends.clear();
 	faces.clear();
 
 	bounds = AABB();
@@ -82,6 +82,17 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Links are sorted by color, links of the same color never share a node and can be
+	// solved in parallel. Links past the last color end could not be colored.
+	LocalVector<uint32_t> link_color_ends;
+
+	static const uint32_t LINK_BATCH_SIZE = 256;
+	static const uint32_t PARALLEL_MIN_COLOR_LINKS = 2 * LINK_BATCH_SIZE;
+
+	uint32_t link_batch_begin = 0;
+	uint32_t link_batch_end = 0;
+	real_t link_batch_kst = 0.0;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -234,10 +245,13 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void color_links();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
 	void solve_links(real_t kst, real_t ti);
+	void _solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst);
+	void _solve_link_batch(uint32_t p_batch_index, void *p_userdata);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
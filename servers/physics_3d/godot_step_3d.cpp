@@ -40,6 +40,9 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define COLORED_ISLAND_MIN_CONSTRAINTS 512
+#define COLORED_ISLAND_MAX_COLORS 64
+#define COLOR_PARALLEL_MIN_CONSTRAINTS 64
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -158,6 +161,125 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_color_island(LocalVector<GodotConstraint3D *> &p_constraint_island, ColoredIsland &r_colored_island) {
+	for (LocalVector<GodotConstraint3D *> &color : r_colored_island.colors) {
+		color.clear();
+	}
+	r_colored_island.uncolored.clear();
+	body_color_masks.clear();
+
+	uint32_t color_count = 0;
+
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		if (constraint->get_soft_body_count() > 0) {
+			// Soft bodies are shared by most of their constraints, there's nothing to gain from coloring them.
+			r_colored_island.uncolored.push_back(constraint);
+			continue;
+		}
+
+		// Static and kinematic bodies are only read when solving, so they can be shared within a color.
+		uint64_t used_colors = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				uint64_t *mask = body_color_masks.getptr(body);
+				if (mask) {
+					used_colors |= *mask;
+				}
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < COLORED_ISLAND_MAX_COLORS && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+		if (color == COLORED_ISLAND_MAX_COLORS) {
+			r_colored_island.uncolored.push_back(constraint);
+			continue;
+		}
+
+		if (color >= color_count) {
+			color_count = color + 1;
+			if (r_colored_island.colors.size() < color_count) {
+				r_colored_island.colors.resize(color_count);
+			}
+		}
+		r_colored_island.colors[color].push_back(constraint);
+
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				body_color_masks[body] |= uint64_t(1) << color;
+			}
+		}
+	}
+
+	r_colored_island.colors.resize(color_count);
+
+	// The constraints are owned by the colored island now, leave nothing for _solve_island.
+	p_constraint_island.clear();
+}
+
+void GodotStep3D::_solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_constraints) {
+	(*p_constraints)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_colored_island(ColoredIsland &p_colored_island) {
+	int current_priority = 1;
+
+	while (true) {
+		uint32_t constraint_count = p_colored_island.uncolored.size();
+		for (const LocalVector<GodotConstraint3D *> &color : p_colored_island.colors) {
+			constraint_count += color.size();
+		}
+		if (constraint_count == 0) {
+			break;
+		}
+
+		for (int i = 0; i < iterations; i++) {
+			// Go through all iterations, one color after the other.
+			for (LocalVector<GodotConstraint3D *> &color : p_colored_island.colors) {
+				if (color.size() >= COLOR_PARALLEL_MIN_CONSTRAINTS) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_colored_constraint, &color, color.size(), -1, true, SNAME("Physics3DConstraintSolveColor"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else {
+					for (GodotConstraint3D *constraint : color) {
+						constraint->solve(delta);
+					}
+				}
+			}
+			for (GodotConstraint3D *constraint : p_colored_island.uncolored) {
+				constraint->solve(delta);
+			}
+		}
+
+		// Check priority to keep only higher priority constraints, this doesn't break the coloring.
+		++current_priority;
+		for (LocalVector<GodotConstraint3D *> &color : p_colored_island.colors) {
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < color.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = color[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					color[priority_constraint_count++] = constraint;
+				}
+			}
+			color.resize(priority_constraint_count);
+		}
+		uint32_t priority_constraint_count = 0;
+		for (uint32_t constraint_index = 0; constraint_index < p_colored_island.uncolored.size(); ++constraint_index) {
+			GodotConstraint3D *constraint = p_colored_island.uncolored[constraint_index];
+			if (constraint->get_priority() >= current_priority) {
+				p_colored_island.uncolored[priority_constraint_count++] = constraint;
+			}
+		}
+		p_colored_island.uncolored.resize(priority_constraint_count);
+	}
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -362,9 +484,27 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	// Islands with many constraints would keep a single thread busy while the others are idle,
+	// they are colored and solved here instead, while the regular islands are solved in the group task.
+	uint32_t colored_island_count = 0;
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (constraint_islands[island_index].size() >= COLORED_ISLAND_MIN_CONSTRAINTS) {
+			++colored_island_count;
+			if (colored_islands.size() < colored_island_count) {
+				colored_islands.resize(colored_island_count);
+			}
+			_color_island(constraint_islands[island_index], colored_islands[colored_island_count - 1]);
+		}
+	}
+
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+
+	for (uint32_t island_index = 0; island_index < colored_island_count; ++island_index) {
+		_solve_colored_island(colored_islands[island_index]);
+	}
+
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -390,12 +530,21 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
+	// Soft bodies only touch their own nodes here. With a single one, its links are solved in parallel instead.
+	active_soft_bodies.clear();
 	sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->solve_constraints(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 	}
 
+	if (active_soft_bodies.size() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (active_soft_bodies.size() == 1) {
+		active_soft_bodies[0]->solve_constraints(p_delta);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
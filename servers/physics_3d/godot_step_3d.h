@@ -33,6 +33,7 @@
 
 #include "godot_space_3d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
@@ -45,11 +46,28 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	// Islands too large to be solved efficiently on a single thread. Their constraints are
+	// split into colors, so that constraints of the same color never share a dynamic body
+	// and can be solved in parallel.
+	struct ColoredIsland {
+		LocalVector<LocalVector<GodotConstraint3D *>> colors;
+		LocalVector<GodotConstraint3D *> uncolored;
+	};
+
+	LocalVector<ColoredIsland> colored_islands;
+	HashMap<const GodotBody3D *, uint64_t> body_color_masks;
+
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
+
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _color_island(LocalVector<GodotConstraint3D *> &p_constraint_island, ColoredIsland &r_colored_island);
+	void _solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_constraints);
+	void _solve_colored_island(ColoredIsland &p_colored_island);
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
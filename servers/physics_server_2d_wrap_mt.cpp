@@ -42,6 +42,7 @@ void PhysicsServer2DWrapMT::_thread_exit() {
 }
 
 void PhysicsServer2DWrapMT::_thread_loop() {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
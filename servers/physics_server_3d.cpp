@@ -377,6 +377,70 @@ Dictionary PhysicsDirectSpaceState3D::_intersect_ray(const Ref<PhysicsRayQueryPa
 	return d;
 }
 
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The from and to arrays must have the same size.");
+
+	int count = p_from.size();
+
+	Vector<RayResult> results;
+	results.resize(count);
+	Vector<bool> hits;
+	hits.resize(count);
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptrw(), hits.ptrw());
+
+	PackedVector3Array positions;
+	positions.resize(count);
+	PackedVector3Array normals;
+	normals.resize(count);
+	PackedInt32Array face_indices;
+	face_indices.resize(count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(count);
+	PackedInt32Array shapes;
+	shapes.resize(count);
+	TypedArray<RID> rids;
+	rids.resize(count);
+
+	for (int i = 0; i < count; i++) {
+		if (!hits[i]) {
+			positions.set(i, Vector3());
+			normals.set(i, Vector3());
+			face_indices.set(i, -1);
+			collider_ids.set(i, 0);
+			shapes.set(i, -1);
+			continue;
+		}
+
+		const RayResult &result = results[i];
+		positions.set(i, result.position);
+		normals.set(i, result.normal);
+		face_indices.set(i, result.face_index);
+		collider_ids.set(i, (int64_t)result.collider_id);
+		shapes.set(i, result.shape);
+		rids[i] = result.rid;
+	}
+
+	Dictionary d;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["face_index"] = face_indices;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["rid"] = rids;
+
+	return d;
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results) {
 	ERR_FAIL_COND_V(p_point_query.is_null(), TypedArray<Dictionary>());
 
@@ -482,6 +546,7 @@ PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
@@ -662,6 +727,31 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+void PhysicsServer3D::_body_set_state_batch(const TypedArray<RID> &p_bodies, BodyState p_state, const Array &p_values) {
+	ERR_FAIL_COND_MSG(p_bodies.size() != p_values.size(), "The number of bodies and values must match.");
+
+	Vector<RID> bodies;
+	Vector<Variant> values;
+	bodies.resize(p_bodies.size());
+	values.resize(p_values.size());
+	RID *bodiesw = bodies.ptrw();
+	Variant *valuesw = values.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		bodiesw[i] = p_bodies[i];
+		valuesw[i] = p_values[i];
+	}
+
+	body_set_state_batch(bodies, p_state, values);
+}
+
+void PhysicsServer3D::body_set_state_batch(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND_MSG(p_bodies.size() != p_values.size(), "The number of bodies and values must match.");
+
+	for (int i = 0; i < p_bodies.size(); i++) {
+		body_set_state(p_bodies[i], p_state, p_values[i]);
+	}
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -796,6 +886,7 @@ void PhysicsServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("body_set_state", "body", "state", "value"), &PhysicsServer3D::body_set_state);
 	ClassDB::bind_method(D_METHOD("body_get_state", "body", "state"), &PhysicsServer3D::body_get_state);
+	ClassDB::bind_method(D_METHOD("body_set_state_batch", "bodies", "state", "values"), &PhysicsServer3D::_body_set_state_batch);
 
 	ClassDB::bind_method(D_METHOD("body_apply_central_impulse", "body", "impulse"), &PhysicsServer3D::body_apply_central_impulse);
 	ClassDB::bind_method(D_METHOD("body_apply_impulse", "body", "impulse", "position"), &PhysicsServer3D::body_apply_impulse, Vector3());
@@ -42,12 +42,136 @@ void PhysicsServer3DWrapMT::_thread_exit() {
 }
 
 void PhysicsServer3DWrapMT::_thread_loop() {
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS);
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
 	}
 }
 
+/* BODY STATE SNAPSHOTS */
+
+void PhysicsServer3DWrapMT::_update_body_state_snapshots() {
+	for (KeyValue<RID, BodyStateSnapshot> &E : body_state_snapshots) {
+		BodyStateSnapshot &snapshot = E.value;
+		snapshot.transform = physics_server_3d->body_get_state(E.key, BODY_STATE_TRANSFORM);
+		snapshot.linear_velocity = physics_server_3d->body_get_state(E.key, BODY_STATE_LINEAR_VELOCITY);
+		snapshot.angular_velocity = physics_server_3d->body_get_state(E.key, BODY_STATE_ANGULAR_VELOCITY);
+		snapshot.sleeping = physics_server_3d->body_get_state(E.key, BODY_STATE_SLEEPING);
+		snapshot.can_sleep = physics_server_3d->body_get_state(E.key, BODY_STATE_CAN_SLEEP);
+		snapshot.valid = true;
+	}
+}
+
+void PhysicsServer3DWrapMT::_update_body_state_snapshot(RID p_body, BodyState p_state, const Variant &p_value) {
+	BodyStateSnapshot *snapshot = body_state_snapshots.getptr(p_body);
+	if (!snapshot || !snapshot->valid) {
+		return;
+	}
+
+	switch (p_state) {
+		case BODY_STATE_TRANSFORM: {
+			snapshot->transform = p_value;
+		} break;
+		case BODY_STATE_LINEAR_VELOCITY: {
+			snapshot->linear_velocity = p_value;
+		} break;
+		case BODY_STATE_ANGULAR_VELOCITY: {
+			snapshot->angular_velocity = p_value;
+		} break;
+		default: {
+			// Sleeping states interact with each other and the body mode, read them back on the next sync.
+			snapshot->valid = false;
+		} break;
+	}
+}
+
+void PhysicsServer3DWrapMT::_invalidate_body_state_snapshot(RID p_body) {
+	if (!_uses_body_state_snapshots()) {
+		return;
+	}
+
+	BodyStateSnapshot *snapshot = body_state_snapshots.getptr(p_body);
+	if (snapshot) {
+		snapshot->valid = false;
+	}
+}
+
+void PhysicsServer3DWrapMT::body_set_state(RID p_body, BodyState p_state, const Variant &p_value) {
+	if (Thread::get_caller_id() != server_thread) {
+		if (_uses_body_state_snapshots()) {
+			_update_body_state_snapshot(p_body, p_state, p_value);
+		}
+		command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_state, p_body, p_state, p_value);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->body_set_state(p_body, p_state, p_value);
+	}
+}
+
+Variant PhysicsServer3DWrapMT::body_get_state(RID p_body, BodyState p_state) const {
+	if (Thread::get_caller_id() == server_thread) {
+		command_queue.flush_if_pending();
+		return physics_server_3d->body_get_state(p_body, p_state);
+	}
+
+	if (_uses_body_state_snapshots()) {
+		const BodyStateSnapshot *snapshot = body_state_snapshots.getptr(p_body);
+		if (snapshot && snapshot->valid) {
+			switch (p_state) {
+				case BODY_STATE_TRANSFORM:
+					return snapshot->transform;
+				case BODY_STATE_LINEAR_VELOCITY:
+					return snapshot->linear_velocity;
+				case BODY_STATE_ANGULAR_VELOCITY:
+					return snapshot->angular_velocity;
+				case BODY_STATE_SLEEPING:
+					return snapshot->sleeping;
+				case BODY_STATE_CAN_SLEEP:
+					return snapshot->can_sleep;
+			}
+		}
+
+		if (!snapshot) {
+			// Start tracking the body, it gets a snapshot on the next sync.
+			body_state_snapshots.insert(p_body, BodyStateSnapshot());
+		}
+	}
+
+	Variant ret;
+	command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+	return ret;
+}
+
+void PhysicsServer3DWrapMT::body_set_state_batch(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND_MSG(p_bodies.size() != p_values.size(), "The number of bodies and values must match.");
+
+	if (Thread::get_caller_id() != server_thread) {
+		if (_uses_body_state_snapshots()) {
+			for (int i = 0; i < p_bodies.size(); i++) {
+				_update_body_state_snapshot(p_bodies[i], p_state, p_values[i]);
+			}
+		}
+		// A single command for all the bodies.
+		command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_state_batch, p_bodies, p_state, p_values);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->body_set_state_batch(p_bodies, p_state, p_values);
+	}
+}
+
+void PhysicsServer3DWrapMT::free(RID p_rid) {
+	if (Thread::get_caller_id() != server_thread) {
+		if (_uses_body_state_snapshots()) {
+			body_state_snapshots.erase(p_rid);
+		}
+		command_queue.push(physics_server_3d, &PhysicsServer3D::free, p_rid);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->free(p_rid);
+	}
+}
+
 /* EVENT QUEUING */
 
 void PhysicsServer3DWrapMT::step(real_t p_step) {
@@ -61,6 +185,8 @@ void PhysicsServer3DWrapMT::step(real_t p_step) {
 void PhysicsServer3DWrapMT::sync() {
 	if (create_thread) {
 		command_queue.sync();
+		// The server thread is idle until the next step.
+		_update_body_state_snapshots();
 	} else {
 		command_queue.flush_all(); // Flush all pending from other threads.
 	}
@@ -35,6 +35,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
 #include "servers/physics_server_3d.h"
 
 #ifdef DEBUG_SYNC
@@ -61,6 +62,26 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	bool exit = false;
 	bool create_thread = false;
 
+	// States of the bodies read from the main thread, refreshed on sync() while the server thread
+	// is idle. Reading them doesn't need to wait for the server thread to finish its step.
+	// Only accessed from the main thread.
+	struct BodyStateSnapshot {
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		bool sleeping = false;
+		bool can_sleep = true;
+		// Cleared by commands changing the state in ways that can't be tracked here.
+		bool valid = false;
+	};
+
+	mutable HashMap<RID, BodyStateSnapshot> body_state_snapshots;
+
+	_FORCE_INLINE_ bool _uses_body_state_snapshots() const { return create_thread && Thread::is_main_thread(); }
+	void _update_body_state_snapshots();
+	void _update_body_state_snapshot(RID p_body, BodyState p_state, const Variant &p_value);
+	void _invalidate_body_state_snapshot(RID p_body);
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_step(real_t p_delta);
@@ -173,10 +194,24 @@ public:
 	//FUNC2RID(body,BodyMode,bool);
 	FUNCRID(body)
 
-	FUNC2(body_set_space, RID, RID);
-	FUNC1RC(RID, body_get_space, RID);
+	// These change the body state as a side effect.
+#undef WRITE_ACTION
+#define WRITE_ACTION _invalidate_body_state_snapshot(p1);
 
+	FUNC2(body_set_space, RID, RID);
 	FUNC2(body_set_mode, RID, BodyMode);
+
+	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
+	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
+	FUNC3(body_apply_impulse, RID, const Vector3 &, const Vector3 &);
+
+	FUNC2(body_set_axis_velocity, RID, const Vector3 &);
+	FUNC3(body_set_axis_lock, RID, BodyAxis, bool);
+
+#undef WRITE_ACTION
+#define WRITE_ACTION
+
+	FUNC1RC(RID, body_get_space, RID);
 	FUNC1RC(BodyMode, body_get_mode, RID);
 
 	FUNC4(body_add_shape, RID, RID, const Transform3D &, bool);
@@ -215,12 +250,9 @@ public:
 
 	FUNC1(body_reset_mass_properties, RID);
 
-	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
-
-	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
-	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
-	FUNC3(body_apply_impulse, RID, const Vector3 &, const Vector3 &);
+	void body_set_state(RID p_body, BodyState p_state, const Variant &p_value) override;
+	Variant body_get_state(RID p_body, BodyState p_state) const override;
+	void body_set_state_batch(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) override;
 
 	FUNC2(body_apply_central_force, RID, const Vector3 &);
 	FUNC3(body_apply_force, RID, const Vector3 &, const Vector3 &);
@@ -236,9 +268,6 @@ public:
 	FUNC2(body_set_constant_torque, RID, const Vector3 &);
 	FUNC1RC(Vector3, body_get_constant_torque, RID);
 
-	FUNC2(body_set_axis_velocity, RID, const Vector3 &);
-
-	FUNC3(body_set_axis_lock, RID, BodyAxis, bool);
 	FUNC2RC(bool, body_is_axis_locked, RID, BodyAxis);
 
 	FUNC2(body_add_collision_exception, RID, RID);
@@ -379,7 +408,7 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	void free(RID p_rid) override;
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
@@ -48,6 +48,7 @@ public:
 	virtual void particles_set_emitting(RID p_particles, bool p_emitting) override {}
 	virtual void particles_set_amount(RID p_particles, int p_amount) override {}
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) override {}
+	virtual void particles_set_emission_lod_distance(RID p_particles, float p_distance) override {}
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) override {}
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) override {}
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) override {}
@@ -63,6 +64,7 @@ public:
 	virtual void particles_set_fractional_delta(RID p_particles, bool p_enable) override {}
 	virtual void particles_set_subemitter(RID p_particles, RID p_subemitter_particles) override {}
 	virtual void particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) override {}
+	virtual void particles_set_view_distance(RID p_particles, float p_distance) override {}
 	virtual void particles_set_collision_base_size(RID p_particles, real_t p_size) override {}
 
 	virtual void particles_set_transform_align(RID p_particles, RS::ParticlesTransformAlign p_transform_align) override {}
@@ -0,0 +1,318 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "raster_occlusion_cull.h"
+
+#include "core/object/worker_thread_pool.h"
+
+void RasterOcclusionCull::RasterHZBuffer::_raster_threaded(uint32_t p_thread, const RasterThreadData *p_data) {
+	int height = sizes[0].y;
+	int from = p_thread * height / p_data->thread_count;
+	int to = (p_thread + 1 == p_data->thread_count) ? height : ((p_thread + 1) * height / p_data->thread_count);
+	_raster_rows(p_data, from, to);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_raster_rows(const RasterThreadData *p_data, int p_from_y, int p_to_y) {
+	const int width = sizes[0].x;
+	float *depth = mips[0];
+
+	for (uint32_t i = 0; i < p_data->triangle_count; i++) {
+		const ScreenTriangle &t = p_data->triangles[i];
+		if (t.max_y < p_from_y || t.min_y >= p_to_y) {
+			continue;
+		}
+
+		const Vector2 &a = t.v[0];
+		const Vector2 &b = t.v[1];
+		const Vector2 &c = t.v[2];
+
+		float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+		if (Math::abs(area) < CMP_EPSILON) {
+			continue;
+		}
+		// Occluders are double sided, flip the edge functions for clockwise triangles.
+		float inv_area = 1.0f / area;
+
+		int min_x = MAX(0, (int)Math::floor(MIN(a.x, MIN(b.x, c.x))));
+		int max_x = MIN(width - 1, (int)Math::ceil(MAX(a.x, MAX(b.x, c.x))));
+		int min_y = MAX(p_from_y, t.min_y);
+		int max_y = MIN(p_to_y - 1, t.max_y);
+
+		for (int y = min_y; y <= max_y; y++) {
+			const float py = y + 0.5f;
+			float *row = &depth[y * width];
+			for (int x = min_x; x <= max_x; x++) {
+				const float px = x + 0.5f;
+				float w0 = ((c.x - b.x) * (py - b.y) - (c.y - b.y) * (px - b.x)) * inv_area;
+				float w1 = ((a.x - c.x) * (py - c.y) - (a.y - c.y) * (px - c.x)) * inv_area;
+				float w2 = 1.0f - w0 - w1;
+				if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+					continue;
+				}
+
+				float inv_w = w0 * t.inv_w[0] + w1 * t.inv_w[1] + w2 * t.inv_w[2];
+				float d = (w0 * t.depth_over_w[0] + w1 * t.depth_over_w[1] + w2 * t.depth_over_w[2]) / inv_w;
+				if (d < row[x]) {
+					row[x] = d;
+				}
+			}
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(float p_z_far) {
+	ERR_FAIL_COND(is_empty());
+
+	debug_tex_range = p_z_far;
+
+	float *depth = mips[0];
+	const int pixel_count = sizes[0].x * sizes[0].y;
+	for (int i = 0; i < pixel_count; i++) {
+		depth[i] = FLT_MAX;
+	}
+
+	RasterThreadData td;
+	td.triangles = triangles.ptr();
+	td.triangle_count = triangles.size();
+	td.thread_count = MIN((uint32_t)sizes[0].y, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+
+	if (td.triangle_count > 64 && td.thread_count > 1) {
+		// Each thread owns a band of rows, so no two threads write the same pixel.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_raster_threaded, &td, td.thread_count, -1, true, SNAME("RasterOcclusionCull"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_raster_rows(&td, 0, sizes[0].y);
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance &instance = scenario->instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+	scenario->instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::_add_triangles(RasterHZBuffer &r_buffer, const Occluder *p_occluder, const Transform3D &p_view_xform, const Projection &p_cam_projection, real_t p_z_near) {
+	const Vector3 *vertices = p_occluder->vertices.ptr();
+	const int vertex_count = p_occluder->vertices.size();
+	const int32_t *indices = p_occluder->indices.ptr();
+	const int index_count = p_occluder->indices.size() - (p_occluder->indices.size() % 3);
+	const Size2 size = r_buffer.get_occlusion_buffer_size();
+
+	for (int i = 0; i < index_count; i += 3) {
+		// Clip the triangle against the near plane in view space, which leaves at most four vertices.
+		Vector3 tri[3];
+		bool valid = true;
+		for (int j = 0; j < 3; j++) {
+			int idx = indices[i + j];
+			if (idx < 0 || idx >= vertex_count) {
+				valid = false;
+				break;
+			}
+			tri[j] = p_view_xform.xform(vertices[idx]);
+		}
+		if (!valid) {
+			continue;
+		}
+
+		Vector3 clipped[4];
+		int clipped_count = 0;
+		for (int j = 0; j < 3; j++) {
+			const Vector3 &cur = tri[j];
+			const Vector3 &next = tri[(j + 1) % 3];
+			const real_t cur_d = -p_z_near - cur.z;
+			const real_t next_d = -p_z_near - next.z;
+			if (cur_d >= 0) {
+				clipped[clipped_count++] = cur;
+			}
+			if ((cur_d >= 0) != (next_d >= 0)) {
+				clipped[clipped_count++] = cur.lerp(next, cur_d / (cur_d - next_d));
+			}
+		}
+		if (clipped_count < 3) {
+			continue;
+		}
+
+		Vector2 screen[4];
+		float depth_over_w[4];
+		float inv_w[4];
+		for (int j = 0; j < clipped_count; j++) {
+			Plane projected = p_cam_projection.xform4(Plane(clipped[j], 1.0));
+			float w = MAX((float)projected.d, (float)CMP_EPSILON);
+			screen[j] = Vector2((projected.normal.x / w * 0.5f + 0.5f) * size.x, (projected.normal.y / w * 0.5f + 0.5f) * size.y);
+			inv_w[j] = 1.0f / w;
+			depth_over_w[j] = -clipped[j].z * inv_w[j];
+		}
+
+		for (int j = 1; j + 1 < clipped_count; j++) {
+			int fan[3] = { 0, j, j + 1 };
+			ScreenTriangle t;
+			float min_x = FLT_MAX;
+			float max_x = -FLT_MAX;
+			float min_y = FLT_MAX;
+			float max_y = -FLT_MAX;
+			for (int k = 0; k < 3; k++) {
+				t.v[k] = screen[fan[k]];
+				t.depth_over_w[k] = depth_over_w[fan[k]];
+				t.inv_w[k] = inv_w[fan[k]];
+				min_x = MIN(min_x, t.v[k].x);
+				max_x = MAX(max_x, t.v[k].x);
+				min_y = MIN(min_y, t.v[k].y);
+				max_y = MAX(max_y, t.v[k].y);
+			}
+			if (max_x < 0 || max_y < 0 || min_x >= size.x || min_y >= size.y) {
+				continue; // Off screen.
+			}
+			t.min_y = MAX(0, (int)Math::floor(min_y));
+			t.max_y = MIN((int)size.y - 1, (int)Math::ceil(max_y));
+			r_buffer.triangles.push_back(t);
+		}
+	}
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer) {
+		return;
+	}
+
+	const Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (buffer->is_empty() || !scenario) {
+		return;
+	}
+
+	const Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	const real_t z_near = p_cam_projection.get_z_near();
+
+	buffer->triangles.clear();
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		if (!E.value.enabled) {
+			continue;
+		}
+		const Occluder *occluder = occluder_owner.get_or_null(E.value.occluder);
+		if (!occluder) {
+			continue;
+		}
+		_add_triangles(*buffer, occluder, cam_inv_transform * E.value.xform, p_cam_projection, z_near);
+	}
+
+	buffer->rasterize(p_cam_projection.get_z_far());
+	buffer->update_mips();
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+RasterOcclusionCull::~RasterOcclusionCull() {
+	for (KeyValue<RID, RasterHZBuffer> &E : buffers) {
+		E.value.clear();
+	}
+}
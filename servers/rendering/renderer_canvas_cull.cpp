@@ -123,6 +123,178 @@ void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner, RID_Owner<Renderer
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+void RendererCanvasCull::_mark_subtree_rect_dirty(Item *p_item) {
+	Item *item = p_item;
+	while (item) {
+		Item *parent = canvas_item_owner.owns(item->parent) ? canvas_item_owner.get_or_null(item->parent) : nullptr;
+		if (parent && parent->child_bvh && !item->child_bvh_dirty) {
+			parent->child_bvh_dirty_items.push_back(item);
+			item->child_bvh_dirty = true;
+		}
+
+		if (item->subtree_rect_dirty) {
+			// Ancestors of a dirty item are always dirty too.
+			break;
+		}
+		item->subtree_rect_dirty = true;
+		item = parent;
+	}
+}
+
+bool RendererCanvasCull::_get_subtree_rect_in_parent(const Item *p_item, Rect2 &r_rect, bool &r_unbounded) const {
+	if (p_item->subtree_unbounded) {
+		r_unbounded = true;
+		return true;
+	}
+	if (p_item->subtree_empty) {
+		return false;
+	}
+
+	r_rect = p_item->xform_curr.xform(p_item->subtree_rect);
+
+	if (_interpolation_data.interpolation_enabled && p_item->interpolated && p_item->xform_prev != p_item->xform_curr) {
+		if (p_item->xform_prev.columns[0] != p_item->xform_curr.columns[0] || p_item->xform_prev.columns[1] != p_item->xform_curr.columns[1]) {
+			// Interpolating rotation or scale may sweep outside both rects.
+			r_unbounded = true;
+		} else {
+			r_rect = r_rect.merge(p_item->xform_prev.xform(p_item->subtree_rect));
+		}
+	}
+	return true;
+}
+
+void RendererCanvasCull::_remove_from_parent_bvh(Item *p_item, Item *p_parent) {
+	if (p_parent->child_bvh) {
+		if (p_item->child_bvh_id.is_valid()) {
+			p_parent->child_bvh->remove(p_item->child_bvh_id);
+		}
+		if (p_item->child_bvh_dirty) {
+			p_parent->child_bvh_dirty_items.erase(p_item);
+		}
+		if (p_item->child_bvh_unbounded) {
+			p_parent->child_bvh_unbounded_count--;
+		}
+	}
+
+	p_item->child_bvh_id = DynamicBVH::ID();
+	p_item->child_bvh_dirty = false;
+	p_item->child_bvh_unbounded = false;
+}
+
+void RendererCanvasCull::_free_child_bvh(Item *p_item) {
+	if (!p_item->child_bvh) {
+		return;
+	}
+
+	for (Item *child : p_item->child_items) {
+		child->child_bvh_id = DynamicBVH::ID();
+		child->child_bvh_dirty = false;
+		child->child_bvh_unbounded = false;
+	}
+
+	memdelete(p_item->child_bvh);
+	p_item->child_bvh = nullptr;
+	p_item->child_bvh_dirty_items.clear();
+	p_item->child_bvh_unbounded_count = 0;
+}
+
+void RendererCanvasCull::_update_subtree_rect(Item *p_item) {
+	if (!p_item->subtree_rect_dirty) {
+		return;
+	}
+	p_item->subtree_rect_dirty = false;
+
+	Rect2 rect;
+	bool empty = true;
+	bool unbounded = p_item->vp_render || p_item->copy_back_buffer || p_item->canvas_group || p_item->skeleton.is_valid() || (p_item->repeat_source && (p_item->repeat_size.x || p_item->repeat_size.y));
+
+	if (p_item->commands != nullptr || p_item->visibility_notifier) {
+		for (const Item::Command *c = p_item->commands; c && !unbounded; c = c->next) {
+			// These take their rect from storage, which can change without the item being notified.
+			unbounded = c->type == Item::Command::TYPE_MESH || c->type == Item::Command::TYPE_MULTIMESH || c->type == Item::Command::TYPE_PARTICLES;
+		}
+
+		rect = p_item->get_rect();
+		if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+			rect = rect.merge(p_item->visibility_notifier->area);
+		}
+		empty = false;
+	}
+
+	const int child_count = p_item->child_items.size();
+	if (!p_item->child_bvh && child_count >= CHILD_BVH_THRESHOLD) {
+		p_item->child_bvh = memnew(DynamicBVH);
+		for (Item *child : p_item->child_items) {
+			if (!child->child_bvh_dirty) {
+				p_item->child_bvh_dirty_items.push_back(child);
+				child->child_bvh_dirty = true;
+			}
+		}
+	} else if (p_item->child_bvh && child_count < CHILD_BVH_THRESHOLD / 2) {
+		_free_child_bvh(p_item);
+	}
+
+	if (p_item->child_bvh) {
+		for (Item *child : p_item->child_bvh_dirty_items) {
+			child->child_bvh_dirty = false;
+			_update_subtree_rect(child);
+
+			Rect2 child_rect;
+			bool child_unbounded = false;
+			bool has_rect = _get_subtree_rect_in_parent(child, child_rect, child_unbounded);
+
+			if (child->child_bvh_unbounded) {
+				p_item->child_bvh_unbounded_count--;
+			}
+			child->child_bvh_unbounded = has_rect && child_unbounded;
+			if (child->child_bvh_unbounded) {
+				// Still inserted, so queries always return it.
+				p_item->child_bvh_unbounded_count++;
+				child_rect = Rect2(-1e20, -1e20, 2e20, 2e20);
+			}
+
+			if (!has_rect) {
+				if (child->child_bvh_id.is_valid()) {
+					p_item->child_bvh->remove(child->child_bvh_id);
+					child->child_bvh_id = DynamicBVH::ID();
+				}
+				continue;
+			}
+
+			AABB aabb(Vector3(child_rect.position.x, child_rect.position.y, 0), Vector3(child_rect.size.x, child_rect.size.y, 0));
+			if (child->child_bvh_id.is_valid()) {
+				p_item->child_bvh->update(child->child_bvh_id, aabb);
+			} else {
+				child->child_bvh_id = p_item->child_bvh->insert(aabb, child);
+			}
+		}
+		p_item->child_bvh_dirty_items.clear();
+
+		if (p_item->child_bvh_unbounded_count > 0) {
+			unbounded = true;
+		} else if (!p_item->child_bvh->is_empty()) {
+			AABB bounds = p_item->child_bvh->get_bounds();
+			Rect2 children_rect(bounds.position.x, bounds.position.y, bounds.size.x, bounds.size.y);
+			rect = empty ? children_rect : rect.merge(children_rect);
+			empty = false;
+		}
+	} else {
+		for (Item *child : p_item->child_items) {
+			_update_subtree_rect(child);
+
+			Rect2 child_rect;
+			if (_get_subtree_rect_in_parent(child, child_rect, unbounded)) {
+				rect = empty ? child_rect : rect.merge(child_rect);
+				empty = false;
+			}
+		}
+	}
+
+	p_item->subtree_rect = rect;
+	p_item->subtree_empty = empty;
+	p_item->subtree_unbounded = unbounded;
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -293,6 +465,27 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	Rect2 global_rect = final_xform.xform(rect);
 	global_rect.position += p_clip_rect.position;
 
+	const bool repeating = repeat_size.x || repeat_size.y;
+
+	if (!repeating) {
+		_update_subtree_rect(ci);
+		if (!ci->subtree_unbounded) {
+			if (ci->subtree_empty) {
+				return;
+			}
+
+			// Nothing in the subtree can reach the screen, so skip it entirely.
+			Rect2 subtree_global_rect = final_xform.xform(ci->subtree_rect);
+			subtree_global_rect.position += p_clip_rect.position;
+			if (snapping_2d_transforms_to_pixel) {
+				subtree_global_rect = subtree_global_rect.grow(1.0);
+			}
+			if (!p_clip_rect.intersects(subtree_global_rect, true)) {
+				return;
+			}
+		}
+	}
+
 	if (ci->use_parent_material && p_material_owner) {
 		ci->material_owner = p_material_owner;
 	} else {
@@ -377,6 +570,28 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		// With many children, only visit the ones whose subtree reaches the screen.
+		LocalVector<Item *> visible_children;
+		if (ci->child_bvh && !repeating && final_xform.determinant() != 0) {
+			Rect2 local_clip = final_xform.affine_inverse().xform(Rect2(Point2(), p_clip_rect.size).grow(1.0));
+
+			struct ChildCullResult {
+				LocalVector<Item *> *items = nullptr;
+				_FORCE_INLINE_ bool operator()(void *p_data) {
+					items->push_back(static_cast<Item *>(p_data));
+					return false;
+				}
+			};
+
+			ChildCullResult result;
+			result.items = &visible_children;
+			ci->child_bvh->aabb_query(AABB(Vector3(local_clip.position.x, local_clip.position.y, -1), Vector3(local_clip.size.x, local_clip.size.y, 2)), result);
+			visible_children.sort_custom<ItemIndexSort>();
+
+			child_item_count = visible_children.size();
+			child_items = visible_children.ptr();
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -441,6 +656,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	canvas_item->repeat_source = true;
 	canvas_item->repeat_size = p_repeat_size;
 	canvas_item->repeat_times = p_repeat_times;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_set_modulate(RID p_canvas, const Color &p_color) {
@@ -479,6 +695,8 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 		} else if (canvas_item_owner.owns(canvas_item->parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 			item_owner->child_items.erase(canvas_item);
+			_remove_from_parent_bvh(canvas_item, item_owner);
+			_mark_subtree_rect_dirty(item_owner);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -510,6 +728,7 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	}
 
 	canvas_item->parent = p_parent;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visible(RID p_item, bool p_visible) {
@@ -542,6 +761,7 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	}
 
 	canvas_item->xform_curr = p_transform;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -578,6 +798,7 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_color) {
@@ -611,6 +832,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -840,6 +1062,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1110,6 +1333,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		}
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_mark_subtree_rect_dirty(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1152,6 +1376,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1316,6 +1541,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	static const int circle_segments = 64;
 
@@ -1407,6 +1633,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1438,6 +1665,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1472,6 +1700,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1504,6 +1733,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1545,6 +1775,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode, RS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1569,6 +1800,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1595,6 +1827,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1616,6 +1849,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1637,6 +1871,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1646,6 +1881,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1665,6 +1901,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1679,6 +1916,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1690,6 +1928,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
@@ -1699,6 +1938,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_animation_length, double p_slice_begin, double p_slice_end, double p_offset) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
@@ -1740,6 +1980,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 		return;
 	}
 	canvas_item->skeleton = p_skeleton;
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::Command *c = canvas_item->commands;
 
@@ -1777,6 +2018,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 		canvas_item->copy_back_buffer->rect = p_rect;
 		canvas_item->copy_back_buffer->full = p_rect == Rect2();
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
@@ -1784,6 +2026,7 @@ void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->clear();
+	_mark_subtree_rect_dirty(canvas_item);
 #ifdef DEBUG_ENABLED
 	if (debug_redraw) {
 		canvas_item->debug_redraw_time = debug_redraw_time;
@@ -1842,6 +2085,7 @@ void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_
 			canvas_item->visibility_notifier = nullptr;
 		}
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_debug_redraw(bool p_enabled) {
@@ -1857,12 +2101,14 @@ void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpo
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 	canvas_item->interpolated = p_interpolated;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 	canvas_item->xform_prev = canvas_item->xform_curr;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 // Useful especially for origin shifting.
@@ -1871,6 +2117,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 	ERR_FAIL_NULL(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
@@ -1892,6 +2139,7 @@ void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::Canva
 		canvas_item->canvas_group->blur_mipmaps = p_blur_mipmaps;
 		canvas_item->canvas_group->clear_margin = p_clear_margin;
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 RID RendererCanvasCull::canvas_light_allocate() {
@@ -2311,7 +2559,7 @@ void RendererCanvasCull::canvas_item_set_default_texture_repeat(RID p_item, RS::
 	ci->texture_repeat = p_repeat;
 }
 
-void RendererCanvasCull::update_visibility_notifiers() {
+void RendererCanvasCull::update_visibility_notifiers(LocalVector<Callable> &r_callbacks) {
 	SelfList<Item::VisibilityNotifierData> *E = visibility_notifier_list.first();
 	while (E) {
 		SelfList<Item::VisibilityNotifierData> *N = E->next();
@@ -2321,22 +2569,14 @@ void RendererCanvasCull::update_visibility_notifiers() {
 			visibility_notifier->just_visible = false;
 
 			if (visibility_notifier->enter_callable.is_valid()) {
-				if (RSG::threaded) {
-					visibility_notifier->enter_callable.call_deferred();
-				} else {
-					visibility_notifier->enter_callable.call();
-				}
+				r_callbacks.push_back(visibility_notifier->enter_callable);
 			}
 		} else {
 			if (visibility_notifier->visible_in_frame != RSG::rasterizer->get_frame_number()) {
 				visibility_notifier_list.remove(E);
 
 				if (visibility_notifier->exit_callable.is_valid()) {
-					if (RSG::threaded) {
-						visibility_notifier->exit_callable.call_deferred();
-					} else {
-						visibility_notifier->exit_callable.call();
-					}
+					r_callbacks.push_back(visibility_notifier->exit_callable);
 				}
 			}
 		}
@@ -2393,6 +2633,8 @@ bool RendererCanvasCull::free(RID p_rid) {
 			} else if (canvas_item_owner.owns(canvas_item->parent)) {
 				Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 				item_owner->child_items.erase(canvas_item);
+				_remove_from_parent_bvh(canvas_item, item_owner);
+				_mark_subtree_rect_dirty(item_owner);
 
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -2400,6 +2642,7 @@ bool RendererCanvasCull::free(RID p_rid) {
 			}
 		}
 
+		_free_child_bvh(canvas_item);
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
 			canvas_item->child_items[i]->parent = RID();
 		}
@@ -2530,6 +2773,22 @@ void RendererCanvasCull::update_interpolation_tick(bool p_process) {
 	SWAP(_interpolation_data.m_list_curr, _interpolation_data.m_list_prev);                  \
 	_interpolation_data.m_list_curr->clear();
 
+	// The previous transforms of these items are about to change, which changes their subtree rect in the parent.
+	for (const RID &rid : *_interpolation_data.canvas_item_transform_update_list_prev) {
+		Item *item = canvas_item_owner.get_or_null(rid);
+		if (item) {
+			_mark_subtree_rect_dirty(item);
+		}
+	}
+	if (p_process) {
+		for (const RID &rid : *_interpolation_data.canvas_item_transform_update_list_curr) {
+			Item *item = canvas_item_owner.get_or_null(rid);
+			if (item) {
+				_mark_subtree_rect_dirty(item);
+			}
+		}
+	}
+
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_item_transform_update_list_prev, canvas_item_transform_update_list_curr, Item, canvas_item_owner);
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_light_transform_update_list_prev, canvas_light_transform_update_list_curr, RendererCanvasRender::Light, canvas_light_owner);
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_light_occluder_transform_update_list_prev, canvas_light_occluder_transform_update_list_curr, RendererCanvasRender::LightOccluderInstance, canvas_light_occluder_owner);
@@ -31,6 +31,7 @@
 #ifndef RENDERER_CANVAS_CULL_H
 #define RENDERER_CANVAS_CULL_H
 
+#include "core/math/dynamic_bvh.h"
 #include "core/templates/paged_allocator.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
@@ -72,6 +73,23 @@ public:
 
 		VisibilityNotifierData *visibility_notifier = nullptr;
 
+		// Bounds of the item and all its descendants in the item's own space, so culling can skip whole subtrees.
+		// Unbounded subtrees contain something whose rect can't be tracked and are never skipped.
+		Rect2 subtree_rect;
+		bool subtree_rect_dirty = true;
+		bool subtree_empty = true;
+		bool subtree_unbounded = false;
+
+		// Items with many children keep them in a BVH, so only the visible ones are visited.
+		DynamicBVH *child_bvh = nullptr;
+		LocalVector<Item *> child_bvh_dirty_items;
+		uint32_t child_bvh_unbounded_count = 0;
+
+		// Entry in the parent's child BVH.
+		DynamicBVH::ID child_bvh_id;
+		bool child_bvh_dirty = false;
+		bool child_bvh_unbounded = false;
+
 		Item() {
 			children_order_dirty = true;
 			E = nullptr;
@@ -184,6 +202,14 @@ public:
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
 
+	static constexpr int CHILD_BVH_THRESHOLD = 64;
+
+	void _mark_subtree_rect_dirty(Item *p_item);
+	void _update_subtree_rect(Item *p_item);
+	bool _get_subtree_rect_in_parent(const Item *p_item, Rect2 &r_rect, bool &r_unbounded) const;
+	void _remove_from_parent_bvh(Item *p_item, Item *p_parent);
+	void _free_child_bvh(Item *p_item);
+
 	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from);
 
 private:
@@ -340,7 +366,7 @@ public:
 	void canvas_item_set_default_texture_filter(RID p_item, RS::CanvasItemTextureFilter p_filter);
 	void canvas_item_set_default_texture_repeat(RID p_item, RS::CanvasItemTextureRepeat p_repeat);
 
-	void update_visibility_notifiers();
+	void update_visibility_notifiers(LocalVector<Callable> &r_callbacks);
 
 	Rect2 _debug_canvas_item_get_rect(RID p_item);
 
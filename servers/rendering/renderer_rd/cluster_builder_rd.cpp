@@ -29,10 +29,13 @@
 /**************************************************************************/
 
 #include "cluster_builder_rd.h"
+#include "core/config/project_settings.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server_globals.h"
 
 ClusterBuilderSharedDataRD::ClusterBuilderSharedDataRD() {
+	use_compute_binning = GLOBAL_GET("rendering/limits/cluster_builder/use_compute_binning");
+
 	RD::VertexFormatID vertex_format;
 
 	{
@@ -74,6 +77,14 @@ ClusterBuilderSharedDataRD::ClusterBuilderSharedDataRD() {
 		ms.sample_count = RD::TEXTURE_SAMPLES_4;
 		cluster_render.shader_pipelines[ClusterRender::PIPELINE_MSAA] = RD::get_singleton()->render_pipeline_create(cluster_render.shader, fb_format, vertex_format, RD::RENDER_PRIMITIVE_TRIANGLES, rasterization_state, ms, RD::PipelineDepthStencilState(), blend_state, 0);
 	}
+	{
+		Vector<String> versions;
+		versions.push_back("");
+		cluster_bin.cluster_bin_shader.initialize(versions);
+		cluster_bin.shader_version = cluster_bin.cluster_bin_shader.version_create();
+		cluster_bin.shader = cluster_bin.cluster_bin_shader.version_get_shader(cluster_bin.shader_version, 0);
+		cluster_bin.shader_pipeline = RD::get_singleton()->compute_pipeline_create(cluster_bin.shader);
+	}
 	{
 		Vector<String> versions;
 		versions.push_back("");
@@ -228,6 +239,7 @@ ClusterBuilderSharedDataRD::~ClusterBuilderSharedDataRD() {
 	RD::get_singleton()->free(box_index_buffer);
 
 	cluster_render.cluster_render_shader.version_free(cluster_render.shader_version);
+	cluster_bin.cluster_bin_shader.version_free(cluster_bin.shader_version);
 	cluster_store.cluster_store_shader.version_free(cluster_store.shader_version);
 	cluster_debug.cluster_debug_shader.version_free(cluster_debug.shader_version);
 }
@@ -252,10 +264,13 @@ void ClusterBuilderRD::_clear() {
 	render_element_max = 0;
 	render_element_count = 0;
 
-	RD::get_singleton()->free(framebuffer);
-	framebuffer = RID();
+	if (framebuffer.is_valid()) {
+		RD::get_singleton()->free(framebuffer);
+		framebuffer = RID();
+	}
 
 	cluster_render_uniform_set = RID();
+	cluster_bin_uniform_set = RID();
 	cluster_store_uniform_set = RID();
 }
 
@@ -293,11 +308,13 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 
 	element_buffer = RD::get_singleton()->storage_buffer_create(sizeof(RenderElementData) * render_element_max);
 
-	uint32_t div_value = 1 << divisor;
-	if (use_msaa) {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
-	} else {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+	if (!shared->use_compute_binning) {
+		uint32_t div_value = 1 << divisor;
+		if (use_msaa) {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
+		} else {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+		}
 	}
 
 	{
@@ -324,7 +341,11 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 			uniforms.push_back(u);
 		}
 
-		cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		if (shared->use_compute_binning) {
+			cluster_bin_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_bin.shader, 0);
+		} else {
+			cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		}
 	}
 
 	{
@@ -448,10 +469,34 @@ void ClusterBuilderRD::bake_cluster() {
 
 		RD::get_singleton()->buffer_update(element_buffer, 0, sizeof(RenderElementData) * render_element_count, render_elements);
 
-		RENDER_TIMESTAMP("Render 3D Cluster Elements");
+		if (shared->use_compute_binning) {
+			RENDER_TIMESTAMP("Bin 3D Cluster Elements");
 
-		// Render elements.
-		{
+			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, shared->cluster_bin.shader_pipeline);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, cluster_bin_uniform_set, 0);
+
+			ClusterBuilderSharedDataRD::ClusterBin::PushConstant push_constant;
+			push_constant.cluster_screen_size[0] = cluster_screen_size.x;
+			push_constant.cluster_screen_size[1] = cluster_screen_size.y;
+			push_constant.cluster_ndc_size[0] = 2.0 * cluster_size / screen_size.x;
+			push_constant.cluster_ndc_size[1] = 2.0 * cluster_size / screen_size.y;
+			push_constant.render_element_count = render_element_count;
+			push_constant.z_near = z_near;
+			push_constant.orthogonal = camera_orthogonal;
+			push_constant.pad = 0;
+
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(ClusterBuilderSharedDataRD::ClusterBin::PushConstant));
+
+			// One workgroup per element, wrapped into rows to stay below the workgroup count limit.
+			const uint32_t groups_x = MIN(render_element_count, 65535u);
+			RD::get_singleton()->compute_list_dispatch(compute_list, groups_x, Math::division_round_up(render_element_count, groups_x), 1);
+
+			RD::get_singleton()->compute_list_end();
+		} else {
+			RENDER_TIMESTAMP("Render 3D Cluster Elements");
+
+			// Render elements.
 			RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD);
 			ClusterBuilderSharedDataRD::ClusterRender::PushConstant push_constant = {};
 
@@ -31,6 +31,7 @@
 #ifndef CLUSTER_BUILDER_RD_H
 #define CLUSTER_BUILDER_RD_H
 
+#include "servers/rendering/renderer_rd/shaders/cluster_bin.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_debug.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_render.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_store.glsl.gen.h"
@@ -83,6 +84,26 @@ class ClusterBuilderSharedDataRD {
 		RID shader_pipelines[PIPELINE_MAX];
 	} cluster_render;
 
+	// Assigns elements to clusters with a compute pass instead of rasterizing their proxy meshes.
+	bool use_compute_binning = true;
+
+	struct ClusterBin {
+		struct PushConstant {
+			uint32_t cluster_screen_size[2];
+			float cluster_ndc_size[2];
+
+			uint32_t render_element_count;
+			float z_near;
+			uint32_t orthogonal;
+			uint32_t pad;
+		};
+
+		ClusterBinShaderRD cluster_bin_shader;
+		RID shader_version;
+		RID shader;
+		RID shader_pipeline;
+	} cluster_bin;
+
 	struct ClusterStore {
 		struct PushConstant {
 			uint32_t cluster_render_data_size; // how much data for a single cluster takes
@@ -199,6 +220,7 @@ private:
 	uint32_t cluster_buffer_size = 0;
 
 	RID cluster_render_uniform_set;
+	RID cluster_bin_uniform_set;
 	RID cluster_store_uniform_set;
 
 	// Persistent data.
@@ -63,10 +63,29 @@ VRS::VRS() {
 			}
 		}
 	}
+
+	{
+		Vector<String> vrs_adaptive_modes;
+		vrs_adaptive_modes.push_back("\n");
+
+		vrs_adaptive_shader.shader.initialize(vrs_adaptive_modes);
+		vrs_adaptive_shader.shader_version = vrs_adaptive_shader.shader.version_create();
+		vrs_adaptive_shader.pipeline = RD::get_singleton()->compute_pipeline_create(vrs_adaptive_shader.shader.version_get_shader(vrs_adaptive_shader.shader_version, 0));
+	}
 }
 
 VRS::~VRS() {
 	vrs_shader.shader.version_free(vrs_shader.shader_version);
+	vrs_adaptive_shader.shader.version_free(vrs_adaptive_shader.shader_version);
+}
+
+float VRS::_get_max_texel_factor() const {
+	// Set maximum texel factor based on maximum fragment size, some GPUs do not support 8x8 (fragment shading rate approach).
+	if (MIN(RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_WIDTH), RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_HEIGHT)) > 4) {
+		return 3.0;
+	} else {
+		return 2.0;
+	}
 }
 
 void VRS::copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multiview) {
@@ -84,12 +103,7 @@ void VRS::copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multi
 
 	int mode = p_multiview ? VRS_MULTIVIEW : VRS_DEFAULT;
 
-	// Set maximum texel factor based on maximum fragment size, some GPUs do not support 8x8 (fragment shading rate approach).
-	if (MIN(RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_WIDTH), RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_HEIGHT)) > 4) {
-		push_constant.max_texel_factor = 3.0;
-	} else {
-		push_constant.max_texel_factor = 2.0;
-	}
+	push_constant.max_texel_factor = _get_max_texel_factor();
 
 	RID shader = vrs_shader.shader.version_get_shader(vrs_shader.shader_version, mode);
 	ERR_FAIL_COND(shader.is_null());
@@ -102,6 +116,49 @@ void VRS::copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multi
 	RD::get_singleton()->draw_list_end();
 }
 
+void VRS::update_adaptive_vrs_texture(RID p_vrs_texture, RID p_source_color, RID p_source_velocity, const Size2i &p_source_size) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+
+	Size2i vrs_size = get_vrs_texture_size(p_source_size);
+
+	VRSAdaptivePushConstant push_constant = {};
+	push_constant.vrs_size[0] = vrs_size.x;
+	push_constant.vrs_size[1] = vrs_size.y;
+	push_constant.texel_size[0] = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_WIDTH);
+	push_constant.texel_size[1] = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_HEIGHT);
+	push_constant.pixel_size[0] = 1.0 / p_source_size.x;
+	push_constant.pixel_size[1] = 1.0 / p_source_size.y;
+	push_constant.max_texel_factor = _get_max_texel_factor();
+	push_constant.use_velocity = p_source_velocity.is_valid();
+	push_constant.motion_threshold = adaptive_motion_threshold;
+	push_constant.contrast_threshold = adaptive_contrast_threshold;
+
+	RID velocity = p_source_velocity;
+	if (velocity.is_null()) {
+		velocity = TextureStorage::get_singleton()->texture_rd_get_default(TextureStorage::DEFAULT_RD_TEXTURE_BLACK);
+	}
+
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::Uniform u_source_color(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, p_source_color }));
+	RD::Uniform u_source_velocity(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, Vector<RID>({ default_sampler, velocity }));
+	RD::Uniform u_dest_vrs(RD::UNIFORM_TYPE_IMAGE, 0, p_vrs_texture);
+
+	RID shader = vrs_adaptive_shader.shader.version_get_shader(vrs_adaptive_shader.shader_version, 0);
+	ERR_FAIL_COND(shader.is_null());
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, vrs_adaptive_shader.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source_color, u_source_velocity), 0);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 1, u_dest_vrs), 1);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(VRSAdaptivePushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, vrs_size.x, vrs_size.y, 1);
+	RD::get_singleton()->compute_list_end();
+}
+
 Size2i VRS::get_vrs_texture_size(const Size2i p_base_size) const {
 	int32_t texel_width = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_WIDTH);
 	int32_t texel_height = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_HEIGHT);
@@ -33,6 +33,7 @@
 
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/shaders/effects/vrs.glsl.gen.h"
+#include "servers/rendering/renderer_rd/shaders/effects/vrs_adaptive.glsl.gen.h"
 #include "servers/rendering/renderer_scene_render.h"
 
 #include "servers/rendering_server.h"
@@ -61,6 +62,32 @@ private:
 		PipelineCacheRD pipelines[VRS_MAX];
 	} vrs_shader;
 
+	struct VRSAdaptivePushConstant {
+		int32_t vrs_size[2];
+		int32_t texel_size[2];
+
+		float pixel_size[2];
+		float max_texel_factor;
+		uint32_t use_velocity;
+
+		float motion_threshold;
+		float contrast_threshold;
+		float pad[2];
+	};
+
+	struct VRSAdaptiveShader {
+		VrsAdaptiveShaderRD shader;
+		RID shader_version;
+		RID pipeline;
+	} vrs_adaptive_shader;
+
+	// Motion in pixels per frame from which shading rate is halved, and the
+	// relative luminance deviation under which a tile is considered flat.
+	float adaptive_motion_threshold = 2.0;
+	float adaptive_contrast_threshold = 0.08;
+
+	float _get_max_texel_factor() const;
+
 public:
 	VRS();
 	~VRS();
@@ -69,6 +96,7 @@ public:
 
 	Size2i get_vrs_texture_size(const Size2i p_base_size) const;
 	void update_vrs_texture(RID p_vrs_fb, RID p_render_target);
+	void update_adaptive_vrs_texture(RID p_vrs_texture, RID p_source_color, RID p_source_velocity, const Size2i &p_source_size);
 };
 
 } // namespace RendererRD
@@ -1189,8 +1189,24 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
-	for (SDFGI::Cascade &cascade : cascades) {
-		cascade.dirty_regions = Vector3i();
+	// Revoxelizing a cascade is the most expensive part of SDFGI, so only a few cascades may scroll
+	// in the same frame. The ones that waited the longest go first, then the closest ones; the rest
+	// keep their position and are considered again on the next frame.
+	LocalVector<uint32_t> scroll_order;
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		cascades[i].dirty_regions = Vector3i();
+
+		uint32_t insert_at = scroll_order.size();
+		while (insert_at > 0 && cascades[scroll_order[insert_at - 1]].scroll_wait_frames < cascades[i].scroll_wait_frames) {
+			insert_at--;
+		}
+		scroll_order.insert(insert_at, i);
+	}
+
+	uint32_t scrolls_left = gi->sdfgi_max_cascade_scrolls_per_frame;
+
+	for (uint32_t cascade_index : scroll_order) {
+		SDFGI::Cascade &cascade = cascades[cascade_index];
 
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
@@ -1199,29 +1215,47 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 		world_position.y *= y_mult;
 		Vector3i pos_in_cascade = Vector3i((world_position + probe_half_size) / cascade.cell_size);
 
+		Vector3i position = cascade.position;
+		Vector3i dirty_regions;
+
 		for (int j = 0; j < 3; j++) {
-			if (pos_in_cascade[j] < cascade.position[j]) {
-				while (pos_in_cascade[j] < (cascade.position[j] - drag_margin)) {
-					cascade.position[j] -= drag_margin * 2;
-					cascade.dirty_regions[j] += drag_margin * 2;
+			if (pos_in_cascade[j] < position[j]) {
+				while (pos_in_cascade[j] < (position[j] - drag_margin)) {
+					position[j] -= drag_margin * 2;
+					dirty_regions[j] += drag_margin * 2;
 				}
-			} else if (pos_in_cascade[j] > cascade.position[j]) {
-				while (pos_in_cascade[j] > (cascade.position[j] + drag_margin)) {
-					cascade.position[j] += drag_margin * 2;
-					cascade.dirty_regions[j] -= drag_margin * 2;
+			} else if (pos_in_cascade[j] > position[j]) {
+				while (pos_in_cascade[j] > (position[j] + drag_margin)) {
+					position[j] += drag_margin * 2;
+					dirty_regions[j] -= drag_margin * 2;
 				}
 			}
 
-			if (cascade.dirty_regions[j] == 0) {
+			if (dirty_regions[j] == 0) {
 				continue; // not dirty
-			} else if (uint32_t(ABS(cascade.dirty_regions[j])) >= cascade_size) {
+			} else if (uint32_t(ABS(dirty_regions[j])) >= cascade_size) {
 				//moved too much, just redraw everything (make all dirty)
-				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_regions = SDFGI::Cascade::DIRTY_ALL;
 				break;
 			}
 		}
 
-		if (cascade.dirty_regions != Vector3i() && cascade.dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
+		if (dirty_regions == Vector3i()) {
+			cascade.scroll_wait_frames = 0;
+			continue;
+		}
+
+		if (scrolls_left == 0) {
+			cascade.scroll_wait_frames++;
+			continue;
+		}
+
+		scrolls_left--;
+		cascade.scroll_wait_frames = 0;
+		cascade.position = position;
+		cascade.dirty_regions = dirty_regions;
+
+		if (cascade.dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
 			//see how much the total dirty volume represents from the total volume
 			uint32_t total_volume = cascade_size * cascade_size * cascade_size;
 			uint32_t safe_volume = 1;
@@ -3354,6 +3388,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_max_cascade_scrolls_per_frame = MAX(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/max_cascade_scrolls_per_frame")), 1);
 }
 
 GI::~GI() {
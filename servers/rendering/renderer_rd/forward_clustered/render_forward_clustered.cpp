@@ -1286,7 +1286,7 @@ void RenderForwardClustered::_process_ssao(Ref<RenderSceneBuffersRD> p_render_bu
 	Ref<RenderBufferDataForwardClustered> rb_data = p_render_buffers->get_custom_data(RB_SCOPE_FORWARD_CLUSTERED);
 	ERR_FAIL_COND(rb_data.is_null());
 
-	RENDER_TIMESTAMP("Process SSAO");
+	RENDER_TIMESTAMP("> Process SSAO");
 
 	RendererRD::SSEffects::SSAOSettings settings;
 	settings.radius = environment_get_ssao_radius(p_environment);
@@ -1302,6 +1302,8 @@ void RenderForwardClustered::_process_ssao(Ref<RenderSceneBuffersRD> p_render_bu
 	for (uint32_t v = 0; v < p_render_buffers->get_view_count(); v++) {
 		ss_effects->generate_ssao(p_render_buffers, rb_data->ss_effects_data.ssao, v, p_normal_buffers[v], p_projections[v], settings);
 	}
+
+	RENDER_TIMESTAMP("< Process SSAO");
 }
 
 void RenderForwardClustered::_process_ssil(Ref<RenderSceneBuffersRD> p_render_buffers, RID p_environment, const RID *p_normal_buffers, const Projection *p_projections, const Transform3D &p_transform) {
@@ -1312,7 +1314,7 @@ void RenderForwardClustered::_process_ssil(Ref<RenderSceneBuffersRD> p_render_bu
 	Ref<RenderBufferDataForwardClustered> rb_data = p_render_buffers->get_custom_data(RB_SCOPE_FORWARD_CLUSTERED);
 	ERR_FAIL_COND(rb_data.is_null());
 
-	RENDER_TIMESTAMP("Process SSIL");
+	RENDER_TIMESTAMP("> Process SSIL");
 
 	RendererRD::SSEffects::SSILSettings settings;
 	settings.radius = environment_get_ssil_radius(p_environment);
@@ -1337,6 +1339,8 @@ void RenderForwardClustered::_process_ssil(Ref<RenderSceneBuffersRD> p_render_bu
 		rb_data->ss_effects_data.last_frame_projections[v] = projection;
 	}
 	rb_data->ss_effects_data.last_frame_transform = transform;
+
+	RENDER_TIMESTAMP("< Process SSIL");
 }
 
 void RenderForwardClustered::_copy_framebuffer_to_ssil(Ref<RenderSceneBuffersRD> p_render_buffers) {
@@ -1444,7 +1448,8 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		}
 		//render positional shadows
 		for (uint32_t i = 0; i < p_render_data->shadows.size(); i++) {
-			_render_shadow_pass(p_render_data->render_shadows[p_render_data->shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->shadows[i]].pass, p_render_data->render_shadows[p_render_data->shadows[i]].instances, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, p_render_data->render_info, viewport_size, p_render_data->scene_data->cam_transform);
+			const RenderShadowData &shadow_data = p_render_data->render_shadows[p_render_data->shadows[i]];
+			_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, p_render_data->render_info, viewport_size, p_render_data->scene_data->cam_transform, &shadow_data.static_instances, shadow_data.static_version);
 		}
 
 		_render_shadow_process();
@@ -1480,7 +1485,7 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		}
 	}
 
-	RENDER_TIMESTAMP("Pre Opaque Render");
+	RENDER_TIMESTAMP("Update Light Buffers");
 
 	if (current_cluster_builder) {
 		// Note: when rendering stereoscopic (multiview) we are using our combined frustum projection to create
@@ -1644,6 +1649,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	bool using_debug_mvs = get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS;
 	bool using_taa = rb->get_use_taa();
 	bool using_fsr2 = rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR2;
+	bool using_adaptive_vrs = vrs && rb->get_render_target().is_valid() && RendererRD::TextureStorage::get_singleton()->render_target_get_vrs_mode(rb->get_render_target()) == RS::VIEWPORT_VRS_ADAPTIVE;
 
 	// check if we need motion vectors
 	bool motion_vectors_required;
@@ -1655,6 +1661,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		motion_vectors_required = true;
 	} else if (!is_reflection_probe && using_fsr2) {
 		motion_vectors_required = true;
+	} else if (!is_reflection_probe && using_adaptive_vrs) {
+		motion_vectors_required = true;
 	} else {
 		motion_vectors_required = false;
 	}
@@ -1926,6 +1934,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	bool using_ssao = depth_pre_pass && !is_reflection_probe && p_render_data->environment.is_valid() && environment_get_ssao_enabled(p_render_data->environment);
 
 	if (depth_pre_pass) { //depth pre pass
+		RENDER_TIMESTAMP("> Depth Pre-Pass");
+
 		bool needs_pre_resolve = _needs_post_prepass_render(p_render_data, using_sdfgi || using_voxelgi);
 		if (needs_pre_resolve) {
 			RENDER_TIMESTAMP("GI + Render Depth Pre-Pass (Parallel)");
@@ -1964,6 +1974,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			}
 			RD::get_singleton()->draw_command_end_label();
 		}
+
+		RENDER_TIMESTAMP("< Depth Pre-Pass");
 	}
 
 	{
@@ -1987,9 +1999,11 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			normal_roughness_views[v] = rb_data->get_normal_roughness(v);
 		}
 	}
+	RENDER_TIMESTAMP("> Pre Opaque Render");
 	_pre_opaque_render(p_render_data, using_ssao, using_ssil, using_sdfgi || using_voxelgi, normal_roughness_views, rb_data.is_valid() && rb_data->has_voxelgi() ? rb_data->get_voxelgi() : RID());
+	RENDER_TIMESTAMP("< Pre Opaque Render");
 
-	RENDER_TIMESTAMP("Render Opaque Pass");
+	RENDER_TIMESTAMP("> Render Opaque Pass");
 
 	RD::get_singleton()->draw_command_begin_label("Render Opaque Pass");
 
@@ -2051,6 +2065,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		}
 	}
 
+	RENDER_TIMESTAMP("< Render Opaque Pass");
+
 	{
 		if (ce_post_opaque_resolved_color) {
 			for (uint32_t v = 0; v < rb->get_view_count(); v++) {
@@ -2131,6 +2147,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	}
 
 	if (using_separate_specular) {
+		RENDER_TIMESTAMP("> Separate Specular");
+
 		if (using_sss) {
 			RENDER_TIMESTAMP("Sub-Surface Scattering");
 			RD::get_singleton()->draw_command_begin_label("Process Sub-Surface Scattering");
@@ -2152,6 +2170,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			RENDER_TIMESTAMP("Merge Specular");
 			copy_effects->merge_specular(color_only_framebuffer, rb_data->get_specular(), !use_msaa ? RID() : rb->get_internal_texture(), RID(), p_render_data->scene_data->view_count);
 		}
+
+		RENDER_TIMESTAMP("< Separate Specular");
 	}
 
 	if (using_separate_specular && is_environment(p_render_data->environment) && (environment_get_background(p_render_data->environment) == RS::ENV_BG_CANVAS)) {
@@ -2207,7 +2227,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		_process_compositor_effects(RS::COMPOSITOR_EFFECT_CALLBACK_TYPE_PRE_TRANSPARENT, p_render_data);
 	}
 
-	RENDER_TIMESTAMP("Render 3D Transparent Pass");
+	RENDER_TIMESTAMP("> Render 3D Transparent Pass");
 
 	RD::get_singleton()->draw_command_begin_label("Render 3D Transparent Pass");
 
@@ -2229,12 +2249,14 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 	RD::get_singleton()->draw_command_end_label();
 
+	RENDER_TIMESTAMP("< Render 3D Transparent Pass");
+
 	RENDER_TIMESTAMP("Resolve");
 
 	RD::get_singleton()->draw_command_begin_label("Resolve");
 
 	if (rb_data.is_valid() && use_msaa) {
-		bool resolve_velocity_buffer = (using_taa || using_fsr2 || ce_needs_motion_vectors) && rb->has_velocity_buffer(true);
+		bool resolve_velocity_buffer = (using_taa || using_fsr2 || using_adaptive_vrs || ce_needs_motion_vectors) && rb->has_velocity_buffer(true);
 		for (uint32_t v = 0; v < rb->get_view_count(); v++) {
 			RD::get_singleton()->texture_resolve_multisample(rb->get_color_msaa(v), rb->get_internal_texture(v));
 			resolve_effects->resolve_depth(rb->get_depth_msaa(v), rb->get_depth_texture(v), rb->get_internal_size(), texture_multisamples[msaa]);
@@ -2259,6 +2281,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	}
 	RD::get_singleton()->draw_command_end_label();
 
+	RENDER_TIMESTAMP("> Post Process");
+
 	if (rb_data.is_valid() && (using_fsr2 || using_taa)) {
 		if (using_fsr2) {
 			rb_data->ensure_fsr2(fsr2_effect);
@@ -2322,6 +2346,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		_render_buffers_post_process_and_tonemap(p_render_data);
 	}
 
+	RENDER_TIMESTAMP("< Post Process");
+
 	if (rb_data.is_valid()) {
 		_render_buffers_debug_draw(p_render_data);
 
@@ -2374,7 +2400,7 @@ void RenderForwardClustered::_render_buffers_debug_draw(const RenderDataRD *p_re
 	}
 }
 
-void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RenderingMethod::RenderInfo *p_render_info, const Size2i &p_viewport_size, const Transform3D &p_main_cam_transform) {
+void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RenderingMethod::RenderInfo *p_render_info, const Size2i &p_viewport_size, const Transform3D &p_main_cam_transform, const PagedArray<RenderGeometryInstance *> *p_static_instances, uint64_t p_static_version) {
 	RendererRD::LightStorage *light_storage = RendererRD::LightStorage::get_singleton();
 
 	ERR_FAIL_COND(!light_storage->owns_light_instance(p_light));
@@ -2545,6 +2571,23 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 			light_storage->light_instance_set_shadow_transform(p_light, Projection(), light_storage->light_instance_get_base_transform(p_light), zfar, 0, 0, 0);
 		}
 
+	} else if (p_static_version != 0 && p_static_instances && p_shadow_atlas.is_valid() && render_fb == light_storage->shadow_atlas_get_fb(p_shadow_atlas)) {
+		// Static casters are cached in a second atlas and only redrawn when they change,
+		// the cached region is copied back before the dynamic casters are drawn on top.
+		RID static_fb = light_storage->shadow_atlas_get_static_fb(p_shadow_atlas);
+		if (light_storage->shadow_atlas_get_light_instance_static_version(p_shadow_atlas, p_light) != p_static_version) {
+			_render_shadow_append(static_fb, *p_static_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, true, false, false, p_render_info, p_viewport_size, p_main_cam_transform);
+
+			// Both paraboloid halves share the slot, so it is only marked up to date after the last one.
+			if (!using_dual_paraboloid || using_dual_paraboloid_flip) {
+				light_storage->shadow_atlas_set_light_instance_static_version(p_shadow_atlas, p_light, p_static_version);
+			}
+		}
+
+		_render_shadow_append(render_fb, p_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, false, false, p_close_pass, p_render_info, p_viewport_size, p_main_cam_transform);
+		SceneState::ShadowPass &shadow_pass = scene_state.shadow_passes[scene_state.shadow_passes.size() - 1];
+		shadow_pass.static_texture = light_storage->shadow_atlas_get_static_texture(p_shadow_atlas);
+		shadow_pass.atlas_texture = light_storage->shadow_atlas_get_texture(p_shadow_atlas);
 	} else {
 		//render shadow
 		_render_shadow_append(render_fb, p_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, p_clear_region, p_open_pass, p_close_pass, p_render_info, p_viewport_size, p_main_cam_transform);
@@ -2646,6 +2689,11 @@ void RenderForwardClustered::_render_shadow_end() {
 	RD::get_singleton()->draw_command_begin_label("Shadow Render");
 
 	for (SceneState::ShadowPass &shadow_pass : scene_state.shadow_passes) {
+		if (shadow_pass.static_texture.is_valid()) {
+			const Vector3 rect_position = Vector3(shadow_pass.rect.position.x, shadow_pass.rect.position.y, 0);
+			RD::get_singleton()->texture_copy(shadow_pass.static_texture, shadow_pass.atlas_texture, rect_position, rect_position, Vector3(shadow_pass.rect.size.x, shadow_pass.rect.size.y, 1), 0, 0, 0, 0);
+		}
+
 		RenderListParameters render_list_parameters(render_list[RENDER_LIST_SECONDARY].elements.ptr() + shadow_pass.element_from, render_list[RENDER_LIST_SECONDARY].element_info.ptr() + shadow_pass.element_from, shadow_pass.element_count, shadow_pass.flip_cull, shadow_pass.pass_mode, 0, true, false, shadow_pass.rp_uniform_set, false, Vector2(), shadow_pass.lod_distance_multiplier, shadow_pass.screen_mesh_lod_threshold, 1, shadow_pass.element_from);
 		_render_list_with_draw_list(&render_list_parameters, shadow_pass.framebuffer, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, shadow_pass.initial_depth_action, RD::FINAL_ACTION_STORE, Vector<Color>(), 0.0, 0, shadow_pass.rect);
 	}
@@ -2917,6 +2965,11 @@ void RenderForwardClustered::base_uniforms_changed() {
 	render_base_uniform_set = RID();
 }
 
+void RenderForwardClustered::update() {
+	RendererSceneRenderRD::update();
+	scene_shader.update_compiling_shaders();
+}
+
 void RenderForwardClustered::_update_render_base_uniform_set() {
 	RendererRD::LightStorage *light_storage = RendererRD::LightStorage::get_singleton();
 
@@ -3859,7 +3912,7 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material_chain(
 	SceneShaderForwardClustered::MaterialData *material = p_material;
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
-	_geometry_instance_add_surface_with_material(ginstance, p_surface, material, p_mat_src.get_local_index(), material_storage->material_get_shader_id(p_mat_src), p_mesh);
+	_geometry_instance_add_surface_with_material(ginstance, p_surface, material, material->get_sort_id(), material_storage->material_get_shader_id(p_mat_src), p_mesh);
 
 	while (material->next_pass.is_valid()) {
 		RID next_pass = material->next_pass;
@@ -3870,7 +3923,7 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material_chain(
 		if (ginstance->data->dirty_dependencies) {
 			material_storage->material_update_dependency(next_pass, &ginstance->data->dependency_tracker);
 		}
-		_geometry_instance_add_surface_with_material(ginstance, p_surface, material, next_pass.get_local_index(), material_storage->material_get_shader_id(next_pass), p_mesh);
+		_geometry_instance_add_surface_with_material(ginstance, p_surface, material, material->get_sort_id(), material_storage->material_get_shader_id(next_pass), p_mesh);
 	}
 }
 
@@ -4250,6 +4303,9 @@ void RenderForwardClustered::_update_shader_quality_settings() {
 RenderForwardClustered::RenderForwardClustered() {
 	singleton = this;
 
+	// Direct3D 12 can only copy whole depth subresources, which the cached atlas regions are not.
+	positional_shadow_static_cache = GLOBAL_GET("rendering/lights_and_shadows/positional_shadow/static_cache") && RD::get_singleton()->get_device_api_name() != "D3D12";
+
 	/* SCENE SHADER */
 
 	{
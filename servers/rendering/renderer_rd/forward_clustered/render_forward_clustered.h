@@ -32,6 +32,8 @@
 #define RENDER_FORWARD_CLUSTERED_H
 
 #include "core/templates/paged_allocator.h"
+#include "core/templates/parallel_sort_array.h"
+#include "core/templates/radix_sort.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
 #include "servers/rendering/renderer_rd/effects/fsr2.h"
 #include "servers/rendering/renderer_rd/effects/resolve.h"
@@ -353,6 +355,10 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			RID framebuffer;
 			RD::InitialAction initial_depth_action;
 			Rect2i rect;
+
+			// When valid, the region is first restored from the cached static casters.
+			RID static_texture;
+			RID atlas_texture;
 		};
 
 		LocalVector<ShadowPass> shadow_passes;
@@ -520,7 +526,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			element_info.clear();
 		}
 
-		//should eventually be replaced by radix
+		// Below this size introsort beats the radix passes.
+		static constexpr uint32_t RADIX_SORT_THRESHOLD = 256;
 
 		struct SortByKey {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
@@ -528,14 +535,35 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			}
 		};
 
-		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
-		}
+		struct SortKey1 {
+			_FORCE_INLINE_ uint64_t operator()(const GeometryInstanceSurfaceDataCache *A) const { return A->sort.sort_key1; }
+		};
+		struct SortKey2 {
+			_FORCE_INLINE_ uint64_t operator()(const GeometryInstanceSurfaceDataCache *A) const { return A->sort.sort_key2; }
+		};
+
+		// The 128-bit key takes up to 16 radix passes, so very large lists are
+		// better served by a merge sort across the worker threads.
+		ParallelSortArray<GeometryInstanceSurfaceDataCache *, SortByKey> parallel_key_sorter;
+		RadixSort<GeometryInstanceSurfaceDataCache *, SortKey1> key1_sorter;
+		RadixSort<GeometryInstanceSurfaceDataCache *, SortKey2> key2_sorter;
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr() + p_from, p_size);
+			GeometryInstanceSurfaceDataCache **ptr = elements.ptr() + p_from;
+			if (p_size >= parallel_key_sorter.min_parallel_size) {
+				parallel_key_sorter.sort(ptr, p_size);
+			} else if (p_size >= RADIX_SORT_THRESHOLD) {
+				// LSD order: the minor key first, then a stable pass on the major key.
+				key1_sorter.sort(ptr, p_size);
+				key2_sorter.sort(ptr, p_size);
+			} else {
+				SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
+				sorter.sort(ptr, p_size);
+			}
+		}
+
+		void sort_by_key() {
+			sort_by_key_range(0, elements.size());
 		}
 
 		struct SortByDepth {
@@ -544,8 +572,16 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			}
 		};
 
-		void sort_by_depth() { //used for shadows
+		struct DepthKey {
+			_FORCE_INLINE_ uint32_t operator()(const GeometryInstanceSurfaceDataCache *A) const { return RadixSortKey::from_float(A->owner->depth); }
+		};
+		RadixSort<GeometryInstanceSurfaceDataCache *, DepthKey> depth_sorter;
 
+		void sort_by_depth() { //used for shadows
+			if (elements.size() >= RADIX_SORT_THRESHOLD) {
+				depth_sorter.sort(elements.ptr(), elements.size());
+				return;
+			}
 			SortArray<GeometryInstanceSurfaceDataCache *, SortByDepth> sorter;
 			sorter.sort(elements.ptr(), elements.size());
 		}
@@ -556,8 +592,18 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			}
 		};
 
-		void sort_by_reverse_depth_and_priority() { //used for alpha
+		struct ReverseDepthAndPriorityKey {
+			_FORCE_INLINE_ uint64_t operator()(const GeometryInstanceSurfaceDataCache *A) const {
+				return (uint64_t(A->sort.priority) << 32) | uint64_t(~RadixSortKey::from_float(A->owner->depth));
+			}
+		};
+		RadixSort<GeometryInstanceSurfaceDataCache *, ReverseDepthAndPriorityKey> reverse_depth_sorter;
 
+		void sort_by_reverse_depth_and_priority() { //used for alpha
+			if (elements.size() >= RADIX_SORT_THRESHOLD) {
+				reverse_depth_sorter.sort(elements.ptr(), elements.size());
+				return;
+			}
 			SortArray<GeometryInstanceSurfaceDataCache *, SortByReverseDepthAndPriority> sorter;
 			sorter.sort(elements.ptr(), elements.size());
 		}
@@ -593,7 +639,9 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	/* Render shadows */
 
-	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
+	bool positional_shadow_static_cache = false;
+
+	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D(), const PagedArray<RenderGeometryInstance *> *p_static_instances = nullptr, uint64_t p_static_version = 0);
 	void _render_shadow_begin();
 	void _render_shadow_append(RID p_framebuffer, const PagedArray<RenderGeometryInstance *> &p_instances, const Projection &p_projection, const Transform3D &p_transform, float p_zfar, float p_bias, float p_normal_bias, bool p_reverse_cull_face, bool p_use_dp, bool p_use_dp_flip, bool p_use_pancake, float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, const Rect2i &p_rect = Rect2i(), bool p_flip_y = false, bool p_clear_region = true, bool p_begin = true, bool p_end = true, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
 	void _render_shadow_process();
@@ -646,6 +694,8 @@ public:
 
 	virtual void base_uniforms_changed() override;
 
+	virtual void update() override;
+
 	/* SDFGI UPDATE */
 
 	virtual void sdfgi_update(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_environment, const Vector3 &p_world_position) override;
@@ -663,6 +713,8 @@ public:
 
 	virtual bool free(RID p_rid) override;
 
+	virtual bool is_positional_shadow_static_cache_enabled() const override { return positional_shadow_static_cache; }
+
 	RenderForwardClustered();
 	~RenderForwardClustered();
 };
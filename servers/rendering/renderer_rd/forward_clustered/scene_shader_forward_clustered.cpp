@@ -45,15 +45,21 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	ubo_size = 0;
 	uniforms.clear();
 
+	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
+	if (compiling_list_element.in_list()) {
+		// The new code replaces whatever was still compiling.
+		shader_singleton->compiling_shader_list.remove(&compiling_list_element);
+	}
+
 	if (code.is_empty()) {
 		return; //just invalid, but no error
 	}
 
 	ShaderCompiler::GeneratedCode gen_code;
 
-	int blend_mode = BLEND_MODE_MIX;
+	blend_mode = BLEND_MODE_MIX;
 	int depth_testi = DEPTH_TEST_ENABLED;
-	int alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF;
+	alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF;
 	int cull_modei = CULL_BACK;
 
 	uses_point_size = false;
@@ -67,7 +73,7 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	uses_normal = false;
 	uses_tangent = false;
 	bool uses_normal_map = false;
-	bool wireframe = false;
+	wireframe = false;
 
 	unshaded = false;
 	uses_vertex = false;
@@ -141,7 +147,6 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 
 	actions.uniforms = &uniforms;
 
-	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
 	Error err = shader_singleton->compiler.compile(RS::SHADER_SPATIAL, code, &actions, path, gen_code);
 	ERR_FAIL_COND_MSG(err != OK, "Shader compilation failed.");
 
@@ -178,6 +183,17 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	print_line("\n**vertex_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX]);
 	print_line("\n**fragment_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT]);
 #endif
+	if (shader_singleton->async_compilation) {
+		// Geometry using this shader is drawn with the default material until the compilation finishes and the pipelines are set up,
+		// see update_compiling_shaders().
+		shader_singleton->shader.version_set_code(version, gen_code.code, gen_code.uniforms, gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX], gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT], gen_code.defines, true);
+		ubo_size = gen_code.uniform_total_size;
+		ubo_offsets = gen_code.uniform_offsets;
+		texture_uniforms = gen_code.texture_uniforms;
+		shader_singleton->compiling_shader_list.add(&compiling_list_element);
+		return;
+	}
+
 	shader_singleton->shader.version_set_code(version, gen_code.code, gen_code.uniforms, gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX], gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT], gen_code.defines);
 	ERR_FAIL_COND(!shader_singleton->shader.version_is_valid(version));
 
@@ -185,6 +201,12 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	ubo_offsets = gen_code.uniform_offsets;
 	texture_uniforms = gen_code.texture_uniforms;
 
+	_setup_pipelines();
+}
+
+void SceneShaderForwardClustered::ShaderData::_setup_pipelines() {
+	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
+
 	//blend modes
 
 	// if any form of Alpha Antialiasing is enabled, set the blend mode to alpha to coverage
@@ -428,7 +450,8 @@ RS::ShaderNativeSourceCode SceneShaderForwardClustered::ShaderData::get_native_s
 }
 
 SceneShaderForwardClustered::ShaderData::ShaderData() :
-		shader_list_element(this) {
+		shader_list_element(this),
+		compiling_list_element(this) {
 }
 
 SceneShaderForwardClustered::ShaderData::~ShaderData() {
@@ -457,6 +480,11 @@ void SceneShaderForwardClustered::MaterialData::set_next_pass(RID p_pass) {
 bool SceneShaderForwardClustered::MaterialData::update_parameters(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty) {
 	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
 
+	if (shader_data->compiling_list_element.in_list()) {
+		// Creating the uniform set needs the compiled shader, the material is updated again once it's available.
+		return false;
+	}
+
 	return update_parameters_uniform_set(p_parameters, p_uniform_dirty, p_textures_dirty, shader_data->uniforms, shader_data->ubo_offsets.ptr(), shader_data->texture_uniforms, shader_data->default_texture_params, shader_data->ubo_size, uniform_set, shader_singleton->shader.version_get_shader(shader_data->version, 0), RenderForwardClustered::MATERIAL_UNIFORM_SET, true, true);
 }
 
@@ -845,6 +873,29 @@ void fragment() {
 		sampler.compare_op = RD::COMPARE_OP_GREATER;
 		shadow_sampler = RD::get_singleton()->sampler_create(sampler);
 	}
+
+	// Only enabled after the built-in materials are created, as they're the fallback while other shaders compile.
+	async_compilation = GLOBAL_GET("rendering/shader_compiler/async_compilation/enabled");
+}
+
+void SceneShaderForwardClustered::update_compiling_shaders() {
+	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
+
+	SelfList<ShaderData> *E = compiling_shader_list.first();
+	while (E) {
+		SelfList<ShaderData> *next = E->next();
+		ShaderData *shader_data = E->self();
+		if (!shader.version_is_compiling(shader_data->version)) {
+			compiling_shader_list.remove(E);
+			if (shader.version_is_valid(shader_data->version)) {
+				shader_data->_setup_pipelines();
+			} else {
+				ERR_PRINT("Shader compilation failed.");
+			}
+			material_storage->shader_notify_data_changed(shader_data->self);
+		}
+		E = next;
+	}
 }
 
 void SceneShaderForwardClustered::set_default_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_constants) {
@@ -184,10 +184,14 @@ public:
 		bool uses_world_coordinates = false;
 		bool uses_screen_texture_mipmaps = false;
 		Cull cull_mode = CULL_DISABLED;
+		int blend_mode = BLEND_MODE_MIX;
+		int alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF;
+		bool wireframe = false;
 
 		uint64_t last_pass = 0;
 		uint32_t index = 0;
 
+		void _setup_pipelines();
 		virtual void set_code(const String &p_Code);
 
 		virtual bool is_animated() const;
@@ -195,11 +199,14 @@ public:
 		virtual RS::ShaderNativeSourceCode get_native_source_code() const;
 
 		SelfList<ShaderData> shader_list_element;
+		SelfList<ShaderData> compiling_list_element;
 		ShaderData();
 		virtual ~ShaderData();
 	};
 
 	SelfList<ShaderData>::List shader_list;
+	SelfList<ShaderData>::List compiling_shader_list;
+	bool async_compilation = false;
 
 	RendererRD::MaterialStorage::ShaderData *_create_shader_func();
 	static RendererRD::MaterialStorage::ShaderData *_create_shader_funcs() {
@@ -258,6 +265,7 @@ public:
 	void init(const String p_defines);
 	void set_default_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_constants);
 	void enable_advanced_shader_group(bool p_needs_multiview = false);
+	void update_compiling_shaders();
 };
 
 } // namespace RendererSceneRenderImplementation
@@ -75,9 +75,15 @@ void RenderForwardMobile::fill_push_constant_instance_indices(SceneState::Instan
 
 	p_instance_data->omni_lights[0] = 0xFFFFFFFF;
 	p_instance_data->omni_lights[1] = 0xFFFFFFFF;
+	p_instance_data->spot_lights[0] = 0xFFFFFFFF;
+	p_instance_data->spot_lights[1] = 0xFFFFFFFF;
+
+	// Omni and spot lights are read from the light tiles instead.
+	uint32_t omni_light_count = light_tiles.active ? 0 : p_instance->omni_light_count;
+	uint32_t spot_light_count = light_tiles.active ? 0 : p_instance->spot_light_count;
 
 	uint32_t idx = 0;
-	for (uint32_t i = 0; i < p_instance->omni_light_count; i++) {
+	for (uint32_t i = 0; i < omni_light_count; i++) {
 		uint32_t ofs = idx < 4 ? 0 : 1;
 		uint32_t shift = (idx & 0x3) << 3;
 		uint32_t mask = ~(0xFF << shift);
@@ -89,11 +95,8 @@ void RenderForwardMobile::fill_push_constant_instance_indices(SceneState::Instan
 		}
 	}
 
-	p_instance_data->spot_lights[0] = 0xFFFFFFFF;
-	p_instance_data->spot_lights[1] = 0xFFFFFFFF;
-
 	idx = 0;
-	for (uint32_t i = 0; i < p_instance->spot_light_count; i++) {
+	for (uint32_t i = 0; i < spot_light_count; i++) {
 		uint32_t ofs = idx < 4 ? 0 : 1;
 		uint32_t shift = (idx & 0x3) << 3;
 		uint32_t mask = ~(0xFF << shift);
@@ -135,6 +138,141 @@ void RenderForwardMobile::fill_push_constant_instance_indices(SceneState::Instan
 	}
 }
 
+/* Light tiles */
+
+void RenderForwardMobile::_light_tiles_begin(const RenderDataRD *p_render_data, const Size2i &p_screen_size) {
+	// Reflection probes keep using the per instance lists, and multiview would need a tile grid per view.
+	light_tiles.active = light_tiles.enabled && p_render_data->reflection_probe.is_null() && p_render_data->scene_data->view_count == 1 && p_screen_size.width > 0 && p_screen_size.height > 0;
+	if (!light_tiles.active) {
+		return;
+	}
+
+	light_tiles.projection = p_render_data->scene_data->get_cam_projection();
+	light_tiles.inv_cam_transform = p_render_data->scene_data->cam_transform.affine_inverse();
+	light_tiles.z_near = p_render_data->scene_data->z_near;
+	light_tiles.screen_size = p_screen_size;
+	light_tiles.tiles_x = Math::division_round_up(uint32_t(p_screen_size.width), uint32_t(1 << LIGHT_TILE_SIZE_SHIFT));
+	light_tiles.tiles_y = Math::division_round_up(uint32_t(p_screen_size.height), uint32_t(1 << LIGHT_TILE_SIZE_SHIFT));
+	light_tiles.light_count[0] = 0;
+	light_tiles.light_count[1] = 0;
+
+	uint32_t tile_count = light_tiles.tiles_x * light_tiles.tiles_y;
+	light_tiles.data.resize(LIGHT_TILE_HEADER_SIZE + tile_count * LIGHT_TILE_STRIDE);
+	light_tiles.data[0] = LIGHT_TILE_SIZE_SHIFT;
+	light_tiles.data[1] = light_tiles.tiles_x;
+	light_tiles.data[2] = light_tiles.tiles_y;
+	light_tiles.data[3] = 0;
+	memset(light_tiles.data.ptr() + LIGHT_TILE_HEADER_SIZE, 0xFF, tile_count * LIGHT_TILE_STRIDE * sizeof(uint32_t));
+
+	light_tiles.tile_light_count.resize(tile_count * 2);
+	memset(light_tiles.tile_light_count.ptr(), 0, light_tiles.tile_light_count.size());
+}
+
+void RenderForwardMobile::_light_tiles_end() {
+	if (!light_tiles.active) {
+		return;
+	}
+
+	if (light_tiles.buffer_size < light_tiles.data.size()) {
+		if (light_tiles.buffer.is_valid()) {
+			RD::get_singleton()->free(light_tiles.buffer);
+		}
+		uint32_t new_size = nearest_power_of_2_templated(MAX(uint32_t(LIGHT_TILE_DATA_MIN_SIZE), light_tiles.data.size()));
+		light_tiles.buffer = RD::get_singleton()->storage_buffer_create(new_size * sizeof(uint32_t));
+		light_tiles.buffer_size = new_size;
+	}
+	RD::get_singleton()->buffer_update(light_tiles.buffer, 0, light_tiles.data.size() * sizeof(uint32_t), light_tiles.data.ptr());
+}
+
+void RenderForwardMobile::setup_added_light(const RS::LightType p_type, const Transform3D &p_transform, float p_radius, float p_spot_aperture) {
+	if (!light_tiles.active) {
+		return;
+	}
+
+	// Called in light buffer order, so the light index matches the one used in the shader.
+	uint32_t type_index = p_type == RS::LIGHT_SPOT ? 1 : 0;
+	uint32_t light_index = light_tiles.light_count[type_index]++;
+	if (light_index >= 0xFF) {
+		return; // 0xFF terminates the tile list.
+	}
+
+	// Conservative view space bounds of the light volume.
+	Transform3D xform = light_tiles.inv_cam_transform * p_transform;
+	Vector3 origin = xform.origin;
+	AABB bounds;
+	if (p_type == RS::LIGHT_SPOT && p_spot_aperture < 90.0) {
+		Vector3 dir = -xform.basis.get_column(Vector3::AXIS_Z).normalized();
+		float angle = Math::deg_to_rad(p_spot_aperture);
+		float cos_angle = Math::cos(angle);
+
+		// Cone apex and the disk at the base of the spherical cap.
+		Vector3 disk_center = origin + dir * p_radius * cos_angle;
+		Vector3 disk_extents = Vector3(Math::sqrt(MAX(0.0, 1.0 - dir.x * dir.x)), Math::sqrt(MAX(0.0, 1.0 - dir.y * dir.y)), Math::sqrt(MAX(0.0, 1.0 - dir.z * dir.z))) * p_radius * Math::sin(angle);
+		bounds = AABB(disk_center - disk_extents, disk_extents * 2.0);
+		bounds.expand_to(origin);
+
+		// The spherical cap reaches the full radius along any axis that falls inside the cone.
+		for (int i = 0; i < 3; i++) {
+			Vector3 axis;
+			axis[i] = 1.0;
+			if (dir[i] >= cos_angle) {
+				bounds.expand_to(origin + axis * p_radius);
+			}
+			if (-dir[i] >= cos_angle) {
+				bounds.expand_to(origin - axis * p_radius);
+			}
+		}
+	} else {
+		bounds = AABB(origin - Vector3(p_radius, p_radius, p_radius), Vector3(p_radius, p_radius, p_radius) * 2.0);
+	}
+
+	int32_t tiles_x = light_tiles.tiles_x;
+	int32_t tiles_y = light_tiles.tiles_y;
+	int32_t from_x = 0;
+	int32_t from_y = 0;
+	int32_t to_x = tiles_x - 1;
+	int32_t to_y = tiles_y - 1;
+
+	// Volumes crossing the near plane can't be projected reliably, so they cover the whole screen.
+	if (bounds.position.z + bounds.size.z < -light_tiles.z_near) {
+		Vector2 min_pos = Vector2(FLT_MAX, FLT_MAX);
+		Vector2 max_pos = Vector2(-FLT_MAX, -FLT_MAX);
+		for (int i = 0; i < 8; i++) {
+			Vector3 pos = light_tiles.projection.xform(bounds.get_endpoint(i));
+			min_pos = min_pos.min(Vector2(pos.x, pos.y));
+			max_pos = max_pos.max(Vector2(pos.x, pos.y));
+		}
+
+		Vector2 size = Vector2(light_tiles.screen_size);
+		min_pos = (min_pos * 0.5 + Vector2(0.5, 0.5)) * size;
+		max_pos = (max_pos * 0.5 + Vector2(0.5, 0.5)) * size;
+		if (max_pos.x < 0.0 || max_pos.y < 0.0 || min_pos.x >= size.x || min_pos.y >= size.y) {
+			return; // Off screen.
+		}
+
+		from_x = MAX(0, int32_t(min_pos.x) >> LIGHT_TILE_SIZE_SHIFT);
+		from_y = MAX(0, int32_t(min_pos.y) >> LIGHT_TILE_SIZE_SHIFT);
+		to_x = MIN(tiles_x - 1, int32_t(max_pos.x) >> LIGHT_TILE_SIZE_SHIFT);
+		to_y = MIN(tiles_y - 1, int32_t(max_pos.y) >> LIGHT_TILE_SIZE_SHIFT);
+	}
+
+	// Lights arrive sorted by distance, so when a tile is full the closest lights are the ones kept.
+	uint32_t *data = light_tiles.data.ptr() + LIGHT_TILE_HEADER_SIZE + type_index * (LIGHT_TILE_MAX_LIGHTS / 4);
+	for (int32_t y = from_y; y <= to_y; y++) {
+		for (int32_t x = from_x; x <= to_x; x++) {
+			uint32_t tile = y * tiles_x + x;
+			uint8_t &count = light_tiles.tile_light_count[tile * 2 + type_index];
+			if (count >= LIGHT_TILE_MAX_LIGHTS) {
+				continue;
+			}
+			uint32_t &word = data[tile * LIGHT_TILE_STRIDE + (count >> 2)];
+			uint32_t shift = (count & 0x3) << 3;
+			word = (word & ~(0xFFu << shift)) | (light_index << shift);
+			count++;
+		}
+	}
+}
+
 /* Render buffer */
 
 void RenderForwardMobile::RenderBufferDataForwardMobile::free_data() {
@@ -539,6 +677,14 @@ RID RenderForwardMobile::_setup_render_pass_uniform_set(RenderListType p_render_
 
 	uniforms.append_array(p_samplers.get_uniforms(13));
 
+	if (light_tiles.enabled) {
+		RD::Uniform u;
+		u.binding = 13 + 12;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.append_id(light_tiles.buffer.is_valid() ? light_tiles.buffer : scene_shader.default_vec4_xform_buffer);
+		uniforms.push_back(u);
+	}
+
 	if (p_index >= (int)render_pass_uniform_sets.size()) {
 		render_pass_uniform_sets.resize(p_index + 1);
 	}
@@ -622,7 +768,7 @@ void RenderForwardMobile::_pre_opaque_render(RenderDataRD *p_render_data) {
 
 	//prepare shadow rendering
 	if (render_shadows) {
-		RENDER_TIMESTAMP("Render Shadows");
+		RENDER_TIMESTAMP("> Render Shadows");
 
 		_render_shadow_begin();
 
@@ -638,6 +784,8 @@ void RenderForwardMobile::_pre_opaque_render(RenderDataRD *p_render_data) {
 		_render_shadow_process();
 
 		_render_shadow_end();
+
+		RENDER_TIMESTAMP("< Render Shadows");
 	}
 }
 
@@ -737,7 +885,9 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 	// Update light and decal buffer first so we know what lights and decals are safe to pair with.
 	uint32_t directional_light_count = 0;
 	uint32_t positional_light_count = 0;
+	_light_tiles_begin(p_render_data, rb->get_internal_size());
 	light_storage->update_light_buffers(p_render_data, *p_render_data->lights, p_render_data->scene_data->cam_transform, p_render_data->shadow_atlas, using_shadows, directional_light_count, positional_light_count, p_render_data->directional_light_soft_shadows);
+	_light_tiles_end();
 	texture_storage->update_decal_buffer(*p_render_data->decals, p_render_data->scene_data->cam_transform);
 
 	p_render_data->directional_light_count = directional_light_count;
@@ -936,6 +1086,10 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 		if (p_render_data->environment.is_valid() && environment_get_fog_mode(p_render_data->environment) == RS::EnvironmentFogMode::ENV_FOG_MODE_DEPTH) {
 			spec_constant_base_flags |= 1 << SPEC_CONSTANT_USE_DEPTH_FOG;
 		}
+
+		if (light_tiles.active) {
+			spec_constant_base_flags |= 1 << SPEC_CONSTANT_USE_LIGHT_TILES;
+		}
 	}
 
 	{
@@ -1055,15 +1209,18 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 
 			// rendering effects
 			if (ce_has_pre_transparent) {
+				RENDER_TIMESTAMP("Process Pre Transparent Compositor Effects");
 				_process_compositor_effects(RS::COMPOSITOR_EFFECT_CALLBACK_TYPE_PRE_TRANSPARENT, p_render_data);
 			}
 
 			if (scene_state.used_screen_texture) {
+				RENDER_TIMESTAMP("Copy Screen Texture");
 				// Copy screen texture to backbuffer so we can read from it
 				_render_buffers_copy_screen_texture(p_render_data);
 			}
 
 			if (scene_state.used_depth_texture) {
+				RENDER_TIMESTAMP("Copy Depth Texture");
 				// Copy depth texture to backbuffer so we can read from it
 				_render_buffers_copy_depth_texture(p_render_data);
 			}
@@ -1091,9 +1248,11 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 	}
 
 	if (rb_data.is_valid() && !using_subpass_post_process) {
+		RENDER_TIMESTAMP("> Post Process");
 		RD::get_singleton()->draw_command_begin_label("Post process pass");
 
 		if (ce_has_post_transparent) {
+			RENDER_TIMESTAMP("Process Post Transparent Compositor Effects");
 			_process_compositor_effects(RS::COMPOSITOR_EFFECT_CALLBACK_TYPE_POST_TRANSPARENT, p_render_data);
 		}
 
@@ -1103,6 +1262,7 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 		_render_buffers_post_process_and_tonemap(p_render_data);
 
 		RD::get_singleton()->draw_command_end_label(); // Post process pass
+		RENDER_TIMESTAMP("< Post Process");
 	}
 
 	if (rb_data.is_valid()) {
@@ -2482,7 +2642,7 @@ void RenderForwardMobile::_geometry_instance_add_surface_with_material_chain(Geo
 	SceneShaderForwardMobile::MaterialData *material = p_material;
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
-	_geometry_instance_add_surface_with_material(ginstance, p_surface, material, p_mat_src.get_local_index(), material_storage->material_get_shader_id(p_mat_src), p_mesh);
+	_geometry_instance_add_surface_with_material(ginstance, p_surface, material, material->get_sort_id(), material_storage->material_get_shader_id(p_mat_src), p_mesh);
 
 	while (material->next_pass.is_valid()) {
 		RID next_pass = material->next_pass;
@@ -2493,7 +2653,7 @@ void RenderForwardMobile::_geometry_instance_add_surface_with_material_chain(Geo
 		if (ginstance->data->dirty_dependencies) {
 			material_storage->material_update_dependency(next_pass, &ginstance->data->dependency_tracker);
 		}
-		_geometry_instance_add_surface_with_material(ginstance, p_surface, material, next_pass.get_local_index(), material_storage->material_get_shader_id(next_pass), p_mesh);
+		_geometry_instance_add_surface_with_material(ginstance, p_surface, material, material->get_sort_id(), material_storage->material_get_shader_id(next_pass), p_mesh);
 	}
 }
 
@@ -2817,6 +2977,12 @@ RenderForwardMobile::RenderForwardMobile() {
 	{
 		defines += "\n#define MATERIAL_UNIFORM_SET " + itos(MATERIAL_UNIFORM_SET) + "\n";
 	}
+	{
+		light_tiles.enabled = GLOBAL_GET("rendering/limits/forward_mobile/use_light_tiles");
+		if (light_tiles.enabled) {
+			defines += "\n#define USE_LIGHT_TILES\n";
+		}
+	}
 #ifdef REAL_T_IS_DOUBLE
 	{
 		defines += "\n#define USE_DOUBLE_PRECISION \n";
@@ -2851,4 +3017,8 @@ RenderForwardMobile::~RenderForwardMobile() {
 		RD::get_singleton()->free(scene_state.lightmap_capture_buffer);
 		memdelete_arr(scene_state.lightmap_captures);
 	}
+
+	if (light_tiles.buffer.is_valid()) {
+		RD::get_singleton()->free(light_tiles.buffer);
+	}
 }
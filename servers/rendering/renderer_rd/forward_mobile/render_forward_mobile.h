@@ -82,6 +82,7 @@ private:
 		SPEC_CONSTANT_DISABLE_FOG = 14,
 		SPEC_CONSTANT_USE_DEPTH_FOG = 16,
 		SPEC_CONSTANT_IS_MULTIMESH = 17,
+		SPEC_CONSTANT_USE_LIGHT_TILES = 18,
 
 	};
 
@@ -91,6 +92,14 @@ private:
 		INSTANCE_DATA_BUFFER_MIN_SIZE = 4096
 	};
 
+	enum {
+		LIGHT_TILE_SIZE_SHIFT = 6, // 64x64 pixel tiles.
+		LIGHT_TILE_MAX_LIGHTS = 32, // Per light type, must be a multiple of 4.
+		LIGHT_TILE_HEADER_SIZE = 4,
+		LIGHT_TILE_STRIDE = LIGHT_TILE_MAX_LIGHTS / 2, // Packed omni then spot indices, 4 per uint32.
+		LIGHT_TILE_DATA_MIN_SIZE = 4096
+	};
+
 	enum RenderListType {
 		RENDER_LIST_OPAQUE, //used for opaque objects
 		RENDER_LIST_ALPHA, //used for transparent objects
@@ -282,6 +291,33 @@ private:
 		LocalVector<ShadowPass> shadow_passes;
 	} scene_state;
 
+	/* Light tiles */
+
+	// Optional screen space light list, built on the CPU while the light buffers are filled.
+	// Fragments read the lights of their tile instead of the per instance light indices,
+	// which lifts the per instance light limit.
+	struct LightTiles {
+		bool enabled = false;
+		bool active = false;
+
+		Projection projection;
+		Transform3D inv_cam_transform;
+		float z_near = 0.0;
+		Size2i screen_size;
+		uint32_t tiles_x = 0;
+		uint32_t tiles_y = 0;
+		uint32_t light_count[2] = {};
+
+		LocalVector<uint32_t> data;
+		LocalVector<uint8_t> tile_light_count;
+
+		RID buffer;
+		uint32_t buffer_size = 0;
+	} light_tiles;
+
+	void _light_tiles_begin(const RenderDataRD *p_render_data, const Size2i &p_screen_size);
+	void _light_tiles_end();
+
 	/* Render List */
 
 	// !BAS! Render list can probably be reused between clustered and mobile?
@@ -513,6 +549,10 @@ protected:
 	virtual void _render_sdfgi(Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3i &p_from, const Vector3i &p_size, const AABB &p_bounds, const PagedArray<RenderGeometryInstance *> &p_instances, const RID &p_albedo_texture, const RID &p_emission_texture, const RID &p_emission_aniso_texture, const RID &p_geom_facing_texture, float p_exposure_normalization) override;
 	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) override;
 
+	/* Lighting */
+
+	virtual void setup_added_light(const RS::LightType p_type, const Transform3D &p_transform, float p_radius, float p_spot_aperture) override;
+
 	/* Forward ID */
 
 	class ForwardIDStorageMobile : public RendererRD::ForwardIDStorage {
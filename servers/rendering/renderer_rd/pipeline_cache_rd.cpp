@@ -30,8 +30,18 @@
 
 #include "pipeline_cache_rd.h"
 
+#include "core/io/file_access.h"
 #include "core/os/memory.h"
 
+// Bump whenever the layout of the manifest entries changes, older manifests are discarded.
+static const uint32_t PIPELINE_MANIFEST_VERSION = 1;
+
+Mutex PipelineCacheRD::manifest_mutex;
+HashMap<uint32_t, Array> PipelineCacheRD::manifest;
+String PipelineCacheRD::manifest_path;
+bool PipelineCacheRD::manifest_prewarm = false;
+bool PipelineCacheRD::manifest_dirty = false;
+
 RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
 	RD::PipelineMultisampleState multisample_state_version = multisample_state;
 	multisample_state_version.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
@@ -67,10 +77,223 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 	versions[version_count].render_pass = p_render_pass;
 	versions[version_count].bool_specializations = p_bool_specializations;
 	version_count++;
+
+	if (!manifest_path.is_empty()) {
+		_manifest_record_version(versions[version_count - 1]);
+	}
+
 	return pipeline;
 }
 
+uint32_t PipelineCacheRD::_get_manifest_key() {
+	if (manifest_key != 0 || shader.is_null()) {
+		return manifest_key;
+	}
+
+	uint32_t shader_hash = RD::get_singleton()->shader_get_binary_hash(shader);
+	if (shader_hash == 0) {
+		// Placeholder shader, nothing stable to key on yet.
+		return 0;
+	}
+
+	// The key doesn't need to include every state. A collision only means a few unneeded pipelines get compiled in the background.
+	uint32_t h = hash_murmur3_one_32(shader_hash);
+	h = hash_murmur3_one_32(render_primitive, h);
+	h = hash_murmur3_one_32(rasterization_state.cull_mode, h);
+	h = hash_murmur3_one_32(rasterization_state.front_face, h);
+	h = hash_murmur3_one_32(rasterization_state.wireframe, h);
+	h = hash_murmur3_one_32(depth_stencil_state.enable_depth_test, h);
+	h = hash_murmur3_one_32(depth_stencil_state.enable_depth_write, h);
+	h = hash_murmur3_one_32(depth_stencil_state.depth_compare_operator, h);
+	h = hash_murmur3_one_32(blend_state.attachments.size(), h);
+	for (int i = 0; i < blend_state.attachments.size(); i++) {
+		h = hash_murmur3_one_32(blend_state.attachments[i].enable_blend, h);
+		h = hash_murmur3_one_32(blend_state.attachments[i].src_color_blend_factor, h);
+		h = hash_murmur3_one_32(blend_state.attachments[i].dst_color_blend_factor, h);
+	}
+	h = hash_murmur3_one_32(dynamic_state_flags, h);
+	for (int i = 0; i < base_specialization_constants.size(); i++) {
+		h = hash_murmur3_one_32(base_specialization_constants[i].constant_id, h);
+		h = hash_murmur3_one_32(base_specialization_constants[i].int_value, h);
+	}
+
+	manifest_key = hash_fmix32(h);
+	if (manifest_key == 0) {
+		manifest_key = 1;
+	}
+
+	return manifest_key;
+}
+
+void PipelineCacheRD::_manifest_record_version(const Version &p_version) {
+	uint32_t key = _get_manifest_key();
+	if (key == 0) {
+		return;
+	}
+
+	Vector<RD::AttachmentFormat> attachments;
+	Vector<RD::FramebufferPass> passes;
+	uint32_t view_count = 1;
+	if (!RD::get_singleton()->framebuffer_format_get_description(p_version.framebuffer_id, attachments, passes, view_count)) {
+		return;
+	}
+
+	// Formats are stored by description, as their IDs are only valid for this run.
+	Variant vertex_description;
+	if (p_version.vertex_id != RD::INVALID_ID) {
+		Vector<RD::VertexAttribute> attributes = RD::get_singleton()->vertex_format_get_attributes(p_version.vertex_id);
+		PackedInt64Array vertex_values;
+		for (const RD::VertexAttribute &attribute : attributes) {
+			vertex_values.push_back(attribute.location);
+			vertex_values.push_back(attribute.offset);
+			vertex_values.push_back(attribute.format);
+			vertex_values.push_back(attribute.stride);
+			vertex_values.push_back(attribute.frequency);
+		}
+		vertex_description = vertex_values;
+	}
+
+	PackedInt64Array attachment_values;
+	for (const RD::AttachmentFormat &attachment : attachments) {
+		attachment_values.push_back(attachment.format);
+		attachment_values.push_back(attachment.samples);
+		attachment_values.push_back(attachment.usage_flags);
+	}
+
+	Array pass_values;
+	for (const RD::FramebufferPass &pass : passes) {
+		Array pass_value;
+		pass_value.push_back(PackedInt32Array(pass.color_attachments));
+		pass_value.push_back(PackedInt32Array(pass.input_attachments));
+		pass_value.push_back(PackedInt32Array(pass.resolve_attachments));
+		pass_value.push_back(PackedInt32Array(pass.preserve_attachments));
+		pass_value.push_back(pass.depth_attachment);
+		pass_value.push_back(pass.vrs_attachment);
+		pass_values.push_back(pass_value);
+	}
+
+	Array entry;
+	entry.push_back(vertex_description);
+	entry.push_back(attachment_values);
+	entry.push_back(pass_values);
+	entry.push_back(view_count);
+	entry.push_back(RD::get_singleton()->framebuffer_format_get_texture_samples(p_version.framebuffer_id, 0));
+	entry.push_back(p_version.wireframe);
+	entry.push_back(p_version.render_pass);
+	entry.push_back(p_version.bool_specializations);
+
+	MutexLock lock(manifest_mutex);
+	Array *entries = manifest.getptr(key);
+	if (entries == nullptr) {
+		entries = &manifest.insert(key, Array())->value;
+	} else if (entries->has(entry)) {
+		return;
+	}
+
+	entries->push_back(entry);
+	manifest_dirty = true;
+}
+
+void PipelineCacheRD::_start_prewarm() {
+	if (!manifest_prewarm) {
+		return;
+	}
+
+	uint32_t key = _get_manifest_key();
+	if (key == 0) {
+		return;
+	}
+
+	Array prewarm_versions;
+	{
+		MutexLock lock(manifest_mutex);
+		const Array *entries = manifest.getptr(key);
+		if (entries == nullptr) {
+			return;
+		}
+		// The entries themselves are never modified once recorded, so a shallow copy is enough.
+		prewarm_versions = entries->duplicate();
+	}
+
+	_wait_for_prewarm();
+	prewarm_task = WorkerThreadPool::get_singleton()->add_template_task(this, &PipelineCacheRD::_prewarm_task, prewarm_versions, false, SNAME("PipelineCacheRDPrewarm"));
+}
+
+void PipelineCacheRD::_wait_for_prewarm() {
+	if (prewarm_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(prewarm_task);
+		prewarm_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void PipelineCacheRD::_prewarm_task(Array p_versions) {
+	RD *rd = RD::get_singleton();
+	for (int i = 0; i < p_versions.size(); i++) {
+		const Array entry = p_versions[i];
+		ERR_CONTINUE(entry.size() != 8);
+
+		RD::VertexFormatID vertex_id = RD::INVALID_ID;
+		if (entry[0].get_type() == Variant::PACKED_INT64_ARRAY) {
+			const PackedInt64Array vertex_values = entry[0];
+			ERR_CONTINUE(vertex_values.size() % 5 != 0);
+			Vector<RD::VertexAttribute> attributes;
+			for (int j = 0; j < vertex_values.size(); j += 5) {
+				RD::VertexAttribute attribute;
+				attribute.location = vertex_values[j + 0];
+				attribute.offset = vertex_values[j + 1];
+				attribute.format = RD::DataFormat(vertex_values[j + 2]);
+				attribute.stride = vertex_values[j + 3];
+				attribute.frequency = RD::VertexFrequency(vertex_values[j + 4]);
+				ERR_FAIL_INDEX(attribute.format, RD::DATA_FORMAT_MAX);
+				attributes.push_back(attribute);
+			}
+			vertex_id = rd->vertex_format_create(attributes);
+		}
+
+		const PackedInt64Array attachment_values = entry[1];
+		ERR_CONTINUE(attachment_values.size() % 3 != 0);
+		Vector<RD::AttachmentFormat> attachments;
+		for (int j = 0; j < attachment_values.size(); j += 3) {
+			RD::AttachmentFormat attachment;
+			attachment.format = RD::DataFormat(attachment_values[j + 0]);
+			attachment.samples = RD::TextureSamples(attachment_values[j + 1]);
+			attachment.usage_flags = attachment_values[j + 2];
+			ERR_FAIL_INDEX(attachment.format, RD::DATA_FORMAT_MAX);
+			ERR_FAIL_INDEX(attachment.samples, RD::TEXTURE_SAMPLES_MAX);
+			attachments.push_back(attachment);
+		}
+
+		RD::FramebufferFormatID framebuffer_id;
+		if (attachments.is_empty()) {
+			const int64_t samples = entry[4];
+			ERR_FAIL_INDEX(samples, RD::TEXTURE_SAMPLES_MAX);
+			framebuffer_id = rd->framebuffer_format_create_empty(RD::TextureSamples(samples));
+		} else {
+			const Array pass_values = entry[2];
+			Vector<RD::FramebufferPass> passes;
+			for (int j = 0; j < pass_values.size(); j++) {
+				const Array pass_value = pass_values[j];
+				ERR_FAIL_COND(pass_value.size() != 6);
+				RD::FramebufferPass pass;
+				pass.color_attachments = PackedInt32Array(pass_value[0]);
+				pass.input_attachments = PackedInt32Array(pass_value[1]);
+				pass.resolve_attachments = PackedInt32Array(pass_value[2]);
+				pass.preserve_attachments = PackedInt32Array(pass_value[3]);
+				pass.depth_attachment = pass_value[4];
+				pass.vrs_attachment = pass_value[5];
+				passes.push_back(pass);
+			}
+			framebuffer_id = rd->framebuffer_format_create_multipass(attachments, passes, entry[3]);
+		}
+		ERR_CONTINUE(framebuffer_id == RD::INVALID_ID);
+
+		get_render_pipeline(vertex_id, framebuffer_id, entry[5], entry[6], entry[7]);
+	}
+}
+
 void PipelineCacheRD::_clear() {
+	_wait_for_prewarm();
+
 	// TODO: Clear should probably recompile all the variants already compiled instead to avoid stalls? Needs discussion.
 	if (versions) {
 		for (uint32_t i = 0; i < version_count; i++) {
@@ -97,10 +320,14 @@ void PipelineCacheRD::setup(RID p_shader, RD::RenderPrimitive p_primitive, const
 	blend_state = p_blend_state;
 	dynamic_state_flags = p_dynamic_state_flags;
 	base_specialization_constants = p_base_specialization_constants;
+	manifest_key = 0;
+	_start_prewarm();
 }
 void PipelineCacheRD::update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants) {
-	base_specialization_constants = p_base_specialization_constants;
 	_clear();
+	base_specialization_constants = p_base_specialization_constants;
+	manifest_key = 0;
+	_start_prewarm();
 }
 
 void PipelineCacheRD::update_shader(RID p_shader) {
@@ -113,6 +340,52 @@ void PipelineCacheRD::clear() {
 	_clear();
 	shader = RID(); //clear shader
 	input_mask = 0;
+	manifest_key = 0;
+}
+
+void PipelineCacheRD::manifest_load(const String &p_path, bool p_prewarm) {
+	MutexLock lock(manifest_mutex);
+	manifest_path = p_path;
+	manifest_prewarm = p_prewarm;
+	manifest_dirty = false;
+	manifest.clear();
+
+	if (!FileAccess::exists(p_path)) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null() || f->get_32() != PIPELINE_MANIFEST_VERSION) {
+		return;
+	}
+
+	Dictionary entries = f->get_var();
+	for (const Variant &key : entries.keys()) {
+		if (entries[key].get_type() == Variant::ARRAY) {
+			manifest.insert(uint32_t(key), entries[key]);
+		}
+	}
+
+	print_verbose(vformat("Loaded pipeline manifest with %d shader setups.", manifest.size()));
+}
+
+void PipelineCacheRD::manifest_save() {
+	MutexLock lock(manifest_mutex);
+	if (manifest_path.is_empty() || !manifest_dirty) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(manifest_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Can't save the pipeline manifest to: " + manifest_path);
+
+	Dictionary entries;
+	for (const KeyValue<uint32_t, Array> &E : manifest) {
+		entries[E.key] = E.value;
+	}
+
+	f->store_32(PIPELINE_MANIFEST_VERSION);
+	f->store_var(entries);
+	manifest_dirty = false;
 }
 
 PipelineCacheRD::PipelineCacheRD() {
@@ -31,7 +31,10 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/hash_map.h"
 #include "servers/rendering/rendering_device.h"
 
 class PipelineCacheRD {
@@ -60,8 +63,25 @@ class PipelineCacheRD {
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	// The manifest stores the versions that were generated during play, keyed by a hash of everything this cache was set up with, so they
+	// can be compiled in the background the next time the same shader and states are set up.
+	static Mutex manifest_mutex;
+	static HashMap<uint32_t, Array> manifest;
+	static String manifest_path;
+	static bool manifest_prewarm;
+	static bool manifest_dirty;
+
+	uint32_t manifest_key = 0;
+	WorkerThreadPool::TaskID prewarm_task = WorkerThreadPool::INVALID_TASK_ID;
+
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
 
+	uint32_t _get_manifest_key();
+	void _manifest_record_version(const Version &p_version);
+	void _start_prewarm();
+	void _wait_for_prewarm();
+	void _prewarm_task(Array p_versions);
+
 	void _clear();
 
 public:
@@ -99,6 +119,10 @@ public:
 		return input_mask;
 	}
 	void clear();
+
+	static void manifest_load(const String &p_path, bool p_prewarm);
+	static void manifest_save();
+
 	PipelineCacheRD();
 	~PipelineCacheRD();
 };
@@ -447,8 +447,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	push_constant.color_texture_pixel_size[0] = 0;
 	push_constant.color_texture_pixel_size[1] = 0;
 
-	push_constant.pad[0] = 0;
-	push_constant.pad[1] = 0;
+	push_constant.instance_offset = 0;
+	push_constant.pad = 0;
 
 	push_constant.lights[0] = 0;
 	push_constant.lights[1] = 0;
@@ -1148,6 +1148,236 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 	return uniform_set;
 }
 
+bool RendererCanvasRenderRD::_is_rect_batchable(const Item *p_item, Light *p_lights) const {
+	if (p_item->use_canvas_group || p_item->repeat_size.x || p_item->repeat_size.y || p_item->commands == nullptr) {
+		return false;
+	}
+
+	// Custom shaders may rely on VERTEX and MODEL_MATRIX, which differ when drawing instanced.
+	RID material = p_item->material_owner == nullptr ? p_item->material : p_item->material_owner->material;
+	if (material.is_valid()) {
+		return false;
+	}
+
+	const Item::Command *c = p_item->commands;
+	RID texture = static_cast<const Item::CommandRect *>(c)->texture;
+	while (c) {
+		if (c->type != Item::Command::TYPE_RECT) {
+			return false;
+		}
+		const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+		if (rect->texture != texture || (rect->flags & (CANVAS_RECT_TILE | CANVAS_RECT_CLIP_UV | CANVAS_RECT_MSDF | CANVAS_RECT_LCD))) {
+			return false;
+		}
+		if ((rect->flags & CANVAS_RECT_TRANSPOSE) != (static_cast<const Item::CommandRect *>(p_item->commands)->flags & CANVAS_RECT_TRANSPOSE)) {
+			return false;
+		}
+		c = c->next;
+	}
+
+	// Lit items need their own light list in the push constant.
+	for (const Light *light = p_lights; light; light = light->next_ptr) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void RendererCanvasRenderRD::_prepare_rect_batches(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights) {
+	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
+
+	rect_batching.batches.clear();
+	rect_batching.instances.clear();
+
+	if (using_directional_lights || debug_redraw) {
+		return;
+	}
+
+	const bool use_linear_colors = texture_storage->render_target_is_using_hdr(p_to_render_target);
+
+	RectBatch batch;
+	RID batch_texture;
+	RS::CanvasItemTextureFilter batch_filter = RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT;
+	RS::CanvasItemTextureRepeat batch_repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT;
+	const Item *batch_clip = nullptr;
+
+	for (int i = 0; i <= p_item_count; i++) {
+		const Item *ci = i < p_item_count ? items[i] : nullptr;
+		bool batchable = ci && _is_rect_batchable(ci, p_lights);
+
+		const Item::CommandRect *first_rect = nullptr;
+		RID texture;
+		RS::CanvasItemTextureFilter filter = default_filter;
+		RS::CanvasItemTextureRepeat repeat = default_repeat;
+		if (batchable) {
+			first_rect = static_cast<const Item::CommandRect *>(ci->commands);
+			texture = first_rect->texture.is_valid() ? first_rect->texture : default_canvas_texture;
+			if (ci->texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT) {
+				filter = ci->texture_filter;
+			}
+			if (ci->texture_repeat != RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT) {
+				repeat = ci->texture_repeat;
+			}
+		}
+
+		bool same_batch = batchable && batch.item_count > 0 && texture == batch_texture && filter == batch_filter && repeat == batch_repeat && ci->final_clip_owner == batch_clip && bool(first_rect->flags & CANVAS_RECT_TRANSPOSE) == bool(batch.flags & FLAGS_TRANSPOSE_RECT);
+
+		if (!same_batch && batch.item_count > 0) {
+			if (batch.instance_count >= 2) {
+				rect_batching.batches.push_back(batch);
+			} else {
+				rect_batching.instances.resize(batch.instance_from);
+			}
+			batch.item_count = 0;
+		}
+
+		if (!batchable) {
+			continue;
+		}
+
+		if (batch.item_count == 0) {
+			Color specular_shininess;
+			Size2i size;
+			bool use_normal;
+			bool use_specular;
+			if (!texture_storage->canvas_texture_get_uniform_set(texture, filter, repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, use_linear_colors, batch.texture_uniform_set, size, specular_shininess, use_normal, use_specular, false)) {
+				continue;
+			}
+
+			batch.item_from = i;
+			batch.instance_from = rect_batching.instances.size();
+			batch.instance_count = 0;
+			batch.flags = 1 | FLAGS_INSTANCING_HAS_COLORS | FLAGS_INSTANCING_HAS_SRC_RECT | ((first_rect->flags & CANVAS_RECT_TRANSPOSE) ? FLAGS_TRANSPOSE_RECT : 0);
+			batch.texpixel_size = Size2(1.0 / float(size.x), 1.0 / float(size.y));
+			batch_texture = texture;
+			batch_filter = filter;
+			batch_repeat = repeat;
+			batch_clip = ci->final_clip_owner;
+		}
+
+		batch.item_count++;
+
+		const Transform2D base_transform = p_canvas_transform_inverse * ci->final_transform;
+		for (const Item::Command *c = ci->commands; c; c = c->next) {
+			const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+
+			// Same rect setup as _render_item(), with the destination rect folded into the transform.
+			Rect2 src_rect = Rect2(0, 0, 1, 1);
+			Rect2 dst_rect = rect->rect;
+			if (dst_rect.size.width < 0) {
+				dst_rect.position.x += dst_rect.size.width;
+				dst_rect.size.width *= -1;
+			}
+			if (dst_rect.size.height < 0) {
+				dst_rect.position.y += dst_rect.size.height;
+				dst_rect.size.height *= -1;
+			}
+
+			if (rect->texture.is_valid()) {
+				if (rect->flags & CANVAS_RECT_REGION) {
+					src_rect = Rect2(rect->source.position * batch.texpixel_size, rect->source.size * batch.texpixel_size);
+				}
+				if (rect->flags & CANVAS_RECT_FLIP_H) {
+					src_rect.size.x *= -1;
+				}
+				if (rect->flags & CANVAS_RECT_FLIP_V) {
+					src_rect.size.y *= -1;
+				}
+			}
+
+			Color modulated = rect->modulate * ci->final_modulate;
+			if (use_linear_colors) {
+				modulated = modulated.srgb_to_linear();
+			}
+
+			RectInstance instance;
+			_update_transform_2d_to_mat2x4(base_transform * Transform2D(Vector2(dst_rect.size.width, 0), Vector2(0, dst_rect.size.height), dst_rect.position), instance.xform);
+			instance.modulation[0] = modulated.r;
+			instance.modulation[1] = modulated.g;
+			instance.modulation[2] = modulated.b;
+			instance.modulation[3] = modulated.a;
+			instance.src_rect[0] = src_rect.position.x;
+			instance.src_rect[1] = src_rect.position.y;
+			instance.src_rect[2] = src_rect.size.width;
+			instance.src_rect[3] = src_rect.size.height;
+			rect_batching.instances.push_back(instance);
+			batch.instance_count++;
+		}
+	}
+
+	if (rect_batching.batches.is_empty()) {
+		return;
+	}
+
+	// Several canvases are drawn each frame, so append to the buffer rather than overwrite what earlier draw lists use.
+	const uint64_t frame = RSG::rasterizer->get_frame_number();
+	if (rect_batching.frame != frame) {
+		rect_batching.frame = frame;
+		rect_batching.buffer_used = 0;
+	}
+
+	const uint32_t instance_count = rect_batching.instances.size();
+	if (rect_batching.buffer_used + instance_count > rect_batching.buffer_size) {
+		if (rect_batching.buffer.is_valid()) {
+			RD::get_singleton()->free(rect_batching.buffer);
+		}
+		rect_batching.buffer_size = MAX(next_power_of_2(rect_batching.buffer_used + instance_count), (uint32_t)MIN_RECT_BATCH_INSTANCES);
+		rect_batching.buffer = RD::get_singleton()->storage_buffer_create(rect_batching.buffer_size * sizeof(RectInstance));
+		rect_batching.buffer_used = 0;
+
+		Vector<RD::Uniform> uniforms;
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 0;
+		u.append_id(rect_batching.buffer);
+		uniforms.push_back(u);
+		rect_batching.uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
+	}
+
+	RD::get_singleton()->buffer_update(rect_batching.buffer, rect_batching.buffer_used * sizeof(RectInstance), instance_count * sizeof(RectInstance), rect_batching.instances.ptr());
+	for (RectBatch &E : rect_batching.batches) {
+		E.instance_from += rect_batching.buffer_used;
+	}
+	rect_batching.buffer_used += instance_count;
+}
+
+void RendererCanvasRenderRD::_render_rect_batch(RD::DrawListID p_draw_list, const RectBatch &p_batch, RD::FramebufferFormatID p_framebuffer_format, RenderingMethod::RenderInfo *r_render_info) {
+	PushConstant push_constant;
+	memset(&push_constant, 0, sizeof(PushConstant));
+
+	_update_transform_2d_to_mat2x3(Transform2D(), push_constant.world);
+	push_constant.flags = p_batch.flags;
+	for (int i = 0; i < 4; i++) {
+		push_constant.modulation[i] = 1.0;
+	}
+	push_constant.src_rect[2] = 1.0;
+	push_constant.src_rect[3] = 1.0;
+	push_constant.dst_rect[2] = 1.0;
+	push_constant.dst_rect[3] = 1.0;
+	push_constant.color_texture_pixel_size[0] = p_batch.texpixel_size.x;
+	push_constant.color_texture_pixel_size[1] = p_batch.texpixel_size.y;
+	push_constant.instance_offset = p_batch.instance_from;
+
+	RID pipeline = shader.pipeline_variants.variants[PIPELINE_LIGHT_MODE_DISABLED][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+	RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, p_batch.texture_uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, rect_batching.uniform_set, TRANSFORMS_UNIFORM_SET);
+	RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+	RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
+	RD::get_singleton()->draw_list_draw(p_draw_list, true, p_batch.instance_count);
+
+	// Items drawn after the batch expect the default transforms buffer.
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+
+	if (r_render_info) {
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += p_batch.instance_count;
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2 * p_batch.instance_count;
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
+	}
+}
+
 void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer, RenderingMethod::RenderInfo *r_render_info) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
@@ -1183,6 +1413,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
+	// Buffers can't be updated while a draw list is open, so batches are built up front.
+	_prepare_rect_batches(p_to_render_target, p_item_count, canvas_transform_inverse, p_lights);
+	uint32_t next_batch = 0;
+
 	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD, clear_colors);
 
 	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
@@ -1246,7 +1480,11 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			}
 		}
 
-		if (!ci->repeat_size.x && !ci->repeat_size.y) {
+		if (next_batch < rect_batching.batches.size() && rect_batching.batches[next_batch].item_from == (uint32_t)i) {
+			const RectBatch &batch = rect_batching.batches[next_batch++];
+			_render_rect_batch(draw_list, batch, fb_format, r_render_info);
+			i += batch.item_count - 1;
+		} else if (!ci->repeat_size.x && !ci->repeat_size.y) {
 			_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, Point2(), r_render_info);
 		} else {
 			Point2 start_pos = ci->repeat_size * -(ci->repeat_times / 2);
@@ -2922,6 +3160,10 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 	//shaders
 
+	if (rect_batching.buffer.is_valid()) {
+		RD::get_singleton()->free(rect_batching.buffer);
+	}
+
 	shader.canvas_shader.version_free(shader.default_version);
 
 	//buffers
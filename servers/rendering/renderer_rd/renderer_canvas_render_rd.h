@@ -78,6 +78,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR = (1 << 11),
 
 		FLAGS_NINEPACH_DRAW_CENTER = (1 << 12),
+		FLAGS_INSTANCING_HAS_SRC_RECT = (1 << 13),
 
 		FLAGS_USE_SKELETON = (1 << 15),
 		FLAGS_NINEPATCH_H_MODE_SHIFT = 16,
@@ -109,6 +110,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	enum {
 		MAX_RENDER_ITEMS = 256 * 1024,
+		MIN_RECT_BATCH_INSTANCES = 256,
 		MAX_LIGHT_TEXTURES = 1024,
 		MAX_LIGHTS_PER_ITEM = 16,
 		DEFAULT_MAX_LIGHTS_PER_RENDER = 256
@@ -390,7 +392,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 				};
 				float dst_rect[4];
 				float src_rect[4];
-				float pad[2];
+				uint32_t instance_offset;
+				uint32_t pad;
 			};
 			//primitive
 			struct {
@@ -405,6 +408,42 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	Item *items[MAX_RENDER_ITEMS];
 
+	/**** RECT BATCHING ****/
+
+	// Runs of rects drawn with the default shader and the same texture are merged into a single
+	// instanced draw, which reads the transform, color and source rect of each rect from a storage buffer.
+
+	struct RectInstance {
+		float xform[8];
+		float modulation[4];
+		float src_rect[4];
+	};
+
+	struct RectBatch {
+		uint32_t item_from = 0;
+		uint32_t item_count = 0;
+		uint32_t instance_from = 0;
+		uint32_t instance_count = 0;
+		uint32_t flags = 0;
+		RID texture_uniform_set;
+		Size2 texpixel_size;
+	};
+
+	struct RectBatching {
+		RID buffer;
+		RID uniform_set;
+		uint32_t buffer_size = 0; // In instances.
+		uint32_t buffer_used = 0;
+		uint64_t frame = UINT64_MAX;
+
+		LocalVector<RectInstance> instances;
+		LocalVector<RectBatch> batches;
+	} rect_batching;
+
+	bool _is_rect_batchable(const Item *p_item, Light *p_lights) const;
+	void _prepare_rect_batches(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights);
+	void _render_rect_batch(RD::DrawListID p_draw_list, const RectBatch &p_batch, RD::FramebufferFormatID p_framebuffer_format, RenderingMethod::RenderInfo *r_render_info);
+
 	bool using_directional_lights = false;
 	RID default_canvas_texture;
 
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 
 void RendererCompositorRD::blit_render_targets_to_screen(DisplayServer::WindowID p_screen, const BlitToScreen *p_render_targets, int p_amount) {
 	Error err = RD::get_singleton()->screen_prepare_for_drawing(p_screen);
@@ -148,6 +149,8 @@ void RendererCompositorRD::initialize() {
 uint64_t RendererCompositorRD::frame = 1;
 
 void RendererCompositorRD::finalize() {
+	PipelineCacheRD::manifest_save();
+
 	memdelete(scene);
 	memdelete(canvas);
 	memdelete(fog);
@@ -294,6 +297,12 @@ RendererCompositorRD::RendererCompositorRD() {
 					ShaderRD::set_shader_cache_save_compressed(compress);
 					ShaderRD::set_shader_cache_save_compressed_zstd(use_zstd);
 					ShaderRD::set_shader_cache_save_debug(!strip_debug);
+
+					// Must be loaded before any shader is set up, so the pipelines seen in previous runs can be prewarmed as they load.
+					if (GLOBAL_GET("rendering/rendering_device/pipeline_cache/prewarm_manifest")) {
+						String manifest_file = vformat("pipelines.%s%s.manifest", OS::get_singleton()->get_current_rendering_method(), Engine::get_singleton()->is_editor_hint() ? ".editor" : "");
+						PipelineCacheRD::manifest_load(shader_cache_dir.path_join(manifest_file), true);
+					}
 				}
 			}
 		}
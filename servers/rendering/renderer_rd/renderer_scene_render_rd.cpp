@@ -515,7 +515,7 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 	int max_glow_level = -1;
 
 	if (can_use_effects && p_render_data->environment.is_valid() && environment_get_glow_enabled(p_render_data->environment)) {
-		RENDER_TIMESTAMP("Glow");
+		RENDER_TIMESTAMP("> Glow");
 		RD::get_singleton()->draw_command_begin_label("Gaussian Glow");
 
 		rb->allocate_blur_textures();
@@ -534,6 +534,7 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		float luminance_multiplier = _render_buffers_get_luminance_multiplier();
 		for (uint32_t l = 0; l < rb->get_view_count(); l++) {
 			for (int i = 0; i < (max_glow_level + 1); i++) {
+				RENDER_TIMESTAMP("Glow Level " + itos(i));
 				Size2i vp_size = rb->get_texture_slice_size(RB_SCOPE_BUFFERS, RB_TEX_BLUR_1, i);
 
 				if (i == 0) {
@@ -564,6 +565,7 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		}
 
 		RD::get_singleton()->draw_command_end_label();
+		RENDER_TIMESTAMP("< Glow");
 	}
 
 	{
@@ -1063,7 +1065,20 @@ void RendererSceneRenderRD::_update_vrs(Ref<RenderSceneBuffersRD> p_render_buffe
 		RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 
 		RS::ViewportVRSMode vrs_mode = texture_storage->render_target_get_vrs_mode(render_target);
-		if (vrs_mode != RS::VIEWPORT_VRS_DISABLED) {
+		if (vrs_mode == RS::VIEWPORT_VRS_ADAPTIVE) {
+			// Build the shading rate from what was rendered last frame, the color and velocity
+			// buffers haven't been overwritten yet at this point.
+			RD::get_singleton()->draw_command_begin_label("VRS Adaptive");
+
+			bool use_velocity = p_render_buffers->has_velocity_buffer(false);
+			for (uint32_t v = 0; v < p_render_buffers->get_view_count(); v++) {
+				RID vrs_texture = p_render_buffers->get_texture_slice(RB_SCOPE_VRS, RB_TEXTURE, v, 0);
+				RID velocity = use_velocity ? p_render_buffers->get_velocity_buffer(false, v) : RID();
+				vrs->update_adaptive_vrs_texture(vrs_texture, p_render_buffers->get_internal_texture(v), velocity, p_render_buffers->get_internal_size());
+			}
+
+			RD::get_singleton()->draw_command_end_label();
+		} else if (vrs_mode != RS::VIEWPORT_VRS_DISABLED) {
 			RID vrs_texture = p_render_buffers->get_texture(RB_SCOPE_VRS, RB_TEXTURE);
 
 			// We use get_cache_multipass instead of get_cache_multiview because the default behavior is for
@@ -315,6 +315,7 @@ RS::ShaderNativeSourceCode ShaderRD::version_get_native_source_code(RID p_versio
 	Version *version = version_owner.get_or_null(p_version);
 	RS::ShaderNativeSourceCode source_code;
 	ERR_FAIL_NULL_V(version, source_code);
+	_wait_for_compilation(version);
 
 	source_code.versions.resize(variant_defines.size());
 
@@ -495,6 +496,21 @@ void ShaderRD::_allocate_placeholders(Version *p_version, int p_group) {
 	}
 }
 
+void ShaderRD::_compile_version_task(Version *p_version) {
+	for (int i = 0; i < group_enabled.size(); i++) {
+		if (group_enabled[i]) {
+			_compile_version(p_version, i);
+		}
+	}
+}
+
+void ShaderRD::_wait_for_compilation(Version *p_version) {
+	if (p_version->compile_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_version->compile_task);
+		p_version->compile_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
 // Try to compile all variants for a given group.
 // Will skip variants that are disabled.
 void ShaderRD::_compile_version(Version *p_version, int p_group) {
@@ -568,11 +584,13 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 	p_version->valid = true;
 }
 
-void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines) {
+void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines, bool p_async) {
 	ERR_FAIL_COND(is_compute);
 
 	Version *version = version_owner.get_or_null(p_version);
 	ERR_FAIL_NULL(version);
+	_wait_for_compilation(version);
+
 	version->vertex_globals = p_vertex_globals.utf8();
 	version->fragment_globals = p_fragment_globals.utf8();
 	version->uniforms = p_uniforms.utf8();
@@ -587,7 +605,17 @@ void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_
 	}
 
 	version->dirty = true;
-	if (version->initialize_needed) {
+	if (p_async) {
+		// Placeholders are only needed by the disabled groups, the enabled ones get their shaders once the task creates them.
+		_initialize_version(version);
+		for (int i = 0; i < group_enabled.size(); i++) {
+			if (!group_enabled[i]) {
+				_allocate_placeholders(version, i);
+			}
+		}
+		version->initialize_needed = false;
+		version->compile_task = WorkerThreadPool::get_singleton()->add_template_task(this, &ShaderRD::_compile_version_task, version, false, SNAME("ShaderCompilationAsync"));
+	} else if (version->initialize_needed) {
 		_initialize_version(version);
 		for (int i = 0; i < group_enabled.size(); i++) {
 			if (!group_enabled[i]) {
@@ -636,6 +664,7 @@ void ShaderRD::version_set_compute_code(RID p_version, const HashMap<String, Str
 bool ShaderRD::version_is_valid(RID p_version) {
 	Version *version = version_owner.get_or_null(p_version);
 	ERR_FAIL_NULL_V(version, false);
+	_wait_for_compilation(version);
 
 	if (version->dirty) {
 		_initialize_version(version);
@@ -651,9 +680,26 @@ bool ShaderRD::version_is_valid(RID p_version) {
 	return version->valid;
 }
 
+bool ShaderRD::version_is_compiling(RID p_version) {
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_NULL_V(version, false);
+
+	if (version->compile_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return false;
+	}
+
+	if (!WorkerThreadPool::get_singleton()->is_task_completed(version->compile_task)) {
+		return true;
+	}
+
+	_wait_for_compilation(version);
+	return false;
+}
+
 bool ShaderRD::version_free(RID p_version) {
 	if (version_owner.owns(p_version)) {
 		Version *version = version_owner.get_or_null(p_version);
+		_wait_for_compilation(version);
 		_clear_version(version);
 		version_owner.free(p_version);
 	} else {
@@ -682,11 +728,16 @@ void ShaderRD::enable_group(int p_group) {
 		return;
 	}
 
+	// Background compilations read the enabled groups, so they must be done before any is changed.
+	List<RID> all_versions;
+	version_owner.get_owned_list(&all_versions);
+	for (const RID &E : all_versions) {
+		_wait_for_compilation(version_owner.get_or_null(E));
+	}
+
 	group_enabled.write[p_group] = true;
 
 	// Compile all versions again to include the new group.
-	List<RID> all_versions;
-	version_owner.get_owned_list(&all_versions);
 	for (const RID &E : all_versions) {
 		Version *version = version_owner.get_or_null(E);
 		_compile_version(version, p_group);
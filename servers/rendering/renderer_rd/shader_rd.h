@@ -31,6 +31,7 @@
 #ifndef SHADER_RD_H
 #define SHADER_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
@@ -76,6 +77,9 @@ private:
 		bool valid;
 		bool dirty;
 		bool initialize_needed;
+
+		// Set while the version is being compiled in the background, see version_set_code().
+		WorkerThreadPool::TaskID compile_task = WorkerThreadPool::INVALID_TASK_ID;
 	};
 
 	Mutex variant_set_mutex;
@@ -91,6 +95,8 @@ private:
 	void _clear_version(Version *p_version);
 	void _compile_version(Version *p_version, int p_group);
 	void _allocate_placeholders(Version *p_version, int p_group);
+	void _compile_version_task(Version *p_version);
+	void _wait_for_compilation(Version *p_version);
 
 	RID_Owner<Version> version_owner;
 
@@ -155,7 +161,9 @@ protected:
 public:
 	RID version_create();
 
-	void version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines);
+	// With p_async, every enabled group is compiled on the WorkerThreadPool right away. Poll version_is_compiling() to know when it's done,
+	// any other access to the version before that waits for the compilation to finish.
+	void version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines, bool p_async = false);
 	void version_set_compute_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_compute_globals, const Vector<String> &p_custom_defines);
 
 	_FORCE_INLINE_ RID version_get_shader(RID p_version, int p_variant) {
@@ -165,6 +173,10 @@ public:
 		Version *version = version_owner.get_or_null(p_version);
 		ERR_FAIL_NULL_V(version, RID());
 
+		if (unlikely(version->compile_task != WorkerThreadPool::INVALID_TASK_ID)) {
+			_wait_for_compilation(version);
+		}
+
 		if (version->dirty) {
 			_initialize_version(version);
 			for (int i = 0; i < group_enabled.size(); i++) {
@@ -184,6 +196,7 @@ public:
 	}
 
 	bool version_is_valid(RID p_version);
+	bool version_is_compiling(RID p_version);
 
 	bool version_free(RID p_version);
 
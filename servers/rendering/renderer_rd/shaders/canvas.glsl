@@ -172,9 +172,17 @@ void main() {
 				if (bool(draw_data.flags & FLAGS_INSTANCING_HAS_CUSTOM_DATA)) {
 					stride += 1;
 				}
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+				if (bool(draw_data.flags & FLAGS_INSTANCING_HAS_SRC_RECT)) {
+					stride += 1;
+				}
+#endif
 			}
 
 			uint offset = stride * gl_InstanceIndex;
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+			offset += stride * draw_data.instance_offset;
+#endif
 
 			mat4 matrix = mat4(transforms.data[offset + 0], transforms.data[offset + 1], vec4(0.0, 0.0, 1.0, 0.0), vec4(0.0, 0.0, 0.0, 1.0));
 			offset += 2;
@@ -186,8 +194,18 @@ void main() {
 
 			if (bool(draw_data.flags & FLAGS_INSTANCING_HAS_CUSTOM_DATA)) {
 				instance_custom = transforms.data[offset];
+				offset += 1;
 			}
 
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+			// Batched rects, the destination rect is folded into the instance transform.
+			if (bool(draw_data.flags & FLAGS_INSTANCING_HAS_SRC_RECT)) {
+				vec4 src_rect = transforms.data[offset];
+				uv = src_rect.xy + abs(src_rect.zw) * ((draw_data.flags & FLAGS_TRANSPOSE_RECT) != 0 ? vertex_base.yx : vertex_base.xy);
+				vertex = mix(vertex_base, vec2(1.0, 1.0) - vertex_base, lessThan(src_rect.zw, vec2(0.0, 0.0)));
+			}
+#endif
+
 			matrix = transpose(matrix);
 			model_matrix = model_matrix * matrix;
 		}
@@ -14,6 +14,7 @@
 #define FLAGS_TRANSPOSE_RECT (1 << 10)
 #define FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR (1 << 11)
 #define FLAGS_NINEPACH_DRAW_CENTER (1 << 12)
+#define FLAGS_INSTANCING_HAS_SRC_RECT (1 << 13)
 
 #define FLAGS_NINEPATCH_H_MODE_SHIFT 16
 #define FLAGS_NINEPATCH_V_MODE_SHIFT 18
@@ -46,7 +47,8 @@ layout(push_constant, std430) uniform DrawData {
 	vec4 ninepatch_margins;
 	vec4 dst_rect; //for built-in rect and UV
 	vec4 src_rect;
-	vec2 pad;
+	uint instance_offset;
+	uint pad;
 
 #endif
 	vec2 color_texture_pixel_size;
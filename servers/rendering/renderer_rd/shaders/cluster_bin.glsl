@@ -0,0 +1,198 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// One workgroup per element. The element bounds are projected to a rectangle of
+// clusters, then every cluster in it is tested against the element shape and
+// tagged the same way cluster_render does, so cluster_store can pack the result.
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(push_constant, std430) uniform Params {
+	uvec2 cluster_screen_size;
+	vec2 cluster_ndc_size; // Size of a cluster in normalized device coordinates.
+
+	uint render_element_count;
+	float z_near;
+	bool orthogonal;
+	uint pad;
+}
+params;
+
+layout(set = 0, binding = 1, std140) uniform State {
+	mat4 projection;
+
+	float inv_z_far;
+	uint screen_to_clusters_shift; // shift to obtain coordinates in block indices
+	uint cluster_screen_width; //
+	uint cluster_data_size; // how much data for a single cluster takes
+
+	uint cluster_depth_offset;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+}
+state;
+
+struct RenderElement {
+	uint type; //0-4
+	bool touches_near;
+	bool touches_far;
+	uint original_index;
+	mat3x4 transform_inv;
+	vec3 scale;
+	bool has_wide_spot_angle;
+};
+
+layout(set = 0, binding = 2, std430) buffer restrict readonly RenderElements {
+	RenderElement data[];
+}
+render_elements;
+
+layout(set = 0, binding = 3, std430) buffer restrict ClusterRender {
+	uint data[];
+}
+cluster_render;
+
+#define SHAPE_SPHERE 0
+#define SHAPE_CONE 1
+#define SHAPE_BOX 2
+
+#define ELEMENT_TYPE_OMNI_LIGHT 0
+#define ELEMENT_TYPE_SPOT_LIGHT 1
+
+float plane_distance(vec4 plane, vec3 point) {
+	return dot(plane.xyz, point) + plane.w;
+}
+
+// Planes are not normalized, so the extents are scaled by the normal length where needed.
+bool is_outside_plane(vec4 plane, uint shape, vec3 origin, vec3 axis_x, vec3 axis_y, vec3 axis_z, vec3 scale) {
+	if (shape == SHAPE_SPHERE) {
+		return plane_distance(plane, origin) < -scale.x * length(plane.xyz);
+	} else if (shape == SHAPE_CONE) {
+		if (plane_distance(plane, origin) >= 0.0) {
+			return false;
+		}
+		// Farthest point of the base rim along the plane normal.
+		vec3 dir = -axis_z;
+		vec3 base = origin + dir * scale.z;
+		vec3 towards = plane.xyz - dir * dot(plane.xyz, dir);
+		float towards_len = length(towards);
+		if (towards_len > 0.0) {
+			base += towards * (scale.x / towards_len);
+		}
+		return plane_distance(plane, base) < 0.0;
+	} else {
+		float extent = abs(dot(plane.xyz, axis_x)) * scale.x + abs(dot(plane.xyz, axis_y)) * scale.y + abs(dot(plane.xyz, axis_z)) * scale.z;
+		return plane_distance(plane, origin) < -extent;
+	}
+}
+
+void main() {
+	uint index = gl_WorkGroupID.y * gl_NumWorkGroups.x + gl_WorkGroupID.x;
+	if (index >= params.render_element_count) {
+		return;
+	}
+
+	mat3x4 transform = render_elements.data[index].transform_inv;
+	vec3 origin = vec3(transform[0].w, transform[1].w, transform[2].w);
+	vec3 axis_x = normalize(vec3(transform[0].x, transform[1].x, transform[2].x));
+	vec3 axis_y = normalize(vec3(transform[0].y, transform[1].y, transform[2].y));
+	vec3 axis_z = normalize(vec3(transform[0].z, transform[1].z, transform[2].z));
+	vec3 scale = render_elements.data[index].scale;
+
+	uint type = render_elements.data[index].type;
+	uint shape;
+	if (type == ELEMENT_TYPE_OMNI_LIGHT || (type == ELEMENT_TYPE_SPOT_LIGHT && render_elements.data[index].has_wide_spot_angle)) {
+		shape = SHAPE_SPHERE;
+	} else if (type == ELEMENT_TYPE_SPOT_LIGHT) {
+		shape = SHAPE_CONE;
+	} else {
+		shape = SHAPE_BOX;
+	}
+
+	// View space bounds.
+	vec3 aabb_min;
+	vec3 aabb_max;
+	if (shape == SHAPE_SPHERE) {
+		aabb_min = origin - vec3(scale.x);
+		aabb_max = origin + vec3(scale.x);
+	} else if (shape == SHAPE_CONE) {
+		vec3 base = origin - axis_z * scale.z;
+		vec3 rim = sqrt(max(vec3(1.0) - axis_z * axis_z, vec3(0.0))) * scale.x;
+		aabb_min = min(origin, base - rim);
+		aabb_max = max(origin, base + rim);
+	} else {
+		vec3 extent = abs(axis_x) * scale.x + abs(axis_y) * scale.y + abs(axis_z) * scale.z;
+		aabb_min = origin - extent;
+		aabb_max = origin + extent;
+	}
+
+	float min_depth = -aabb_max.z;
+	float max_depth = -aabb_min.z;
+
+	if (!params.orthogonal && max_depth <= 0.0) {
+		return; // Behind the camera.
+	}
+
+	// Depth slices, matching the clamped depth used by cluster_render.
+	uint from_z = uint(clamp(min_depth * state.inv_z_far * 32.0, 0.0, 31.0));
+	uint to_z = uint(clamp(max_depth * state.inv_z_far * 32.0, 0.0, 31.0)) + 1;
+	uint z_bits = (to_z == 32 ? 0xFFFFFFFFu : ((1u << to_z) - 1)) & ~((1u << from_z) - 1);
+
+	uvec2 rect_from = uvec2(0);
+	uvec2 rect_to = params.cluster_screen_size;
+
+	if (params.orthogonal || min_depth > params.z_near) {
+		vec2 ndc_min = vec2(1e20);
+		vec2 ndc_max = vec2(-1e20);
+		for (uint i = 0; i < 8; i++) {
+			vec3 corner = mix(aabb_min, aabb_max, bvec3((i & 1) != 0, (i & 2) != 0, (i & 4) != 0));
+			vec4 clip = state.projection * vec4(corner, 1.0);
+			vec2 ndc = clip.xy / clip.w;
+			ndc_min = min(ndc_min, ndc);
+			ndc_max = max(ndc_max, ndc);
+		}
+
+		vec2 cluster_min = floor((ndc_min + 1.0) / params.cluster_ndc_size);
+		vec2 cluster_max = floor((ndc_max + 1.0) / params.cluster_ndc_size) + 1.0;
+		rect_from = uvec2(clamp(cluster_min, vec2(0.0), vec2(params.cluster_screen_size)));
+		rect_to = uvec2(clamp(cluster_max, vec2(0.0), vec2(params.cluster_screen_size)));
+	}
+
+	if (any(greaterThanEqual(rect_from, rect_to))) {
+		return;
+	}
+
+	vec4 row0 = vec4(state.projection[0][0], state.projection[1][0], state.projection[2][0], state.projection[3][0]);
+	vec4 row1 = vec4(state.projection[0][1], state.projection[1][1], state.projection[2][1], state.projection[3][1]);
+	vec4 row3 = vec4(state.projection[0][3], state.projection[1][3], state.projection[2][3], state.projection[3][3]);
+
+	uvec2 rect_size = rect_to - rect_from;
+	uint cluster_count = rect_size.x * rect_size.y;
+	uint usage_word = index >> 5;
+	uint usage_bit = 1u << (index & 0x1F);
+
+	for (uint i = gl_LocalInvocationIndex; i < cluster_count; i += 64) {
+		uvec2 pos = rect_from + uvec2(i % rect_size.x, i / rect_size.x);
+
+		if (!render_elements.data[index].touches_near) {
+			vec2 ndc_from = vec2(pos) * params.cluster_ndc_size - 1.0;
+			vec2 ndc_to = ndc_from + params.cluster_ndc_size;
+
+			// Side planes of the cluster column, facing inwards.
+			if (is_outside_plane(row0 - ndc_from.x * row3, shape, origin, axis_x, axis_y, axis_z, scale) ||
+					is_outside_plane(ndc_to.x * row3 - row0, shape, origin, axis_x, axis_y, axis_z, scale) ||
+					is_outside_plane(row1 - ndc_from.y * row3, shape, origin, axis_x, axis_y, axis_z, scale) ||
+					is_outside_plane(ndc_to.y * row3 - row1, shape, origin, axis_x, axis_y, axis_z, scale)) {
+				continue;
+			}
+		}
+
+		uint offset = (pos.x + state.cluster_screen_width * pos.y) * state.cluster_data_size;
+		atomicOr(cluster_render.data[offset + usage_word], usage_bit);
+		cluster_render.data[offset + state.cluster_depth_offset + index] = z_bits;
+	}
+}
@@ -0,0 +1,86 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Builds a shading rate image from the previous frame: tiles that move fast or
+// have little contrast are shaded at a coarser rate.
+
+#define SAMPLES_PER_AXIS 4
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D source_color;
+layout(set = 0, binding = 1) uniform sampler2D source_velocity;
+
+layout(r8ui, set = 1, binding = 0) uniform restrict writeonly uimage2D dest_vrs;
+
+layout(push_constant, std430) uniform Params {
+	ivec2 vrs_size;
+	ivec2 texel_size;
+
+	vec2 pixel_size;
+	float max_texel_factor;
+	bool use_velocity;
+
+	float motion_threshold; // In pixels per frame, for halving the rate along an axis.
+	float contrast_threshold; // Relative luminance deviation under which a tile is considered flat.
+	float pad[2];
+}
+params;
+
+void main() {
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.vrs_size))) {
+		return;
+	}
+
+	vec2 tile_origin = vec2(pos * params.texel_size);
+	vec2 sample_step = vec2(params.texel_size) / float(SAMPLES_PER_AXIS);
+
+	float lum_sum = 0.0;
+	float lum_sq_sum = 0.0;
+	vec2 motion = vec2(0.0);
+
+	for (int y = 0; y < SAMPLES_PER_AXIS; y++) {
+		for (int x = 0; x < SAMPLES_PER_AXIS; x++) {
+			vec2 uv = (tile_origin + (vec2(x, y) + 0.5) * sample_step) * params.pixel_size;
+
+			float lum = dot(textureLod(source_color, uv, 0.0).rgb, vec3(0.2126, 0.7152, 0.0722));
+			lum_sum += lum;
+			lum_sq_sum += lum * lum;
+
+			if (params.use_velocity) {
+				// Velocity is stored in UV units, convert to pixels.
+				motion = max(motion, abs(textureLod(source_velocity, uv, 0.0).xy) / params.pixel_size);
+			}
+		}
+	}
+
+	float sample_count = float(SAMPLES_PER_AXIS * SAMPLES_PER_AXIS);
+	float lum_mean = lum_sum / sample_count;
+	float lum_deviation = sqrt(max(lum_sq_sum / sample_count - lum_mean * lum_mean, 0.0));
+	float contrast = lum_deviation / max(lum_mean, 0.0001);
+
+	// Rates are log2 of the texel factor: 0 = 1, 1 = 2, 2 = 4, 3 = 8.
+	vec2 rate = vec2(0.0);
+
+	// Every doubling of the motion over the threshold halves the rate again along that axis.
+	rate = max(rate, floor(log2(max(motion / params.motion_threshold, vec2(1.0))) + step(params.motion_threshold, motion)));
+
+	// Flat tiles are shaded coarser, very flat ones even more so.
+	if (contrast < params.contrast_threshold) {
+		rate = max(rate, vec2(contrast < params.contrast_threshold * 0.25 ? 2.0 : 1.0));
+	}
+
+	rate = clamp(rate, vec2(0.0), vec2(params.max_texel_factor));
+
+	// Note 1x4, 4x1, 1x8, 8x1, 2x8 and 8x2 are not supported:
+	rate.x = max(rate.x, rate.y - 1.0);
+	rate.y = max(rate.y, rate.x - 1.0);
+
+	// Output image shading rate image for VRS according to VK_KHR_fragment_shading_rate.
+	uint vrs = (uint(rate.x + 0.1) << 2) + uint(rate.y + 0.1);
+	imageStore(dest_vrs, pos, uvec4(vrs));
+}
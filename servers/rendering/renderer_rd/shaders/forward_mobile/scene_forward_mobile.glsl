@@ -521,6 +521,7 @@ layout(constant_id = 9) const bool sc_disable_omni_lights = false;
 layout(constant_id = 10) const bool sc_disable_spot_lights = false;
 layout(constant_id = 11) const bool sc_disable_reflection_probes = false;
 layout(constant_id = 12) const bool sc_disable_directional_lights = false;
+layout(constant_id = 18) const bool sc_use_light_tiles = false;
 
 #endif //!MODE_UNSHADED
 
@@ -1673,16 +1674,40 @@ void main() {
 
 	if (!sc_disable_omni_lights) { //omni lights
 		uint light_indices = instances.data[draw_call.instance_index].omni_lights.x;
-		for (uint i = 0; i < 8; i++) {
-			uint light_index = light_indices & 0xFF;
-			if (i == 3) {
-				light_indices = instances.data[draw_call.instance_index].omni_lights.y;
-			} else {
-				light_indices = light_indices >> 8;
-			}
+		uint light_count = 8;
+#ifdef USE_LIGHT_TILES
+		uint light_tile_ofs = 0;
+		if (sc_use_light_tiles) {
+			uvec2 light_tile = uvec2(gl_FragCoord.xy) >> light_tiles.data[0];
+			light_tile = min(light_tile, uvec2(light_tiles.data[1], light_tiles.data[2]) - 1);
+			light_tile_ofs = LIGHT_TILE_HEADER_SIZE + (light_tile.y * light_tiles.data[1] + light_tile.x) * LIGHT_TILE_STRIDE + 0;
+			light_count = 32;
+		}
+#endif
+		for (uint i = 0; i < light_count; i++) {
+			uint light_index;
+#ifdef USE_LIGHT_TILES
+			if (sc_use_light_tiles) {
+				light_index = (light_tiles.data[light_tile_ofs + (i >> 2)] >> ((i & 3) << 3)) & 0xFF;
+				if (light_index == 0xFF) {
+					break;
+				}
+				if (!bool(omni_lights.data[light_index].mask & instances.data[draw_call.instance_index].layer_mask)) {
+					continue;
+				}
+			} else
+#endif
+			{
+				light_index = light_indices & 0xFF;
+				if (i == 3) {
+					light_indices = instances.data[draw_call.instance_index].omni_lights.y;
+				} else {
+					light_indices = light_indices >> 8;
+				}
 
-			if (light_index == 0xFF) {
-				break;
+				if (light_index == 0xFF) {
+					break;
+				}
 			}
 
 			float shadow = light_process_omni_shadow(light_index, vertex, normal);
@@ -1718,16 +1743,40 @@ void main() {
 	if (!sc_disable_spot_lights) { //spot lights
 
 		uint light_indices = instances.data[draw_call.instance_index].spot_lights.x;
-		for (uint i = 0; i < 8; i++) {
-			uint light_index = light_indices & 0xFF;
-			if (i == 3) {
-				light_indices = instances.data[draw_call.instance_index].spot_lights.y;
-			} else {
-				light_indices = light_indices >> 8;
-			}
+		uint light_count = 8;
+#ifdef USE_LIGHT_TILES
+		uint light_tile_ofs = 0;
+		if (sc_use_light_tiles) {
+			uvec2 light_tile = uvec2(gl_FragCoord.xy) >> light_tiles.data[0];
+			light_tile = min(light_tile, uvec2(light_tiles.data[1], light_tiles.data[2]) - 1);
+			light_tile_ofs = LIGHT_TILE_HEADER_SIZE + (light_tile.y * light_tiles.data[1] + light_tile.x) * LIGHT_TILE_STRIDE + 8;
+			light_count = 32;
+		}
+#endif
+		for (uint i = 0; i < light_count; i++) {
+			uint light_index;
+#ifdef USE_LIGHT_TILES
+			if (sc_use_light_tiles) {
+				light_index = (light_tiles.data[light_tile_ofs + (i >> 2)] >> ((i & 3) << 3)) & 0xFF;
+				if (light_index == 0xFF) {
+					break;
+				}
+				if (!bool(spot_lights.data[light_index].mask & instances.data[draw_call.instance_index].layer_mask)) {
+					continue;
+				}
+			} else
+#endif
+			{
+				light_index = light_indices & 0xFF;
+				if (i == 3) {
+					light_indices = instances.data[draw_call.instance_index].spot_lights.y;
+				} else {
+					light_indices = light_indices >> 8;
+				}
 
-			if (light_index == 0xFF) {
-				break;
+				if (light_index == 0xFF) {
+					break;
+				}
 			}
 
 			float shadow = light_process_spot_shadow(light_index, vertex, normal);
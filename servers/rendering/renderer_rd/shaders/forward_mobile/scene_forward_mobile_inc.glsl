@@ -181,6 +181,18 @@ layout(set = 1, binding = 13 + 9) uniform sampler SAMPLER_LINEAR_WITH_MIPMAPS_RE
 layout(set = 1, binding = 13 + 10) uniform sampler SAMPLER_NEAREST_WITH_MIPMAPS_ANISOTROPIC_REPEAT;
 layout(set = 1, binding = 13 + 11) uniform sampler SAMPLER_LINEAR_WITH_MIPMAPS_ANISOTROPIC_REPEAT;
 
+#ifdef USE_LIGHT_TILES
+// Header: tile size shift, tile count in X, tile count in Y, padding.
+// Each tile then stores 8 words of packed omni light indices followed by 8 words of packed spot light indices, 0xFF terminated.
+#define LIGHT_TILE_HEADER_SIZE 4
+#define LIGHT_TILE_STRIDE 16
+
+layout(set = 1, binding = 13 + 12, std430) restrict readonly buffer LightTiles {
+	uint data[];
+}
+light_tiles;
+#endif
+
 /* Set 2 Skeleton & Instancing (can change per item) */
 
 layout(set = 2, binding = 0, std430) restrict readonly buffer Transforms {
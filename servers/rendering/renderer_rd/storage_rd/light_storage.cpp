@@ -1998,7 +1998,7 @@ void LightStorage::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = shadow_atlas->size;
 		tf.height = shadow_atlas->size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		shadow_atlas->depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
@@ -2022,6 +2022,10 @@ void LightStorage::shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits
 		RD::get_singleton()->free(shadow_atlas->depth);
 		shadow_atlas->depth = RID();
 	}
+	if (shadow_atlas->static_depth.is_valid()) {
+		RD::get_singleton()->free(shadow_atlas->static_depth);
+		shadow_atlas->static_depth = RID();
+	}
 	for (int i = 0; i < 4; i++) {
 		//clear subdivisions
 		shadow_atlas->quadrants[i].shadows.clear();
@@ -2332,6 +2336,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 		sh->owner = p_light_instance;
 		sh->alloc_tick = tick;
 		sh->version = p_light_version;
+		sh->static_version = 0;
 
 		if (is_omni) {
 			new_key |= OMNI_LIGHT_FLAG;
@@ -2343,6 +2348,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 			extra_sh->owner = p_light_instance;
 			extra_sh->alloc_tick = tick;
 			extra_sh->version = p_light_version;
+			extra_sh->static_version = 0;
 		}
 
 		li->shadow_atlases.insert(p_atlas);
@@ -2376,6 +2382,57 @@ void LightStorage::_shadow_atlas_invalidate_shadow(ShadowAtlas::Quadrant::Shadow
 	}
 }
 
+RID LightStorage::shadow_atlas_get_static_texture(RID p_atlas) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_NULL_V(shadow_atlas, RID());
+	return shadow_atlas->static_depth;
+}
+
+RID LightStorage::shadow_atlas_get_static_fb(RID p_atlas) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_NULL_V(shadow_atlas, RID());
+	ERR_FAIL_COND_V(shadow_atlas->size == 0, RID());
+
+	if (shadow_atlas->static_depth.is_null()) {
+		RD::TextureFormat tf;
+		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
+		tf.width = shadow_atlas->size;
+		tf.height = shadow_atlas->size;
+		tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
+
+		shadow_atlas->static_depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		Vector<RID> fb_tex;
+		fb_tex.push_back(shadow_atlas->static_depth);
+		shadow_atlas->static_fb = RD::get_singleton()->framebuffer_create(fb_tex);
+	}
+
+	return shadow_atlas->static_fb;
+}
+
+uint64_t LightStorage::shadow_atlas_get_light_instance_static_version(RID p_atlas, RID p_light_instance) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_NULL_V(shadow_atlas, 0);
+	const uint32_t *key = shadow_atlas->shadow_owners.getptr(p_light_instance);
+	ERR_FAIL_NULL_V(key, 0);
+
+	uint32_t quadrant = (*key >> QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = *key & SHADOW_INDEX_MASK;
+	ERR_FAIL_INDEX_V((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size(), 0);
+	return shadow_atlas->quadrants[quadrant].shadows[shadow].static_version;
+}
+
+void LightStorage::shadow_atlas_set_light_instance_static_version(RID p_atlas, RID p_light_instance, uint64_t p_version) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_NULL(shadow_atlas);
+	const uint32_t *key = shadow_atlas->shadow_owners.getptr(p_light_instance);
+	ERR_FAIL_NULL(key);
+
+	uint32_t quadrant = (*key >> QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = *key & SHADOW_INDEX_MASK;
+	ERR_FAIL_INDEX((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size());
+	shadow_atlas->quadrants[quadrant].shadows.write[shadow].static_version = p_version;
+}
+
 void LightStorage::shadow_atlas_update(RID p_atlas) {
 	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
 	ERR_FAIL_NULL(shadow_atlas);
@@ -381,6 +381,7 @@ private:
 				RID owner;
 				uint64_t version = 0;
 				uint64_t fog_version = 0; // used for fog
+				uint64_t static_version = 0; // version of the static casters in static_depth
 				uint64_t alloc_tick = 0;
 
 				Shadow() {}
@@ -400,6 +401,10 @@ private:
 		RID depth;
 		RID fb; //for copying
 
+		// Same layout as depth, holds only the static casters of each shadow (created on demand).
+		RID static_depth;
+		RID static_fb;
+
 		HashMap<RID, uint32_t> shadow_owners;
 	};
 
@@ -1073,6 +1078,11 @@ public:
 		return atlas->fb;
 	}
 
+	RID shadow_atlas_get_static_texture(RID p_atlas);
+	RID shadow_atlas_get_static_fb(RID p_atlas);
+	uint64_t shadow_atlas_get_light_instance_static_version(RID p_atlas, RID p_light_instance);
+	void shadow_atlas_set_light_instance_static_version(RID p_atlas, RID p_light_instance, uint64_t p_version);
+
 	virtual void shadow_atlas_update(RID p_atlas) override;
 
 	/* DIRECTIONAL SHADOW */
@@ -747,8 +747,8 @@ MaterialStorage::MaterialData::~MaterialData() {
 	}
 
 	for (int i = 0; i < 2; i++) {
-		if (uniform_buffer[i].is_valid()) {
-			RD::get_singleton()->free(uniform_buffer[i]);
+		if (shared_uniform_set[i]) {
+			material_storage->_shared_uniform_set_release(shared_uniform_set[i], self);
 		}
 	}
 }
@@ -983,38 +983,44 @@ void MaterialStorage::MaterialData::update_textures(const HashMap<StringName, Va
 }
 
 void MaterialStorage::MaterialData::free_parameters_uniform_set(RID p_uniform_set) {
+	for (int i = 0; i < 2; i++) {
+		if (shared_uniform_set[i] && shared_uniform_set[i]->uniform_set == p_uniform_set) {
+			MaterialStorage::get_singleton()->_shared_uniform_set_release(shared_uniform_set[i], self);
+			shared_uniform_set[i] = nullptr;
+			return;
+		}
+	}
+
 	if (p_uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(p_uniform_set)) {
 		RD::get_singleton()->uniform_set_set_invalidation_callback(p_uniform_set, nullptr, nullptr);
 		RD::get_singleton()->free(p_uniform_set);
 	}
 }
 
+uint32_t MaterialStorage::MaterialData::get_sort_id() const {
+	const SharedUniformSet *shared = shared_uniform_set[1] ? shared_uniform_set[1] : shared_uniform_set[0];
+	if (shared) {
+		return shared->id;
+	}
+	// Shared set IDs never have the high bit set, so this can't collide with them.
+	return self.get_local_index() | 0x80000000;
+}
+
 bool MaterialStorage::MaterialData::update_parameters_uniform_set(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty, const HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> &p_uniforms, const uint32_t *p_uniform_offsets, const Vector<ShaderCompiler::GeneratedCode::Texture> &p_texture_uniforms, const HashMap<StringName, HashMap<int, RID>> &p_default_texture_params, uint32_t p_ubo_size, RID &uniform_set, RID p_shader, uint32_t p_shader_uniform_set, bool p_use_linear_color, bool p_3d_material) {
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	SharedUniformSet *&shared = shared_uniform_set[p_use_linear_color];
+
 	if ((uint32_t)ubo_data[p_use_linear_color].size() != p_ubo_size) {
 		p_uniform_dirty = true;
-		if (uniform_buffer[p_use_linear_color].is_valid()) {
-			RD::get_singleton()->free(uniform_buffer[p_use_linear_color]);
-			uniform_buffer[p_use_linear_color] = RID();
-		}
-
 		ubo_data[p_use_linear_color].resize(p_ubo_size);
 		if (ubo_data[p_use_linear_color].size()) {
-			uniform_buffer[p_use_linear_color] = RD::get_singleton()->uniform_buffer_create(ubo_data[p_use_linear_color].size());
 			memset(ubo_data[p_use_linear_color].ptrw(), 0, ubo_data[p_use_linear_color].size()); //clear
 		}
-
-		//clear previous uniform set
-		if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-			RD::get_singleton()->uniform_set_set_invalidation_callback(uniform_set, nullptr, nullptr);
-			RD::get_singleton()->free(uniform_set);
-			uniform_set = RID();
-		}
 	}
 
 	//check whether buffer changed
 	if (p_uniform_dirty && ubo_data[p_use_linear_color].size()) {
 		update_uniform_buffer(p_uniforms, p_uniform_offsets, p_parameters, ubo_data[p_use_linear_color].ptrw(), ubo_data[p_use_linear_color].size(), p_use_linear_color);
-		RD::get_singleton()->buffer_update(uniform_buffer[p_use_linear_color], 0, ubo_data[p_use_linear_color].size(), ubo_data[p_use_linear_color].ptrw());
 	}
 
 	uint32_t tex_uniform_count = 0U;
@@ -1026,13 +1032,6 @@ bool MaterialStorage::MaterialData::update_parameters_uniform_set(const HashMap<
 		texture_cache.resize(tex_uniform_count);
 		render_target_cache.clear();
 		p_textures_dirty = true;
-
-		//clear previous uniform set
-		if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-			RD::get_singleton()->uniform_set_set_invalidation_callback(uniform_set, nullptr, nullptr);
-			RD::get_singleton()->free(uniform_set);
-			uniform_set = RID();
-		}
 	}
 
 	if (p_textures_dirty && tex_uniform_count) {
@@ -1041,46 +1040,53 @@ bool MaterialStorage::MaterialData::update_parameters_uniform_set(const HashMap<
 
 	if (p_ubo_size == 0 && (p_texture_uniforms.size() == 0)) {
 		// This material does not require an uniform set, so don't create it.
+		if (shared) {
+			material_storage->_shared_uniform_set_release(shared, self);
+			shared = nullptr;
+		}
+		uniform_set = RID();
 		return false;
 	}
 
-	if (!p_textures_dirty && uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-		//no reason to update uniform set, only UBO (or nothing) was needed to update
+	const bool shared_valid = shared && shared->uniform_set.is_valid() && shared->shader == p_shader && shared->shader_uniform_set == p_shader_uniform_set;
+	if (!p_uniform_dirty && !p_textures_dirty && shared_valid) {
+		//no reason to update uniform set
 		return false;
 	}
 
-	Vector<RD::Uniform> uniforms;
-
-	{
-		if (p_ubo_size) {
-			RD::Uniform u;
-			u.uniform_type = RD::UNIFORM_TYPE_UNIFORM_BUFFER;
-			u.binding = 0;
-			u.append_id(uniform_buffer[p_use_linear_color]);
-			uniforms.push_back(u);
-		}
-
-		const RID *textures = texture_cache.ptrw();
-		for (int i = 0, k = 0; i < p_texture_uniforms.size(); i++) {
-			const int array_size = p_texture_uniforms[i].array_size;
+	const uint32_t hash = _shared_uniform_set_hash(p_shader, p_shader_uniform_set, ubo_data[p_use_linear_color], texture_cache);
+	if (shared_valid && shared->hash == hash && shared->ubo_data == ubo_data[p_use_linear_color] && shared->textures == texture_cache) {
+		// Parameters were set, but to the values already in use.
+		return false;
+	}
 
-			RD::Uniform u;
-			u.uniform_type = RD::UNIFORM_TYPE_TEXTURE;
-			u.binding = 1 + k;
-			if (array_size > 0) {
-				for (int j = 0; j < array_size; j++) {
-					u.append_id(textures[k++]);
-				}
-			} else {
-				u.append_id(textures[k++]);
-			}
-			uniforms.push_back(u);
+	SharedUniformSet *existing = material_storage->_shared_uniform_set_find(p_shader, p_shader_uniform_set, ubo_data[p_use_linear_color], texture_cache, hash);
+	if (existing) {
+		if (shared) {
+			material_storage->_shared_uniform_set_release(shared, self);
 		}
+		shared = existing;
+		shared->materials.push_back(self);
+		uniform_set = shared->uniform_set;
+		return true;
 	}
 
-	uniform_set = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_shader_uniform_set);
+	if (shared_valid && shared->materials.size() == 1 && shared->textures == texture_cache && shared->ubo_data.size() == ubo_data[p_use_linear_color].size()) {
+		// Only the UBO contents changed and no other material uses this set, so update it in place.
+		material_storage->_shared_uniform_set_unregister(shared);
+		shared->ubo_data = ubo_data[p_use_linear_color];
+		shared->hash = hash;
+		material_storage->_shared_uniform_set_register(shared);
+		RD::get_singleton()->buffer_update(shared->uniform_buffer, 0, shared->ubo_data.size(), shared->ubo_data.ptr());
+		return false;
+	}
 
-	RD::get_singleton()->uniform_set_set_invalidation_callback(uniform_set, MaterialStorage::_material_uniform_set_erased, &self);
+	if (shared) {
+		material_storage->_shared_uniform_set_release(shared, self);
+	}
+	shared = material_storage->_shared_uniform_set_create(p_shader, p_shader_uniform_set, ubo_data[p_use_linear_color], texture_cache, p_texture_uniforms, hash);
+	shared->materials.push_back(self);
+	uniform_set = shared->uniform_set;
 
 	return true;
 }
@@ -1888,6 +1894,7 @@ void MaterialStorage::shader_set_code(RID p_shader, const String &p_code) {
 
 		if (new_type < SHADER_TYPE_MAX && shader_data_request_func[new_type]) {
 			shader->data = shader_data_request_func[new_type]();
+			shader->data->self = p_shader;
 		} else {
 			shader->type = SHADER_TYPE_MAX; //invalid
 		}
@@ -1917,6 +1924,13 @@ void MaterialStorage::shader_set_code(RID p_shader, const String &p_code) {
 		shader->data->set_code(p_code);
 	}
 
+	shader_notify_data_changed(p_shader);
+}
+
+void MaterialStorage::shader_notify_data_changed(RID p_shader) {
+	Shader *shader = shader_owner.get_or_null(p_shader);
+	ERR_FAIL_NULL(shader);
+
 	for (Material *E : shader->owners) {
 		Material *material = E;
 		material->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MATERIAL);
@@ -2023,6 +2037,134 @@ void MaterialStorage::_material_uniform_set_erased(void *p_material) {
 	}
 }
 
+uint32_t MaterialStorage::_shared_uniform_set_hash(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures) {
+	uint32_t h = hash_murmur3_one_64(p_shader.get_id());
+	h = hash_murmur3_one_32(p_shader_uniform_set, h);
+	h = hash_murmur3_buffer(p_ubo_data.ptr(), p_ubo_data.size(), h);
+	for (const RID &texture : p_textures) {
+		h = hash_murmur3_one_64(texture.get_id(), h);
+	}
+	return hash_fmix32(h);
+}
+
+MaterialStorage::SharedUniformSet *MaterialStorage::_shared_uniform_set_find(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures, uint32_t p_hash) {
+	LocalVector<SharedUniformSet *> *bucket = shared_uniform_sets.getptr(p_hash);
+	if (!bucket) {
+		return nullptr;
+	}
+
+	for (SharedUniformSet *shared : *bucket) {
+		if (shared->shader == p_shader && shared->shader_uniform_set == p_shader_uniform_set && shared->ubo_data == p_ubo_data && shared->textures == p_textures) {
+			return shared;
+		}
+	}
+
+	return nullptr;
+}
+
+MaterialStorage::SharedUniformSet *MaterialStorage::_shared_uniform_set_create(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures, const Vector<ShaderCompiler::GeneratedCode::Texture> &p_texture_uniforms, uint32_t p_hash) {
+	SharedUniformSet *shared = memnew(SharedUniformSet);
+	shared->shader = p_shader;
+	shared->shader_uniform_set = p_shader_uniform_set;
+	shared->ubo_data = p_ubo_data;
+	shared->textures = p_textures;
+	shared->hash = p_hash;
+	shared_uniform_set_id = (shared_uniform_set_id + 1) & 0x7FFFFFFF;
+	if (shared_uniform_set_id == 0) {
+		shared_uniform_set_id = 1;
+	}
+	shared->id = shared_uniform_set_id;
+
+	Vector<RD::Uniform> uniforms;
+
+	if (p_ubo_data.size()) {
+		shared->uniform_buffer = RD::get_singleton()->uniform_buffer_create(p_ubo_data.size(), p_ubo_data);
+
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_UNIFORM_BUFFER;
+		u.binding = 0;
+		u.append_id(shared->uniform_buffer);
+		uniforms.push_back(u);
+	}
+
+	const RID *textures = p_textures.ptr();
+	for (int i = 0, k = 0; i < p_texture_uniforms.size(); i++) {
+		const int array_size = p_texture_uniforms[i].array_size;
+
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_TEXTURE;
+		u.binding = 1 + k;
+		if (array_size > 0) {
+			for (int j = 0; j < array_size; j++) {
+				u.append_id(textures[k++]);
+			}
+		} else {
+			u.append_id(textures[k++]);
+		}
+		uniforms.push_back(u);
+	}
+
+	shared->uniform_set = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_shader_uniform_set);
+	RD::get_singleton()->uniform_set_set_invalidation_callback(shared->uniform_set, MaterialStorage::_shared_uniform_set_erased, shared);
+
+	_shared_uniform_set_register(shared);
+
+	return shared;
+}
+
+void MaterialStorage::_shared_uniform_set_register(SharedUniformSet *p_shared) {
+	DEV_ASSERT(!p_shared->registered);
+	if (!shared_uniform_sets.has(p_shared->hash)) {
+		shared_uniform_sets.insert(p_shared->hash, LocalVector<SharedUniformSet *>());
+	}
+	shared_uniform_sets[p_shared->hash].push_back(p_shared);
+	p_shared->registered = true;
+}
+
+void MaterialStorage::_shared_uniform_set_unregister(SharedUniformSet *p_shared) {
+	if (!p_shared->registered) {
+		return;
+	}
+
+	LocalVector<SharedUniformSet *> *bucket = shared_uniform_sets.getptr(p_shared->hash);
+	ERR_FAIL_NULL(bucket);
+	bucket->erase(p_shared);
+	if (bucket->is_empty()) {
+		shared_uniform_sets.erase(p_shared->hash);
+	}
+	p_shared->registered = false;
+}
+
+void MaterialStorage::_shared_uniform_set_release(SharedUniformSet *p_shared, RID p_material) {
+	p_shared->materials.erase(p_material);
+	if (!p_shared->materials.is_empty()) {
+		return;
+	}
+
+	_shared_uniform_set_unregister(p_shared);
+
+	if (p_shared->uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(p_shared->uniform_set)) {
+		RD::get_singleton()->uniform_set_set_invalidation_callback(p_shared->uniform_set, nullptr, nullptr);
+		RD::get_singleton()->free(p_shared->uniform_set);
+	}
+	if (p_shared->uniform_buffer.is_valid()) {
+		RD::get_singleton()->free(p_shared->uniform_buffer);
+	}
+
+	memdelete(p_shared);
+}
+
+void MaterialStorage::_shared_uniform_set_erased(void *p_shared) {
+	SharedUniformSet *shared = static_cast<SharedUniformSet *>(p_shared);
+	shared->uniform_set = RID();
+
+	// A dependency such as a texture was freed, stop handing this set out and let every user re-create its own.
+	MaterialStorage::get_singleton()->_shared_uniform_set_unregister(shared);
+	for (RID &material : shared->materials) {
+		_material_uniform_set_erased(&material);
+	}
+}
+
 void MaterialStorage::_material_queue_update(Material *material, bool p_uniform, bool p_texture) {
 	material->uniform_dirty = material->uniform_dirty || p_uniform;
 	material->texture_dirty = material->texture_dirty || p_texture;
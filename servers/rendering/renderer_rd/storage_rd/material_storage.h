@@ -56,6 +56,7 @@ public:
 	};
 
 	struct ShaderData {
+		RID self;
 		String path;
 		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
 		HashMap<StringName, HashMap<int, RID>> default_texture_params;
@@ -75,6 +76,21 @@ public:
 		virtual ~ShaderData() {}
 	};
 
+	// A uniform buffer and uniform set owned by every material using the same shader, parameter values and textures.
+	struct SharedUniformSet {
+		RID shader;
+		uint32_t shader_uniform_set = 0;
+		Vector<uint8_t> ubo_data;
+		Vector<RID> textures;
+		uint32_t hash = 0;
+
+		RID uniform_buffer;
+		RID uniform_set;
+		uint32_t id = 0;
+		bool registered = false;
+		LocalVector<RID> materials;
+	};
+
 	struct MaterialData {
 		Vector<RendererRD::TextureStorage::RenderTarget *> render_target_cache;
 		void update_uniform_buffer(const HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> &p_uniforms, const uint32_t *p_uniform_offsets, const HashMap<StringName, Variant> &p_parameters, uint8_t *p_buffer, uint32_t p_buffer_size, bool p_use_linear_color);
@@ -90,6 +106,9 @@ public:
 		bool update_parameters_uniform_set(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty, const HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> &p_uniforms, const uint32_t *p_uniform_offsets, const Vector<ShaderCompiler::GeneratedCode::Texture> &p_texture_uniforms, const HashMap<StringName, HashMap<int, RID>> &p_default_texture_params, uint32_t p_ubo_size, RID &r_uniform_set, RID p_shader, uint32_t p_shader_uniform_set, bool p_use_linear_color, bool p_3d_material);
 		void free_parameters_uniform_set(RID p_uniform_set);
 
+		// Materials whose parameters end up identical share a uniform set, and therefore this ID, so renderers can sort and draw them together.
+		uint32_t get_sort_id() const;
+
 	private:
 		friend class MaterialStorage;
 
@@ -101,7 +120,7 @@ public:
 
 		//internally by update_parameters_uniform_set
 		Vector<uint8_t> ubo_data[2]; // 0: linear buffer; 1: sRGB buffer.
-		RID uniform_buffer[2]; // 0: linear buffer; 1: sRGB buffer.
+		SharedUniformSet *shared_uniform_set[2] = {}; // 0: linear buffer; 1: sRGB buffer.
 		Vector<RID> texture_cache;
 	};
 
@@ -247,6 +266,17 @@ private:
 
 	static void _material_uniform_set_erased(void *p_material);
 
+	HashMap<uint32_t, LocalVector<SharedUniformSet *>> shared_uniform_sets;
+	uint32_t shared_uniform_set_id = 0;
+
+	static uint32_t _shared_uniform_set_hash(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures);
+	SharedUniformSet *_shared_uniform_set_find(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures, uint32_t p_hash);
+	SharedUniformSet *_shared_uniform_set_create(RID p_shader, uint32_t p_shader_uniform_set, const Vector<uint8_t> &p_ubo_data, const Vector<RID> &p_textures, const Vector<ShaderCompiler::GeneratedCode::Texture> &p_texture_uniforms, uint32_t p_hash);
+	void _shared_uniform_set_register(SharedUniformSet *p_shared);
+	void _shared_uniform_set_unregister(SharedUniformSet *p_shared);
+	void _shared_uniform_set_release(SharedUniformSet *p_shared, RID p_material);
+	static void _shared_uniform_set_erased(void *p_shared);
+
 public:
 	static MaterialStorage *get_singleton();
 
@@ -404,6 +434,8 @@ public:
 	virtual RID shader_get_default_texture_parameter(RID p_shader, const StringName &p_name, int p_index) const override;
 	virtual Variant shader_get_parameter_default(RID p_shader, const StringName &p_param) const override;
 	void shader_set_data_request_function(ShaderType p_shader_type, ShaderDataRequestFunction p_function);
+	// For renderers that finish setting up their shader data after set_code() returned, e.g. when compiling in the background.
+	void shader_notify_data_changed(RID p_shader);
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override;
 
@@ -1041,7 +1041,7 @@ void MeshStorage::update_mesh_instances() {
 	//process skeletons and blend shapes
 	uint64_t frame = RSG::rasterizer->get_frame_number();
 	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
-	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	skinning_jobs.clear();
 
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
@@ -1075,69 +1075,96 @@ void MeshStorage::update_mesh_instances() {
 				continue;
 			}
 
-			bool array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
+			SkinningJob job;
+			job.mesh_instance = mi;
+			job.skeleton = sk;
+			job.surface = i;
+			job.array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
+			job.instance_uniform_set = mi_surface_uniform_set;
+			job.surface_uniform_set = mi->mesh->surfaces[i]->uniform_set;
+			job.skeleton_uniform_set = (sk && sk->uniform_set_mi.is_valid()) ? sk->uniform_set_mi : skeleton_shader.default_skeleton_uniform_set;
+			skinning_jobs.push_back(job);
+		}
 
-			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
+		mi->dirty = false;
+		if (sk) {
+			mi->skeleton_version = sk->version;
+		}
+		dirty_mesh_instance_arrays.remove(&mi->array_update_list);
+	}
 
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi_surface_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi->mesh->surfaces[i]->uniform_set, SkeletonShader::UNIFORM_SET_SURFACE);
-			if (sk && sk->uniform_set_mi.is_valid()) {
-				RD::get_singleton()->compute_list_bind_uniform_set(compute_list, sk->uniform_set_mi, SkeletonShader::UNIFORM_SET_SKELETON);
-			} else {
-				RD::get_singleton()->compute_list_bind_uniform_set(compute_list, skeleton_shader.default_skeleton_uniform_set, SkeletonShader::UNIFORM_SET_SKELETON);
-			}
+	if (skinning_jobs.is_empty()) {
+		return;
+	}
 
-			SkeletonShader::PushConstant push_constant;
+	skinning_jobs.sort();
 
-			push_constant.has_normal = mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_NORMAL;
-			push_constant.has_tangent = mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_TANGENT;
-			push_constant.has_skeleton = sk != nullptr && sk->use_2d == array_is_2d && (mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_BONES);
-			push_constant.has_blend_shape = mi->mesh->blend_shape_count > 0;
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RID bound_surface_uniform_set;
+	RID bound_skeleton_uniform_set;
 
-			push_constant.normal_tangent_stride = (push_constant.has_normal ? 1 : 0) + (push_constant.has_tangent ? 1 : 0);
+	for (const SkinningJob &job : skinning_jobs) {
+		MeshInstance *mi = job.mesh_instance;
+		Skeleton *sk = job.skeleton;
+		const Mesh::Surface *surface = mi->mesh->surfaces[job.surface];
 
-			push_constant.vertex_count = mi->mesh->surfaces[i]->vertex_count;
-			push_constant.vertex_stride = ((mi->mesh->surfaces[i]->vertex_buffer_size / mi->mesh->surfaces[i]->vertex_count) / 4) - push_constant.normal_tangent_stride;
-			push_constant.skin_stride = (mi->mesh->surfaces[i]->skin_buffer_size / mi->mesh->surfaces[i]->vertex_count) / 4;
-			push_constant.skin_weight_offset = (mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_8_BONE_WEIGHTS) ? 4 : 2;
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[job.array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
 
-			Transform2D transform = Transform2D();
-			if (sk && sk->use_2d) {
-				transform = mi->canvas_item_transform_2d.affine_inverse() * sk->base_transform_2d;
-			}
-			push_constant.skeleton_transform_x[0] = transform.columns[0][0];
-			push_constant.skeleton_transform_x[1] = transform.columns[0][1];
-			push_constant.skeleton_transform_y[0] = transform.columns[1][0];
-			push_constant.skeleton_transform_y[1] = transform.columns[1][1];
-			push_constant.skeleton_transform_offset[0] = transform.columns[2][0];
-			push_constant.skeleton_transform_offset[1] = transform.columns[2][1];
-
-			Transform2D inverse_transform = transform.affine_inverse();
-			push_constant.inverse_transform_x[0] = inverse_transform.columns[0][0];
-			push_constant.inverse_transform_x[1] = inverse_transform.columns[0][1];
-			push_constant.inverse_transform_y[0] = inverse_transform.columns[1][0];
-			push_constant.inverse_transform_y[1] = inverse_transform.columns[1][1];
-			push_constant.inverse_transform_offset[0] = inverse_transform.columns[2][0];
-			push_constant.inverse_transform_offset[1] = inverse_transform.columns[2][1];
-
-			push_constant.blend_shape_count = mi->mesh->blend_shape_count;
-			push_constant.normalized_blend_shapes = mi->mesh->blend_shape_mode == RS::BLEND_SHAPE_MODE_NORMALIZED;
-			push_constant.pad1 = 0;
-
-			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SkeletonShader::PushConstant));
-
-			//dispatch without barrier, so all is done at the same time
-			RD::get_singleton()->compute_list_dispatch_threads(compute_list, push_constant.vertex_count, 1, 1);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.instance_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
+		if (job.surface_uniform_set != bound_surface_uniform_set) {
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.surface_uniform_set, SkeletonShader::UNIFORM_SET_SURFACE);
+			bound_surface_uniform_set = job.surface_uniform_set;
+		}
+		if (job.skeleton_uniform_set != bound_skeleton_uniform_set) {
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.skeleton_uniform_set, SkeletonShader::UNIFORM_SET_SKELETON);
+			bound_skeleton_uniform_set = job.skeleton_uniform_set;
 		}
 
-		mi->dirty = false;
-		if (sk) {
-			mi->skeleton_version = sk->version;
+		SkeletonShader::PushConstant push_constant;
+
+		push_constant.has_normal = surface->format & RS::ARRAY_FORMAT_NORMAL;
+		push_constant.has_tangent = surface->format & RS::ARRAY_FORMAT_TANGENT;
+		push_constant.has_skeleton = sk != nullptr && sk->use_2d == job.array_is_2d && (surface->format & RS::ARRAY_FORMAT_BONES);
+		push_constant.has_blend_shape = mi->mesh->blend_shape_count > 0;
+
+		push_constant.normal_tangent_stride = (push_constant.has_normal ? 1 : 0) + (push_constant.has_tangent ? 1 : 0);
+
+		push_constant.vertex_count = surface->vertex_count;
+		push_constant.vertex_stride = ((surface->vertex_buffer_size / surface->vertex_count) / 4) - push_constant.normal_tangent_stride;
+		push_constant.skin_stride = (surface->skin_buffer_size / surface->vertex_count) / 4;
+		push_constant.skin_weight_offset = (surface->format & RS::ARRAY_FLAG_USE_8_BONE_WEIGHTS) ? 4 : 2;
+
+		Transform2D transform = Transform2D();
+		if (sk && sk->use_2d) {
+			transform = mi->canvas_item_transform_2d.affine_inverse() * sk->base_transform_2d;
 		}
-		dirty_mesh_instance_arrays.remove(&mi->array_update_list);
+		push_constant.skeleton_transform_x[0] = transform.columns[0][0];
+		push_constant.skeleton_transform_x[1] = transform.columns[0][1];
+		push_constant.skeleton_transform_y[0] = transform.columns[1][0];
+		push_constant.skeleton_transform_y[1] = transform.columns[1][1];
+		push_constant.skeleton_transform_offset[0] = transform.columns[2][0];
+		push_constant.skeleton_transform_offset[1] = transform.columns[2][1];
+
+		Transform2D inverse_transform = transform.affine_inverse();
+		push_constant.inverse_transform_x[0] = inverse_transform.columns[0][0];
+		push_constant.inverse_transform_x[1] = inverse_transform.columns[0][1];
+		push_constant.inverse_transform_y[0] = inverse_transform.columns[1][0];
+		push_constant.inverse_transform_y[1] = inverse_transform.columns[1][1];
+		push_constant.inverse_transform_offset[0] = inverse_transform.columns[2][0];
+		push_constant.inverse_transform_offset[1] = inverse_transform.columns[2][1];
+
+		push_constant.blend_shape_count = mi->mesh->blend_shape_count;
+		push_constant.normalized_blend_shapes = mi->mesh->blend_shape_mode == RS::BLEND_SHAPE_MODE_NORMALIZED;
+		push_constant.pad1 = 0;
+
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SkeletonShader::PushConstant));
+
+		//dispatch without barrier, so all is done at the same time
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, push_constant.vertex_count, 1, 1);
 	}
 
 	RD::get_singleton()->compute_list_end();
+	skinning_jobs.clear();
 }
 
 void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint64_t p_input_mask, bool p_input_motion_vectors, MeshInstance::Surface *mis, uint32_t p_current_buffer, uint32_t p_previous_buffer) {
@@ -330,6 +330,31 @@ private:
 
 	Skeleton *skeleton_dirty_list = nullptr;
 
+	// One skinning dispatch for a mesh instance surface. The dispatches of a frame are sorted so
+	// that consecutive ones share their pipeline and mesh surface, and the uniform sets that don't
+	// change between them are not bound again.
+	struct SkinningJob {
+		MeshInstance *mesh_instance = nullptr;
+		Skeleton *skeleton = nullptr;
+		uint32_t surface = 0;
+		bool array_is_2d = false;
+		RID instance_uniform_set;
+		RID surface_uniform_set;
+		RID skeleton_uniform_set;
+
+		bool operator<(const SkinningJob &p_job) const {
+			if (array_is_2d != p_job.array_is_2d) {
+				return array_is_2d;
+			}
+			if (surface_uniform_set != p_job.surface_uniform_set) {
+				return surface_uniform_set < p_job.surface_uniform_set;
+			}
+			return skeleton_uniform_set < p_job.skeleton_uniform_set;
+		}
+	};
+
+	LocalVector<SkinningJob> skinning_jobs;
+
 	enum AttributeLocation {
 		ATTRIBUTE_LOCATION_PREV_VERTEX = 12,
 		ATTRIBUTE_LOCATION_PREV_NORMAL = 13,
@@ -242,6 +242,15 @@ private:
 		float interp_to_end = 0.0;
 		float amount_ratio = 1.0;
 
+		// Emission is scaled down beyond this distance to the closest camera that saw the particles.
+		float emission_lod_distance = 0.0;
+		float view_distance = FLT_MAX;
+		float lod_amount_ratio = 1.0;
+
+		// Used to simulate the time missed while the particles were culled.
+		uint64_t last_process_frame = 0;
+		double last_process_time = 0.0;
+
 		Vector<uint8_t> emission_buffer_data;
 
 		ParticleEmissionBuffer *emission_buffer = nullptr;
@@ -333,6 +342,7 @@ private:
 	} particles_shader;
 
 	SelfList<Particles>::List particle_update_list;
+	double culled_catch_up_time = 0.0;
 
 	mutable RID_Owner<Particles, true> particles_owner;
 
@@ -436,6 +446,7 @@ public:
 	virtual void particles_set_emitting(RID p_particles, bool p_emitting) override;
 	virtual void particles_set_amount(RID p_particles, int p_amount) override;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) override;
+	virtual void particles_set_emission_lod_distance(RID p_particles, float p_distance) override;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) override;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) override;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) override;
@@ -479,6 +490,7 @@ public:
 	virtual RID particles_get_draw_pass_mesh(RID p_particles, int p_pass) const override;
 
 	virtual void particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) override;
+	virtual void particles_set_view_distance(RID p_particles, float p_distance) override;
 
 	virtual bool particles_is_inactive(RID p_particles) const override;
 
@@ -93,14 +93,83 @@ void RenderSceneBuffersRD::update_sizes(NamedTexture &p_named_texture) {
 	}
 }
 
-void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
-	if (p_named_texture.texture.is_valid()) {
+void RenderSceneBuffersRD::free_named_texture(const StringName &p_context, NamedTexture &p_named_texture) {
+	if (p_named_texture.is_transient) {
+		// The pooled texture outlives us, so our slices won't be freed as its dependents.
+		for (const KeyValue<NTSliceKey, RID> &E : p_named_texture.slices) {
+			RD::get_singleton()->free(E.value);
+		}
+		_release_transient_texture(p_context, p_named_texture.texture);
+	} else if (p_named_texture.texture.is_valid()) {
 		RD::get_singleton()->free(p_named_texture.texture);
 	}
 	p_named_texture.texture = RID();
 	p_named_texture.slices.clear(); // slices should be freed automatically as dependents...
 }
 
+// Transient textures
+
+LocalVector<RenderSceneBuffersRD::TransientTexture *> RenderSceneBuffersRD::transient_textures;
+
+RID RenderSceneBuffersRD::_acquire_transient_texture(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format) {
+	for (TransientTexture *transient : transient_textures) {
+		if (!(transient->format == p_texture_format) || transient->format.is_resolve_buffer != p_texture_format.is_resolve_buffer) {
+			continue;
+		}
+
+		bool used_by_context = false;
+		for (const TransientTextureUser &user : transient->users) {
+			if (user.render_buffers == this && user.context == p_context) {
+				used_by_context = true;
+				break;
+			}
+		}
+
+		if (!used_by_context) {
+			transient->users.push_back({ this, p_context });
+			return transient->texture;
+		}
+	}
+
+	TransientTexture *transient = memnew(TransientTexture);
+	transient->format = p_texture_format;
+	transient->texture = RD::get_singleton()->texture_create(p_texture_format, RD::TextureView());
+	transient->users.push_back({ this, p_context });
+	transient_textures.push_back(transient);
+
+	Array arr;
+	arr.push_back(p_context);
+	arr.push_back(p_texture_name);
+	RD::get_singleton()->set_resource_name(transient->texture, String("RenderBuffer Transient {0}/{1}").format(arr));
+
+	return transient->texture;
+}
+
+void RenderSceneBuffersRD::_release_transient_texture(const StringName &p_context, RID p_texture) {
+	for (uint32_t i = 0; i < transient_textures.size(); i++) {
+		TransientTexture *transient = transient_textures[i];
+		if (transient->texture != p_texture) {
+			continue;
+		}
+
+		for (uint32_t j = 0; j < transient->users.size(); j++) {
+			if (transient->users[j].render_buffers == this && transient->users[j].context == p_context) {
+				transient->users.remove_at_unordered(j);
+				break;
+			}
+		}
+
+		if (transient->users.is_empty()) {
+			RD::get_singleton()->free(transient->texture);
+			memdelete(transient);
+			transient_textures.remove_at_unordered(i);
+		}
+		return;
+	}
+
+	ERR_FAIL_MSG("Transient texture is not in the pool.");
+}
+
 void RenderSceneBuffersRD::update_samplers() {
 	float computed_mipmap_bias = texture_mipmap_bias;
 
@@ -130,7 +199,7 @@ void RenderSceneBuffersRD::cleanup() {
 
 	// Clear our named textures
 	for (KeyValue<NTKey, NamedTexture> &E : named_textures) {
-		free_named_texture(E.value);
+		free_named_texture(E.key.context, E.value);
 	}
 	named_textures.clear();
 
@@ -327,8 +396,6 @@ RID RenderSceneBuffersRD::_create_texture_from_format(const StringName &p_contex
 }
 
 RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format, RD::TextureView p_view, bool p_unique) {
-	// TODO p_unique, if p_unique is true, this is a texture that can be shared. This will be implemented later as an optimization.
-
 	NTKey key(p_context, p_texture_name);
 
 	// check if this is a known texture
@@ -340,12 +407,19 @@ RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context
 	NamedTexture &named_texture = named_textures[key];
 	named_texture.format = p_texture_format;
 	named_texture.is_unique = p_unique;
-	named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
 
-	Array arr;
-	arr.push_back(p_context);
-	arr.push_back(p_texture_name);
-	RD::get_singleton()->set_resource_name(named_texture.texture, String("RenderBuffer {0}/{1}").format(arr));
+	if (!p_unique && p_view == RD::TextureView()) {
+		// Not unique, this texture can be shared with other contexts.
+		named_texture.is_transient = true;
+		named_texture.texture = _acquire_transient_texture(p_context, p_texture_name, p_texture_format);
+	} else {
+		named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
+
+		Array arr;
+		arr.push_back(p_context);
+		arr.push_back(p_texture_name);
+		RD::get_singleton()->set_resource_name(named_texture.texture, String("RenderBuffer {0}/{1}").format(arr));
+	}
 
 	update_sizes(named_texture);
 
@@ -508,7 +582,7 @@ void RenderSceneBuffersRD::clear_context(const StringName &p_context) {
 
 	// Now free these and remove them from our textures
 	for (NTKey &key : to_free) {
-		free_named_texture(named_textures[key]);
+		free_named_texture(key.context, named_textures[key]);
 		named_textures.erase(key);
 	}
 }
@@ -150,6 +150,7 @@ private:
 		// Cache the data used to create our texture
 		RD::TextureFormat format;
 		bool is_unique; // If marked as unique, we return it into our pool
+		bool is_transient = false; // Texture is owned by the transient pool.
 
 		// Our texture objects, slices are lazy (i.e. only created when requested).
 		RID texture;
@@ -159,7 +160,27 @@ private:
 
 	mutable HashMap<NTKey, NamedTexture, NTKey> named_textures;
 	void update_sizes(NamedTexture &p_named_texture);
-	void free_named_texture(NamedTexture &p_named_texture);
+	void free_named_texture(const StringName &p_context, NamedTexture &p_named_texture);
+
+	// Transient textures
+
+	// Textures that aren't unique only hold data while their context uses them, so they're taken from a pool shared by all render
+	// buffers. Contexts of any viewport share a texture with a matching format, but a context never gets the same texture twice.
+	// The render graph tracks the shared texture as a single resource and orders the contexts using it.
+	struct TransientTextureUser {
+		const RenderSceneBuffersRD *render_buffers = nullptr;
+		StringName context;
+	};
+
+	struct TransientTexture {
+		RD::TextureFormat format;
+		RID texture;
+		LocalVector<TransientTextureUser> users;
+	};
+
+	static LocalVector<TransientTexture *> transient_textures;
+	RID _acquire_transient_texture(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format);
+	void _release_transient_texture(const StringName &p_context, RID p_texture);
 
 	// Data buffers
 	mutable HashMap<StringName, Ref<RenderBufferCustomDataRD>> data_buffers;
@@ -193,27 +193,11 @@ AABB Utilities::visibility_notifier_get_aabb(RID p_notifier) const {
 	return vn->aabb;
 }
 
-void Utilities::visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) {
+Callable Utilities::visibility_notifier_get_callback(RID p_notifier, bool p_enter) const {
 	VisibilityNotifier *vn = visibility_notifier_owner.get_or_null(p_notifier);
-	ERR_FAIL_NULL(vn);
+	ERR_FAIL_NULL_V(vn, Callable());
 
-	if (p_enter) {
-		if (vn->enter_callback.is_valid()) {
-			if (p_deferred) {
-				vn->enter_callback.call_deferred();
-			} else {
-				vn->enter_callback.call();
-			}
-		}
-	} else {
-		if (vn->exit_callback.is_valid()) {
-			if (p_deferred) {
-				vn->exit_callback.call_deferred();
-			} else {
-				vn->exit_callback.call();
-			}
-		}
-	}
+	return p_enter ? vn->enter_callback : vn->exit_callback;
 }
 
 /* TIMING */
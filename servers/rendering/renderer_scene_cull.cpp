@@ -30,9 +30,12 @@
 
 #include "renderer_scene_cull.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/math/transform_interpolator.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "raster_occlusion_cull.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_default.h"
 
@@ -165,7 +168,11 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		light->geometries.insert(A);
 
 		if (geom->can_cast_shadows) {
-			light->make_shadow_dirty();
+			if (_is_static_shadow_caster(A)) {
+				light->make_static_shadow_dirty();
+			} else {
+				light->make_shadow_dirty();
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -272,7 +279,11 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		light->geometries.erase(A);
 
 		if (geom->can_cast_shadows) {
-			light->make_shadow_dirty();
+			if (_is_static_shadow_caster(A)) {
+				light->make_static_shadow_dirty();
+			} else {
+				light->make_shadow_dirty();
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -539,6 +550,7 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 			instance->mesh_instance = RID();
 			// no need to set instance data flag here, as it was freed above
 		}
+		instance->lod_stream = nullptr;
 
 		switch (instance->base_type) {
 			case RS::INSTANCE_MESH:
@@ -685,6 +697,10 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 				if (instance->lightmap_sh.size() == 9) {
 					geom->geometry_instance->set_lightmap_capture(instance->lightmap_sh.ptr());
 				}
+				if (instance->base_type == RS::INSTANCE_MESH) {
+					MeshLODStream **stream = mesh_lod_streams.getptr(p_base);
+					instance->lod_stream = stream ? *stream : nullptr;
+				}
 
 				for (Instance *E : instance->visibility_dependencies) {
 					Instance *dep_instance = E;
@@ -882,10 +898,7 @@ void RendererSceneCull::instance_set_layer_mask(RID p_instance, uint32_t p_mask)
 		geom->geometry_instance->set_layer_mask(p_mask);
 
 		if (geom->can_cast_shadows) {
-			for (HashSet<RendererSceneCull::Instance *>::Iterator I = geom->lights.begin(); I != geom->lights.end(); ++I) {
-				InstanceLightData *light = static_cast<InstanceLightData *>((*I)->base_data);
-				light->make_shadow_dirty();
-			}
+			_make_lights_shadow_dirty(instance, _is_static_shadow_caster(instance));
 		}
 	}
 }
@@ -924,8 +937,30 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
 
-	if (instance->transform == p_transform) {
-		return; //must be checked to avoid worst evil
+	if (!_interpolation_data.interpolation_enabled || !instance->interpolated) {
+		if (instance->transform == p_transform) {
+			return; //must be checked to avoid worst evil
+		}
+
+#ifdef DEBUG_ENABLED
+
+		for (int i = 0; i < 4; i++) {
+			const Vector3 &v = i < 3 ? p_transform.basis.rows[i] : p_transform.origin;
+			ERR_FAIL_COND(!v.is_finite());
+		}
+
+#endif
+		instance->transform = p_transform;
+		// Keep the tick transforms in sync, so turning interpolation on later doesn't start from a stale one.
+		instance->transform_prev = p_transform;
+		instance->transform_curr = p_transform;
+		_instance_queue_update(instance, true);
+		return;
+	}
+
+	// Even with no change, the instance has to stay on the tick list so its previous transform catches up.
+	if (instance->transform_curr == p_transform && instance->transform_prev == p_transform) {
+		return;
 	}
 
 #ifdef DEBUG_ENABLED
@@ -936,8 +971,20 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	}
 
 #endif
-	instance->transform = p_transform;
-	_instance_queue_update(instance, true);
+	instance->transform_curr = p_transform;
+
+	if (!instance->on_interpolate_transform_list) {
+		_interpolation_data.instance_transform_update_list_curr->push_back(p_instance);
+		instance->on_interpolate_transform_list = true;
+	} else {
+		DEV_ASSERT(_interpolation_data.instance_transform_update_list_curr->size() > 0);
+	}
+
+	// The rendered transform is interpolated for every frame in update_interpolation_frame().
+	if (!instance->on_interpolate_list) {
+		_interpolation_data.instance_interpolate_update_list.push_back(p_instance);
+		instance->on_interpolate_list = true;
+	}
 }
 
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
@@ -1101,6 +1148,36 @@ void RendererSceneCull::instance_set_ignore_culling(RID p_instance, bool p_enabl
 	}
 }
 
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+	instance->interpolated = p_interpolated;
+
+	if (!p_interpolated) {
+		// Drop to the latest submitted transform; the instance leaves the interpolate list on the next tick.
+		instance->transform_prev = instance->transform_curr;
+		if (instance->transform != instance->transform_curr) {
+			instance->transform = instance->transform_curr;
+			_instance_queue_update(instance, true);
+		}
+	}
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+
+	if (!_interpolation_data.interpolation_enabled || !instance->interpolated) {
+		return;
+	}
+
+	instance->transform_prev = instance->transform_curr;
+	if (instance->transform != instance->transform_curr) {
+		instance->transform = instance->transform_curr;
+		_instance_queue_update(instance, true);
+	}
+}
+
 Vector<ObjectID> RendererSceneCull::instances_cull_aabb(const AABB &p_aabb, RID p_scenario) const {
 	Vector<ObjectID> instances;
 	Scenario *scenario = scenario_owner.get_or_null(p_scenario);
@@ -1181,6 +1258,10 @@ void RendererSceneCull::instance_geometry_set_flag(RID p_instance, RS::InstanceF
 
 	switch (p_flags) {
 		case RS::INSTANCE_FLAG_USE_BAKED_LIGHT: {
+			if (instance->baked_light != p_enabled && ((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) && instance->base_data && static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows) {
+				// The caster moves between the static and dynamic shadow lists.
+				_make_lights_shadow_dirty(instance, true);
+			}
 			instance->baked_light = p_enabled;
 
 			if (instance->scenario && instance->array_index >= 0) {
@@ -1496,6 +1577,61 @@ void RendererSceneCull::instance_geometry_set_lod_bias(RID p_instance, float p_l
 	}
 }
 
+void RendererSceneCull::_update_mesh_lod_stream_instances(RID p_mesh, MeshLODStream *p_stream) {
+	// Only happens when a mesh starts or stops streaming, so going over every instance is fine.
+	List<RID> instances;
+	instance_owner.get_owned_list(&instances);
+	for (const RID &E : instances) {
+		Instance *instance = instance_owner.get_or_null(E);
+		if (instance->base_type != RS::INSTANCE_MESH || instance->base != p_mesh) {
+			continue;
+		}
+		instance->lod_stream = p_stream;
+		if (instance->scenario && instance->array_index >= 0) {
+			InstanceData &idata = instance->scenario->instance_data[instance->array_index];
+			if (p_stream) {
+				idata.flags |= InstanceData::FLAG_LOD_STREAM;
+			} else {
+				idata.flags &= ~uint32_t(InstanceData::FLAG_LOD_STREAM);
+			}
+		}
+	}
+}
+
+void RendererSceneCull::mesh_set_lod_streaming(RID p_mesh, bool p_enabled) {
+	MeshLODStream **stream = mesh_lod_streams.getptr(p_mesh);
+	if (p_enabled == (stream != nullptr)) {
+		return;
+	}
+
+	if (p_enabled) {
+		ERR_FAIL_COND(RSG::utilities->get_base_type(p_mesh) != RS::INSTANCE_MESH);
+		MeshLODStream *new_stream = memnew(MeshLODStream);
+		mesh_lod_streams.insert(p_mesh, new_stream);
+		_update_mesh_lod_stream_instances(p_mesh, new_stream);
+	} else {
+		_update_mesh_lod_stream_instances(p_mesh, nullptr);
+		memdelete(*stream);
+		mesh_lod_streams.erase(p_mesh);
+	}
+}
+
+Vector<float> RendererSceneCull::mesh_get_lod_stream_demands(const Vector<RID> &p_meshes) {
+	Vector<float> demands;
+	demands.resize(p_meshes.size());
+	float *demands_ptr = demands.ptrw();
+	for (int i = 0; i < p_meshes.size(); i++) {
+		demands_ptr[i] = 0.0;
+		MeshLODStream **stream = mesh_lod_streams.getptr(p_meshes[i]);
+		ERR_CONTINUE(!stream);
+
+		// Reset, so the next call only reports what was culled since this one.
+		uint32_t bits = (*stream)->demand.bit_and(0);
+		memcpy(&demands_ptr[i], &bits, sizeof(float));
+	}
+	return demands;
+}
+
 void RendererSceneCull::instance_geometry_set_shader_parameter(RID p_instance, const StringName &p_parameter, const Variant &p_value) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1571,15 +1707,38 @@ void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instan
 	}
 }
 
+AABB RendererSceneCull::_get_instance_bvh_aabb(const Instance *p_instance) {
+	//quantize to improve moving object performance
+	AABB bvh_aabb = p_instance->transformed_aabb;
+
+	if (p_instance->indexer_id.is_valid() && bvh_aabb != p_instance->prev_transformed_aabb) {
+		//assume motion, see if bounds need to be quantized
+		AABB motion_aabb = bvh_aabb.merge(p_instance->prev_transformed_aabb);
+		float motion_longest_axis = motion_aabb.get_longest_axis_size();
+		float longest_axis = p_instance->transformed_aabb.get_longest_axis_size();
+
+		if (motion_longest_axis < longest_axis * 2) {
+			//moved but not a lot, use motion aabb quantizing
+			float quantize_size = Math::pow(2.0, Math::ceil(Math::log(motion_longest_axis) / Math::log(2.0))) * 0.5; //one fifth
+			bvh_aabb.quantize(quantize_size);
+		}
+	}
+
+	return bvh_aabb;
+}
+
 void RendererSceneCull::_update_instance(Instance *p_instance) {
 	p_instance->version++;
 
+	const bool bounds_precomputed = p_instance->bounds_precomputed;
+	p_instance->bounds_precomputed = false;
+
 	if (p_instance->base_type == RS::INSTANCE_LIGHT) {
 		InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 		RSG::light_storage->light_instance_set_transform(light->instance, p_instance->transform);
 		RSG::light_storage->light_instance_set_aabb(light->instance, p_instance->transform.xform(p_instance->aabb));
-		light->make_shadow_dirty();
+		light->make_static_shadow_dirty();
 
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
@@ -1653,19 +1812,16 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		}
 	}
 
-	AABB new_aabb;
-	new_aabb = p_instance->transform.xform(p_instance->aabb);
-	p_instance->transformed_aabb = new_aabb;
+	if (!bounds_precomputed) {
+		p_instance->transformed_aabb = p_instance->transform.xform(p_instance->aabb);
+	}
 
 	if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
 		//make sure lights are updated if it casts shadow
 
 		if (geom->can_cast_shadows) {
-			for (const Instance *E : geom->lights) {
-				InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
-				light->make_shadow_dirty();
-			}
+			_make_lights_shadow_dirty(p_instance, _is_static_shadow_caster(p_instance));
 		}
 
 		if (!p_instance->lightmap && geom->lightmap_captures.size()) {
@@ -1690,21 +1846,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		return;
 	}
 
-	//quantize to improve moving object performance
-	AABB bvh_aabb = p_instance->transformed_aabb;
-
-	if (p_instance->indexer_id.is_valid() && bvh_aabb != p_instance->prev_transformed_aabb) {
-		//assume motion, see if bounds need to be quantized
-		AABB motion_aabb = bvh_aabb.merge(p_instance->prev_transformed_aabb);
-		float motion_longest_axis = motion_aabb.get_longest_axis_size();
-		float longest_axis = p_instance->transformed_aabb.get_longest_axis_size();
-
-		if (motion_longest_axis < longest_axis * 2) {
-			//moved but not a lot, use motion aabb quantizing
-			float quantize_size = Math::pow(2.0, Math::ceil(Math::log(motion_longest_axis) / Math::log(2.0))) * 0.5; //one fifth
-			bvh_aabb.quantize(quantize_size);
-		}
-	}
+	const AABB bvh_aabb = bounds_precomputed ? p_instance->precomputed_bvh_aabb : _get_instance_bvh_aabb(p_instance);
 
 	if (!p_instance->indexer_id.is_valid()) {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1792,6 +1934,9 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		if (p_instance->ignore_all_culling) {
 			idata.flags |= InstanceData::FLAG_IGNORE_ALL_CULLING;
 		}
+		if (p_instance->lod_stream) {
+			idata.flags |= InstanceData::FLAG_LOD_STREAM;
+		}
 
 		p_instance->scenario->instance_data.push_back(idata);
 		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
@@ -2309,6 +2454,46 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
+void RendererSceneCull::_light_instance_fill_shadow_casters(InstanceLightData *p_light, RendererSceneRender::RenderShadowData &r_shadow_data, uint32_t p_visible_layers, bool p_use_static_cache, bool &r_animated_material_found) {
+	if (p_use_static_cache) {
+		// Static casters are kept in their own list, which the renderer only redraws when the static version changes.
+		// They are never culled to the camera frustum, as the cached result must stay valid when the camera moves.
+		for (uint64_t j = 0; j < instance_shadow_cull_result.size();) {
+			Instance *instance = instance_shadow_cull_result[j];
+			if (!_is_static_shadow_caster(instance)) {
+				j++;
+				continue;
+			}
+			if (instance->visible && static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows && (p_visible_layers & instance->layer_mask)) {
+				r_shadow_data.static_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+			}
+			instance_shadow_cull_result.remove_at_unordered(j);
+		}
+		r_shadow_data.static_version = p_light->static_shadow_version;
+	}
+
+	if (!p_light->is_shadow_update_full()) {
+		light_culler->cull_regular_light(instance_shadow_cull_result);
+	}
+
+	for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
+		Instance *instance = instance_shadow_cull_result[j];
+		if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
+			continue;
+		} else {
+			if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
+				r_animated_material_found = true;
+			}
+
+			if (instance->mesh_instance.is_valid()) {
+				RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
+			}
+		}
+
+		r_shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	}
+}
+
 bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
@@ -2316,6 +2501,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 	light_transform.orthonormalize(); //scale does not count on lights
 
 	bool animated_material_found = false;
+	const bool use_static_cache = scene_render->is_positional_shadow_static_cache_enabled();
 
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
@@ -2363,26 +2549,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
+					_light_instance_fill_shadow_casters(light, shadow_data, p_visible_layers, use_static_cache && shadow_mode == RS::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID, animated_material_found);
 
 					RSG::mesh_storage->update_mesh_instances();
 
@@ -2445,25 +2612,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
+					_light_instance_fill_shadow_casters(light, shadow_data, p_visible_layers, false, animated_material_found);
 
 					RSG::mesh_storage->update_mesh_instances();
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, xform, radius, 0, i, 0);
@@ -2512,25 +2661,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
-			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
-			}
-
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
-
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
-				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-			}
+			_light_instance_fill_shadow_casters(light, shadow_data, p_visible_layers, use_static_cache, animated_material_found);
 
 			RSG::mesh_storage->update_mesh_instances();
 
@@ -2752,6 +2883,29 @@ void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_d
 	_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
 }
 
+void RendererSceneCull::_update_mesh_lod_stream_demand(const CullData &p_cull_data, const Instance *p_instance) {
+	// Measured the same way as when the renderer picks the LOD to draw.
+	float distance = 1.0;
+	if (!p_cull_data.cam_orthogonal) {
+		distance = 0.0;
+		if (!p_instance->transformed_aabb.has_point(p_cull_data.cam_transform.origin)) {
+			Vector3 lod_support = p_instance->transformed_aabb.get_support(p_cull_data.cam_transform.basis.get_column(Vector3::AXIS_Z));
+			distance = (float)p_cull_data.cam_transform.origin.distance_to(lod_support);
+		}
+	}
+
+	Vector3 model_scale_vec = p_instance->transform.basis.get_scale_abs();
+	float model_scale = MAX(model_scale_vec.x, MAX(model_scale_vec.y, model_scale_vec.z));
+
+	// Anything finer than one unit of edge length per this value would be drawn at full detail.
+	float threshold = distance * p_cull_data.lod_distance_multiplier * p_cull_data.screen_mesh_lod_threshold;
+	float demand = threshold > 0.0f ? model_scale * p_instance->lod_bias / threshold : FLT_MAX;
+
+	uint32_t bits;
+	memcpy(&bits, &demand, sizeof(float));
+	p_instance->lod_stream->demand.exchange_if_greater(bits);
+}
+
 void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to) {
 	uint64_t frame_number = RSG::rasterizer->get_frame_number();
 	float lightmap_probe_update_speed = RSG::light_storage->lightmap_get_probe_capture_update_speed() * RSG::rasterizer->get_frame_delta_time();
@@ -2795,11 +2949,20 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 						if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || RSG::light_storage->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
 							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
+							float camera_distance = cull_data.cam_transform.origin.distance_to(idata.instance->transform.origin);
 							cull_data.cull->lock.lock();
 							if (!reflection_probe->update_list.in_list()) {
 								reflection_probe->render_step = 0;
+								reflection_probe->last_update_frame = frame_number;
 								reflection_probe_render_list.add_last(&reflection_probe->update_list);
 							}
+							if (reflection_probe->camera_distance_frame != frame_number) {
+								// Several cameras may see the probe, keep the closest one.
+								reflection_probe->camera_distance = camera_distance;
+								reflection_probe->camera_distance_frame = frame_number;
+							} else {
+								reflection_probe->camera_distance = MIN(reflection_probe->camera_distance, camera_distance);
+							}
 							cull_data.cull->lock.unlock();
 
 							idata.flags &= ~uint32_t(InstanceData::FLAG_REFLECTION_PROBE_DIRTY);
@@ -2816,7 +2979,8 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					InstanceVoxelGIData *voxel_gi = static_cast<InstanceVoxelGIData *>(idata.instance->base_data);
 					cull_data.cull->lock.lock();
 					if (!voxel_gi->update_element.in_list()) {
-						voxel_gi_update_list.add(&voxel_gi->update_element);
+						// Appended so probes left over by the per frame update budget are served first.
+						voxel_gi_update_list.add_last(&voxel_gi->update_element);
 					}
 					cull_data.cull->lock.unlock();
 					cull_result.voxel_gi_instances.push_back(RID::from_uint64(idata.instance_data_rid));
@@ -2843,6 +3007,9 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 					if (base_type == RS::INSTANCE_MESH) {
 						mesh_visible = true;
+						if (idata.flags & InstanceData::FLAG_LOD_STREAM) {
+							_update_mesh_lod_stream_demand(cull_data, idata.instance);
+						}
 					} else if (base_type == RS::INSTANCE_PARTICLES) {
 						//particles visible? process them
 						if (RSG::particles_storage->particles_is_inactive(idata.base_rid)) {
@@ -2851,6 +3018,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 						} else {
 							cull_data.cull->lock.lock();
 							RSG::particles_storage->particles_request_process(idata.base_rid);
+							RSG::particles_storage->particles_set_view_distance(idata.base_rid, cull_data.cam_transform.origin.distance_to(idata.instance->transformed_aabb.get_center()));
 							cull_data.cull->lock.unlock();
 							RSG::particles_storage->particles_set_view_axis(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized());
 							//particles visible? request redraw
@@ -3160,6 +3328,9 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
 		cull_data.camera_matrix = &p_camera_data->main_projection;
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
+		cull_data.cam_orthogonal = p_camera_data->is_orthogonal;
+		cull_data.lod_distance_multiplier = p_camera_data->main_projection.get_lod_multiplier();
+		cull_data.screen_mesh_lod_threshold = p_screen_mesh_lod_threshold;
 //#define DEBUG_CULL_TIME
 #ifdef DEBUG_CULL_TIME
 		uint64_t time_from = OS::get_singleton()->get_ticks_usec();
@@ -3417,6 +3588,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 	for (uint32_t i = 0; i < max_shadows_used; i++) {
 		render_shadow_data[i].instances.clear();
+		render_shadow_data[i].static_instances.clear();
+		render_shadow_data[i].static_version = 0;
 	}
 	max_shadows_used = 0;
 
@@ -3574,7 +3747,43 @@ void RendererSceneCull::render_probes() {
 
 	bool busy = false;
 
-	if (ref_probe) {
+	if (ref_probe && reflection_probe_max_update_steps_per_frame > 0) {
+		RENDER_TIMESTAMP("Render ReflectionProbes");
+
+		// Spread probe updates over several frames. Every step renders one cubemap face
+		// or one filtering pass, closer probes go first, and probes that have waited
+		// longer get promoted so distant ones are still refreshed eventually.
+		uint64_t frame_number = RSG::rasterizer->get_frame_number();
+		LocalVector<InstanceReflectionProbeData *> probes;
+		while (ref_probe) {
+			InstanceReflectionProbeData *probe = ref_probe->self();
+			probe->update_priority = probe->camera_distance / (1.0 + (frame_number - probe->last_update_frame));
+			probes.push_back(probe);
+			ref_probe = ref_probe->next();
+		}
+
+		struct ReflectionProbePrioritySort {
+			_FORCE_INLINE_ bool operator()(const InstanceReflectionProbeData *p_a, const InstanceReflectionProbeData *p_b) const {
+				return p_a->update_priority < p_b->update_priority;
+			}
+		};
+		probes.sort_custom<ReflectionProbePrioritySort>();
+
+		uint32_t steps_left = reflection_probe_max_update_steps_per_frame;
+		for (uint32_t i = 0; i < probes.size() && steps_left > 0; i++) {
+			InstanceReflectionProbeData *probe = probes[i];
+			probe->last_update_frame = frame_number;
+
+			while (steps_left > 0) {
+				steps_left--;
+				if (_render_reflection_probe_step(probe->owner, probe->render_step)) {
+					reflection_probe_render_list.remove(&probe->update_list);
+					break;
+				}
+				probe->render_step++;
+			}
+		}
+	} else if (ref_probe) {
 		RENDER_TIMESTAMP("Render ReflectionProbes");
 
 		while (ref_probe) {
@@ -3625,8 +3834,11 @@ void RendererSceneCull::render_probes() {
 		RENDER_TIMESTAMP("Render VoxelGI");
 	}
 
-	while (voxel_gi) {
+	uint32_t voxel_gi_updates_left = voxel_gi_max_updates_per_frame > 0 ? voxel_gi_max_updates_per_frame : UINT32_MAX;
+
+	while (voxel_gi && voxel_gi_updates_left > 0) {
 		SelfList<InstanceVoxelGIData> *next = voxel_gi->next();
+		voxel_gi_updates_left--;
 
 		InstanceVoxelGIData *probe = voxel_gi->self();
 		//Instance *instance_probe = probe->owner;
@@ -3885,12 +4097,28 @@ void RendererSceneCull::_update_instance_shader_uniforms_from_material(HashMap<S
 	}
 }
 
+void RendererSceneCull::_precompute_instance_bounds(uint32_t p_index, Instance **p_instances) {
+	Instance *instance = p_instances[p_index];
+	if (instance->update_aabb || instance->update_dependencies || !instance->aabb.has_surface()) {
+		return; // Bounds may still change, leave them to the serial update.
+	}
+
+	instance->transformed_aabb = instance->transform.xform(instance->aabb);
+	if (instance->scenario && instance->visible && instance->transform.basis.determinant() != 0) {
+		instance->precomputed_bvh_aabb = _get_instance_bvh_aabb(instance);
+	}
+	instance->bounds_precomputed = true;
+}
+
 void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 	if (p_instance->update_aabb) {
+		p_instance->bounds_precomputed = false;
 		_update_instance_aabb(p_instance);
 	}
 
 	if (p_instance->update_dependencies) {
+		const bool was_static_shadow_caster = _is_static_shadow_caster(p_instance);
+
 		p_instance->dependency_tracker.update_begin();
 
 		if (p_instance->base.is_valid()) {
@@ -4051,15 +4279,17 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 
 			if (can_cast_shadows != geom->can_cast_shadows) {
 				//ability to cast shadows change, let lights now
-				for (const Instance *E : geom->lights) {
-					InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
-					light->make_shadow_dirty();
-				}
+				_make_lights_shadow_dirty(p_instance, was_static_shadow_caster);
 
 				geom->can_cast_shadows = can_cast_shadows;
 			}
 
 			geom->material_is_animated = is_animated;
+
+			if (geom->can_cast_shadows && (was_static_shadow_caster || _is_static_shadow_caster(p_instance))) {
+				// Materials or the mesh changed, so the cached static shadow may no longer match.
+				_make_lights_shadow_dirty(p_instance, true);
+			}
 			p_instance->instance_shader_uniforms = isparams;
 
 			if (p_instance->instance_allocated_shader_uniforms != (p_instance->instance_shader_uniforms.size() > 0)) {
@@ -4120,15 +4350,35 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 }
 
 void RendererSceneCull::update_dirty_instances() {
+	// Transforming bounds is independent per instance, so when many instances moved do it on all threads first.
+	// Indexing and pairing touch shared structures and stay serial below.
+	dirty_instance_batch.clear();
+	for (SelfList<Instance> *E = _instance_update_list.first(); E; E = E->next()) {
+		dirty_instance_batch.push_back(E->self());
+	}
+	if (dirty_instance_batch.size() > thread_cull_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_precompute_instance_bounds, dirty_instance_batch.ptr(), dirty_instance_batch.size(), -1, true, SNAME("PrecomputeInstanceBounds"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	while (_instance_update_list.first()) {
 		_update_dirty_instance(_instance_update_list.first()->self());
 	}
 
+	if (dirty_instance_batch.size() > thread_cull_threshold) {
+		// Don't let bounds from an update that bailed out early be picked up later.
+		for (Instance *instance : dirty_instance_batch) {
+			instance->bounds_precomputed = false;
+		}
+	}
+
 	// Update dirty resources after dirty instances as instance updates may affect resources.
 	RSG::utilities->update_dirty_resources();
 }
 
 void RendererSceneCull::update() {
+	update_interpolation_frame();
+
 	//optimize bvhs
 
 	uint32_t rid_count = scenario_owner.get_rid_count();
@@ -4193,6 +4443,7 @@ bool RendererSceneCull::free(RID p_rid) {
 		}
 		update_dirty_instances(); //in case something changed this
 
+		_interpolation_data.notify_free_instance(p_rid, *instance);
 		instance_owner.free(p_rid);
 	} else {
 		return false;
@@ -4201,11 +4452,146 @@ bool RendererSceneCull::free(RID p_rid) {
 	return true;
 }
 
+/* INTERPOLATION */
+
+void RendererSceneCull::tick() {
+	if (_interpolation_data.interpolation_enabled) {
+		update_interpolation_tick(true);
+	}
+}
+
+void RendererSceneCull::set_physics_interpolation_enabled(bool p_enabled) {
+	if (_interpolation_data.interpolation_enabled == p_enabled) {
+		return;
+	}
+
+	if (!p_enabled) {
+		// Leave every instance at its latest submitted transform.
+		for (const RID &rid : _interpolation_data.instance_interpolate_update_list) {
+			Instance *instance = instance_owner.get_or_null(rid);
+			if (instance) {
+				instance->transform = instance->transform_curr;
+				instance->transform_prev = instance->transform_curr;
+				instance->on_interpolate_list = false;
+				instance->on_interpolate_transform_list = false;
+				_instance_queue_update(instance, true);
+			}
+		}
+		for (const RID &rid : *_interpolation_data.instance_transform_update_list_curr) {
+			Instance *instance = instance_owner.get_or_null(rid);
+			if (instance) {
+				instance->on_interpolate_transform_list = false;
+			}
+		}
+		_interpolation_data.instance_interpolate_update_list.clear();
+		_interpolation_data.instance_transform_update_lists[0].clear();
+		_interpolation_data.instance_transform_update_lists[1].clear();
+	}
+
+	_interpolation_data.interpolation_enabled = p_enabled;
+}
+
+void RendererSceneCull::update_interpolation_tick(bool p_process) {
+	// Instances that were transformed on the previous tick but not on this one have come to rest.
+	bool any_at_rest = false;
+	for (const RID &rid : *_interpolation_data.instance_transform_update_list_prev) {
+		Instance *instance = instance_owner.get_or_null(rid);
+		if (instance && !instance->on_interpolate_transform_list) {
+			instance->transform_prev = instance->transform_curr;
+			if (instance->on_interpolate_list) {
+				instance->on_interpolate_list = false;
+				any_at_rest = true;
+				// Render the resting transform exactly, rather than the last interpolated one.
+				if (instance->transform != instance->transform_curr) {
+					instance->transform = instance->transform_curr;
+					_instance_queue_update(instance, true);
+				}
+			}
+		}
+	}
+
+	// Those being actively transformed keep their previous transform ready for the next tick.
+	if (p_process) {
+		for (const RID &rid : *_interpolation_data.instance_transform_update_list_curr) {
+			Instance *instance = instance_owner.get_or_null(rid);
+			if (instance) {
+				instance->transform_prev = instance->transform_curr;
+				instance->on_interpolate_transform_list = false;
+			}
+		}
+	}
+
+	SWAP(_interpolation_data.instance_transform_update_list_curr, _interpolation_data.instance_transform_update_list_prev);
+	_interpolation_data.instance_transform_update_list_curr->clear();
+
+	if (any_at_rest) {
+		// Compact in one pass rather than erasing each resting instance on its own.
+		LocalVector<RID> &list = _interpolation_data.instance_interpolate_update_list;
+		uint32_t kept = 0;
+		for (uint32_t i = 0; i < list.size(); i++) {
+			Instance *instance = instance_owner.get_or_null(list[i]);
+			if (instance && instance->on_interpolate_list) {
+				list[kept++] = list[i];
+			}
+		}
+		list.resize(kept);
+	}
+}
+
+void RendererSceneCull::_interpolate_instance_transform(uint32_t p_index, Instance **p_instances) {
+	Instance *instance = p_instances[p_index];
+	TransformInterpolator::interpolate_transform_3d(instance->transform_prev, instance->transform_curr, instance->transform, interpolation_fraction);
+}
+
+void RendererSceneCull::update_interpolation_frame() {
+	if (!_interpolation_data.interpolation_enabled || _interpolation_data.instance_interpolate_update_list.is_empty()) {
+		return;
+	}
+
+	interpolation_fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+
+	interpolate_instance_batch.clear();
+	for (const RID &rid : _interpolation_data.instance_interpolate_update_list) {
+		Instance *instance = instance_owner.get_or_null(rid);
+		if (instance) {
+			interpolate_instance_batch.push_back(instance);
+		}
+	}
+
+	// Interpolating is independent per instance; queueing the bounds update touches the shared list and stays serial.
+	if (interpolate_instance_batch.size() > thread_cull_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_interpolate_instance_transform, interpolate_instance_batch.ptr(), interpolate_instance_batch.size(), -1, true, SNAME("InterpolateInstanceTransforms"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < interpolate_instance_batch.size(); i++) {
+			_interpolate_instance_transform(i, interpolate_instance_batch.ptr());
+		}
+	}
+
+	for (Instance *instance : interpolate_instance_batch) {
+		_instance_queue_update(instance, true);
+	}
+}
+
+void RendererSceneCull::InterpolationData::notify_free_instance(RID p_rid, Instance &r_instance) {
+	r_instance.on_interpolate_list = false;
+	r_instance.on_interpolate_transform_list = false;
+
+	if (!interpolation_enabled) {
+		return;
+	}
+
+	// If the instance was on any of the lists, remove.
+	instance_interpolate_update_list.erase_multiple_unordered(p_rid);
+	instance_transform_update_list_curr->erase_multiple_unordered(p_rid);
+	instance_transform_update_list_prev->erase_multiple_unordered(p_rid);
+}
+
 TypedArray<Image> RendererSceneCull::bake_render_uv2(RID p_base, const TypedArray<RID> &p_material_overrides, const Size2i &p_image_size) {
 	return scene_render->bake_render_uv2(p_base, p_material_overrides, p_image_size);
 }
 
-void RendererSceneCull::update_visibility_notifiers() {
+void RendererSceneCull::update_visibility_notifiers(LocalVector<Callable> &r_callbacks) {
 	SelfList<InstanceVisibilityNotifierData> *E = visible_notifier_list.first();
 	while (E) {
 		SelfList<InstanceVisibilityNotifierData> *N = E->next();
@@ -4214,12 +4600,18 @@ void RendererSceneCull::update_visibility_notifiers() {
 		if (visibility_notifier->just_visible) {
 			visibility_notifier->just_visible = false;
 
-			RSG::utilities->visibility_notifier_call(visibility_notifier->base, true, RSG::threaded);
+			Callable callback = RSG::utilities->visibility_notifier_get_callback(visibility_notifier->base, true);
+			if (callback.is_valid()) {
+				r_callbacks.push_back(callback);
+			}
 		} else {
 			if (visibility_notifier->visible_in_frame != RSG::rasterizer->get_frame_number()) {
 				visible_notifier_list.remove(E);
 
-				RSG::utilities->visibility_notifier_call(visibility_notifier->base, false, RSG::threaded);
+				Callable callback = RSG::utilities->visibility_notifier_get_callback(visibility_notifier->base, false);
+				if (callback.is_valid()) {
+					r_callbacks.push_back(callback);
+				}
 			}
 		}
 
@@ -4249,6 +4641,7 @@ RendererSceneCull::RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		render_shadow_data[i].static_instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4262,10 +4655,12 @@ RendererSceneCull::RendererSceneCull() {
 
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
+	voxel_gi_max_updates_per_frame = GLOBAL_GET("rendering/global_illumination/voxel_gi/max_updates_per_frame");
+	reflection_probe_max_update_steps_per_frame = GLOBAL_GET("rendering/reflections/reflection_atlas/max_update_steps_per_frame");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+	dummy_occlusion_culling = memnew(RasterOcclusionCull);
 
 	light_culler = memnew(RenderingLightCuller);
 
@@ -4280,6 +4675,7 @@ RendererSceneCull::~RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		render_shadow_data[i].static_instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -4291,6 +4687,11 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
+	for (KeyValue<RID, MeshLODStream *> &E : mesh_lod_streams) {
+		memdelete(E.value);
+	}
+	mesh_lod_streams.clear();
+
 	if (dummy_occlusion_culling) {
 		memdelete(dummy_occlusion_culling);
 	}
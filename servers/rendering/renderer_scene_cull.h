@@ -38,6 +38,7 @@
 #include "core/templates/paged_array.h"
 #include "core/templates/pass_func.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "servers/rendering/renderer_scene_occlusion_cull.h"
 #include "servers/rendering/renderer_scene_render.h"
@@ -273,6 +274,7 @@ public:
 			FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN = (1 << 22),
 			FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY = (1 << 23),
 			FLAG_IGNORE_ALL_CULLING = (1 << 24),
+			FLAG_LOD_STREAM = (1 << 25),
 		};
 
 		uint32_t flags = 0;
@@ -396,6 +398,16 @@ public:
 		virtual ~InstanceBaseData() {}
 	};
 
+	// Streamed meshes only keep their coarser LODs resident. Culling records how much
+	// detail their visible instances need, so the mesh resource can load finer LODs.
+	struct MeshLODStream {
+		// Largest screen size per unit of LOD edge length, relative to the LOD threshold.
+		// Stored as float bits, which order like integers for positive values.
+		SafeNumeric<uint32_t> demand;
+	};
+
+	HashMap<RID, MeshLODStream *> mesh_lod_streams;
+
 	struct Instance {
 		RS::InstanceType base_type;
 		RID base;
@@ -405,9 +417,18 @@ public:
 		RID material_overlay;
 
 		RID mesh_instance; //only used for meshes and when skeleton/blendshapes exist
+		MeshLODStream *lod_stream = nullptr; //only used for streamed meshes
 
 		Transform3D transform;
 
+		// With physics interpolation, the transforms submitted on the last two ticks.
+		// `transform` then holds the one interpolated between them for the current frame.
+		Transform3D transform_prev;
+		Transform3D transform_curr;
+		bool interpolated = true;
+		bool on_interpolate_list = false;
+		bool on_interpolate_transform_list = false;
+
 		float lod_bias;
 
 		bool ignore_occlusion_culling;
@@ -435,6 +456,8 @@ public:
 		AABB aabb;
 		AABB transformed_aabb;
 		AABB prev_transformed_aabb;
+		AABB precomputed_bvh_aabb; // Valid while bounds_precomputed is set.
+		bool bounds_precomputed = false;
 
 		struct InstanceShaderParameter {
 			int32_t index = -1;
@@ -622,6 +645,14 @@ public:
 	SelfList<Instance>::List _instance_update_list;
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_dependencies = false);
 
+	LocalVector<Instance *> dirty_instance_batch;
+	void _precompute_instance_bounds(uint32_t p_index, Instance **p_instances);
+
+	LocalVector<Instance *> interpolate_instance_batch;
+	real_t interpolation_fraction = 0.0;
+	void _interpolate_instance_transform(uint32_t p_index, Instance **p_instances);
+	static AABB _get_instance_bvh_aabb(const Instance *p_instance);
+
 	struct InstanceGeometryData : public InstanceBaseData {
 		RenderGeometryInstance *geometry_instance = nullptr;
 		HashSet<Instance *> lights;
@@ -651,6 +682,12 @@ public:
 
 		int render_step;
 
+		// Used to prioritize probes when the per-frame update budget is limited.
+		float camera_distance = 0.0;
+		uint64_t camera_distance_frame = 0;
+		uint64_t last_update_frame = 0;
+		float update_priority = 0.0;
+
 		InstanceReflectionProbeData() :
 				update_list(this) {
 			render_step = -1;
@@ -693,6 +730,9 @@ public:
 	struct InstanceLightData : public InstanceBaseData {
 		RID instance;
 		uint64_t last_version;
+		// Bumped whenever a static shadow caster in range changes, renderers that cache
+		// the static part of the shadow redraw it only when this changes.
+		uint64_t static_shadow_version = 1;
 		List<Instance *>::Element *D; // directional light in scenario
 
 		bool uses_projector = false;
@@ -718,6 +758,10 @@ public:
 	public:
 		bool is_shadow_dirty() const { return shadow_dirty_count != 0; }
 		void make_shadow_dirty() { shadow_dirty_count = light_intersects_multiple_cameras ? 1 : 2; }
+		void make_static_shadow_dirty() {
+			static_shadow_version++;
+			make_shadow_dirty();
+		}
 		void detect_light_intersects_multiple_cameras(uint32_t p_frame_id) {
 			// We need to detect the case where shadow updates are occurring
 			// more than once per frame. In this case, we need to turn off
@@ -1011,6 +1055,8 @@ public:
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
+	uint32_t voxel_gi_max_updates_per_frame = 0;
+	uint32_t reflection_probe_max_update_steps_per_frame = 0;
 
 	RID_Owner<Instance, true> instance_owner;
 
@@ -1043,6 +1089,9 @@ public:
 
 	virtual void instance_set_ignore_culling(RID p_instance, bool p_enabled);
 
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
+
 	bool _update_instance_visibility_depth(Instance *p_instance);
 	void _update_instance_visibility_dependencies(Instance *p_instance);
 
@@ -1061,6 +1110,10 @@ public:
 	virtual void instance_geometry_set_lightmap(RID p_instance, RID p_lightmap, const Rect2 &p_lightmap_uv_scale, int p_slice_index);
 	virtual void instance_geometry_set_lod_bias(RID p_instance, float p_lod_bias);
 
+	void _update_mesh_lod_stream_instances(RID p_mesh, MeshLODStream *p_stream);
+	virtual void mesh_set_lod_streaming(RID p_mesh, bool p_enabled);
+	virtual Vector<float> mesh_get_lod_stream_demands(const Vector<RID> &p_meshes);
+
 	void _update_instance_shader_uniforms_from_material(HashMap<StringName, Instance::InstanceShaderParameter> &isparams, const HashMap<StringName, Instance::InstanceShaderParameter> &existing_isparams, RID p_material);
 
 	virtual void instance_geometry_set_shader_parameter(RID p_instance, const StringName &p_parameter, const Variant &p_value);
@@ -1076,6 +1129,25 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
+	// Geometry using static baked light is assumed not to move, so its shadow can be cached.
+	static _FORCE_INLINE_ bool _is_static_shadow_caster(const Instance *p_instance) {
+		if (!((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !p_instance->baked_light || p_instance->mesh_instance.is_valid()) {
+			return false;
+		}
+		return !static_cast<const InstanceGeometryData *>(p_instance->base_data)->material_is_animated;
+	}
+	static _FORCE_INLINE_ void _make_lights_shadow_dirty(const Instance *p_instance, bool p_static) {
+		const InstanceGeometryData *geom = static_cast<const InstanceGeometryData *>(p_instance->base_data);
+		for (const Instance *E : geom->lights) {
+			InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
+			if (p_static) {
+				light->make_static_shadow_dirty();
+			} else {
+				light->make_shadow_dirty();
+			}
+		}
+	}
+	void _light_instance_fill_shadow_casters(InstanceLightData *p_light, RendererSceneRender::RenderShadowData &r_shadow_data, uint32_t p_visible_layers, bool p_use_static_cache, bool &r_animated_material_found);
 	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
@@ -1142,9 +1214,13 @@ public:
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
 		const Projection *camera_matrix;
 		uint64_t visibility_viewport_mask;
+		bool cam_orthogonal;
+		float lod_distance_multiplier;
+		float screen_mesh_lod_threshold;
 	};
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
+	_FORCE_INLINE_ void _update_mesh_lod_stream_demand(const CullData &p_cull_data, const Instance *p_instance);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
@@ -1389,9 +1465,29 @@ public:
 
 	bool free(RID p_rid);
 
+	/* INTERPOLATION */
+
+	virtual void tick();
+	virtual void set_physics_interpolation_enabled(bool p_enabled);
+	void update_interpolation_tick(bool p_process = true);
+	void update_interpolation_frame();
+
+	struct InterpolationData {
+		void notify_free_instance(RID p_rid, Instance &r_instance);
+
+		// Instances whose rendered transform has to be interpolated again each frame.
+		LocalVector<RID> instance_interpolate_update_list;
+
+		LocalVector<RID> instance_transform_update_lists[2];
+		LocalVector<RID> *instance_transform_update_list_curr = &instance_transform_update_lists[0];
+		LocalVector<RID> *instance_transform_update_list_prev = &instance_transform_update_lists[1];
+
+		bool interpolation_enabled = false;
+	} _interpolation_data;
+
 	void set_scene_render(RendererSceneRender *p_scene_render);
 
-	virtual void update_visibility_notifiers();
+	virtual void update_visibility_notifiers(LocalVector<Callable> &r_callbacks);
 
 	RendererSceneCull();
 	virtual ~RendererSceneCull();
@@ -275,6 +275,9 @@ public:
 		RID light;
 		int pass = 0;
 		PagedArray<RenderGeometryInstance *> instances;
+		// Only filled when is_positional_shadow_static_cache_enabled() returns true.
+		PagedArray<RenderGeometryInstance *> static_instances;
+		uint64_t static_version = 0;
 	};
 
 	struct RenderSDFGIData {
@@ -327,6 +330,8 @@ public:
 	virtual void screen_space_roughness_limiter_set_active(bool p_enable, float p_amount, float p_limit) = 0;
 	virtual bool screen_space_roughness_limiter_is_active() const = 0;
 
+	virtual bool is_positional_shadow_static_cache_enabled() const { return false; }
+
 	virtual void sub_surface_scattering_set_quality(RS::SubSurfaceScatteringQuality p_quality) = 0;
 	virtual void sub_surface_scattering_set_scale(float p_scale, float p_depth_scale) = 0;
 
@@ -110,7 +110,7 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 			p_viewport->render_buffers.unref();
 		} else {
 			const float EPSILON = 0.0001;
-			float scaling_3d_scale = p_viewport->scaling_3d_scale;
+			float scaling_3d_scale = p_viewport->scaling_3d_dynamic ? p_viewport->scaling_3d_dynamic_scale : p_viewport->scaling_3d_scale;
 			RS::ViewportScaling3DMode scaling_3d_mode = p_viewport->scaling_3d_mode;
 			bool upscaler_available = p_viewport->fsr_enabled;
 
@@ -251,8 +251,60 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 #endif // _3D_DISABLED
 }
 
+void RendererViewport::_update_scaling_3d_dynamic(Viewport *p_viewport) {
+	if (p_viewport->time_gpu_end <= p_viewport->time_gpu_begin) {
+		return;
+	}
+
+	// Results arrive a few frames late, so give the new resolution time to show up in the samples.
+	if (p_viewport->scaling_3d_dynamic_cooldown > 0) {
+		p_viewport->scaling_3d_dynamic_cooldown--;
+		return;
+	}
+
+	float gpu_time = double(p_viewport->time_gpu_end - p_viewport->time_gpu_begin) / 1000000.0;
+	if (p_viewport->scaling_3d_dynamic_gpu_time == 0.0) {
+		p_viewport->scaling_3d_dynamic_gpu_time = gpu_time;
+		return;
+	}
+	// Smooth out single frame spikes.
+	p_viewport->scaling_3d_dynamic_gpu_time = Math::lerp(p_viewport->scaling_3d_dynamic_gpu_time, gpu_time, 0.1f);
+	gpu_time = p_viewport->scaling_3d_dynamic_gpu_time;
+
+	// Changing the scale reallocates the render buffers and drops TAA/FSR2 history,
+	// so the scale moves in coarse steps and only grows when there is clear headroom.
+	const float STEP = 0.05;
+	const float HEADROOM = 0.9;
+	const uint32_t COOLDOWN_FRAMES = 8;
+
+	float target = p_viewport->scaling_3d_dynamic_target_frame_time;
+	float current = p_viewport->scaling_3d_dynamic_scale;
+	float new_scale = current;
+
+	// GPU cost follows the pixel count, which is quadratic in the scale.
+	if (gpu_time > target) {
+		new_scale = Math::floor(current * Math::sqrt(target * HEADROOM / gpu_time) / STEP) * STEP;
+	} else {
+		float grown = current + STEP;
+		if (gpu_time * (grown * grown) / (current * current) < target * HEADROOM) {
+			new_scale = grown;
+		}
+	}
+
+	float max_scale = p_viewport->scaling_3d_scale;
+	new_scale = CLAMP(new_scale, MIN(p_viewport->scaling_3d_dynamic_min_scale, max_scale), max_scale);
+	if (Math::is_equal_approx(new_scale, current)) {
+		return;
+	}
+
+	p_viewport->scaling_3d_dynamic_scale = new_scale;
+	p_viewport->scaling_3d_dynamic_gpu_time = 0.0;
+	p_viewport->scaling_3d_dynamic_cooldown = COOLDOWN_FRAMES;
+	_configure_3d_render_buffers(p_viewport);
+}
+
 void RendererViewport::_draw_viewport(Viewport *p_viewport) {
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->scaling_3d_dynamic) {
 		String rt_id = "vp_begin_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -654,7 +706,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		RSG::texture_storage->render_target_do_msaa_resolve(p_viewport->render_target);
 	}
 
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->scaling_3d_dynamic) {
 		String rt_id = "vp_end_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -945,9 +997,52 @@ void RendererViewport::viewport_set_scaling_3d_scale(RID p_viewport, float p_sca
 	}
 
 	viewport->scaling_3d_scale = CLAMP(p_scaling_3d_scale, 0.1, 2.0);
+	viewport->scaling_3d_dynamic_scale = viewport->scaling_3d_scale;
+	viewport->scaling_3d_dynamic_gpu_time = 0.0;
+	_configure_3d_render_buffers(viewport);
+}
+
+void RendererViewport::viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	if (viewport->scaling_3d_dynamic == p_enabled) {
+		return;
+	}
+
+	viewport->scaling_3d_dynamic = p_enabled;
+	viewport->scaling_3d_dynamic_scale = viewport->scaling_3d_scale;
+	viewport->scaling_3d_dynamic_gpu_time = 0.0;
+	viewport->scaling_3d_dynamic_cooldown = 0;
 	_configure_3d_render_buffers(viewport);
 }
 
+void RendererViewport::viewport_set_scaling_3d_dynamic_target_frame_time(RID p_viewport, float p_msec) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+	ERR_FAIL_COND(p_msec <= 0.0);
+
+	viewport->scaling_3d_dynamic_target_frame_time = p_msec;
+}
+
+void RendererViewport::viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_scale) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	viewport->scaling_3d_dynamic_min_scale = CLAMP(p_scale, 0.1, 2.0);
+	if (viewport->scaling_3d_dynamic && viewport->scaling_3d_dynamic_scale < viewport->scaling_3d_dynamic_min_scale) {
+		viewport->scaling_3d_dynamic_scale = MIN(viewport->scaling_3d_dynamic_min_scale, viewport->scaling_3d_scale);
+		_configure_3d_render_buffers(viewport);
+	}
+}
+
+float RendererViewport::viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL_V(viewport, 1.0);
+
+	return viewport->scaling_3d_dynamic ? viewport->scaling_3d_dynamic_scale : viewport->scaling_3d_scale;
+}
+
 void RendererViewport::viewport_set_size(RID p_viewport, int p_width, int p_height) {
 	ERR_FAIL_COND(p_width < 0 || p_height < 0);
 
@@ -1525,6 +1620,10 @@ void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time,
 	if (p_timestamp.begins_with("vp_end")) {
 		viewport->time_cpu_end = p_cpu_time;
 		viewport->time_gpu_end = p_gpu_time;
+
+		if (viewport->scaling_3d_dynamic) {
+			_update_scaling_3d_dynamic(viewport);
+		}
 	}
 }
 
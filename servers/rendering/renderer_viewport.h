@@ -63,6 +63,12 @@ public:
 
 		RS::ViewportScaling3DMode scaling_3d_mode = RenderingServer::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 		float scaling_3d_scale = 1.0;
+		bool scaling_3d_dynamic = false;
+		float scaling_3d_dynamic_target_frame_time = 16.6;
+		float scaling_3d_dynamic_min_scale = 0.5;
+		float scaling_3d_dynamic_scale = 1.0; // Scale picked by the controller, never above scaling_3d_scale.
+		float scaling_3d_dynamic_gpu_time = 0.0; // Smoothed GPU time in milliseconds, 0 until the first sample.
+		uint32_t scaling_3d_dynamic_cooldown = 0;
 		float fsr_sharpness = 0.2f;
 		float texture_mipmap_bias = 0.0f;
 		bool fsr_enabled = false;
@@ -209,6 +215,7 @@ private:
 	void _viewport_set_size(Viewport *p_viewport, int p_width, int p_height, uint32_t p_view_count);
 	bool _viewport_requires_motion_vectors(Viewport *p_viewport);
 	void _configure_3d_render_buffers(Viewport *p_viewport);
+	void _update_scaling_3d_dynamic(Viewport *p_viewport);
 	void _draw_3d(Viewport *p_viewport);
 	void _draw_viewport(Viewport *p_viewport);
 
@@ -232,6 +239,10 @@ public:
 
 	void viewport_set_scaling_3d_mode(RID p_viewport, RS::ViewportScaling3DMode p_mode);
 	void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale);
+	void viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled);
+	void viewport_set_scaling_3d_dynamic_target_frame_time(RID p_viewport, float p_msec);
+	void viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_scale);
+	float viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const;
 	void viewport_set_fsr_sharpness(RID p_viewport, float p_sharpness);
 	void viewport_set_texture_mipmap_bias(RID p_viewport, float p_mipmap_bias);
 
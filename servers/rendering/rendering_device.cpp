@@ -116,12 +116,6 @@ static uint32_t _get_device_type_score(const RenderingContextDriver::Device &p_d
 
 #define RENDER_GRAPH_FULL_BARRIERS 0
 
-// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
-// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
-// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
-
-#define SECONDARY_COMMAND_BUFFERS_PER_FRAME 0
-
 RenderingDevice *RenderingDevice::singleton = nullptr;
 
 RenderingDevice *RenderingDevice::get_singleton() {
@@ -1111,6 +1105,73 @@ Error RenderingDevice::texture_update(RID p_texture, uint32_t p_layer, const Vec
 	return _texture_update(p_texture, p_layer, p_data, false, true);
 }
 
+uint64_t RenderingDevice::texture_update_streamed(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data) {
+	_THREAD_SAFE_METHOD_
+
+	StreamedTextureUpdate update;
+	update.id = streamed_texture_update_next_id++;
+	update.texture = p_texture;
+	update.layer = p_layer;
+	update.data = p_data;
+
+	if (streamed_texture_updates.is_empty()) {
+		// Nothing is queued before this update, so copy whatever fits right away.
+		Error err = _texture_update(p_texture, p_layer, p_data, false, true, &update.next_region);
+		if (err == OK) {
+			streamed_texture_updates_recorded[update.id] = frames_drawn;
+			return update.id;
+		} else if (err != ERR_BUSY) {
+			return 0;
+		}
+	}
+
+	streamed_texture_updates.push_back(update);
+	return update.id;
+}
+
+bool RenderingDevice::texture_update_streamed_is_done(uint64_t p_update_id) {
+	_THREAD_SAFE_METHOD_
+
+	for (const StreamedTextureUpdate &update : streamed_texture_updates) {
+		if (update.id == p_update_id) {
+			return false;
+		}
+	}
+
+	const uint64_t *recorded_frame = streamed_texture_updates_recorded.getptr(p_update_id);
+	return recorded_frame == nullptr || *recorded_frame <= frames_drawn - frames.size();
+}
+
+void RenderingDevice::_process_streamed_texture_updates() {
+	while (!streamed_texture_updates.is_empty()) {
+		StreamedTextureUpdate &update = streamed_texture_updates.front()->get();
+		if (texture_owner.owns(update.texture)) {
+			Error err = _texture_update(update.texture, update.layer, update.data, false, true, &update.next_region);
+			if (err == ERR_BUSY) {
+				// Staging is still full, try again next frame.
+				break;
+			} else if (err == OK) {
+				streamed_texture_updates_recorded[update.id] = frames_drawn;
+			}
+		}
+
+		streamed_texture_updates.pop_front();
+	}
+
+	// Forget about updates the GPU has finished, they're reported as done either way.
+	thread_local LocalVector<uint64_t> finished_updates;
+	finished_updates.clear();
+	for (const KeyValue<uint64_t, uint64_t> &E : streamed_texture_updates_recorded) {
+		if (E.value <= frames_drawn - frames.size()) {
+			finished_updates.push_back(E.key);
+		}
+	}
+
+	for (uint64_t update_id : finished_updates) {
+		streamed_texture_updates_recorded.erase(update_id);
+	}
+}
+
 static _ALWAYS_INLINE_ void _copy_region(uint8_t const *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_x, uint32_t p_src_y, uint32_t p_src_w, uint32_t p_src_h, uint32_t p_src_full_w, uint32_t p_dst_pitch, uint32_t p_unit_size) {
 	uint32_t src_offset = (p_src_y * p_src_full_w + p_src_x) * p_unit_size;
 	uint32_t dst_offset = 0;
@@ -1127,9 +1188,11 @@ static _ALWAYS_INLINE_ void _copy_region(uint8_t const *__restrict p_src, uint8_
 	}
 }
 
-Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data, bool p_use_setup_queue, bool p_validate_can_update) {
+Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data, bool p_use_setup_queue, bool p_validate_can_update, uint32_t *r_next_region) {
 	_THREAD_SAFE_METHOD_
 
+	DEV_ASSERT(r_next_region == nullptr || !p_use_setup_queue);
+
 	ERR_FAIL_COND_V_MSG((draw_list || compute_list) && !p_use_setup_queue, ERR_INVALID_PARAMETER,
 			"Updating textures is forbidden during creation of a draw or compute list");
 
@@ -1192,6 +1255,10 @@ Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Ve
 	uint32_t logic_width = texture->width;
 	uint32_t logic_height = texture->height;
 
+	// Streamed updates resume from the first region that didn't fit in the staging buffer.
+	const uint32_t first_region = r_next_region ? *r_next_region : 0;
+	uint32_t region_index = 0;
+
 	for (uint32_t mm_i = 0; mm_i < texture->mipmaps; mm_i++) {
 		uint32_t depth = 0;
 		uint32_t image_total = get_image_format_required_size(texture->format, texture->width, texture->height, texture->depth, mm_i + 1, &width, &height, &depth);
@@ -1204,7 +1271,11 @@ Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Ve
 			const uint8_t *read_ptr = read_ptr_mipmap + (tight_mip_size / depth) * z;
 
 			for (uint32_t y = 0; y < height; y += region_size) {
-				for (uint32_t x = 0; x < width; x += region_size) {
+				for (uint32_t x = 0; x < width; x += region_size, region_index++) {
+					if (region_index < first_region) {
+						continue;
+					}
+
 					uint32_t region_w = MIN(region_size, width - x);
 					uint32_t region_h = MIN(region_size, height - y);
 
@@ -1224,6 +1295,20 @@ Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Ve
 					Error err = _staging_buffer_allocate(to_allocate, required_align, alloc_offset, alloc_size, required_action, false);
 					ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
+					if (r_next_region != nullptr && required_action != STAGING_REQUIRED_ACTION_NONE) {
+						// Streamed updates never stall, submit what was copied so far and continue on a later frame.
+						if (!command_buffer_to_texture_copies_vector.is_empty()) {
+							if (_texture_make_mutable(texture, p_texture)) {
+								draw_graph.add_synchronization();
+							}
+
+							draw_graph.add_texture_update(texture->driver_id, texture->draw_tracker, command_buffer_to_texture_copies_vector);
+						}
+
+						*r_next_region = region_index;
+						return ERR_BUSY;
+					}
+
 					if (!p_use_setup_queue && !command_buffer_to_texture_copies_vector.is_empty() && required_action == STAGING_REQUIRED_ACTION_FLUSH_AND_STALL_ALL) {
 						if (_texture_make_mutable(texture, p_texture)) {
 							// The texture must be mutable to be used as a copy destination.
@@ -2199,6 +2284,8 @@ RenderingDevice::FramebufferFormatID RenderingDevice::framebuffer_format_create_
 }
 
 RenderingDevice::FramebufferFormatID RenderingDevice::framebuffer_format_create_empty(TextureSamples p_samples) {
+	_THREAD_SAFE_METHOD_
+
 	FramebufferFormatKey key;
 	key.passes.push_back(FramebufferPass());
 
@@ -2234,6 +2321,19 @@ RenderingDevice::TextureSamples RenderingDevice::framebuffer_format_get_texture_
 	return E->value.pass_samples[p_pass];
 }
 
+bool RenderingDevice::framebuffer_format_get_description(FramebufferFormatID p_format, Vector<AttachmentFormat> &r_attachments, Vector<FramebufferPass> &r_passes, uint32_t &r_view_count) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<FramebufferFormatID, FramebufferFormat>::Iterator E = framebuffer_formats.find(p_format);
+	ERR_FAIL_COND_V(!E, false);
+
+	const FramebufferFormatKey &key = E->value.E->key();
+	r_attachments = key.attachments;
+	r_passes = key.passes;
+	r_view_count = key.view_count;
+	return true;
+}
+
 RID RenderingDevice::framebuffer_create_empty(const Size2i &p_size, TextureSamples p_samples, FramebufferFormatID p_format_check) {
 	_THREAD_SAFE_METHOD_
 	Framebuffer framebuffer;
@@ -2469,6 +2569,14 @@ RenderingDevice::VertexFormatID RenderingDevice::vertex_format_create(const Vect
 	return id;
 }
 
+Vector<RenderingDevice::VertexAttribute> RenderingDevice::vertex_format_get_attributes(VertexFormatID p_format) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<VertexFormatID, VertexDescriptionCache>::Iterator E = vertex_formats.find(p_format);
+	ERR_FAIL_COND_V(!E, Vector<VertexAttribute>());
+	return E->value.vertex_formats;
+}
+
 RID RenderingDevice::vertex_array_create(uint32_t p_vertex_count, VertexFormatID p_vertex_format, const Vector<RID> &p_src_buffers, const Vector<uint64_t> &p_offsets) {
 	_THREAD_SAFE_METHOD_
 
@@ -2683,6 +2791,7 @@ RID RenderingDevice::shader_create_from_bytecode(const Vector<uint8_t> &p_shader
 	shader->name = name;
 	shader->driver_id = shader_id;
 	shader->layout_hash = driver->shader_get_layout_hash(shader_id);
+	shader->binary_hash = hash_murmur3_buffer(p_shader_binary.ptr(), p_shader_binary.size());
 
 	for (int i = 0; i < shader->uniform_sets.size(); i++) {
 		uint32_t format = 0; // No format, default.
@@ -2748,6 +2857,14 @@ uint64_t RenderingDevice::shader_get_vertex_input_attribute_mask(RID p_shader) {
 	return shader->vertex_input_mask;
 }
 
+uint32_t RenderingDevice::shader_get_binary_hash(RID p_shader) {
+	_THREAD_SAFE_METHOD_
+
+	const Shader *shader = shader_owner.get_or_null(p_shader);
+	ERR_FAIL_NULL_V(shader, 0);
+	return shader->binary_hash;
+}
+
 /******************/
 /**** UNIFORMS ****/
 /******************/
@@ -4172,6 +4289,117 @@ void RenderingDevice::draw_list_draw(DrawListID p_list, bool p_use_indices, uint
 	dl->state.draw_count++;
 }
 
+void RenderingDevice::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_NULL(dl);
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_NULL(buffer);
+
+	ERR_FAIL_COND_MSG(!buffer->usage.has_flag(RDD::BUFFER_USAGE_INDIRECT_BIT), "Buffer provided was not created to do indirect draws.");
+
+	// Each command is a VkDrawIndexedIndirectCommand (5 uints) or a VkDrawIndirectCommand (4 uints).
+	const uint32_t command_size = p_use_indices ? 20 : 16;
+	const uint32_t stride = p_stride != 0 ? p_stride : command_size;
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "At least one draw must be requested.");
+	ERR_FAIL_COND_MSG(stride < command_size || (stride % 4) != 0, "Stride (" + itos(stride) + ") must be a multiple of 4 and no smaller than the size of a draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG((p_offset % 4) != 0, "Offset (" + itos(p_offset) + ") must be a multiple of 4.");
+	ERR_FAIL_COND_MSG(uint64_t(p_offset) + uint64_t(stride) * (p_draw_count - 1) + command_size > buffer->size, "Offset provided plus the requested draws is past the end of buffer.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		// Pipeline uses vertices, validate format.
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		// Make sure format is right.
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		// Using push constants, check that they were supplied.
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_count,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+#endif
+
+#ifdef DEBUG_ENABLED
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			// Nothing expected by this pipeline.
+			continue;
+		}
+
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline.");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+	}
+#endif
+
+	// Prepare descriptor sets if the API doesn't use pipeline barriers.
+	if (!driver->api_trait_get(RDD::API_TRAIT_HONORS_PIPELINE_BARRIERS)) {
+		for (uint32_t i = 0; i < dl->state.set_count; i++) {
+			if (dl->state.sets[i].pipeline_expected_format == 0) {
+				// Nothing expected by this pipeline.
+				continue;
+			}
+
+			draw_graph.add_draw_list_uniform_set_prepare_for_use(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+		}
+	}
+
+	// Bind descriptor sets.
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			draw_graph.add_draw_list_bind_uniform_set(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+
+			UniformSet *uniform_set = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+			_uniform_set_update_shared(uniform_set);
+
+			draw_graph.add_draw_list_usages(uniform_set->draw_trackers, uniform_set->draw_trackers_usage);
+
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	if (p_use_indices) {
+		draw_graph.add_draw_list_draw_indexed_indirect(buffer->driver_id, p_offset, p_draw_count, stride);
+	} else {
+		draw_graph.add_draw_list_draw_indirect(buffer->driver_id, p_offset, p_draw_count, stride);
+	}
+
+	if (buffer->draw_tracker != nullptr) {
+		draw_graph.add_draw_list_usage(buffer->draw_tracker, RDG::RESOURCE_USAGE_INDIRECT_BUFFER_READ);
+	}
+
+	dl->state.draw_count++;
+}
+
 void RenderingDevice::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -5061,6 +5289,7 @@ void RenderingDevice::swap_buffers() {
 	// Advance to the next frame and begin recording again.
 	frame = (frame + 1) % frames.size();
 	_begin_frame();
+	_process_streamed_texture_updates();
 }
 
 void RenderingDevice::submit() {
@@ -5072,6 +5301,7 @@ void RenderingDevice::submit() {
 void RenderingDevice::sync() {
 	_THREAD_SAFE_METHOD_
 	_begin_frame();
+	_process_streamed_texture_updates();
 }
 
 void RenderingDevice::_free_pending_resources(int p_frame) {
@@ -5173,6 +5403,9 @@ uint64_t RenderingDevice::get_memory_usage(MemoryType p_type) const {
 		case MEMORY_TOTAL: {
 			return driver->get_total_memory_used();
 		}
+		case MEMORY_BUDGET: {
+			return driver->get_total_memory_budget();
+		}
 		default: {
 			DEV_ASSERT(false);
 			return 0;
@@ -5459,7 +5692,11 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->command_buffer_begin(frames[0].draw_command_buffer);
 
 	// Create draw graph and start it initialized as well.
-	draw_graph.initialize(driver, device, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
+	// The command graph can automatically issue secondary command buffers for large draw lists and record them in parallel on background threads.
+	// This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However, it's not enabled
+	// by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
+	uint32_t secondary_command_buffers_per_frame = GLOBAL_GET("rendering/rendering_device/secondary_command_buffers_per_frame");
+	draw_graph.initialize(driver, device, frames.size(), main_queue_family, secondary_command_buffers_per_frame);
 	draw_graph.begin();
 
 	for (uint32_t i = 0; i < frames.size(); i++) {
@@ -5871,6 +6108,8 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("texture_create_from_extension", "type", "format", "samples", "usage_flags", "image", "width", "height", "depth", "layers"), &RenderingDevice::texture_create_from_extension);
 
 	ClassDB::bind_method(D_METHOD("texture_update", "texture", "layer", "data"), &RenderingDevice::texture_update);
+	ClassDB::bind_method(D_METHOD("texture_update_streamed", "texture", "layer", "data"), &RenderingDevice::texture_update_streamed);
+	ClassDB::bind_method(D_METHOD("texture_update_streamed_is_done", "update_id"), &RenderingDevice::texture_update_streamed_is_done);
 	ClassDB::bind_method(D_METHOD("texture_get_data", "texture", "layer"), &RenderingDevice::texture_get_data);
 
 	ClassDB::bind_method(D_METHOD("texture_is_format_supported_for_usage", "format", "usage_flags"), &RenderingDevice::texture_is_format_supported_for_usage);
@@ -5952,6 +6191,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("draw_list_set_push_constant", "draw_list", "buffer", "size_bytes"), &RenderingDevice::_draw_list_set_push_constant);
 
 	ClassDB::bind_method(D_METHOD("draw_list_draw", "draw_list", "use_indices", "instances", "procedural_vertex_count"), &RenderingDevice::draw_list_draw, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("draw_list_draw_indirect", "draw_list", "use_indices", "buffer", "offset", "draw_count", "stride"), &RenderingDevice::draw_list_draw_indirect, DEFVAL(0), DEFVAL(1), DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("draw_list_enable_scissor", "draw_list", "rect"), &RenderingDevice::draw_list_enable_scissor, DEFVAL(Rect2()));
 	ClassDB::bind_method(D_METHOD("draw_list_disable_scissor", "draw_list"), &RenderingDevice::draw_list_disable_scissor);
@@ -6528,6 +6768,7 @@ void RenderingDevice::_bind_methods() {
 	BIND_ENUM_CONSTANT(MEMORY_TEXTURES);
 	BIND_ENUM_CONSTANT(MEMORY_BUFFERS);
 	BIND_ENUM_CONSTANT(MEMORY_TOTAL);
+	BIND_ENUM_CONSTANT(MEMORY_BUDGET);
 
 	BIND_CONSTANT(INVALID_ID);
 	BIND_CONSTANT(INVALID_FORMAT_ID);
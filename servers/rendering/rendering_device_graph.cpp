@@ -699,6 +699,16 @@ void RenderingDeviceGraph::_run_draw_list_command(RDD::CommandBufferID p_command
 				driver->command_render_draw_indexed(p_command_buffer, draw_indexed_instruction->index_count, draw_indexed_instruction->instance_count, draw_indexed_instruction->first_index, 0, 0);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				driver->command_render_draw_indexed_indirect(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				driver->command_render_draw_indirect(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_EXECUTE_COMMANDS: {
 				const DrawListExecuteCommandsInstruction *execute_commands_instruction = reinterpret_cast<const DrawListExecuteCommandsInstruction *>(instruction);
 				driver->command_buffer_execute_secondary(p_command_buffer, execute_commands_instruction->command_buffer);
@@ -748,19 +758,31 @@ void RenderingDeviceGraph::_run_draw_list_command(RDD::CommandBufferID p_command
 	}
 }
 
-void RenderingDeviceGraph::_run_secondary_command_buffer_task(const SecondaryCommandBuffer *p_secondary) {
-	driver->command_buffer_begin_secondary(p_secondary->command_buffer, p_secondary->render_pass, 0, p_secondary->framebuffer);
-	_run_draw_list_command(p_secondary->command_buffer, p_secondary->instruction_data.ptr(), p_secondary->instruction_data.size());
-	driver->command_buffer_end(p_secondary->command_buffer);
+void RenderingDeviceGraph::_run_secondary_command_buffer_task(uint32_t p_index, Frame *p_frame) {
+	const SecondaryCommandBuffer &secondary = p_frame->secondary_command_buffers[p_index];
+	const RecordedDrawListCommand *draw_list_command = reinterpret_cast<const RecordedDrawListCommand *>(&command_data[command_data_offsets[secondary.command_index]]);
+	driver->command_buffer_begin_secondary(secondary.command_buffer, draw_list_command->render_pass, 0, draw_list_command->framebuffer);
+	_run_draw_list_command(secondary.command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
+	driver->command_buffer_end(secondary.command_buffer);
+}
+
+void RenderingDeviceGraph::_start_secondary_command_buffer_tasks() {
+	Frame &f = frames[frame];
+	if (f.secondary_command_buffers_used == 0) {
+		return;
+	}
+
+	// The command data won't change until the graph begins again, so every draw list that was assigned a secondary command buffer can be
+	// recorded from its own worker while the main thread sorts the graph and records the rest of the commands.
+	DEV_ASSERT(f.secondary_command_buffers_group == -1);
+	f.secondary_command_buffers_group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, &f, f.secondary_command_buffers_used, -1, true, SNAME("RenderingDeviceGraphSecondary"));
 }
 
 void RenderingDeviceGraph::_wait_for_secondary_command_buffer_tasks() {
-	for (uint32_t i = 0; i < frames[frame].secondary_command_buffers_used; i++) {
-		WorkerThreadPool::TaskID &task = frames[frame].secondary_command_buffers[i].task;
-		if (task != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
-			task = WorkerThreadPool::INVALID_TASK_ID;
-		}
+	WorkerThreadPool::GroupID &group = frames[frame].secondary_command_buffers_group;
+	if (group != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		group = -1;
 	}
 }
 
@@ -824,7 +846,13 @@ void RenderingDeviceGraph::_run_render_commands(int32_t p_level, const RecordedC
 				const RecordedDrawListCommand *draw_list_command = reinterpret_cast<const RecordedDrawListCommand *>(command);
 				const VectorView clear_values(draw_list_command->clear_values(), draw_list_command->clear_values_count);
 				driver->command_begin_render_pass(r_command_buffer, draw_list_command->render_pass, draw_list_command->framebuffer, draw_list_command->command_buffer_type, draw_list_command->region, clear_values);
-				_run_draw_list_command(r_command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
+				if (draw_list_command->secondary_command_buffer_index >= 0) {
+					// The secondary must be done recording before it can be executed. This only blocks the first time it's reached.
+					_wait_for_secondary_command_buffer_tasks();
+					driver->command_buffer_execute_secondary(r_command_buffer, frames[frame].secondary_command_buffers[draw_list_command->secondary_command_buffer_index].command_buffer);
+				} else {
+					_run_draw_list_command(r_command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
+				}
 				driver->command_end_render_pass(r_command_buffer);
 			} break;
 			case RecordedCommand::TYPE_TEXTURE_CLEAR: {
@@ -955,6 +983,59 @@ void RenderingDeviceGraph::_run_label_command_change(RDD::CommandBufferID p_comm
 	}
 }
 
+void RenderingDeviceGraph::_defer_draw_lists_for_compute(RecordedCommandSort *p_sorted_commands) {
+	// A level's barriers wait on every earlier command of the source stages, not only the ones that produced the resources. Draw lists
+	// that are not needed by the next level are moved into it when it runs compute lists, so those compute lists don't wait for them
+	// through the graphics stages of their barriers, and they're recorded after the compute lists so both can overlap on the queue.
+	const uint32_t deferred_priority = 5;
+
+	thread_local LocalVector<uint8_t> level_has_compute;
+	level_has_compute.clear();
+	for (uint32_t i = 0; i < command_count; i++) {
+		const RecordedCommand &recorded_command = *reinterpret_cast<const RecordedCommand *>(&command_data[command_data_offsets[i]]);
+		if (recorded_command.type == RecordedCommand::TYPE_COMPUTE_LIST) {
+			const uint32_t level = p_sorted_commands[i].level;
+			if (level >= level_has_compute.size()) {
+				uint32_t previous_size = level_has_compute.size();
+				level_has_compute.resize(level + 1);
+				memset(&level_has_compute[previous_size], 0, level + 1 - previous_size);
+			}
+
+			level_has_compute[level] = 1;
+		}
+	}
+
+	for (uint32_t i = 0; i < command_count; i++) {
+		const RecordedCommand &recorded_command = *reinterpret_cast<const RecordedCommand *>(&command_data[command_data_offsets[i]]);
+		if (recorded_command.type != RecordedCommand::TYPE_DRAW_LIST) {
+			continue;
+		}
+
+		const uint32_t next_level = p_sorted_commands[i].level + 1;
+		if (next_level >= level_has_compute.size() || !level_has_compute[next_level]) {
+			continue;
+		}
+
+		bool adjacent_in_next_level = false;
+		int32_t adjacency_list_index = recorded_command.adjacent_command_list_index;
+		while (adjacency_list_index >= 0) {
+			const RecordedCommandListNode &command_list_node = command_list_nodes[adjacency_list_index];
+			if (p_sorted_commands[command_list_node.command_index].level <= next_level) {
+				adjacent_in_next_level = true;
+				break;
+			}
+
+			adjacency_list_index = command_list_node.next_list_index;
+		}
+
+		if (!adjacent_in_next_level) {
+			// Deferring a command only loosens the constraints of the commands it depends on, so a single pass is enough.
+			p_sorted_commands[i].level = next_level;
+			p_sorted_commands[i].priority = deferred_priority;
+		}
+	}
+}
+
 void RenderingDeviceGraph::_boost_priority_for_render_commands(RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_boosted_priority) {
 	if (p_sorted_commands_count == 0) {
 		return;
@@ -1175,6 +1256,16 @@ void RenderingDeviceGraph::_print_draw_list(const uint8_t *p_instruction_data, u
 				print_line("\tDRAW INDICES", draw_indexed_instruction->index_count, "INSTANCES", draw_indexed_instruction->instance_count, "FIRST INDEX", draw_indexed_instruction->first_index);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				print_line("\tDRAW INDEXED INDIRECT BUFFER ID", itos(draw_indirect_instruction->buffer.id), "OFFSET", draw_indirect_instruction->offset, "DRAW COUNT", draw_indirect_instruction->draw_count, "STRIDE", draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				print_line("\tDRAW INDIRECT BUFFER ID", itos(draw_indirect_instruction->buffer.id), "OFFSET", draw_indirect_instruction->offset, "DRAW COUNT", draw_indirect_instruction->draw_count, "STRIDE", draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_EXECUTE_COMMANDS: {
 				print_line("\tEXECUTE COMMANDS");
 				instruction_data_cursor += sizeof(DrawListExecuteCommandsInstruction);
@@ -1278,7 +1369,6 @@ void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Dev
 			SecondaryCommandBuffer &secondary = frames[i].secondary_command_buffers[j];
 			secondary.command_pool = driver->command_pool_create(p_secondary_command_queue_family, RDD::COMMAND_BUFFER_TYPE_SECONDARY);
 			secondary.command_buffer = driver->command_buffer_create(secondary.command_pool);
-			secondary.task = WorkerThreadPool::INVALID_TASK_ID;
 		}
 	}
 
@@ -1496,6 +1586,7 @@ void RenderingDeviceGraph::add_draw_list_begin(RDD::RenderPassID p_render_pass,
 	draw_instruction_list.render_pass = p_render_pass;
 	draw_instruction_list.framebuffer = p_framebuffer;
 	draw_instruction_list.region = p_region;
+	draw_instruction_list.uses_subpasses = false;
 	draw_instruction_list.clear_values.resize(p_clear_values.size());
 	for (uint32_t i = 0; i < p_clear_values.size(); i++) {
 		draw_instruction_list.clear_values[i] = p_clear_values[i];
@@ -1591,6 +1682,26 @@ void RenderingDeviceGraph::add_draw_list_draw_indexed(uint32_t p_index_count, ui
 	instruction->first_index = p_first_index;
 }
 
+void RenderingDeviceGraph::add_draw_list_draw_indexed_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawListDrawIndirectInstruction *instruction = reinterpret_cast<DrawListDrawIndirectInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDrawIndirectInstruction)));
+	instruction->type = DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT;
+	instruction->buffer = p_buffer;
+	instruction->offset = p_offset;
+	instruction->draw_count = p_draw_count;
+	instruction->stride = p_stride;
+	draw_instruction_list.stages.set_flag(RDD::PIPELINE_STAGE_DRAW_INDIRECT_BIT);
+}
+
+void RenderingDeviceGraph::add_draw_list_draw_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawListDrawIndirectInstruction *instruction = reinterpret_cast<DrawListDrawIndirectInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDrawIndirectInstruction)));
+	instruction->type = DrawListInstruction::TYPE_DRAW_INDIRECT;
+	instruction->buffer = p_buffer;
+	instruction->offset = p_offset;
+	instruction->draw_count = p_draw_count;
+	instruction->stride = p_stride;
+	draw_instruction_list.stages.set_flag(RDD::PIPELINE_STAGE_DRAW_INDIRECT_BIT);
+}
+
 void RenderingDeviceGraph::add_draw_list_execute_commands(RDD::CommandBufferID p_command_buffer) {
 	DrawListExecuteCommandsInstruction *instruction = reinterpret_cast<DrawListExecuteCommandsInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListExecuteCommandsInstruction)));
 	instruction->type = DrawListInstruction::TYPE_EXECUTE_COMMANDS;
@@ -1601,6 +1712,7 @@ void RenderingDeviceGraph::add_draw_list_next_subpass(RDD::CommandBufferType p_c
 	DrawListNextSubpassInstruction *instruction = reinterpret_cast<DrawListNextSubpassInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListNextSubpassInstruction)));
 	instruction->type = DrawListInstruction::TYPE_NEXT_SUBPASS;
 	instruction->command_buffer_type = p_command_buffer_type;
+	draw_instruction_list.uses_subpasses = true;
 }
 
 void RenderingDeviceGraph::add_draw_list_set_blend_constants(const Color &p_color) {
@@ -1669,29 +1781,16 @@ void RenderingDeviceGraph::add_draw_list_usages(VectorView<ResourceTracker *> p_
 }
 
 void RenderingDeviceGraph::add_draw_list_end() {
-	// Arbitrary size threshold to evaluate if it'd be best to record the draw list on the background as a secondary buffer.
+	// Arbitrary size threshold to evaluate if it'd be best to record the draw list on the background as a secondary buffer. Draw lists with
+	// more than one subpass are always recorded inline, as a secondary command buffer can only inherit a single subpass.
 	const uint32_t instruction_data_threshold_for_secondary = 16384;
-	RDD::CommandBufferType command_buffer_type;
+	RDD::CommandBufferType command_buffer_type = RDD::COMMAND_BUFFER_TYPE_PRIMARY;
+	int32_t secondary_command_buffer_index = -1;
 	uint32_t &secondary_buffers_used = frames[frame].secondary_command_buffers_used;
-	if (draw_instruction_list.data.size() > instruction_data_threshold_for_secondary && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
-		// Copy the current instruction list data into another array that will be used by the secondary command buffer worker.
-		SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[secondary_buffers_used];
-		secondary.render_pass = draw_instruction_list.render_pass;
-		secondary.framebuffer = draw_instruction_list.framebuffer;
-		secondary.instruction_data.resize(draw_instruction_list.data.size());
-		memcpy(secondary.instruction_data.ptr(), draw_instruction_list.data.ptr(), draw_instruction_list.data.size());
-
-		// Run a background task for recording the secondary command buffer.
-		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, &secondary, true);
-
-		// Clear the instruction list and add a single command for executing the secondary command buffer instead.
-		draw_instruction_list.data.clear();
-		add_draw_list_execute_commands(secondary.command_buffer);
-		secondary_buffers_used++;
-
+	if (draw_instruction_list.data.size() > instruction_data_threshold_for_secondary && !draw_instruction_list.uses_subpasses && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
+		// Reserve a secondary command buffer. The instructions are kept in the command and recorded on a worker thread when the graph ends.
+		secondary_command_buffer_index = secondary_buffers_used++;
 		command_buffer_type = RDD::COMMAND_BUFFER_TYPE_SECONDARY;
-	} else {
-		command_buffer_type = RDD::COMMAND_BUFFER_TYPE_PRIMARY;
 	}
 
 	int32_t command_index;
@@ -1705,6 +1804,7 @@ void RenderingDeviceGraph::add_draw_list_end() {
 	command->render_pass = draw_instruction_list.render_pass;
 	command->framebuffer = draw_instruction_list.framebuffer;
 	command->command_buffer_type = command_buffer_type;
+	command->secondary_command_buffer_index = secondary_command_buffer_index;
 	command->region = draw_instruction_list.region;
 	command->clear_values_count = draw_instruction_list.clear_values.size();
 
@@ -1715,6 +1815,10 @@ void RenderingDeviceGraph::add_draw_list_end() {
 
 	memcpy(command->instruction_data(), draw_instruction_list.data.ptr(), instruction_data_size);
 	_add_command_to_graph(draw_instruction_list.command_trackers.ptr(), draw_instruction_list.command_tracker_usages.ptr(), draw_instruction_list.command_trackers.size(), command_index, command);
+
+	if (secondary_command_buffer_index >= 0) {
+		frames[frame].secondary_command_buffers[secondary_command_buffer_index].command_index = command_index;
+	}
 }
 
 void RenderingDeviceGraph::add_texture_clear(RDD::TextureID p_dst, ResourceTracker *p_dst_tracker, const Color &p_color, const RDD::TextureSubresourceRange &p_range) {
@@ -1894,6 +1998,8 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 		return;
 	}
 
+	_start_secondary_command_buffer_tasks();
+
 	thread_local LocalVector<RecordedCommandSort> commands_sorted;
 	if (p_reorder_commands) {
 		thread_local LocalVector<int64_t> command_stack;
@@ -1988,6 +2094,10 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 			commands_sorted[sorted_command_index].index = sorted_command_index;
 			commands_sorted[sorted_command_index].priority = PriorityTable[recorded_command.type];
 		}
+
+		if (!device.workarounds.avoid_compute_after_draw) {
+			_defer_draw_lists_for_compute(commands_sorted.ptr());
+		}
 	} else {
 		commands_sorted.clear();
 		commands_sorted.resize(command_count);
@@ -1997,8 +2107,6 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 		}
 	}
 
-	_wait_for_secondary_command_buffer_tasks();
-
 	if (command_count > 0) {
 		int32_t current_label_index = -1;
 		int32_t current_label_level = -1;
@@ -2064,6 +2172,9 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 #endif
 	}
 
+	// Every secondary should've been executed by now, but the tasks must never outlive the command data they read from.
+	_wait_for_secondary_command_buffer_tasks();
+
 	// Advance the frame counter. It's not necessary to do this if no commands are recorded because that means no secondary command buffers were used.
 	frame = (frame + 1) % frames.size();
 }
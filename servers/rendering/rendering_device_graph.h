@@ -69,6 +69,8 @@ public:
 			TYPE_CLEAR_ATTACHMENTS,
 			TYPE_DRAW,
 			TYPE_DRAW_INDEXED,
+			TYPE_DRAW_INDEXED_INDIRECT,
+			TYPE_DRAW_INDIRECT,
 			TYPE_EXECUTE_COMMANDS,
 			TYPE_NEXT_SUBPASS,
 			TYPE_SET_BLEND_CONSTANTS,
@@ -226,6 +228,7 @@ private:
 		RDD::FramebufferID framebuffer;
 		Rect2i region;
 		LocalVector<RDD::RenderPassClearValue> clear_values;
+		bool uses_subpasses = false;
 	};
 
 	struct RecordedCommandSort {
@@ -311,6 +314,7 @@ private:
 		RDD::RenderPassID render_pass;
 		RDD::FramebufferID framebuffer;
 		RDD::CommandBufferType command_buffer_type;
+		int32_t secondary_command_buffer_index = -1;
 		Rect2i region;
 		uint32_t clear_values_count = 0;
 
@@ -460,6 +464,13 @@ private:
 		uint32_t first_index = 0;
 	};
 
+	struct DrawListDrawIndirectInstruction : DrawListInstruction {
+		RDD::BufferID buffer;
+		uint32_t offset = 0;
+		uint32_t draw_count = 0;
+		uint32_t stride = 0;
+	};
+
 	struct DrawListEndRenderPassInstruction : DrawListInstruction {
 		// No contents.
 	};
@@ -571,17 +582,15 @@ private:
 	};
 
 	struct SecondaryCommandBuffer {
-		LocalVector<uint8_t> instruction_data;
 		RDD::CommandBufferID command_buffer;
 		RDD::CommandPoolID command_pool;
-		RDD::RenderPassID render_pass;
-		RDD::FramebufferID framebuffer;
-		WorkerThreadPool::TaskID task;
+		int32_t command_index = -1;
 	};
 
 	struct Frame {
 		TightLocalVector<SecondaryCommandBuffer> secondary_command_buffers;
 		uint32_t secondary_command_buffers_used = 0;
+		WorkerThreadPool::GroupID secondary_command_buffers_group = -1;
 	};
 
 	RDD *driver = nullptr;
@@ -634,10 +643,12 @@ private:
 #endif
 	void _run_compute_list_command(RDD::CommandBufferID p_command_buffer, const uint8_t *p_instruction_data, uint32_t p_instruction_data_size);
 	void _run_draw_list_command(RDD::CommandBufferID p_command_buffer, const uint8_t *p_instruction_data, uint32_t p_instruction_data_size);
-	void _run_secondary_command_buffer_task(const SecondaryCommandBuffer *p_secondary);
+	void _run_secondary_command_buffer_task(uint32_t p_index, Frame *p_frame);
+	void _start_secondary_command_buffer_tasks();
 	void _wait_for_secondary_command_buffer_tasks();
 	void _run_render_commands(int32_t p_level, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool, int32_t &r_current_label_index, int32_t &r_current_label_level);
 	void _run_label_command_change(RDD::CommandBufferID p_command_buffer, int32_t p_new_label_index, int32_t p_new_level, bool p_ignore_previous_value, bool p_use_label_for_empty, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, int32_t &r_current_label_index, int32_t &r_current_label_level);
+	void _defer_draw_lists_for_compute(RecordedCommandSort *p_sorted_commands);
 	void _boost_priority_for_render_commands(RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_boosted_priority);
 	void _group_barriers_for_render_commands(RDD::CommandBufferID p_command_buffer, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, bool p_full_memory_barrier);
 	void _print_render_commands(const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count);
@@ -672,6 +683,8 @@ public:
 	void add_draw_list_clear_attachments(VectorView<RDD::AttachmentClear> p_attachments_clear, VectorView<Rect2i> p_attachments_clear_rect);
 	void add_draw_list_draw(uint32_t p_vertex_count, uint32_t p_instance_count);
 	void add_draw_list_draw_indexed(uint32_t p_index_count, uint32_t p_instance_count, uint32_t p_first_index);
+	void add_draw_list_draw_indexed_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride);
+	void add_draw_list_draw_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride);
 	void add_draw_list_execute_commands(RDD::CommandBufferID p_command_buffer);
 	void add_draw_list_next_subpass(RDD::CommandBufferType p_command_buffer_type);
 	void add_draw_list_set_blend_constants(const Color &p_color);
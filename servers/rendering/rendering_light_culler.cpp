@@ -32,8 +32,19 @@
 
 #include "core/math/plane.h"
 #include "core/math/projection.h"
+#include "core/object/worker_thread_pool.h"
 #include "rendering_server_globals.h"
 
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LIGHT_CULLER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LIGHT_CULLER_NEON
+#endif
+#endif
+
 #ifdef RENDERING_LIGHT_CULLER_DEBUG_STRINGS
 const char *RenderingLightCuller::Data::string_planes[] = {
 	"NEAR",
@@ -135,21 +146,33 @@ bool RenderingLightCuller::cull_directional_light(const RendererSceneCull::Insta
 	Vector3 maxs = Vector3(p_bound.bounds[3], p_bound.bounds[4], p_bound.bounds[5]);
 	AABB bb(mins, maxs - mins);
 
-	real_t r_min, r_max;
-	for (int p = 0; p < cull_planes.num_cull_planes; p++) {
-		bb.project_range_in_plane(cull_planes.cull_planes[p], r_min, r_max);
-		if (r_min > 0.0f) {
+	if (cull_planes.cull_box(bb)) {
 #ifdef LIGHT_CULLER_DEBUG_DIRECTIONAL_LIGHT
-			cull_planes.rejected_count++;
+		cull_planes.rejected_count++;
 #endif
 
-			return false;
-		}
+		return false;
 	}
 
 	return true;
 }
 
+void RenderingLightCuller::_cull_casters(uint32_t p_task, CullCastersData *p_data) {
+	const PagedArray<RendererSceneCull::Instance *> &list = *p_data->list;
+	const uint32_t from = p_task * CULL_CASTERS_PER_TASK;
+	const uint32_t to = MIN(from + CULL_CASTERS_PER_TASK, (uint32_t)list.size());
+
+	CullBoxes boxes;
+	for (uint32_t n = from; n < to; n += 4) {
+		const uint32_t count = MIN(4u, to - n);
+		for (uint32_t i = 0; i < 4; i++) {
+			// Unused lanes repeat the last box, their result is masked out below.
+			boxes.set(i, list[n + MIN(i, count - 1)]->transformed_aabb);
+		}
+		p_data->culled[n / 4] = data.regular_cull_planes.cull_boxes(boxes) & ((1 << count) - 1);
+	}
+}
+
 void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result) {
 	if (!data.is_active() || !is_caster_culling_active()) {
 		return;
@@ -168,48 +191,33 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 	uint32_t count_before = r_instance_shadow_cull_result.size();
 #endif
 
-	// Go through all the casters in the list (the list will hopefully shrink as we go).
-	for (int n = 0; n < (int)list.size(); n++) {
-		// World space aabb.
-		const AABB &bb = list[n]->transformed_aabb;
-
-#ifdef LIGHT_CULLER_DEBUG_LOGGING
-		if (is_logging()) {
-			print_line("bb : " + String(bb));
-		}
-#endif
-
-		real_t r_min, r_max;
-		bool show = true;
-
-		for (int p = 0; p < data.regular_cull_planes.num_cull_planes; p++) {
-			// As we only need r_min, could this be optimized?
-			bb.project_range_in_plane(data.regular_cull_planes.cull_planes[p], r_min, r_max);
-
-#ifdef LIGHT_CULLER_DEBUG_LOGGING
-			if (is_logging()) {
-				print_line("\tplane " + itos(p) + " : " + String(data.regular_cull_planes.cull_planes[p]) + " r_min " + String(Variant(r_min)) + " r_max " + String(Variant(r_max)));
-			}
-#endif
+	// Test the world space AABBs of the casters four at a time, split across threads for long lists.
+	const uint32_t caster_count = list.size();
+	CullCastersData &cull_data = data.cull_casters_data;
+	cull_data.list = &list;
+	cull_data.culled.resize((caster_count + 3) / 4);
 
-			if (r_min > 0.0f) {
-				show = false;
-				break;
-			}
+	const uint32_t task_count = (caster_count + CULL_CASTERS_PER_TASK - 1) / CULL_CASTERS_PER_TASK;
+	if (caster_count >= CULL_CASTERS_THREADED_MIN) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderingLightCuller::_cull_casters, &cull_data, task_count, -1, true, SNAME("LightCullCasters"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < task_count; i++) {
+			_cull_casters(i, &cull_data);
 		}
+	}
 
-		// Remove.
-		if (!show) {
+	// Remove back to front, so the casters swapped in from the end have already been tested.
+	for (int64_t n = (int64_t)caster_count - 1; n >= 0; n--) {
+		if (cull_data.culled[n / 4] & (1 << (n % 4))) {
 			list.remove_at_unordered(n);
 
-			// Repeat this element next iteration of the loop as it has been removed and replaced by the last.
-			n--;
-
 #ifdef LIGHT_CULLER_DEBUG_REGULAR_LIGHT
 			data.regular_rejected_count++;
 #endif
 		}
 	}
+	cull_data.list = nullptr;
 
 #ifdef LIGHT_CULLER_DEBUG_LOGGING
 	uint32_t removed = r_instance_shadow_cull_result.size() - count_before;
@@ -221,9 +229,137 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 #endif
 }
 
+void RenderingLightCuller::CullBoxes::set(int p_lane, const AABB &p_aabb) {
+	Vector3 half_extents = p_aabb.size * 0.5f;
+	Vector3 center = p_aabb.position + half_extents;
+	center_x[p_lane] = center.x;
+	center_y[p_lane] = center.y;
+	center_z[p_lane] = center.z;
+	extents_x[p_lane] = half_extents.x;
+	extents_y[p_lane] = half_extents.y;
+	extents_z[p_lane] = half_extents.z;
+}
+
 void RenderingLightCuller::LightCullPlanes::add_cull_plane(const Plane &p) {
 	ERR_FAIL_COND(num_cull_planes >= MAX_CULL_PLANES);
+	int index = num_cull_planes;
 	cull_planes[num_cull_planes++] = p;
+
+	normal_x[index] = p.normal.x;
+	normal_y[index] = p.normal.y;
+	normal_z[index] = p.normal.z;
+	abs_normal_x[index] = Math::abs(p.normal.x);
+	abs_normal_y[index] = Math::abs(p.normal.y);
+	abs_normal_z[index] = Math::abs(p.normal.z);
+	d[index] = p.d;
+
+	// Pad the rest of the group of four with planes that every box is behind.
+	for (int i = index + 1; i % 4 != 0; i++) {
+		normal_x[i] = 0;
+		normal_y[i] = 0;
+		normal_z[i] = 0;
+		abs_normal_x[i] = 0;
+		abs_normal_y[i] = 0;
+		abs_normal_z[i] = 0;
+		d[i] = 1;
+	}
+}
+
+// Same test as AABB::project_range_in_plane(), the box is culled when its
+// closest point to the plane is in front of it.
+bool RenderingLightCuller::LightCullPlanes::cull_box(const AABB &p_aabb) const {
+	Vector3 half_extents = p_aabb.size * 0.5f;
+	Vector3 center = p_aabb.position + half_extents;
+	const int padded_count = (num_cull_planes + 3) & ~3;
+
+#if defined(LIGHT_CULLER_SSE2)
+	const __m128 cx = _mm_set1_ps(center.x);
+	const __m128 cy = _mm_set1_ps(center.y);
+	const __m128 cz = _mm_set1_ps(center.z);
+	const __m128 ex = _mm_set1_ps(half_extents.x);
+	const __m128 ey = _mm_set1_ps(half_extents.y);
+	const __m128 ez = _mm_set1_ps(half_extents.z);
+	for (int p = 0; p < padded_count; p += 4) {
+		__m128 distance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(normal_x + p), cx), _mm_mul_ps(_mm_load_ps(normal_y + p), cy)), _mm_mul_ps(_mm_load_ps(normal_z + p), cz)), _mm_load_ps(d + p));
+		__m128 length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(abs_normal_x + p), ex), _mm_mul_ps(_mm_load_ps(abs_normal_y + p), ey)), _mm_mul_ps(_mm_load_ps(abs_normal_z + p), ez));
+		if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_sub_ps(distance, length), _mm_setzero_ps()))) {
+			return true;
+		}
+	}
+#elif defined(LIGHT_CULLER_NEON)
+	const float32x4_t cx = vdupq_n_f32(center.x);
+	const float32x4_t cy = vdupq_n_f32(center.y);
+	const float32x4_t cz = vdupq_n_f32(center.z);
+	const float32x4_t ex = vdupq_n_f32(half_extents.x);
+	const float32x4_t ey = vdupq_n_f32(half_extents.y);
+	const float32x4_t ez = vdupq_n_f32(half_extents.z);
+	for (int p = 0; p < padded_count; p += 4) {
+		float32x4_t distance = vsubq_f32(vaddq_f32(vaddq_f32(vmulq_f32(vld1q_f32(normal_x + p), cx), vmulq_f32(vld1q_f32(normal_y + p), cy)), vmulq_f32(vld1q_f32(normal_z + p), cz)), vld1q_f32(d + p));
+		float32x4_t length = vaddq_f32(vaddq_f32(vmulq_f32(vld1q_f32(abs_normal_x + p), ex), vmulq_f32(vld1q_f32(abs_normal_y + p), ey)), vmulq_f32(vld1q_f32(abs_normal_z + p), ez));
+		uint32x4_t outside = vcgtq_f32(vsubq_f32(distance, length), vdupq_n_f32(0.0f));
+		uint32x2_t any_outside = vorr_u32(vget_low_u32(outside), vget_high_u32(outside));
+		if (vget_lane_u32(any_outside, 0) | vget_lane_u32(any_outside, 1)) {
+			return true;
+		}
+	}
+#else
+	for (int p = 0; p < padded_count; p++) {
+		real_t distance = normal_x[p] * center.x + normal_y[p] * center.y + normal_z[p] * center.z - d[p];
+		real_t length = abs_normal_x[p] * half_extents.x + abs_normal_y[p] * half_extents.y + abs_normal_z[p] * half_extents.z;
+		if (distance - length > 0.0f) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+uint32_t RenderingLightCuller::LightCullPlanes::cull_boxes(const CullBoxes &p_boxes) const {
+#if defined(LIGHT_CULLER_SSE2)
+	const __m128 cx = _mm_load_ps(p_boxes.center_x);
+	const __m128 cy = _mm_load_ps(p_boxes.center_y);
+	const __m128 cz = _mm_load_ps(p_boxes.center_z);
+	const __m128 ex = _mm_load_ps(p_boxes.extents_x);
+	const __m128 ey = _mm_load_ps(p_boxes.extents_y);
+	const __m128 ez = _mm_load_ps(p_boxes.extents_z);
+	__m128 culled = _mm_setzero_ps();
+	for (int p = 0; p < num_cull_planes; p++) {
+		__m128 distance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(normal_x[p]), cx), _mm_mul_ps(_mm_set1_ps(normal_y[p]), cy)), _mm_mul_ps(_mm_set1_ps(normal_z[p]), cz)), _mm_set1_ps(d[p]));
+		__m128 length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(abs_normal_x[p]), ex), _mm_mul_ps(_mm_set1_ps(abs_normal_y[p]), ey)), _mm_mul_ps(_mm_set1_ps(abs_normal_z[p]), ez));
+		culled = _mm_or_ps(culled, _mm_cmpgt_ps(_mm_sub_ps(distance, length), _mm_setzero_ps()));
+		if (_mm_movemask_ps(culled) == 0xF) {
+			break;
+		}
+	}
+	return _mm_movemask_ps(culled);
+#elif defined(LIGHT_CULLER_NEON)
+	const float32x4_t cx = vld1q_f32(p_boxes.center_x);
+	const float32x4_t cy = vld1q_f32(p_boxes.center_y);
+	const float32x4_t cz = vld1q_f32(p_boxes.center_z);
+	const float32x4_t ex = vld1q_f32(p_boxes.extents_x);
+	const float32x4_t ey = vld1q_f32(p_boxes.extents_y);
+	const float32x4_t ez = vld1q_f32(p_boxes.extents_z);
+	uint32x4_t culled = vdupq_n_u32(0);
+	for (int p = 0; p < num_cull_planes; p++) {
+		float32x4_t distance = vsubq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(cx, normal_x[p]), vmulq_n_f32(cy, normal_y[p])), vmulq_n_f32(cz, normal_z[p])), vdupq_n_f32(d[p]));
+		float32x4_t length = vaddq_f32(vaddq_f32(vmulq_n_f32(ex, abs_normal_x[p]), vmulq_n_f32(ey, abs_normal_y[p])), vmulq_n_f32(ez, abs_normal_z[p]));
+		culled = vorrq_u32(culled, vcgtq_f32(vsubq_f32(distance, length), vdupq_n_f32(0.0f)));
+	}
+	return (vgetq_lane_u32(culled, 0) & 1) | (vgetq_lane_u32(culled, 1) & 2) | (vgetq_lane_u32(culled, 2) & 4) | (vgetq_lane_u32(culled, 3) & 8);
+#else
+	uint32_t culled = 0;
+	for (int i = 0; i < 4; i++) {
+		for (int p = 0; p < num_cull_planes; p++) {
+			real_t distance = normal_x[p] * p_boxes.center_x[i] + normal_y[p] * p_boxes.center_y[i] + normal_z[p] * p_boxes.center_z[i] - d[p];
+			real_t length = abs_normal_x[p] * p_boxes.extents_x[i] + abs_normal_y[p] * p_boxes.extents_y[i] + abs_normal_z[p] * p_boxes.extents_z[i];
+			if (distance - length > 0.0f) {
+				culled |= 1 << i;
+				break;
+			}
+		}
+	}
+	return culled;
+#endif
 }
 
 // Directional lights are different to points, as the origin is infinitely in the distance, so the plane third
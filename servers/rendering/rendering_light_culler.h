@@ -124,7 +124,11 @@ private:
 		NUM_CAM_PLANES = 6,
 		NUM_CAM_POINTS = 8,
 		MAX_CULL_PLANES = 17,
+		MAX_CULL_PLANES_PADDED = (MAX_CULL_PLANES + 3) & ~3,
 		LUT_SIZE = 64,
+		// Casters are culled in blocks of this many per thread task.
+		CULL_CASTERS_PER_TASK = 1024,
+		CULL_CASTERS_THREADED_MIN = 4 * CULL_CASTERS_PER_TASK,
 	};
 
 public:
@@ -152,15 +156,49 @@ public:
 	void set_light_culling_active(bool p_active) { data.light_culling_active = p_active; }
 
 private:
+	// Four boxes in SoA layout, tested against the planes together.
+	struct alignas(16) CullBoxes {
+		real_t center_x[4];
+		real_t center_y[4];
+		real_t center_z[4];
+		real_t extents_x[4];
+		real_t extents_y[4];
+		real_t extents_z[4];
+
+		void set(int p_lane, const AABB &p_aabb);
+	};
+
 	struct LightCullPlanes {
 		void add_cull_plane(const Plane &p);
 		Plane cull_planes[MAX_CULL_PLANES];
 		int num_cull_planes = 0;
+
+		// The same planes in SoA layout, padded to a multiple of four with planes that never cull.
+		alignas(16) real_t normal_x[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t normal_y[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t normal_z[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t abs_normal_x[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t abs_normal_y[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t abs_normal_z[MAX_CULL_PLANES_PADDED];
+		alignas(16) real_t d[MAX_CULL_PLANES_PADDED];
+
+		// Returns true if the box lies entirely in front of one of the planes.
+		bool cull_box(const AABB &p_aabb) const;
+		// Returns one bit per box, set when that box lies entirely in front of one of the planes.
+		uint32_t cull_boxes(const CullBoxes &p_boxes) const;
+
 #ifdef LIGHT_CULLER_DEBUG_DIRECTIONAL_LIGHT
 		uint32_t rejected_count = 0;
 #endif
 	};
 
+	struct CullCastersData {
+		PagedArray<RendererSceneCull::Instance *> *list = nullptr;
+		LocalVector<uint8_t> culled; // One bit mask per four casters.
+	};
+
+	void _cull_casters(uint32_t p_task, CullCastersData *p_data);
+
 	bool _prepare_light(const RendererSceneCull::Instance &p_instance, int32_t p_directional_light_id = -1);
 
 	// Avoid adding extra culling planes derived from near colinear triangles.
@@ -226,6 +264,7 @@ private:
 		// Single threaded cull planes for regular lights
 		// (OMNI, SPOT). These lights reuse the same set of cull plane data.
 		LightCullPlanes regular_cull_planes;
+		CullCastersData cull_casters_data;
 
 #ifdef LIGHT_CULLER_DEBUG_REGULAR_LIGHT
 		uint32_t regular_rejected_count = 0;
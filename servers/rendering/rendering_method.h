@@ -98,6 +98,9 @@ public:
 
 	virtual void instance_set_ignore_culling(RID p_instance, bool p_enabled) = 0;
 
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
+
 	// don't use these in a game!
 	virtual Vector<ObjectID> instances_cull_aabb(const AABB &p_aabb, RID p_scenario = RID()) const = 0;
 	virtual Vector<ObjectID> instances_cull_ray(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const = 0;
@@ -111,6 +114,8 @@ public:
 	virtual void instance_geometry_set_visibility_range(RID p_instance, float p_min, float p_max, float p_min_margin, float p_max_margin, RS::VisibilityRangeFadeMode p_fade_mode) = 0;
 	virtual void instance_geometry_set_lightmap(RID p_instance, RID p_lightmap, const Rect2 &p_lightmap_uv_scale, int p_slice_index) = 0;
 	virtual void instance_geometry_set_lod_bias(RID p_instance, float p_lod_bias) = 0;
+	virtual void mesh_set_lod_streaming(RID p_mesh, bool p_enabled) = 0;
+	virtual Vector<float> mesh_get_lod_stream_demands(const Vector<RID> &p_meshes) = 0;
 	virtual void instance_geometry_set_shader_parameter(RID p_instance, const StringName &p_parameter, const Variant &p_value) = 0;
 	virtual void instance_geometry_get_shader_parameter_list(RID p_instance, List<PropertyInfo> *p_parameters) const = 0;
 	virtual Variant instance_geometry_get_shader_parameter(RID p_instance, const StringName &p_parameter) const = 0;
@@ -343,13 +348,18 @@ public:
 
 	virtual void update() = 0;
 	virtual void render_probes() = 0;
-	virtual void update_visibility_notifiers() = 0;
+	virtual void update_visibility_notifiers(LocalVector<Callable> &r_callbacks) = 0;
 
 	virtual void decals_set_filter(RS::DecalFilter p_filter) = 0;
 	virtual void light_projectors_set_filter(RS::LightProjectorFilter p_filter) = 0;
 
 	virtual bool free(RID p_rid) = 0;
 
+	/* INTERPOLATION */
+
+	virtual void tick() = 0;
+	virtual void set_physics_interpolation_enabled(bool p_enabled) = 0;
+
 	RenderingMethod();
 	virtual ~RenderingMethod();
 };
@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_trace.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
@@ -49,6 +50,7 @@ void RenderingServerDefault::_free(RID p_rid) {
 		return;
 	}
 	if (RSG::utilities->free(p_rid)) {
+		RSG::scene->mesh_set_lod_streaming(p_rid, false); // In case it was a streamed mesh.
 		return;
 	}
 	if (RSG::canvas->free(p_rid)) {
@@ -68,7 +70,19 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 	frame_drawn_callbacks.push_back(p_callable);
 }
 
+void RenderingServerDefault::_call_visibility_notifier_callbacks(const Array &p_callbacks) {
+	for (const Variant &callback : p_callbacks) {
+		const Callable &callable = callback;
+		// The target may have been freed since the frame was drawn.
+		if (callable.is_valid()) {
+			callable.call();
+		}
+	}
+}
+
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	TRACE_ZONE("RenderingServer::draw");
+	MemoryTagScope memory_tag_scope(Memory::TAG_RENDERING);
 	RSG::rasterizer->begin_frame(frame_step);
 
 	TIMESTAMP_BEGIN()
@@ -97,11 +111,34 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	}
 #endif // _3D_DISABLED
 
-	RSG::canvas->update_visibility_notifiers();
-	RSG::scene->update_visibility_notifiers();
+	RSG::canvas->update_visibility_notifiers(visibility_notifier_callbacks);
+	RSG::scene->update_visibility_notifiers(visibility_notifier_callbacks);
+
+	if (!visibility_notifier_callbacks.is_empty()) {
+		if (RSG::threaded) {
+			// Send all the visibility changes of the frame to the main thread as a single message.
+			Array callbacks;
+			callbacks.resize(visibility_notifier_callbacks.size());
+			for (uint32_t i = 0; i < visibility_notifier_callbacks.size(); i++) {
+				callbacks[i] = visibility_notifier_callbacks[i];
+			}
+			callable_mp_static(&RenderingServerDefault::_call_visibility_notifier_callbacks).call_deferred(callbacks);
+		} else {
+			for (const Callable &callback : visibility_notifier_callbacks) {
+				callback.call();
+			}
+		}
+		visibility_notifier_callbacks.clear();
+	}
 
 	if (create_thread) {
 		callable_mp(this, &RenderingServerDefault::_run_post_draw_steps).call_deferred();
+
+		if (max_queued_frames > 1) {
+			MutexLock lock(queued_frames_mutex);
+			queued_frames--;
+			queued_frames_cond.notify_one();
+		}
 	} else {
 		_run_post_draw_steps();
 	}
@@ -369,6 +406,7 @@ void RenderingServerDefault::_thread_exit() {
 }
 
 void RenderingServerDefault::_thread_loop() {
+	MemoryTagScope memory_tag_scope(Memory::TAG_RENDERING);
 	DisplayServer::get_singleton()->gl_window_make_current(DisplayServer::MAIN_WINDOW_ID); // Move GL to this thread.
 
 	while (!exit) {
@@ -383,15 +421,18 @@ void RenderingServerDefault::_thread_loop() {
 
 void RenderingServerDefault::tick() {
 	RSG::canvas->tick();
+	RSG::scene->tick();
 }
 
 void RenderingServerDefault::set_physics_interpolation_enabled(bool p_enabled) {
 	RSG::canvas->set_physics_interpolation_enabled(p_enabled);
+	RSG::scene->set_physics_interpolation_enabled(p_enabled);
 }
 
 /* EVENT QUEUING */
 
 void RenderingServerDefault::sync() {
+	TRACE_ZONE("RenderingServer::sync");
 	if (create_thread) {
 		command_queue.sync();
 	} else {
@@ -399,12 +440,43 @@ void RenderingServerDefault::sync() {
 	}
 }
 
+void RenderingServerDefault::sync_frame() {
+	if (!create_thread || max_queued_frames <= 1) {
+		sync();
+		return;
+	}
+
+	// Let the main thread build the next frames while the rendering thread is still
+	// drawing the previous ones, as long as it doesn't get too far ahead.
+	TRACE_ZONE("RenderingServer::sync_frame");
+	MutexLock lock(queued_frames_mutex);
+	while (queued_frames >= max_queued_frames) {
+		queued_frames_cond.wait(lock);
+	}
+}
+
+void RenderingServerDefault::begin_batch(uint32_t p_reserve_bytes) {
+	if (create_thread) {
+		command_queue.begin_batch(p_reserve_bytes);
+	}
+}
+
+void RenderingServerDefault::end_batch() {
+	if (create_thread) {
+		command_queue.end_batch();
+	}
+}
+
 void RenderingServerDefault::draw(bool p_swap_buffers, double frame_step) {
 	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "Manually triggering the draw function from the RenderingServer can only be done on the main thread. Call this function from the main thread or use call_deferred().");
 	// Needs to be done before changes is reset to 0, to not force the editor to redraw.
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 	changes = 0;
 	if (create_thread) {
+		if (max_queued_frames > 1) {
+			MutexLock lock(queued_frames_mutex);
+			queued_frames++;
+		}
 		command_queue.push(this, &RenderingServerDefault::_draw, p_swap_buffers, frame_step);
 	} else {
 		_draw(p_swap_buffers, frame_step);
@@ -419,6 +491,9 @@ RenderingServerDefault::RenderingServerDefault(bool p_create_thread) {
 	RenderingServer::init();
 
 	create_thread = p_create_thread;
+	if (create_thread) {
+		max_queued_frames = GLOBAL_GET("rendering/driver/threads/max_queued_frames");
+	}
 }
 
 RenderingServerDefault::~RenderingServerDefault() {
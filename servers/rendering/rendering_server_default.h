@@ -32,6 +32,7 @@
 #define RENDERING_SERVER_DEFAULT_H
 
 #include "core/object/worker_thread_pool.h"
+#include "core/os/condition_variable.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
 #include "core/templates/hash_map.h"
@@ -81,10 +82,19 @@ class RenderingServerDefault : public RenderingServer {
 	bool exit = false;
 	bool create_thread = false;
 
+	// Frames pushed to the rendering thread that it didn't finish drawing yet.
+	uint32_t max_queued_frames = 1;
+	uint32_t queued_frames = 0;
+	BinaryMutex queued_frames_mutex;
+	ConditionVariable queued_frames_cond;
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_loop();
 
+	LocalVector<Callable> visibility_notifier_callbacks;
+	static void _call_visibility_notifier_callbacks(const Array &p_callbacks);
+
 	void _draw(bool p_swap_buffers, double frame_step);
 	void _run_post_draw_steps();
 	void _init();
@@ -495,6 +505,7 @@ public:
 	FUNC1R(bool, particles_get_emitting, RID)
 	FUNC2(particles_set_amount, RID, int)
 	FUNC2(particles_set_amount_ratio, RID, float)
+	FUNC2(particles_set_emission_lod_distance, RID, float)
 	FUNC2(particles_set_lifetime, RID, double)
 	FUNC2(particles_set_one_shot, RID, bool)
 	FUNC2(particles_set_pre_process_time, RID, double)
@@ -616,6 +627,10 @@ public:
 
 	FUNC2(viewport_set_scaling_3d_mode, RID, ViewportScaling3DMode)
 	FUNC2(viewport_set_scaling_3d_scale, RID, float)
+	FUNC2(viewport_set_scaling_3d_dynamic, RID, bool)
+	FUNC2(viewport_set_scaling_3d_dynamic_target_frame_time, RID, float)
+	FUNC2(viewport_set_scaling_3d_dynamic_min_scale, RID, float)
+	FUNC1RC(float, viewport_get_scaling_3d_dynamic_scale, RID)
 	FUNC2(viewport_set_fsr_sharpness, RID, float)
 	FUNC2(viewport_set_texture_mipmap_bias, RID, float)
 
@@ -816,6 +831,9 @@ public:
 
 	FUNC2(instance_set_ignore_culling, RID, bool)
 
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
+
 	// don't use these in a game!
 	FUNC2RC(Vector<ObjectID>, instances_cull_aabb, const AABB &, RID)
 	FUNC3RC(Vector<ObjectID>, instances_cull_ray, const Vector3 &, const Vector3 &, RID)
@@ -829,6 +847,8 @@ public:
 	FUNC6(instance_geometry_set_visibility_range, RID, float, float, float, float, VisibilityRangeFadeMode)
 	FUNC4(instance_geometry_set_lightmap, RID, RID, const Rect2 &, int)
 	FUNC2(instance_geometry_set_lod_bias, RID, float)
+	FUNC2(mesh_set_lod_streaming, RID, bool)
+	FUNC1R(Vector<float>, mesh_get_lod_stream_demands, const Vector<RID> &)
 	FUNC2(instance_geometry_set_transparency, RID, float)
 	FUNC3(instance_geometry_set_shader_parameter, RID, const StringName &, const Variant &)
 	FUNC2RC(Variant, instance_geometry_get_shader_parameter, RID, const StringName &)
@@ -1057,7 +1077,10 @@ public:
 
 	virtual void draw(bool p_swap_buffers, double frame_step) override;
 	virtual void sync() override;
+	virtual void sync_frame() override;
 	virtual bool has_changed() const override;
+	virtual void begin_batch(uint32_t p_reserve_bytes = 0) override;
+	virtual void end_batch() override;
 	virtual void init() override;
 	virtual void finish() override;
 
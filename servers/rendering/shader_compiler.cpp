@@ -1462,7 +1462,141 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+uint64_t ShaderCompiler::_get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions &p_actions) const {
+	// The same source may be compiled with different actions, so their names are part of the key.
+	uint32_t h = hash_murmur3_one_32(p_mode);
+	for (const KeyValue<StringName, Stage> &E : p_actions.entry_point_stages) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value, h);
+	}
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions.render_mode_values) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value.second, h);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions.render_mode_flags) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions.usage_flag_pointers) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions.write_flag_pointers) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	h = hash_murmur3_one_32(p_actions.uniforms != nullptr, h);
+
+	return (uint64_t(hash_fmix32(h)) << 32) | p_code.hash();
+}
+
+bool ShaderCompiler::_is_cache_entry_valid(const CacheEntry &p_entry) const {
+	// Global uniforms can be removed or change type since the shader was compiled.
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : p_entry.uniforms) {
+		if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL && _get_global_shader_uniform_type(E.key) != E.value.type) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void ShaderCompiler::_apply_cache_entry(const CacheEntry &p_entry, IdentifierActions *p_actions, GeneratedCode &r_gen_code) const {
+	for (const StringName &name : p_entry.render_mode_values) {
+		const Pair<int *, int> &p = p_actions->render_mode_values[name];
+		*p.first = p.second;
+	}
+	for (const StringName &name : p_entry.render_mode_flags) {
+		*p_actions->render_mode_flags[name] = true;
+	}
+	for (const StringName &name : p_entry.usage_flags) {
+		*p_actions->usage_flag_pointers[name] = true;
+	}
+	for (const StringName &name : p_entry.write_flags) {
+		*p_actions->write_flag_pointers[name] = true;
+	}
+	if (p_actions->uniforms) {
+		for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : p_entry.uniforms) {
+			p_actions->uniforms->insert(E.key, E.value);
+		}
+	}
+	r_gen_code = p_entry.gen_code;
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	uint64_t key = _get_cache_key(p_mode, p_code, *p_actions);
+	HashMap<uint64_t, CacheEntry>::Iterator E = cache.find(key);
+	if (E && E->value.code == p_code && _is_cache_entry_valid(E->value)) {
+		_apply_cache_entry(E->value, p_actions, r_gen_code);
+		return OK;
+	}
+
+	// Compile against scratch storage, so what the compiler sets can be recorded by name.
+	IdentifierActions recording;
+	recording.entry_point_stages = p_actions->entry_point_stages;
+
+	LocalVector<int> render_mode_values;
+	LocalVector<bool> flags;
+	render_mode_values.resize(p_actions->render_mode_values.size());
+	flags.resize(p_actions->render_mode_flags.size() + p_actions->usage_flag_pointers.size() + p_actions->write_flag_pointers.size());
+	uint32_t value_index = 0;
+	uint32_t flag_index = 0;
+	for (const KeyValue<StringName, Pair<int *, int>> &F : p_actions->render_mode_values) {
+		render_mode_values[value_index] = ~F.value.second; // Anything but the value the render mode sets.
+		recording.render_mode_values[F.key] = Pair<int *, int>(&render_mode_values[value_index++], F.value.second);
+	}
+	for (const KeyValue<StringName, bool *> &F : p_actions->render_mode_flags) {
+		flags[flag_index] = false;
+		recording.render_mode_flags[F.key] = &flags[flag_index++];
+	}
+	for (const KeyValue<StringName, bool *> &F : p_actions->usage_flag_pointers) {
+		flags[flag_index] = false;
+		recording.usage_flag_pointers[F.key] = &flags[flag_index++];
+	}
+	for (const KeyValue<StringName, bool *> &F : p_actions->write_flag_pointers) {
+		flags[flag_index] = false;
+		recording.write_flag_pointers[F.key] = &flags[flag_index++];
+	}
+
+	CacheEntry entry;
+	entry.code = p_code;
+	if (p_actions->uniforms) {
+		recording.uniforms = &entry.uniforms;
+	}
+
+	Error err = _compile(p_mode, p_code, &recording, p_path, entry.gen_code);
+	if (err != OK) {
+		return err;
+	}
+
+	for (const KeyValue<StringName, Pair<int *, int>> &F : recording.render_mode_values) {
+		if (*F.value.first == F.value.second) {
+			entry.render_mode_values.push_back(F.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &F : recording.render_mode_flags) {
+		if (*F.value) {
+			entry.render_mode_flags.push_back(F.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &F : recording.usage_flag_pointers) {
+		if (*F.value) {
+			entry.usage_flags.push_back(F.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &F : recording.write_flag_pointers) {
+		if (*F.value) {
+			entry.write_flags.push_back(F.key);
+		}
+	}
+
+	_apply_cache_entry(entry, p_actions, r_gen_code);
+
+	if (cache.size() >= CACHE_MAX_ENTRIES) {
+		cache.remove(cache.begin()); // Oldest first.
+	}
+	cache.insert(key, entry);
+
+	return OK;
+}
+
+Error ShaderCompiler::_compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1572,6 +1706,7 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
+	cache.clear();
 
 	time_name = "TIME";
 
@@ -125,12 +125,32 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// Results of previous compilations, so unchanged shaders skip parsing and code generation.
+	// The effects on the identifier actions are stored by name and replayed on the caller's pointers.
+	struct CacheEntry {
+		String code; // Compared on lookup, as only its hash is in the key.
+		GeneratedCode gen_code;
+		LocalVector<StringName> render_mode_values;
+		LocalVector<StringName> render_mode_flags;
+		LocalVector<StringName> usage_flags;
+		LocalVector<StringName> write_flags;
+		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	};
+	static const uint32_t CACHE_MAX_ENTRIES = 512;
+	HashMap<uint64_t, CacheEntry> cache;
+
+	uint64_t _get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions &p_actions) const;
+	bool _is_cache_entry_valid(const CacheEntry &p_entry) const;
+	void _apply_cache_entry(const CacheEntry &p_entry, IdentifierActions *p_actions, GeneratedCode &r_gen_code) const;
+	Error _compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
 	void initialize(DefaultIdentifierActions p_actions);
+	void clear_cache() { cache.clear(); }
 	ShaderCompiler();
 };
 
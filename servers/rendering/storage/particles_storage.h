@@ -50,6 +50,7 @@ public:
 
 	virtual void particles_set_amount(RID p_particles, int p_amount) = 0;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) = 0;
+	virtual void particles_set_emission_lod_distance(RID p_particles, float p_distance) = 0;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) = 0;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) = 0;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) = 0;
@@ -93,6 +94,7 @@ public:
 	virtual RID particles_get_draw_pass_mesh(RID p_particles, int p_pass) const = 0;
 
 	virtual void particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) = 0;
+	virtual void particles_set_view_distance(RID p_particles, float p_distance) = 0;
 
 	virtual void particles_add_collision(RID p_particles, RID p_particles_collision_instance) = 0;
 	virtual void particles_remove_collision(RID p_particles, RID p_particles_collision_instance) = 0;
@@ -142,7 +142,7 @@ public:
 	virtual void visibility_notifier_set_callbacks(RID p_notifier, const Callable &p_enter_callbable, const Callable &p_exit_callable) = 0;
 
 	virtual AABB visibility_notifier_get_aabb(RID p_notifier) const = 0;
-	virtual void visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) = 0;
+	virtual Callable visibility_notifier_get_callback(RID p_notifier, bool p_enter) const = 0;
 
 	/* TIMING */
 
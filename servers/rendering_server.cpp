@@ -73,6 +73,57 @@ Array RenderingServer::_texture_debug_usage_bind() {
 	return arr;
 }
 
+TypedArray<Dictionary> RenderingServer::_get_frame_profile_bind() {
+	Vector<FrameProfileArea> areas = get_frame_profile();
+	TypedArray<Dictionary> arr;
+
+	// "> Name" opens a scope that is closed by the matching "< Name", everything else is a
+	// single step lasting until the next timestamp. Scopes store their start times until closed.
+	LocalVector<int> scopes;
+	for (int i = 0; i < areas.size(); i++) {
+		const FrameProfileArea &area = areas[i];
+		if (area.name.is_empty() || area.name.begins_with("vp_")) {
+			continue;
+		}
+
+		if (area.name[0] == '<') {
+			if (scopes.is_empty()) {
+				continue;
+			}
+			Dictionary scope = arr[scopes[scopes.size() - 1]];
+			scope["cpu_msec"] = area.cpu_msec - double(scope["cpu_msec"]);
+			scope["gpu_msec"] = area.gpu_msec - double(scope["gpu_msec"]);
+			scopes.remove_at(scopes.size() - 1);
+			continue;
+		}
+
+		Dictionary dict;
+		dict["depth"] = scopes.size();
+		dict["parent"] = scopes.is_empty() ? -1 : scopes[scopes.size() - 1];
+		if (area.name[0] == '>') {
+			dict["name"] = area.name.substr(1).strip_edges();
+			dict["cpu_msec"] = area.cpu_msec;
+			dict["gpu_msec"] = area.gpu_msec;
+			scopes.push_back(arr.size());
+		} else {
+			bool has_next = i + 1 < areas.size();
+			dict["name"] = area.name;
+			dict["cpu_msec"] = has_next ? areas[i + 1].cpu_msec - area.cpu_msec : 0.0;
+			dict["gpu_msec"] = has_next ? areas[i + 1].gpu_msec - area.gpu_msec : 0.0;
+		}
+		arr.push_back(dict);
+	}
+
+	// Scopes left open run until the end of the frame.
+	for (int scope_index : scopes) {
+		Dictionary scope = arr[scope_index];
+		scope["cpu_msec"] = areas[areas.size() - 1].cpu_msec - double(scope["cpu_msec"]);
+		scope["gpu_msec"] = areas[areas.size() - 1].gpu_msec - double(scope["gpu_msec"]);
+	}
+
+	return arr;
+}
+
 static PackedInt64Array to_int_array(const Vector<ObjectID> &ids) {
 	PackedInt64Array a;
 	a.resize(ids.size());
@@ -82,6 +133,15 @@ static PackedInt64Array to_int_array(const Vector<ObjectID> &ids) {
 	return a;
 }
 
+PackedFloat32Array RenderingServer::_mesh_get_lod_stream_demands_bind(const TypedArray<RID> &p_meshes) {
+	Vector<RID> meshes;
+	meshes.resize(p_meshes.size());
+	for (int i = 0; i < p_meshes.size(); ++i) {
+		meshes.write[i] = p_meshes[i];
+	}
+	return mesh_get_lod_stream_demands(meshes);
+}
+
 PackedInt64Array RenderingServer::_instances_cull_aabb_bind(const AABB &p_aabb, RID p_scenario) const {
 	Vector<ObjectID> ids = instances_cull_aabb(p_aabb, p_scenario);
 	return to_int_array(ids);
@@ -2332,6 +2392,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("mesh_set_custom_aabb", "mesh", "aabb"), &RenderingServer::mesh_set_custom_aabb);
 	ClassDB::bind_method(D_METHOD("mesh_get_custom_aabb", "mesh"), &RenderingServer::mesh_get_custom_aabb);
 	ClassDB::bind_method(D_METHOD("mesh_clear", "mesh"), &RenderingServer::mesh_clear);
+	ClassDB::bind_method(D_METHOD("mesh_set_lod_streaming", "mesh", "enabled"), &RenderingServer::mesh_set_lod_streaming);
+	ClassDB::bind_method(D_METHOD("mesh_get_lod_stream_demands", "meshes"), &RenderingServer::_mesh_get_lod_stream_demands_bind);
 
 	ClassDB::bind_method(D_METHOD("mesh_surface_update_vertex_region", "mesh", "surface", "offset", "data"), &RenderingServer::mesh_surface_update_vertex_region);
 	ClassDB::bind_method(D_METHOD("mesh_surface_update_attribute_region", "mesh", "surface", "offset", "data"), &RenderingServer::mesh_surface_update_attribute_region);
@@ -2645,6 +2707,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("particles_get_emitting", "particles"), &RenderingServer::particles_get_emitting);
 	ClassDB::bind_method(D_METHOD("particles_set_amount", "particles", "amount"), &RenderingServer::particles_set_amount);
 	ClassDB::bind_method(D_METHOD("particles_set_amount_ratio", "particles", "ratio"), &RenderingServer::particles_set_amount_ratio);
+	ClassDB::bind_method(D_METHOD("particles_set_emission_lod_distance", "particles", "distance"), &RenderingServer::particles_set_emission_lod_distance);
 	ClassDB::bind_method(D_METHOD("particles_set_lifetime", "particles", "lifetime"), &RenderingServer::particles_set_lifetime);
 	ClassDB::bind_method(D_METHOD("particles_set_one_shot", "particles", "one_shot"), &RenderingServer::particles_set_one_shot);
 	ClassDB::bind_method(D_METHOD("particles_set_pre_process_time", "particles", "time"), &RenderingServer::particles_set_pre_process_time);
@@ -2778,6 +2841,10 @@ void RenderingServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_mode", "viewport", "scaling_3d_mode"), &RenderingServer::viewport_set_scaling_3d_mode);
 	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_scale", "viewport", "scale"), &RenderingServer::viewport_set_scaling_3d_scale);
+	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_dynamic", "viewport", "enabled"), &RenderingServer::viewport_set_scaling_3d_dynamic);
+	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_dynamic_target_frame_time", "viewport", "msec"), &RenderingServer::viewport_set_scaling_3d_dynamic_target_frame_time);
+	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_dynamic_min_scale", "viewport", "scale"), &RenderingServer::viewport_set_scaling_3d_dynamic_min_scale);
+	ClassDB::bind_method(D_METHOD("viewport_get_scaling_3d_dynamic_scale", "viewport"), &RenderingServer::viewport_get_scaling_3d_dynamic_scale);
 	ClassDB::bind_method(D_METHOD("viewport_set_fsr_sharpness", "viewport", "sharpness"), &RenderingServer::viewport_set_fsr_sharpness);
 	ClassDB::bind_method(D_METHOD("viewport_set_texture_mipmap_bias", "viewport", "mipmap_bias"), &RenderingServer::viewport_set_texture_mipmap_bias);
 	ClassDB::bind_method(D_METHOD("viewport_set_update_mode", "viewport", "update_mode"), &RenderingServer::viewport_set_update_mode);
@@ -2916,6 +2983,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_DISABLED);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_TEXTURE);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_XR);
+	BIND_ENUM_CONSTANT(VIEWPORT_VRS_ADAPTIVE);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_MAX);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_UPDATE_DISABLED);
@@ -3128,6 +3196,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_extra_visibility_margin", "instance", "margin"), &RenderingServer::instance_set_extra_visibility_margin);
 	ClassDB::bind_method(D_METHOD("instance_set_visibility_parent", "instance", "parent"), &RenderingServer::instance_set_visibility_parent);
 	ClassDB::bind_method(D_METHOD("instance_set_ignore_culling", "instance", "enabled"), &RenderingServer::instance_set_ignore_culling);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 
 	ClassDB::bind_method(D_METHOD("instance_geometry_set_flag", "instance", "flag", "enabled"), &RenderingServer::instance_geometry_set_flag);
 	ClassDB::bind_method(D_METHOD("instance_geometry_set_cast_shadows_setting", "instance", "shadow_casting_setting"), &RenderingServer::instance_geometry_set_cast_shadows_setting);
@@ -3421,6 +3491,9 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_render_loop_enabled", "enabled"), &RenderingServer::set_render_loop_enabled);
 
 	ClassDB::bind_method(D_METHOD("get_frame_setup_time_cpu"), &RenderingServer::get_frame_setup_time_cpu);
+	ClassDB::bind_method(D_METHOD("set_frame_profiling_enabled", "enable"), &RenderingServer::set_frame_profiling_enabled);
+	ClassDB::bind_method(D_METHOD("get_frame_profile"), &RenderingServer::_get_frame_profile_bind);
+	ClassDB::bind_method(D_METHOD("get_frame_profile_frame"), &RenderingServer::get_frame_profile_frame);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "render_loop_enabled"), "set_render_loop_enabled", "is_render_loop_enabled");
 
@@ -3519,6 +3592,12 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF("rendering/textures/lossless_compression/force_png", false);
 
+	GLOBAL_DEF("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/resident_size", PROPERTY_HINT_RANGE, "1,4096,1"), 128);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/vram_budget_mb", PROPERTY_HINT_RANGE, "0,65536,1,suffix:MiB"), 1024);
+
+	GLOBAL_DEF("rendering/mesh_lod/streaming/enabled", false);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/webp_compression/compression_method", PROPERTY_HINT_RANGE, "0,6,1"), 2);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"), 25);
 
@@ -3534,12 +3613,16 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Very Low (Faster),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"), 2);
 	GLOBAL_DEF("rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality.mobile", 0);
+	GLOBAL_DEF_RST("rendering/lights_and_shadows/positional_shadow/static_cache", false);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/2d/shadow_atlas/size", PROPERTY_HINT_RANGE, "128,16384"), 2048);
 
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/particles/culled_catch_up_time", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater,suffix:s"), 0.5);
+
 	// Number of commands that can be drawn per frame.
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/gl_compatibility/item_buffer_size", PROPERTY_HINT_RANGE, "128,1048576,1"), 16384);
 
+	GLOBAL_DEF_RST("rendering/shader_compiler/async_compilation/enabled", false);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
@@ -3555,16 +3638,19 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_size", PROPERTY_HINT_RANGE, "0,4096,1"), 256);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_size.mobile", PROPERTY_HINT_RANGE, "0,2048,1"), 128);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_count", PROPERTY_HINT_RANGE, "0,256,1"), 64);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/max_update_steps_per_frame", PROPERTY_HINT_RANGE, "0,64,1"), 0);
 
 	GLOBAL_DEF("rendering/global_illumination/gi/use_half_resolution", false);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/voxel_gi/quality", PROPERTY_HINT_ENUM, "Low (4 Cones - Fast),High (6 Cones - Slow)"), 0);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/global_illumination/voxel_gi/max_updates_per_frame", PROPERTY_HINT_RANGE, "0,64,1"), 4);
 
 	GLOBAL_DEF("rendering/shading/overrides/force_vertex_shading", false);
 	GLOBAL_DEF("rendering/shading/overrides/force_vertex_shading.mobile", true);
 	GLOBAL_DEF("rendering/shading/overrides/force_lambert_over_burley", false);
 	GLOBAL_DEF("rendering/shading/overrides/force_lambert_over_burley.mobile", true);
 
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/driver/threads/max_queued_frames", PROPERTY_HINT_RANGE, "1,3,1"), 1);
 	GLOBAL_DEF_RST("rendering/driver/depth_prepass/enable", true);
 	GLOBAL_DEF_RST("rendering/driver/depth_prepass/disable_for_vendors", "PowerVR,Mali,Adreno,Apple");
 
@@ -3595,6 +3681,9 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/scaling_3d/mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),FSR 2.2 (Slow)"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), 1.0);
+	GLOBAL_DEF("rendering/scaling_3d/dynamic/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/dynamic/target_frame_time", PROPERTY_HINT_RANGE, "1,100,0.1,suffix:ms"), 16.6);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/dynamic/min_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), 0.5);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), 0.2f);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/default_filters/texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), 0.0f);
 
@@ -3620,6 +3709,7 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/probe_ray_count", PROPERTY_HINT_ENUM, "8 (Fastest),16,32,64,96,128 (Slowest)"), 1);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"), 5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"), 2);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/max_cascade_scrolls_per_frame", PROPERTY_HINT_RANGE, "1,8,1"), 2);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"), 64);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_depth", PROPERTY_HINT_RANGE, "16,512,1"), 64);
@@ -3629,6 +3719,9 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"), 1000);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"), 512);
+	GLOBAL_DEF_RST("rendering/limits/cluster_builder/use_compute_binning", true);
+
+	GLOBAL_DEF_RST("rendering/limits/forward_mobile/use_light_tiles", false);
 
 	// OpenGL limits
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/opengl/max_renderable_elements", PROPERTY_HINT_RANGE, "1024,65536,1"), 65536);
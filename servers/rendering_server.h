@@ -417,6 +417,9 @@ public:
 
 	virtual void mesh_clear(RID p_mesh) = 0;
 
+	virtual void mesh_set_lod_streaming(RID p_mesh, bool p_enabled) = 0;
+	virtual Vector<float> mesh_get_lod_stream_demands(const Vector<RID> &p_meshes) = 0;
+
 	/* MULTIMESH API */
 
 	virtual RID multimesh_create() = 0;
@@ -701,6 +704,7 @@ public:
 	virtual bool particles_get_emitting(RID p_particles) = 0;
 	virtual void particles_set_amount(RID p_particles, int p_amount) = 0;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) = 0;
+	virtual void particles_set_emission_lod_distance(RID p_particles, float p_distance) = 0;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) = 0;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) = 0;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) = 0;
@@ -881,6 +885,10 @@ public:
 
 	virtual void viewport_set_scaling_3d_mode(RID p_viewport, ViewportScaling3DMode p_scaling_3d_mode) = 0;
 	virtual void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale) = 0;
+	virtual void viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled) = 0;
+	virtual void viewport_set_scaling_3d_dynamic_target_frame_time(RID p_viewport, float p_msec) = 0;
+	virtual void viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_scale) = 0;
+	virtual float viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const = 0;
 	virtual void viewport_set_fsr_sharpness(RID p_viewport, float p_fsr_sharpness) = 0;
 	virtual void viewport_set_texture_mipmap_bias(RID p_viewport, float p_texture_mipmap_bias) = 0;
 
@@ -1047,6 +1055,7 @@ public:
 		VIEWPORT_VRS_DISABLED,
 		VIEWPORT_VRS_TEXTURE,
 		VIEWPORT_VRS_XR,
+		VIEWPORT_VRS_ADAPTIVE,
 		VIEWPORT_VRS_MAX,
 	};
 
@@ -1348,11 +1357,15 @@ public:
 
 	virtual void instance_set_ignore_culling(RID p_instance, bool p_enabled) = 0;
 
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
+
 	// Don't use these in a game!
 	virtual Vector<ObjectID> instances_cull_aabb(const AABB &p_aabb, RID p_scenario = RID()) const = 0;
 	virtual Vector<ObjectID> instances_cull_ray(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const = 0;
 	virtual Vector<ObjectID> instances_cull_convex(const Vector<Plane> &p_convex, RID p_scenario = RID()) const = 0;
 
+	PackedFloat32Array _mesh_get_lod_stream_demands_bind(const TypedArray<RID> &p_meshes);
 	PackedInt64Array _instances_cull_aabb_bind(const AABB &p_aabb, RID p_scenario = RID()) const;
 	PackedInt64Array _instances_cull_ray_bind(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const;
 	PackedInt64Array _instances_cull_convex_bind(const TypedArray<Plane> &p_convex, RID p_scenario = RID()) const;
@@ -1656,7 +1669,14 @@ public:
 
 	virtual void draw(bool p_swap_buffers = true, double frame_step = 0.0) = 0;
 	virtual void sync() = 0;
+	// Waits until the rendering thread is few enough frames behind to queue another one.
+	// Without a rendering thread, this is the same as sync().
+	virtual void sync_frame() = 0;
 	virtual bool has_changed() const = 0;
+	// Groups calls made by the calling thread until the matching end, so they are
+	// handed to the rendering thread at once instead of one by one.
+	virtual void begin_batch(uint32_t p_reserve_bytes = 0) = 0;
+	virtual void end_batch() = 0;
 	virtual void init();
 	virtual void finish() = 0;
 
@@ -1687,6 +1707,7 @@ public:
 	virtual void set_frame_profiling_enabled(bool p_enable) = 0;
 	virtual Vector<FrameProfileArea> get_frame_profile() = 0;
 	virtual uint64_t get_frame_profile_frame() = 0;
+	TypedArray<Dictionary> _get_frame_profile_bind();
 
 	virtual double get_frame_setup_time_cpu() const = 0;
 
@@ -0,0 +1,388 @@
+/**************************************************************************/
+/*  bench_core.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCH_CORE_H
+#define BENCH_CORE_H
+
+#include "core/math/random_pcg.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/swiss_hash_map.h"
+#include "core/templates/vector.h"
+
+#include "tests/test_bench.h"
+#include "tests/test_macros.h"
+
+namespace BenchCore {
+
+static const int MAP_SIZE = 100000;
+
+static LocalVector<String> make_string_keys(int p_count) {
+	LocalVector<String> keys;
+	keys.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		keys[i] = "key_" + itos(i * 7919);
+	}
+	return keys;
+}
+
+TEST_SUITE("[Benchmark][HashMap]") {
+	TEST_CASE("Integer keys") {
+		BENCHMARK("HashMap/insert_int", MAP_SIZE) {
+			HashMap<int, int> map;
+			for (int i = 0; i < MAP_SIZE; i++) {
+				map.insert(i * 7919, i);
+			}
+			bench_do_not_optimize(map.size());
+		}
+
+		HashMap<int, int> map;
+		for (int i = 0; i < MAP_SIZE; i++) {
+			map.insert(i * 7919, i);
+		}
+		BENCHMARK("HashMap/lookup_int", MAP_SIZE * 2) {
+			int64_t sum = 0;
+			// Half of the lookups miss.
+			for (int i = 0; i < MAP_SIZE * 2; i++) {
+				const int *value = map.getptr(i * 7919 / 2);
+				sum += value ? *value : 0;
+			}
+			bench_do_not_optimize(sum);
+		}
+
+		BENCHMARK("HashMap/erase_insert_int", MAP_SIZE) {
+			for (int i = 0; i < MAP_SIZE; i++) {
+				map.erase(i * 7919);
+				map.insert(i * 7919, i);
+			}
+		}
+
+		BENCHMARK("HashMap/iterate_int", MAP_SIZE) {
+			int64_t sum = 0;
+			for (const KeyValue<int, int> &E : map) {
+				sum += E.value;
+			}
+			bench_do_not_optimize(sum);
+		}
+	}
+
+	TEST_CASE("String keys") {
+		const LocalVector<String> keys = make_string_keys(MAP_SIZE);
+
+		BENCHMARK("HashMap/insert_string", MAP_SIZE) {
+			HashMap<String, int> map;
+			for (int i = 0; i < MAP_SIZE; i++) {
+				map.insert(keys[i], i);
+			}
+			bench_do_not_optimize(map.size());
+		}
+
+		HashMap<String, int> map;
+		for (int i = 0; i < MAP_SIZE; i++) {
+			map.insert(keys[i], i);
+		}
+		BENCHMARK("HashMap/lookup_string", MAP_SIZE) {
+			int64_t sum = 0;
+			for (int i = 0; i < MAP_SIZE; i++) {
+				sum += *map.getptr(keys[i]);
+			}
+			bench_do_not_optimize(sum);
+		}
+	}
+
+	TEST_CASE("SwissHashMap") {
+		BENCHMARK("SwissHashMap/insert_int", MAP_SIZE) {
+			SwissHashMap<int, int> map;
+			for (int i = 0; i < MAP_SIZE; i++) {
+				map.insert(i * 7919, i);
+			}
+			bench_do_not_optimize(map.size());
+		}
+
+		SwissHashMap<int, int> map;
+		for (int i = 0; i < MAP_SIZE; i++) {
+			map.insert(i * 7919, i);
+		}
+		BENCHMARK("SwissHashMap/lookup_int", MAP_SIZE * 2) {
+			int64_t sum = 0;
+			for (int i = 0; i < MAP_SIZE * 2; i++) {
+				const int *value = map.getptr(i * 7919 / 2);
+				sum += value ? *value : 0;
+			}
+			bench_do_not_optimize(sum);
+		}
+	}
+}
+
+TEST_SUITE("[Benchmark][Vector]") {
+	TEST_CASE("Vector operations") {
+		static const int VECTOR_SIZE = 1000000;
+
+		BENCHMARK("Vector/push_back", VECTOR_SIZE) {
+			Vector<int> vector;
+			for (int i = 0; i < VECTOR_SIZE; i++) {
+				vector.push_back(i);
+			}
+			bench_do_not_optimize(vector.size());
+		}
+
+		Vector<int> vector;
+		vector.resize(VECTOR_SIZE);
+		int *ptrw = vector.ptrw();
+		for (int i = 0; i < VECTOR_SIZE; i++) {
+			ptrw[i] = i;
+		}
+
+		BENCHMARK("Vector/read_index", VECTOR_SIZE) {
+			int64_t sum = 0;
+			for (int i = 0; i < VECTOR_SIZE; i++) {
+				sum += vector[i];
+			}
+			bench_do_not_optimize(sum);
+		}
+
+		BENCHMARK("Vector/copy_on_write", VECTOR_SIZE) {
+			Vector<int> copy = vector;
+			copy.write[0] = 1;
+			bench_do_not_optimize(copy.ptr());
+		}
+
+		BENCHMARK("Vector/sort", VECTOR_SIZE) {
+			BENCHMARK_PAUSE_TIMING();
+			Vector<int> shuffled = vector;
+			RandomPCG rng(42);
+			int *values = shuffled.ptrw();
+			for (int i = VECTOR_SIZE - 1; i > 0; i--) {
+				SWAP(values[i], values[rng.rand() % (i + 1)]);
+			}
+			BENCHMARK_RESUME_TIMING();
+			shuffled.sort();
+			bench_do_not_optimize(shuffled.ptr());
+		}
+	}
+}
+
+TEST_SUITE("[Benchmark][StringName]") {
+	TEST_CASE("StringName operations") {
+		static const int NAME_COUNT = 10000;
+		const LocalVector<String> strings = make_string_keys(NAME_COUNT);
+
+		LocalVector<StringName> names;
+		for (const String &E : strings) {
+			names.push_back(StringName(E));
+		}
+
+		// The names exist already, so this measures the table lookup.
+		BENCHMARK("StringName/from_string", NAME_COUNT) {
+			for (int i = 0; i < NAME_COUNT; i++) {
+				StringName name(strings[i]);
+				bench_do_not_optimize(name.data_unique_pointer());
+			}
+		}
+
+		BENCHMARK("StringName/from_cstring", NAME_COUNT) {
+			for (int i = 0; i < NAME_COUNT; i++) {
+				StringName name("position");
+				bench_do_not_optimize(name.data_unique_pointer());
+			}
+		}
+
+		BENCHMARK("StringName/compare", NAME_COUNT) {
+			int equal = 0;
+			for (int i = 0; i < NAME_COUNT; i++) {
+				equal += names[i] == names[(i * 31) % NAME_COUNT];
+			}
+			bench_do_not_optimize(equal);
+		}
+	}
+}
+
+TEST_SUITE("[Benchmark][Variant]") {
+	TEST_CASE("Variant operations") {
+		static const int OP_COUNT = 100000;
+
+		BENCHMARK("Variant/evaluate_add_int", OP_COUNT) {
+			Variant a = 1;
+			Variant ret;
+			bool valid = false;
+			for (int i = 0; i < OP_COUNT; i++) {
+				Variant::evaluate(Variant::OP_ADD, a, i, ret, valid);
+				a = ret;
+			}
+			bench_do_not_optimize(a);
+		}
+
+		BENCHMARK("Variant/evaluate_multiply_vector3", OP_COUNT) {
+			Variant a = Vector3(1, 2, 3);
+			const Variant b = 1.0001;
+			Variant ret;
+			bool valid = false;
+			for (int i = 0; i < OP_COUNT; i++) {
+				Variant::evaluate(Variant::OP_MULTIPLY, a, b, ret, valid);
+				a = ret;
+			}
+			bench_do_not_optimize(a);
+		}
+
+		BENCHMARK("Variant/validated_operator_add_float", OP_COUNT) {
+			Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::OP_ADD, Variant::FLOAT, Variant::FLOAT);
+			Variant a = 1.0;
+			const Variant b = 0.5;
+			for (int i = 0; i < OP_COUNT; i++) {
+				evaluator(&a, &b, &a);
+			}
+			bench_do_not_optimize(a);
+		}
+
+		BENCHMARK("Variant/call_builtin_method", OP_COUNT) {
+			Variant vector = Vector2(3, 4);
+			const StringName method = "length";
+			Variant ret;
+			Callable::CallError ce;
+			for (int i = 0; i < OP_COUNT; i++) {
+				vector.callp(method, nullptr, 0, ret, ce);
+			}
+			bench_do_not_optimize(ret);
+		}
+
+		BENCHMARK("Variant/copy_dictionary_value", OP_COUNT) {
+			Dictionary dictionary;
+			dictionary["value"] = Vector3(1, 2, 3);
+			Variant copy;
+			for (int i = 0; i < OP_COUNT; i++) {
+				copy = dictionary["value"];
+			}
+			bench_do_not_optimize(copy);
+		}
+	}
+}
+
+class BenchSignalReceiver : public Object {
+public:
+	int64_t total = 0;
+
+	void receive(int p_value) {
+		total += p_value;
+	}
+};
+
+TEST_SUITE("[Benchmark][Object]") {
+	TEST_CASE("Signal emission") {
+		static const int EMIT_COUNT = 100000;
+
+		Object *emitter = memnew(Object);
+		emitter->add_user_signal(MethodInfo("bench_signal", PropertyInfo(Variant::INT, "value")));
+
+		BenchSignalReceiver *receivers[4];
+		for (int i = 0; i < 4; i++) {
+			receivers[i] = memnew(BenchSignalReceiver);
+		}
+
+		const StringName signal_name = "bench_signal";
+
+		BENCHMARK("Object/emit_signal_no_connection", EMIT_COUNT) {
+			for (int i = 0; i < EMIT_COUNT; i++) {
+				emitter->emit_signal(signal_name, i);
+			}
+		}
+
+		emitter->connect(signal_name, callable_mp(receivers[0], &BenchSignalReceiver::receive));
+		BENCHMARK("Object/emit_signal_1_connection", EMIT_COUNT) {
+			for (int i = 0; i < EMIT_COUNT; i++) {
+				emitter->emit_signal(signal_name, i);
+			}
+		}
+
+		for (int i = 1; i < 4; i++) {
+			emitter->connect(signal_name, callable_mp(receivers[i], &BenchSignalReceiver::receive));
+		}
+		BENCHMARK("Object/emit_signal_4_connections", EMIT_COUNT) {
+			for (int i = 0; i < EMIT_COUNT; i++) {
+				emitter->emit_signal(signal_name, i);
+			}
+		}
+		bench_do_not_optimize(receivers[0]->total);
+
+		memdelete(emitter);
+		for (int i = 0; i < 4; i++) {
+			memdelete(receivers[i]);
+		}
+	}
+}
+
+class BenchWorkerTasks {
+public:
+	LocalVector<uint64_t> values;
+
+	void process(uint32_t p_index, void *p_userdata) {
+		uint64_t value = p_index;
+		for (int i = 0; i < 64; i++) {
+			value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+		}
+		values[p_index] = value;
+	}
+
+	static void process_native(void *p_userdata) {
+		uint64_t *value = static_cast<uint64_t *>(p_userdata);
+		*value = *value * 6364136223846793005ULL + 1442695040888963407ULL;
+	}
+};
+
+TEST_SUITE("[Benchmark][WorkerThreadPool]") {
+	TEST_CASE("Task dispatch") {
+		static const int ELEMENT_COUNT = 100000;
+		static const int TASK_COUNT = 1000;
+
+		BenchWorkerTasks tasks;
+		tasks.values.resize(ELEMENT_COUNT);
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+		BENCHMARK("WorkerThreadPool/group_task", ELEMENT_COUNT) {
+			WorkerThreadPool::GroupID group = pool->add_template_group_task(&tasks, &BenchWorkerTasks::process, (void *)nullptr, ELEMENT_COUNT, -1, false, "Benchmark");
+			pool->wait_for_group_task_completion(group);
+		}
+
+		BENCHMARK("WorkerThreadPool/native_tasks", TASK_COUNT) {
+			WorkerThreadPool::TaskID ids[TASK_COUNT];
+			for (int i = 0; i < TASK_COUNT; i++) {
+				ids[i] = pool->add_native_task(&BenchWorkerTasks::process_native, &tasks.values[i], false, "Benchmark");
+			}
+			for (int i = 0; i < TASK_COUNT; i++) {
+				pool->wait_for_task_completion(ids[i]);
+			}
+		}
+	}
+}
+
+} // namespace BenchCore
+
+#endif // BENCH_CORE_H
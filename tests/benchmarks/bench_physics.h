@@ -0,0 +1,289 @@
+/**************************************************************************/
+/*  bench_physics.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCH_PHYSICS_H
+#define BENCH_PHYSICS_H
+
+#include "core/math/random_pcg.h"
+#include "servers/physics_2d/godot_body_2d.h"
+#include "servers/physics_2d/godot_broad_phase_2d_bvh.h"
+#include "servers/physics_server_2d.h"
+
+#ifndef _3D_DISABLED
+#include "servers/physics_3d/godot_collision_solver_3d.h"
+#include "servers/physics_3d/godot_shape_3d.h"
+#include "servers/physics_server_3d.h"
+#endif // _3D_DISABLED
+
+#include "tests/test_bench.h"
+#include "tests/test_macros.h"
+
+namespace BenchPhysics {
+
+static const real_t STEP_TIME = 1.0 / 60.0;
+
+template <typename T>
+static void step_server(T *p_server, int p_steps) {
+	for (int i = 0; i < p_steps; i++) {
+		p_server->sync();
+		p_server->flush_queries();
+		p_server->end_sync();
+		p_server->step(STEP_TIME);
+	}
+}
+
+TEST_SUITE("[Benchmark][Physics2D]") {
+	TEST_CASE("Broadphase stress") {
+		static const int BODY_COUNT = 8000;
+		static const int AREA_COUNT = 2000;
+
+		PhysicsServer2D *ps = PhysicsServer2DManager::get_singleton()->new_default_server();
+		ps->init();
+		ps->set_active(true);
+
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		// No gravity, the bodies are packed so that neighbors overlap and keep
+		// pushing each other.
+		ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 0.0);
+
+		RID circle = ps->circle_shape_create();
+		ps->shape_set_data(circle, 6.0);
+		RID rectangle = ps->rectangle_shape_create();
+		ps->shape_set_data(rectangle, Vector2(40, 40));
+
+		RandomPCG rng(1234);
+		LocalVector<RID> bodies;
+		for (int i = 0; i < BODY_COUNT; i++) {
+			RID body = ps->body_create();
+			ps->body_set_mode(body, PhysicsServer2D::BODY_MODE_RIGID);
+			ps->body_add_shape(body, circle);
+			ps->body_set_space(body, space);
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_CAN_SLEEP, false);
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2((i % 100) * 10.0, (i / 100) * 10.0)));
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(rng.random(-20, 20), rng.random(-20, 20)));
+			bodies.push_back(body);
+		}
+
+		LocalVector<RID> areas;
+		for (int i = 0; i < AREA_COUNT; i++) {
+			RID area = ps->area_create();
+			ps->area_add_shape(area, rectangle);
+			ps->area_set_space(area, space);
+			ps->area_set_param(area, PhysicsServer2D::AREA_PARAM_GRAVITY_OVERRIDE_MODE, PhysicsServer2D::AREA_SPACE_OVERRIDE_COMBINE);
+			ps->area_set_transform(area, Transform2D(0, Vector2(rng.random(0, 1000), rng.random(0, 800))));
+			areas.push_back(area);
+		}
+
+		step_server(ps, 1);
+
+		BENCHMARK("Physics2D/step_8k_bodies_2k_areas", 1) {
+			step_server(ps, 1);
+		}
+
+		for (const RID &E : bodies) {
+			ps->free(E);
+		}
+		for (const RID &E : areas) {
+			ps->free(E);
+		}
+		ps->free(circle);
+		ps->free(rectangle);
+		ps->free(space);
+		ps->finish();
+		memdelete(ps);
+	}
+
+	TEST_CASE("Broadphase BVH") {
+		static const int COLUMNS = 64;
+		static const int ITEM_COUNT = COLUMNS * 64;
+
+		// Only the broadphase, without the solver. Every item moves each step, so
+		// the pair candidates are found on worker threads.
+		GodotBroadPhase2DBVH broad_phase;
+		LocalVector<GodotBody2D *> bodies;
+		LocalVector<GodotBroadPhase2D::ID> ids;
+		LocalVector<Rect2> rects;
+		LocalVector<Vector2> velocities;
+		RandomPCG rng(2468);
+		for (int i = 0; i < ITEM_COUNT; i++) {
+			GodotBody2D *body = memnew(GodotBody2D);
+			const Rect2 rect(Vector2((i % COLUMNS) * 10.0, (i / COLUMNS) * 10.0), Vector2(12, 12));
+			bodies.push_back(body);
+			rects.push_back(rect);
+			velocities.push_back(Vector2(rng.random(-2, 2), rng.random(-2, 2)));
+			ids.push_back(broad_phase.create(body, 0, rect, false));
+		}
+		broad_phase.update();
+
+		int step = 0;
+		BENCHMARK("Physics2D/broadphase_bvh_move_4k", ITEM_COUNT) {
+			// Go back and forth, so the items stay packed.
+			const real_t direction = (step++ / 8) % 2 ? -1.0 : 1.0;
+			for (int i = 0; i < ITEM_COUNT; i++) {
+				rects[i].position += velocities[i] * direction;
+				broad_phase.move(ids[i], rects[i]);
+			}
+			broad_phase.update();
+		}
+
+		for (int i = 0; i < ITEM_COUNT; i++) {
+			broad_phase.remove(ids[i]);
+			memdelete(bodies[i]);
+		}
+	}
+}
+
+#ifndef _3D_DISABLED
+struct NarrowphasePair {
+	const GodotShape3D *shape_a = nullptr;
+	const GodotShape3D *shape_b = nullptr;
+	Transform3D transform_a;
+	Transform3D transform_b;
+};
+
+static void count_contact(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
+	(*static_cast<int *>(p_userdata))++;
+}
+
+static Transform3D random_transform(RandomPCG &p_rng, real_t p_range) {
+	Basis basis = Basis::from_euler(Vector3(p_rng.random(-Math_PI, Math_PI), p_rng.random(-Math_PI, Math_PI), p_rng.random(-Math_PI, Math_PI)));
+	return Transform3D(basis, Vector3(p_rng.random(-p_range, p_range), p_rng.random(-p_range, p_range), p_rng.random(-p_range, p_range)));
+}
+
+static void bench_narrowphase(const char *p_name, const GodotShape3D *p_shape_a, const GodotShape3D *p_shape_b) {
+	static const int PAIR_COUNT = 4096;
+
+	// Most pairs overlap or are close enough to go past the bounds check.
+	RandomPCG rng(5678);
+	LocalVector<NarrowphasePair> pairs;
+	pairs.resize(PAIR_COUNT);
+	for (NarrowphasePair &pair : pairs) {
+		pair.shape_a = p_shape_a;
+		pair.shape_b = p_shape_b;
+		pair.transform_a = random_transform(rng, 0.5);
+		pair.transform_b = random_transform(rng, 2.0);
+	}
+
+	BENCHMARK(p_name, PAIR_COUNT) {
+		int contacts = 0;
+		for (const NarrowphasePair &pair : pairs) {
+			GodotCollisionSolver3D::solve_static(pair.shape_a, pair.transform_a, pair.shape_b, pair.transform_b, count_contact, &contacts);
+		}
+		bench_do_not_optimize(contacts);
+	}
+}
+
+TEST_SUITE("[Benchmark][Physics3D]") {
+	TEST_CASE("Narrowphase") {
+		GodotBoxShape3D box;
+		box.set_data(Vector3(1, 1, 1));
+
+		GodotCapsuleShape3D capsule;
+		Dictionary capsule_data;
+		capsule_data["radius"] = 0.5;
+		capsule_data["height"] = 2.0;
+		capsule.set_data(capsule_data);
+
+		// A rounded convex hull of 32 points.
+		RandomPCG rng(91011);
+		Vector<Vector3> points;
+		for (int i = 0; i < 32; i++) {
+			points.push_back(Vector3(rng.random(-1, 1), rng.random(-1, 1), rng.random(-1, 1)).normalized());
+		}
+		GodotConvexPolygonShape3D convex;
+		convex.set_data(points);
+
+		bench_narrowphase("Physics3D/narrowphase_box_box", &box, &box);
+		bench_narrowphase("Physics3D/narrowphase_box_capsule", &box, &capsule);
+		bench_narrowphase("Physics3D/narrowphase_convex_convex", &convex, &convex);
+	}
+
+	TEST_CASE("Box stacking") {
+		static const int TOWERS = 8;
+		static const int TOWER_HEIGHT = 12;
+		static const int STEPS = 10;
+
+		PhysicsServer3D *ps = PhysicsServer3DManager::get_singleton()->new_default_server();
+		ps->init();
+		ps->set_active(true);
+
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		ps->space_set_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS, 16);
+
+		RID floor_shape = ps->box_shape_create();
+		ps->shape_set_data(floor_shape, Vector3(50, 1, 50));
+		RID floor = ps->body_create();
+		ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(floor, floor_shape);
+		ps->body_set_space(floor, space);
+		ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+
+		RID box_shape = ps->box_shape_create();
+		ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+		// Boxes start resting on each other, and are kept awake so that the
+		// solver keeps working on the stacks.
+		LocalVector<RID> boxes;
+		for (int tower = 0; tower < TOWERS; tower++) {
+			for (int i = 0; i < TOWER_HEIGHT; i++) {
+				RID box = ps->body_create();
+				ps->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+				ps->body_add_shape(box, box_shape);
+				ps->body_set_space(box, space);
+				ps->body_set_state(box, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+				ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(tower * 3.0, 0.5 + i, 0)));
+				boxes.push_back(box);
+			}
+		}
+
+		step_server(ps, 1);
+
+		BENCHMARK("Physics3D/box_stacking_8x12", STEPS) {
+			step_server(ps, STEPS);
+		}
+
+		for (const RID &E : boxes) {
+			ps->free(E);
+		}
+		ps->free(floor);
+		ps->free(box_shape);
+		ps->free(floor_shape);
+		ps->free(space);
+		ps->finish();
+		memdelete(ps);
+	}
+}
+#endif // _3D_DISABLED
+
+} // namespace BenchPhysics
+
+#endif // BENCH_PHYSICS_H
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  bench_scene.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCH_SCENE_H
+#define BENCH_SCENE_H
+
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
+#include "scene/2d/node_2d.h"
+#include "scene/gui/box_container.h"
+#include "scene/gui/grid_container.h"
+#include "scene/main/window.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_bench.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace BenchScene {
+
+// A wide and moderately deep tree with a few properties per node, roughly
+// what a level scene looks like.
+static Ref<PackedScene> make_packed_scene(int p_node_count) {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+
+	LocalVector<Node *> parents;
+	parents.push_back(root);
+	for (int i = 0; i < p_node_count; i++) {
+		Node2D *node = memnew(Node2D);
+		node->set_name("Node" + itos(i));
+		node->set_position(Vector2(i % 100, i / 100) * 16.0);
+		node->set_rotation(i * 0.01);
+		node->set_z_index(i % 8);
+		if (i % 4 == 0) {
+			node->add_to_group("bench_group", true);
+			node->set_meta("bench_value", i);
+		}
+		parents[(i * 13) % parents.size()]->add_child(node);
+		node->set_owner(root);
+		if (parents.size() < 64) {
+			parents.push_back(node);
+		}
+	}
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_SUITE("[Benchmark][PackedScene]") {
+	TEST_CASE("Scene instantiation") {
+		static const int NODE_COUNT = 2000;
+		Ref<PackedScene> packed_scene = make_packed_scene(NODE_COUNT);
+
+		BENCHMARK("PackedScene/instantiate_2k_nodes", NODE_COUNT) {
+			Node *instance = packed_scene->instantiate();
+			BENCHMARK_PAUSE_TIMING();
+			memdelete(instance);
+			BENCHMARK_RESUME_TIMING();
+		}
+
+		BENCHMARK("PackedScene/pack_2k_nodes", NODE_COUNT) {
+			BENCHMARK_PAUSE_TIMING();
+			Node *instance = packed_scene->instantiate();
+			Ref<PackedScene> repacked;
+			repacked.instantiate();
+			BENCHMARK_RESUME_TIMING();
+			repacked->pack(instance);
+			BENCHMARK_PAUSE_TIMING();
+			memdelete(instance);
+			BENCHMARK_RESUME_TIMING();
+		}
+	}
+
+	TEST_CASE("Large scene loading") {
+		static const int NODE_COUNT = 10000;
+		Ref<PackedScene> packed_scene = make_packed_scene(NODE_COUNT);
+
+		// The text loader goes through the VariantParser tokenizer for every property.
+		const String text_path = TestUtils::get_temp_path("bench_large_scene.tscn");
+		const String binary_path = TestUtils::get_temp_path("bench_large_scene.scn");
+		REQUIRE(ResourceSaver::save(packed_scene, text_path) == OK);
+		REQUIRE(ResourceSaver::save(packed_scene, binary_path) == OK);
+
+		BENCHMARK("ResourceLoader/load_tscn_10k_nodes", NODE_COUNT) {
+			Ref<PackedScene> loaded = ResourceLoader::load(text_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+			bench_do_not_optimize(loaded.ptr());
+		}
+
+		BENCHMARK("ResourceLoader/load_scn_10k_nodes", NODE_COUNT) {
+			Ref<PackedScene> loaded = ResourceLoader::load(binary_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+			bench_do_not_optimize(loaded.ptr());
+		}
+	}
+}
+
+TEST_SUITE("[Benchmark][Control]") {
+	TEST_CASE("[SceneTree] Deep container re-sort") {
+		static const int DEPTH = 12;
+		static const int SIBLINGS = 8;
+
+		// Nested VBoxContainers and GridContainers, each with a few leaf siblings.
+		VBoxContainer *root = memnew(VBoxContainer);
+		SceneTree::get_singleton()->get_root()->add_child(root);
+
+		Container *parent = root;
+		for (int depth = 0; depth < DEPTH; depth++) {
+			for (int i = 0; i < SIBLINGS; i++) {
+				Control *sibling = memnew(Control);
+				sibling->set_custom_minimum_size(Size2(10 + i, 10));
+				sibling->set_h_size_flags(Control::SIZE_EXPAND_FILL);
+				parent->add_child(sibling);
+			}
+
+			Container *child = nullptr;
+			if (depth % 2) {
+				GridContainer *grid = memnew(GridContainer);
+				grid->set_columns(3);
+				child = grid;
+			} else {
+				child = memnew(VBoxContainer);
+			}
+			parent->add_child(child);
+			parent = child;
+		}
+		Control *leaf = memnew(Control);
+		parent->add_child(leaf);
+		MessageQueue::get_singleton()->flush();
+
+		static const int CHANGES = 16;
+		BENCHMARK("Control/deep_container_resort", CHANGES) {
+			for (int i = 0; i < CHANGES; i++) {
+				leaf->set_custom_minimum_size(Size2(20 + (i % 2) * 10, 20 + (i % 2) * 5));
+				MessageQueue::get_singleton()->flush();
+			}
+		}
+
+		memdelete(root);
+	}
+}
+
+} // namespace BenchScene
+
+#endif // BENCH_SCENE_H
@@ -35,12 +35,21 @@
 #include "core/io/dir_access.h"
 #include "core/variant/variant.h"
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 class TestProjectSettingsInternalsAccessor {
 public:
 	static String &resource_path() {
 		return ProjectSettings::get_singleton()->resource_path;
 	};
+
+	static Error load_settings_binary(const String &p_path) {
+		return ProjectSettings::get_singleton()->_load_settings_binary(p_path);
+	}
+
+	static uint32_t encoded_settings_count() {
+		return ProjectSettings::get_singleton()->encoded_settings_count;
+	}
 };
 
 namespace TestProjectSettings {
@@ -108,6 +117,33 @@ TEST_CASE("[ProjectSettings] Set value should be returned when retrieved") {
 	CHECK(ProjectSettings::get_singleton()->has_setting("my_custom_setting"));
 }
 
+TEST_CASE("[ProjectSettings] Binary settings are decoded on first access") {
+	const String path = TestUtils::get_temp_path("lazy_project.binary");
+	ProjectSettings::CustomMap custom;
+	custom["lazy_test/number"] = 42;
+	custom["lazy_test/name"] = "Lazy";
+	REQUIRE(ProjectSettings::get_singleton()->save_custom(path, custom, Vector<String>(), false) == OK);
+
+	const uint32_t encoded_count = TestProjectSettingsInternalsAccessor::encoded_settings_count();
+	REQUIRE(TestProjectSettingsInternalsAccessor::load_settings_binary(path) == OK);
+	CHECK(TestProjectSettingsInternalsAccessor::encoded_settings_count() == encoded_count + 2);
+	CHECK(ProjectSettings::get_singleton()->has_setting("lazy_test/number"));
+	CHECK(ProjectSettings::get_singleton()->has_setting("lazy_test/name"));
+
+	CHECK(int(ProjectSettings::get_singleton()->get_setting("lazy_test/number")) == 42);
+	CHECK(TestProjectSettingsInternalsAccessor::encoded_settings_count() == encoded_count + 1);
+	CHECK(int(ProjectSettings::get_singleton()->get_setting("lazy_test/number")) == 42);
+	CHECK(TestProjectSettingsInternalsAccessor::encoded_settings_count() == encoded_count + 1);
+
+	// Overwriting or erasing a setting discards its encoded value.
+	ProjectSettings::get_singleton()->set_setting("lazy_test/name", Variant());
+	CHECK_FALSE(ProjectSettings::get_singleton()->has_setting("lazy_test/name"));
+	CHECK(TestProjectSettingsInternalsAccessor::encoded_settings_count() == encoded_count);
+
+	ProjectSettings::get_singleton()->set_setting("lazy_test/number", Variant());
+	DirAccess::remove_absolute(path);
+}
+
 TEST_CASE("[ProjectSettings] localize_path") {
 	String old_resource_path = TestProjectSettingsInternalsAccessor::resource_path();
 	TestProjectSettingsInternalsAccessor::resource_path() = DirAccess::create(DirAccess::ACCESS_FILESYSTEM)->get_current_dir();
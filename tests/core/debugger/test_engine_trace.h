@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_engine_trace.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ENGINE_TRACE_H
+#define TEST_ENGINE_TRACE_H
+
+#include "core/debugger/engine_trace.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEngineTrace {
+
+static void record_thread_zone(void *p_userdata) {
+	EngineTrace::set_thread_name("Trace test thread");
+	TRACE_ZONE_DETAIL("thread_zone", "detail");
+}
+
+TEST_CASE("[EngineTrace] Zones are only recorded while recording") {
+	{
+		TRACE_ZONE("ignored_zone");
+	}
+
+	EngineTrace::start();
+	{
+		TRACE_ZONE("outer_zone");
+		TRACE_ZONE("sibling_zone");
+		{
+			TRACE_ZONE_DETAIL("inner_zone", "res://inner.tres");
+			OS::get_singleton()->delay_usec(100);
+		}
+	}
+	Thread thread;
+	thread.start(record_thread_zone, nullptr);
+	thread.wait_to_finish();
+	EngineTrace::stop();
+
+	{
+		TRACE_ZONE("ignored_after_stop");
+	}
+
+	const String path = TestUtils::get_temp_path("engine_trace.json");
+	REQUIRE(EngineTrace::save(path) == OK);
+	EngineTrace::clear();
+
+	const Dictionary trace = JSON::parse_string(FileAccess::get_file_as_string(path));
+	const Array events = trace["traceEvents"];
+
+	HashMap<String, Dictionary> zones;
+	bool has_thread_name = false;
+	for (int i = 0; i < events.size(); i++) {
+		const Dictionary event = events[i];
+		if (event["ph"] == "M") {
+			has_thread_name = has_thread_name || Dictionary(event["args"])["name"] == "Trace test thread";
+		} else {
+			zones[event["name"]] = event;
+		}
+	}
+
+	CHECK_FALSE(zones.has("ignored_zone"));
+	CHECK_FALSE(zones.has("ignored_after_stop"));
+	REQUIRE(zones.has("outer_zone"));
+	REQUIRE(zones.has("inner_zone"));
+	CHECK(zones.has("sibling_zone"));
+	REQUIRE(zones.has("thread_zone"));
+	CHECK(has_thread_name);
+
+	// Nested zones are enclosed by their parents on the same thread.
+	const Dictionary &outer = zones["outer_zone"];
+	const Dictionary &inner = zones["inner_zone"];
+	CHECK(int64_t(inner["ts"]) >= int64_t(outer["ts"]));
+	CHECK(int64_t(inner["ts"]) + int64_t(inner["dur"]) <= int64_t(outer["ts"]) + int64_t(outer["dur"]));
+	CHECK(outer["tid"] == inner["tid"]);
+	CHECK(Dictionary(inner["args"])["detail"] == "res://inner.tres");
+
+	CHECK(zones["thread_zone"]["tid"] != outer["tid"]);
+}
+
+} // namespace TestEngineTrace
+
+#endif // TEST_ENGINE_TRACE_H
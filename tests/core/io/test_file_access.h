@@ -31,7 +31,9 @@
 #ifndef TEST_FILE_ACCESS_H
 #define TEST_FILE_ACCESS_H
 
+#include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +109,161 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+TEST_CASE("[FileAccess] Memory-mapped read") {
+	const String path = TestUtils::get_data_path("testdata.csv");
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	Ref<FileAccess> mf = FileAccess::open_mapped(path);
+	REQUIRE(!f.is_null());
+	REQUIRE(!mf.is_null());
+#if defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	CHECK(mf->get_mapped_data() != nullptr);
+#endif
+
+	const uint64_t length = f->get_length();
+	CHECK(mf->get_length() == length);
+
+	Vector<uint8_t> expected = f->get_buffer(length);
+	Vector<uint8_t> data = mf->get_buffer(length);
+	CHECK(data == expected);
+	CHECK_FALSE(mf->eof_reached());
+	if (mf->get_mapped_data()) {
+		CHECK(memcmp(mf->get_mapped_data(), expected.ptr(), length) == 0);
+	}
+
+	// Reading past the end stops at the end of the file.
+	uint8_t extra[4];
+	CHECK(mf->get_buffer(extra, 4) == 0);
+	CHECK(mf->eof_reached());
+
+	f->seek(7);
+	mf->seek(7);
+	CHECK_FALSE(mf->eof_reached());
+	CHECK(mf->get_32() == f->get_32());
+	CHECK(mf->get_8() == f->get_8());
+	CHECK(mf->get_position() == f->get_position());
+
+	mf->seek_end(-2);
+	CHECK(mf->get_position() == length - 2);
+	CHECK(mf->get_16() == expected[length - 2] + (expected[length - 1] << 8));
+
+	mf->close();
+	CHECK_FALSE(mf->is_open());
+}
+TEST_CASE("[FileAccess] Asynchronous reads") {
+	const String path = TestUtils::get_data_path("testdata.csv");
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(!f.is_null());
+#if defined(UNIX_ENABLED)
+	CHECK(f->is_positional_read_supported());
+#endif
+
+	const uint64_t length = f->get_length();
+	Vector<uint8_t> expected = f->get_buffer(length);
+	f->seek(3);
+
+	// Many requests in flight at once, in small chunks to cover partial reads at the end.
+	const uint64_t chunk_size = 17;
+	Vector<uint8_t> data;
+	data.resize(length);
+	Vector<FileAccess::AsyncReadID> requests;
+	for (uint64_t ofs = 0; ofs < length; ofs += chunk_size) {
+		requests.push_back(f->read_async(ofs, data.ptrw() + ofs, MIN(chunk_size, length - ofs)));
+	}
+
+	uint64_t total = 0;
+	for (int i = 0; i < requests.size(); i++) {
+		total += f->wait_for_async_read(requests[i]);
+	}
+	CHECK(total == length);
+	CHECK(data == expected);
+
+	// Positional reads don't move the cursor, and stop at the end of the file.
+	CHECK(f->get_position() == 3);
+	uint8_t tail[8];
+	CHECK(f->get_buffer_at(length - 2, tail, 8) == 2);
+	CHECK(tail[0] == expected[length - 2]);
+	CHECK(f->get_buffer_at(length + 10, tail, 8) == 0);
+	CHECK(f->get_position() == 3);
+}
+TEST_CASE("[FileAccess] Compressed blocks with a Zstd dictionary") {
+	Vector<uint8_t> data;
+	for (int i = 0; data.size() < 50000; i++) {
+		CharString line = vformat("[resource id=\"%d\" type=\"Mesh\"]\nsurface_%d = %d\n", i, i % 7, i * 31).utf8();
+		for (int j = 0; j < line.length(); j++) {
+			data.push_back(line[j]);
+		}
+	}
+
+	Vector<Vector<uint8_t>> samples;
+	for (int i = 0; i < 8; i++) {
+		samples.push_back(data.slice(i * 4000, i * 4000 + 1000));
+	}
+	Vector<uint8_t> dictionary = Compression::build_zstd_dictionary(samples, 4096);
+	CHECK(dictionary.size() == 4096);
+	const uint32_t dictionary_id = Compression::register_zstd_dictionary(dictionary);
+	REQUIRE(dictionary_id != 0);
+	CHECK(Compression::register_zstd_dictionary(dictionary) == dictionary_id);
+	CHECK(Compression::has_zstd_dictionary(dictionary_id));
+
+	const String plain_path = TestUtils::get_temp_path("compressed_plain.bin");
+	const String dictionary_path = TestUtils::get_temp_path("compressed_dictionary.bin");
+	for (const String &path : { plain_path, dictionary_path }) {
+		Ref<FileAccessCompressed> fw;
+		fw.instantiate();
+		fw->configure("TEST", Compression::MODE_ZSTD, 1024, path == dictionary_path ? dictionary_id : 0);
+		REQUIRE(fw->open_internal(path, FileAccess::WRITE) == OK);
+		fw->store_buffer(data.ptr(), data.size());
+		fw->close();
+	}
+
+	// Small blocks have little data of their own to match against.
+	CHECK(FileAccess::get_file_as_bytes(dictionary_path).size() < FileAccess::get_file_as_bytes(plain_path).size());
+
+	Ref<FileAccessCompressed> fr;
+	fr.instantiate();
+	fr->configure("TEST");
+	REQUIRE(fr->open_internal(dictionary_path, FileAccess::READ) == OK);
+	Ref<FileAccess> f = fr;
+	CHECK(fr->get_dictionary_id() == dictionary_id);
+	CHECK(fr->get_length() == (uint64_t)data.size());
+
+	// Whole blocks are decompressed in parallel, straight into the destination.
+	CHECK(f->get_buffer(data.size()) == data);
+	CHECK_FALSE(fr->eof_reached());
+	CHECK(fr->get_position() == (uint64_t)data.size());
+	fr->get_8();
+	CHECK(fr->eof_reached());
+
+	// Starting and ending in the middle of a block.
+	fr->seek(100);
+	CHECK(f->get_buffer(20000) == data.slice(100, 20100));
+	fr->seek(30001);
+	CHECK(fr->get_8() == data[30001]);
+	CHECK(fr->get_position() == 30002);
+
+	fr->seek_end(-3);
+	CHECK(f->get_buffer(10) == data.slice(data.size() - 3));
+	CHECK(fr->eof_reached());
+	fr->close();
+
+	// The last block is empty when the size is a multiple of the block size.
+	const String aligned_path = TestUtils::get_temp_path("compressed_aligned.bin");
+	Ref<FileAccessCompressed> fw;
+	fw.instantiate();
+	fw->configure("TEST", Compression::MODE_ZSTD, 1024, dictionary_id);
+	REQUIRE(fw->open_internal(aligned_path, FileAccess::WRITE) == OK);
+	fw->store_buffer(data.ptr(), 4096);
+	fw->close();
+
+	REQUIRE(fr->open_internal(aligned_path, FileAccess::READ) == OK);
+	CHECK(f->get_buffer(4096) == data.slice(0, 4096));
+	CHECK_FALSE(fr->eof_reached());
+	fr->get_8();
+	CHECK(fr->eof_reached());
+	fr->seek(4095);
+	CHECK(fr->get_8() == data[4095]);
+	CHECK(fr->get_position() == 4096);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -442,6 +442,91 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+TEST_CASE("[Image] Converting between byte and float formats") {
+	// Covers images large enough to be converted on several threads.
+	const int formats[] = { Image::FORMAT_R8, Image::FORMAT_RG8, Image::FORMAT_RGB8, Image::FORMAT_RGBA8, Image::FORMAT_RF, Image::FORMAT_RGF, Image::FORMAT_RGBF, Image::FORMAT_RGBAF };
+	Ref<Image> source = memnew(Image(300, 260, false, Image::FORMAT_RGBAF));
+	for (int y = 0; y < source->get_height(); y++) {
+		for (int x = 0; x < source->get_width(); x++) {
+			source->set_pixel(x, y, Color((x % 256) / 255.0, (y % 256) / 255.0, ((x + y) % 300) / 200.0, (x * y % 7) / 6.0));
+		}
+	}
+
+	for (int format : formats) {
+		for (int new_format : formats) {
+			Ref<Image> image = source->duplicate();
+			image->convert((Image::Format)format);
+			Ref<Image> expected = memnew(Image(image->get_width(), image->get_height(), false, (Image::Format)new_format));
+			for (int y = 0; y < image->get_height(); y++) {
+				for (int x = 0; x < image->get_width(); x++) {
+					expected->set_pixel(x, y, image->get_pixel(x, y));
+				}
+			}
+
+			image->convert((Image::Format)new_format);
+			CHECK_MESSAGE(
+					image->get_data() == expected->get_data(),
+					vformat("Converting from %s to %s should match setting every pixel.", Image::format_names[format], Image::format_names[new_format]));
+		}
+	}
+}
+
+TEST_CASE("[Image] Premultiplying alpha") {
+	// An odd width leaves pixels for the scalar tail after each row band.
+	Ref<Image> image = memnew(Image(333, 257, false, Image::FORMAT_RGBA8));
+	PackedByteArray data = image->get_data();
+	for (int i = 0; i < data.size(); i++) {
+		data.set(i, (i * 37 + i / 7) % 256);
+	}
+	image->set_data(333, 257, false, Image::FORMAT_RGBA8, data);
+
+	image->premultiply_alpha();
+	PackedByteArray result = image->get_data();
+	bool matches = true;
+	for (int i = 0; i < data.size(); i += 4) {
+		for (int c = 0; c < 3; c++) {
+			matches = matches && result[i + c] == ((data[i + c] * data[i + 3] + 255) >> 8);
+		}
+		matches = matches && result[i + 3] == data[i + 3];
+	}
+	CHECK_MESSAGE(matches, "Every pixel should have its color multiplied by its alpha.");
+}
+
+TEST_CASE("[Image] Resizing and generating mipmaps of large images") {
+	Ref<Image> image = memnew(Image(512, 384, false, Image::FORMAT_RGBA8));
+	for (int y = 0; y < image->get_height(); y++) {
+		for (int x = 0; x < image->get_width(); x++) {
+			image->set_pixel(x, y, Color((x % 256) / 255.0, (y % 256) / 255.0, ((x / 2) % 256) / 255.0));
+		}
+	}
+
+	Ref<Image> nearest = image->duplicate();
+	nearest->resize(700, 500, Image::INTERPOLATE_NEAREST);
+	bool matches = true;
+	for (int y = 0; y < nearest->get_height(); y++) {
+		for (int x = 0; x < nearest->get_width(); x++) {
+			matches = matches && nearest->get_pixel(x, y) == image->get_pixel(x * 512 / 700, y * 384 / 500);
+		}
+	}
+	CHECK_MESSAGE(matches, "Every row of the resized image should be filled from the matching source row.");
+
+	Ref<Image> mipmapped = image->duplicate();
+	REQUIRE(mipmapped->generate_mipmaps() == OK);
+	Ref<Image> level = mipmapped->get_image_from_mipmap(1);
+	REQUIRE(level->get_size() == Vector2(256, 192));
+	matches = true;
+	for (int y = 0; y < level->get_height(); y++) {
+		for (int x = 0; x < level->get_width(); x++) {
+			int r = 0;
+			for (int i = 0; i < 4; i++) {
+				r += image->get_pixel(x * 2 + i % 2, y * 2 + i / 2).get_r8();
+			}
+			matches = matches && level->get_pixel(x, y).get_r8() == (r + 2) >> 2;
+		}
+	}
+	CHECK_MESSAGE(matches, "Every pixel of the first mipmap should average the four source pixels.");
+}
+
 } // namespace TestImage
 
 #endif // TEST_IMAGE_H
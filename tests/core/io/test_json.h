@@ -232,6 +232,90 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+struct JSONEventLog {
+	Vector<JSON::ParseEvent> events;
+	Array values;
+	int stop_after = -1;
+
+	static bool record(void *p_userdata, JSON::ParseEvent p_event, const Variant &p_value) {
+		JSONEventLog *log = (JSONEventLog *)p_userdata;
+		log->events.push_back(p_event);
+		log->values.push_back(p_value);
+		return log->stop_after < 0 || log->events.size() < log->stop_after;
+	}
+};
+
+TEST_CASE("[JSON] Parsing events") {
+	String err_str;
+	int err_line = 0;
+
+	SUBCASE("Event order") {
+		JSONEventLog log;
+		Error err = JSON::parse_events(R"({"a": [1, "x", true, null], "b": {}})", &JSONEventLog::record, &log, err_str, err_line);
+		CHECK(err == OK);
+
+		const JSON::ParseEvent expected[] = {
+			JSON::EVENT_OBJECT_BEGIN,
+			JSON::EVENT_KEY,
+			JSON::EVENT_ARRAY_BEGIN,
+			JSON::EVENT_VALUE,
+			JSON::EVENT_VALUE,
+			JSON::EVENT_VALUE,
+			JSON::EVENT_VALUE,
+			JSON::EVENT_ARRAY_END,
+			JSON::EVENT_KEY,
+			JSON::EVENT_OBJECT_BEGIN,
+			JSON::EVENT_OBJECT_END,
+			JSON::EVENT_OBJECT_END,
+		};
+		REQUIRE(log.events.size() == (int)(sizeof(expected) / sizeof(expected[0])));
+		for (int i = 0; i < log.events.size(); i++) {
+			CHECK_MESSAGE(log.events[i] == expected[i], vformat("Event %d should match.", i));
+		}
+		CHECK(String(log.values[1]) == "a");
+		CHECK(double(log.values[3]) == 1.0);
+		CHECK(String(log.values[4]) == "x");
+		CHECK(bool(log.values[5]) == true);
+		CHECK(log.values[6].get_type() == Variant::NIL);
+		CHECK(String(log.values[8]) == "b");
+	}
+
+	SUBCASE("Errors are reported like JSON::parse()") {
+		JSONEventLog log;
+		Error err = JSON::parse_events("{\n\"a\" 1}", &JSONEventLog::record, &log, err_str, err_line);
+		CHECK(err == ERR_PARSE_ERROR);
+		CHECK(err_str == "Expected ':'");
+		CHECK(err_line == 1);
+
+		JSON json;
+		json.parse("{\n\"a\" 1}");
+		CHECK(json.get_error_message() == err_str);
+		CHECK(json.get_error_line() == err_line);
+
+		err = JSON::parse_events("[1, 2", &JSONEventLog::record, &log, err_str, err_line);
+		CHECK(err == ERR_PARSE_ERROR);
+	}
+
+	SUBCASE("Stopping from the callback") {
+		JSONEventLog log;
+		log.stop_after = 2;
+		Error err = JSON::parse_events("[1, 2, 3]", &JSONEventLog::record, &log, err_str, err_line);
+		CHECK(err == ERR_SKIP);
+		CHECK(log.events.size() == 2);
+	}
+}
+
+TEST_CASE("[JSON] Parsing long strings") {
+	JSON json;
+	String plain = String("abcdefgh").repeat(64);
+	CHECK(json.parse("\"" + plain + "\"") == OK);
+	CHECK(String(json.get_data()) == plain);
+
+	// Escapes split the string into several runs.
+	CHECK(json.parse("\"" + plain + "\\n" + plain + "\\u00e9\"") == OK);
+	CHECK(String(json.get_data()) == plain + "\n" + plain + String::chr(0xe9));
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -386,6 +386,85 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed array encoding") {
+	PackedInt32Array ints = { 1, -2, 0x12345678 };
+	int r_len;
+	uint8_t buffer[20];
+
+	CHECK(encode_variant(ints, buffer, r_len) == OK);
+	CHECK(r_len == 20);
+	CHECK_MESSAGE(buffer[0] == 0x1e, "Variant::PACKED_INT32_ARRAY");
+	CHECK_MESSAGE(buffer[4] == 0x03, "Array size.");
+	CHECK(buffer[8] == 0x01);
+	CHECK(buffer[12] == 0xfe);
+	CHECK(buffer[15] == 0xff);
+	CHECK(buffer[16] == 0x78);
+	CHECK(buffer[19] == 0x12);
+
+	PackedByteArray bytes = { 1, 2, 3, 4, 5 };
+	CHECK(encode_variant(bytes, buffer, r_len) == OK);
+	CHECK_MESSAGE(r_len == 16, "Byte arrays are padded to 4 bytes.");
+	CHECK(buffer[12] == 5);
+	CHECK(buffer[13] == 0x00);
+}
+
+TEST_CASE("[Marshalls] Packed array round trip") {
+	PackedFloat64Array doubles = { 0.5, -1e300, 3.25 };
+	PackedVector3Array vectors = { Vector3(1, 2, 3), Vector3(-4.5, 0, 8) };
+	PackedColorArray colors = { Color(0.25, 0.5, 0.75, 1), Color(1, 0, 0, 0.5) };
+	PackedStringArray strings = { "a", "abcd", "" };
+
+	Array values;
+	values.push_back(doubles);
+	values.push_back(vectors);
+	values.push_back(colors);
+	values.push_back(strings);
+	int len;
+	REQUIRE(encode_variant(values, nullptr, len) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	REQUIRE(encode_variant(values, buffer.ptrw(), len) == OK);
+
+	Variant decoded;
+	int r_len;
+	REQUIRE(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == len);
+	Array result = decoded;
+	REQUIRE(result.size() == 4);
+	PackedFloat64Array result_doubles = result[0];
+	PackedVector3Array result_vectors = result[1];
+	PackedColorArray result_colors = result[2];
+	PackedStringArray result_strings = result[3];
+	CHECK(result_doubles == doubles);
+	CHECK(result_vectors == vectors);
+	CHECK(result_colors == colors);
+	CHECK(result_strings == strings);
+}
+
+TEST_CASE("[Marshalls] Bounded Variant encoding") {
+	Dictionary dict;
+	dict["key"] = PackedInt64Array({ 1, 2, 3 });
+	dict["name"] = "value";
+
+	int len;
+	REQUIRE(encode_variant(dict, nullptr, len) == OK);
+	Vector<uint8_t> expected;
+	expected.resize(len);
+	REQUIRE(encode_variant(dict, expected.ptrw(), len) == OK);
+
+	for (int max_len : { 0, 4, len - 1, len, len + 8 }) {
+		Vector<uint8_t> buffer;
+		buffer.resize(MAX(max_len, 1));
+		int r_len = -1;
+		CHECK(encode_variant_bounded(dict, buffer.ptrw(), max_len, r_len) == OK);
+		CHECK_MESSAGE(r_len == len, "The full length should be reported whether it fits or not.");
+		if (r_len <= max_len) {
+			buffer.resize(r_len);
+			CHECK(buffer == expected);
+		}
+	}
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -0,0 +1,60 @@
+/**************************************************************************/
+/*  test_packed_byte_array_slice.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PACKED_BYTE_ARRAY_SLICE_H
+#define TEST_PACKED_BYTE_ARRAY_SLICE_H
+
+#include "core/io/packed_byte_array_slice.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedByteArraySlice {
+
+TEST_CASE("[PackedByteArraySlice] Find") {
+	PackedByteArray bytes;
+	for (int i = 0; i < 7; i++) {
+		bytes.push_back(i * 40);
+	}
+	Ref<PackedByteArraySlice> slice = PackedByteArraySlice::create(bytes, 1, 7);
+
+	CHECK(slice->find(80) == 1);
+	CHECK(slice->find(80, 2) == -1);
+	CHECK(slice->find(240, -2) == 5);
+	CHECK(slice->find(0) == -1);
+
+	// Values that are not bytes must not wrap around to a byte value.
+	CHECK(slice->find(80 + 256) == -1);
+	CHECK(slice->find(240 - 256) == -1);
+	CHECK(slice->find(-1) == -1);
+}
+
+} // namespace TestPackedByteArraySlice
+
+#endif // TEST_PACKED_BYTE_ARRAY_SLICE_H
@@ -38,6 +38,13 @@
 #include "tests/test_utils.h"
 #include "thirdparty/doctest/doctest.h"
 
+class TestPackedDataInternalsAccessor {
+public:
+	static PackedData *&singleton() {
+		return PackedData::singleton;
+	}
+};
+
 namespace TestPCKPacker {
 
 TEST_CASE("[PCKPacker] Pack an empty PCK file") {
@@ -117,6 +124,82 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Look up files and directories through the path index") {
+	const char *paths[] = { "pck_index/a.txt", "pck_index/sub/b.txt", "pck_index/sub/deeper/c.txt", "pck_index/sub2/d.txt" };
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_path_index.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	for (const char *path : paths) {
+		const String source_path = TestUtils::get_temp_path(String(path).get_file());
+		{
+			Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+			REQUIRE(f.is_valid());
+			f->store_string(path);
+		}
+		CHECK(pck_packer.add_file("res://" + String(path), source_path) == OK);
+	}
+	REQUIRE(pck_packer.flush() == OK);
+
+	{
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+		REQUIRE(f.is_valid());
+		f->seek(5 * 4);
+		CHECK_MESSAGE((f->get_32() & PACK_PATH_INDEX), "Packs with an unencrypted directory should have a path index.");
+	}
+
+	// Indices are only used for mapped packs.
+	Ref<FileAccess> mapped = FileAccess::open_mapped(output_pck_path);
+	REQUIRE(mapped.is_valid());
+	if (!mapped->get_mapped_data()) {
+		return;
+	}
+	mapped.unref();
+
+	// Load the pack into a separate PackedData, so it's gone for the tests that follow.
+	struct SingletonRestorer {
+		PackedData *global_packed_data = PackedData::get_singleton();
+		~SingletonRestorer() {
+			TestPackedDataInternalsAccessor::singleton() = global_packed_data;
+		}
+	} restorer;
+	PackedData packed_data;
+	REQUIRE(packed_data.add_pack(output_pck_path, false, 0) == OK);
+
+	for (const char *path : paths) {
+		Ref<FileAccess> f = packed_data.try_open_path("res://" + String(path));
+		REQUIRE_MESSAGE(f.is_valid(), vformat("'%s' should be found in the pack.", path));
+		CHECK(f->get_as_utf8_string() == path);
+	}
+	CHECK(packed_data.has_path("res://pck_index/./sub/../sub/b.txt"));
+	CHECK_FALSE(packed_data.has_path("res://pck_index/sub/missing.txt"));
+
+	Ref<DirAccess> da = packed_data.try_open_directory("res://pck_index");
+	REQUIRE(da.is_valid());
+	HashSet<String> dirs;
+	HashSet<String> files;
+	da->list_dir_begin();
+	for (String name = da->get_next(); !name.is_empty(); name = da->get_next()) {
+		if (da->current_is_dir()) {
+			dirs.insert(name);
+		} else {
+			files.insert(name);
+		}
+	}
+	da->list_dir_end();
+	CHECK(dirs.size() == 2);
+	CHECK(dirs.has("sub"));
+	CHECK(dirs.has("sub2"));
+	CHECK(files.size() == 1);
+	CHECK(files.has("a.txt"));
+
+	CHECK(da->dir_exists("sub/deeper"));
+	CHECK(da->file_exists("sub/deeper/c.txt"));
+	CHECK_FALSE(da->file_exists("sub/c.txt"));
+	CHECK(da->change_dir("sub/deeper") == OK);
+	CHECK(da->get_current_dir() == "res://pck_index/sub/deeper");
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
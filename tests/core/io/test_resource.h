@@ -32,6 +32,7 @@
 #define TEST_RESOURCE_H
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
@@ -112,6 +113,42 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Loading internal resources in parallel") {
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < 16; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("data", PackedInt32Array({ i, i * 2, i * 3 }));
+		if (i > 0) {
+			child->set_meta("previous", children[i - 1]);
+		}
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+	const String save_path = TestUtils::get_temp_path("resource_parallel.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = FAILED;
+	Ref<Resource> loaded = loader->load(save_path, "", &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+
+	Array loaded_children = loaded->get_meta("children");
+	REQUIRE(loaded_children.size() == 16);
+	for (int i = 0; i < 16; i++) {
+		Ref<Resource> child = loaded_children[i];
+		REQUIRE(child.is_valid());
+		CHECK(child->get_name() == vformat("Child %d", i));
+		CHECK(PackedInt32Array(child->get_meta("data")) == PackedInt32Array({ i, i * 2, i * 3 }));
+		if (i > 0) {
+			CHECK_MESSAGE(Ref<Resource>(child->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]), "References between internal resources should resolve to the same instances.");
+		}
+	}
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -32,6 +32,7 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -85,6 +86,44 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] Compact graph") {
+	ABCX abcx;
+	abcx.compact();
+	CHECK(abcx.is_compact());
+
+	Vector<int64_t> path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 4);
+	CHECK(path[0] == ABCX::X);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::B);
+	CHECK(path[3] == ABCX::C);
+	CHECK(abcx.get_point_connections(ABCX::A).size() == 3);
+
+	// Changing the connections goes back to the regular storage.
+	abcx.disconnect_points(ABCX::A, ABCX::B);
+	CHECK_FALSE(abcx.is_compact());
+	path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::C);
+
+	// One-way connections survive.
+	AStar3D a;
+	a.add_point(1, Vector3(0, 0, 0));
+	a.add_point(2, Vector3(1, 0, 0));
+	a.add_point(3, Vector3(2, 0, 0));
+	a.connect_points(1, 2, false);
+	a.connect_points(2, 3);
+	a.compact();
+	CHECK(a.get_id_path(1, 3).size() == 3);
+	CHECK(a.get_id_path(3, 1).is_empty());
+
+	a.remove_point(2);
+	CHECK(a.get_point_connections(1).is_empty());
+	CHECK(a.get_point_connections(3).is_empty());
+	CHECK_FALSE(a.are_points_connected(1, 2));
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -357,6 +396,70 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+TEST_CASE("[AStarGrid2D] Hierarchical paths") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 40, 40));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->set_default_compute_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->set_default_estimate_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->update();
+
+	// A wall across the grid with a single gap.
+	grid->fill_solid_region(Rect2i(19, 0, 2, 40));
+	grid->set_point_solid(Vector2i(19, 30), false);
+	grid->set_point_solid(Vector2i(20, 30), false);
+
+	const TypedArray<Vector2i> full_path = grid->get_id_path(Vector2i(2, 2), Vector2i(37, 2));
+	REQUIRE(full_path.size() > 0);
+
+	grid->set_hierarchy_cluster_size(8);
+
+	const auto check_path = [&](const TypedArray<Vector2i> &p_path, const Vector2i &p_from, const Vector2i &p_to) {
+		REQUIRE(p_path.size() > 0);
+		CHECK(Vector2i(p_path[0]) == p_from);
+		CHECK(Vector2i(p_path[p_path.size() - 1]) == p_to);
+		bool valid = true;
+		for (int i = 0; i < p_path.size(); i++) {
+			const Vector2i id = p_path[i];
+			if (grid->is_point_solid(id)) {
+				valid = false;
+			}
+			if (i > 0) {
+				const Vector2i step = id - Vector2i(p_path[i - 1]);
+				if (ABS(step.x) + ABS(step.y) != 1) {
+					valid = false;
+				}
+			}
+		}
+		CHECK_MESSAGE(valid, "Path steps between neighboring walkable points.");
+	};
+
+	SUBCASE("Paths go through the gap and stay close to the shortest path") {
+		const TypedArray<Vector2i> path = grid->get_id_path(Vector2i(2, 2), Vector2i(37, 2));
+		check_path(path, Vector2i(2, 2), Vector2i(37, 2));
+		CHECK(path.has(Vector2i(19, 30)));
+		CHECK(path.size() >= full_path.size());
+		CHECK(path.size() <= full_path.size() * 1.2);
+	}
+
+	SUBCASE("Points in the same cluster use the regular search") {
+		CHECK(grid->get_id_path(Vector2i(1, 1), Vector2i(6, 6)).size() == 11);
+	}
+
+	SUBCASE("Changes to solidity are picked up by the next query") {
+		grid->get_id_path(Vector2i(2, 2), Vector2i(37, 2));
+
+		grid->set_point_solid(Vector2i(19, 30));
+		CHECK(grid->get_id_path(Vector2i(2, 2), Vector2i(37, 2)).is_empty());
+
+		grid->fill_solid_region(Rect2i(19, 10, 2, 1), false);
+		const TypedArray<Vector2i> path = grid->get_id_path(Vector2i(2, 2), Vector2i(37, 2));
+		check_path(path, Vector2i(2, 2), Vector2i(37, 2));
+		CHECK(path.has(Vector2i(19, 10)));
+	}
+}
 } // namespace TestAStar
 
 #endif // TEST_ASTAR_H
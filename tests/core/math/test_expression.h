@@ -439,6 +439,73 @@ TEST_CASE("[Expression] Unusual expressions") {
 	//		int64_t(expression.execute()) == 0,
 	//		"`(-9223372036854775807 - 1) / -1` should return the expected result.");
 }
+
+static Array make_inputs(const Variant &p_a, const Variant &p_b) {
+	Array inputs;
+	inputs.push_back(p_a);
+	inputs.push_back(p_b);
+	return inputs;
+}
+
+TEST_CASE("[Expression] Repeated execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("a");
+	parameter_names.push_back("b");
+	CHECK_MESSAGE(
+			expression.parse("a + b * 2", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(1, 2))) == 5,
+			"The expression should return the expected result for integer inputs.");
+	CHECK_MESSAGE(
+			double(expression.execute(make_inputs(0.5, 0.25))) == doctest::Approx(1.0),
+			"The expression should return the expected result after the input types change.");
+	CHECK_MESSAGE(
+			Vector2(expression.execute(make_inputs(Vector2(1, 1), Vector2(1, 2)))).is_equal_approx(Vector2(3, 5)),
+			"The expression should return the expected result for vector inputs.");
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(3, 4))) == 11,
+			"The expression should return the expected result when switching back to integer inputs.");
+
+	ERR_PRINT_OFF;
+	expression.execute(make_inputs("text", 1));
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Invalid operand types should still be reported.");
+	ERR_PRINT_ON;
+
+	CHECK_MESSAGE(
+			expression.parse("a / b", parameter_names) == OK,
+			"The expression should parse successfully.");
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(7, 2))) == 3,
+			"The expression should return the expected result.");
+	ERR_PRINT_OFF;
+	expression.execute(make_inputs(7, 0));
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Integer division by zero should be reported.");
+	ERR_PRINT_ON;
+
+	// Constant subexpressions are computed once, but containers are created on every execution.
+	CHECK_MESSAGE(
+			expression.parse("[Vector2(1, 2) * 2, a]", parameter_names) == OK,
+			"The expression should parse successfully.");
+	Array first = expression.execute(make_inputs(1, 0));
+	Array second = expression.execute(make_inputs(2, 0));
+	CHECK_MESSAGE(
+			first == make_inputs(Vector2(2, 4), 1),
+			"The expression should return the expected result.");
+	CHECK_MESSAGE(
+			second == make_inputs(Vector2(2, 4), 2),
+			"The expression should return the expected result.");
+	CHECK_MESSAGE(
+			int(first[1]) == 1,
+			"Each execution should return a new array.");
+}
 } // namespace TestExpression
 
 #endif // TEST_EXPRESSION_H
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<int> received;
+
+static void record_call(int p_value) {
+	received.push_back(p_value);
+}
+
+TEST_CASE("[CallQueue] Calls are flushed in order") {
+	CallQueue queue;
+	received.clear();
+	for (int i = 0; i < 2000; i++) {
+		queue.push_callable(callable_mp_static(&record_call), i);
+	}
+	CHECK(queue.has_messages());
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	bool in_order = received.size() == 2000;
+	for (uint32_t i = 0; i < received.size(); i++) {
+		in_order = in_order && received[i] == int(i);
+	}
+	CHECK(in_order);
+}
+
+static const int PRODUCER_COUNT = 8;
+static const int CALLS_PER_PRODUCER = 1000;
+static CallQueue *threaded_queue = nullptr;
+static int last_received[PRODUCER_COUNT];
+static int out_of_order_calls = 0;
+
+static void record_producer_call(int p_producer, int p_sequence) {
+	// Only called from the flushing thread.
+	if (p_sequence != last_received[p_producer] + 1) {
+		out_of_order_calls++;
+	}
+	last_received[p_producer] = p_sequence;
+}
+
+static void push_from_thread(void *p_arg, uint32_t p_index) {
+	for (int i = 0; i < CALLS_PER_PRODUCER; i++) {
+		threaded_queue->push_callable(callable_mp_static(&record_producer_call), int(p_index), i);
+	}
+}
+
+TEST_CASE("[CallQueue] Calls pushed from several threads keep their order per thread") {
+	CallQueue queue;
+	threaded_queue = &queue;
+	out_of_order_calls = 0;
+	for (int i = 0; i < PRODUCER_COUNT; i++) {
+		last_received[i] = -1;
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(push_from_thread, nullptr, PRODUCER_COUNT, PRODUCER_COUNT, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(queue.has_messages());
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	CHECK(out_of_order_calls == 0);
+	bool all_received = true;
+	for (int i = 0; i < PRODUCER_COUNT; i++) {
+		all_received = all_received && last_received[i] == CALLS_PER_PRODUCER - 1;
+	}
+	CHECK(all_received);
+	threaded_queue = nullptr;
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -33,6 +33,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/object.h"
+#include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
 
 #include "tests/test_macros.h"
@@ -57,6 +58,10 @@ public:
 	int get_property() const { return property_value; }
 };
 
+class _TestDerivedDerivedObject : public _TestDerivedObject {
+	GDCLASS(_TestDerivedDerivedObject, _TestDerivedObject);
+};
+
 namespace TestObject {
 
 class _MockScriptInstance : public ScriptInstance {
@@ -220,6 +225,31 @@ TEST_CASE("[Object] Script instance property getter") {
 			"The returned value should equal the one which was set by the script instance.");
 }
 
+TEST_CASE("[Object] Cached indexed property setter") {
+	Object object;
+	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
+	object.set_script_instance(script_instance);
+
+	// The mock instance has no plain members, so the setter falls back to the regular path.
+	int slot = ScriptInstance::MEMBER_SLOT_UNRESOLVED;
+	Vector<StringName> path;
+	path.push_back("some_name");
+	bool valid = false;
+	object.set_indexed_cached(path, 100, slot, &valid);
+	CHECK(valid);
+	CHECK(slot == ScriptInstance::MEMBER_SLOT_NONE);
+
+	object.set_indexed_cached(path, 200, slot, &valid);
+	CHECK(valid);
+	Variant actual_value;
+	CHECK_MESSAGE(
+			script_instance->get("some_name", actual_value),
+			"The assigned script instance should successfully retrieve value by name.");
+	CHECK_MESSAGE(
+			actual_value == Variant(200),
+			"The returned value should equal the one which was set last.");
+}
+
 TEST_CASE("[Object] Built-in property setter") {
 	GDREGISTER_CLASS(_TestDerivedObject);
 	_TestDerivedObject derived_object;
@@ -245,6 +275,33 @@ TEST_CASE("[Object] Built-in property getter") {
 			"The returned value should equal the one which was set with built-in setter.");
 }
 
+TEST_CASE("[Object] Resolved method and property lookups") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	GDREGISTER_CLASS(_TestDerivedDerivedObject);
+
+	// Inherited methods resolve to the same bind as in the base class.
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_class") == ClassDB::get_method("Object", "get_class"));
+	CHECK(ClassDB::get_method("_TestDerivedObject", "set_property") != nullptr);
+	CHECK(ClassDB::get_method("Object", "set_property") == nullptr);
+	CHECK(ClassDB::get_method("_TestDerivedObject", "does_not_exist") == nullptr);
+
+	_TestDerivedObject derived_object;
+	bool valid = true;
+	derived_object.set("does_not_exist", 1, &valid);
+	CHECK_FALSE(valid);
+
+	// Members bound after the first lookup are picked up, by inheriting classes too.
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_property_late") == nullptr);
+	CHECK(ClassDB::get_method("_TestDerivedDerivedObject", "get_property_late") == nullptr);
+	ClassDB::bind_method(D_METHOD("get_property_late"), &_TestDerivedObject::get_property);
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_property_late") != nullptr);
+	CHECK(ClassDB::get_method("_TestDerivedDerivedObject", "get_property_late") == ClassDB::get_method("_TestDerivedObject", "get_property_late"));
+	CHECK(ClassDB::get_method("Object", "get_property_late") == nullptr);
+
+	derived_object.set_property(7);
+	CHECK(derived_object.call("get_property_late") == Variant(7));
+}
+
 TEST_CASE("[Object] Script property setter") {
 	Object object;
 	Variant script;
@@ -431,6 +488,112 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+class SignalReceiver : public Object {
+public:
+	Object *source = nullptr;
+	SignalReceiver *other = nullptr;
+	int calls = 0;
+
+	void count() { calls++; }
+	void disconnect_other() {
+		calls++;
+		source->disconnect("my_custom_signal", callable_mp(other, &SignalReceiver::count));
+	}
+	void connect_other() {
+		calls++;
+		source->connect("my_custom_signal", callable_mp(other, &SignalReceiver::count));
+	}
+	void emit_again() {
+		calls++;
+		if (calls == 1) {
+			source->emit_signal("my_custom_signal");
+		}
+	}
+};
+
+TEST_CASE("[Object] Changing connections while emitting") {
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal"));
+	SignalReceiver first;
+	SignalReceiver second;
+	first.source = &object;
+	first.other = &second;
+
+	SUBCASE("Slots disconnected during emission are still called by that emission") {
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.connect("my_custom_signal", callable_mp(&second, &SignalReceiver::count));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 1);
+		CHECK(second.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&second, &SignalReceiver::count)));
+
+		List<Object::Connection> connections;
+		object.get_signal_connection_list("my_custom_signal", &connections);
+		CHECK(connections.size() == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.emit_signal("my_custom_signal");
+		CHECK(second.calls == 1);
+	}
+
+	SUBCASE("Slots connected during emission are called from the next emission") {
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::connect_other), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 1);
+		CHECK(second.calls == 0);
+		CHECK(object.is_connected("my_custom_signal", callable_mp(&second, &SignalReceiver::count)));
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&first, &SignalReceiver::connect_other)));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 1);
+		CHECK(second.calls == 1);
+		object.disconnect("my_custom_signal", callable_mp(&second, &SignalReceiver::count));
+	}
+
+	SUBCASE("Reconnecting during emission keeps a single connection") {
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::connect_other));
+		object.connect("my_custom_signal", callable_mp(&second, &SignalReceiver::count));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 2);
+		CHECK(second.calls == 1);
+
+		List<Object::Connection> connections;
+		object.get_signal_connection_list("my_custom_signal", &connections);
+		CHECK(connections.size() == 3);
+
+		object.disconnect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.disconnect("my_custom_signal", callable_mp(&first, &SignalReceiver::connect_other));
+		object.disconnect("my_custom_signal", callable_mp(&second, &SignalReceiver::count));
+	}
+
+	SUBCASE("Nested emissions do not call slots disconnected before they started") {
+		object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.connect("my_custom_signal", callable_mp(&second, &SignalReceiver::count));
+		SignalReceiver nested;
+		nested.source = &object;
+		object.connect("my_custom_signal", callable_mp(&nested, &SignalReceiver::emit_again));
+
+		ERR_PRINT_OFF;
+		object.emit_signal("my_custom_signal");
+		ERR_PRINT_ON;
+		// The outer emission calls `second`, the nested one started after it was disconnected.
+		CHECK(second.calls == 1);
+		CHECK(nested.calls == 2);
+		CHECK(first.calls == 2);
+
+		object.disconnect("my_custom_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+		object.disconnect("my_custom_signal", callable_mp(&nested, &SignalReceiver::emit_again));
+	}
+
+	List<Object::Connection> connections;
+	object.get_all_signal_connections(&connections);
+	CHECK(connections.size() == 0);
+}
+
 class NotificationObject1 : public Object {
 	GDCLASS(NotificationObject1, Object);
 
@@ -499,6 +662,36 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+TEST_CASE("[Object] Thread-confined reference counting") {
+	Ref<RefCounted> ref;
+	ref.instantiate();
+	CHECK_FALSE(ref->is_thread_confined());
+
+	ref->set_thread_confined(true);
+	CHECK(ref->is_thread_confined());
+	CHECK_EQ(ref->get_reference_count(), 1);
+
+	{
+		Ref<RefCounted> copy = ref;
+		Variant as_variant = copy;
+		CHECK_EQ(ref->get_reference_count(), 3);
+	}
+	CHECK_EQ(ref->get_reference_count(), 1);
+
+	// Switching back keeps the count intact.
+	ref->set_thread_confined(false);
+	Ref<RefCounted> copy = ref;
+	CHECK_EQ(ref->get_reference_count(), 2);
+	copy.unref();
+	CHECK_EQ(ref->get_reference_count(), 1);
+
+	// The last unreference through the unsynchronized path must still free the object.
+	ref->set_thread_confined(true);
+	ObjectID id = ref->get_instance_id();
+	ref.unref();
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -40,17 +40,23 @@
 class _TestUndoRedoObject : public Object {
 	GDCLASS(_TestUndoRedoObject, Object);
 	int property_value = 0;
+	PackedByteArray data_value;
 
 protected:
 	static void _bind_methods() {
 		ClassDB::bind_method(D_METHOD("set_property", "property"), &_TestUndoRedoObject::set_property);
 		ClassDB::bind_method(D_METHOD("get_property"), &_TestUndoRedoObject::get_property);
+		ClassDB::bind_method(D_METHOD("set_data", "data"), &_TestUndoRedoObject::set_data);
+		ClassDB::bind_method(D_METHOD("get_data"), &_TestUndoRedoObject::get_data);
 		ADD_PROPERTY(PropertyInfo(Variant::INT, "property"), "set_property", "get_property");
+		ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "data"), "set_data", "get_data");
 	}
 
 public:
 	void set_property(int value) { property_value = value; }
 	int get_property() const { return property_value; }
+	void set_data(const PackedByteArray &value) { data_value = value; }
+	PackedByteArray get_data() const { return data_value; }
 	void add_to_property(int value) { property_value += value; }
 	void subtract_from_property(int value) { property_value -= value; }
 };
@@ -71,6 +77,24 @@ void increment_property_action(UndoRedo *undo_redo, const String &name, _TestUnd
 	undo_redo->commit_action();
 }
 
+void set_data_action(UndoRedo *undo_redo, _TestUndoRedoObject *test_object, const PackedByteArray &value) {
+	undo_redo->create_action("Set Data");
+	undo_redo->add_do_property(test_object, "data", value);
+	undo_redo->add_undo_property(test_object, "data", test_object->get_data());
+	undo_redo->commit_action();
+}
+
+PackedByteArray make_data(int size, uint8_t value, bool noisy) {
+	PackedByteArray data;
+	data.resize(size);
+	uint32_t state = value + 1;
+	for (int i = 0; i < size; i++) {
+		state = state * 1664525 + 1013904223;
+		data.write[i] = noisy ? uint8_t(state >> 24) : value;
+	}
+	return data;
+}
+
 TEST_CASE("[UndoRedo] Simple Property UndoRedo") {
 	GDREGISTER_CLASS(_TestUndoRedoObject);
 	UndoRedo *undo_redo = memnew(UndoRedo());
@@ -197,6 +221,66 @@ TEST_CASE("[UndoRedo] Merge Method UndoRedo") {
 	memdelete(undo_redo);
 }
 
+TEST_CASE("[UndoRedo] Large values of older actions are compressed") {
+	GDREGISTER_CLASS(_TestUndoRedoObject);
+	UndoRedo *undo_redo = memnew(UndoRedo());
+
+	_TestUndoRedoObject *test_object = memnew(_TestUndoRedoObject());
+
+	const int data_size = 1024 * 1024;
+	for (int i = 1; i <= 4; i++) {
+		set_data_action(undo_redo, test_object, make_data(data_size, i, false));
+	}
+
+	CHECK(undo_redo->get_history_count() == 4);
+	// Only the last action keeps its values uncompressed.
+	CHECK(undo_redo->get_memory_usage() < uint64_t(3 * data_size));
+
+	undo_redo->undo();
+	undo_redo->undo();
+	undo_redo->undo();
+	CHECK(test_object->get_data() == make_data(data_size, 1, false));
+
+	undo_redo->redo();
+	CHECK(test_object->get_data() == make_data(data_size, 2, false));
+
+	undo_redo->undo();
+	undo_redo->undo();
+	CHECK(test_object->get_data().is_empty());
+
+	memdelete(test_object);
+	memdelete(undo_redo);
+}
+
+TEST_CASE("[UndoRedo] Memory budget") {
+	GDREGISTER_CLASS(_TestUndoRedoObject);
+	UndoRedo *undo_redo = memnew(UndoRedo());
+	undo_redo->set_max_memory_mb(2);
+
+	_TestUndoRedoObject *test_object = memnew(_TestUndoRedoObject());
+
+	// Noisy data doesn't compress, so every action costs at least 512 KiB for both do and undo values.
+	const int data_size = 512 * 1024;
+	for (int i = 0; i < 8; i++) {
+		set_data_action(undo_redo, test_object, make_data(data_size, i, true));
+		CHECK(undo_redo->get_memory_usage() <= uint64_t(2 * 1024 * 1024));
+	}
+
+	CHECK(undo_redo->get_history_count() >= 1);
+	CHECK(undo_redo->get_history_count() < 8);
+	CHECK(test_object->get_data() == make_data(data_size, 7, true));
+
+	undo_redo->undo();
+	CHECK(test_object->get_data() == make_data(data_size, 6, true));
+
+	undo_redo->clear_history();
+	CHECK(undo_redo->get_history_count() == 0);
+	CHECK(undo_redo->get_memory_usage() == 0);
+
+	memdelete(test_object);
+	memdelete(undo_redo);
+}
+
 } //namespace TestUndoRedo
 
 #endif // TEST_UNDO_REDO_H
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Tagged allocations are accounted per tag") {
+	const uint64_t usage = Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+
+	void *mem = memalloc_tagged(1000, Memory::TAG_AUDIO);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage + 1000);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO) >= usage + 1000);
+
+	// Reallocating keeps the original tag, wherever it happens.
+	{
+		MemoryTagScope scope(Memory::TAG_PHYSICS);
+		mem = memrealloc(mem, 3000);
+	}
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage + 3000);
+
+	memfree(mem);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO) >= usage + 3000);
+}
+
+TEST_CASE("[Memory] Tag scopes attribute untagged allocations") {
+	const uint64_t usage = Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION);
+
+	uint64_t *value = nullptr;
+	{
+		MemoryTagScope scope(Memory::TAG_NAVIGATION);
+		{
+			MemoryTagScope inner_scope(Memory::TAG_SCRIPT);
+		}
+		value = memnew(uint64_t(42));
+	}
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION) == usage + sizeof(uint64_t));
+
+	uint64_t *other = memnew(uint64_t(7));
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION) == usage + sizeof(uint64_t));
+
+	uint64_t *tagged = memnew_tagged(uint64_t(3), Memory::TAG_NAVIGATION);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION) == usage + 2 * sizeof(uint64_t));
+
+	memdelete(value);
+	memdelete(other);
+	memdelete(tagged);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION) == usage);
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Memory] Tag names") {
+	CHECK(String(Memory::get_tag_name(Memory::TAG_RENDERING)) == "rendering");
+	CHECK(String(Memory::get_tag_name(Memory::TAG_NAVIGATION)) == "navigation");
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -262,6 +262,17 @@ TEST_CASE("[String] Concatenation") {
 	s = s + String("Day");
 
 	CHECK(s == "Have a Nice Day");
+
+	// Operands are left untouched, including when they share data.
+	const String lhs = "Have a";
+	const String rhs = lhs;
+	const String sum = lhs + String(" ") + rhs;
+	CHECK(sum == "Have a Have a");
+	CHECK(lhs == "Have a");
+	CHECK(rhs == "Have a");
+	CHECK(String() + lhs == lhs);
+	CHECK(lhs + String() == lhs);
+	CHECK(lhs + lhs == "Have aHave a");
 }
 
 TEST_CASE("[String] Testing size and length of string") {
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "string_name_interning_test";
+	const StringName b = String("string_name_interning_test");
+	const StringName c = StringName(StaticCString::create("string_name_interning_test"));
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a.hash() == String("string_name_interning_test").hash());
+
+	CHECK(a == "string_name_interning_test");
+	CHECK(a == String("string_name_interning_test"));
+	CHECK(a != "string_name_interning_tes");
+	CHECK(a != "string_name_interning_test_");
+
+	CHECK(StringName::search("string_name_interning_test") == a);
+	CHECK(StringName::search(U"string_name_interning_test") == a);
+	CHECK(StringName::search(String("string_name_interning_test")) == a);
+	CHECK(StringName::search("string_name_interning_test_missing") == StringName());
+}
+
+TEST_CASE("[StringName] Names are released when unreferenced") {
+	{
+		const StringName temp = String("string_name_release_test");
+		CHECK(StringName::search("string_name_release_test") == temp);
+	}
+	CHECK(StringName::search("string_name_release_test") == StringName());
+}
+
+static const int THREADED_NAMES = 64;
+static StringName threaded_names[THREADED_NAMES];
+static SafeNumeric<int> threaded_mismatches;
+
+static void intern_from_thread(void *p_arg, uint32_t p_index) {
+	const int idx = p_index % THREADED_NAMES;
+	const StringName name = "string_name_threaded_test_" + itos(idx);
+	if (name != threaded_names[idx] || name.data_unique_pointer() != threaded_names[idx].data_unique_pointer()) {
+		threaded_mismatches.increment();
+	}
+	// Also create and drop names nobody else holds, to exercise removal.
+	const StringName transient = "string_name_threaded_transient_" + itos(p_index);
+	if (transient.operator String() != "string_name_threaded_transient_" + itos(p_index)) {
+		threaded_mismatches.increment();
+	}
+}
+
+TEST_CASE("[StringName] Interning from multiple threads") {
+	for (int i = 0; i < THREADED_NAMES; i++) {
+		threaded_names[i] = "string_name_threaded_test_" + itos(i);
+	}
+	threaded_mismatches.set(0);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(intern_from_thread, nullptr, 4096, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(threaded_mismatches.get() == 0);
+	CHECK(StringName::search("string_name_threaded_transient_0") == StringName());
+
+	for (int i = 0; i < THREADED_NAMES; i++) {
+		threaded_names[i] = StringName();
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
@@ -111,6 +111,8 @@ public:
 		TEST_MSGSYNC_FUNC2_TRANSFORM_FLOAT,
 		TEST_MSGRET_FUNC1_TRANSFORM,
 		TEST_MSGRET_FUNC2_TRANSFORM_FLOAT,
+		TEST_MSG_BEGIN_BATCH,
+		TEST_MSG_END_BATCH,
 		TEST_MSG_MAX
 	};
 
@@ -206,6 +208,12 @@ public:
 					case TEST_MSGRET_FUNC2_TRANSFORM_FLOAT:
 						command_queue.push_and_ret(this, &SharedThreadState::func2r, tr, f, &otr);
 						break;
+					case TEST_MSG_BEGIN_BATCH:
+						command_queue.begin_batch();
+						break;
+					case TEST_MSG_END_BATCH:
+						command_queue.end_batch();
+						break;
 					default:
 						break;
 				}
@@ -296,6 +304,35 @@ TEST_CASE("[CommandQueue] Test Queue Basics with WorkerThreadPool sync.") {
 	test_command_queue_basic(true);
 }
 
+TEST_CASE("[CommandQueue] Batched commands are published on commit") {
+	SharedThreadState sts;
+	sts.init_threads();
+
+	sts.add_msg_to_write(SharedThreadState::TEST_MSG_BEGIN_BATCH);
+	sts.add_msg_to_write(SharedThreadState::TEST_MSG_FUNC1_TRANSFORM);
+	sts.add_msg_to_write(SharedThreadState::TEST_MSG_FUNC3_TRANSFORMx6);
+	sts.writer_threadwork.main_start_work();
+	sts.writer_threadwork.main_wait_for_done();
+
+	sts.message_count_to_read = -1;
+	sts.reader_threadwork.main_start_work();
+	sts.reader_threadwork.main_wait_for_done();
+	CHECK_MESSAGE(sts.func1_count == 0,
+			"Commands of an open batch should not be visible to the reader.");
+
+	sts.add_msg_to_write(SharedThreadState::TEST_MSG_END_BATCH);
+	sts.writer_threadwork.main_start_work();
+	sts.writer_threadwork.main_wait_for_done();
+
+	sts.message_count_to_read = -1;
+	sts.reader_threadwork.main_start_work();
+	sts.reader_threadwork.main_wait_for_done();
+	CHECK_MESSAGE(sts.func1_count == 2,
+			"Ending the batch should publish its commands.");
+
+	sts.destroy_threads();
+}
+
 TEST_CASE("[CommandQueue] Test Queue Wrapping to same spot.") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
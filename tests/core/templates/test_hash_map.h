@@ -32,14 +32,16 @@
 #define TEST_HASH_MAP_H
 
 #include "core/templates/hash_map.h"
+#include "core/templates/ordered_hash_map.h"
+#include "core/templates/swiss_hash_map.h"
 
 #include "tests/test_macros.h"
 
 namespace TestHashMap {
 
-TEST_CASE("[HashMap] Insert element") {
-	HashMap<int, int> map;
-	HashMap<int, int>::Iterator e = map.insert(42, 84);
+TEST_CASE_TEMPLATE("[HashMap] Insert element", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
+	typename Map::Iterator e = map.insert(42, 84);
 
 	CHECK(e);
 	CHECK(e->key == 42);
@@ -49,32 +51,32 @@ TEST_CASE("[HashMap] Insert element") {
 	CHECK(map.find(42));
 }
 
-TEST_CASE("[HashMap] Overwrite element") {
-	HashMap<int, int> map;
+TEST_CASE_TEMPLATE("[HashMap] Overwrite element", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
 	map.insert(42, 84);
 	map.insert(42, 1234);
 
 	CHECK(map[42] == 1234);
 }
 
-TEST_CASE("[HashMap] Erase via element") {
-	HashMap<int, int> map;
-	HashMap<int, int>::Iterator e = map.insert(42, 84);
+TEST_CASE_TEMPLATE("[HashMap] Erase via element", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
+	typename Map::Iterator e = map.insert(42, 84);
 	map.remove(e);
 	CHECK(!map.has(42));
 	CHECK(!map.find(42));
 }
 
-TEST_CASE("[HashMap] Erase via key") {
-	HashMap<int, int> map;
+TEST_CASE_TEMPLATE("[HashMap] Erase via key", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
 	map.insert(42, 84);
 	map.erase(42);
 	CHECK(!map.has(42));
 	CHECK(!map.find(42));
 }
 
-TEST_CASE("[HashMap] Size") {
-	HashMap<int, int> map;
+TEST_CASE_TEMPLATE("[HashMap] Size", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
 	map.insert(42, 84);
 	map.insert(123, 84);
 	map.insert(123, 84);
@@ -84,8 +86,8 @@ TEST_CASE("[HashMap] Size") {
 	CHECK(map.size() == 4);
 }
 
-TEST_CASE("[HashMap] Iteration") {
-	HashMap<int, int> map;
+TEST_CASE_TEMPLATE("[HashMap] Iteration", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
 	map.insert(42, 84);
 	map.insert(123, 12385);
 	map.insert(0, 12934);
@@ -105,15 +107,15 @@ TEST_CASE("[HashMap] Iteration") {
 	}
 }
 
-TEST_CASE("[HashMap] Const iteration") {
-	HashMap<int, int> map;
+TEST_CASE_TEMPLATE("[HashMap] Const iteration", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
 	map.insert(42, 84);
 	map.insert(123, 12385);
 	map.insert(0, 12934);
 	map.insert(123485, 1238888);
 	map.insert(123, 111111);
 
-	const HashMap<int, int> const_map = map;
+	const Map const_map = map;
 
 	Vector<Pair<int, int>> expected;
 	expected.push_back(Pair<int, int>(42, 84));
@@ -128,6 +130,156 @@ TEST_CASE("[HashMap] Const iteration") {
 		++idx;
 	}
 }
+
+TEST_CASE_TEMPLATE("[HashMap] Many insertions and erasures", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
+	for (int i = 0; i < 10000; i++) {
+		map.insert(i, i * 2);
+	}
+	CHECK(map.size() == 10000);
+
+	// Leave holes behind so lookups have to probe past removed entries.
+	for (int i = 0; i < 10000; i += 2) {
+		CHECK(map.erase(i));
+	}
+	CHECK(map.size() == 5000);
+
+	bool all_found = true;
+	for (int i = 0; i < 10000; i++) {
+		const int *value = map.getptr(i);
+		if ((i % 2 == 0) != (value == nullptr) || (value && *value != i * 2)) {
+			all_found = false;
+		}
+	}
+	CHECK(all_found);
+
+	// Reinsert over the removed slots, iteration keeps insertion order.
+	for (int i = 0; i < 10000; i += 2) {
+		map[i] = -i;
+	}
+	CHECK(map.size() == 10000);
+
+	int idx = 0;
+	bool order_kept = true;
+	for (const KeyValue<int, int> &E : map) {
+		const int expected_key = idx < 5000 ? idx * 2 + 1 : (idx - 5000) * 2;
+		if (E.key != expected_key) {
+			order_kept = false;
+		}
+		idx++;
+	}
+	CHECK(order_kept);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has(1));
+}
+
+TEST_CASE_TEMPLATE("[HashMap] Replace key", Map, HashMap<int, int>, SwissHashMap<int, int>, OrderedHashMap<int, int>) {
+	Map map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+
+	CHECK(map.replace_key(123, 456));
+	CHECK(!map.has(123));
+	CHECK(map[456] == 12385);
+	CHECK(map.size() == 3);
+
+	// Position in iteration order is preserved.
+	typename Map::Iterator e = map.begin();
+	++e;
+	CHECK(e->key == 456);
+}
+
+TEST_CASE("[OrderedHashMap] Stable pointers and indexed access") {
+	OrderedHashMap<int, int> map;
+	map.insert(1, 10);
+	int *value = map.getptr(1);
+	for (int i = 2; i < 1000; i++) {
+		map.insert(i, i * 10);
+	}
+	// Entries are never moved when the map grows.
+	CHECK(value == map.getptr(1));
+
+	CHECK(map.get_at_index(0)->key == 1);
+	CHECK(map.get_at_index(998)->key == 999);
+	CHECK(map.get_at_index(999) == nullptr);
+
+	map.erase(2);
+	CHECK(map.get_at_index(1)->key == 3);
+	CHECK(map.getptr(1) == value);
+
+	// Erasing never moves the remaining entries.
+	int *last_value = map.getptr(999);
+	for (int i = 3; i < 900; i++) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 101);
+	CHECK(map.getptr(1) == value);
+	CHECK(map.getptr(999) == last_value);
+	CHECK(map.get_at_index(0)->key == 1);
+	CHECK(map.get_at_index(1)->key == 900);
+
+	// The next insertion compacts the storage, order is kept.
+	map.insert(2000, 20000);
+	CHECK(map.size() == 102);
+	CHECK(map.get_at_index(0)->key == 1);
+	CHECK(map.get_at_index(1)->key == 900);
+	CHECK(map.get_at_index(101)->key == 2000);
+	CHECK(map[950] == 9500);
+	CHECK(!map.has(500));
+}
+
+TEST_CASE("[OrderedHashMap] Erase while iterating") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i);
+	}
+
+	// Erasing the current element keeps the iterator and the other entries valid.
+	int visited = 0;
+	for (OrderedHashMap<int, int>::Iterator it = map.begin(); it; ++it) {
+		CHECK(it->value == visited);
+		map.erase(it->key);
+		visited++;
+	}
+	CHECK(visited == 100);
+	CHECK(map.is_empty());
+
+	map.insert(7, 70);
+	CHECK(map.size() == 1);
+	CHECK(map.get_at_index(0)->key == 7);
+}
+
+TEST_CASE("[OrderedHashMap] Matches HashMap under random operations") {
+	OrderedHashMap<int, int> map;
+	HashMap<int, int> reference;
+	uint32_t seed = 12345;
+	for (int i = 0; i < 20000; i++) {
+		seed = seed * 1103515245 + 12345;
+		const int key = (seed >> 16) % 512;
+		if ((seed >> 8) % 3 == 0) {
+			CHECK(map.erase(key) == reference.erase(key));
+		} else {
+			map[key] = i;
+			reference[key] = i;
+		}
+	}
+	CHECK(map.size() == reference.size());
+
+	bool same = true;
+	OrderedHashMap<int, int>::ConstIterator it = map.begin();
+	for (const KeyValue<int, int> &E : reference) {
+		if (!it || it->key != E.key || it->value != E.value) {
+			same = false;
+			break;
+		}
+		++it;
+	}
+	CHECK(same);
+	CHECK(it == map.end());
+}
 } // namespace TestHashMap
 
 #endif // TEST_HASH_MAP_H
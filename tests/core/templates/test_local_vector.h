@@ -244,6 +244,73 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Frame allocator.") {
+	const bool owns_arena = FrameAllocator::get_arena_size() == 0;
+	if (owns_arena) {
+		FrameAllocator::initialize(256);
+	}
+	FrameAllocator::reset();
+
+	{
+		// Grows past the arena, so it also exercises the fallback to the heap.
+		FrameLocalVector<int> vector;
+		for (int i = 0; i < 100; i++) {
+			vector.push_back(i);
+		}
+		CHECK(vector.size() == 100);
+		CHECK(vector[0] == 0);
+		CHECK(vector[50] == 50);
+		CHECK(vector[99] == 99);
+		CHECK(FrameAllocator::get_arena_usage() > 0);
+	}
+
+	FrameAllocator::reset();
+	CHECK(FrameAllocator::get_arena_usage() == 0);
+
+	{
+		FrameLocalVector<int> vector;
+		vector.push_back(1);
+		CHECK(FrameAllocator::get_arena_usage() > 0);
+
+		// A stray allocation retires its arena, so its memory isn't handed out again.
+		ERR_PRINT_OFF;
+		FrameAllocator::reset();
+		ERR_PRINT_ON;
+		CHECK(FrameAllocator::get_arena_usage() == 0);
+
+		FrameLocalVector<int> other;
+		other.push_back(2);
+		CHECK(vector[0] == 1);
+		CHECK(other[0] == 2);
+		const size_t usage = FrameAllocator::get_arena_usage();
+		CHECK(usage > 0);
+
+		// With an arena already retired, the new one can't be rewound either.
+		ERR_PRINT_OFF;
+		FrameAllocator::reset();
+		ERR_PRINT_ON;
+		CHECK(FrameAllocator::get_arena_usage() == usage);
+		CHECK(vector[0] == 1);
+		CHECK(other[0] == 2);
+	}
+
+	// Once everything is freed, the retired arena is released and the arena is rewound.
+	FrameAllocator::reset();
+	CHECK(FrameAllocator::get_arena_usage() == 0);
+
+	{
+		FrameLocalVector<int> vector;
+		vector.push_back(1);
+		CHECK(FrameAllocator::get_arena_usage() > 0);
+	}
+	FrameAllocator::reset();
+	CHECK(FrameAllocator::get_arena_usage() == 0);
+
+	if (owns_arena) {
+		FrameAllocator::finalize();
+	}
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_paged_allocator.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PAGED_ALLOCATOR_H
+#define TEST_PAGED_ALLOCATOR_H
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestPagedAllocator {
+
+struct Tracked {
+	static inline SafeNumeric<int> alive{ 0 };
+	uint64_t value = 0;
+
+	Tracked(uint64_t p_value) :
+			value(p_value) { alive.increment(); }
+	~Tracked() { alive.decrement(); }
+};
+
+TEST_CASE("[PagedAllocator] Allocation and reuse") {
+	PagedAllocator<Tracked> allocator(4);
+	Tracked::alive.set(0);
+
+	LocalVector<Tracked *> items;
+	for (uint64_t i = 0; i < 10; i++) {
+		items.push_back(allocator.alloc(i));
+	}
+	CHECK(Tracked::alive.get() == 10);
+	for (uint64_t i = 0; i < 10; i++) {
+		CHECK(items[i]->value == i);
+	}
+
+	Tracked *freed = items[3];
+	allocator.free(freed);
+	// The most recently freed slot is handed out first.
+	CHECK(allocator.alloc(42) == freed);
+	CHECK(freed->value == 42);
+
+	for (Tracked *item : items) {
+		allocator.free(item);
+	}
+	CHECK(Tracked::alive.get() == 0);
+}
+
+static PagedAllocator<Tracked, true> *threaded_allocator = nullptr;
+static SafeNumeric<int> threaded_mismatches;
+
+static void use_allocator_from_thread(void *p_arg) {
+	const uint64_t base = uint64_t(uintptr_t(p_arg)) << 32;
+	Tracked *items[100];
+	for (int round = 0; round < 50; round++) {
+		for (uint64_t i = 0; i < 100; i++) {
+			items[i] = threaded_allocator->alloc(base | i);
+		}
+		for (uint64_t i = 0; i < 100; i++) {
+			if (items[i]->value != (base | i)) {
+				threaded_mismatches.increment();
+			}
+			threaded_allocator->free(items[i]);
+		}
+	}
+}
+
+TEST_CASE("[PagedAllocator] Thread caches") {
+	PagedAllocator<Tracked, true> allocator(64, true);
+	CHECK(allocator.is_thread_cache_enabled());
+	threaded_allocator = &allocator;
+	threaded_mismatches.set(0);
+	Tracked::alive.set(0);
+
+	const int thread_count = 8;
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].start(use_allocator_from_thread, (void *)uintptr_t(i + 1));
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(threaded_mismatches.get() == 0);
+	CHECK(Tracked::alive.get() == 0);
+
+	// Objects freed into a thread cache are still reusable once caching is off.
+	Tracked *item = allocator.alloc(7);
+	allocator.free(item);
+	allocator.set_thread_cache_enabled(false);
+	CHECK_FALSE(allocator.is_thread_cache_enabled());
+	item = allocator.alloc(8);
+	CHECK(item->value == 8);
+	allocator.free(item);
+
+	threaded_allocator = nullptr;
+}
+
+} // namespace TestPagedAllocator
+
+#endif // TEST_PAGED_ALLOCATOR_H
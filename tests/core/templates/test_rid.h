@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,142 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Make, get and free") {
+	// Small chunks, so growing the chunk table is covered too.
+	RID_Owner<int> owner(64);
+	LocalVector<RID> rids;
+	for (int i = 0; i < 100; i++) {
+		rids.push_back(owner.make_rid(i));
+	}
+	CHECK(owner.get_rid_count() == 100);
+
+	bool all_found = true;
+	for (int i = 0; i < 100; i++) {
+		const int *value = owner.get_or_null(rids[i]);
+		all_found = all_found && value && *value == i && owner.owns(rids[i]);
+	}
+	CHECK(all_found);
+
+	owner.free(rids[10]);
+	CHECK_FALSE(owner.owns(rids[10]));
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+
+	// The freed slot is reused, but the stale RID stays invalid.
+	const RID reused = owner.make_rid(1000);
+	CHECK(reused.get_local_index() == rids[10].get_local_index());
+	CHECK(reused != rids[10]);
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+	CHECK(*owner.get_or_null(reused) == 1000);
+
+	List<RID> owned;
+	owner.get_owned_list(&owned);
+	CHECK(owned.size() == 100);
+
+	owner.free(reused);
+	for (int i = 0; i < 100; i++) {
+		if (i != 10) {
+			owner.free(rids[i]);
+		}
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
+static const int THREADED_STABLE_RIDS = 256;
+static RID_Owner<uint64_t, true> *threaded_owner = nullptr;
+static RID threaded_stable_rids[THREADED_STABLE_RIDS];
+static SafeNumeric<int> threaded_mismatches;
+
+static void use_rids_from_thread(void *p_arg, uint32_t p_index) {
+	// Allocate and free while other threads look up long-lived RIDs,
+	// which forces the chunk table to grow under concurrent readers.
+	const RID rid = threaded_owner->make_rid(p_index);
+	const uint64_t *value = threaded_owner->get_or_null(rid);
+	if (!value || *value != p_index) {
+		threaded_mismatches.increment();
+	}
+
+	const int stable_idx = p_index % THREADED_STABLE_RIDS;
+	const uint64_t *stable_value = threaded_owner->get_or_null(threaded_stable_rids[stable_idx]);
+	if (!stable_value || *stable_value != uint64_t(stable_idx) || !threaded_owner->owns(threaded_stable_rids[stable_idx])) {
+		threaded_mismatches.increment();
+	}
+
+	if (p_index % 2) {
+		threaded_owner->free(rid);
+	}
+}
+
+TEST_CASE("[RID_Owner] Thread safe allocation and lookup") {
+	RID_Owner<uint64_t, true> owner(256);
+	threaded_owner = &owner;
+	for (int i = 0; i < THREADED_STABLE_RIDS; i++) {
+		threaded_stable_rids[i] = owner.make_rid(i);
+	}
+	threaded_mismatches.set(0);
+
+	const uint32_t task_count = 16384;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(use_rids_from_thread, nullptr, task_count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(threaded_mismatches.get() == 0);
+	CHECK(owner.get_rid_count() == THREADED_STABLE_RIDS + task_count / 2);
+
+	List<RID> owned;
+	owner.get_owned_list(&owned);
+	for (const RID &rid : owned) {
+		owner.free(rid);
+	}
+	CHECK(owner.get_rid_count() == 0);
+	threaded_owner = nullptr;
+}
+
+static const int PUBLISHED_RIDS = 1024;
+static RID published_rids[PUBLISHED_RIDS];
+
+static void initialize_or_read_rid_from_thread(void *p_arg, uint32_t p_index) {
+	// Even tasks initialize a RID while odd tasks look it up without any other synchronization.
+	const int idx = p_index / 2;
+	if (p_index % 2 == 0) {
+		threaded_owner->initialize_rid(published_rids[idx], uint64_t(idx) + 1);
+		return;
+	}
+	for (int i = 0; i < 100000; i++) {
+		const uint64_t *value = threaded_owner->get_or_null(published_rids[idx]);
+		if (value) {
+			if (*value != uint64_t(idx) + 1) {
+				threaded_mismatches.increment();
+			}
+			return;
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Initialized elements are visible to lookups on other threads") {
+	RID_Owner<uint64_t, true> owner(256);
+	threaded_owner = &owner;
+	for (int i = 0; i < PUBLISHED_RIDS; i++) {
+		published_rids[i] = owner.allocate_rid();
+	}
+	threaded_mismatches.set(0);
+
+	// Lookups of RIDs that aren't initialized yet are expected to fail.
+	ERR_PRINT_OFF;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(initialize_or_read_rid_from_thread, nullptr, PUBLISHED_RIDS * 2, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	ERR_PRINT_ON;
+
+	CHECK(threaded_mismatches.get() == 0);
+	bool all_initialized = true;
+	for (int i = 0; i < PUBLISHED_RIDS; i++) {
+		const uint64_t *value = owner.get_or_null(published_rids[i]);
+		all_initialized = all_initialized && value && *value == uint64_t(i) + 1;
+		owner.free(published_rids[i]);
+	}
+	CHECK(all_initialized);
+	CHECK(owner.get_rid_count() == 0);
+	threaded_owner = nullptr;
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
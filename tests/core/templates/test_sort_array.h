@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  test_sort_array.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SORT_ARRAY_H
+#define TEST_SORT_ARRAY_H
+
+#include "core/math/random_pcg.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/parallel_sort_array.h"
+#include "core/templates/radix_sort.h"
+#include "core/templates/sort_array.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSortArray {
+
+template <typename T, typename Comparator = _DefaultComparator<T>>
+static bool is_sorted(const LocalVector<T> &p_array, Comparator p_compare = Comparator()) {
+	for (uint32_t i = 1; i < p_array.size(); i++) {
+		if (p_compare(p_array[i], p_array[i - 1])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[SortArray] Introsort") {
+	RandomPCG rng(1234);
+	LocalVector<int> array;
+	for (int i = 0; i < 1000; i++) {
+		array.push_back(rng.rand() % 100);
+	}
+	SortArray<int> sorter;
+	sorter.sort(array.ptr(), array.size());
+	CHECK(is_sorted(array));
+}
+
+TEST_CASE("[RadixSort] Unsigned keys") {
+	RandomPCG rng(1234);
+	LocalVector<uint64_t> array;
+	for (int i = 0; i < 5000; i++) {
+		array.push_back((uint64_t(rng.rand()) << 32) | rng.rand());
+	}
+	array.push_back(0);
+	array.push_back(UINT64_MAX);
+
+	RadixSort<uint64_t> sorter;
+	sorter.sort(array.ptr(), array.size());
+	CHECK(is_sorted(array));
+	CHECK(array[0] == 0);
+	CHECK(array[array.size() - 1] == UINT64_MAX);
+
+	// Only the low byte varies, all other passes are skipped.
+	LocalVector<uint32_t> small;
+	for (uint32_t i = 0; i < 200; i++) {
+		small.push_back(0xAB000000 | ((i * 37) & 0xFF));
+	}
+	RadixSort<uint32_t> small_sorter;
+	small_sorter.sort(small.ptr(), small.size());
+	CHECK(is_sorted(small));
+}
+
+struct FloatKey {
+	_FORCE_INLINE_ uint32_t operator()(float p_value) const { return RadixSortKey::from_float(p_value); }
+};
+
+struct IntKey {
+	_FORCE_INLINE_ uint32_t operator()(int32_t p_value) const { return RadixSortKey::from_int32(p_value); }
+};
+
+TEST_CASE("[RadixSort] Float and signed keys") {
+	RandomPCG rng(1234);
+	LocalVector<float> floats;
+	LocalVector<int32_t> ints;
+	for (int i = 0; i < 3000; i++) {
+		floats.push_back(rng.random(-1000.0f, 1000.0f));
+		ints.push_back(int32_t(rng.rand()));
+	}
+	floats.push_back(-0.0f);
+	floats.push_back(0.0f);
+	floats.push_back(-INFINITY);
+	floats.push_back(INFINITY);
+
+	RadixSort<float, FloatKey> float_sorter;
+	float_sorter.sort(floats.ptr(), floats.size());
+	CHECK(is_sorted(floats));
+	CHECK(floats[0] == -INFINITY);
+	CHECK(floats[floats.size() - 1] == INFINITY);
+
+	RadixSort<int32_t, IntKey> int_sorter;
+	int_sorter.sort(ints.ptr(), ints.size());
+	CHECK(is_sorted(ints));
+}
+
+struct Item {
+	uint32_t key = 0;
+	uint32_t order = 0;
+};
+
+struct ItemKey {
+	_FORCE_INLINE_ uint32_t operator()(const Item &p_item) const { return p_item.key; }
+};
+
+TEST_CASE("[RadixSort] Stability") {
+	LocalVector<Item> items;
+	for (uint32_t i = 0; i < 1000; i++) {
+		items.push_back({ (i * 7919) % 10, i });
+	}
+	RadixSort<Item, ItemKey> sorter;
+	sorter.sort(items.ptr(), items.size());
+
+	bool stable = true;
+	for (uint32_t i = 1; i < items.size(); i++) {
+		if (items[i].key < items[i - 1].key || (items[i].key == items[i - 1].key && items[i].order < items[i - 1].order)) {
+			stable = false;
+		}
+	}
+	CHECK(stable);
+}
+
+TEST_CASE("[ParallelSortArray] Sorts across worker threads") {
+	RandomPCG rng(1234);
+	LocalVector<uint32_t> array;
+	for (int i = 0; i < 50000; i++) {
+		array.push_back(rng.rand());
+	}
+	LocalVector<uint32_t> expected = array;
+	SortArray<uint32_t> reference;
+	reference.sort(expected.ptr(), expected.size());
+
+	ParallelSortArray<uint32_t> sorter;
+	sorter.min_parallel_size = 1000;
+	sorter.sort(array.ptr(), array.size());
+	CHECK(is_sorted(array));
+	bool matches = true;
+	for (uint32_t i = 0; i < array.size(); i++) {
+		matches = matches && array[i] == expected[i];
+	}
+	CHECK(matches);
+
+	// Below the threshold it falls back to a serial sort.
+	LocalVector<uint32_t> small;
+	for (int i = 0; i < 100; i++) {
+		small.push_back(rng.rand());
+	}
+	sorter.sort(small.ptr(), small.size());
+	CHECK(is_sorted(small));
+}
+
+} // namespace TestSortArray
+
+#endif // TEST_SORT_ARRAY_H
@@ -532,6 +532,80 @@ TEST_CASE("[Vector] Operators") {
 	CHECK(vector != vector_other);
 }
 
+TEST_CASE("[Vector] Resize shared copy") {
+	Vector<int> vector;
+	vector.push_back(1);
+	vector.push_back(2);
+	vector.push_back(3);
+
+	// Growing a copy must not affect the original.
+	Vector<int> grown = vector;
+	grown.resize_zeroed(6);
+	CHECK(grown.size() == 6);
+	CHECK(grown[0] == 1);
+	CHECK(grown[2] == 3);
+	CHECK(grown[3] == 0);
+	CHECK(grown[5] == 0);
+	CHECK(vector.size() == 3);
+
+	// Same for shrinking.
+	Vector<int> shrunk = vector;
+	shrunk.resize(1);
+	CHECK(shrunk.size() == 1);
+	CHECK(shrunk[0] == 1);
+	CHECK(vector.size() == 3);
+	CHECK(vector[2] == 3);
+
+	// And for non-trivial types.
+	Vector<Vector<int>> nested;
+	nested.push_back(vector);
+	Vector<Vector<int>> nested_copy = nested;
+	nested_copy.resize(3);
+	CHECK(nested_copy[0] == vector);
+	CHECK(nested_copy[2].is_empty());
+	CHECK(nested.size() == 1);
+}
+
+TEST_CASE("[Vector] Slice view") {
+	Vector<int> vector;
+	for (int i = 0; i < 10; i++) {
+		vector.push_back(i);
+	}
+
+	VectorSlice<int> view = vector.slice_view(2, -2);
+	CHECK(view.size() == 6);
+	CHECK(view.ptr() == vector.ptr() + 2);
+	CHECK(view[0] == 2);
+	CHECK(view[5] == 7);
+	CHECK(view.find(4) == 2);
+	CHECK(view.find(9) == -1);
+
+	VectorSlice<int> narrower = view.slice(1, 3);
+	CHECK(narrower.size() == 2);
+	CHECK(narrower.ptr() == vector.ptr() + 3);
+	CHECK(narrower.to_vector() == Vector<int>({ 3, 4 }));
+
+	int sum = 0;
+	for (int value : narrower) {
+		sum += value;
+	}
+	CHECK(sum == 7);
+
+	// Writing to the source copies it, the view keeps the old contents.
+	vector.write[3] = 100;
+	CHECK(narrower[0] == 3);
+	CHECK(narrower.ptr() != vector.ptr() + 3);
+
+	CHECK(vector.slice_view(5, 5).is_empty());
+	ERR_PRINT_OFF;
+	CHECK(vector.slice_view(8, 4).is_empty());
+	ERR_PRINT_ON;
+
+	// A view covering everything converts back without copying.
+	VectorSlice<int> whole = vector.slice_view(0);
+	CHECK(whole.to_vector().ptr() == vector.ptr());
+}
+
 } // namespace TestVector
 
 #endif // TEST_VECTOR_H
@@ -31,6 +31,7 @@
 #ifndef TEST_WORKER_THREAD_POOL_H
 #define TEST_WORKER_THREAD_POOL_H
 
+#include "core/object/task_graph.h"
 #include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
@@ -107,6 +108,31 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	// Some of these tasks land on the queue of the thread blocked here, so other threads have to steal them.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, nullptr, counter.size(), WorkerThreadPool::get_singleton()->get_thread_count() * 2);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+TEST_CASE("[WorkerThreadPool] Process group tasks posted from a worker thread") {
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return; // The blocked thread would be the only one able to run them.
+	}
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 8.0f));
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, 1, 1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -173,6 +199,132 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static SafeNumeric<int> chain_step;
+static SafeNumeric<int> chain_errors;
+
+static void static_chain_first(void *p_arg) {
+	chain_step.set(1);
+}
+static void static_chain_group(void *p_arg, uint32_t p_index) {
+	if (chain_step.get() != 1) {
+		chain_errors.increment();
+	}
+	counter[p_index].increment();
+}
+static void static_chain_last(void *p_arg) {
+	for (uint32_t i = 0; i < counter.size(); i++) {
+		if (counter[i].get() != 1) {
+			chain_errors.increment();
+		}
+	}
+	chain_step.set(2);
+}
+
+TEST_CASE("[WorkerThreadPool] Chain tasks with continuations") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (int iterations = 0; iterations < 200; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 6.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		chain_step.set(0);
+		chain_errors.set(0);
+
+		WorkerThreadPool::TaskID first = pool->add_native_task(static_chain_first, nullptr, !low_priority);
+		WorkerThreadPool::GroupID group = pool->add_native_group_task_after(static_chain_group, nullptr, count, { first }, -1, !low_priority);
+		WorkerThreadPool::TaskID last = pool->add_native_task_after(static_chain_last, nullptr, { group, first }, !low_priority);
+
+		pool->wait_for_task_completion(last);
+		CHECK(chain_step.get() == 2);
+		CHECK(chain_errors.get() == 0);
+
+		pool->wait_for_group_task_completion(group);
+		pool->wait_for_task_completion(first);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Continuations of completed tasks run right away") {
+	chain_step.set(0);
+	WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_chain_first, nullptr, true);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+	CHECK(chain_step.get() == 1);
+
+	counter.clear();
+	WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_task_after(static_chain_last, nullptr, { first }, true);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+	CHECK(chain_step.get() == 2);
+}
+
+static SafeFlag gate_open;
+
+static void static_wait_for_gate(void *p_arg) {
+	while (!gate_open.is_set()) {
+		OS::get_singleton()->delay_usec(1);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Promote a queued low priority task") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	gate_open.clear();
+
+	// Keep every low priority slot busy, with some more waiting for one.
+	LocalVector<WorkerThreadPool::TaskID> blockers;
+	for (int i = 0; i < pool->get_thread_count(); i++) {
+		blockers.push_back(pool->add_native_task(static_wait_for_gate, nullptr, false));
+	}
+
+	counter.clear();
+	counter.resize(1);
+	WorkerThreadPool::TaskID task_id = pool->add_native_task(static_test, (void *)0, false);
+	CHECK(pool->set_task_priority(task_id, true));
+
+	// High priority work has threads of its own, so this doesn't need the blockers to finish.
+	uint64_t waited_usec = 0;
+	while (!pool->is_task_completed(task_id) && waited_usec < 5000000) {
+		OS::get_singleton()->delay_usec(100);
+		waited_usec += 100;
+	}
+	CHECK(pool->is_task_completed(task_id));
+	CHECK(counter[0].get() == 3);
+
+	gate_open.set();
+	pool->wait_for_task_completion(task_id);
+	for (WorkerThreadPool::TaskID blocker : blockers) {
+		pool->wait_for_task_completion(blocker);
+	}
+}
+
+TEST_CASE("[TaskGraph] Run a graph several times") {
+	Ref<TaskGraph> graph;
+	graph.instantiate();
+
+	const int count = 64;
+	const int first = graph->add_native_task(static_chain_first, nullptr, Vector<int>(), true);
+	const int group = graph->add_native_group_task(static_chain_group, nullptr, count, { first }, -1, true);
+	graph->add_native_task(static_chain_last, nullptr, { group }, true);
+	CHECK(graph->get_task_count() == 3);
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(graph->add_native_task(static_chain_first, nullptr, { 3 }) == -1, "Dependencies must be tasks added before.");
+	ERR_PRINT_ON;
+
+	for (int iterations = 0; iterations < 10; iterations++) {
+		counter.clear();
+		counter.resize(count);
+		chain_step.set(0);
+		chain_errors.set(0);
+
+		graph->submit();
+		CHECK(graph->is_submitted());
+		graph->wait();
+		CHECK_FALSE(graph->is_submitted());
+
+		CHECK(chain_step.get() == 2);
+		CHECK(chain_errors.get() == 0);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
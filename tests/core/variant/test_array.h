@@ -634,6 +634,35 @@ TEST_CASE("[Array] Typed copying") {
 	a6.clear();
 }
 
+TEST_CASE("[Array] Typed writes") {
+	TypedArray<double> arr;
+	arr.push_back(1.5);
+	arr.push_back(2);
+	arr.insert(0, 3);
+	arr.append_array(arr.duplicate());
+
+	CHECK(arr.size() == 6);
+	for (int i = 0; i < arr.size(); i++) {
+		CHECK(arr[i].get_type() == Variant::FLOAT);
+	}
+	CHECK(double(arr[0]) == 3.0);
+	CHECK(double(arr[4]) == 1.5);
+
+	arr.set(1, 4);
+	CHECK(arr[1].get_type() == Variant::FLOAT);
+	CHECK(double(arr[1]) == 4.0);
+
+	ERR_PRINT_OFF;
+	arr.set(2, "string");
+	arr.push_back(Vector3());
+	ERR_PRINT_ON;
+	CHECK(arr.size() == 6);
+	CHECK(double(arr[2]) == 2.0);
+
+	arr.fill(7);
+	CHECK(arr[5].get_type() == Variant::FLOAT);
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
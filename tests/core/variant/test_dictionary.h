@@ -537,6 +537,31 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order is kept across erasures") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i * 2;
+	}
+	for (int i = 0; i < 90; i++) {
+		d.erase(i);
+	}
+	d[1000] = true;
+	d[5] = 10;
+
+	CHECK(d.size() == 12);
+	CHECK(d.get_key_at_index(0) == Variant(90));
+	CHECK(d.get_value_at_index(9) == Variant(198));
+	CHECK(d.get_key_at_index(10) == Variant(1000));
+	CHECK(d.get_key_at_index(11) == Variant(5));
+	CHECK(d.get_key_at_index(12).get_type() == Variant::NIL);
+
+	int count = 0;
+	for (const Variant *key = d.next(); key; key = d.next(key)) {
+		count++;
+	}
+	CHECK(count == d.size());
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
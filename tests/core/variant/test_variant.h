@@ -35,6 +35,7 @@
 #include "core/variant/variant_parser.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestVariant {
 
@@ -1806,6 +1807,60 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+static void _check_tokens(VariantParser::Stream *p_stream, const String &p_long_string, const String &p_long_identifier) {
+	VariantParser::Token token;
+	String errs;
+	int line = 1;
+
+	REQUIRE(VariantParser::get_token(p_stream, token, line, errs) == OK);
+	CHECK(token.type == VariantParser::TK_STRING);
+	CHECK(String(token.value) == p_long_string);
+	CHECK(line == 2);
+
+	REQUIRE(VariantParser::get_token(p_stream, token, line, errs) == OK);
+	CHECK(token.type == VariantParser::TK_IDENTIFIER);
+	CHECK(String(token.value) == p_long_identifier);
+
+	REQUIRE(VariantParser::get_token(p_stream, token, line, errs) == OK);
+	CHECK(token.type == VariantParser::TK_STRING_NAME);
+	CHECK(StringName(token.value) == StringName(String::utf8("héllo \"world\"")));
+
+	REQUIRE(VariantParser::get_token(p_stream, token, line, errs) == OK);
+	CHECK(token.type == VariantParser::TK_NUMBER);
+	CHECK(double(token.value) == doctest::Approx(-1.5e3));
+	CHECK_MESSAGE(line == 3, "The comment should be skipped up to its line break.");
+
+	REQUIRE(VariantParser::get_token(p_stream, token, line, errs) == OK);
+	CHECK(token.type == VariantParser::TK_EOF);
+}
+
+TEST_CASE("[Variant] Parser tokens longer than the stream readahead") {
+	// Long enough to cross the readahead buffer of the stream several times.
+	String long_string;
+	String long_identifier;
+	for (int i = 0; i < 1000; i++) {
+		long_string += "line " + itos(i) + String::utf8(", café \\ ");
+		long_identifier += "id_" + itos(i);
+	}
+	long_string += "\n";
+	const String source = "\"" + long_string.c_escape_multiline() + "\" " + long_identifier + String::utf8(" &\"héllo \\\"world\\\"\"; A comment.\n-1.5e3");
+
+	VariantParser::StreamString ss;
+	ss.s = source;
+	_check_tokens(&ss, long_string, long_identifier);
+
+	const String path = TestUtils::get_temp_path("variant_parser_tokens.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(source);
+	}
+	VariantParser::StreamFile sf;
+	sf.f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(sf.f.is_valid());
+	_check_tokens(&sf, long_string, long_identifier);
+}
+
 TEST_CASE("[Variant] Writer recursive dictionary") {
 	// There is no way to accurately represent a recursive dictionary,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  test_compressed_texture.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_COMPRESSED_TEXTURE_H
+#define TEST_COMPRESSED_TEXTURE_H
+
+#include "core/config/project_settings.h"
+#include "core/io/image.h"
+#include "core/os/os.h"
+#include "scene/resources/compressed_texture.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestCompressedTexture2D {
+
+static Ref<Image> _create_mipmapped_image() {
+	Ref<Image> image = memnew(Image(64, 32, false, Image::FORMAT_RGBA8));
+	for (int y = 0; y < 32; y++) {
+		for (int x = 0; x < 64; x++) {
+			image->set_pixel(x, y, Color((x * 7 % 64) / 64.0, (y * 13 % 32) / 32.0, ((x + y) % 5) / 5.0));
+		}
+	}
+	image->generate_mipmaps();
+	return image;
+}
+
+static void _save_ctex(const String &p_path, const Ref<Image> &p_image, bool p_stream) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_buffer((const uint8_t *)"GST2", 4);
+	f->store_32(CompressedTexture2D::FORMAT_VERSION);
+	f->store_32(p_image->get_width());
+	f->store_32(p_image->get_height());
+	f->store_32(CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS | (p_stream ? CompressedTexture2D::FORMAT_BIT_STREAM : 0));
+	for (int i = 0; i < 4; i++) {
+		f->store_32(0); // Mipmap limit and reserved.
+	}
+
+	f->store_32(CompressedTexture2D::DATA_FORMAT_IMAGE);
+	f->store_16(p_image->get_width());
+	f->store_16(p_image->get_height());
+	f->store_32(p_image->get_mipmap_count());
+	f->store_32(p_image->get_format());
+	f->store_buffer(p_image->get_data());
+}
+
+TEST_CASE("[CompressedTexture2D] Load only the mipmaps within a size limit") {
+	Ref<Image> image = _create_mipmapped_image();
+	const String path = TestUtils::get_temp_path("size_limit.ctex");
+	_save_ctex(path, image, true);
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(36);
+	Ref<Image> limited = CompressedTexture2D::load_image_from_file(f, 16);
+	REQUIRE(limited.is_valid());
+	CHECK(limited->get_width() == 16);
+	CHECK(limited->get_height() == 8);
+	CHECK(limited->has_mipmaps());
+	CHECK(limited->get_data() == image->get_data().slice(image->get_mipmap_offset(2)));
+
+	f->seek(36);
+	Ref<Image> full = CompressedTexture2D::load_image_from_file(f, 0);
+	REQUIRE(full.is_valid());
+	CHECK(full->get_data() == image->get_data());
+
+	// The smallest mipmap is always loaded.
+	f->seek(36);
+	Ref<Image> smallest = CompressedTexture2D::load_image_from_file(f, 1);
+	REQUIRE(smallest.is_valid());
+	CHECK(smallest->get_width() == 1);
+	CHECK(smallest->get_height() == 1);
+}
+
+static void _wait_for_resident_mipmap(const Ref<CompressedTexture2D> &p_texture, int p_mipmap) {
+	for (int i = 0; i < 5000 && p_texture->get_resident_mipmap() != p_mipmap; i++) {
+		CompressedTexture2D::update_streaming();
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK(p_texture->get_resident_mipmap() == p_mipmap);
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Stream mipmaps on demand") {
+	Ref<Image> image = _create_mipmapped_image();
+	const String path = TestUtils::get_temp_path("streamed.ctex");
+	_save_ctex(path, image, true);
+	const String plain_path = TestUtils::get_temp_path("not_streamed.ctex");
+	_save_ctex(plain_path, image, false);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/resident_size", 8);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/vram_budget_mb", 0);
+	const uint64_t used_bytes = CompressedTexture2D::get_streaming_used_bytes();
+
+	Ref<CompressedTexture2D> plain;
+	plain.instantiate();
+	REQUIRE(plain->load(plain_path) == OK);
+	CHECK_FALSE(plain->is_streamed());
+	CHECK(plain->get_image()->get_width() == 64);
+
+	{
+		Ref<CompressedTexture2D> texture;
+		texture.instantiate();
+		REQUIRE(texture->load(path) == OK);
+		CHECK(texture->is_streamed());
+		CHECK(texture->get_resident_mipmap() == 3);
+		CHECK(texture->get_width() == 64);
+		CHECK(texture->get_height() == 32);
+		CHECK(texture->get_image()->get_width() == 8);
+		CHECK(CompressedTexture2D::get_streaming_used_bytes() == used_bytes + Image::get_image_data_size(8, 4, Image::FORMAT_RGBA8, true));
+
+		// Until anything is requested, streamed textures load up to their full size.
+		_wait_for_resident_mipmap(texture, 0);
+		CHECK(texture->get_image()->get_data() == image->get_data());
+
+		// 16 pixels need the 16x8 mipmap.
+		texture->request_stream_screen_size(16);
+		_wait_for_resident_mipmap(texture, 2);
+		CHECK(texture->get_image()->get_width() == 16);
+		CHECK(CompressedTexture2D::get_streaming_used_bytes() == used_bytes + Image::get_image_data_size(16, 8, Image::FORMAT_RGBA8, true));
+
+		// Requests made during the same frame keep the largest size.
+		texture->request_stream_screen_size(1);
+		CompressedTexture2D::update_streaming();
+		CHECK(texture->get_resident_mipmap() == 2);
+	}
+	CHECK(CompressedTexture2D::get_streaming_used_bytes() == used_bytes);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+}
+
+} // namespace TestCompressedTexture2D
+
+#endif // TEST_COMPRESSED_TEXTURE_H
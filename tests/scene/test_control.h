@@ -31,12 +31,27 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "scene/gui/box_container.h"
 #include "scene/gui/control.h"
 
 #include "tests/test_macros.h"
 
 namespace TestControl {
 
+class SortCountingVBoxContainer : public VBoxContainer {
+	GDCLASS(SortCountingVBoxContainer, VBoxContainer);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_SORT_CHILDREN) {
+			sort_count++;
+		}
+	}
+
+public:
+	int sort_count = 0;
+};
+
 TEST_CASE("[SceneTree][Control]") {
 	SUBCASE("[Control][Global Transform] Global Transform should be accessible while not in SceneTree.") { // GH-79453
 		Control *test_node = memnew(Control);
@@ -61,6 +76,36 @@ TEST_CASE("[SceneTree][Control]") {
 	}
 }
 
+TEST_CASE("[SceneTree][Container] Nested containers sort once per change") {
+	const int depth = 6;
+	SortCountingVBoxContainer *boxes[depth];
+	for (int i = 0; i < depth; i++) {
+		boxes[i] = memnew(SortCountingVBoxContainer);
+		if (i > 0) {
+			boxes[i - 1]->add_child(boxes[i]);
+		}
+	}
+	Control *leaf = memnew(Control);
+	boxes[depth - 1]->add_child(leaf);
+	SceneTree::get_singleton()->get_root()->add_child(boxes[0]);
+	MessageQueue::get_singleton()->flush();
+
+	for (int i = 0; i < depth; i++) {
+		boxes[i]->sort_count = 0;
+	}
+
+	leaf->set_custom_minimum_size(Size2(100, 50));
+	MessageQueue::get_singleton()->flush();
+
+	for (int i = 0; i < depth; i++) {
+		CHECK_MESSAGE(boxes[i]->sort_count == 1, vformat("Container at depth %d should sort exactly once.", i));
+		CHECK(boxes[i]->get_size() == Size2(100, 50));
+	}
+	CHECK(leaf->get_size() == Size2(100, 50));
+
+	memdelete(boxes[0]);
+}
+
 } // namespace TestControl
 
 #endif // TEST_CONTROL_H
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  test_font_file.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FONT_FILE_H
+#define TEST_FONT_FILE_H
+
+#ifdef TOOLS_ENABLED
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/object/message_queue.h"
+#include "editor/themes/builtin_fonts.gen.h"
+#include "scene/resources/font.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFontFile {
+
+TEST_CASE("[FontFile] Persistent glyph cache round trip") {
+	ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", true);
+	DirAccess::make_dir_recursive_absolute(OS::get_singleton()->get_user_data_dir());
+
+	const Vector2i size = Vector2i(16, 0);
+	Ref<FontFile> font;
+	font.instantiate();
+	font->set_data_ptr(_font_NotoSans_Regular, _font_NotoSans_Regular_size);
+	MessageQueue::get_singleton()->flush();
+
+	const int32_t glyph = font->get_glyph_index(size.x, 'A');
+	font->render_glyph(0, size, glyph);
+	FontFile::save_glyph_cache();
+
+	// The rendered glyph is saved.
+	Ref<FileAccess> f = FileAccess::open("user://font_glyph_cache.bin", FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_32() == 1);
+	const Dictionary saved = f->get_var();
+	f.unref();
+	bool found = false;
+	for (const Variant &key : saved.keys()) {
+		const Dictionary font_glyphs = saved[key];
+		const Dictionary cache_glyphs = font_glyphs.get(0, Dictionary());
+		const PackedInt32Array glyphs = cache_glyphs.get(size, PackedInt32Array());
+		found = found || glyphs.has(glyph);
+	}
+	CHECK_MESSAGE(found, "The rendered glyph should be saved.");
+
+	// Another font with the same data renders it in the background.
+	Ref<FontFile> other;
+	other.instantiate();
+	other->set_data_ptr(_font_NotoSans_Regular, _font_NotoSans_Regular_size);
+	MessageQueue::get_singleton()->flush();
+	bool prerendered = false;
+	for (int i = 0; i < 5000 && !prerendered; i++) {
+		prerendered = other->get_glyph_list(0, size).has(glyph);
+		if (!prerendered) {
+			OS::get_singleton()->delay_usec(1000);
+		}
+	}
+	CHECK_MESSAGE(prerendered, "The saved glyph should be prerendered.");
+
+	// Changing the data or the caches waits for the prerender task.
+	other->set_data_ptr(_font_NotoSans_Regular, _font_NotoSans_Regular_size);
+	MessageQueue::get_singleton()->flush();
+	other->clear_cache();
+	CHECK(other->get_cache_count() == 0);
+
+	font.unref();
+	other.unref();
+	Ref<DirAccess> da = DirAccess::open("user://");
+	if (da.is_valid()) {
+		da->remove("font_glyph_cache.bin");
+	}
+	ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", false);
+}
+
+} // namespace TestFontFile
+
+#endif // TOOLS_ENABLED
+
+#endif // TEST_FONT_FILE_H
@@ -92,6 +92,14 @@ public:
 
 	List<Node *> *callback_list = nullptr;
 
+	int batch_counter = 0;
+	Array batch_nodes;
+
+	void process_batch(const Array &p_nodes, double p_delta) {
+		batch_counter++;
+		batch_nodes = p_nodes;
+	}
+
 	void set_exported_node(Node *p_node) { exported_node = p_node; }
 	Node *get_exported_node() const { return exported_node; }
 
@@ -892,6 +900,186 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Repeated path lookups follow tree changes") {
+	Node *node = memnew(Node);
+	Node *child = memnew(Node);
+	Node *grandchild = memnew(Node);
+	child->set_name("Child");
+	grandchild->set_name("Grandchild");
+	node->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	const NodePath path("Child/Grandchild");
+	CHECK_EQ(node->get_node_or_null(path), grandchild);
+	CHECK_EQ(node->get_node_or_null(path), grandchild);
+
+	SUBCASE("Renaming") {
+		grandchild->set_name("Renamed");
+		CHECK_EQ(node->get_node_or_null(path), nullptr);
+		CHECK_EQ(node->get_node_or_null(NodePath("Child/Renamed")), grandchild);
+
+		grandchild->set_name("Grandchild");
+		CHECK_EQ(node->get_node_or_null(path), grandchild);
+	}
+
+	SUBCASE("Removing and replacing") {
+		child->remove_child(grandchild);
+		CHECK_EQ(node->get_node_or_null(path), nullptr);
+
+		Node *replacement = memnew(Node);
+		replacement->set_name("Grandchild");
+		child->add_child(replacement);
+		CHECK_EQ(node->get_node_or_null(path), replacement);
+
+		memdelete(grandchild);
+	}
+
+	SUBCASE("Deleting") {
+		memdelete(grandchild);
+		CHECK_EQ(node->get_node_or_null(path), nullptr);
+	}
+
+	SUBCASE("Unique names") {
+		child->set_owner(node);
+		grandchild->set_owner(node);
+		grandchild->set_unique_name_in_owner(true);
+		const NodePath unique_path("Child/%Grandchild");
+		CHECK_EQ(node->get_node_or_null(unique_path), grandchild);
+
+		grandchild->set_unique_name_in_owner(false);
+		CHECK_EQ(node->get_node_or_null(unique_path), nullptr);
+	}
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Node] Group calls through process thread groups") {
+	Node *node = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	node->add_to_group("thread_group_call");
+
+	SceneTree::get_singleton()->set_group_flags(SceneTree::GROUP_CALL_THREAD_GROUP, "thread_group_call", "process_priority", 3);
+	SceneTree::get_singleton()->call_group_flags(SceneTree::GROUP_CALL_THREAD_GROUP, "thread_group_call", "set_name", "Called");
+	CHECK_EQ(node->get_process_priority(), 0);
+	CHECK_NE(node->get_name(), StringName("Called"));
+
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(node->get_process_priority(), 3);
+	CHECK_EQ(node->get_name(), StringName("Called"));
+
+	memdelete(node);
+}
+
+TEST_CASE("[Node] Removing many children keeps order and indices") {
+	Node *parent = memnew(Node);
+	Node *internal_front = memnew(Node);
+	Node *internal_back = memnew(Node);
+	parent->add_child(internal_front, false, Node::INTERNAL_MODE_FRONT);
+	parent->add_child(internal_back, false, Node::INTERNAL_MODE_BACK);
+
+	LocalVector<Node *> children;
+	for (int i = 0; i < 10; i++) {
+		Node *child = memnew(Node);
+		parent->add_child(child);
+		children.push_back(child);
+	}
+	CHECK_EQ(parent->get_child_count(), 10);
+
+	// Remove every other child without reading the children in between.
+	for (int i = 0; i < 10; i += 2) {
+		parent->remove_child(children[i]);
+		memdelete(children[i]);
+	}
+
+	CHECK_EQ(parent->get_child_count(), 5);
+	CHECK_EQ(parent->get_child_count(true), 7);
+	for (int i = 0; i < 5; i++) {
+		CHECK_EQ(parent->get_child(i), children[i * 2 + 1]);
+		CHECK_EQ(children[i * 2 + 1]->get_index(), i);
+	}
+	CHECK_EQ(parent->get_child(0, true), internal_front);
+	CHECK_EQ(parent->get_child(-1, true), internal_back);
+	CHECK_EQ(internal_back->get_index(true), 6);
+
+	SUBCASE("Adding after removing") {
+		parent->remove_child(children[9]);
+		memdelete(children[9]);
+		Node *added = memnew(Node);
+		parent->add_child(added);
+		CHECK_EQ(parent->get_child_count(), 5);
+		CHECK_EQ(parent->get_child(4), added);
+		CHECK_EQ(added->get_index(), 4);
+	}
+
+	SUBCASE("Moving after removing") {
+		parent->remove_child(children[1]);
+		memdelete(children[1]);
+		parent->move_child(children[9], 0);
+		CHECK_EQ(parent->get_child(0), children[9]);
+		CHECK_EQ(parent->get_child(1), children[3]);
+		CHECK_EQ(children[7]->get_index(), 3);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Test process batches") {
+	TestNode *receiver = memnew(TestNode);
+	TestNode *node1 = memnew(TestNode);
+	TestNode *node2 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(receiver);
+	SceneTree::get_singleton()->get_root()->add_child(node1);
+	SceneTree::get_singleton()->get_root()->add_child(node2);
+	node1->add_to_group("batch");
+	node2->add_to_group("batch");
+
+	Callable callback = callable_mp(receiver, &TestNode::process_batch);
+
+	SUBCASE("Process batch receives the whole group") {
+		SceneTree::get_singleton()->add_process_batch("batch", callback);
+		CHECK(SceneTree::get_singleton()->has_process_batch("batch", callback));
+		CHECK_FALSE(SceneTree::get_singleton()->has_process_batch("batch", callback, true));
+
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(1, receiver->batch_counter);
+		CHECK_EQ(2, receiver->batch_nodes.size());
+		CHECK(receiver->batch_nodes.has(node1));
+		CHECK(receiver->batch_nodes.has(node2));
+
+		node2->set_process_mode(Node::PROCESS_MODE_DISABLED);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(2, receiver->batch_counter);
+		CHECK_EQ(1, receiver->batch_nodes.size());
+
+		SceneTree::get_singleton()->remove_process_batch("batch", callback);
+		CHECK_FALSE(SceneTree::get_singleton()->has_process_batch("batch", callback));
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(2, receiver->batch_counter);
+	}
+
+	SUBCASE("Physics process batch") {
+		SceneTree::get_singleton()->add_process_batch("batch", callback, true);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(0, receiver->batch_counter);
+
+		SceneTree::get_singleton()->physics_process(0);
+		CHECK_EQ(1, receiver->batch_counter);
+		CHECK_EQ(2, receiver->batch_nodes.size());
+
+		SceneTree::get_singleton()->remove_process_batch("batch", callback, true);
+	}
+
+	memdelete(node2);
+	memdelete(node1);
+	memdelete(receiver);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notified_count++;
+			notified_transform = get_global_transform();
+		}
+	}
+
+public:
+	int notified_count = 0;
+	Transform3D notified_transform;
+
+	using Node3D::set_ignore_transform_notification;
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform propagation") {
+	Node3D *root = memnew(Node3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+	root->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	child->notified_count = 0;
+	grandchild->notified_count = 0;
+
+	SUBCASE("Moving a hierarchy several times notifies each node once") {
+		root->set_position(Vector3(1, 0, 0));
+		child->set_position(Vector3(0, 1, 0));
+		root->set_position(Vector3(2, 0, 0));
+		grandchild->set_position(Vector3(0, 0, 1));
+		root->set_position(Vector3(3, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(child->notified_count, 1);
+		CHECK_EQ(grandchild->notified_count, 1);
+		CHECK(child->notified_transform.origin.is_equal_approx(Vector3(3, 1, 0)));
+		CHECK(grandchild->notified_transform.origin.is_equal_approx(Vector3(3, 1, 1)));
+
+		root->set_position(Vector3(4, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(child->notified_count, 2);
+		CHECK_EQ(grandchild->notified_count, 2);
+		CHECK(grandchild->notified_transform.origin.is_equal_approx(Vector3(4, 1, 1)));
+	}
+
+	SUBCASE("Reading global transforms between changes keeps them up to date") {
+		root->set_position(Vector3(1, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 0, 0)));
+		root->set_position(Vector3(2, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 0, 0)));
+		CHECK(child->get_global_position().is_equal_approx(Vector3(2, 0, 0)));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(child->notified_count, 1);
+		CHECK_EQ(grandchild->notified_count, 1);
+	}
+
+	SUBCASE("Nodes added or starting to listen after a change are still notified") {
+		TransformNotifiedNode3D *added = memnew(TransformNotifiedNode3D);
+		root->set_position(Vector3(1, 0, 0));
+		grandchild->add_child(added);
+		grandchild->set_notify_transform(false);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		added->notified_count = 0;
+		grandchild->notified_count = 0;
+
+		root->set_position(Vector3(2, 0, 0));
+		grandchild->set_notify_transform(true);
+		root->set_position(Vector3(3, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(added->notified_count, 1);
+		CHECK_EQ(grandchild->notified_count, 1);
+		CHECK(added->notified_transform.origin.is_equal_approx(Vector3(3, 0, 0)));
+	}
+
+	SUBCASE("Ignored notifications are delivered by later changes") {
+		grandchild->set_ignore_transform_notification(true);
+		grandchild->set_position(Vector3(0, 0, 1));
+		grandchild->set_ignore_transform_notification(false);
+		root->set_position(Vector3(1, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK_EQ(grandchild->notified_count, 1);
+		CHECK(grandchild->notified_transform.origin.is_equal_approx(Vector3(1, 0, 1)));
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -31,6 +31,8 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
+#include "scene/main/timer.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +152,59 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+	scene->set_meta("tag", "root");
+
+	Timer *timer = memnew(Timer);
+	timer->set_name("Timer");
+	timer->set_wait_time(2.5);
+	timer->set_one_shot(true);
+	scene->add_child(timer);
+	timer->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Every instance gets the same properties, whichever way they are set.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_process_priority() == 3);
+		CHECK(String(instance->get_meta("tag")) == "root");
+
+		Timer *timer_instance = Object::cast_to<Timer>(instance->get_node_or_null(NodePath("Timer")));
+		REQUIRE(timer_instance != nullptr);
+		CHECK(timer_instance->get_wait_time() == doctest::Approx(2.5));
+		CHECK(timer_instance->is_one_shot());
+		CHECK(timer_instance->get_owner() == instance);
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse what was resolved for the previous state.
+	timer->set_wait_time(4.0);
+	Node2D *node_2d = memnew(Node2D);
+	node_2d->set_name("Node2D");
+	node_2d->set_position(Vector2(1, 2));
+	scene->add_child(node_2d);
+	node_2d->set_owner(scene);
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(Object::cast_to<Timer>(instance->get_node(NodePath("Timer")))->get_wait_time() == doctest::Approx(4.0));
+	Node2D *node_2d_instance = Object::cast_to<Node2D>(instance->get_node_or_null(NodePath("Node2D")));
+	REQUIRE(node_2d_instance != nullptr);
+	CHECK(node_2d_instance->get_position() == Vector2(1, 2));
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
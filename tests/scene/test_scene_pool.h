@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_POOL_H
+#define TEST_SCENE_POOL_H
+
+#include "scene/main/window.h"
+#include "scene/resources/scene_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+static Ref<PackedScene> _create_scene() {
+	Node *scene = memnew(Node);
+	scene->set_name("Pooled");
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneTree][ScenePool] Released instances are recycled") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_scene());
+
+	Node *node = pool->acquire();
+	REQUIRE(node != nullptr);
+	CHECK(node->get_name() == "Pooled");
+	CHECK(node->get_child_count() == 1);
+
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	const ObjectID id = node->get_instance_id();
+	pool->release(node);
+	CHECK(node->get_parent() == nullptr);
+	CHECK(pool->get_available_count() == 1);
+
+	ERR_PRINT_OFF;
+	pool->release(node);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(pool->get_available_count() == 1, "Releasing twice should be rejected.");
+
+	Node *recycled = pool->acquire();
+	CHECK(recycled->get_instance_id() == id);
+	CHECK(pool->get_available_count() == 0);
+
+	Node *foreign = memnew(Node);
+	ERR_PRINT_OFF;
+	pool->release(foreign);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(pool->get_available_count() == 0, "Nodes from elsewhere should be rejected.");
+	memdelete(foreign);
+
+	pool->release(recycled);
+}
+
+TEST_CASE("[ScenePool] Prewarm and limit") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_scene());
+	pool->set_max_available(4);
+
+	pool->prewarm(8);
+	CHECK(pool->get_available_count() == 4);
+
+	Node *nodes[5];
+	for (int i = 0; i < 5; i++) {
+		nodes[i] = pool->acquire();
+		REQUIRE(nodes[i] != nullptr);
+	}
+	CHECK(pool->get_available_count() == 0);
+	for (int i = 0; i < 5; i++) {
+		pool->release(nodes[i]);
+	}
+	CHECK_MESSAGE(pool->get_available_count() == 4, "Instances beyond the limit should be freed.");
+
+	// Instances freed while waiting to be recycled are skipped.
+	Node *freed = pool->acquire();
+	pool->release(freed);
+	memdelete(freed);
+	Node *node = pool->acquire();
+	REQUIRE(node != nullptr);
+	CHECK(pool->get_available_count() == 2);
+	pool->release(node);
+
+	pool->set_max_available(1);
+	CHECK(pool->get_available_count() == 1);
+
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+}
+
+} // namespace TestScenePool
+
+#endif // TEST_SCENE_POOL_H
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  test_streamed_mesh.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STREAMED_MESH_H
+#define TEST_STREAMED_MESH_H
+
+#include "scene/resources/3d/importer_mesh.h"
+#include "scene/resources/3d/streamed_mesh.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestStreamedMesh {
+
+static Array _create_level(int p_vertex_count) {
+	PackedVector3Array vertices;
+	for (int i = 0; i < p_vertex_count; i++) {
+		vertices.push_back(Vector3(i, i * 2, i * 3));
+	}
+	Dictionary surface;
+	surface["format"] = int64_t(Mesh::ARRAY_FORMAT_VERTEX);
+	surface["primitive"] = int64_t(Mesh::PRIMITIVE_POINTS);
+	surface["vertex_data"] = vertices.to_byte_array();
+	surface["vertex_count"] = p_vertex_count;
+	surface["name"] = vformat("Level with %d vertices", p_vertex_count);
+	surface["material"] = Variant(); // Must not be stored.
+	Array surfaces;
+	surfaces.push_back(surface);
+	return surfaces;
+}
+
+TEST_CASE("[MeshLODChunks] Levels are stored separately") {
+	Ref<MeshLODChunks> lod_chunks;
+	lod_chunks.instantiate();
+	lod_chunks->add_level(_create_level(64), 0.0);
+	lod_chunks->add_level(_create_level(16), 0.5);
+	lod_chunks->add_level(_create_level(4), 2.0);
+
+	CHECK(lod_chunks->get_level_count() == 3);
+	CHECK(lod_chunks->get_level_edge_length(0) == doctest::Approx(0.0));
+	CHECK(lod_chunks->get_level_edge_length(2) == doctest::Approx(2.0));
+
+	Array surfaces = lod_chunks->get_level_surfaces(1);
+	REQUIRE(surfaces.size() == 1);
+	Dictionary surface = surfaces[0];
+	CHECK(int(surface["vertex_count"]) == 16);
+	CHECK(String(surface["name"]) == "Level with 16 vertices");
+	CHECK_FALSE(surface.has("material"));
+
+	ERR_PRINT_OFF;
+	lod_chunks->add_level(_create_level(8), 1.0);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(lod_chunks->get_level_count() == 3, "Levels finer than the last one should be rejected.");
+
+	lod_chunks->clear();
+	CHECK(lod_chunks->get_level_count() == 0);
+}
+
+TEST_CASE("[MeshLODChunks] Levels are read from the file on demand") {
+	Ref<MeshLODChunks> lod_chunks;
+	lod_chunks.instantiate();
+	lod_chunks->add_level(_create_level(64), 0.0);
+	lod_chunks->add_level(_create_level(4), 1.5);
+
+	const String path = TestUtils::get_temp_path("streamed_mesh.meshlod");
+	REQUIRE(lod_chunks->save(path) == OK);
+
+	Ref<MeshLODChunks> loaded;
+	loaded.instantiate();
+	REQUIRE(loaded->load(path) == OK);
+	CHECK(loaded->get_level_count() == 2);
+	CHECK(loaded->get_level_edge_length(1) == doctest::Approx(1.5));
+
+	// Levels can be read in any order, and more than once.
+	for (int i = 0; i < 2; i++) {
+		Array coarse = loaded->get_level_surfaces(1);
+		REQUIRE(coarse.size() == 1);
+		CHECK(int(Dictionary(coarse[0])["vertex_count"]) == 4);
+		Array fine = loaded->get_level_surfaces(0);
+		REQUIRE(fine.size() == 1);
+		PackedByteArray vertex_data = Dictionary(fine[0])["vertex_data"];
+		CHECK(vertex_data == PackedByteArray(Dictionary(lod_chunks->get_level_surfaces(0)[0])["vertex_data"]));
+	}
+
+	// Saving loaded chunks copies the levels without decoding them.
+	const String copy_path = TestUtils::get_temp_path("streamed_mesh_copy.meshlod");
+	REQUIRE(loaded->save(copy_path) == OK);
+	Ref<MeshLODChunks> copy;
+	copy.instantiate();
+	REQUIRE(copy->load(copy_path) == OK);
+	CHECK(int(Dictionary(copy->get_level_surfaces(0)[0])["vertex_count"]) == 64);
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_buffer((const uint8_t *)"GDML", 4);
+	f->close();
+	ERR_PRINT_OFF;
+	CHECK(loaded->load(path) != OK);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[SceneTree][StreamedMesh] Surfaces are switched between levels") {
+	Ref<ImporterMesh> importer_mesh;
+	importer_mesh.instantiate();
+
+	// A grid, so that LOD generation has something to simplify.
+	const int size = 16;
+	PackedVector3Array vertices;
+	PackedVector3Array normals;
+	PackedInt32Array indices;
+	for (int y = 0; y <= size; y++) {
+		for (int x = 0; x <= size; x++) {
+			vertices.push_back(Vector3(x, 0, y));
+			normals.push_back(Vector3(0, 1, 0));
+		}
+	}
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			const int i = y * (size + 1) + x;
+			indices.append_array({ i, i + 1, i + size + 1, i + 1, i + size + 2, i + size + 1 });
+		}
+	}
+	Array arrays;
+	arrays.resize(Mesh::ARRAY_MAX);
+	arrays[Mesh::ARRAY_VERTEX] = vertices;
+	arrays[Mesh::ARRAY_NORMAL] = normals;
+	arrays[Mesh::ARRAY_INDEX] = indices;
+	Dictionary lods;
+	lods[1.0] = PackedInt32Array({ 0, size, (size + 1) * (size + 1) - 1 });
+	importer_mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, arrays, TypedArray<Array>(), lods, Ref<Material>(), "Grid");
+
+	Ref<StreamedMesh> mesh = importer_mesh->get_streamed_mesh(1);
+	REQUIRE(mesh.is_valid());
+	REQUIRE(mesh->get_lod_chunks().is_valid());
+	CHECK(mesh->get_lod_chunks()->get_level_count() == 2);
+	CHECK(mesh->get_resident_level() == 1);
+	CHECK(mesh->get_lod_level() == 1);
+	CHECK_MESSAGE(mesh->surface_get_array_len(0) == 3, "The resident level should only keep the vertices its indices use.");
+
+	CHECK(mesh->load_lod_level(0) == OK);
+	CHECK(mesh->get_lod_level() == 0);
+	CHECK(mesh->surface_get_array_len(0) == vertices.size());
+	CHECK(mesh->surface_get_name(0) == "Grid");
+
+	ERR_PRINT_OFF;
+	CHECK(mesh->load_lod_level(2) != OK);
+	ERR_PRINT_ON;
+	CHECK_FALSE(mesh->is_streamed());
+}
+
+} // namespace TestStreamedMesh
+
+#endif // TEST_STREAMED_MESH_H
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_audio_stream.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_STREAM_H
+#define TEST_AUDIO_STREAM_H
+
+#include "core/math/math_funcs.h"
+#include "servers/audio/audio_stream.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStream {
+
+// Plays the index of each frame, at the mix rate so the resampler passes the frames through.
+class RampPlayback : public AudioStreamPlaybackResampled {
+	uint32_t position = 0;
+	uint32_t length = 0;
+	bool active = false;
+
+protected:
+	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override {
+		int mixed = 0;
+		while (mixed < p_frames && active) {
+			if (position >= length) {
+				active = false;
+				break;
+			}
+			p_buffer[mixed++] = AudioFrame(position, position);
+			position++;
+		}
+		return mixed;
+	}
+
+	virtual float get_stream_sampling_rate() override {
+		return AudioServer::get_singleton()->get_mix_rate();
+	}
+
+	virtual void _start_decoder(double p_from_pos) override {
+		active = true;
+		_seek_decoder(p_from_pos);
+	}
+
+	virtual void _seek_decoder(double p_time) override {
+		position = uint32_t(p_time * get_stream_sampling_rate());
+	}
+
+	virtual void _stop_decoder() override {
+		active = false;
+	}
+
+public:
+	virtual void start(double p_from_pos = 0.0) override {
+		start_decoder(p_from_pos);
+		begin_resample();
+	}
+
+	virtual void stop() override {
+		stop_decoder();
+	}
+
+	virtual bool is_playing() const override {
+		return is_decoder_playing(active);
+	}
+
+	virtual void seek(double p_time) override {
+		seek_decoder(p_time);
+	}
+
+	void init(uint32_t p_length) {
+		length = p_length;
+		set_background_decode(true);
+	}
+};
+
+TEST_CASE("[Audio][AudioStreamPlaybackResampled] Frames are mixed in order") {
+	Ref<RampPlayback> playback;
+	playback.instantiate();
+	playback->init(AudioServer::get_singleton()->get_mix_rate() * 4);
+	playback->start();
+	CHECK(playback->is_playing());
+
+	const int frame_count = 4096;
+	Vector<AudioFrame> buffer;
+	buffer.resize(frame_count);
+	for (int block = 0; block < 8; block++) {
+		CHECK(playback->mix(buffer.ptrw(), 1.0, frame_count) == frame_count);
+		// The first frames come after the silent interpolation history.
+		for (int i = block == 0 ? 32 : 1; i < frame_count; i++) {
+			CHECK_MESSAGE(Math::is_equal_approx(buffer[i].left - buffer[i - 1].left, 1.0f, 0.05f), vformat("Frame %d of block %d is out of order.", i, block));
+		}
+	}
+}
+
+TEST_CASE("[Audio][AudioStreamPlaybackResampled] Seek and stop") {
+	const float mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	Ref<RampPlayback> playback;
+	playback.instantiate();
+	playback->init(mix_rate * 4);
+	playback->start();
+
+	const int frame_count = 4096;
+	Vector<AudioFrame> buffer;
+	buffer.resize(frame_count);
+	CHECK(playback->mix(buffer.ptrw(), 1.0, frame_count) == frame_count);
+
+	// Frames decoded ahead before the seek are dropped.
+	playback->seek(1.0);
+	CHECK(playback->is_playing());
+	CHECK(playback->mix(buffer.ptrw(), 1.0, frame_count) == frame_count);
+	CHECK(buffer[frame_count - 1].left >= mix_rate);
+	CHECK(buffer[frame_count - 1].left <= mix_rate + frame_count);
+
+	playback->stop();
+	CHECK_FALSE(playback->is_playing());
+}
+
+TEST_CASE("[Audio][AudioStreamPlaybackResampled] Short stream ends") {
+	Ref<RampPlayback> playback;
+	playback.instantiate();
+	playback->init(1000);
+	playback->start();
+
+	const int frame_count = 4096;
+	Vector<AudioFrame> buffer;
+	buffer.resize(frame_count);
+	const int mixed = playback->mix(buffer.ptrw(), 1.0, frame_count);
+	CHECK(mixed > 0);
+	CHECK(mixed < frame_count);
+}
+
+} // namespace TestAudioStream
+
+#endif // TEST_AUDIO_STREAM_H
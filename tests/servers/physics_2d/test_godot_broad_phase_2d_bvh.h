@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_godot_broad_phase_2d_bvh.h                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_BROAD_PHASE_2D_BVH_H
+#define TEST_GODOT_BROAD_PHASE_2D_BVH_H
+
+#include "core/math/random_pcg.h"
+#include "servers/physics_2d/godot_body_2d.h"
+#include "servers/physics_2d/godot_broad_phase_2d_bvh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotBroadPhase2DBVH {
+
+struct PairTracker {
+	HashMap<const GodotCollisionObject2D *, uint32_t> indices;
+	HashSet<uint64_t> pairs;
+	int duplicate_pairs = 0;
+	int unknown_unpairs = 0;
+
+	uint64_t key(const GodotCollisionObject2D *p_a, const GodotCollisionObject2D *p_b) const {
+		const uint64_t a = indices[p_a];
+		const uint64_t b = indices[p_b];
+		return a < b ? (a << 32) | b : (b << 32) | a;
+	}
+
+	static void *pair(GodotCollisionObject2D *p_a, int p_subindex_a, GodotCollisionObject2D *p_b, int p_subindex_b, void *p_userdata) {
+		PairTracker *tracker = static_cast<PairTracker *>(p_userdata);
+		const uint64_t k = tracker->key(p_a, p_b);
+		if (tracker->pairs.has(k)) {
+			tracker->duplicate_pairs++;
+		}
+		tracker->pairs.insert(k);
+		return nullptr;
+	}
+
+	static void unpair(GodotCollisionObject2D *p_a, int p_subindex_a, GodotCollisionObject2D *p_b, int p_subindex_b, void *p_data, void *p_userdata) {
+		PairTracker *tracker = static_cast<PairTracker *>(p_userdata);
+		if (!tracker->pairs.erase(tracker->key(p_a, p_b))) {
+			tracker->unknown_unpairs++;
+		}
+	}
+};
+
+// Every pair of overlapping rects must be paired.
+static int count_missing_pairs(const PairTracker &p_tracker, const LocalVector<Rect2> &p_rects) {
+	int missing = 0;
+	for (uint32_t i = 0; i < p_rects.size(); i++) {
+		for (uint32_t j = i + 1; j < p_rects.size(); j++) {
+			if (p_rects[i].intersects(p_rects[j]) && !p_tracker.pairs.has((uint64_t(i) << 32) | j)) {
+				missing++;
+			}
+		}
+	}
+	return missing;
+}
+
+TEST_CASE("[GodotBroadPhase2DBVH] Pairing many moving items") {
+	// Above the threshold of the BVH, so the pair candidates are found on worker threads.
+	static const int COLUMNS = 32;
+	static const int ROWS = 16;
+	static const int ITEM_COUNT = COLUMNS * ROWS;
+
+	GodotBroadPhase2DBVH broad_phase;
+	PairTracker tracker;
+	broad_phase.set_pair_callback(PairTracker::pair, &tracker);
+	broad_phase.set_unpair_callback(PairTracker::unpair, &tracker);
+
+	// Neighbors on a grid overlap.
+	LocalVector<GodotBody2D *> bodies;
+	LocalVector<GodotBroadPhase2D::ID> ids;
+	LocalVector<Rect2> rects;
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		GodotBody2D *body = memnew(GodotBody2D);
+		tracker.indices[body] = i;
+		const Rect2 rect(Vector2((i % COLUMNS) * 10.0, (i / COLUMNS) * 10.0), Vector2(12, 12));
+		bodies.push_back(body);
+		rects.push_back(rect);
+		ids.push_back(broad_phase.create(body, 0, rect, false));
+	}
+	broad_phase.update();
+
+	CHECK(tracker.pairs.size() > 0);
+	CHECK(count_missing_pairs(tracker, rects) == 0);
+
+	RandomPCG rng(4321);
+	for (int step = 0; step < 8; step++) {
+		for (int i = 0; i < ITEM_COUNT; i++) {
+			rects[i].position += Vector2(rng.random(-6, 6), rng.random(-6, 6));
+			broad_phase.move(ids[i], rects[i]);
+		}
+		broad_phase.update();
+		CHECK_MESSAGE(count_missing_pairs(tracker, rects) == 0, vformat("Overlapping items should be paired after step %d.", step));
+	}
+
+	// Spreading everything out unpairs all items.
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		rects[i].position = Vector2((i % COLUMNS) * 1000.0, (i / COLUMNS) * 1000.0);
+		broad_phase.move(ids[i], rects[i]);
+	}
+	broad_phase.update();
+	CHECK(tracker.pairs.is_empty());
+
+	CHECK(tracker.duplicate_pairs == 0);
+	CHECK(tracker.unknown_unpairs == 0);
+
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		broad_phase.remove(ids[i]);
+		memdelete(bodies[i]);
+	}
+}
+
+} // namespace TestGodotBroadPhase2DBVH
+
+#endif // TEST_GODOT_BROAD_PHASE_2D_BVH_H
@@ -672,6 +672,47 @@ TEST_SUITE("[Navigation]") {
 		memdelete(node_3d);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation meshes") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(4.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+
+		SUBCASE("Paths should cross the tile borders") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			const Vector3 target = Vector3(8, 0, 8);
+			Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-8, 0, -8), target, true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK_LT(path[path.size() - 1].distance_to(target), 1.0);
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+		}
+
+		SUBCASE("Rebaking unchanged source geometry should yield the same result") {
+			const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			const int polygon_count = navigation_mesh->get_polygon_count();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(navigation_mesh->get_vertices(), vertices);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+		}
+	}
+
 	// This test case does not check precise values on purpose - to not be too sensitivte.
 	TEST_CASE("[NavigationServer3D] Server should respond to queries against valid map properly") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -763,6 +804,30 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Asynchronous queries should pass their results in submission order") {
+			TypedArray<NavigationPathQueryParameters3D> queries;
+			for (int i = 0; i < 2; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(0, 0, 0));
+				query_parameters->set_target_position(Vector3(10, 0, 10));
+				// The second query can't find a path.
+				query_parameters->set_navigation_layers(i == 0 ? 1 : 2);
+				queries.push_back(query_parameters);
+			}
+			CallableMock query_callback_mock;
+			navigation_server->query_paths_async(queries, callable_mp(&query_callback_mock, &CallableMock::function1));
+			navigation_server->process(0.0); // Waits for the running queries.
+			CHECK_EQ(query_callback_mock.function1_calls, 1);
+
+			Array results = query_callback_mock.function1_latest_arg0;
+			REQUIRE_EQ(results.size(), 2);
+			Ref<NavigationPathQueryResult3D> result_with_path = results[0];
+			Ref<NavigationPathQueryResult3D> result_without_path = results[1];
+			CHECK_NE(result_with_path->get_path().size(), 0);
+			CHECK_EQ(result_without_path->get_path().size(), 0);
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->process(0.0); // Give server some cycles to commit.
@@ -0,0 +1,228 @@
+/**************************************************************************/
+/*  test_bench.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "test_bench.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "core/templates/sort_array.h"
+#include "core/version.h"
+
+namespace Benchmarks {
+
+struct Result {
+	String name;
+	uint64_t ops = 1;
+	uint32_t iterations = 0;
+	double min_usec = 0.0;
+	double median_usec = 0.0;
+	double mean_usec = 0.0;
+	double max_usec = 0.0;
+};
+
+static LocalVector<Result> results;
+
+static uint64_t min_time_usec = 250000;
+static uint32_t min_iterations = 3;
+static uint32_t max_iterations = 1000000;
+static int warmup_iterations = 1;
+static String output_path;
+static String baseline_path;
+static double tolerance = 0.1;
+
+bool parse_argument(const String &p_arg) {
+	if (p_arg == "--bench") {
+		return true;
+	} else if (p_arg.begins_with("--bench-time=")) {
+		min_time_usec = MAX(p_arg.get_slice("=", 1).to_float(), 0.0) * 1000000.0;
+		return true;
+	} else if (p_arg.begins_with("--bench-output=")) {
+		output_path = p_arg.get_slice("=", 1);
+		return true;
+	} else if (p_arg.begins_with("--bench-baseline=")) {
+		baseline_path = p_arg.get_slice("=", 1);
+		return true;
+	} else if (p_arg.begins_with("--bench-tolerance=")) {
+		tolerance = MAX(p_arg.get_slice("=", 1).to_float(), 0.0);
+		return true;
+	}
+	return false;
+}
+
+void print_help() {
+	print_line("Benchmark options:");
+	print_line("  --bench                       Run the benchmarks instead of the tests. Use --test-case=<pattern> to filter them.");
+	print_line("  --bench-time=<seconds>        Minimum time spent on each benchmark (default: 0.25).");
+	print_line("  --bench-output=<file>         Write the results as JSON to the given file instead of the standard output.");
+	print_line("  --bench-baseline=<file>       Compare the results against a previous JSON output and fail on regressions.");
+	print_line("  --bench-tolerance=<ratio>     Slowdown of the median time tolerated against the baseline (default: 0.1).");
+}
+
+static void _add_result(const String &p_name, uint64_t p_ops, LocalVector<uint64_t> &p_samples) {
+	ERR_FAIL_COND_MSG(p_samples.is_empty(), vformat("Benchmark \"%s\" has no samples.", p_name));
+
+	for (const Result &E : results) {
+		ERR_FAIL_COND_MSG(E.name == p_name, vformat("Duplicate benchmark name \"%s\".", p_name));
+	}
+
+	SortArray<uint64_t> sorter;
+	sorter.sort(p_samples.ptr(), p_samples.size());
+
+	Result result;
+	result.name = p_name;
+	result.ops = p_ops;
+	result.iterations = p_samples.size();
+	result.min_usec = p_samples[0];
+	result.max_usec = p_samples[p_samples.size() - 1];
+	if (p_samples.size() % 2) {
+		result.median_usec = p_samples[p_samples.size() / 2];
+	} else {
+		result.median_usec = (p_samples[p_samples.size() / 2 - 1] + p_samples[p_samples.size() / 2]) * 0.5;
+	}
+	uint64_t total = 0;
+	for (uint64_t sample : p_samples) {
+		total += sample;
+	}
+	result.mean_usec = double(total) / p_samples.size();
+	results.push_back(result);
+
+	print_line(vformat("%-48s %10.1f us/iter %14.0f ops/s (%d iterations)", p_name, result.median_usec, p_ops * 1000000.0 / MAX(result.median_usec, 1.0), result.iterations));
+}
+
+static int _compare_baseline(const Dictionary &p_baseline) {
+	HashMap<String, double> baseline_medians;
+	const Array baseline_results = p_baseline.get("results", Array());
+	for (int i = 0; i < baseline_results.size(); i++) {
+		const Dictionary entry = baseline_results[i];
+		baseline_medians[entry.get("name", String())] = entry.get("median_usec", 0.0);
+	}
+
+	int regressions = 0;
+	for (const Result &E : results) {
+		HashMap<String, double>::ConstIterator base = baseline_medians.find(E.name);
+		if (!base || base->value <= 0.0) {
+			continue;
+		}
+		const double change = E.median_usec / base->value - 1.0;
+		if (change > tolerance) {
+			print_line(vformat("REGRESSION %s: %.1f us -> %.1f us (%+.1f%%)", E.name, base->value, E.median_usec, change * 100.0));
+			regressions++;
+		}
+	}
+	return regressions;
+}
+
+int finish() {
+	Array json_results;
+	for (const Result &E : results) {
+		Dictionary entry;
+		entry["name"] = E.name;
+		entry["ops_per_iteration"] = E.ops;
+		entry["iterations"] = E.iterations;
+		entry["min_usec"] = E.min_usec;
+		entry["median_usec"] = E.median_usec;
+		entry["mean_usec"] = E.mean_usec;
+		entry["max_usec"] = E.max_usec;
+		entry["ops_per_sec"] = E.ops * 1000000.0 / MAX(E.median_usec, 1.0);
+		json_results.push_back(entry);
+	}
+
+	Dictionary report;
+	report["version"] = 1;
+	report["engine"] = VERSION_FULL_BUILD;
+	report["min_time_usec"] = min_time_usec;
+	report["results"] = json_results;
+
+	const String json = JSON::stringify(report, "\t", false);
+	if (output_path.is_empty()) {
+		print_line(json);
+	} else {
+		Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE);
+		ERR_FAIL_COND_V_MSG(f.is_null(), 1, vformat("Can't open benchmark output file \"%s\".", output_path));
+		f->store_string(json);
+	}
+
+	int regressions = 0;
+	if (!baseline_path.is_empty()) {
+		const String baseline_text = FileAccess::get_file_as_string(baseline_path);
+		ERR_FAIL_COND_V_MSG(baseline_text.is_empty(), 1, vformat("Can't read benchmark baseline file \"%s\".", baseline_path));
+		const Dictionary baseline = JSON::parse_string(baseline_text);
+		regressions = _compare_baseline(baseline);
+		print_line(vformat("%d benchmark regression(s) over %.0f%% against \"%s\".", regressions, tolerance * 100.0, baseline_path));
+	}
+
+	results.clear();
+	return regressions;
+}
+
+} // namespace Benchmarks
+
+BenchmarkRun::BenchmarkRun(const String &p_name, uint64_t p_ops) {
+	name = p_name;
+	ops = MAX(p_ops, uint64_t(1));
+	warmup_left = Benchmarks::warmup_iterations;
+}
+
+bool BenchmarkRun::next() {
+	const uint64_t now = OS::get_singleton()->get_ticks_usec();
+
+	if (!started) {
+		started = true;
+		run_start = now;
+	} else if (warmup_left > 0) {
+		warmup_left--;
+		// Don't count the warmup in the time budget.
+		run_start = now;
+	} else {
+		samples.push_back(now - iteration_start - paused);
+		const uint64_t elapsed = now - run_start;
+		if (samples.size() >= Benchmarks::max_iterations || (samples.size() >= Benchmarks::min_iterations && elapsed >= Benchmarks::min_time_usec)) {
+			_finish();
+			return false;
+		}
+	}
+
+	paused = 0;
+	iteration_start = OS::get_singleton()->get_ticks_usec();
+	return true;
+}
+
+void BenchmarkRun::pause() {
+	pause_start = OS::get_singleton()->get_ticks_usec();
+}
+
+void BenchmarkRun::resume() {
+	paused += OS::get_singleton()->get_ticks_usec() - pause_start;
+}
+
+void BenchmarkRun::_finish() {
+	Benchmarks::_add_result(name, ops, samples);
+}
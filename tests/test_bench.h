@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  test_bench.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BENCH_H
+#define TEST_BENCH_H
+
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Benchmarks are regular doctest cases living in test suites whose name starts
+// with `[Benchmark]`. They are excluded from normal test runs and run with
+// `godot --test --bench`, optionally filtered with `--test-case=<pattern>`.
+//
+// Each `BENCHMARK()` block is executed repeatedly until the configured minimum
+// time is reached, and the timing of every iteration is recorded:
+//
+//	TEST_SUITE("[Benchmark][HashMap]") {
+//		TEST_CASE("Insertion") {
+//			BENCHMARK("HashMap/insert_int", 10000) {
+//				HashMap<int, int> map;
+//				for (int i = 0; i < 10000; i++) {
+//					map.insert(i, i);
+//				}
+//				bench_do_not_optimize(map.size());
+//			}
+//		}
+//	}
+//
+// The second argument is the number of operations done by one iteration, it
+// is used to report the throughput. Names must be unique as they are the keys
+// used to compare results between runs.
+
+#define BENCHMARK(m_name, m_ops) for (BenchmarkRun _bench_run(m_name, m_ops); _bench_run.next();)
+
+// Excludes the code in between from the timing of the current iteration, for
+// per-iteration setup that must not be measured.
+#define BENCHMARK_PAUSE_TIMING() _bench_run.pause()
+#define BENCHMARK_RESUME_TIMING() _bench_run.resume()
+
+// Prevents the compiler from discarding a computation whose result is unused.
+template <typename T>
+_FORCE_INLINE_ void bench_do_not_optimize(const T &p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(p_value) : "memory");
+#else
+	static volatile const T *sink;
+	sink = &p_value;
+	(void)sink;
+#endif
+}
+
+class BenchmarkRun {
+	String name;
+	uint64_t ops = 1;
+
+	LocalVector<uint64_t> samples;
+	uint64_t run_start = 0;
+	uint64_t iteration_start = 0;
+	uint64_t pause_start = 0;
+	uint64_t paused = 0;
+	int warmup_left = 0;
+	bool started = false;
+
+	void _finish();
+
+public:
+	bool next();
+	void pause();
+	void resume();
+
+	BenchmarkRun(const String &p_name, uint64_t p_ops);
+};
+
+namespace Benchmarks {
+
+// Returns `true` if the argument is a benchmark option and was consumed.
+bool parse_argument(const String &p_arg);
+void print_help();
+
+// Writes the results and compares them against the baseline, if any.
+// Returns the number of regressions found.
+int finish();
+
+} // namespace Benchmarks
+
+#endif // TEST_BENCH_H
@@ -37,7 +37,11 @@
 #include "editor/editor_settings.h"
 #endif // TOOLS_ENABLED
 
+#include "tests/benchmarks/bench_core.h"
+#include "tests/benchmarks/bench_physics.h"
+#include "tests/benchmarks/bench_scene.h"
 #include "tests/core/config/test_project_settings.h"
+#include "tests/core/debugger/test_engine_trace.h"
 #include "tests/core/input/test_input_event.h"
 #include "tests/core/input/test_input_event_key.h"
 #include "tests/core/input/test_input_event_mouse.h"
@@ -49,6 +53,7 @@
 #include "tests/core/io/test_ip.h"
 #include "tests/core/io/test_json.h"
 #include "tests/core/io/test_marshalls.h"
+#include "tests/core/io/test_packed_byte_array_slice.h"
 #include "tests/core/io/test_pck_packer.h"
 #include "tests/core/io/test_resource.h"
 #include "tests/core/io/test_xml_parser.h"
@@ -74,12 +79,15 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/object/test_undo_redo.h"
+#include "tests/core/os/test_memory.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
+#include "tests/core/string/test_string_name.h"
 #include "tests/core/string/test_translation.h"
 #include "tests/core/string/test_translation_server.h"
 #include "tests/core/templates/test_command_queue.h"
@@ -89,8 +97,10 @@
 #include "tests/core/templates/test_local_vector.h"
 #include "tests/core/templates/test_lru.h"
 #include "tests/core/templates/test_oa_hash_map.h"
+#include "tests/core/templates/test_paged_allocator.h"
 #include "tests/core/templates/test_paged_array.h"
 #include "tests/core/templates/test_rid.h"
+#include "tests/core/templates/test_sort_array.h"
 #include "tests/core/templates/test_vector.h"
 #include "tests/core/test_crypto.h"
 #include "tests/core/test_hashing_context.h"
@@ -105,10 +115,12 @@
 #include "tests/scene/test_audio_stream_wav.h"
 #include "tests/scene/test_bit_map.h"
 #include "tests/scene/test_camera_2d.h"
+#include "tests/scene/test_compressed_texture.h"
 #include "tests/scene/test_control.h"
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_curve_2d.h"
 #include "tests/scene/test_curve_3d.h"
+#include "tests/scene/test_font_file.h"
 #include "tests/scene/test_gradient.h"
 #include "tests/scene/test_image_texture.h"
 #include "tests/scene/test_image_texture_3d.h"
@@ -118,12 +130,15 @@
 #include "tests/scene/test_packed_scene.h"
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_follow_2d.h"
+#include "tests/scene/test_scene_pool.h"
 #include "tests/scene/test_sprite_frames.h"
 #include "tests/scene/test_theme.h"
 #include "tests/scene/test_timer.h"
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/audio/test_audio_stream.h"
+#include "tests/servers/physics_2d/test_godot_broad_phase_2d_bvh.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
@@ -149,14 +164,17 @@
 
 #include "tests/scene/test_arraymesh.h"
 #include "tests/scene/test_camera_3d.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"
+#include "tests/scene/test_streamed_mesh.h"
 #endif // _3D_DISABLED
 
 #include "modules/modules_tests.gen.h"
 
 #include "tests/display_server_mock.h"
+#include "tests/test_bench.h"
 #include "tests/test_macros.h"
 
 #include "scene/theme/theme_db.h"
@@ -202,15 +220,23 @@ int test_main(int argc, char *argv[]) {
 	// Doctest runner.
 	doctest::Context test_context;
 	LocalVector<String> test_args;
+	const bool run_benchmarks = args.find("--bench") != nullptr;
 
-	// Clean arguments of "--test" from the args.
+	// Clean arguments of "--test" and benchmark options from the args.
 	for (int x = 0; x < argc; x++) {
 		String arg = String(argv[x]);
-		if (arg != "--test") {
+		if (arg != "--test" && !Benchmarks::parse_argument(arg)) {
 			test_args.push_back(arg);
 		}
 	}
 
+	// Benchmarks are regular test cases, but only run when explicitly requested.
+	if (run_benchmarks) {
+		test_context.addFilter("test-suite", "[Benchmark]*");
+	} else {
+		test_context.addFilter("test-suite-exclude", "[Benchmark]*");
+	}
+
 	if (test_args.size() > 0) {
 		// Convert Godot command line arguments back to standard arguments.
 		char **doctest_args = new char *[test_args.size()];
@@ -232,7 +258,15 @@ int test_main(int argc, char *argv[]) {
 		delete[] doctest_args;
 	}
 
-	return test_context.run();
+	int status = test_context.run();
+	if (args.find("--help") || args.find("-h")) {
+		Benchmarks::print_help();
+	} else if (run_benchmarks) {
+		if (Benchmarks::finish() > 0 && status == 0) {
+			status = 1;
+		}
+	}
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,15 @@ private:
 	IPAddress local_address;
 	bool bound = false;
 
+	// Datagrams are drained from the socket in batches and handed out one by one.
+	enum {
+		RECV_BATCH_SIZE = 16,
+	};
+	uint8_t recv_buffer[RECV_BATCH_SIZE][ENET_PROTOCOL_MAXIMUM_MTU];
+	NetSocket::Datagram recv_batch[RECV_BATCH_SIZE];
+	int recv_count = 0;
+	int recv_next = 0;
+
 public:
 	ENetUDP() {
 		sock = Ref<NetSocket>(NetSocket::create());
@@ -104,11 +113,28 @@ public:
 	}
 
 	Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port) {
-		Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
-		if (err != OK) {
-			return err;
+		if (recv_next == recv_count) {
+			Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
+			if (err != OK) {
+				return err;
+			}
+			for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+				recv_batch[i].buffer = recv_buffer[i];
+				recv_batch[i].len = ENET_PROTOCOL_MAXIMUM_MTU;
+			}
+			recv_next = 0;
+			recv_count = 0;
+			err = sock->recvfrom_batch(recv_batch, RECV_BATCH_SIZE, recv_count);
+			if (err != OK) {
+				return err;
+			}
 		}
-		return sock->recvfrom(p_buffer, p_len, r_read, r_ip, r_port);
+		const NetSocket::Datagram &d = recv_batch[recv_next++];
+		r_read = MIN(p_len, d.len);
+		memcpy(p_buffer, d.buffer, r_read);
+		r_ip = d.ip;
+		r_port = d.port;
+		return OK;
 	}
 
 	int set_option(ENetSocketOption p_option, int p_value) {
@@ -156,6 +182,8 @@ public:
 	void close() {
 		sock->close();
 		local_address.clear();
+		recv_count = 0;
+		recv_next = 0;
 	}
 };
 
@@ -32,6 +32,59 @@
 
 #define wslay_min(A, B) (((A) < (B)) ? (A) : (B))
 
+/* GODOT ADDITION */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WSLAY_MASK_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define WSLAY_MASK_NEON
+#endif
+
+/* XORs len bytes of src with the 4 bytes mask key into dst (which may be
+ * src), off being the payload offset of the first byte. */
+static void wslay_mask(uint8_t *dst, const uint8_t *src, size_t len,
+                       const uint8_t *key, uint64_t off) {
+  uint8_t rkey[16];
+  size_t i = 0;
+  for (i = 0; i < 16; ++i) {
+    rkey[i] = key[(off + i) % 4];
+  }
+  i = 0;
+#if defined(WSLAY_MASK_SSE2)
+  {
+    const __m128i m = _mm_loadu_si128((const __m128i *)rkey);
+    for (; i + 16 <= len; i += 16) {
+      _mm_storeu_si128(
+          (__m128i *)(dst + i),
+          _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src + i)), m));
+    }
+  }
+#elif defined(WSLAY_MASK_NEON)
+  {
+    const uint8x16_t m = vld1q_u8(rkey);
+    for (; i + 16 <= len; i += 16) {
+      vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), m));
+    }
+  }
+#else
+  {
+    uint64_t m;
+    memcpy(&m, rkey, 8);
+    for (; i + 8 <= len; i += 8) {
+      uint64_t v;
+      memcpy(&v, src + i, 8);
+      v ^= m;
+      memcpy(dst + i, &v, 8);
+    }
+  }
+#endif
+  for (; i < len; ++i) {
+    dst[i] = src[i] ^ rkey[i % 16];
+  }
+}
+/* GODOT END */
+
 int wslay_frame_context_init(wslay_frame_context_ptr *ctx,
                              const struct wslay_frame_callbacks *callbacks,
                              void *user_data) {
@@ -140,10 +193,10 @@ ssize_t wslay_frame_send(wslay_frame_context_ptr ctx,
               datamark + wslay_min(sizeof(temp), datalen);
           size_t writelen = (size_t)(writelimit - datamark);
           ssize_t r;
-          size_t i;
-          for (i = 0; i < writelen; ++i) {
-            temp[i] = datamark[i] ^ ctx->omaskkey[(ctx->opayloadoff + i) % 4];
-          }
+          /* GODOT ADDITION */
+          wslay_mask(temp, datamark, writelen, ctx->omaskkey,
+                     ctx->opayloadoff);
+          /* GODOT END */
           r = ctx->callbacks.send_callback(temp, writelen, 0, ctx->user_data);
           if (r > 0) {
             if ((size_t)r > writelen) {
@@ -189,7 +242,6 @@ ssize_t wslay_frame_write(wslay_frame_context_ptr ctx,
                           struct wslay_frame_iocb *iocb, uint8_t *buf,
                           size_t buflen, size_t *pwpayloadlen) {
   uint8_t *buf_last = buf;
-  size_t i;
   size_t hdlen;
 
   *pwpayloadlen = 0;
@@ -268,10 +320,11 @@ ssize_t wslay_frame_write(wslay_frame_context_ptr ctx,
       size_t writelen = wslay_min(buflen, iocb->data_length);
 
       if (ctx->omask) {
-        for (i = 0; i < writelen; ++i) {
-          *buf_last++ =
-              iocb->data[i] ^ ctx->omaskkey[(ctx->opayloadoff + i) % 4];
-        }
+        /* GODOT ADDITION */
+        wslay_mask(buf_last, iocb->data, writelen, ctx->omaskkey,
+                   ctx->opayloadoff);
+        buf_last += writelen;
+        /* GODOT END */
       } else {
         memcpy(buf_last, iocb->data, writelen);
         buf_last += writelen;
@@ -414,9 +467,12 @@ ssize_t wslay_frame_recv(wslay_frame_context_ptr ctx,
                     ? ctx->ibuflimit
                     : ctx->ibufmark + rempayloadlen;
     if (ctx->imask) {
-      for (; ctx->ibufmark != readlimit; ++ctx->ibufmark, ++ctx->ipayloadoff) {
-        ctx->ibufmark[0] ^= ctx->imaskkey[ctx->ipayloadoff % 4];
-      }
+      /* GODOT ADDITION */
+      wslay_mask(readmark, readmark, (size_t)(readlimit - readmark),
+                 ctx->imaskkey, ctx->ipayloadoff);
+      ctx->ipayloadoff += (uint64_t)(readlimit - readmark);
+      ctx->ibufmark = readlimit;
+      /* GODOT END */
     } else {
       ctx->ibufmark = readlimit;
       ctx->ipayloadoff += (uint64_t)(readlimit - readmark);